@@ -15,6 +15,18 @@ CFTypeID CFBooleanGetTypeID(void) {
 }
 
 CFNumberType CFNumberGetType(CFNumberRef self) {
+   if(objc_isTaggedPointer(self)){
+    switch(*[ToNSNumber(self) objCType]){
+     case 'c': case 'C': return kCFNumberCharType;
+     case 's': case 'S': return kCFNumberShortType;
+     case 'i': case 'I': return kCFNumberIntType;
+     case 'l': case 'L': return kCFNumberLongType;
+     case 'q': case 'Q': return kCFNumberLongLongType;
+     case 'f': return kCFNumberFloatType;
+     case 'd': return kCFNumberDoubleType;
+    }
+   }
+
    if([ToNSNumber(self) isKindOfClass:[NSNumber_CF class]])
     return ((NSNumber_CF *)self)->_type;
 
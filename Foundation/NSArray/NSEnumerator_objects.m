@@ -0,0 +1,47 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSEnumerator_objects.h>
+#import <Foundation/NSArray_concrete.h>
+#import <Foundation/NSAutoreleasePool-private.h>
+
+@implementation NSEnumerator_objects
+
+NSEnumerator *NSEnumerator_objectsNew(id owner,id *objects,NSUInteger count) {
+   NSEnumerator_objects *self=NSAllocateObject([NSEnumerator_objects class],0,NULL);
+
+   self->_owner=[owner retain];
+   self->_objects=objects;
+   self->_count=count;
+   self->_index=0;
+
+   return self;
+}
+
+-(void)dealloc {
+   [_owner release];
+   NSDeallocateObject(self);
+   return;
+   [super dealloc];
+}
+
+-nextObject {
+   if(_index>=_count)
+    return nil;
+
+   return _objects[_index++];
+}
+
+-(NSArray *)allObjects {
+   NSArray *result=NSArray_concreteNew(NULL,_objects+_index,_count-_index);
+
+   _index=_count;
+
+   return NSAutorelease(result);
+}
+
+@end
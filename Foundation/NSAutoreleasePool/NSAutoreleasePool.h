@@ -9,7 +9,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSObject.h>
 
 @interface NSAutoreleasePool : NSObject {
-    struct objc_autoreleasepool *_pool;
+    void *_pool;
 }
 
 + (void)addObject:object;
@@ -10,7 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSRaise.h>
 #import <Foundation/NSCoder.h>
 #import <Foundation/NSPlatform.h>
-#import <Foundation/NSDate_timeInterval.h>
+#import <Foundation/NSDate_placeholder.h>
 #import <Foundation/NSDateFormatter.h>
 
 const NSTimeInterval NSTimeIntervalSince1970 = (NSTimeInterval)978307200.0;
@@ -21,7 +21,7 @@ const NSTimeInterval NSTimeIntervalSince1970 = (NSTimeInterval)978307200.0;
 
 +allocWithZone:(NSZone *)zone {
    if(self==[NSDate class])
-    return NSAllocateObject([NSDate_timeInterval class],0,zone);
+    return [NSDate_placeholder _sharedInstance];
 
    return NSAllocateObject(self,0,zone);
 }
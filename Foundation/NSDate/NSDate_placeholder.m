@@ -0,0 +1,56 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSDate_placeholder.h>
+#import <Foundation/NSDate_tagged.h>
+#import <Foundation/NSDate_timeInterval.h>
+#include <limits.h>
+
+static NSDate_placeholder *sSharedInstance;
+
+// +[NSDate alloc] returns this, the initializer picks a tagged or a heap date
+@implementation NSDate_placeholder
+
++(void)initialize {
+   if(self==objc_lookUpClass("NSDate_placeholder"))
+      sSharedInstance=NSAllocateObject([NSDate_placeholder class],0,NULL);
+}
+
++_sharedInstance {
+   return sSharedInstance;
+}
+
+-(void)dealloc {
+   return;
+   [super dealloc];  // Silence compiler warning
+}
+
+-(id)retain {
+   return self;
+}
+
+-(oneway void)release {
+}
+
+-(id)autorelease {
+   return self;
+}
+
+-(NSUInteger)retainCount {
+   return UINT_MAX;
+}
+
+-initWithTimeIntervalSinceReferenceDate:(NSTimeInterval)seconds {
+   NSDate *result=NSDate_taggedNewWithTimeInterval(seconds);
+
+   if(result==nil)
+    result=[NSAllocateObject([NSDate_timeInterval class],0,NULL) initWithTimeIntervalSinceReferenceDate:seconds];
+
+   return (NSDate_placeholder *)result;
+}
+
+@end
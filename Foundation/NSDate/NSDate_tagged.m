@@ -0,0 +1,94 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSDate_tagged.h>
+#include <limits.h>
+#include <string.h>
+
+#define NSDateTaggedExponentBias 959 // biased exponents 960...1086 map to 1...127, 0 is +0.0
+
+static inline NSTimeInterval NSDateTaggedInterval(NSDate *self) {
+   uint64_t       payload=objc_getTaggedPointerValue(self);
+   uint64_t       bits=0;
+   NSTimeInterval result;
+
+   if(payload!=0){
+    uint64_t sign=(payload>>59)&1;
+    uint64_t exponent=((payload>>52)&0x7F)+NSDateTaggedExponentBias;
+
+    bits=(sign<<63)|(exponent<<52)|(payload&0xFFFFFFFFFFFFFULL);
+   }
+
+   memcpy(&result,&bits,sizeof(NSTimeInterval));
+   return result;
+}
+
+NSDate *NSDate_taggedNewWithTimeInterval(NSTimeInterval interval) {
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   uint64_t bits,exponent,payload=0;
+
+   memcpy(&bits,&interval,sizeof(NSTimeInterval));
+
+   if(bits!=0){
+    exponent=(bits>>52)&0x7FF;
+
+    // also rules out -0.0, denormals, infinities and NaN
+    if(exponent<=NSDateTaggedExponentBias || exponent>NSDateTaggedExponentBias+127)
+     return nil;
+
+    payload=((bits>>63)<<59)|((exponent-NSDateTaggedExponentBias)<<52)|(bits&0xFFFFFFFFFFFFFULL);
+   }
+
+   if(objc_taggedPointerClasses[OBJC_TAG_NSDate]==Nil)
+    objc_registerTaggedPointerClass(OBJC_TAG_NSDate,[NSDate_tagged class]);
+
+   return objc_makeTaggedPointer(OBJC_TAG_NSDate,payload);
+#else
+   return nil;
+#endif
+}
+
+@implementation NSDate_tagged
+
+// [[self class] alloc] gets a regular instance, which may well turn out tagged again
++allocWithZone:(NSZone *)zone {
+   return [NSDate allocWithZone:zone];
+}
+
++(BOOL)accessInstanceVariablesDirectly {
+   return NO;
+}
+
+-(void)dealloc {
+   return;
+   [super dealloc];  // Silence compiler warning
+}
+
+-(id)retain {
+   return self;
+}
+
+-(oneway void)release {
+}
+
+-(id)autorelease {
+   return self;
+}
+
+-(NSUInteger)retainCount {
+   return UINT_MAX;
+}
+
+-copyWithZone:(NSZone *)zone {
+   return self;
+}
+
+-(NSTimeInterval)timeIntervalSinceReferenceDate {
+   return NSDateTaggedInterval(self);
+}
+
+@end
@@ -10,6 +10,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 FOUNDATION_EXPORT BOOL NSZombieEnabled;
 FOUNDATION_EXPORT BOOL NSDebugEnabled;
+// zones created while set report and trap objects which outlive them, see NSRecycleZone
+FOUNDATION_EXPORT BOOL NSZoneDebugEnabled;
 FOUNDATION_EXPORT BOOL NSCooperativeThreadsEnabled;
 
 void NSCooperativeThreadBlocking();
@@ -19,6 +21,55 @@ FOUNDATION_EXPORT void *NSFrameAddress(NSUInteger level);
 FOUNDATION_EXPORT unsigned NSCountFrames(void);
 FOUNDATION_EXPORT void *NSReturnAddress(int level);
 
+// @synchronized contention per object, only counted while enabled. Objects are not retained,
+// an entry can outlive its object and describe several objects allocated at the same address.
+typedef struct {
+   id object;
+   NSUInteger acquisitions;
+   NSUInteger contentions;
+   double waitTime; // seconds spent blocked
+} NSSynchronizationStatistics;
+
+FOUNDATION_EXPORT void NSSetSynchronizationStatisticsEnabled(BOOL enabled);
+// most contended first, free() the result
+FOUNDATION_EXPORT NSSynchronizationStatistics *NSCopySynchronizationStatistics(NSUInteger *count);
+FOUNDATION_EXPORT void NSResetSynchronizationStatistics(void);
+
+// Allocations per class served from NSDeallocateObject's caches of freed instances (hits) and
+// from the zone (misses), only counted while enabled.
+typedef struct {
+   Class cls;
+   NSUInteger hits;
+   NSUInteger misses;
+} NSObjectCacheStatistics;
+
+FOUNDATION_EXPORT void NSSetObjectCacheStatisticsEnabled(BOOL enabled);
+// most allocations first, free() the result
+FOUNDATION_EXPORT NSObjectCacheStatistics *NSCopyObjectCacheStatistics(NSUInteger *count);
+FOUNDATION_EXPORT void NSResetObjectCacheStatistics(void);
+
+// Instances per class allocated and deallocated while the heap census is enabled. Live counts
+// start from zero when it is enabled and go negative as older instances are deallocated, take
+// a census before and after a workload and diff them. Live bytes don't include extra bytes.
+typedef struct {
+   Class cls;
+   NSInteger liveInstances;
+   NSInteger liveBytes;
+   NSUInteger allocations;
+   NSUInteger allocatedBytes;
+} NSHeapCensusEntry;
+
+FOUNDATION_EXPORT void NSSetHeapCensusEnabled(BOOL enabled);
+// most live bytes first, free() the result
+FOUNDATION_EXPORT NSHeapCensusEntry *NSCopyHeapCensus(NSUInteger *count);
+// after minus before for every class which changed, most live bytes first, free() the result
+FOUNDATION_EXPORT NSHeapCensusEntry *NSCopyHeapCensusDifference(const NSHeapCensusEntry *before, NSUInteger beforeCount, const NSHeapCensusEntry *after, NSUInteger afterCount, NSUInteger *count);
+// writes the first limit entries to stderr, 0 for all
+FOUNDATION_EXPORT void NSPrintHeapCensus(const NSHeapCensusEntry *entries, NSUInteger count, NSUInteger limit);
+// Prints the census, and what changed since the last time, whenever the process receives signal.
+// Also set from the NSHeapCensusSignal environment variable. Not available on Windows.
+FOUNDATION_EXPORT BOOL NSDumpHeapCensusOnSignal(int signal);
+
 #if defined(__WIN32__) || defined(SOLARIS)
 int backtrace(void **array, int size);
 char **backtrace_symbols(void *const *array, int size);
@@ -15,9 +15,20 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #if defined(LINUX) ||  defined(__APPLE__)  ||  defined(FREEBSD)
 #include <execinfo.h>
 #endif
+#import <objc/runtime.h>
+#ifndef WINDOWS
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 
 BOOL NSZombieEnabled=NO;
 BOOL NSDebugEnabled=NO;
+BOOL NSZoneDebugEnabled=NO;
 BOOL NSCooperativeThreadsEnabled=NO;
 
 const char* _NSPrintForDebugger(id object) {
@@ -58,6 +69,196 @@ void NSCooperativeThreadWaiting() {
 }
 #endif
 
+void NSSetHeapCensusEnabled(BOOL enabled) {
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+   objc_setCensusEnabled(enabled);
+#endif
+}
+
+static int compareLiveBytes(const void *a,const void *b){
+   const NSHeapCensusEntry *entryA=a,*entryB=b;
+
+   if(entryA->liveBytes!=entryB->liveBytes)
+    return (entryA->liveBytes>entryB->liveBytes)?-1:1;
+   if(entryA->allocatedBytes!=entryB->allocatedBytes)
+    return (entryA->allocatedBytes>entryB->allocatedBytes)?-1:1;
+
+   return 0;
+}
+
+static int compareClass(const void *a,const void *b){
+   Class classA=((const NSHeapCensusEntry *)a)->cls,classB=((const NSHeapCensusEntry *)b)->cls;
+
+   return (classA==classB)?0:((uintptr_t)classA<(uintptr_t)classB)?-1:1;
+}
+
+NSHeapCensusEntry *NSCopyHeapCensus(NSUInteger *countp) {
+   NSHeapCensusEntry *result;
+   NSUInteger i,count=0;
+
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+   unsigned censusCount;
+   objc_census_entry *census=objc_copyCensus(&censusCount);
+
+   result=malloc(sizeof(NSHeapCensusEntry)*(censusCount+1));
+   for(i=0;i<censusCount;i++){
+    result[count].cls=census[i].cls;
+    result[count].liveInstances=census[i].liveInstances;
+    result[count].liveBytes=census[i].liveInstances*(NSInteger)class_getInstanceSize(census[i].cls);
+    result[count].allocations=census[i].allocations;
+    result[count].allocatedBytes=census[i].allocatedBytes;
+    count++;
+   }
+   free(census);
+#else
+   result=malloc(sizeof(NSHeapCensusEntry));
+#endif
+
+   qsort(result,count,sizeof(NSHeapCensusEntry),compareLiveBytes);
+   if(countp!=NULL)
+    *countp=count;
+
+   return result;
+}
+
+NSHeapCensusEntry *NSCopyHeapCensusDifference(const NSHeapCensusEntry *before,NSUInteger beforeCount,const NSHeapCensusEntry *after,NSUInteger afterCount,NSUInteger *countp) {
+   NSHeapCensusEntry *sorted=malloc(sizeof(NSHeapCensusEntry)*(beforeCount+1));
+   NSHeapCensusEntry *result=malloc(sizeof(NSHeapCensusEntry)*(beforeCount+afterCount+1));
+   BOOL *matched=calloc(beforeCount+1,sizeof(BOOL));
+   NSUInteger i,count=0;
+
+   memcpy(sorted,before,sizeof(NSHeapCensusEntry)*beforeCount);
+   qsort(sorted,beforeCount,sizeof(NSHeapCensusEntry),compareClass);
+
+   for(i=0;i<afterCount;i++){
+    NSHeapCensusEntry *old=bsearch(after+i,sorted,beforeCount,sizeof(NSHeapCensusEntry),compareClass);
+    NSHeapCensusEntry entry=after[i];
+
+    if(old!=NULL){
+     matched[old-sorted]=YES;
+     entry.liveInstances-=old->liveInstances;
+     entry.liveBytes-=old->liveBytes;
+     entry.allocations-=old->allocations;
+     entry.allocatedBytes-=old->allocatedBytes;
+    }
+    if(entry.liveInstances!=0 || entry.allocations!=0)
+     result[count++]=entry;
+   }
+
+   // only in before, the census was switched off and on again in between
+   for(i=0;i<beforeCount;i++)
+    if(!matched[i] && sorted[i].liveInstances!=0){
+     result[count]=sorted[i];
+     result[count].liveInstances=-sorted[i].liveInstances;
+     result[count].liveBytes=-sorted[i].liveBytes;
+     result[count].allocations=0;
+     result[count].allocatedBytes=0;
+     count++;
+    }
+
+   free(matched);
+   free(sorted);
+
+   qsort(result,count,sizeof(NSHeapCensusEntry),compareLiveBytes);
+   if(countp!=NULL)
+    *countp=count;
+
+   return result;
+}
+
+void NSPrintHeapCensus(const NSHeapCensusEntry *entries,NSUInteger count,NSUInteger limit) {
+   NSUInteger i;
+
+   if(limit==0 || limit>count)
+    limit=count;
+
+   fprintf(stderr,"%12s %14s %12s %14s  %s\n","live","live bytes","allocations","bytes","class");
+   for(i=0;i<limit;i++)
+    fprintf(stderr,"%12ld %14ld %12lu %14lu  %s\n",(long)entries[i].liveInstances,(long)entries[i].liveBytes,(unsigned long)entries[i].allocations,(unsigned long)entries[i].allocatedBytes,class_getName(entries[i].cls));
+   if(limit<count)
+    fprintf(stderr,"... %lu more classes\n",(unsigned long)(count-limit));
+   fflush(stderr);
+}
+
+#ifndef WINDOWS
+// The handler only writes to a pipe, the census is taken and printed on a thread of its own
+static int censusPipe[2]={-1,-1};
+
+static void censusSignalHandler(int signal){
+   char byte=0;
+   int saved=errno;
+
+   write(censusPipe[1],&byte,1);
+   errno=saved;
+}
+
+static void *censusDumpThread(void *arg){
+   NSHeapCensusEntry *previous=NULL;
+   NSUInteger previousCount=0;
+   char byte;
+
+   while(read(censusPipe[0],&byte,1)==1 || errno==EINTR){
+    NSUInteger count;
+    NSHeapCensusEntry *census=NSCopyHeapCensus(&count);
+
+    fprintf(stderr,"Heap census, %lu classes\n",(unsigned long)count);
+    NSPrintHeapCensus(census,count,50);
+
+    if(previous!=NULL){
+     NSUInteger differenceCount;
+     NSHeapCensusEntry *difference=NSCopyHeapCensusDifference(previous,previousCount,census,count,&differenceCount);
+
+     fprintf(stderr,"Since the last census, %lu classes changed\n",(unsigned long)differenceCount);
+     NSPrintHeapCensus(difference,differenceCount,50);
+     free(difference);
+    }
+
+    free(previous);
+    previous=census;
+    previousCount=count;
+   }
+
+   return NULL;
+}
+#endif
+
+BOOL NSDumpHeapCensusOnSignal(int signal) {
+#ifdef WINDOWS
+   return NO;
+#else
+   static pthread_mutex_t lock=PTHREAD_MUTEX_INITIALIZER;
+   struct sigaction action;
+   BOOL result=YES;
+
+   pthread_mutex_lock(&lock);
+   if(censusPipe[0]==-1){
+    pthread_t thread;
+
+    if(pipe(censusPipe)!=0)
+     result=NO;
+    else if(pthread_create(&thread,NULL,censusDumpThread,NULL)!=0){
+     close(censusPipe[0]);
+     close(censusPipe[1]);
+     censusPipe[0]=censusPipe[1]=-1;
+     result=NO;
+    }
+    else
+     pthread_detach(thread);
+   }
+   pthread_mutex_unlock(&lock);
+
+   if(!result)
+    return NO;
+
+   memset(&action,0,sizeof(action));
+   action.sa_handler=censusSignalHandler;
+   action.sa_flags=SA_RESTART;
+   sigemptyset(&action.sa_mask);
+
+   return (sigaction(signal,&action,NULL)==0)?YES:NO;
+#endif
+}
+
 #define _NS_RETURN_ADDRESS(x) case x: return __builtin_return_address(x + 1)
 
 void *NSFrameAddress(NSUInteger level)
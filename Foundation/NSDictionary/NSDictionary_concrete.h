@@ -0,0 +1,23 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import <Foundation/NSDictionary.h>
+
+// Immutable dictionaries are one block laid out as keys[count], objects[count] and, from
+// NSDictionaryConcreteIndexedCount keys up, the key hashes[count] and an open addressed index
+// of entry numbers into them. Smaller dictionaries are scanned instead.
+#define NSDictionaryConcreteIndexedCount 8
+
+@interface NSDictionary_concrete : NSDictionary {
+    NSUInteger _count;
+    NSUInteger _mask; // index size - 1, 0 when scanned
+    id _keys[0];
+}
+@end
+
+NSDictionary *NSDictionary_concreteNew(NSZone *zone, id *objects, id *keys, NSUInteger count);
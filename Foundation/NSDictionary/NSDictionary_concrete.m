@@ -0,0 +1,200 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import <Foundation/NSDictionary_concrete.h>
+#import <Foundation/NSHashIndex.h>
+#import <Foundation/NSArray_concrete.h>
+#import <Foundation/NSEnumerator_objects.h>
+#import <Foundation/NSAutoreleasePool-private.h>
+#include <string.h>
+#include <stdint.h>
+
+@implementation NSDictionary_concrete
+
+static inline id *objectsOf(NSDictionary_concrete *self,NSUInteger count){
+   return self->_keys+count;
+}
+
+static inline NSUInteger *hashesOf(NSDictionary_concrete *self,NSUInteger count){
+   return (NSUInteger *)(self->_keys+2*count);
+}
+
+static inline uint32_t *indexOf(NSDictionary_concrete *self,NSUInteger count){
+   return (uint32_t *)(hashesOf(self,count)+count);
+}
+
+static void buildIndex(NSDictionary_concrete *self){
+   NSUInteger count=self->_count,mask=NSHashIndexSizeForCount(count)-1;
+
+   NSHashIndexBuild(indexOf(self,count),mask,hashesOf(self,count),count);
+   self->_mask=mask;
+}
+
+// Entries are stored, and the index filled in, as they are added so duplicate keys can be found;
+// a later duplicate replaces the earlier key and value as with a mutable dictionary.
+NSDictionary *NSDictionary_concreteNew(NSZone *zone,id *objects,id *keys,NSUInteger count) {
+   BOOL                   indexed=(count>=NSDictionaryConcreteIndexedCount);
+   NSUInteger             extra=sizeof(id)*2*count,scanHashes[NSDictionaryConcreteIndexedCount];
+   NSUInteger             i,unique=0,mask=0,*hashes=scanHashes;
+   uint32_t              *index=NULL;
+   NSDictionary_concrete *self;
+   id                    *selfObjects;
+
+   if(indexed){
+    mask=NSHashIndexSizeForCount(count)-1;
+    extra+=sizeof(NSUInteger)*count+sizeof(uint32_t)*(mask+1);
+   }
+
+   self=NSAllocateObject([NSDictionary_concrete class],extra,zone);
+   self->_count=count;
+   selfObjects=objectsOf(self,count);
+   if(indexed){
+    hashes=hashesOf(self,count);
+    index=indexOf(self,count);
+   }
+
+   for(i=0;i<count;i++){
+    id         key=[keys[i] copy];
+    NSUInteger hash=[key hash],entry=NSNotFound;
+
+    if(indexed){
+     NSUInteger slot;
+
+     for(slot=NSHashIndexSlotForHash(hash,mask);index[slot]!=0;slot=(slot+1)&mask){
+      NSUInteger check=index[slot]-1;
+
+      if(hashes[check]==hash && [self->_keys[check] isEqual:key]){
+       entry=check;
+       break;
+      }
+     }
+     if(entry==NSNotFound)
+      index[slot]=unique+1;
+    }
+    else {
+     NSUInteger check;
+
+     for(check=0;check<unique;check++)
+      if(hashes[check]==hash && [self->_keys[check] isEqual:key]){
+       entry=check;
+       break;
+      }
+    }
+
+    if(entry==NSNotFound){
+     self->_keys[unique]=key;
+     selfObjects[unique]=[objects[i] retain];
+     hashes[unique]=hash;
+     unique++;
+    }
+    else {
+     [objects[i] retain];
+     [selfObjects[entry] release];
+     selfObjects[entry]=objects[i];
+     [self->_keys[entry] release];
+     self->_keys[entry]=key;
+    }
+   }
+
+   if(unique<count){
+    // close up the layout for the smaller count, the tail of the block goes unused
+    memmove(self->_keys+unique,selfObjects,sizeof(id)*unique);
+    self->_count=unique;
+    if(unique>=NSDictionaryConcreteIndexedCount){
+     memmove(hashesOf(self,unique),hashes,sizeof(NSUInteger)*unique);
+     buildIndex(self);
+    }
+   }
+   else if(indexed)
+    self->_mask=mask;
+
+   return self;
+}
+
+-(void)dealloc {
+   id        *objects=objectsOf(self,_count);
+   NSUInteger i;
+
+   for(i=0;i<_count;i++){
+    [_keys[i] release];
+    [objects[i] release];
+   }
+
+   NSDeallocateObject(self);
+   return;
+   [super dealloc];
+}
+
+-(NSUInteger)count {
+   return _count;
+}
+
+-objectForKey:key {
+   NSUInteger i;
+
+   if(key==nil)
+    return nil;
+
+   if(_mask==0){
+    for(i=0;i<_count;i++)
+     if(_keys[i]==key)
+      return objectsOf(self,_count)[i];
+
+    for(i=0;i<_count;i++)
+     if([_keys[i] isEqual:key])
+      return objectsOf(self,_count)[i];
+   }
+   else {
+    NSUInteger  hash=[key hash],*hashes=hashesOf(self,_count);
+    uint32_t   *index=indexOf(self,_count),entry;
+
+    for(i=NSHashIndexSlotForHash(hash,_mask);(entry=index[i])!=0;i=(i+1)&_mask){
+     entry--;
+     if(hashes[entry]==hash && (_keys[entry]==key || [_keys[entry] isEqual:key]))
+      return objectsOf(self,_count)[entry];
+    }
+   }
+
+   return nil;
+}
+
+-(NSEnumerator *)keyEnumerator {
+   return NSAutorelease(NSEnumerator_objectsNew(self,_keys,_count));
+}
+
+-(NSEnumerator *)objectEnumerator {
+   return NSAutorelease(NSEnumerator_objectsNew(self,objectsOf(self,_count),_count));
+}
+
+-(NSArray *)allKeys {
+   return NSAutorelease(NSArray_concreteNew(NULL,_keys,_count));
+}
+
+-(NSArray *)allValues {
+   return NSAutorelease(NSArray_concreteNew(NULL,objectsOf(self,_count),_count));
+}
+
+-(void)getObjects:(id *)objects andKeys:(id *)keys {
+   if(objects!=NULL)
+    memcpy(objects,objectsOf(self,_count),sizeof(id)*_count);
+   if(keys!=NULL)
+    memcpy(keys,_keys,sizeof(id)*_count);
+}
+
+-(NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id *)stackbuf count:(NSUInteger)length {
+   if(state->state>=_count)
+    return 0;
+
+   state->itemsPtr=_keys;
+   state->state=_count;
+   state->mutationsPtr=(unsigned long *)self;
+
+   return _count;
+}
+
+@end
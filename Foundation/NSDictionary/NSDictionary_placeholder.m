@@ -0,0 +1,44 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import <Foundation/NSDictionary_placeholder.h>
+#import <Foundation/NSDictionary_concrete.h>
+#import <Foundation/NSRaise.h>
+#import <Foundation/NSRaiseException.h>
+
+@implementation NSDictionary_placeholder
+
+- init
+{
+    NSZone *zone = NSZoneFromPointer(self);
+
+    [self dealloc];
+    return (NSDictionary_placeholder *)NSDictionary_concreteNew(zone, NULL, NULL, 0);
+}
+
+- initWithObjects:(id *)objects forKeys:(id *)keys count:(NSUInteger)count
+{
+    NSZone *zone = NSZoneFromPointer(self);
+    NSUInteger i;
+
+    for (i = 0; i < count; i++) {
+        if (keys[i] == nil) {
+            [self autorelease];
+            NSRaiseException(NSInvalidArgumentException, self, _cmd, @"Attempt to insert object with nil key");
+        }
+        if (objects[i] == nil) {
+            [self autorelease];
+            NSRaiseException(NSInvalidArgumentException, self, _cmd, @"Attempt to insert nil object for key %@", keys[i]);
+        }
+    }
+
+    [self dealloc];
+    return (NSDictionary_placeholder *)NSDictionary_concreteNew(zone, objects, keys, count);
+}
+
+@end
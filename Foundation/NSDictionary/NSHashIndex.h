@@ -0,0 +1,42 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSObject.h>
+#include <string.h>
+#include <stdint.h>
+
+// The open addressed index NSSet_concrete and NSDictionary_concrete keep after their entries:
+// slot -> entry number + 1, 0 for an empty slot, probed linearly from the entry's hash.
+
+// at most 2/3 full so misses stop early
+static inline NSUInteger NSHashIndexSizeForCount(NSUInteger count){
+   NSUInteger result=16;
+
+   while(result<count+count/2)
+    result*=2;
+
+   return result;
+}
+
+static inline NSUInteger NSHashIndexSlotForHash(NSUInteger hash,NSUInteger mask){
+   hash*=(NSUInteger)0x9E3779B97F4A7C15ULL;
+
+   return (hash^(hash>>(sizeof(NSUInteger)*4)))&mask;
+}
+
+static inline void NSHashIndexBuild(uint32_t *index,NSUInteger mask,NSUInteger *hashes,NSUInteger count){
+   NSUInteger i;
+
+   memset(index,0,sizeof(uint32_t)*(mask+1));
+   for(i=0;i<count;i++){
+    NSUInteger slot;
+
+    for(slot=NSHashIndexSlotForHash(hashes[i],mask);index[slot]!=0;slot=(slot+1)&mask)
+     ;
+    index[slot]=i+1;
+   }
+}
@@ -59,6 +59,34 @@ typedef struct NSExceptionFrame {
 FOUNDATION_EXPORT void __NSPushExceptionFrame(NSExceptionFrame *frame);
 FOUNDATION_EXPORT void __NSPopExceptionFrame(NSExceptionFrame *frame);
 
+#ifdef OBJC_ZERO_COST_EXCEPTIONS
+
+// The handlers are found from unwind tables, entering NS_DURING costs nothing
+#define NS_DURING \
+    @try {
+
+#define NS_HANDLER                                                             \
+    }                                                                          \
+    @catch(id __exception) {                                                   \
+        NSException *localException = __exception;                             \
+        if(localException) { /* caller does not have to read localException */ \
+        }
+
+#define NS_ENDHANDLER \
+    }
+
+#define NS_VALUERETURN(val, type) \
+    {                             \
+        return val;               \
+    }
+
+#define NS_VOIDRETURN \
+    {                 \
+        return;       \
+    }
+
+#else
+
 #define NS_DURING                                  \
     {                                              \
         NSExceptionFrame __exceptionFrame;         \
@@ -89,4 +117,6 @@ FOUNDATION_EXPORT void __NSPopExceptionFrame(NSExceptionFrame *frame);
         return;                                   \
     }
 
+#endif
+
 #import <Foundation/NSAssertionHandler.h>
@@ -16,7 +16,7 @@ typedef struct NSHashTable NSHashTable;
 typedef struct {
     NSHashTable *table;
     NSUInteger i;
-    struct NSHashBucket *j;
+    void **j;
 } NSHashEnumerator;
 
 typedef struct {
@@ -8,20 +8,118 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSHashTable.h>
 #import <Foundation/NSArray.h>
 #import <Foundation/NSString.h>
+#include <string.h>
 
-typedef struct NSHashBucket {
-   struct NSHashBucket *next;
-   void *key;
-} NSHashBucket;
+/* Open addressed with linear probing and cached hashes, as NSMapTable. Hashes 0 and 1 mark
+   empty and removed slots, key hashes are moved out of the way.
+ */
+#define NSHashHashEmpty   0
+#define NSHashHashRemoved 1
+#define NSHashHashMultiplier ((NSUInteger)0x9E3779B97F4A7C15ULL)
 
 struct NSHashTable {
    NSHashTableCallBacks *callBacks;
    NSUInteger       count;
-   NSUInteger       nBuckets;
-   NSHashBucket **buckets;
+   NSUInteger       used;
+   NSUInteger       mask;
+   NSUInteger      *hashes;
+   void           **keys;
+   BOOL             pointerKeys;
 };
 
 NSHashTableCallBacks _NSHashTableFixCallbacks(NSHashTableCallBacks callBacks);
+static NSUInteger _NSHashPointerHash(NSHashTable *table,const void *object);
+static BOOL _NSHashPointerIsEqual(NSHashTable *table,const void *object1,const void *object2);
+
+static inline NSUInteger _NSHashStoredHash(NSUInteger hash){
+   return (hash<=NSHashHashRemoved)?hash+2:hash;
+}
+
+static inline NSUInteger _NSHashIndex(NSHashTable *table,NSUInteger hash){
+   hash*=NSHashHashMultiplier;
+
+   return (hash^(hash>>(sizeof(NSUInteger)*4)))&table->mask;
+}
+
+static void _NSHashAllocate(NSHashTable *table,NSUInteger size,NSZone *zone){
+   // one block, the hashes followed by the keys
+   table->hashes=NSZoneCalloc(zone,size,sizeof(NSUInteger)+sizeof(void *));
+   table->keys=(void **)(table->hashes+size);
+   table->mask=size-1;
+   table->used=0;
+}
+
+// Smallest table which holds count keys at most 3/4 full
+static NSUInteger _NSHashSizeForCount(NSUInteger count){
+   NSUInteger result=8;
+
+   while(result*3<count*4)
+    result*=2;
+
+   return result;
+}
+
+// Index of pointer or NSNotFound, hash is a stored hash
+static NSUInteger _NSHashFind(NSHashTable *table,const void *pointer,NSUInteger hash){
+   NSUInteger i=_NSHashIndex(table,hash),check;
+
+   if(table->pointerKeys){
+    for(;(check=table->hashes[i])!=NSHashHashEmpty;i=(i+1)&table->mask)
+     if(check==hash && table->keys[i]==pointer)
+      return i;
+
+    return NSNotFound;
+   }
+
+   for(;(check=table->hashes[i])!=NSHashHashEmpty;i=(i+1)&table->mask)
+    if(check==hash && (table->keys[i]==pointer || table->callBacks->isEqual(table,table->keys[i],pointer)))
+     return i;
+
+   return NSNotFound;
+}
+
+static inline NSUInteger _NSHashKeyHash(NSHashTable *table,const void *pointer){
+   return _NSHashStoredHash(table->pointerKeys?(NSUInteger)pointer:table->callBacks->hash(table,pointer));
+}
+
+// The slot is emptied before the key is released, which may come back to the table
+static void _NSHashRemoveIndex(NSHashTable *table,NSUInteger i){
+   void *key=table->keys[i];
+
+   table->keys[i]=NULL;
+   // nothing probes past a slot followed by an empty one
+   if(table->hashes[(i+1)&table->mask]==NSHashHashEmpty){
+    table->hashes[i]=NSHashHashEmpty;
+    table->used--;
+   }
+   else
+    table->hashes[i]=NSHashHashRemoved;
+   table->count--;
+
+   table->callBacks->release(table,key);
+}
+
+// Moves the keys to a table which is at most half full, dropping removed slots
+static void _NSHashRehash(NSHashTable *table){
+   NSZone *zone=NSZoneFromPointer(table);
+   NSUInteger *hashes=table->hashes,size=table->mask+1,i;
+   void **keys=table->keys;
+
+   _NSHashAllocate(table,_NSHashSizeForCount(table->count*3/2+1),zone);
+
+   for(i=0;i<size;i++)
+    if(hashes[i]>NSHashHashRemoved){
+     NSUInteger j;
+
+     for(j=_NSHashIndex(table,hashes[i]);table->hashes[j]!=NSHashHashEmpty;j=(j+1)&table->mask)
+      ;
+     table->hashes[j]=hashes[i];
+     table->keys[j]=keys[i];
+     table->used++;
+    }
+
+   NSZoneFree(zone,hashes);
+}
 
 NSHashTable *NSCreateHashTable(NSHashTableCallBacks callBacks,
  NSUInteger capacity) {
@@ -39,10 +137,11 @@ NSHashTable *NSCreateHashTableWithZone(NSHashTableCallBacks callBacks,
 
    table->callBacks=NSZoneMalloc(zone,sizeof(NSHashTableCallBacks));
    *(table->callBacks)=_NSHashTableFixCallbacks(callBacks);
+   // pointer keys hash and compare inline
+   table->pointerKeys=(table->callBacks->hash==_NSHashPointerHash && table->callBacks->isEqual==_NSHashPointerIsEqual);
 
    table->count=0;
-   table->nBuckets=(capacity<4)?4:capacity;
-   table->buckets=NSZoneCalloc(zone,table->nBuckets,sizeof(NSHashBucket *));
+   _NSHashAllocate(table,_NSHashSizeForCount(capacity),zone);
 
    return table;
 }
@@ -61,48 +160,33 @@ NSHashTable *NSCopyHashTableWithZone(NSHashTable *table,NSZone *zone) {
 
 void NSFreeHashTable(NSHashTable *table) {
    NSZone *zone=NSZoneFromPointer(table);
-   NSUInteger i;
-   NSHashBucket *j,*next;
 
-   for(i=0;i<table->nBuckets;i++){
-    for(j=table->buckets[i];j!=NULL;j=next){
-     table->callBacks->release(table,j->key);
-     next=j->next;
-     NSZoneFree(zone,j);
-    }
-   }
-   NSZoneFree(zone,table->buckets);
+   NSResetHashTable(table);
+   NSZoneFree(zone,table->hashes);
    NSZoneFree(zone,table->callBacks);
    NSZoneFree(zone,table);
 }
 
 void NSResetHashTable(NSHashTable *table) {
-   NSZone *zone=NSZoneFromPointer(table);
    NSUInteger i;
-   NSHashBucket *j,*next;
 
-   for(i=0;i<table->nBuckets;i++){
-    for(j=table->buckets[i];j!=NULL;j=next){
-     table->callBacks->release(table,j->key);
-     next=j->next;
-     NSZoneFree(zone,j);
-    }
-    table->buckets[i]=NULL;
-   }
-   table->count=0;
+   for(i=0;i<=table->mask;i++)
+    if(table->hashes[i]>NSHashHashRemoved)
+     _NSHashRemoveIndex(table,i);
+
+   memset(table->hashes,0,(table->mask+1)*sizeof(NSUInteger));
+   table->used=0;
 }
 
 BOOL NSCompareHashTables(NSHashTable *table1,NSHashTable *table2) {
    NSUInteger i;
-   NSHashBucket *j;
 
    if(table1->count!=table2->count)
     return NO;
 
-   for(i=0;i<table1->nBuckets;i++)
-    for(j=table1->buckets[i];j!=NULL;j=j->next)
-     if(NSHashGet(table2,j->key)!=j->key)
-      return NO;
+   for(i=0;i<=table1->mask;i++)
+    if(table1->hashes[i]>NSHashHashRemoved && NSHashGet(table2,table1->keys[i])!=table1->keys[i])
+     return NO;
 
    return YES;
 }
@@ -112,101 +196,83 @@ NSUInteger NSCountHashTable(NSHashTable *table) {
 }
 
 void *NSHashGet(NSHashTable *table,const void *pointer) {
-   NSUInteger i=table->callBacks->hash(table,pointer)%table->nBuckets;
-   NSHashBucket *j;
-
-   for(j=table->buckets[i];j!=NULL;j=j->next)
-    if(table->callBacks->isEqual(table,j->key,pointer))
-     return j->key;
+   NSUInteger i=_NSHashFind(table,pointer,_NSHashKeyHash(table,pointer));
 
-   return NULL;
+   return (i==NSNotFound)?NULL:table->keys[i];
 }
 
 NSArray *NSAllHashTableObjects(NSHashTable *table) {
    NSMutableArray *array;
    NSUInteger i;
-   NSHashBucket *j;
 
    array=[[[NSMutableArray allocWithZone:NULL] initWithCapacity:table->count] autorelease];
 
-   for(i=0;i<table->nBuckets;i++)
-    for(j=table->buckets[i];j!=NULL;j=j->next)
-     [array addObject:j->key];
+   for(i=0;i<=table->mask;i++)
+    if(table->hashes[i]>NSHashHashRemoved)
+     [array addObject:table->keys[i]];
 
    return array;
 }
 
+// A rehash moves every key, an enumeration which outlives one ends rather than read freed memory
 NSHashEnumerator NSEnumerateHashTable(NSHashTable *table) {
    NSHashEnumerator state;
 
    state.table=table;
-   for(state.i=0;state.i<table->nBuckets;state.i++)
-    if(table->buckets[state.i]!=NULL)
-     break;
-   state.j=(state.i<table->nBuckets)?table->buckets[state.i]:NULL;
+   state.i=0;
+   state.j=table->keys;
 
    return state;
 }
 
 void *NSNextHashEnumeratorItem(NSHashEnumerator *state) {
-   void *key;
+   NSHashTable *table=state->table;
 
-   if(state->j==NULL)
+   if(state->j!=table->keys)
     return NULL;
 
-   key=state->j->key;
-
-   if((state->j=state->j->next)!=NULL)
-    return key;
+   while(state->i<=table->mask){
+    NSUInteger i=state->i++;
 
-   for(state->i++;state->i<state->table->nBuckets;state->i++)
-    if((state->j=state->table->buckets[state->i])!=NULL)
-     return key;
-
-   state->j=NULL;
+    if(table->hashes[i]>NSHashHashRemoved)
+     return table->keys[i];
+   }
 
-   return key;
+   return NULL;
 }
 
 void NSHashInsert(NSHashTable *table,const void *pointer) {
-   NSZone *zone;
-   NSUInteger hash=table->callBacks->hash(table,pointer);
-   NSUInteger i=hash%table->nBuckets;
-   NSHashBucket *j;
-
-   for(j=table->buckets[i];j!=NULL;j=j->next)
-    if(table->callBacks->isEqual(table,j->key,pointer)){
-     void *old=j->key;
+   NSUInteger hash=_NSHashKeyHash(table,pointer);
+   NSUInteger i,check,removed=NSNotFound;
+
+   for(i=_NSHashIndex(table,hash);(check=table->hashes[i])!=NSHashHashEmpty;i=(i+1)&table->mask){
+    if(check==NSHashHashRemoved){
+     if(removed==NSNotFound)
+      removed=i;
+    }
+    else if(check==hash && (table->keys[i]==pointer || (!table->pointerKeys && table->callBacks->isEqual(table,table->keys[i],pointer)))){
+     void *old=table->keys[i];
      table->callBacks->retain(table,pointer);
-     j->key=(void *)pointer;
+     table->keys[i]=(void *)pointer;
      table->callBacks->release(table,old);
      return;
     }
+   }
 
-   zone=NSZoneFromPointer(table);
-
-   if(table->count>=table->nBuckets){
-    NSUInteger nBuckets=table->nBuckets;
-    NSHashBucket **buckets=table->buckets,*next;
-
-    table->nBuckets=nBuckets*2;
-    table->buckets=NSZoneCalloc(zone,table->nBuckets,sizeof(NSHashBucket *));
-    for(i=0;i<nBuckets;i++)
-     for(j=buckets[i];j!=NULL;j=next){
-      NSUInteger newi=table->callBacks->hash(table,j->key)%table->nBuckets;
-      next=j->next;
-      j->next=table->buckets[newi];
-      table->buckets[newi]=j;
-     }
-    NSZoneFree(zone,buckets);
-    i=hash%table->nBuckets;
+   if(removed!=NSNotFound)
+    i=removed;
+   else {
+    if((table->used+1)*4>(table->mask+1)*3){
+     _NSHashRehash(table);
+     for(i=_NSHashIndex(table,hash);table->hashes[i]!=NSHashHashEmpty;i=(i+1)&table->mask)
+      ;
+    }
+    table->used++;
    }
 
    table->callBacks->retain(table,pointer);
-   j=NSZoneMalloc(zone,sizeof(NSHashBucket));
-   j->key=(void *)pointer;
-   j->next=table->buckets[i];
-   table->buckets[i]=j;
+   table->hashes[i]=hash;
+   table->keys[i]=(void *)pointer;
    table->count++;
 }
 
@@ -229,46 +295,34 @@ void *NSHashInsertIfAbsent(NSHashTable *table,const void *pointer) {
 }
 
 void NSHashRemove(NSHashTable *table,const void *pointer) {
-   NSUInteger i=table->callBacks->hash(table,pointer)%table->nBuckets;
-   NSHashBucket *j=table->buckets[i],*prev=j;
+   NSUInteger i=_NSHashFind(table,pointer,_NSHashKeyHash(table,pointer));
 
-   for(;j!=NULL;j=j->next){
-    if(table->callBacks->isEqual(table,j->key,pointer)){
-     if(prev==j)
-      table->buckets[i]=j->next;
-     else
-      prev->next=j->next;
-     table->callBacks->release(table,j->key);
-     NSZoneFree(NSZoneFromPointer(j),j);
-     table->count--;
-     return;
-    }
-    prev=j;
-   }
+   if(i!=NSNotFound)
+    _NSHashRemoveIndex(table,i);
 }
 
 NSString *NSStringFromHashTable(NSHashTable *table) {
    NSMutableString *string=[NSMutableString string];
    NSString *fmt=@"%p";
    NSUInteger i;
-   NSHashBucket *j;
 
-   for(i=0;i<table->nBuckets;i++){
-    for(j=table->buckets[i];j!=NULL;j=j->next){
+   for(i=0;i<=table->mask;i++){
+    if(table->hashes[i]>NSHashHashRemoved){
      NSString *desc;
 
-     if((desc=table->callBacks->describe(table,j->key))!=nil)
+     if((desc=table->callBacks->describe(table,table->keys[i]))!=nil)
       [string appendString:desc];
      else
-      [string appendFormat:fmt,j->key];
+      [string appendFormat:fmt,table->keys[i]];
     }
    }
 
    return string;
 }
 
+// the table mixes hashes, aligned pointers and small integers need no shifting here
 static NSUInteger _NSHashPointerHash(NSHashTable *table,const void *object){
-   return (NSUInteger)object>>5;
+   return (NSUInteger)object;
 }
 
 static NSUInteger _NSHashObjectHash(NSHashTable *table,const void *object){
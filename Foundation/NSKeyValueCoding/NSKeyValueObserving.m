@@ -918,6 +918,10 @@ CHANGE_DECLARATION(SEL)
 
 -(void)_KVO_swizzle
 {
+	// a tagged pointer has no isa to replace, and being immutable it has no setters to notify from
+	if(objc_isTaggedPointer(self))
+		return;
+
 	NSString* className=[self className];
 	if([className hasPrefix:@"KVONotifying_"])
 		return; // this class is already swizzled
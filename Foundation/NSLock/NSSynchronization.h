@@ -8,6 +8,10 @@
 
 #if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
 
-void _NSInitializeSynchronizedDirective();
+#import <Foundation/NSObject.h>
+
+// Called by the compiler around @synchronized blocks
+FOUNDATION_EXPORT int objc_sync_enter(id object);
+FOUNDATION_EXPORT int objc_sync_exit(id object);
 
 #endif
@@ -6,49 +6,47 @@
 
  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+
 #if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
 
-#import <Foundation/NSMutableDictionary.h>
-#import <Foundation/NSRecursiveLock.h>
-#import <Foundation/NSValue.h>
+#import <Foundation/NSSynchronization.h>
+#import <Foundation/NSDebug.h>
+#import <Foundation/NSPlatform.h>
+#import <objc/objc_tls.h>
+#import <objc/objc_lock.h>
+#include <stdlib.h>
+#include <string.h>
 
-#define NUM_CHAINS 16
-#define ID_HASH(a) (((long)a >> 5) & (NUM_CHAINS - 1))
+// Each object being synchronized on gets a lock record from a striped side table. The record
+// is a recursive lock built on the runtime lock word, which spins briefly and then parks on a
+// futex only when contended. Records are kept for reuse once their last user leaves.
+//
+// A thread keeps the records it recently locked in its runtime thread state and stays a user
+// of them after unlocking, so entering the same object again is a single compare and swap on
+// the record and recursive entries are free. Idle records are dropped from the cache when it
+// fills up and when the thread exits.
 
-// lock to serialize accesses to the lock chain; also serves as a marker if we
-// are currently locking (locking is disabled as long as there's no multithreading)
-static NSLock **lockChainLock=NULL;
+#define NUM_STRIPES 256 // power of 2
 
-struct LockChain;
-typedef struct LockChain
-	{
-		id lock;
-		id object;
-      unsigned owningThreads;
-		struct LockChain *next;
-	} LockChain;
+typedef struct SyncLock {
+   id object;         // nil when the record is free, stripe lock
+   unsigned users;    // stripe lock, one per caching, holding or waiting thread, plus one per extra nesting level when not cached
+   volatile objc_lock word;
+   objc_tls *volatile owner;
+   unsigned recursion; // owner only
+   // owner only, while statistics are enabled
+   NSUInteger acquisitions;
+   NSUInteger contentions;
+   double waitTime;
+   struct SyncLock *next;
+} SyncLock;
 
-static LockChain *allLocks[NUM_CHAINS]={0};
+typedef struct {
+   objc_lock lock;
+   SyncLock *locks;
+} __attribute__((aligned(64))) SyncStripe;
 
-void _NSInitializeSynchronizedDirective()
-{
-	if(!lockChainLock)
-	{
-      int i;
-      lockChainLock=NSZoneCalloc(NULL, NUM_CHAINS, sizeof(id));
-      for(i=0; i<NUM_CHAINS; i++)
-      {
-         allLocks[i]=NSZoneCalloc(NULL, 1, sizeof(LockChain));
-
-         allLocks[i]->object=0;
-         allLocks[i]->next=0;
-         allLocks[i]->owningThreads=0;
-         allLocks[i]->lock=[NSRecursiveLock new];
-
-         lockChainLock[i]=[NSLock new];
-      }
-	}
-}
+static SyncStripe stripes[NUM_STRIPES];
 
 enum {
 	OBJC_SYNC_SUCCESS                 = 0,
@@ -57,92 +55,316 @@ enum {
 	OBJC_SYNC_NOT_INITIALIZED         = -3
 };
 
-LockChain* lockForObject(id object, BOOL entering)
-{
-   NSLock *chainLock=lockChainLock[ID_HASH(object)];
-	LockChain *result=allLocks[ID_HASH(object)];
-	LockChain *firstFree=NULL;
-
-   [chainLock lock];
-
-	while(result)
-	{
-		if(result->object==object)
-			goto done;
-		if(result->object==NULL)
-			firstFree=result;
-      result=result->next;
-	}
-
-   if(!entering)
-      goto done;
-
-	if(firstFree)
-	{
-		firstFree->object=object;
-		result=firstFree;
-		goto done;
-	}
-
-	result=NSZoneCalloc(NULL, 1, sizeof(LockChain));
-	result->object=object;
-   result->owningThreads=0;
-	result->next=allLocks[ID_HASH(object)];
-	result->lock=[NSRecursiveLock new];
-	allLocks[ID_HASH(object)]=result;
-
-done:
-
-   if(entering)
-   {
-      result->owningThreads++;
+static volatile BOOL statisticsEnabled=NO;
+
+// Counters of records which went free, keyed by object
+typedef struct {
+   NSUInteger count;
+   NSUInteger mask;
+   NSSynchronizationStatistics *entries;
+} SyncStatisticsTable;
+
+static objc_lock statisticsLock=0;
+static SyncStatisticsTable retiredStatistics;
+
+static inline SyncStripe *stripeForObject(id object) {
+   uintptr_t hash=(uintptr_t)object>>4;
+
+   return stripes+((hash^(hash>>8))&(NUM_STRIPES-1));
+}
+
+static void statisticsTableAdd(SyncStatisticsTable *table,id object,NSUInteger acquisitions,NSUInteger contentions,double waitTime) {
+   NSUInteger index;
+
+   if((table->count+1)*4>(table->mask+1)*3 || table->entries==NULL){
+      SyncStatisticsTable grown;
+      NSUInteger i;
+
+      grown.count=0;
+      grown.mask=(table->entries==NULL)?63:table->mask*2+1;
+      grown.entries=calloc(grown.mask+1,sizeof(NSSynchronizationStatistics));
+      if(table->entries!=NULL){
+         for(i=0;i<=table->mask;i++)
+            if(table->entries[i].object!=nil)
+               statisticsTableAdd(&grown,table->entries[i].object,table->entries[i].acquisitions,table->entries[i].contentions,table->entries[i].waitTime);
+         free(table->entries);
+      }
+      *table=grown;
+   }
+
+   for(index=((uintptr_t)object>>4)&table->mask;table->entries[index].object!=nil && table->entries[index].object!=object;index=(index+1)&table->mask)
+      ;
+
+   if(table->entries[index].object==nil){
+      table->entries[index].object=object;
+      table->count++;
    }
-   else
-   {
-      if(result)
-      {
-         result->owningThreads--;
-         if(result->owningThreads==0)
-            result->object=NULL;
+   table->entries[index].acquisitions+=acquisitions;
+   table->entries[index].contentions+=contentions;
+   table->entries[index].waitTime+=waitTime;
+}
+
+// stripe lock held
+static void retireStatistics(SyncLock *lock) {
+   if(lock->acquisitions==0 && lock->contentions==0)
+      return;
+
+   objc_lock_lock(&statisticsLock);
+   statisticsTableAdd(&retiredStatistics,lock->object,lock->acquisitions,lock->contentions,lock->waitTime);
+   objc_lock_unlock(&statisticsLock);
+
+   lock->acquisitions=0;
+   lock->contentions=0;
+   lock->waitTime=0;
+}
+
+// stripe lock held
+static void releaseUser(SyncLock *lock) {
+   if(--lock->users==0){
+      retireStatistics(lock);
+      lock->object=nil;
+   }
+}
+
+static SyncLock *lockForObject(SyncStripe *stripe,id object) {
+   SyncLock *result,*firstFree=NULL;
+
+   objc_lock_lock(&stripe->lock);
+   for(result=stripe->locks;result!=NULL;result=result->next){
+      if(result->object==object)
+         break;
+      if(result->object==nil && firstFree==NULL)
+         firstFree=result;
+   }
+
+   if(result==NULL){
+      if((result=firstFree)==NULL){
+         result=NSZoneCalloc(NULL,1,sizeof(SyncLock));
+         result->next=stripe->locks;
+         stripe->locks=result;
+      }
+      result->object=object;
+   }
+   result->users++;
+   objc_lock_unlock(&stripe->lock);
+
+   return result;
+}
+
+static void releaseCacheEntry(objc_sync_cache_entry *entry) {
+   SyncStripe *stripe=stripeForObject(entry->object);
+
+   objc_lock_lock(&stripe->lock);
+   releaseUser(entry->lock);
+   objc_lock_unlock(&stripe->lock);
+}
+
+// Thread exit, records still held stay locked and cached as they would be without the cache
+static void releaseThreadCache(objc_tls *tls) {
+   unsigned i;
+
+   for(i=0;i<tls->syncCacheCount;i++)
+      if(((SyncLock *)tls->syncCache[i].lock)->owner!=tls)
+         releaseCacheEntry(tls->syncCache+i);
+   tls->syncCacheCount=0;
+}
+
+// A free slot, or the slot of an idle record which is released to make room
+static objc_sync_cache_entry *cacheSlot(objc_tls *tls) {
+   unsigned i;
+
+   if(tls->syncCacheCount<OBJC_SYNC_CACHE_SIZE)
+      return tls->syncCache+tls->syncCacheCount++;
+
+   for(i=OBJC_SYNC_CACHE_SIZE;i-->0;)
+      if(((SyncLock *)tls->syncCache[i].lock)->owner!=tls){
+         releaseCacheEntry(tls->syncCache+i);
+         return tls->syncCache+i;
+      }
+
+   return NULL;
+}
+
+static void acquire(SyncLock *lock,objc_tls *tls) {
+   if(!objc_lock_try(&lock->word)){
+      if(statisticsEnabled){
+         NSTimeInterval start=NSPlatformTimeIntervalSinceReferenceDate();
+
+         objc_lock_lockContended(&lock->word);
+         lock->contentions++;
+         lock->waitTime+=NSPlatformTimeIntervalSinceReferenceDate()-start;
       }
+      else
+         objc_lock_lockContended(&lock->word);
    }
 
-	[chainLock unlock];
-	return result;
+   lock->owner=tls;
+   lock->recursion=1;
+   if(statisticsEnabled)
+      lock->acquisitions++;
 }
 
-FOUNDATION_EXPORT int objc_sync_enter(id obj)
+FOUNDATION_EXPORT int objc_sync_enter(id object)
 {
-	if(!obj)
+   objc_tls *tls;
+   objc_sync_cache_entry *entry;
+   SyncLock *lock;
+   unsigned i;
+
+	if(object==nil)
 		return OBJC_SYNC_SUCCESS;
-	if(!lockChainLock)
-		return OBJC_SYNC_NOT_INITIALIZED;
 
-	LockChain *result=lockForObject(obj, YES);
+   tls=objc_tlsCurrent();
+   for(i=0;i<tls->syncCacheCount;i++)
+      if(tls->syncCache[i].object==object){
+         lock=tls->syncCache[i].lock;
+         if(lock->owner==tls)
+            lock->recursion++;
+         else
+            acquire(lock,tls);
+         return OBJC_SYNC_SUCCESS;
+      }
 
-   [result->lock lock];
+   lock=lockForObject(stripeForObject(object),object);
+
+   // entered before while the cache was full of held records
+   if(lock->owner==tls){
+      lock->recursion++;
+      return OBJC_SYNC_SUCCESS;
+   }
+
+   if((entry=cacheSlot(tls))!=NULL){
+      objc_tlsSyncCacheExit=releaseThreadCache;
+      entry->object=object;
+      entry->lock=lock;
+   }
+   acquire(lock,tls);
 
    return OBJC_SYNC_SUCCESS;
 }
 
-FOUNDATION_EXPORT int objc_sync_exit(id obj)
+FOUNDATION_EXPORT int objc_sync_exit(id object)
 {
-	if(!obj)
+   objc_tls *tls;
+   SyncStripe *stripe;
+   SyncLock *lock;
+   unsigned i;
+
+	if(object==nil)
 		return OBJC_SYNC_SUCCESS;
-	if(!lockChainLock)
-		return OBJC_SYNC_NOT_INITIALIZED;
-
-	LockChain *result=lockForObject(obj, NO);
-   if(!result)
-   {
-      // this may happen only in the case where locking was initialized after a sync_enter,
-      // but before the corresponding sync_exit.
-		return OBJC_SYNC_NOT_INITIALIZED;
+
+   tls=objc_tlsCurrent();
+
+   for(i=0;i<tls->syncCacheCount;i++)
+      if(tls->syncCache[i].object==object){
+         lock=tls->syncCache[i].lock;
+         if(lock->owner!=tls)
+            return OBJC_SYNC_NOT_OWNING_THREAD_ERROR;
+         if(--lock->recursion==0){
+            lock->owner=NULL;
+            objc_lock_unlock(&lock->word);
+         }
+         return OBJC_SYNC_SUCCESS;
+      }
+
+   stripe=stripeForObject(object);
+   objc_lock_lock(&stripe->lock);
+   for(lock=stripe->locks;lock!=NULL;lock=lock->next)
+      if(lock->object==object)
+         break;
+
+   if(lock==NULL || lock->owner!=tls){
+      objc_lock_unlock(&stripe->lock);
+      return OBJC_SYNC_NOT_OWNING_THREAD_ERROR;
    }
 
-   [result->lock unlock];
+   if(--lock->recursion==0){
+      lock->owner=NULL;
+      objc_lock_unlock(&lock->word);
+   }
+   releaseUser(lock);
+   objc_lock_unlock(&stripe->lock);
 
 	return OBJC_SYNC_SUCCESS;
 }
 
+void NSSetSynchronizationStatisticsEnabled(BOOL enabled) {
+   statisticsEnabled=enabled;
+}
+
+// A record going free moves its counters into the retired table, so readers of both hold every
+// stripe lock and then statisticsLock, the order retireStatistics takes them in
+static void lockAllStatistics(void) {
+   NSUInteger i;
+
+   for(i=0;i<NUM_STRIPES;i++)
+      objc_lock_lock(&stripes[i].lock);
+   objc_lock_lock(&statisticsLock);
+}
+
+static void unlockAllStatistics(void) {
+   NSUInteger i;
+
+   objc_lock_unlock(&statisticsLock);
+   for(i=0;i<NUM_STRIPES;i++)
+      objc_lock_unlock(&stripes[i].lock);
+}
+
+static int compareContentions(const void *a,const void *b) {
+   const NSSynchronizationStatistics *left=a,*right=b;
+
+   if(left->contentions!=right->contentions)
+      return (left->contentions>right->contentions)?-1:1;
+   if(left->acquisitions!=right->acquisitions)
+      return (left->acquisitions>right->acquisitions)?-1:1;
+   return 0;
+}
+
+// Counters of records in use are read without their owner's cooperation, they may be a few
+// acquisitions behind.
+NSSynchronizationStatistics *NSCopySynchronizationStatistics(NSUInteger *count) {
+   SyncStatisticsTable merged={0,0,NULL};
+   NSSynchronizationStatistics *result;
+   NSUInteger i,resultCount=0;
+   SyncLock *lock;
+
+   lockAllStatistics();
+   for(i=0;retiredStatistics.entries!=NULL && i<=retiredStatistics.mask;i++)
+      if(retiredStatistics.entries[i].object!=nil)
+         statisticsTableAdd(&merged,retiredStatistics.entries[i].object,retiredStatistics.entries[i].acquisitions,retiredStatistics.entries[i].contentions,retiredStatistics.entries[i].waitTime);
+
+   for(i=0;i<NUM_STRIPES;i++)
+      for(lock=stripes[i].locks;lock!=NULL;lock=lock->next)
+         if(lock->object!=nil && (lock->acquisitions!=0 || lock->contentions!=0))
+            statisticsTableAdd(&merged,lock->object,lock->acquisitions,lock->contentions,lock->waitTime);
+   unlockAllStatistics();
+
+   result=malloc(sizeof(NSSynchronizationStatistics)*(merged.count+1));
+   for(i=0;merged.entries!=NULL && i<=merged.mask;i++)
+      if(merged.entries[i].object!=nil)
+         result[resultCount++]=merged.entries[i];
+   free(merged.entries);
+
+   qsort(result,resultCount,sizeof(NSSynchronizationStatistics),compareContentions);
+   *count=resultCount;
+   return result;
+}
+
+void NSResetSynchronizationStatistics(void) {
+   SyncLock *lock;
+   NSUInteger i;
+
+   lockAllStatistics();
+   free(retiredStatistics.entries);
+   memset(&retiredStatistics,0,sizeof(retiredStatistics));
+
+   for(i=0;i<NUM_STRIPES;i++)
+      for(lock=stripes[i].locks;lock!=NULL;lock=lock->next){
+         lock->acquisitions=0;
+         lock->contentions=0;
+         lock->waitTime=0;
+      }
+   unlockAllStatistics();
+}
+
 #endif
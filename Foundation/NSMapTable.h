@@ -9,13 +9,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSObjCRuntime.h>
 #import <Foundation/NSObject.h>
 #import <Foundation/NSEnumerator.h>
+#import <Foundation/NSPointerFunctions.h>
 
 @class NSArray, NSMapTable;
 
 typedef struct {
     NSMapTable *table;
     NSInteger i;
-    struct _NSMapNode *j;
+    struct _NSMapEntry *j;
 } NSMapEnumerator;
 
 typedef struct {
@@ -37,10 +38,19 @@ typedef struct {
     NSMapTableKeyCallBacks *keyCallBacks;
     NSMapTableValueCallBacks *valueCallBacks;
     NSUInteger count;
-    NSUInteger nBuckets;
-    struct _NSMapNode **buckets;
+    NSUInteger used;
+    NSUInteger mask;
+    NSUInteger *hashes;
+    struct _NSMapEntry *entries;
+    BOOL weakKeys;
+    BOOL weakValues;
+    BOOL pointerKeys;
 }
 
++ mapTableWithKeyOptions:(NSPointerFunctionsOptions)keyOptions valueOptions:(NSPointerFunctionsOptions)valueOptions;
+
+- initWithKeyOptions:(NSPointerFunctionsOptions)keyOptions valueOptions:(NSPointerFunctionsOptions)valueOptions capacity:(NSUInteger)capacity;
+
 + mapTableWithStrongToStrongObjects;
 + mapTableWithStrongToWeakObjects;
 + mapTableWithWeakToStrongObjects;
@@ -10,20 +10,31 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSString.h>
 #import <Foundation/NSZone.h>
 #import <Foundation/NSEnumerator_dictionaryKeys.h>
+#import <objc/objc_arc.h>
+#include <string.h>
 
 @implementation NSMapTable
 
-typedef struct _NSMapNode {
-   struct _NSMapNode *next;
+/* Open addressed with linear probing. Every slot's key hash is cached in a dense array next to
+   the entries, so probes compare hashes without touching entries or calling back, and growing
+   never hashes a key again. Hashes 0 and 1 mark empty and removed slots, key hashes are moved
+   out of the way. Removed slots are reused by inserts and dropped when the table is rehashed.
+ */
+typedef struct _NSMapEntry {
    void *key;
    void *value;
-} NSMapNode;
+} NSMapEntry;
+
+#define NSMapHashEmpty   0
+#define NSMapHashRemoved 1
+#define NSMapHashMultiplier ((NSUInteger)0x9E3779B97F4A7C15ULL)
 
 const void *NSNotAnIntMapKey=(const void *)0x80000000;
 const void *NSNotAPointerMapKey=(const void *)0xffffffff;
 
+// the table mixes hashes, aligned pointers and small integers need no shifting here
 static NSUInteger _NSMapPointerHash(NSMapTable *table,const void *object){
-   return (NSUInteger)object>>5;
+   return (NSUInteger)object;
 }
 
 static NSUInteger _NSMapObjectHash(NSMapTable *table,const void *object){
@@ -68,6 +79,263 @@ static NSString *_NSMapObjectDescribe(NSMapTable *table,const void *object){
    return [(id)object description];
 }
 
+static NSUInteger _NSMapCStringHash(NSMapTable *table,const void *string){
+   const unsigned char *s=string;
+   NSUInteger result=5381;
+
+   for(;*s!='\0';s++)
+    result=result*33+*s;
+
+   return result;
+}
+
+static BOOL _NSMapCStringIsEqual(NSMapTable *table,const void *string1,
+  const void *string2){
+   return (strcmp(string1,string2)==0)?YES:NO;
+}
+
+static NSString *_NSMapCStringDescribe(NSMapTable *table,const void *string){
+   return [NSString stringWithCString:string];
+}
+
+static inline NSUInteger _NSMapStoredHash(NSUInteger hash){
+   return (hash<=NSMapHashRemoved)?hash+2:hash;
+}
+
+// pointer and small integer hashes only differ in their low bits, spread them over the table
+static inline NSUInteger _NSMapIndex(NSMapTable *table,NSUInteger hash){
+   hash*=NSMapHashMultiplier;
+
+   return (hash^(hash>>(sizeof(NSUInteger)*4)))&table->mask;
+}
+
+/* Weak keys and values are stored with objc_storeWeak and read back with objc_loadWeak,
+   the runtime zeroes the slot when the object is deallocated. Entries with a zeroed key or
+   value are skipped by lookups and enumeration and are purged when the table is rehashed.
+   Entries only move on a rehash, weak slots are handed over with objc_moveWeak.
+ */
+static inline BOOL _NSMapEntryMatches(NSMapTable *table,NSMapEntry *entry,const void *key){
+   id check;
+   BOOL result;
+
+   if(!table->weakKeys)
+    return (entry->key==key || table->keyCallBacks->isEqual(table,entry->key,key))?YES:NO;
+
+   if((check=objc_loadWeakRetained((id *)&entry->key))==nil)
+    return NO;
+   result=(check==key || table->keyCallBacks->isEqual(table,check,key));
+   objc_release(check);
+
+   return result;
+}
+
+// Returns NO if a weak key or value is gone, weak objects are returned autoreleased
+static BOOL _NSMapEntryLoad(NSMapTable *table,NSMapEntry *entry,void **key,void **value){
+   *key=table->weakKeys?objc_loadWeak((id *)&entry->key):entry->key;
+   *value=table->weakValues?objc_loadWeak((id *)&entry->value):entry->value;
+
+   return ((!table->weakKeys || *key!=NULL) && (!table->weakValues || *value!=NULL))?YES:NO;
+}
+
+static void _NSMapEntryInitialize(NSMapTable *table,NSMapEntry *entry,const void *key,const void *value){
+   if(table->weakKeys)
+    objc_initWeak((id *)&entry->key,(id)key);
+   else {
+    table->keyCallBacks->retain(table,key);
+    entry->key=(void *)key;
+   }
+   if(table->weakValues)
+    objc_initWeak((id *)&entry->value,(id)value);
+   else {
+    table->valueCallBacks->retain(table,value);
+    entry->value=(void *)value;
+   }
+}
+
+static void _NSMapEntryReplace(NSMapTable *table,NSMapEntry *entry,const void *key,const void *value){
+   void *oldKey=entry->key;
+   void *oldValue=entry->value;
+
+   if(!table->weakKeys)
+    table->keyCallBacks->retain(table,key);
+   if(!table->weakValues)
+    table->valueCallBacks->retain(table,value);
+
+   if(table->weakKeys)
+    objc_storeWeak((id *)&entry->key,(id)key);
+   else
+    entry->key=(void *)key;
+   if(table->weakValues)
+    objc_storeWeak((id *)&entry->value,(id)value);
+   else
+    entry->value=(void *)value;
+
+   if(!table->weakKeys)
+    table->keyCallBacks->release(table,oldKey);
+   if(!table->weakValues)
+    table->valueCallBacks->release(table,oldValue);
+}
+
+static void _NSMapEntryMove(NSMapTable *table,NSMapEntry *to,NSMapEntry *from){
+   if(table->weakKeys)
+    objc_moveWeak((id *)&to->key,(id *)&from->key);
+   else
+    to->key=from->key;
+   if(table->weakValues)
+    objc_moveWeak((id *)&to->value,(id *)&from->value);
+   else
+    to->value=from->value;
+}
+
+// The slot is emptied before the key and value are released, which may come back to the table
+static void _NSMapRemoveIndex(NSMapTable *table,NSUInteger i){
+   NSMapEntry *entry=table->entries+i;
+   void *key=entry->key,*value=entry->value;
+
+   if(table->weakKeys)
+    objc_destroyWeak((id *)&entry->key);
+   if(table->weakValues)
+    objc_destroyWeak((id *)&entry->value);
+   entry->key=NULL;
+   entry->value=NULL;
+
+   // nothing probes past a slot followed by an empty one
+   if(table->hashes[(i+1)&table->mask]==NSMapHashEmpty){
+    table->hashes[i]=NSMapHashEmpty;
+    table->used--;
+   }
+   else
+    table->hashes[i]=NSMapHashRemoved;
+   table->count--;
+
+   if(!table->weakKeys)
+    table->keyCallBacks->release(table,key);
+   if(!table->weakValues)
+    table->valueCallBacks->release(table,value);
+}
+
+// Index of the entry for key or NSNotFound, hash is a stored hash
+static NSUInteger _NSMapFind(NSMapTable *table,const void *key,NSUInteger hash){
+   NSUInteger i=_NSMapIndex(table,hash),check;
+
+   while((check=table->hashes[i])!=NSMapHashEmpty){
+    if(check==hash && _NSMapEntryMatches(table,table->entries+i,key))
+     return i;
+    i=(i+1)&table->mask;
+   }
+
+   return NSNotFound;
+}
+
+static void _NSMapAllocate(NSMapTable *table,NSUInteger size,NSZone *zone){
+   // one block, the hashes followed by the entries
+   table->hashes=NSZoneCalloc(zone,size,sizeof(NSUInteger)+sizeof(NSMapEntry));
+   table->entries=(NSMapEntry *)(table->hashes+size);
+   table->mask=size-1;
+   table->used=0;
+}
+
+// Smallest table which holds count entries at most 3/4 full
+static NSUInteger _NSMapSizeForCount(NSUInteger count){
+   NSUInteger result=8;
+
+   while(result*3<count*4)
+    result*=2;
+
+   return result;
+}
+
+static void _NSMapPurgeZeroedEntries(NSMapTable *table){
+   NSUInteger i;
+
+   for(i=0;i<=table->mask;i++)
+    if(table->hashes[i]>NSMapHashRemoved){
+     NSMapEntry *entry=table->entries+i;
+
+     if((table->weakKeys && entry->key==NULL) || (table->weakValues && entry->value==NULL))
+      _NSMapRemoveIndex(table,i);
+    }
+}
+
+// Moves the entries to a table which is at most half full, dropping removed slots
+static void _NSMapRehash(NSMapTable *table){
+   NSZone *zone=NSZoneFromPointer(table);
+   NSUInteger *hashes,size,i;
+   NSMapEntry *entries;
+
+   if(table->weakKeys || table->weakValues)
+    _NSMapPurgeZeroedEntries(table);
+
+   hashes=table->hashes;
+   entries=table->entries;
+   size=table->mask+1;
+   _NSMapAllocate(table,_NSMapSizeForCount(table->count*3/2+1),zone);
+
+   for(i=0;i<size;i++)
+    if(hashes[i]>NSMapHashRemoved){
+     NSUInteger j;
+
+     for(j=_NSMapIndex(table,hashes[i]);table->hashes[j]!=NSMapHashEmpty;j=(j+1)&table->mask)
+      ;
+     table->hashes[j]=hashes[i];
+     _NSMapEntryMove(table,table->entries+j,entries+i);
+     table->used++;
+    }
+
+   NSZoneFree(zone,hashes);
+}
+
+static NSMapTableKeyCallBacks _NSMapKeyCallBacksWithOptions(NSPointerFunctionsOptions options){
+   NSMapTableKeyCallBacks result={NULL, NULL, NULL, NULL, NULL, NULL};
+   BOOL isObject=NO;
+
+   switch(options&0xFF00){
+    case NSPointerFunctionsObjectPersonality:
+     result.hash=_NSMapObjectHash;
+     result.isEqual=_NSMapObjectIsEqual;
+     result.describe=_NSMapObjectDescribe;
+     isObject=YES;
+     break;
+
+    case NSPointerFunctionsObjectPointerPersonality:
+     result.describe=_NSMapObjectDescribe;
+     isObject=YES;
+     break;
+
+    case NSPointerFunctionsCStringPersonality:
+     result.hash=_NSMapCStringHash;
+     result.isEqual=_NSMapCStringIsEqual;
+     result.describe=_NSMapCStringDescribe;
+     break;
+   }
+
+   switch(options&0xFF){
+    case NSPointerFunctionsStrongMemory:
+     if(isObject){
+      result.retain=_NSMapObjectRetain;
+      result.release=_NSMapObjectRelease;
+     }
+     break;
+
+    case NSPointerFunctionsMallocMemory:
+     result.release=_NSMapPointerRelease;
+     break;
+   }
+
+   return result;
+}
+
+static NSMapTableValueCallBacks _NSMapValueCallBacksWithOptions(NSPointerFunctionsOptions options){
+   NSMapTableKeyCallBacks keyCallBacks=_NSMapKeyCallBacksWithOptions(options);
+   NSMapTableValueCallBacks result={keyCallBacks.retain, keyCallBacks.release, keyCallBacks.describe};
+
+   return result;
+}
+
+static BOOL _NSMapOptionsAreWeak(NSPointerFunctionsOptions options){
+   return ((options&0xFF)==NSPointerFunctionsWeakMemory || (options&0xFF)==NSPointerFunctionsZeroingWeakMemory)?YES:NO;
+}
+
 const NSMapTableKeyCallBacks NSIntMapKeyCallBacks={
  NULL, NULL, NULL, NULL, NULL
 };
@@ -125,12 +393,8 @@ NSMapTable *NSCreateMapTable(NSMapTableKeyCallBacks keyCallBacks,
    return NSCreateMapTableWithZone(keyCallBacks,valueCallBacks,capacity,NULL);
 }
 
-NSMapTable *NSCreateMapTableWithZone(NSMapTableKeyCallBacks keyCallBacks,
+static NSMapTable *_NSMapTableInitialize(NSMapTable *table,NSMapTableKeyCallBacks keyCallBacks,
    NSMapTableValueCallBacks valueCallBacks,NSUInteger capacity,NSZone *zone) {
-   NSMapTable *table;
-
-   table=[NSMapTable allocWithZone:zone];
-
    table->keyCallBacks=NSZoneMalloc(zone,sizeof(NSMapTableKeyCallBacks));
    table->keyCallBacks->hash=(keyCallBacks.hash!=NULL)?keyCallBacks.hash:_NSMapPointerHash;
    table->keyCallBacks->isEqual=(keyCallBacks.isEqual!=NULL)?keyCallBacks.isEqual:_NSMapPointerIsEqual;
@@ -144,18 +408,33 @@ NSMapTable *NSCreateMapTableWithZone(NSMapTableKeyCallBacks keyCallBacks,
    table->valueCallBacks->describe=(valueCallBacks.describe!=NULL)?valueCallBacks.describe:_NSMapEmptyDescribe;
 
    table->count=0;
-   table->nBuckets=(capacity<4)?4:capacity;
-   table->buckets=NSZoneCalloc(zone,table->nBuckets,sizeof(NSMapNode *));
+   _NSMapAllocate(table,_NSMapSizeForCount(capacity),zone);
+   table->pointerKeys=(table->keyCallBacks->hash==_NSMapPointerHash && table->keyCallBacks->isEqual==_NSMapPointerIsEqual);
 
    return table;
 }
 
+static void _NSMapTableSetWeak(NSMapTable *table,BOOL weakKeys,BOOL weakValues){
+   table->weakKeys=weakKeys;
+   table->weakValues=weakValues;
+   // weak keys have to be loaded, they don't take the identity fast path
+   if(weakKeys)
+    table->pointerKeys=NO;
+}
+
+NSMapTable *NSCreateMapTableWithZone(NSMapTableKeyCallBacks keyCallBacks,
+   NSMapTableValueCallBacks valueCallBacks,NSUInteger capacity,NSZone *zone) {
+   return _NSMapTableInitialize([NSMapTable allocWithZone:zone],keyCallBacks,valueCallBacks,capacity,zone);
+}
+
 NSMapTable *NSCopyMapTableWithZone(NSMapTable *table,NSZone *zone){
    NSMapTable *newTable=NSCreateMapTableWithZone(*(table->keyCallBacks),
      *(table->valueCallBacks),table->count,zone);
    NSMapEnumerator state=NSEnumerateMapTable(table);
    void *key,*val;
 
+   _NSMapTableSetWeak(newTable,table->weakKeys,table->weakValues);
+
    while(NSNextMapEnumeratorPair(&state,&key,&val))
     NSMapInsert(newTable,key,val);
 
@@ -164,51 +443,38 @@ NSMapTable *NSCopyMapTableWithZone(NSMapTable *table,NSZone *zone){
 
 void NSFreeMapTable(NSMapTable *table){
    NSZone *zone=NSZoneFromPointer(table);
-   NSUInteger i;
-   NSMapNode *j,*next;
-
-   for(i=0;i<table->nBuckets;i++){
-    for(j=table->buckets[i];j!=NULL;j=next){
-     table->keyCallBacks->release(table,j->key);
-     table->valueCallBacks->release(table,j->value);
-     next=j->next;
-     NSZoneFree(zone,j);
-    }
-   }
-   NSZoneFree(zone,table->buckets);
+
+   NSResetMapTable(table);
+   NSZoneFree(zone,table->hashes);
    NSZoneFree(zone,table->keyCallBacks);
    NSZoneFree(zone,table->valueCallBacks);
    NSDeallocateObject(table);
 }
 
 void NSResetMapTable(NSMapTable *table){
-   NSZone *zone=NSZoneFromPointer(table);
    NSUInteger i;
-   NSMapNode *j,*next;
-
-   for(i=0;i<table->nBuckets;i++){
-    for(j=table->buckets[i];j!=NULL;j=next){
-     table->keyCallBacks->release(table,j->key);
-     table->valueCallBacks->release(table,j->value);
-     next=j->next;
-     NSZoneFree(zone,j);
-    }
-    table->buckets[i]=NULL;
-   }
-   table->count=0;
+
+   for(i=0;i<=table->mask;i++)
+    if(table->hashes[i]>NSMapHashRemoved)
+     _NSMapRemoveIndex(table,i);
+
+   memset(table->hashes,0,(table->mask+1)*sizeof(NSUInteger));
+   table->used=0;
 }
 
 BOOL NSCompareMapTables(NSMapTable *table1,NSMapTable *table2){
    NSUInteger i;
-   NSMapNode *j;
 
    if(table1->count!=table2->count)
     return NO;
 
-   for(i=0;i<table1->nBuckets;i++)
-    for(j=table1->buckets[i];j!=NULL;j=j->next)
-     if(NSMapGet(table2,j->key)!=j->key)
+   for(i=0;i<=table1->mask;i++)
+    if(table1->hashes[i]>NSMapHashRemoved){
+     void *key,*value;
+
+     if(_NSMapEntryLoad(table1,table1->entries+i,&key,&value) && NSMapGet(table2,key)!=key)
       return NO;
+    }
 
    return YES;
 }
@@ -219,73 +485,75 @@ NSUInteger NSCountMapTable(NSMapTable *table){
 
 BOOL NSMapMember(NSMapTable *table,const void *key,void **originalKey,
    void **value){
-   NSUInteger i=table->keyCallBacks->hash(table,key)%table->nBuckets;
-   NSMapNode *j;
+   NSUInteger i=_NSMapFind(table,key,_NSMapStoredHash(table->keyCallBacks->hash(table,key)));
 
-   for(j=table->buckets[i];j!=NULL;j=j->next)
-    if(table->keyCallBacks->isEqual(table,j->key,key)){
-     *originalKey=j->key;
-     *value=j->value;
-     return YES;
-    }
+   if(i==NSNotFound)
+    return NO;
 
-   return NO;
+   return _NSMapEntryLoad(table,table->entries+i,originalKey,value);
 }
 
 void *NSMapGet(NSMapTable *table,const void *key){
-   NSUInteger i=table->keyCallBacks->hash(table,key)%table->nBuckets;
-   NSMapNode *j;
+   NSUInteger hash,i,check;
 
-   for(j=table->buckets[i];j!=NULL;j=j->next)
-    if(j->key == key || table->keyCallBacks->isEqual(table,j->key,key))
-     return j->value;
+   // pointer keys compare and hash inline
+   if(table->pointerKeys){
+    hash=_NSMapStoredHash((NSUInteger)key);
 
-   return NULL;
+    for(i=_NSMapIndex(table,hash);(check=table->hashes[i])!=NSMapHashEmpty;i=(i+1)&table->mask)
+     if(check==hash && table->entries[i].key==key)
+      return table->weakValues?objc_loadWeak((id *)&table->entries[i].value):table->entries[i].value;
+
+    return NULL;
+   }
+
+   if((i=_NSMapFind(table,key,_NSMapStoredHash(table->keyCallBacks->hash(table,key))))==NSNotFound)
+    return NULL;
+
+   return table->weakValues?objc_loadWeak((id *)&table->entries[i].value):table->entries[i].value;
 }
 
+// A rehash moves every entry, an enumeration which outlives one ends rather than read freed memory
 NSMapEnumerator NSEnumerateMapTable(NSMapTable *table){
    NSMapEnumerator state;
 
    state.table=table;
-   for(state.i=0;state.i<table->nBuckets;state.i++)
-    if(table->buckets[state.i]!=NULL)
-     break;
-   state.j=(state.i<table->nBuckets)?table->buckets[state.i]:NULL;
+   state.i=0;
+   state.j=table->entries;
 
    return state;
 }
 
 BOOL NSNextMapEnumeratorPair(NSMapEnumerator *state,void **key,
    void **value){
+   NSMapTable *table=state->table;
 
-   if(state->j==NULL)
+   if(state->j!=table->entries)
     return NO;
 
-   *key=state->j->key;
-   *value=state->j->value;
-
-   if((state->j=state->j->next)!=NULL)
-    return YES;
+   while((NSUInteger)state->i<=table->mask){
+    NSUInteger i=state->i++;
 
-   for(state->i++;state->i<state->table->nBuckets;state->i++)
-    if((state->j=state->table->buckets[state->i])!=NULL)
+    if(table->hashes[i]>NSMapHashRemoved && _NSMapEntryLoad(table,table->entries+i,key,value))
      return YES;
+   }
 
-   state->j=NULL;
-
-   return YES;
+   return NO;
 }
 
 NSArray *NSAllMapTableKeys(NSMapTable *table){
    NSMutableArray *array;
    NSUInteger i;
-   NSMapNode *j;
 
    array=[[[NSMutableArray allocWithZone:NULL] initWithCapacity:table->count] autorelease];
 
-   for(i=0;i<table->nBuckets;i++)
-    for(j=table->buckets[i];j!=NULL;j=j->next)
-     [array addObject:j->key];
+   for(i=0;i<=table->mask;i++)
+    if(table->hashes[i]>NSMapHashRemoved){
+     void *key,*value;
+
+     if(_NSMapEntryLoad(table,table->entries+i,&key,&value))
+      [array addObject:key];
+    }
 
    return array;
 }
@@ -293,66 +561,48 @@ NSArray *NSAllMapTableKeys(NSMapTable *table){
 NSArray *NSAllMapTableValues(NSMapTable *table){
    NSMutableArray *array;
    NSUInteger i;
-   NSMapNode *j;
 
    array=[[[NSMutableArray allocWithZone:NULL] initWithCapacity:table->count] autorelease];
 
-   for(i=0;i<table->nBuckets;i++)
-    for(j=table->buckets[i];j!=NULL;j=j->next)
-     [array addObject:j->value];
+   for(i=0;i<=table->mask;i++)
+    if(table->hashes[i]>NSMapHashRemoved){
+     void *key,*value;
+
+     if(_NSMapEntryLoad(table,table->entries+i,&key,&value))
+      [array addObject:value];
+    }
 
    return array;
 }
 
 void NSMapInsert(NSMapTable *table,const void *key,const void *value){
-   NSZone    *zone;
-   NSUInteger   hash=table->keyCallBacks->hash(table,key);
-   NSUInteger        i=hash%table->nBuckets;
-   NSMapNode *j;
-
-   for(j=table->buckets[i];j!=NULL;j=j->next)
-    if(table->keyCallBacks->isEqual(table,j->key,key)){
-     void *oldKey=j->key;
-     void *oldValue=j->value;
-
-     table->keyCallBacks->retain(table,key);
-     table->valueCallBacks->retain(table,value);
-     j->key=(void *)key;
-     j->value=(void *)value;
-     table->keyCallBacks->release(table,oldKey);
-     table->valueCallBacks->release(table,oldValue);
+   NSUInteger hash=_NSMapStoredHash(table->keyCallBacks->hash(table,key));
+   NSUInteger i,check,removed=NSNotFound;
 
+   for(i=_NSMapIndex(table,hash);(check=table->hashes[i])!=NSMapHashEmpty;i=(i+1)&table->mask){
+    if(check==NSMapHashRemoved){
+     if(removed==NSNotFound)
+      removed=i;
+    }
+    else if(check==hash && _NSMapEntryMatches(table,table->entries+i,key)){
+     _NSMapEntryReplace(table,table->entries+i,key,value);
      return;
     }
+   }
 
-   zone=NSZoneFromPointer(table);
-
-   if(table->count>=table->nBuckets){
-    NSUInteger         nBuckets=table->nBuckets;
-    NSMapNode **buckets=table->buckets,*next;
-
-    table->nBuckets=nBuckets*2;
-    table->buckets=NSZoneCalloc(zone,table->nBuckets,sizeof(NSMapNode *));
-
-    for(i=0;i<nBuckets;i++)
-     for(j=buckets[i];j!=NULL;j=next){
-      NSUInteger newi=table->keyCallBacks->hash(table,j->key)%table->nBuckets;
-
-      next=j->next;
-      j->next=table->buckets[newi];
-      table->buckets[newi]=j;
-     }
-    NSZoneFree(zone,buckets);
-    i=hash%table->nBuckets;
+   if(removed!=NSNotFound)
+    i=removed;
+   else {
+    if((table->used+1)*4>(table->mask+1)*3){
+     _NSMapRehash(table);
+     for(i=_NSMapIndex(table,hash);table->hashes[i]!=NSMapHashEmpty;i=(i+1)&table->mask)
+      ;
+    }
+    table->used++;
    }
 
-   table->keyCallBacks->retain(table,key);
-   table->valueCallBacks->retain(table,value);
-   j=NSZoneMalloc(zone,sizeof(NSMapNode));
-   j->key=(void *)key;
-   j->value=(void *)value;
-   j->next=table->buckets[i];
-   table->buckets[i]=j;
+   table->hashes[i]=hash;
+   _NSMapEntryInitialize(table,table->entries+i,key,value);
    table->count++;
 }
 
@@ -376,44 +626,34 @@ void NSMapInsertKnownAbsent(NSMapTable *table,const void *key,
 }
 
 void NSMapRemove(NSMapTable *table,const void *key){
-   NSUInteger i=table->keyCallBacks->hash(table,key)%table->nBuckets;
-   NSMapNode *j=table->buckets[i],*prev=j;
+   NSUInteger i=_NSMapFind(table,key,_NSMapStoredHash(table->keyCallBacks->hash(table,key)));
 
-   for(;j!=NULL;j=j->next){
-    if(table->keyCallBacks->isEqual(table,j->key,key)){
-     if(prev==j)
-      table->buckets[i]=j->next;
-     else
-      prev->next=j->next;
-     table->keyCallBacks->release(table,j->key);
-     table->valueCallBacks->release(table,j->value);
-     NSZoneFree(NSZoneFromPointer(j),j);
-     table->count--;
-     return;
-    }
-    prev=j;
-   }
+   if(i!=NSNotFound)
+    _NSMapRemoveIndex(table,i);
 }
 
 NSString *NSStringFromMapTable(NSMapTable *table){
    NSMutableString *string=[NSMutableString string];
    NSString *fmt=@"%p",*eq=@" = ",*nl=@";\n";
    NSUInteger i;
-   NSMapNode *j;
 
-   for(i=0;i<table->nBuckets;i++){
-    for(j=table->buckets[i];j!=NULL;j=j->next){
+   for(i=0;i<=table->mask;i++){
+    if(table->hashes[i]>NSMapHashRemoved){
      NSString *desc;
+     void *key,*value;
+
+     if(!_NSMapEntryLoad(table,table->entries+i,&key,&value))
+      continue;
 
-     if((desc=table->keyCallBacks->describe(table,j->key))!=nil)
+     if((desc=table->keyCallBacks->describe(table,key))!=nil)
       [string appendString:desc];
      else
-      [string appendFormat:fmt,j->key];
+      [string appendFormat:fmt,key];
      [string appendString:eq];
-     if((desc=table->valueCallBacks->describe(table,j->value))!=nil)
+     if((desc=table->valueCallBacks->describe(table,value))!=nil)
       [string appendString:desc];
      else
-      [string appendFormat:fmt,j->value];
+      [string appendFormat:fmt,value];
      [string appendString:nl];
     }
    }
@@ -421,20 +661,24 @@ NSString *NSStringFromMapTable(NSMapTable *table){
    return string;
 }
 
++mapTableWithKeyOptions:(NSPointerFunctionsOptions)keyOptions valueOptions:(NSPointerFunctionsOptions)valueOptions {
+    return [[[self allocWithZone:NULL] initWithKeyOptions:keyOptions valueOptions:valueOptions capacity:0] autorelease];
+}
+
 +mapTableWithStrongToStrongObjects {
     return [NSCreateMapTable(NSObjectMapKeyCallBacks,NSObjectMapValueCallBacks,0) autorelease];
 }
 
 +mapTableWithStrongToWeakObjects {
-    return [NSCreateMapTable(NSObjectMapKeyCallBacks,NSNonRetainedObjectMapValueCallBacks,0) autorelease];
+    return [self mapTableWithKeyOptions:NSPointerFunctionsStrongMemory valueOptions:NSPointerFunctionsWeakMemory];
 }
 
 +mapTableWithWeakToStrongObjects {
-    return [NSCreateMapTable(NSNonRetainedObjectMapKeyCallBacks,NSObjectMapValueCallBacks,0) autorelease];
+    return [self mapTableWithKeyOptions:NSPointerFunctionsWeakMemory valueOptions:NSPointerFunctionsStrongMemory];
 }
 
 +mapTableWithWeakToWeakObjects {
-    return [NSCreateMapTable(NSNonRetainedObjectMapKeyCallBacks,NSNonRetainedObjectMapValueCallBacks,0) autorelease];
+    return [self mapTableWithKeyOptions:NSPointerFunctionsWeakMemory valueOptions:NSPointerFunctionsWeakMemory];
 }
 
 +strongToStrongObjectsMapTable {
@@ -453,6 +697,12 @@ NSString *NSStringFromMapTable(NSMapTable *table){
     return [self mapTableWithWeakToWeakObjects];
 }
 
+-initWithKeyOptions:(NSPointerFunctionsOptions)keyOptions valueOptions:(NSPointerFunctionsOptions)valueOptions capacity:(NSUInteger)capacity {
+   _NSMapTableInitialize(self,_NSMapKeyCallBacksWithOptions(keyOptions),_NSMapValueCallBacksWithOptions(valueOptions),capacity,NSZoneFromPointer(self));
+   _NSMapTableSetWeak(self,_NSMapOptionsAreWeak(keyOptions),_NSMapOptionsAreWeak(valueOptions));
+   return self;
+}
+
 -(void)dealloc {
    NSFreeMapTable(self);
    return;
@@ -7,12 +7,15 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #import <Foundation/NSNumber_float.h>
 #import <Foundation/NSNumber_double.h>
+#import <Foundation/NSNumber_tagged.h>
 #import <Foundation/NSStringFormatter.h>
 
 @implementation NSNumber_float
 
 NSNumber *NSNumber_floatNew(NSZone *zone,float value) {
    NSNumber *result=NSNumber_doubleSpecial(value);
+   if (result==nil)
+      result=NSNumber_taggedNewWithFloat(value);
    if (result==nil)
    {
       NSNumber_float *self=NSAllocateObject([NSNumber_float class],0,zone);
@@ -6,11 +6,17 @@ The above copyright notice and this permission notice shall be included in all c
 
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #import <Foundation/NSNumber_int.h>
+#import <Foundation/NSNumber_tagged.h>
 #import <Foundation/NSStringFormatter.h>
 
 @implementation NSNumber_int
 
 NSNumber *NSNumber_intNew(NSZone *zone,int value) {
+   NSNumber *tagged=NSNumber_taggedNewWithSigned(NSNumberTaggedInt,value);
+
+   if(tagged!=nil)
+    return tagged;
+
    NSNumber_int *self=NSAllocateObject([NSNumber_int class],0,zone);
     if (self) {
        self->_type=kCFNumberIntType;
@@ -0,0 +1,261 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSNumber_tagged.h>
+#import <Foundation/NSStringFormatter.h>
+#include <limits.h>
+#include <string.h>
+
+#define NSNumberTaggedValueBits 56
+
+static inline NSNumberTaggedType NSNumberTaggedGetType(NSNumber *self) {
+   return (NSNumberTaggedType)(objc_getTaggedPointerValue(self)&0xF);
+}
+
+static inline long long NSNumberTaggedSigned(NSNumber *self) {
+   return objc_getTaggedPointerSignedValue(self)>>4;
+}
+
+static inline unsigned long long NSNumberTaggedUnsigned(NSNumber *self) {
+   return objc_getTaggedPointerValue(self)>>4;
+}
+
+static inline float NSNumberTaggedFloatValue(NSNumber *self) {
+   uint32_t bits=(uint32_t)NSNumberTaggedUnsigned(self);
+   float    result;
+
+   memcpy(&result,&bits,sizeof(float));
+   return result;
+}
+
+static inline double NSNumberTaggedDoubleValue(NSNumber *self) {
+   uint64_t bits=(uint64_t)NSNumberTaggedUnsigned(self)<<8;
+   double   result;
+
+   memcpy(&result,&bits,sizeof(double));
+   return result;
+}
+
+static NSNumber *NSNumberTaggedMake(NSNumberTaggedType type,unsigned long long value) {
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   // the class is only needed once a tagged number exists
+   if(objc_taggedPointerClasses[OBJC_TAG_NSNumber]==Nil)
+    objc_registerTaggedPointerClass(OBJC_TAG_NSNumber,[NSNumber_tagged class]);
+
+   return objc_makeTaggedPointer(OBJC_TAG_NSNumber,(uintptr_t)((value<<4)|type));
+#else
+   return nil;
+#endif
+}
+
+NSNumber *NSNumber_taggedNewWithSigned(NSNumberTaggedType type,long long value) {
+   if(value<-(1LL<<(NSNumberTaggedValueBits-1)) || value>=(1LL<<(NSNumberTaggedValueBits-1)))
+    return nil;
+
+   return NSNumberTaggedMake(type,(unsigned long long)value);
+}
+
+NSNumber *NSNumber_taggedNewWithUnsigned(NSNumberTaggedType type,unsigned long long value) {
+   if(value>=(1ULL<<NSNumberTaggedValueBits))
+    return nil;
+
+   return NSNumberTaggedMake(type,value);
+}
+
+NSNumber *NSNumber_taggedNewWithFloat(float value) {
+   uint32_t bits;
+
+   memcpy(&bits,&value,sizeof(float));
+   return NSNumberTaggedMake(NSNumberTaggedFloat,bits);
+}
+
+// Small integers and short binary fractions (0.5, 2.25, ...) have the low mantissa bits clear
+NSNumber *NSNumber_taggedNewWithDouble(double value) {
+   uint64_t bits;
+
+   memcpy(&bits,&value,sizeof(double));
+   if(bits&0xFF)
+    return nil;
+
+   return NSNumberTaggedMake(NSNumberTaggedDouble,bits>>8);
+}
+
+// Every getter converts from the original type exactly as the heap classes do
+#define NSNumberTaggedReturnAs(type) \
+   switch(NSNumberTaggedGetType(self)){ \
+    case NSNumberTaggedChar: return (type)(char)NSNumberTaggedSigned(self); \
+    case NSNumberTaggedUnsignedChar: return (type)(unsigned char)NSNumberTaggedUnsigned(self); \
+    case NSNumberTaggedShort: return (type)(short)NSNumberTaggedSigned(self); \
+    case NSNumberTaggedUnsignedShort: return (type)(unsigned short)NSNumberTaggedUnsigned(self); \
+    case NSNumberTaggedInt: return (type)(int)NSNumberTaggedSigned(self); \
+    case NSNumberTaggedUnsignedInt: return (type)(unsigned int)NSNumberTaggedUnsigned(self); \
+    case NSNumberTaggedLong: return (type)(long)NSNumberTaggedSigned(self); \
+    case NSNumberTaggedUnsignedLong: return (type)(unsigned long)NSNumberTaggedUnsigned(self); \
+    case NSNumberTaggedLongLong: return (type)(long long)NSNumberTaggedSigned(self); \
+    case NSNumberTaggedUnsignedLongLong: return (type)(unsigned long long)NSNumberTaggedUnsigned(self); \
+    case NSNumberTaggedFloat: return (type)NSNumberTaggedFloatValue(self); \
+    default: return (type)NSNumberTaggedDoubleValue(self); \
+   }
+
+@implementation NSNumber_tagged
+
+// [[self class] alloc] gets a regular instance, which may well turn out tagged again
++allocWithZone:(NSZone *)zone {
+   return [NSNumber allocWithZone:zone];
+}
+
++(BOOL)accessInstanceVariablesDirectly {
+   return NO;
+}
+
+-(void)dealloc {
+   return;
+   [super dealloc];  // Silence compiler warning
+}
+
+-(id)retain {
+   return self;
+}
+
+-(oneway void)release {
+}
+
+-(id)autorelease {
+   return self;
+}
+
+-(NSUInteger)retainCount {
+   return UINT_MAX;
+}
+
+-(void)getValue:(void *)value {
+   switch(NSNumberTaggedGetType(self)){
+    case NSNumberTaggedChar: *((char *)value)=[self charValue]; break;
+    case NSNumberTaggedUnsignedChar: *((unsigned char *)value)=[self unsignedCharValue]; break;
+    case NSNumberTaggedShort: *((short *)value)=[self shortValue]; break;
+    case NSNumberTaggedUnsignedShort: *((unsigned short *)value)=[self unsignedShortValue]; break;
+    case NSNumberTaggedInt: *((int *)value)=[self intValue]; break;
+    case NSNumberTaggedUnsignedInt: *((unsigned int *)value)=[self unsignedIntValue]; break;
+    case NSNumberTaggedLong: *((long *)value)=[self longValue]; break;
+    case NSNumberTaggedUnsignedLong: *((unsigned long *)value)=[self unsignedLongValue]; break;
+    case NSNumberTaggedLongLong: *((long long *)value)=[self longLongValue]; break;
+    case NSNumberTaggedUnsignedLongLong: *((unsigned long long *)value)=[self unsignedLongLongValue]; break;
+    case NSNumberTaggedFloat: *((float *)value)=[self floatValue]; break;
+    default: *((double *)value)=[self doubleValue]; break;
+   }
+}
+
+-(const char *)objCType {
+   switch(NSNumberTaggedGetType(self)){
+    case NSNumberTaggedChar: return @encode(char);
+    case NSNumberTaggedUnsignedChar: return @encode(unsigned char);
+    case NSNumberTaggedShort: return @encode(short);
+    case NSNumberTaggedUnsignedShort: return @encode(unsigned short);
+    case NSNumberTaggedInt: return @encode(int);
+    case NSNumberTaggedUnsignedInt: return @encode(unsigned int);
+    case NSNumberTaggedLong: return @encode(long);
+    case NSNumberTaggedUnsignedLong: return @encode(unsigned long);
+    case NSNumberTaggedLongLong: return @encode(long long);
+    case NSNumberTaggedUnsignedLongLong: return @encode(unsigned long long);
+    case NSNumberTaggedFloat: return @encode(float);
+    default: return @encode(double);
+   }
+}
+
+-(char)charValue {
+   NSNumberTaggedReturnAs(char);
+}
+
+-(unsigned char)unsignedCharValue {
+   NSNumberTaggedReturnAs(unsigned char);
+}
+
+-(short)shortValue {
+   NSNumberTaggedReturnAs(short);
+}
+
+-(unsigned short)unsignedShortValue {
+   NSNumberTaggedReturnAs(unsigned short);
+}
+
+-(int)intValue {
+   NSNumberTaggedReturnAs(int);
+}
+
+-(unsigned int)unsignedIntValue {
+   NSNumberTaggedReturnAs(unsigned int);
+}
+
+-(long)longValue {
+   NSNumberTaggedReturnAs(long);
+}
+
+-(unsigned long)unsignedLongValue {
+   NSNumberTaggedReturnAs(unsigned long);
+}
+
+-(long long)longLongValue {
+   NSNumberTaggedReturnAs(long long);
+}
+
+-(unsigned long long)unsignedLongLongValue {
+   NSNumberTaggedReturnAs(unsigned long long);
+}
+
+-(float)floatValue {
+   NSNumberTaggedReturnAs(float);
+}
+
+-(double)doubleValue {
+   NSNumberTaggedReturnAs(double);
+}
+
+-(BOOL)boolValue {
+   return ([self doubleValue]!=0)?YES:NO;
+}
+
+-(NSInteger)integerValue {
+   NSNumberTaggedReturnAs(NSInteger);
+}
+
+-(NSUInteger)unsignedIntegerValue {
+   NSNumberTaggedReturnAs(NSUInteger);
+}
+
+// same value as -[NSNumber hash] without going through doubleValue for integers
+-(NSUInteger)hash {
+   switch(NSNumberTaggedGetType(self)){
+    case NSNumberTaggedFloat: return (NSUInteger)(double)NSNumberTaggedFloatValue(self);
+    case NSNumberTaggedDouble: return (NSUInteger)NSNumberTaggedDoubleValue(self);
+    case NSNumberTaggedUnsignedChar:
+    case NSNumberTaggedUnsignedShort:
+    case NSNumberTaggedUnsignedInt:
+    case NSNumberTaggedUnsignedLong:
+    case NSNumberTaggedUnsignedLongLong:
+     return (NSUInteger)(double)NSNumberTaggedUnsigned(self);
+    default: return (NSUInteger)(double)NSNumberTaggedSigned(self);
+   }
+}
+
+-(NSString *)descriptionWithLocale:(NSDictionary *)locale {
+   switch(NSNumberTaggedGetType(self)){
+    case NSNumberTaggedChar: return NSStringWithFormatAndLocale(@"%i",locale,[self charValue]);
+    case NSNumberTaggedUnsignedChar: return NSStringWithFormatAndLocale(@"%u",locale,[self unsignedCharValue]);
+    case NSNumberTaggedShort: return NSStringWithFormatAndLocale(@"%hi",locale,[self shortValue]);
+    case NSNumberTaggedUnsignedShort: return NSStringWithFormatAndLocale(@"%hu",locale,[self unsignedShortValue]);
+    case NSNumberTaggedInt: return NSStringWithFormatAndLocale(@"%i",locale,[self intValue]);
+    case NSNumberTaggedUnsignedInt: return NSStringWithFormatAndLocale(@"%u",locale,[self unsignedIntValue]);
+    case NSNumberTaggedLong: return NSStringWithFormatAndLocale(@"%li",locale,[self longValue]);
+    case NSNumberTaggedUnsignedLong: return NSStringWithFormatAndLocale(@"%lu",locale,[self unsignedLongValue]);
+    case NSNumberTaggedLongLong: return NSStringWithFormatAndLocale(@"%qi",locale,[self longLongValue]);
+    case NSNumberTaggedUnsignedLongLong: return NSStringWithFormatAndLocale(@"%qu",locale,[self unsignedLongLongValue]);
+    case NSNumberTaggedFloat: return NSStringWithFormatAndLocale(@"%0.7g",locale,[self floatValue]);
+    default: return NSStringWithFormatAndLocale(@"%0.15g",locale,[self doubleValue]);
+   }
+}
+
+@end
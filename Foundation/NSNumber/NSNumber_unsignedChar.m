@@ -6,11 +6,17 @@ The above copyright notice and this permission notice shall be included in all c
 
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #import <Foundation/NSNumber_unsignedChar.h>
+#import <Foundation/NSNumber_tagged.h>
 #import <Foundation/NSStringFormatter.h>
 
 @implementation NSNumber_unsignedChar
 
 NSNumber *NSNumber_unsignedCharNew(NSZone *zone,unsigned char value) {
+   NSNumber *tagged=NSNumber_taggedNewWithUnsigned(NSNumberTaggedUnsignedChar,value);
+
+   if(tagged!=nil)
+    return tagged;
+
    NSNumber_unsignedChar *self=NSAllocateObject([NSNumber_unsignedChar class],0,zone);
     if (self) {
        self->_type=kCFNumberCharType;
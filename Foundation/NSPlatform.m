@@ -158,5 +158,19 @@ extern NSString *NSPlatformClassName;
     if((NSZombieEnabled=[value isEqual:@"YES"]))
      NSCLog("NSZombieEnabled=YES");
    }
+   if([key isEqualToString:@"NSZoneDebugEnabled"]){
+    if((NSZoneDebugEnabled=[value isEqual:@"YES"]))
+     NSCLog("NSZoneDebugEnabled=YES");
+   }
+   if([key isEqualToString:@"NSHeapCensusEnabled"]){
+    if([value isEqual:@"YES"]){
+     NSSetHeapCensusEnabled(YES);
+     NSCLog("NSHeapCensusEnabled=YES");
+    }
+   }
+   if([key isEqualToString:@"NSHeapCensusSignal"]){
+    if(NSDumpHeapCensusOnSignal([value intValue]))
+     NSCLog("NSHeapCensusSignal=%d",[value intValue]);
+   }
 }
 @end
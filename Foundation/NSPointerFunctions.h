@@ -0,0 +1,65 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import <Foundation/NSObject.h>
+
+enum {
+    NSPointerFunctionsStrongMemory = (0 << 0),
+    NSPointerFunctionsZeroingWeakMemory = (1 << 0),
+    NSPointerFunctionsOpaqueMemory = (2 << 0),
+    NSPointerFunctionsMallocMemory = (3 << 0),
+    NSPointerFunctionsMachVirtualMemory = (4 << 0),
+    NSPointerFunctionsWeakMemory = (5 << 0),
+
+    NSPointerFunctionsObjectPersonality = (0 << 8),
+    NSPointerFunctionsOpaquePersonality = (1 << 8),
+    NSPointerFunctionsObjectPointerPersonality = (2 << 8),
+    NSPointerFunctionsCStringPersonality = (3 << 8),
+    NSPointerFunctionsStructPersonality = (4 << 8),
+    NSPointerFunctionsIntegerPersonality = (5 << 8),
+
+    NSPointerFunctionsCopyIn = (1 << 16),
+};
+
+typedef NSUInteger NSPointerFunctionsOptions;
+
+@interface NSPointerFunctions : NSObject <NSCopying> {
+    NSPointerFunctionsOptions _options;
+    NSUInteger (*_hashFunction)(const void *item, NSUInteger (*size)(const void *item));
+    BOOL (*_isEqualFunction)(const void *item1, const void *item2, NSUInteger (*size)(const void *item));
+    NSUInteger (*_sizeFunction)(const void *item);
+    NSString *(*_descriptionFunction)(const void *item);
+    void (*_relinquishFunction)(const void *item, NSUInteger (*size)(const void *item));
+    void *(*_acquireFunction)(const void *src, NSUInteger (*size)(const void *item), BOOL shouldCopy);
+    BOOL _usesStrongWriteBarrier;
+    BOOL _usesWeakReadAndWriteBarriers;
+}
+
++ pointerFunctionsWithOptions:(NSPointerFunctionsOptions)options;
+
+- initWithOptions:(NSPointerFunctionsOptions)options;
+
+- (NSUInteger (*)(const void *, NSUInteger (*)(const void *)))hashFunction;
+- (BOOL (*)(const void *, const void *, NSUInteger (*)(const void *)))isEqualFunction;
+- (NSUInteger (*)(const void *))sizeFunction;
+- (NSString * (*)(const void *))descriptionFunction;
+- (void (*)(const void *, NSUInteger (*)(const void *)))relinquishFunction;
+- (void *(*)(const void *, NSUInteger (*)(const void *), BOOL))acquireFunction;
+- (BOOL)usesStrongWriteBarrier;
+- (BOOL)usesWeakReadAndWriteBarriers;
+
+- (void)setHashFunction:(NSUInteger (*)(const void *, NSUInteger (*)(const void *)))function;
+- (void)setIsEqualFunction:(BOOL (*)(const void *, const void *, NSUInteger (*)(const void *)))function;
+- (void)setSizeFunction:(NSUInteger (*)(const void *))function;
+- (void)setDescriptionFunction:(NSString * (*)(const void *))function;
+- (void)setRelinquishFunction:(void (*)(const void *, NSUInteger (*)(const void *)))function;
+- (void)setAcquireFunction:(void *(*)(const void *, NSUInteger (*)(const void *), BOOL))function;
+- (void)setUsesStrongWriteBarrier:(BOOL)value;
+- (void)setUsesWeakReadAndWriteBarriers:(BOOL)value;
+
+@end
@@ -0,0 +1,259 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSPointerFunctions.h>
+#import <Foundation/NSString.h>
+#import <Foundation/NSZone.h>
+#include <string.h>
+
+#define NSPointerFunctionsMemoryMask 0xFF
+#define NSPointerFunctionsPersonalityMask 0xFF00
+
+static NSUInteger _NSPointerHash(const void *item, NSUInteger (*size)(const void *item)) {
+   return (NSUInteger)item>>5;
+}
+
+static NSUInteger _NSIntegerHash(const void *item, NSUInteger (*size)(const void *item)) {
+   return (NSUInteger)item;
+}
+
+static NSUInteger _NSObjectHash(const void *item, NSUInteger (*size)(const void *item)) {
+   return [(id)item hash];
+}
+
+static NSUInteger _NSCStringHash(const void *item, NSUInteger (*size)(const void *item)) {
+   const unsigned char *s=item;
+   NSUInteger result=5381;
+
+   for(;*s!='\0';s++)
+    result=result*33+*s;
+
+   return result;
+}
+
+static NSUInteger _NSStructHash(const void *item, NSUInteger (*size)(const void *item)) {
+   const unsigned char *s=item;
+   NSUInteger i,length=(size==NULL)?0:size(item),result=5381;
+
+   for(i=0;i<length;i++)
+    result=result*33+s[i];
+
+   return result;
+}
+
+static BOOL _NSPointerIsEqual(const void *item1, const void *item2, NSUInteger (*size)(const void *item)) {
+   return (item1==item2)?YES:NO;
+}
+
+static BOOL _NSObjectIsEqual(const void *item1, const void *item2, NSUInteger (*size)(const void *item)) {
+   return (item1==item2 || [(id)item1 isEqual:(id)item2])?YES:NO;
+}
+
+static BOOL _NSCStringIsEqual(const void *item1, const void *item2, NSUInteger (*size)(const void *item)) {
+   return (item1==item2 || strcmp(item1,item2)==0)?YES:NO;
+}
+
+static BOOL _NSStructIsEqual(const void *item1, const void *item2, NSUInteger (*size)(const void *item)) {
+   NSUInteger length;
+
+   if(size==NULL)
+    return (item1==item2)?YES:NO;
+
+   length=size(item1);
+   return (length==size(item2) && memcmp(item1,item2,length)==0)?YES:NO;
+}
+
+static NSString *_NSPointerDescribe(const void *item) {
+   return [NSString stringWithFormat:@"%p",item];
+}
+
+static NSString *_NSIntegerDescribe(const void *item) {
+   return [NSString stringWithFormat:@"%ld",(long)item];
+}
+
+static NSString *_NSObjectDescribe(const void *item) {
+   return [(id)item description];
+}
+
+static NSString *_NSCStringDescribe(const void *item) {
+   return [NSString stringWithCString:item];
+}
+
+static void *_NSObjectAcquire(const void *src, NSUInteger (*size)(const void *item), BOOL shouldCopy) {
+   return shouldCopy?[(id)src copyWithZone:NULL]:[(id)src retain];
+}
+
+static void *_NSMallocAcquire(const void *src, NSUInteger (*size)(const void *item), BOOL shouldCopy) {
+   NSUInteger length;
+   void *result;
+
+   if(!shouldCopy || src==NULL)
+    return (void *)src;
+
+   length=(size!=NULL)?size(src):strlen(src)+1;
+   result=NSZoneMalloc(NULL,length);
+   memcpy(result,src,length);
+
+   return result;
+}
+
+static void _NSObjectRelinquish(const void *item, NSUInteger (*size)(const void *item)) {
+   [(id)item release];
+}
+
+static void _NSMallocRelinquish(const void *item, NSUInteger (*size)(const void *item)) {
+   if(item!=NULL)
+    NSZoneFree(NSZoneFromPointer((void *)item),(void *)item);
+}
+
+@implementation NSPointerFunctions
+
++pointerFunctionsWithOptions:(NSPointerFunctionsOptions)options {
+   return [[[self allocWithZone:NULL] initWithOptions:options] autorelease];
+}
+
+-initWithOptions:(NSPointerFunctionsOptions)options {
+   NSPointerFunctionsOptions memory=options&NSPointerFunctionsMemoryMask;
+   NSPointerFunctionsOptions personality=options&NSPointerFunctionsPersonalityMask;
+   BOOL isObject=(personality==NSPointerFunctionsObjectPersonality || personality==NSPointerFunctionsObjectPointerPersonality);
+
+   _options=options;
+
+   switch(personality){
+    case NSPointerFunctionsObjectPersonality:
+     _hashFunction=_NSObjectHash;
+     _isEqualFunction=_NSObjectIsEqual;
+     _descriptionFunction=_NSObjectDescribe;
+     break;
+
+    case NSPointerFunctionsObjectPointerPersonality:
+     _hashFunction=_NSPointerHash;
+     _isEqualFunction=_NSPointerIsEqual;
+     _descriptionFunction=_NSObjectDescribe;
+     break;
+
+    case NSPointerFunctionsCStringPersonality:
+     _hashFunction=_NSCStringHash;
+     _isEqualFunction=_NSCStringIsEqual;
+     _descriptionFunction=_NSCStringDescribe;
+     break;
+
+    case NSPointerFunctionsStructPersonality:
+     _hashFunction=_NSStructHash;
+     _isEqualFunction=_NSStructIsEqual;
+     _descriptionFunction=_NSPointerDescribe;
+     break;
+
+    case NSPointerFunctionsIntegerPersonality:
+     _hashFunction=_NSIntegerHash;
+     _isEqualFunction=_NSPointerIsEqual;
+     _descriptionFunction=_NSIntegerDescribe;
+     break;
+
+    default:
+     _hashFunction=_NSPointerHash;
+     _isEqualFunction=_NSPointerIsEqual;
+     _descriptionFunction=_NSPointerDescribe;
+     break;
+   }
+
+   switch(memory){
+    case NSPointerFunctionsStrongMemory:
+     if(isObject){
+      _acquireFunction=_NSObjectAcquire;
+      _relinquishFunction=_NSObjectRelinquish;
+     }
+     _usesStrongWriteBarrier=YES;
+     break;
+
+    case NSPointerFunctionsMallocMemory:
+     _acquireFunction=_NSMallocAcquire;
+     _relinquishFunction=_NSMallocRelinquish;
+     break;
+
+    case NSPointerFunctionsWeakMemory:
+    case NSPointerFunctionsZeroingWeakMemory:
+     // not retained, the collection stores these with objc_storeWeak
+     _usesWeakReadAndWriteBarriers=YES;
+     break;
+
+    default:
+     break;
+   }
+
+   return self;
+}
+
+-copyWithZone:(NSZone *)zone {
+   return NSCopyObject(self,0,zone);
+}
+
+-(NSUInteger (*)(const void *, NSUInteger (*)(const void *)))hashFunction {
+   return _hashFunction;
+}
+
+-(BOOL (*)(const void *, const void *, NSUInteger (*)(const void *)))isEqualFunction {
+   return _isEqualFunction;
+}
+
+-(NSUInteger (*)(const void *))sizeFunction {
+   return _sizeFunction;
+}
+
+-(NSString *(*)(const void *))descriptionFunction {
+   return _descriptionFunction;
+}
+
+-(void (*)(const void *, NSUInteger (*)(const void *)))relinquishFunction {
+   return _relinquishFunction;
+}
+
+-(void *(*)(const void *, NSUInteger (*)(const void *), BOOL))acquireFunction {
+   return _acquireFunction;
+}
+
+-(BOOL)usesStrongWriteBarrier {
+   return _usesStrongWriteBarrier;
+}
+
+-(BOOL)usesWeakReadAndWriteBarriers {
+   return _usesWeakReadAndWriteBarriers;
+}
+
+-(void)setHashFunction:(NSUInteger (*)(const void *, NSUInteger (*)(const void *)))function {
+   _hashFunction=function;
+}
+
+-(void)setIsEqualFunction:(BOOL (*)(const void *, const void *, NSUInteger (*)(const void *)))function {
+   _isEqualFunction=function;
+}
+
+-(void)setSizeFunction:(NSUInteger (*)(const void *))function {
+   _sizeFunction=function;
+}
+
+-(void)setDescriptionFunction:(NSString *(*)(const void *))function {
+   _descriptionFunction=function;
+}
+
+-(void)setRelinquishFunction:(void (*)(const void *, NSUInteger (*)(const void *)))function {
+   _relinquishFunction=function;
+}
+
+-(void)setAcquireFunction:(void *(*)(const void *, NSUInteger (*)(const void *), BOOL))function {
+   _acquireFunction=function;
+}
+
+-(void)setUsesStrongWriteBarrier:(BOOL)value {
+   _usesStrongWriteBarrier=value;
+}
+
+-(void)setUsesWeakReadAndWriteBarriers:(BOOL)value {
+   _usesWeakReadAndWriteBarriers=value;
+}
+
+@end
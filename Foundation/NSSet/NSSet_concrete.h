@@ -7,11 +7,16 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #import <Foundation/NSSet.h>
-#import <Foundation/NSInlineSetTable.h>
+
+// Immutable sets are one block laid out as objects[count] and, from NSSetConcreteIndexedCount
+// objects up, their hashes[count] and an open addressed index of entry numbers into them.
+// Smaller sets are scanned instead.
+#define NSSetConcreteIndexedCount 8
 
 @interface NSSet_concrete : NSSet {
-    NSSetTable _table;
-    NSSetBucket *_buckets[0];
+    NSUInteger _count;
+    NSUInteger _mask; // index size - 1, 0 when scanned
+    id _objects[0];
 }
 @end
 
@@ -6,44 +6,167 @@ The above copyright notice and this permission notice shall be included in all c
 
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #import <Foundation/NSSet_concrete.h>
-#import <Foundation/NSEnumerator_set.h>
+#import <Foundation/NSHashIndex.h>
+#import <Foundation/NSArray_concrete.h>
+#import <Foundation/NSEnumerator_objects.h>
 #import <Foundation/NSAutoreleasePool-private.h>
+#include <string.h>
+#include <stdint.h>
 
 @implementation NSSet_concrete
 
+static inline NSUInteger *hashesOf(NSSet_concrete *self,NSUInteger count){
+   return (NSUInteger *)(self->_objects+count);
+}
+
+static inline uint32_t *indexOf(NSSet_concrete *self,NSUInteger count){
+   return (uint32_t *)(hashesOf(self,count)+count);
+}
+
+static void buildIndex(NSSet_concrete *self){
+   NSUInteger count=self->_count,mask=NSHashIndexSizeForCount(count)-1;
+
+   NSHashIndexBuild(indexOf(self,count),mask,hashesOf(self,count),count);
+   self->_mask=mask;
+}
+
+// Objects are stored, and the index filled in, as they are added so duplicates can be found;
+// the first of equal objects is kept.
 NSSet *NSSet_concreteNew(NSZone *zone,id *objects,NSUInteger count) {
-   NSUInteger       i,capacity=NSSetTableRoundCount(count);
-   NSSet_concrete *self=NSAllocateObject([NSSet_concrete class],
-     sizeof(NSSetBucket *)*capacity,zone);
-    if (self) {
-       self->_table.count=0;
-       self->_table.numBuckets=capacity;
-       self->_table.buckets=self->_buckets;
-
-       for(i=0;i<count;i++)
-        NSSetTableAddObjectNoGrow(&(self->_table),objects[i]);
+   BOOL            indexed=(count>=NSSetConcreteIndexedCount);
+   NSUInteger      extra=sizeof(id)*count,scanHashes[NSSetConcreteIndexedCount];
+   NSUInteger      i,unique=0,mask=0,*hashes=scanHashes;
+   uint32_t       *index=NULL;
+   NSSet_concrete *self;
+
+   if(indexed){
+    mask=NSHashIndexSizeForCount(count)-1;
+    extra+=sizeof(NSUInteger)*count+sizeof(uint32_t)*(mask+1);
+   }
+
+   self=NSAllocateObject([NSSet_concrete class],extra,zone);
+   self->_count=count;
+   if(indexed){
+    hashes=hashesOf(self,count);
+    index=indexOf(self,count);
+   }
+
+   for(i=0;i<count;i++){
+    id         object=objects[i];
+    NSUInteger hash,check;
+    BOOL       found=NO;
+
+    if(object==nil)
+     continue;
+
+    hash=[object hash];
+    if(indexed){
+     NSUInteger slot;
+
+     for(slot=NSHashIndexSlotForHash(hash,mask);index[slot]!=0;slot=(slot+1)&mask){
+      check=index[slot]-1;
+      if(hashes[check]==hash && [self->_objects[check] isEqual:object]){
+       found=YES;
+       break;
+      }
+     }
+     if(!found)
+      index[slot]=unique+1;
+    }
+    else {
+     for(check=0;check<unique;check++)
+      if(hashes[check]==hash && [self->_objects[check] isEqual:object]){
+       found=YES;
+       break;
+      }
+    }
+
+    if(!found){
+     self->_objects[unique]=[object retain];
+     hashes[unique]=hash;
+     unique++;
+    }
+   }
+
+   if(unique<count){
+    // close up the layout for the smaller count, the tail of the block goes unused
+    self->_count=unique;
+    if(unique>=NSSetConcreteIndexedCount){
+     memmove(hashesOf(self,unique),hashes,sizeof(NSUInteger)*unique);
+     buildIndex(self);
     }
+   }
+   else if(indexed)
+    self->_mask=mask;
 
    return self;
 }
 
 -(void)dealloc {
-   NSSetTableFreeObjects(&_table);
+   NSUInteger i;
+
+   for(i=0;i<_count;i++)
+    [_objects[i] release];
+
    NSDeallocateObject(self);
    return;
    [super dealloc];
 }
 
 -(NSUInteger)count {
-   return _table.count;
+   return _count;
 }
 
 -member:object {
-   return NSSetTableMember(&_table,object);
+   NSUInteger i;
+
+   if(object==nil)
+    return nil;
+
+   if(_mask==0){
+    for(i=0;i<_count;i++)
+     if(_objects[i]==object)
+      return object;
+
+    for(i=0;i<_count;i++)
+     if([_objects[i] isEqual:object])
+      return _objects[i];
+   }
+   else {
+    NSUInteger  hash=[object hash],*hashes=hashesOf(self,_count);
+    uint32_t   *index=indexOf(self,_count),entry;
+
+    for(i=NSHashIndexSlotForHash(hash,_mask);(entry=index[i])!=0;i=(i+1)&_mask){
+     entry--;
+     if(hashes[entry]==hash && (_objects[entry]==object || [_objects[entry] isEqual:object]))
+      return _objects[entry];
+    }
+   }
+
+   return nil;
 }
 
 -(NSEnumerator *)objectEnumerator {
-   return NSAutorelease(NSEnumerator_setNew(NULL,self,&_table));
+   return NSAutorelease(NSEnumerator_objectsNew(self,_objects,_count));
+}
+
+-(NSArray *)allObjects {
+   return NSAutorelease(NSArray_concreteNew(NULL,_objects,_count));
+}
+
+-anyObject {
+   return (_count==0)?nil:_objects[0];
+}
+
+-(NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id *)stackbuf count:(NSUInteger)length {
+   if(state->state>=_count)
+    return 0;
+
+   state->itemsPtr=_objects;
+   state->state=_count;
+   state->mutationsPtr=(unsigned long *)self;
+
+   return _count;
 }
 
 @end
@@ -25,9 +25,7 @@ static inline void resolveStorageIfNeeded(NSConstantString *self){
    uint32_t length=self->_length;
 
    if((length&(STORAGE_ASCII|STORAGE_UTF8))==0){
-    NSInteger check=NSConvertUTF8toUTF16(self->_bytes,length,NULL);
-
-    if(check==length)
+    if(NSUTF8IsASCII((const char *)self->_bytes,length))
      self->_length|=STORAGE_ASCII;
     else
      self->_length|=STORAGE_UTF8;
@@ -103,6 +101,11 @@ static inline NSUInteger lengthInUnicode(NSConstantString *self){
     }
 }
 
+// the compiler emits the bytes as zero terminated UTF-8
+-(const char *)UTF8String {
+   return (const char *)_bytes;
+}
+
 -(unichar)characterAtIndex:(NSUInteger)location {
    NSUInteger length=lengthInUnicode(self);
 
@@ -165,13 +168,13 @@ static inline NSUInteger lengthInUnicode(NSConstantString *self){
    NSUInteger length=lengthInUnicode(self);
 
    if(storageIsASCII(self))
-    return NSStringHashASCII(_bytes,MIN(length,NSHashStringLength));
+    return NSStringHashASCII(_bytes,length);
    else {
     unichar   unicode[length];
     //NSInteger check=
     NSConvertUTF8toUTF16(self->_bytes,lengthOfBytes(self),unicode);
 
-    return NSStringHashUnicode(unicode,MIN(length,NSHashStringLength));
+    return NSStringHashUnicode(unicode,length);
    }
 }
 
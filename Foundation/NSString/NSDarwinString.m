@@ -84,7 +84,7 @@ int __CFConstantStringClassReference[12] = {0};
 }
 
 -(NSUInteger)hash {
-   return NSStringHashASCII(_bytes,MIN(_length,NSHashStringLength));
+   return NSStringHashASCII(_bytes,_length);
 }
 
 @end
@@ -0,0 +1,36 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSString.h>
+
+// Character storage for large mutable strings. The characters are split into chunks of a few
+// thousand, each chunk knows its UTF-16 offset and the number of line terminators before it, so
+// an edit moves at most one chunk's worth of characters and lines can be found without a scan
+// of the whole string.
+
+#define NSMutableStringRopeChunkLength 4096
+
+typedef struct NSMutableStringRope NSMutableStringRope;
+
+NSMutableStringRope *NSMutableStringRopeCreate(NSZone *zone, const unichar *characters, NSUInteger length);
+void NSMutableStringRopeFree(NSMutableStringRope *rope);
+
+NSUInteger NSMutableStringRopeLength(NSMutableStringRope *rope);
+unichar NSMutableStringRopeCharacterAtIndex(NSMutableStringRope *rope, NSUInteger location);
+void NSMutableStringRopeGetCharacters(NSMutableStringRope *rope, unichar *buffer, NSRange range);
+void NSMutableStringRopeReplaceCharacters(NSMutableStringRope *rope, NSRange range, const unichar *characters, NSUInteger length);
+
+// Lines end at \n, \r, \r\n, U+0085, U+2028 or U+2029, a string always has one more line than terminators.
+// NSMutableStringRopeIndexOfLine returns NSNotFound past the last line.
+NSUInteger NSMutableStringRopeNumberOfLines(NSMutableStringRope *rope);
+NSUInteger NSMutableStringRopeLineOfIndex(NSMutableStringRope *rope, NSUInteger location);
+NSUInteger NSMutableStringRopeIndexOfLine(NSMutableStringRope *rope, NSUInteger line);
+
+// The same on a flat buffer, NSUnicodeIndexOfLine returns NSNotFound past the last line
+NSUInteger NSUnicodeLineTerminatorCount(const unichar *characters, NSUInteger length);
+NSUInteger NSUnicodeLineOfIndex(const unichar *characters, NSUInteger length, NSUInteger location);
+NSUInteger NSUnicodeIndexOfLine(const unichar *characters, NSUInteger length, NSUInteger line);
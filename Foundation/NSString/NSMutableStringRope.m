@@ -0,0 +1,372 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSMutableStringRope.h>
+#include <string.h>
+
+// Chunks are built NSMutableStringRopeChunkLength long and edited in place until an edit would
+// take one past twice that, then the edited characters are cut into chunks again. A \r\n is never
+// split between two chunks so line terminators are counted a chunk at a time, the one extra
+// character of capacity is room to move a \n back across a boundary.
+#define NSMutableStringRopeChunkMaximum (2*NSMutableStringRopeChunkLength)
+
+typedef struct {
+   unichar   *characters;
+   NSUInteger length,capacity;
+   NSUInteger start;     // UTF-16 offset of the first character
+   NSUInteger lines;     // line terminators in the chunk
+   NSUInteger lineStart; // line terminators before the chunk
+} NSMutableStringRopeChunk;
+
+struct NSMutableStringRope {
+   NSZone                   *zone;
+   NSUInteger                length;
+   NSUInteger                count,capacity;
+   NSMutableStringRopeChunk *chunks;
+   NSUInteger                last; // chunk of the last lookup, sequential access doesn't search
+};
+
+static inline BOOL isLineTerminatorAt(const unichar *characters,NSUInteger length,NSUInteger i){
+   unichar c=characters[i];
+
+   if(c>'\r' && c!=0x85 && (c|1)!=0x2029)
+    return NO;
+   if(c=='\r')
+    return (i+1==length || characters[i+1]!='\n'); // the \n ends a \r\n
+   
+   return (c=='\n' || c==0x85 || (c|1)==0x2029);
+}
+
+static NSUInteger lineTerminatorsInRange(const unichar *characters,NSUInteger length,NSUInteger start,NSUInteger end){
+   NSUInteger result=0;
+
+   for(;start<end;start++)
+    if(isLineTerminatorAt(characters,length,start))
+     result++;
+
+   return result;
+}
+
+NSUInteger NSUnicodeLineTerminatorCount(const unichar *characters,NSUInteger length){
+   return lineTerminatorsInRange(characters,length,0,length);
+}
+
+NSUInteger NSUnicodeLineOfIndex(const unichar *characters,NSUInteger length,NSUInteger location){
+   NSUInteger result=NSUnicodeLineTerminatorCount(characters,location);
+
+   // between the \r and \n of a \r\n is still the line before it
+   if(location>0 && location<length && characters[location-1]=='\r' && characters[location]=='\n')
+    result--;
+
+   return result;
+}
+
+NSUInteger NSUnicodeIndexOfLine(const unichar *characters,NSUInteger length,NSUInteger line){
+   NSUInteger i;
+
+   if(line==0)
+    return 0;
+
+   for(i=0;i<length;i++)
+    if(isLineTerminatorAt(characters,length,i))
+     if(--line==0)
+      return i+1;
+
+   return NSNotFound;
+}
+
+static void reserveChunks(NSMutableStringRope *rope,NSUInteger count){
+   if(count>rope->capacity){
+    if(rope->capacity==0)
+     rope->capacity=8;
+    while(count>rope->capacity)
+     rope->capacity*=2;
+
+    rope->chunks=NSZoneRealloc(rope->zone,rope->chunks,sizeof(NSMutableStringRopeChunk)*rope->capacity);
+   }
+}
+
+static void reserveCharacters(NSMutableStringRope *rope,NSMutableStringRopeChunk *chunk,NSUInteger length){
+   if(length>chunk->capacity){
+    chunk->capacity=NSMutableStringRopeChunkMaximum+1;
+    chunk->characters=NSZoneRealloc(rope->zone,chunk->characters,sizeof(unichar)*chunk->capacity);
+   }
+}
+
+static void removeChunk(NSMutableStringRope *rope,NSUInteger index){
+   NSZoneFree(rope->zone,rope->chunks[index].characters);
+   rope->count--;
+   memmove(rope->chunks+index,rope->chunks+index+1,(rope->count-index)*sizeof(NSMutableStringRopeChunk));
+}
+
+// replaces remove chunks at index with as few chunks as will hold the characters, returns how many
+static NSUInteger replaceChunks(NSMutableStringRope *rope,NSUInteger index,NSUInteger remove,const unichar *characters,NSUInteger length){
+   NSUInteger count=(length+NSMutableStringRopeChunkLength-1)/NSMutableStringRopeChunkLength;
+   NSUInteger i;
+
+   for(i=0;i<remove;i++)
+    NSZoneFree(rope->zone,rope->chunks[index+i].characters);
+
+   reserveChunks(rope,rope->count-remove+count);
+   memmove(rope->chunks+index+count,rope->chunks+index+remove,(rope->count-index-remove)*sizeof(NSMutableStringRopeChunk));
+   rope->count=rope->count-remove+count;
+
+   for(i=0;i<count;i++){
+    NSMutableStringRopeChunk *chunk=rope->chunks+index+i;
+    NSUInteger                piece=length/count+((i<length%count)?1:0);
+
+    chunk->length=piece;
+    chunk->capacity=piece+NSMutableStringRopeChunkLength/4;
+    chunk->characters=NSZoneMalloc(rope->zone,sizeof(unichar)*chunk->capacity);
+    memcpy(chunk->characters,characters,sizeof(unichar)*piece);
+    chunk->lines=NSUnicodeLineTerminatorCount(chunk->characters,piece);
+    characters+=piece;
+   }
+
+   return count;
+}
+
+// moves the \n of a \r\n cut by the boundary after index into the chunk with the \r
+static void joinLineTerminator(NSMutableStringRope *rope,NSUInteger index){
+   NSMutableStringRopeChunk *left,*right;
+
+   if(index+1>=rope->count)
+    return;
+
+   left=rope->chunks+index;
+   right=left+1;
+   if(left->characters[left->length-1]!='\r' || right->characters[0]!='\n')
+    return;
+
+   // the \r was counted as a terminator on its own and the \n in the next chunk
+   reserveCharacters(rope,left,left->length+1);
+   left->characters[left->length++]='\n';
+   right->length--;
+   right->lines--;
+   memmove(right->characters,right->characters+1,sizeof(unichar)*right->length);
+   if(right->length==0)
+    removeChunk(rope,index+1);
+}
+
+// folds a short chunk into a neighbour so deletes don't leave the string in slivers
+static void mergeChunk(NSMutableStringRope *rope,NSUInteger index){
+   NSMutableStringRopeChunk *left,*right;
+
+   if(rope->chunks[index].length>=NSMutableStringRopeChunkLength/4)
+    return;
+
+   if(index+1<rope->count && rope->chunks[index].length+rope->chunks[index+1].length<=NSMutableStringRopeChunkLength)
+    left=rope->chunks+index;
+   else if(index>0 && rope->chunks[index-1].length+rope->chunks[index].length<=NSMutableStringRopeChunkLength)
+    left=rope->chunks+--index;
+   else
+    return;
+
+   right=left+1;
+   reserveCharacters(rope,left,left->length+right->length);
+   memcpy(left->characters+left->length,right->characters,sizeof(unichar)*right->length);
+   left->length+=right->length;
+   left->lines+=right->lines;
+   removeChunk(rope,index+1);
+}
+
+static void reindexChunks(NSMutableStringRope *rope,NSUInteger index){
+   NSMutableStringRopeChunk *chunks=rope->chunks;
+   NSUInteger                start=0,lineStart=0;
+
+   if(index>0){
+    start=chunks[index-1].start+chunks[index-1].length;
+    lineStart=chunks[index-1].lineStart+chunks[index-1].lines;
+   }
+
+   for(;index<rope->count;index++){
+    chunks[index].start=start;
+    chunks[index].lineStart=lineStart;
+    start+=chunks[index].length;
+    lineStart+=chunks[index].lines;
+   }
+
+   rope->length=start;
+}
+
+// location is less than the length
+static NSUInteger chunkIndexForLocation(NSMutableStringRope *rope,NSUInteger location){
+   NSMutableStringRopeChunk *chunks=rope->chunks;
+   NSUInteger                index=rope->last,low,high;
+
+   if(index<rope->count && location>=chunks[index].start){
+    if(location<chunks[index].start+chunks[index].length)
+     return index;
+    if(index+1<rope->count && location<chunks[index+1].start+chunks[index+1].length)
+     return rope->last=index+1;
+   }
+
+   for(low=0,high=rope->count;high-low>1;){
+    NSUInteger middle=(low+high)/2;
+
+    if(chunks[middle].start<=location)
+     low=middle;
+    else
+     high=middle;
+   }
+
+   return rope->last=low;
+}
+
+NSMutableStringRope *NSMutableStringRopeCreate(NSZone *zone,const unichar *characters,NSUInteger length){
+   NSMutableStringRope *rope=NSZoneCalloc(zone,1,sizeof(NSMutableStringRope));
+
+   rope->zone=zone;
+   NSMutableStringRopeReplaceCharacters(rope,NSMakeRange(0,0),characters,length);
+
+   return rope;
+}
+
+void NSMutableStringRopeFree(NSMutableStringRope *rope){
+   NSUInteger i;
+
+   for(i=0;i<rope->count;i++)
+    NSZoneFree(rope->zone,rope->chunks[i].characters);
+
+   NSZoneFree(rope->zone,rope->chunks);
+   NSZoneFree(rope->zone,rope);
+}
+
+NSUInteger NSMutableStringRopeLength(NSMutableStringRope *rope){
+   return rope->length;
+}
+
+unichar NSMutableStringRopeCharacterAtIndex(NSMutableStringRope *rope,NSUInteger location){
+   NSMutableStringRopeChunk *chunk=rope->chunks+chunkIndexForLocation(rope,location);
+
+   return chunk->characters[location-chunk->start];
+}
+
+void NSMutableStringRopeGetCharacters(NSMutableStringRope *rope,unichar *buffer,NSRange range){
+   NSUInteger index,offset;
+
+   if(range.length==0)
+    return;
+
+   index=chunkIndexForLocation(rope,range.location);
+   offset=range.location-rope->chunks[index].start;
+   while(YES){
+    NSMutableStringRopeChunk *chunk=rope->chunks+index;
+    NSUInteger                piece=MIN(chunk->length-offset,range.length);
+
+    memcpy(buffer,chunk->characters+offset,sizeof(unichar)*piece);
+    buffer+=piece;
+    range.length-=piece;
+    if(range.length==0)
+     break;
+
+    offset=0;
+    index++;
+   }
+
+   rope->last=index;
+}
+
+void NSMutableStringRopeReplaceCharacters(NSMutableStringRope *rope,NSRange range,const unichar *characters,NSUInteger length){
+   NSUInteger first,last,prefix,suffix,total,count,i;
+
+   if(range.length==0 && length==0)
+    return;
+
+   if(rope->count==0){
+    first=0;
+    count=replaceChunks(rope,0,0,characters,length);
+   }
+   else {
+    // an insert at the end goes into the last chunk
+    first=(range.location<rope->length)?chunkIndexForLocation(rope,range.location):rope->count-1;
+    last=(range.length==0)?first:chunkIndexForLocation(rope,NSMaxRange(range)-1);
+    prefix=range.location-rope->chunks[first].start;
+    suffix=rope->chunks[last].start+rope->chunks[last].length-NSMaxRange(range);
+    total=prefix+length+suffix;
+
+    if(first==last && total>0 && total<=NSMutableStringRopeChunkMaximum){
+     NSMutableStringRopeChunk *chunk=rope->chunks+first;
+     NSUInteger                before=(prefix>0)?prefix-1:0; // a \r before the edit may now end a \r\n
+
+     chunk->lines-=lineTerminatorsInRange(chunk->characters,chunk->length,before,prefix+range.length);
+     reserveCharacters(rope,chunk,total);
+     memmove(chunk->characters+prefix+length,chunk->characters+prefix+range.length,sizeof(unichar)*suffix);
+     if(length>0)
+      memcpy(chunk->characters+prefix,characters,sizeof(unichar)*length);
+     chunk->length=total;
+     chunk->lines+=lineTerminatorsInRange(chunk->characters,total,before,prefix+length);
+     count=1;
+    }
+    else {
+     unichar *joined=NSZoneMalloc(rope->zone,sizeof(unichar)*MAX(total,1));
+
+     memcpy(joined,rope->chunks[first].characters,sizeof(unichar)*prefix);
+     if(length>0)
+      memcpy(joined+prefix,characters,sizeof(unichar)*length);
+     memcpy(joined+prefix+length,rope->chunks[last].characters+rope->chunks[last].length-suffix,sizeof(unichar)*suffix);
+     count=replaceChunks(rope,first,last-first+1,joined,total);
+     NSZoneFree(rope->zone,joined);
+    }
+   }
+
+   // from the last boundary back so a removed chunk doesn't move the ones still to check
+   for(i=first+count;i>0 && i>=first;i--)
+    joinLineTerminator(rope,i-1);
+
+   if(first<rope->count)
+    mergeChunk(rope,first);
+   else if(first>0)
+    mergeChunk(rope,first-1);
+
+   reindexChunks(rope,(first>0)?first-1:0);
+}
+
+NSUInteger NSMutableStringRopeNumberOfLines(NSMutableStringRope *rope){
+   NSMutableStringRopeChunk *chunk;
+
+   if(rope->count==0)
+    return 1;
+
+   chunk=rope->chunks+rope->count-1;
+
+   return chunk->lineStart+chunk->lines+1;
+}
+
+NSUInteger NSMutableStringRopeLineOfIndex(NSMutableStringRope *rope,NSUInteger location){
+   NSMutableStringRopeChunk *chunk;
+
+   if(location>=rope->length)
+    return NSMutableStringRopeNumberOfLines(rope)-1;
+
+   chunk=rope->chunks+chunkIndexForLocation(rope,location);
+
+   return chunk->lineStart+NSUnicodeLineOfIndex(chunk->characters,chunk->length,location-chunk->start);
+}
+
+NSUInteger NSMutableStringRopeIndexOfLine(NSMutableStringRope *rope,NSUInteger line){
+   NSMutableStringRopeChunk *chunks=rope->chunks;
+   NSUInteger                terminator,low,high;
+
+   if(line==0)
+    return 0;
+   if(line>=NSMutableStringRopeNumberOfLines(rope))
+    return NSNotFound;
+
+   // the chunk holding the terminator that ends the line before
+   terminator=line-1;
+   for(low=0,high=rope->count;high-low>1;){
+    NSUInteger middle=(low+high)/2;
+
+    if(chunks[middle].lineStart<=terminator)
+     low=middle;
+    else
+     high=middle;
+   }
+
+   return chunks[low].start+NSUnicodeIndexOfLine(chunks[low].characters,chunks[low].length,terminator-chunks[low].lineStart+1);
+}
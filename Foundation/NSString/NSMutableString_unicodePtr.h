@@ -7,11 +7,22 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #import <Foundation/NSString.h>
+#import <Foundation/NSMutableStringRope.h>
+
+// Strings are edited in one buffer until an edit other than an append leaves them longer than
+// this, then the characters move to a rope. They go back to one buffer under a quarter of it.
+#define NSMutableStringRopeThreshold 65536
 
 @interface NSMutableString_unicodePtr : NSMutableString {
     NSUInteger _length, _capacity;
     unichar *_unicode;
+    NSMutableStringRope *_rope; // _unicode is NULL while the rope holds the characters
 }
+
+-(NSUInteger)_numberOfLines;
+-(NSUInteger)_lineOfCharacterIndex:(NSUInteger)location;
+-(NSUInteger)_characterIndexOfLine:(NSUInteger)line;
+
 @end
 
 NSString *NSMutableString_unicodePtrNewWithCString(NSZone *zone,
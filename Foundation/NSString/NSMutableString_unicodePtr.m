@@ -23,6 +23,40 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 @implementation NSMutableString_unicodePtr
 
+static void moveToRope(NSMutableString_unicodePtr *self){
+   self->_rope=NSMutableStringRopeCreate(NSZoneFromPointer(self),self->_unicode,self->_length);
+   NSZoneFree(NSZoneFromPointer(self->_unicode),self->_unicode);
+   self->_unicode=NULL;
+   self->_capacity=0;
+}
+
+static void moveToBuffer(NSMutableString_unicodePtr *self){
+   self->_capacity=MAX(self->_length*2,4);
+   self->_unicode=NSZoneMalloc(NSZoneFromPointer(self),sizeof(unichar)*self->_capacity);
+   NSMutableStringRopeGetCharacters(self->_rope,self->_unicode,NSMakeRange(0,self->_length));
+   NSMutableStringRopeFree(self->_rope);
+   self->_rope=NULL;
+}
+
+// a piece at a time, without cutting a surrogate pair in two
+static NSUInteger ropeUTF8Length(NSMutableStringRope *rope,NSUInteger length){
+   NSUInteger result=0,location=0;
+   unichar    buffer[1024];
+
+   while(location<length){
+    NSRange range=NSMakeRange(location,MIN(1024,length-location));
+
+    NSMutableStringRopeGetCharacters(rope,buffer,range);
+    if(NSMaxRange(range)<length && buffer[range.length-1]>=0xD800 && buffer[range.length-1]<0xDC00)
+     range.length--;
+
+    result+=NSConvertUTF16toUTF8(buffer,range.length,NULL);
+    location+=range.length;
+   }
+
+   return result;
+}
+
 -(NSUInteger)length {
    return _length;
 }
@@ -30,6 +64,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 -(NSUInteger)lengthOfBytesUsingEncoding:(NSStringEncoding)encoding {
     switch (encoding) {
         case NSUTF8StringEncoding:
+            if (_rope != NULL) {
+                return ropeUTF8Length(_rope, _length);
+            }
             return NSConvertUTF16toUTF8(_unicode, _length,NULL);
         case NSUnicodeStringEncoding:
             return _length;
@@ -47,10 +84,17 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
      location,[self length]);
    }
 
+   if(_rope!=NULL)
+    return NSMutableStringRopeCharacterAtIndex(_rope,location);
+
    return _unicode[location];
 }
 
 -(void)getCharacters:(unichar *)buffer {
+    if (_rope != NULL) {
+        NSMutableStringRopeGetCharacters(_rope, buffer, NSMakeRange(0, _length));
+        return;
+    }
     memcpy(buffer, _unicode, _length*sizeof(unichar));
 }
 
@@ -62,51 +106,100 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
      NSStringFromRange(range),[self length]);
    }
 
+   if(_rope!=NULL)
+    NSMutableStringRopeGetCharacters(_rope,buffer,range);
+   else
     memcpy(buffer, _unicode+loc, range.length*sizeof(unichar));
 
 }
 
 -(void)replaceCharactersInRange:(NSRange)range withString:(NSString *)string {
    NSUInteger otherlength=[string length];
-   NSUInteger i,loc=range.location;
+   NSUInteger loc=range.location,tail;
 
    if(NSMaxRange(range)>_length){
     NSRaiseException(NSRangeException,self,_cmd,@"range %@ beyond length %d",
      NSStringFromRange(range),[self length]);
    }
 
-   if(range.length<otherlength){ // make room
-    NSUInteger delta=otherlength-range.length;
+   // appends stay in the buffer, they only copy when it doubles
+   if(_rope==NULL && loc<_length && _length-range.length+otherlength>NSMutableStringRopeThreshold)
+    moveToRope(self);
 
-    _length+=delta;
+   if(_rope!=NULL){
+    unichar  buffer[256];
+    unichar *characters=(otherlength<=256)?buffer:NSZoneMalloc(NULL,sizeof(unichar)*otherlength);
 
-    if(_length>_capacity){
-     if(_capacity==0)
-      _capacity=1;
+    [string getCharacters:characters range:NSMakeRange(0,otherlength)];
+    NSMutableStringRopeReplaceCharacters(_rope,range,characters,otherlength);
+    if(characters!=buffer)
+     NSZoneFree(NULL,characters);
 
-     while(_length>_capacity)
-      _capacity*=2;
+    _length=NSMutableStringRopeLength(_rope);
+    if(_length<NSMutableStringRopeThreshold/4)
+     moveToBuffer(self);
+    return;
+   }
 
-     _unicode=NSZoneRealloc(NSZoneFromPointer(_unicode),_unicode,sizeof(unichar)*_capacity);
-    }
+   tail=_length-NSMaxRange(range);
+   _length=loc+otherlength+tail;
 
-    for(i=_length;--i>=loc+otherlength;)
-     _unicode[i]=_unicode[i-delta];
-   }
-   else if(range.length>otherlength){ // delete some
-    NSUInteger delta=range.length-otherlength;
+   if(_length>_capacity){ // make room
+    if(_capacity==0)
+     _capacity=1;
 
-    _length-=delta;
+    while(_length>_capacity)
+     _capacity*=2;
 
-    for(i=loc+otherlength;i<_length;i++)
-     _unicode[i]=_unicode[i+delta];
+    _unicode=NSZoneRealloc(NSZoneFromPointer(_unicode),_unicode,sizeof(unichar)*_capacity);
    }
 
+   if(range.length!=otherlength)
+    memmove(_unicode+loc+otherlength,_unicode+NSMaxRange(range),sizeof(unichar)*tail);
+
    [string getCharacters:_unicode+loc range:NSMakeRange(0,otherlength)];
 }
 
 -(NSUInteger)hash {
-   return NSStringHashUnicode(_unicode,MIN(_length,NSHashStringLength));
+   if(_rope!=NULL)
+    return [super hash];
+
+   return NSStringHashUnicode(_unicode,_length);
+}
+
+-(NSUInteger)_numberOfLines {
+   if(_rope!=NULL)
+    return NSMutableStringRopeNumberOfLines(_rope);
+
+   return NSUnicodeLineTerminatorCount(_unicode,_length)+1;
+}
+
+-(NSUInteger)_lineOfCharacterIndex:(NSUInteger)location {
+   if(location>_length){
+    NSRaiseException(NSRangeException,self,_cmd,@"index %d beyond length %d",
+     location,[self length]);
+   }
+
+   if(_rope!=NULL)
+    return NSMutableStringRopeLineOfIndex(_rope,location);
+
+   return NSUnicodeLineOfIndex(_unicode,_length,location);
+}
+
+-(NSUInteger)_characterIndexOfLine:(NSUInteger)line {
+   NSUInteger result;
+
+   if(_rope!=NULL)
+    result=NSMutableStringRopeIndexOfLine(_rope,line);
+   else
+    result=NSUnicodeIndexOfLine(_unicode,_length,line);
+
+   if(result==NSNotFound){
+    NSRaiseException(NSRangeException,self,_cmd,@"line %d beyond %d lines",
+     line,[self _numberOfLines]);
+   }
+
+   return result;
 }
 
 static inline NSUInteger roundCapacityUp(NSUInteger capacity){
@@ -199,7 +292,10 @@ NSString *NSMutableString_unicodePtrNewWithCapacity(NSZone *zone,
 }
 
 -(void)dealloc {
-   NSZoneFree(NSZoneFromPointer(self->_unicode),self->_unicode);
+   if(_rope!=NULL)
+    NSMutableStringRopeFree(_rope);
+   else
+    NSZoneFree(NSZoneFromPointer(self->_unicode),self->_unicode);
    NSDeallocateObject(self);
    return;
    [super dealloc];
@@ -30,6 +30,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSStringSymbol.h>
 #import <Foundation/NSStringUTF8.h>
 #import <Foundation/NSUnicodeCaseMapping.h>
+#import <Foundation/NSStringSearch.h>
 #import <Foundation/NSPropertyListReader.h>
 #import <Foundation/NSStringsFileParser.h>
 #import <Foundation/NSRaise.h>
@@ -492,10 +493,37 @@ static inline unsigned uctoi(unichar *c, NSUInteger *len)
 }
 
 
+#define NSStringComparePieceLength 256
+
+// a piece at a time, long strings don't go on the stack
+static NSComparisonResult comparePieces(NSString *self,NSString *other,BOOL caseInsensitive,NSRange range,NSUInteger otherLength){
+   unichar    selfBuf[NSStringComparePieceLength],otherBuf[NSStringComparePieceLength];
+   NSUInteger location,common=MIN(range.length,otherLength);
+
+   for(location=0;location<common;location+=NSStringComparePieceLength){
+    NSUInteger         piece=MIN(NSStringComparePieceLength,common-location);
+    NSComparisonResult result;
+
+    [self getCharacters:selfBuf range:NSMakeRange(range.location+location,piece)];
+    [other getCharacters:otherBuf range:NSMakeRange(location,piece)];
+    if((result=NSUnicodeCompare(selfBuf,piece,otherBuf,piece,caseInsensitive))!=NSOrderedSame)
+     return result;
+   }
+
+   if(range.length==otherLength)
+    return NSOrderedSame;
+
+   return (range.length<otherLength)?NSOrderedAscending:NSOrderedDescending;
+}
+
 static NSComparisonResult compareWithOptions(NSString *self,NSString *other,NSStringCompareOptions options,NSRange range){
    NSUInteger i,j,il,jl;
    NSUInteger otherLength=[other length];
    int      numResult;
+
+   if(!(options&NSNumericSearch))
+    return comparePieces(self,other,(options&NSCaseInsensitiveSearch)?YES:NO,range,otherLength);
+
    unichar  selfBuf[range.length],otherBuf[otherLength];
 
    [self getCharacters:selfBuf range:range];
@@ -506,30 +534,21 @@ static NSComparisonResult compareWithOptions(NSString *self,NSString *other,NSSt
     NSUnicodeToUppercase(otherBuf,otherLength);
    }
 
-   if(options&NSNumericSearch) {
-    for(i=0,j=0;i<range.length && j<otherLength;i++,j++) {
-     if(isNumChar(selfBuf[i]) && isNumChar(otherBuf[j])) {
-      il=range.length;
-      jl=otherLength;
-      numResult=uctoi(&selfBuf[i],&il)-uctoi(&otherBuf[j],&jl);
-      if(numResult<0)
-       return NSOrderedAscending;
-      else if(numResult>0)
-       return NSOrderedDescending;
-      i+=il;
-      j+=jl;
-     }
-     if(selfBuf[i]<otherBuf[j])
+   for(i=0,j=0;i<range.length && j<otherLength;i++,j++) {
+    if(isNumChar(selfBuf[i]) && isNumChar(otherBuf[j])) {
+     il=range.length;
+     jl=otherLength;
+     numResult=uctoi(&selfBuf[i],&il)-uctoi(&otherBuf[j],&jl);
+     if(numResult<0)
       return NSOrderedAscending;
-     else if(selfBuf[i]>otherBuf[j])
+     else if(numResult>0)
       return NSOrderedDescending;
+     i+=il;
+     j+=jl;
     }
-   }
-   else {
-   for(i=0;i<range.length && i<otherLength;i++)
-    if(selfBuf[i]<otherBuf[i])
+    if(selfBuf[i]<otherBuf[j])
      return NSOrderedAscending;
-    else if(selfBuf[i]>otherBuf[i])
+    else if(selfBuf[i]>otherBuf[j])
      return NSOrderedDescending;
    }
 
@@ -571,15 +590,18 @@ static NSComparisonResult compareWithOptions(NSString *self,NSString *other,NSSt
 }
 
 -(NSUInteger)hash {
-   NSRange  range={0,[self length]};
-   unichar  unicode[NSHashStringLength];
+   NSUInteger        length=[self length],location;
+   unichar           unicode[NSStringHashChunkLength];
+   NSStringHashState state=NSStringHashBegin(length);
 
-   if(range.length>NSHashStringLength)
-    range.length=NSHashStringLength;
+   for(location=0;location<length;location+=NSStringHashChunkLength){
+    NSRange range=NSMakeRange(location,MIN(NSStringHashChunkLength,length-location));
 
-   [self getCharacters:unicode range:range];
+    [self getCharacters:unicode range:range];
+    NSStringHashUnicodeRounds(&state,unicode,range.length);
+   }
 
-   return NSStringHashUnicode(unicode,range.length);
+   return NSStringHashFinish(&state,length);
 }
 
 static inline BOOL isEqualString(NSString *str1,NSString *str2){
@@ -698,104 +720,49 @@ static inline BOOL isEqualString(NSString *str1,NSString *str2){
     return YES;
 }
 
-// Knuth-Morris-Pratt string search
-static inline void computeNext(NSInteger next[],unichar patbuffer[],NSInteger patlength){
-    NSInteger i=0,j=-1;
-    
-    next[i]=j;
-    while(i<patlength){
-        while(j>=0 && patbuffer[j]!=patbuffer[i]) {
-            j = next[j];
-        }
-        
-        i++;
-        j++;
-        next[i]=j;
-    }
-}
-
-static inline NSRange rangeOfPatternNext(unichar *buffer,unichar *patbuffer,NSInteger *next,NSUInteger patlength,NSRange range){
-    NSInteger i=range.location,j=0;
-    NSInteger end = range.location + range.length;
-    
-    while (i < end) {
-        while (j >= 0 && buffer[i] != patbuffer[j]) {
-            j = next[j];
-        }
-        
-        i++;
-        j++;
-        
-        if (j == patlength) {
-            return NSMakeRange(i - patlength, patlength);
-        }
-    }
-    
-    return NSMakeRange(NSNotFound,0);
-}
-
-static inline void reverseString(unichar *buf, NSUInteger len) {
-    NSUInteger i;
-    NSUInteger half = len / 2;
-    for (i = 0; i < half; i++) {
-        unichar t = buf[len-1-i];
-        buf[len-1-i] = buf[i];
-        buf[i] = t;
-    }
-}
-
 -(NSRange)rangeOfString:(NSString *)string options:(NSStringCompareOptions)options range:(NSRange)range locale:(NSLocale *)locale {
    NSUnimplementedMethod();
    return NSMakeRange(0,0);
 }
 
+#define NSStringSearchBufferLength 256
+
 -(NSRange)rangeOfString:(NSString *)pattern options:(NSStringCompareOptions)options range:(NSRange)range {
-    NSUInteger length=[self length];
     NSUInteger patlength=[pattern length];
-    NSInteger      next[patlength+1];
+    unichar    bufferSpace[NSStringSearchBufferLength],patternSpace[NSStringSearchBufferLength];
+    unichar   *buffer,*patbuffer;
+    NSRange    foundRange;
     
     if(patlength==0) {
         return NSMakeRange(NSNotFound,0);
     }
     
     if(range.location+range.length>[self length]) {
-        [NSException raise:NSRangeException format:@"-[%@ %s] range %d,%d beyond length %d",isa,sel_getName(_cmd),range.location,range.length,[self length]];
+        [NSException raise:NSRangeException format:@"-[%@ %s] range %d,%d beyond length %d",[self class],sel_getName(_cmd),range.location,range.length,[self length]];
     }
     
-    unichar  *buffer = NSZoneMalloc(NULL, sizeof(unichar) * length);
-    unichar  *patbuffer = NSZoneMalloc(NULL, sizeof(unichar) * patlength+1);
-
-    [self getCharacters:buffer];
-    [pattern getCharacters:patbuffer];
+    if(patlength>range.length) {
+        return NSMakeRange(NSNotFound,0);
+    }
     
-    // it seems that this search is always literal anyway, so the NSLiteralSearch option can be ignored...?
-    options &= ~((unsigned)NSLiteralSearch);
+    // only the searched range is copied, NSLiteralSearch is what the search does anyway
+    buffer=(range.length<=NSStringSearchBufferLength)?bufferSpace:NSZoneMalloc(NULL,sizeof(unichar)*range.length);
+    patbuffer=(patlength<=NSStringSearchBufferLength)?patternSpace:NSZoneMalloc(NULL,sizeof(unichar)*patlength);
     
-    if(options & NSCaseInsensitiveSearch) {
-        NSUnicodeToUppercase(buffer,length);
-        NSUnicodeToUppercase(patbuffer,patlength);
-    }
+    [self getCharacters:buffer range:range];
+    [pattern getCharacters:patbuffer];
     
-    if(options & NSBackwardsSearch) {
-        reverseString(buffer, length);
-        reverseString(patbuffer, patlength);
-        range.location = length - (range.location + range.length);
+    foundRange=NSUnicodeRangeOfCharacters(buffer,range.length,patbuffer,patlength,options);
+    if(foundRange.location!=NSNotFound) {
+        foundRange.location+=range.location;
     }
     
-    computeNext(next,patbuffer,patlength);
-    
-    NSRange foundRange = rangeOfPatternNext(buffer,patbuffer,next,patlength,range);
-    if(options & NSAnchoredSearch && foundRange.location != 0) {
+    if(buffer!=bufferSpace) {
         NSZoneFree(NULL, buffer);
-        NSZoneFree(NULL, patbuffer);
-        return NSMakeRange(NSNotFound,0);
     }
-    
-    if((options & NSBackwardsSearch) && foundRange.location != NSNotFound) {
-        foundRange.location = length - foundRange.location - foundRange.length;
+    if(patbuffer!=patternSpace) {
+        NSZoneFree(NULL, patbuffer);
     }
-    NSZoneFree(NULL, buffer);
-    NSZoneFree(NULL, patbuffer);
     return foundRange;
 }
 
@@ -1036,7 +1003,7 @@ static inline void reverseString(unichar *buf, NSUInteger len) {
    unichar *unicode;
 
    if(NSMaxRange(range)>[self length])
-    [NSException raise:NSRangeException format:@"-[%@ %s] range %d,%d beyond length %d",isa,sel_getName(_cmd),range.location,range.length,[self length]];
+    [NSException raise:NSRangeException format:@"-[%@ %s] range %d,%d beyond length %d",[self class],sel_getName(_cmd),range.location,range.length,[self length]];
 
    if(range.length==0)
     return @"";
@@ -1052,7 +1019,7 @@ static inline void reverseString(unichar *buf, NSUInteger len) {
    NSRange range={location,[self length]-location};
 
    if(location>[self length])
-    [NSException raise:NSRangeException format:@"-[%@ %s] index %d beyond length %d",isa,sel_getName(_cmd),location,[self length]];
+    [NSException raise:NSRangeException format:@"-[%@ %s] index %d beyond length %d",[self class],sel_getName(_cmd),location,[self length]];
 
    return [self substringWithRange:range];
 }
@@ -1064,7 +1031,7 @@ static inline void reverseString(unichar *buf, NSUInteger len) {
     return [[self copy] autorelease];
 
    if(location>[self length])
-    [NSException raise:NSRangeException format:@"-[%@ %s] index %d beyond length %d",isa,sel_getName(_cmd),location,[self length]];
+    [NSException raise:NSRangeException format:@"-[%@ %s] index %d beyond length %d",[self class],sel_getName(_cmd),location,[self length]];
 
    return [self substringWithRange:range];
 }
@@ -1319,7 +1286,6 @@ static inline void reverseString(unichar *buf, NSUInteger len) {
     unichar        *buffer;
     unichar        *patbuffer;
     NSUInteger        patlength=[pattern length];
-    NSInteger             next[patlength+1];
     NSRange         search=NSMakeRange(0,length),where;
     
     if (length == 0) {
@@ -1333,12 +1299,11 @@ static inline void reverseString(unichar *buf, NSUInteger len) {
     [self getCharacters:buffer];
     [pattern getCharacters:patbuffer];
     
-    computeNext(next,patbuffer,patlength);
-    
     do {
-        where=rangeOfPatternNext(buffer,patbuffer,next,patlength,search);
+        where=NSUnicodeRangeOfCharacters(buffer+search.location,search.length,patbuffer,patlength,0);
         
         if(where.length>0){
+            where.location+=search.location;
             NSString *piece=[self substringWithRange:NSMakeRange(search.location,where.location-search.location)];
             
             [result addObject:piece];
@@ -9,26 +9,38 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSLocale.h>
 #import <Foundation/NSStringFormatter.h>
 #import <Foundation/NSString_unicodePtr.h>
-#import <Foundation/NSString_cString.h> //appendCString
 #import <Foundation/NSAutoreleasePool-private.h>
-#import "unibuffer.h"
 #import <Foundation/NSRaiseException.h>
+#import <Foundation/NSStringUTF8.h>
+#import <objc/objc_atomic.h>
 
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
 
+#define NSStringBufferStackSize 256
+
+// The result is built on the stack and copied into an exact allocation when it is done, results
+// estimated to be larger start out on the heap instead.
 typedef struct {
    NSZone *zone;
    unsigned max,length;
    unichar *characters;
+   unichar *stack;
 } NSStringBuffer;
 
-static inline void prepForUse(NSStringBuffer *buffer,NSZone *zone){
+static inline void prepForUse(NSStringBuffer *buffer,NSZone *zone,unichar *stack,NSUInteger estimate){
    buffer->zone=zone;
-   buffer->max=1024;
    buffer->length=0;
-   buffer->characters=NSZoneMalloc(buffer->zone,sizeof(unichar)*buffer->max);
+   buffer->stack=stack;
+   if(estimate<=NSStringBufferStackSize){
+    buffer->max=NSStringBufferStackSize;
+    buffer->characters=stack;
+   }
+   else {
+    buffer->max=estimate;
+    buffer->characters=NSZoneMalloc(buffer->zone,sizeof(unichar)*buffer->max);
+   }
 }
 
 static inline void makeRoomForNcharacters(NSStringBuffer *buffer,NSUInteger n){
@@ -36,7 +48,12 @@ static inline void makeRoomForNcharacters(NSStringBuffer *buffer,NSUInteger n){
     while(buffer->length+n>buffer->max)
      buffer->max*=2;
 
-    buffer->characters=NSZoneRealloc(buffer->zone,buffer->characters,sizeof(unichar)*buffer->max);
+    if(buffer->characters==buffer->stack){
+     buffer->characters=NSZoneMalloc(buffer->zone,sizeof(unichar)*buffer->max);
+     memcpy(buffer->characters,buffer->stack,sizeof(unichar)*buffer->length);
+    }
+    else
+     buffer->characters=NSZoneRealloc(buffer->zone,buffer->characters,sizeof(unichar)*buffer->max);
    }
 }
 
@@ -46,8 +63,10 @@ static inline void appendCharacter(NSStringBuffer *buffer,unichar unicode){
    buffer->characters[buffer->length++]=unicode;
 }
 
-static inline void appendCharacters(NSStringBuffer *buffer,unichar *characters,NSUInteger length,unichar fillChar,BOOL leftAdj,int fieldWidth){
+// Pads the field out to fieldWidth and returns where its length characters go
+static inline unichar *reserveField(NSStringBuffer *buffer,NSUInteger length,unichar fillChar,BOOL leftAdj,int fieldWidth){
    NSUInteger i;
+   unichar   *result;
 
    makeRoomForNcharacters(buffer,(fieldWidth>length)?fieldWidth:length);
 
@@ -56,13 +75,48 @@ static inline void appendCharacters(NSStringBuffer *buffer,unichar *characters,N
      buffer->characters[buffer->length++]=fillChar;
    }
 
-   for(i=0;i<length;i++)
-    buffer->characters[buffer->length++]=characters[i];
+   result=buffer->characters+buffer->length;
+   buffer->length+=length;
 
    if(leftAdj && fieldWidth>length){
     for(i=0;i<fieldWidth-length;i++)
      buffer->characters[buffer->length++]=' ';
    }
+
+   return result;
+}
+
+static inline void appendCharacters(NSStringBuffer *buffer,unichar *characters,NSUInteger length,unichar fillChar,BOOL leftAdj,int fieldWidth){
+   memcpy(reserveField(buffer,length,fillChar,leftAdj,fieldWidth),characters,sizeof(unichar)*length);
+}
+
+static inline void appendBytes(NSStringBuffer *buffer,const char *bytes,NSUInteger length,unichar fillChar,BOOL leftAdj,int fieldWidth){
+   NSWidenBytesToUnicode((const uint8_t *)bytes,length,reserveField(buffer,length,fillChar,leftAdj,fieldWidth));
+}
+
+static const char decimalPairs[201]=
+ "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+ "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+ "8081828384858687888990919293949596979899";
+
+// Writes the digits backwards two at a time ending at end, returns the first digit
+static inline char *decimalDigits(char *end,unsigned long long value){
+   while(value>=100){
+    unsigned pair=(unsigned)(value%100)*2;
+
+    value/=100;
+    *--end=decimalPairs[pair+1];
+    *--end=decimalPairs[pair];
+   }
+
+   if(value>=10){
+    *--end=decimalPairs[value*2+1];
+    *--end=decimalPairs[value*2];
+   }
+   else
+    *--end=(char)value+'0';
+
+   return end;
 }
 
 static inline void appendUnichar(NSStringBuffer *buffer,unichar code,unichar fillChar,BOOL leftAdj,int fieldWidth){
@@ -103,6 +157,17 @@ static inline void appendDecimal(NSStringBuffer *buffer,long long value,unichar
     NSUInteger groupingLength=[groupingSeparator length];
     unichar    groupingBuffer[groupingLength];
 
+    // LLONG_MIN has no positive counterpart, it is left to the loop below
+    if(groupingSize==0 && value!=LLONG_MIN){
+     char  digits[24],*start=decimalDigits(digits+24,(value<0)?-value:value);
+
+     if(value!=0 && sign)
+      *--start=sign;
+
+     appendBytes(buffer,start,(digits+24)-start,fillChar,leftAdj,fieldWidth);
+     return;
+    }
+
     [groupingSeparator getCharacters:groupingBuffer];
     
     if(value<0)
@@ -133,34 +198,26 @@ static inline void appendDecimal(NSStringBuffer *buffer,long long value,unichar
 
 static inline void appendOctal(NSStringBuffer *buffer,unsigned long long value,
   unichar fillChar,BOOL leftAdj,int fieldWidth){
-    unsigned length=0;
-    unichar  characters[100];
+    char digits[24],*start=digits+24;
 
-    while(value){
-     characters[length++]=(value&0x07)+'0';
+    do{
+     *--start=(value&0x07)+'0';
      value>>=3;
-    }
-
-    if(length==0)
-     characters[length++]='0';
+    }while(value);
 
-    appendReversed(buffer,characters,length,fillChar,leftAdj,fieldWidth);
+    appendBytes(buffer,start,(digits+24)-start,fillChar,leftAdj,fieldWidth);
 }
 
 static inline void appendHex(NSStringBuffer *buffer,unsigned long long value,
   unichar fillChar,BOOL leftAdj,int fieldWidth,const char *hexes){
-    unsigned length=0;
-    unichar  characters[100];
+    char digits[16],*start=digits+16;
 
-    while(value){
-     characters[length++]=hexes[value&0x0F];
+    do{
+     *--start=hexes[value&0x0F];
      value>>=4;
-    }
+    }while(value);
 
-    if(length==0)
-     characters[length++]='0';
-
-    appendReversed(buffer,characters,length,fillChar,leftAdj,fieldWidth);
+    appendBytes(buffer,start,(digits+16)-start,fillChar,leftAdj,fieldWidth);
 }
 
 static inline void appendUnsigned(NSStringBuffer *buffer,unsigned long long value,
@@ -170,6 +227,13 @@ static inline void appendUnsigned(NSStringBuffer *buffer,unsigned long long valu
     NSUInteger groupingLength=[groupingSeparator length];
     unichar    groupingBuffer[groupingLength];
 
+    if(groupingSize==0){
+     char digits[24],*start=decimalDigits(digits+24,value);
+
+     appendBytes(buffer,start,(digits+24)-start,fillChar,leftAdj,fieldWidth);
+     return;
+    }
+
     [groupingSeparator getCharacters:groupingBuffer];
 
     while(value){
@@ -195,16 +259,11 @@ static inline void appendUnsigned(NSStringBuffer *buffer,unsigned long long valu
 
 static inline void appendCString(NSStringBuffer *buffer,const char *cString,
   unichar fillChar,BOOL leftAdj,int fieldWidth){
-   NSUInteger length;
-   unichar *characters;
-
    if(cString==NULL)
     cString="(null pointer)";
 
-   characters=NSString_anyCStringToUnicode(NSASCIIStringEncoding,cString,strlen(cString),&length,NULL);
-   appendCharacters(buffer,characters,length,fillChar,leftAdj,fieldWidth);
-
-   NSZoneFree(NULL,characters);
+   // ASCII is converted as Latin 1, every byte widens to its character
+   appendBytes(buffer,cString,strlen(cString),fillChar,leftAdj,fieldWidth);
 }
 
 static inline void appendCStringChar(NSStringBuffer *buffer,char c,
@@ -232,9 +291,25 @@ double roundDouble(double value) {
    return value;
 }
 
+// Looked up once per format, the locale doesn't change while it is formatted
+static unichar decimalSeparator(NSDictionary *locale,unichar *cache){
+   if(*cache=='\0'){
+    NSString *seperatorString;
+
+    if(locale)
+     seperatorString = [locale objectForKey:NSLocaleDecimalSeparator];
+    else
+     seperatorString = [[NSLocale systemLocale] objectForKey:NSLocaleDecimalSeparator];
+
+    *cache=([seperatorString length]>0)?[seperatorString characterAtIndex:0]:'.';
+   }
+
+   return *cache;
+}
+
 static inline void appendFloat(NSStringBuffer *buffer,double value,
   unichar fillChar,BOOL leftAdj,BOOL plusSign,BOOL spaceSign,
-  int fieldWidth,int precision,BOOL gFormat,BOOL altForm,NSDictionary *locale,NSString *groupingSeparator,NSUInteger groupingSize){
+  int fieldWidth,int precision,BOOL gFormat,BOOL altForm,NSDictionary *locale,unichar *decimalSeparatorCache,NSString *groupingSeparator,NSUInteger groupingSize){
    int valueType=fpclassify(value);
   
    if(valueType==FP_INFINITE)
@@ -304,15 +379,7 @@ static inline void appendFloat(NSStringBuffer *buffer,double value,
     reverseCharacters(characters,length);
 
     if(precision>0){
-     NSString *seperatorString;
-     unichar   decimalSeperator;
-     
-     if(locale)
-      seperatorString = [locale objectForKey:NSLocaleDecimalSeparator];
-     else
-      seperatorString = [[NSLocale systemLocale] objectForKey:NSLocaleDecimalSeparator];
-      
-     decimalSeperator=([seperatorString length]>0)?[seperatorString characterAtIndex:0]:'.';
+     unichar   decimalSeperator=decimalSeparator(locale,decimalSeparatorCache);
      
      unsigned start=length;
      BOOL     fractZero=YES;
@@ -353,34 +420,168 @@ static inline void appendObject(NSStringBuffer *buffer,id object,
     appendCString(buffer,"*nil*",fillChar,leftAdj,fieldWidth);
    else {
     NSString *string=[object description];
-    unibuffer ubuffer=NewUnibufferWithString(string);
-
-    appendCharacters(buffer,ubuffer.characters,ubuffer.length,fillChar,leftAdj,fieldWidth);
 
-    FreeUnibuffer(ubuffer);
+    [string getCharacters:reserveField(buffer,[string length],fillChar,leftAdj,fieldWidth)];
    }
 }
 
 static inline unichar *prepForReturn(NSStringBuffer *buffer,NSUInteger *lengthp){
 
    *lengthp=buffer->max=buffer->length;
-   buffer->characters=NSZoneRealloc(buffer->zone,buffer->characters,sizeof(unichar)*buffer->max);
+   if(buffer->characters!=buffer->stack)
+    buffer->characters=NSZoneRealloc(buffer->zone,buffer->characters,sizeof(unichar)*buffer->max);
+   else {
+    buffer->characters=NSZoneMalloc(buffer->zone,sizeof(unichar)*buffer->max);
+    memcpy(buffer->characters,buffer->stack,sizeof(unichar)*buffer->length);
+   }
 
    return buffer->characters;
 }
 
-unichar *NSCharactersNewWithFormat(NSString *format,NSDictionary *locale,va_list arguments,NSUInteger *lengthp,NSZone *zone){
-   return NSCharactersNewWithFormatAndGrouping(format,locale,arguments,lengthp,zone,nil,0);
+// Formats are compiled into runs of literal characters and conversions. Constant strings are
+// never freed so their compiled forms are cached by address, other formats are compiled for
+// each use. A conversion remembers how many '*' arguments it takes and the digits which follow
+// the last one, so the arguments are consumed and combined exactly as they were while parsing.
+
+typedef struct {
+   unichar  conversion; // '\0' for a run of literal characters
+   unichar  fillChar,modifier;
+   BOOL     altForm,leftAdj,plusSign,spaceSign;
+   unsigned widthArguments,precisionArguments;
+   int      fieldWidth,widthScale;
+   int      precision,precisionScale;
+   unsigned location,length; // literal characters
+} NSFormatOperation;
+
+typedef struct {
+   NSString         *format;
+   NSUInteger        count,literalLength;
+   NSUInteger        estimate;
+   unichar          *literals;
+   NSFormatOperation operations[1];
+} NSCompiledFormat;
+
+#define NSCompiledFormatCacheSize 512 // power of 2
+#define NSCompiledFormatCacheProbes 8
+
+static NSCompiledFormat *volatile compiledFormats[NSCompiledFormatCacheSize];
+
+static inline NSUInteger compiledFormatIndex(NSString *format){
+   NSUInteger hash=(NSUInteger)format>>4;
+
+   return (hash^(hash>>9))&(NSCompiledFormatCacheSize-1);
 }
 
-unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *locale,va_list arguments,NSUInteger *lengthp,NSZone *zone,NSString *groupingSeparator,NSInteger groupingSize){
-   NSUInteger  pos,fmtLength=[format length];
-   unichar   fmtBuffer[fmtLength],unicode;
-   NSStringBuffer result;
+static inline NSCompiledFormat *cachedFormat(NSString *format){
+   NSUInteger i,index=compiledFormatIndex(format);
+
+   for(i=0;i<NSCompiledFormatCacheProbes;i++,index=(index+1)&(NSCompiledFormatCacheSize-1)){
+    NSCompiledFormat *check=OBJCAtomicLoad(compiledFormats+index);
+
+    if(check==NULL)
+     return NULL;
+    if(check->format==format)
+     return check;
+   }
+
+   return NULL;
+}
+
+static NSCompiledFormat *compiledFormatCreate(NSString *format,NSUInteger operations,NSUInteger literals){
+   NSCompiledFormat *result=NSZoneMalloc(NULL,sizeof(NSCompiledFormat)+operations*sizeof(NSFormatOperation)+literals*sizeof(unichar));
+
+   result->format=format;
+   result->count=0;
+   result->literalLength=0;
+   result->estimate=0;
+   result->literals=(unichar *)(result->operations+operations+1);
+
+   return result;
+}
+
+// Returns the cached copy of compiled, NULL when the slots around the format are taken
+static NSCompiledFormat *cacheFormat(NSCompiledFormat *compiled){
+   NSUInteger        i,index=compiledFormatIndex(compiled->format);
+   NSCompiledFormat *copy=NULL;
+
+   for(i=0;i<NSCompiledFormatCacheProbes;i++,index=(index+1)&(NSCompiledFormatCacheSize-1)){
+    NSCompiledFormat *check=OBJCAtomicLoad(compiledFormats+index);
+
+    if(check==NULL){
+     if(copy==NULL){
+      copy=compiledFormatCreate(compiled->format,compiled->count,compiled->literalLength);
+      copy->count=compiled->count;
+      copy->literalLength=compiled->literalLength;
+      copy->estimate=compiled->estimate;
+      memcpy(copy->operations,compiled->operations,sizeof(NSFormatOperation)*compiled->count);
+      memcpy(copy->literals,compiled->literals,sizeof(unichar)*compiled->literalLength);
+     }
+
+     if(__sync_bool_compare_and_swap(compiledFormats+index,NULL,copy))
+      return copy;
+
+     check=OBJCAtomicLoad(compiledFormats+index);
+    }
+
+    if(check->format==compiled->format){
+     NSZoneFree(NULL,copy);
+     return check;
+    }
+   }
+
+   NSZoneFree(NULL,copy);
+   return NULL;
+}
+
+static inline void appendLiteral(NSCompiledFormat *format,unichar unicode){
+   NSFormatOperation *last=(format->count>0)?format->operations+format->count-1:NULL;
+
+   if(last==NULL || last->conversion!='\0'){
+    last=format->operations+format->count++;
+    last->conversion='\0';
+    last->location=format->literalLength;
+    last->length=0;
+   }
+
+   format->literals[format->literalLength++]=unicode;
+   last->length++;
+}
+
+// A guess at the characters a conversion produces, only used to size the first allocation
+static inline NSUInteger estimateConversion(const NSFormatOperation *operation){
+   NSUInteger result;
+
+   switch(operation->conversion){
+    case 'd': case 'D': case 'i': case 'u': case 'U':
+     result=20;
+     break;
+
+    case 'o': case 'x': case 'X': case 'p':
+     result=22;
+     break;
+
+    case 'e': case 'E': case 'f': case 'g': case 'G':
+     result=24;
+     break;
+
+    default:
+     result=16;
+     break;
+   }
+
+   if(operation->widthArguments==0 && operation->fieldWidth>result)
+    result=operation->fieldWidth;
+
+   return result;
+}
 
-   unichar fillChar=' ',dwModify=' ';
-   BOOL    altForm=NO,leftAdj=NO,plusSign=NO,spaceSign=NO;
-   int     fieldWidth=0,precision=6;
+// Parses the format the same way the characters were parsed while formatting, literal
+// characters are moved down in place since they never get ahead of the parse.
+static NSCompiledFormat *compileFormat(NSString *format){
+   NSUInteger         i,pos,fmtLength=[format length];
+   NSCompiledFormat  *result=compiledFormatCreate(format,fmtLength,fmtLength);
+   unichar           *fmtBuffer=result->literals,unicode;
+   NSFormatOperation *operation=NULL;
 
    enum {
     STATE_SCANNING,
@@ -393,8 +594,6 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
 
    [format getCharacters:fmtBuffer];
 
-   prepForUse(&result,zone);
-
    for(pos=0;pos<fmtLength;pos++){
     unicode=fmtBuffer[pos];
 
@@ -402,12 +601,16 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
 
      case STATE_SCANNING:
       if(unicode!='%')
-       appendCharacter(&result,unicode);
+       appendLiteral(result,unicode);
       else{
-       fillChar=dwModify=' ';
-       altForm=leftAdj=plusSign=spaceSign=NO;
-       fieldWidth=0;
-       precision=6;
+       operation=result->operations+result->count;
+       operation->fillChar=operation->modifier=' ';
+       operation->altForm=operation->leftAdj=operation->plusSign=operation->spaceSign=NO;
+       operation->widthArguments=operation->precisionArguments=0;
+       operation->fieldWidth=0;
+       operation->widthScale=1;
+       operation->precision=6;
+       operation->precisionScale=1;
        state=STATE_PERCENT;
       }
       break;
@@ -415,11 +618,11 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
      case STATE_PERCENT:
       switch(unicode){
 
-       case '#': altForm=YES; break;
-       case '0': fillChar='0'; break;
-       case '-': leftAdj=YES; break;
-       case '+': plusSign=YES; break;
-       case ' ': spaceSign=YES; break;
+       case '#': operation->altForm=YES; break;
+       case '0': operation->fillChar='0'; break;
+       case '-': operation->leftAdj=YES; break;
+       case '+': operation->plusSign=YES; break;
+       case ' ': operation->spaceSign=YES; break;
 
        default:
         pos--;
@@ -433,15 +636,14 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
 
        case '0': case '1': case '2': case '3': case '4':
        case '5': case '6': case '7': case '8': case '9':
-        fieldWidth=fieldWidth*10+(unicode-'0');
+        operation->fieldWidth=operation->fieldWidth*10+(unicode-'0');
+        operation->widthScale*=10;
         break;
 
        case '*':
-        fieldWidth=va_arg(arguments,int);
-        if(fieldWidth<0){
-         leftAdj=YES;
-         fieldWidth=-fieldWidth;
-        }
+        operation->widthArguments++;
+        operation->fieldWidth=0;
+        operation->widthScale=1;
         break;
 
        case '$': // FIXME: argument index for localization
@@ -449,7 +651,7 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
         break;
         
        case '.':
-        precision=0;
+        operation->precision=0;
         state=STATE_PRECISION;
         break;
 
@@ -465,11 +667,14 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
 
        case '0': case '1': case '2': case '3': case '4':
        case '5': case '6': case '7': case '8': case '9':
-        precision=precision*10+(unicode-'0');
+        operation->precision=operation->precision*10+(unicode-'0');
+        operation->precisionScale*=10;
         break;
 
        case '*': // fix
-        precision=va_arg(arguments,int);
+        operation->precisionArguments++;
+        operation->precision=0;
+        operation->precisionScale=1;
         break;
 
        default:
@@ -485,7 +690,7 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
        case 'h': case 'l': case 'q':
         // New Cocoa special modes for NSInteger and NSUInteger
         case 'z': case 't':
-        dwModify=unicode;
+        operation->modifier=unicode;
         break;
 
        default:
@@ -496,173 +701,265 @@ unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *loc
       break;
 
      case STATE_CONVERSION:
-      switch(unicode){
+      // conversions without arguments to consume are folded into the literals or dropped,
+      // an unknown one which has '*' arguments is kept as '?' to consume them
+      if(unicode<0x80 && unicode!='\0' && strchr("dDioxXuUcCsSfeEgGpn@%",unicode)!=NULL){
+       if(unicode=='%' && operation->widthArguments==0 && operation->precisionArguments==0)
+        appendLiteral(result,'%');
+       else {
+        operation->conversion=unicode;
+        result->count++;
+       }
+      }
+      else if(operation->widthArguments>0 || operation->precisionArguments>0){
+       operation->conversion='?';
+       result->count++;
+      }
+      state=STATE_SCANNING;
+      break;
+    }
+   }
 
-       case 'd': case 'D': case 'i':{
-         long long value;
-
-         if(dwModify=='h')
-          value=(short)va_arg(arguments,int);
-         else if(dwModify=='l')
-          value=va_arg(arguments,long);
-         else if(dwModify=='q')
-          value=va_arg(arguments,long long);
-         else if(dwModify=='z')
-          value=va_arg(arguments, NSInteger);
-         else
-          value=va_arg(arguments,int);
-
-         appendDecimal(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,groupingSeparator,groupingSize);
-        }
-        break;
+   result->estimate=result->literalLength;
+   for(i=0;i<result->count;i++)
+    if(result->operations[i].conversion!='\0')
+     result->estimate+=estimateConversion(result->operations+i);
 
-       case 'o': {
-         unsigned long long value;
+   return result;
+}
 
-         if(dwModify=='h')
-          value=(unsigned short)va_arg(arguments,int);
-         else if(dwModify=='l')
-          value=va_arg(arguments,unsigned long);
-         else if(dwModify=='q')
-          value=va_arg(arguments,unsigned long long);
-         else
-          value=va_arg(arguments,unsigned int);
+static unichar *formatCompiled(NSCompiledFormat *format,NSDictionary *locale,va_list arguments,NSUInteger *lengthp,NSZone *zone,NSString *groupingSeparator,NSInteger groupingSize){
+   unichar        stack[NSStringBufferStackSize];
+   unichar        decimalSeparatorCache='\0';
+   NSStringBuffer result;
+   NSUInteger     i,j;
 
-         appendOctal(&result,value,fillChar,leftAdj,fieldWidth);
-        }
-        break;
+   prepForUse(&result,zone,stack,format->estimate);
 
-       case 'x':{
-         unsigned long long value;
-
-         if(dwModify=='h')
-          value=(unsigned short)va_arg(arguments,int);
-         else if(dwModify=='l')
-          value=va_arg(arguments,unsigned long);
-         else if(dwModify=='q')
-          value=va_arg(arguments,unsigned long long);
-         else if(dwModify=='t')
-          value=va_arg(arguments, NSUInteger);
-         else
-          value=va_arg(arguments,unsigned int);
-
-         appendHex(&result,value,fillChar,leftAdj,fieldWidth,"0123456789abcdef");
-        }
-        break;
+   for(i=0;i<format->count;i++){
+    const NSFormatOperation *operation=format->operations+i;
+    unichar fillChar=operation->fillChar,dwModify=operation->modifier;
+    BOOL    altForm=operation->altForm,leftAdj=operation->leftAdj,plusSign=operation->plusSign,spaceSign=operation->spaceSign;
+    int     fieldWidth=operation->fieldWidth,precision=operation->precision;
 
-       case 'X':{
-         unsigned long long value;
-
-         if(dwModify=='h')
-          value=(unsigned short)va_arg(arguments,int);
-         else if(dwModify=='l')
-          value=va_arg(arguments,unsigned long);
-         else if(dwModify=='q')
-          value=va_arg(arguments,unsigned long long);
-         else if(dwModify=='t')
-          value=va_arg(arguments, NSUInteger);
-         else
-          value=va_arg(arguments,unsigned int);
-
-         appendHex(&result,value,fillChar,leftAdj,fieldWidth,"0123456789ABCDEF");
-        }
-        break;
+    if(operation->conversion=='\0'){
+     makeRoomForNcharacters(&result,operation->length);
+     memcpy(result.characters+result.length,format->literals+operation->location,sizeof(unichar)*operation->length);
+     result.length+=operation->length;
+     continue;
+    }
 
-       case 'u': case 'U': {
-         unsigned long long value;
-
-         if(dwModify=='h')
-          value=(unsigned short)va_arg(arguments,int);
-         else if(dwModify=='l')
-          value=va_arg(arguments,unsigned long);
-         else if(dwModify=='q')
-          value=va_arg(arguments,unsigned long long);
-         else if(dwModify=='t')
-          value=va_arg(arguments, NSUInteger);
-         else
-          value=va_arg(arguments,unsigned int);
-
-         appendUnsigned(&result,value,fillChar,leftAdj,fieldWidth,groupingSeparator,groupingSize);
-        }
-        break;
+    if(operation->widthArguments>0){
+     int width=0;
 
-       case 'c':
-        appendCStringChar(&result,va_arg(arguments,int),fillChar,leftAdj,fieldWidth);
-        break;
+     for(j=0;j<operation->widthArguments;j++){
+      width=va_arg(arguments,int);
+      if(width<0){
+       leftAdj=YES;
+       width=-width;
+      }
+     }
+     fieldWidth+=width*operation->widthScale;
+    }
 
-       case 'C':
-        appendUnichar(&result,va_arg(arguments,int),fillChar,leftAdj,fieldWidth);
-        break;
+    if(operation->precisionArguments>0){
+     int argument=0;
 
-       case 's':
-        appendCString(&result,va_arg(arguments,char *),fillChar,leftAdj,fieldWidth);
-        break;
+     for(j=0;j<operation->precisionArguments;j++)
+      argument=va_arg(arguments,int);
+     precision+=argument*operation->precisionScale;
+    }
 
-       case 'S':
-        appendUnicodeString(&result,va_arg(arguments,unichar *),fillChar,leftAdj,fieldWidth);
-        break;
+    switch(operation->conversion){
 
-       case 'f':{
-         double value;
+     case 'd': case 'D': case 'i':{
+       long long value;
 
-         if(dwModify=='l')
-          value=va_arg(arguments,double);
-         else
-          value=va_arg(arguments,double);
+       if(dwModify=='h')
+        value=(short)va_arg(arguments,int);
+       else if(dwModify=='l')
+        value=va_arg(arguments,long);
+       else if(dwModify=='q')
+        value=va_arg(arguments,long long);
+       else if(dwModify=='z')
+        value=va_arg(arguments, NSInteger);
+       else
+        value=va_arg(arguments,int);
 
-         appendFloat(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,precision,NO,NO,locale,groupingSeparator,groupingSize);
-        }
-        break;
+       appendDecimal(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,groupingSeparator,groupingSize);
+      }
+      break;
 
-       case 'e': case 'E':{
-         double value;
+     case 'o': {
+       unsigned long long value;
 
-         if(dwModify=='l')
-          value=va_arg(arguments,double);
-         else
-          value=va_arg(arguments,double);
+       if(dwModify=='h')
+        value=(unsigned short)va_arg(arguments,int);
+       else if(dwModify=='l')
+        value=va_arg(arguments,unsigned long);
+       else if(dwModify=='q')
+        value=va_arg(arguments,unsigned long long);
+       else
+        value=va_arg(arguments,unsigned int);
 
-         appendFloat(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,precision,NO,NO,locale,groupingSeparator,groupingSize);
-        }
-        break;
+       appendOctal(&result,value,fillChar,leftAdj,fieldWidth);
+      }
+      break;
 
-       case 'g': case 'G':{
-         double value;
+     case 'x':{
+       unsigned long long value;
+
+       if(dwModify=='h')
+        value=(unsigned short)va_arg(arguments,int);
+       else if(dwModify=='l')
+        value=va_arg(arguments,unsigned long);
+       else if(dwModify=='q')
+        value=va_arg(arguments,unsigned long long);
+       else if(dwModify=='t')
+        value=va_arg(arguments, NSUInteger);
+       else
+        value=va_arg(arguments,unsigned int);
+
+       appendHex(&result,value,fillChar,leftAdj,fieldWidth,"0123456789abcdef");
+      }
+      break;
 
-         if(dwModify=='l')
-          value=va_arg(arguments,double);
-         else
-          value=va_arg(arguments,double);
+     case 'X':{
+       unsigned long long value;
+
+       if(dwModify=='h')
+        value=(unsigned short)va_arg(arguments,int);
+       else if(dwModify=='l')
+        value=va_arg(arguments,unsigned long);
+       else if(dwModify=='q')
+        value=va_arg(arguments,unsigned long long);
+       else if(dwModify=='t')
+        value=va_arg(arguments, NSUInteger);
+       else
+        value=va_arg(arguments,unsigned int);
+
+       appendHex(&result,value,fillChar,leftAdj,fieldWidth,"0123456789ABCDEF");
+      }
+      break;
 
-         appendFloat(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,precision,YES,altForm,locale,groupingSeparator,groupingSize);
-        }
-        break;
+     case 'u': case 'U': {
+       unsigned long long value;
+
+       if(dwModify=='h')
+        value=(unsigned short)va_arg(arguments,int);
+       else if(dwModify=='l')
+        value=va_arg(arguments,unsigned long);
+       else if(dwModify=='q')
+        value=va_arg(arguments,unsigned long long);
+       else if(dwModify=='t')
+        value=va_arg(arguments, NSUInteger);
+       else
+        value=va_arg(arguments,unsigned int);
+
+       appendUnsigned(&result,value,fillChar,leftAdj,fieldWidth,groupingSeparator,groupingSize);
+      }
+      break;
 
-       case 'p':
-        appendHex(&result,(long)va_arg(arguments,void *),fillChar,leftAdj,fieldWidth,"0123456789ABCDEF");
-        break;
+     case 'c':
+      appendCStringChar(&result,va_arg(arguments,int),fillChar,leftAdj,fieldWidth);
+      break;
 
-       case 'n':
-        *va_arg(arguments,int *)=result.length;
-        break;
+     case 'C':
+      appendUnichar(&result,va_arg(arguments,int),fillChar,leftAdj,fieldWidth);
+      break;
 
-       case '@':
-        appendObject(&result,va_arg(arguments,id),fillChar,leftAdj,fieldWidth);
-        break;
+     case 's':
+      appendCString(&result,va_arg(arguments,char *),fillChar,leftAdj,fieldWidth);
+      break;
 
-       case '%':
-        appendCharacter(&result,'%');
-        break;
+     case 'S':
+      appendUnicodeString(&result,va_arg(arguments,unichar *),fillChar,leftAdj,fieldWidth);
+      break;
+
+     case 'f':{
+       double value;
+
+       if(dwModify=='l')
+        value=va_arg(arguments,double);
+       else
+        value=va_arg(arguments,double);
+
+       appendFloat(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,precision,NO,NO,locale,&decimalSeparatorCache,groupingSeparator,groupingSize);
       }
-      state=STATE_SCANNING;
       break;
-    }
 
+     case 'e': case 'E':{
+       double value;
+
+       if(dwModify=='l')
+        value=va_arg(arguments,double);
+       else
+        value=va_arg(arguments,double);
+
+       appendFloat(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,precision,NO,NO,locale,&decimalSeparatorCache,groupingSeparator,groupingSize);
+      }
+      break;
+
+     case 'g': case 'G':{
+       double value;
+
+       if(dwModify=='l')
+        value=va_arg(arguments,double);
+       else
+        value=va_arg(arguments,double);
+
+       appendFloat(&result,value,fillChar,leftAdj,plusSign,spaceSign,fieldWidth,precision,YES,altForm,locale,&decimalSeparatorCache,groupingSeparator,groupingSize);
+      }
+      break;
+
+     case 'p':
+      appendHex(&result,(long)va_arg(arguments,void *),fillChar,leftAdj,fieldWidth,"0123456789ABCDEF");
+      break;
+
+     case 'n':
+      *va_arg(arguments,int *)=result.length;
+      break;
+
+     case '@':
+      appendObject(&result,va_arg(arguments,id),fillChar,leftAdj,fieldWidth);
+      break;
+
+     case '%':
+      appendCharacter(&result,'%');
+      break;
+    }
    }
 
    return prepForReturn(&result,lengthp);
 }
 
+unichar *NSCharactersNewWithFormat(NSString *format,NSDictionary *locale,va_list arguments,NSUInteger *lengthp,NSZone *zone){
+   return NSCharactersNewWithFormatAndGrouping(format,locale,arguments,lengthp,zone,nil,0);
+}
+
+unichar *NSCharactersNewWithFormatAndGrouping(NSString *format,NSDictionary *locale,va_list arguments,NSUInteger *lengthp,NSZone *zone,NSString *groupingSeparator,NSInteger groupingSize){
+   static Class      constantStringClass=Nil;
+   NSCompiledFormat *compiled,*cached;
+   unichar          *result;
+
+   if((compiled=cachedFormat(format))!=NULL)
+    return formatCompiled(compiled,locale,arguments,lengthp,zone,groupingSeparator,groupingSize);
+
+   if(constantStringClass==Nil)
+    constantStringClass=[NSConstantString class];
+
+   compiled=compileFormat(format);
+   if([format isKindOfClass:constantStringClass] && (cached=cacheFormat(compiled))!=NULL){
+    NSZoneFree(NULL,compiled);
+    return formatCompiled(cached,locale,arguments,lengthp,zone,groupingSeparator,groupingSize);
+   }
+
+   result=formatCompiled(compiled,locale,arguments,lengthp,zone,groupingSeparator,groupingSize);
+   NSZoneFree(NULL,compiled);
+
+   return result;
+}
+
 NSString *NSStringNewWithFormat(NSString *format,NSDictionary *locale,
   va_list arguments,NSZone *zone) {
    NSUInteger  length;
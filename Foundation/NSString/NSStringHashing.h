@@ -7,34 +7,164 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #import <Foundation/NSString.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__SSE2__) && defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 
-#define NSHashStringLength 63
+// Strings hash their full length as UTF-16 code units. Characters are loaded four to a 64 bit
+// word and each eight go through one 64x64->128 bit multiply and fold, the round wyhash uses,
+// in one of two lanes. Byte strings are widened to code units as they are loaded, with SSE2
+// where it is available, so a string of 8 bit characters hashes the same as the unichar string
+// with the same characters, whatever the class.
 
-// djb2
+// Characters per call to NSStringHashUnicodeRounds when hashing in pieces, a multiple of 16
+#define NSStringHashChunkLength 64
 
-static inline NSUInteger NSStringHashUnicode(const unichar *buffer, NSUInteger length) {
-    NSUInteger i, result = 5381;
+#define NSStringHashSecret0 0xa0761d6478bd642fULL
+#define NSStringHashSecret1 0xe7037ed1a0b428dbULL
+#define NSStringHashSecret2 0x8ebc6af09c88c6e3ULL
+
+static inline uint64_t NSStringHashMix(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t product = (__uint128_t)a * b;
+
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+#else
+    uint64_t aHigh = a >> 32, aLow = (uint32_t)a, bHigh = b >> 32, bLow = (uint32_t)b;
+    uint64_t middle0 = aHigh * bLow, middle1 = aLow * bHigh, low = aLow * bLow;
+    uint64_t result = low + (middle0 << 32), carry = (result < low);
 
-    for(i = 0; i < length; i++)
-        result = ((result << 5) + result) + buffer[i]; // hash*33+c
+    low = result;
+    result += middle1 << 32;
+    carry += (result < low);
+
+    return result ^ (aHigh * bHigh + (middle0 >> 32) + (middle1 >> 32) + carry);
+#endif
+}
 
+// code units 0 to 3 in the low to high 16 bits
+static inline uint64_t NSStringHashLoadUnicode(const unichar *buffer) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return (uint64_t)buffer[0] | ((uint64_t)buffer[1] << 16) | ((uint64_t)buffer[2] << 32) | ((uint64_t)buffer[3] << 48);
+#else
+    uint64_t result;
+
+    memcpy(&result, buffer, sizeof(result));
     return result;
+#endif
 }
 
-static inline NSUInteger NSStringHashASCII(const char *buffer, NSUInteger length) {
-    NSUInteger i, result = 5381;
+// bytes 0 to 3 spread into the low byte of each 16 bit lane
+static inline uint64_t NSStringHashLoadBytes(const uint8_t *buffer) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    uint64_t result = (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+#else
+    uint32_t word;
+    uint64_t result;
+
+    memcpy(&word, buffer, sizeof(word));
+    result = word;
+#endif
+    result = (result | (result << 16)) & 0x0000FFFF0000FFFFULL;
+    return (result | (result << 8)) & 0x00FF00FF00FF00FFULL;
+}
 
-    for(i = 0; i < length; i++)
-        result = ((result << 5) + result) + (NSUInteger)(buffer[i]); // hash*33+c
+typedef struct {
+    uint64_t lanes[2];
+} NSStringHashState;
+
+static inline NSStringHashState NSStringHashBegin(NSUInteger length) {
+    NSStringHashState result = { { NSStringHashSecret0 ^ (uint64_t)length, NSStringHashSecret2 } };
 
     return result;
 }
 
-static inline NSUInteger NSStringHashZeroTerminatedASCII(const char *buffer) {
-    NSUInteger i, result = 5381;
+static inline void NSStringHashRound(NSStringHashState *state, int lane, uint64_t word0, uint64_t word1) {
+    state->lanes[lane] = NSStringHashMix(word0 ^ NSStringHashSecret1, word1 ^ state->lanes[lane]);
+}
 
-    for(i = 0; buffer[i] != '\0'; i++)
-        result = ((result << 5) + result) + (NSUInteger)(buffer[i]); // hash*33+c
+// Sixteen characters go to the two lanes at once so the multiplies overlap. Whatever is left
+// takes one more round in each lane, only the last call for a string may have a remainder.
+static inline void NSStringHashUnicodeRounds(NSStringHashState *state, const unichar *buffer, NSUInteger length) {
+    NSUInteger i;
 
-    return result;
+    for(i = 0; i + 16 <= length; i += 16) {
+        NSStringHashRound(state, 0, NSStringHashLoadUnicode(buffer + i), NSStringHashLoadUnicode(buffer + i + 4));
+        NSStringHashRound(state, 1, NSStringHashLoadUnicode(buffer + i + 8), NSStringHashLoadUnicode(buffer + i + 12));
+    }
+
+    if(i < length) {
+        uint64_t words[4] = { 0, 0, 0, 0 };
+        NSUInteger j;
+
+        for(j = 0; i + j + 4 <= length; j += 4)
+            words[j >> 2] = NSStringHashLoadUnicode(buffer + i + j);
+        for(; i + j < length; j++)
+            words[j >> 2] |= (uint64_t)buffer[i + j] << ((j & 3) * 16);
+        NSStringHashRound(state, 0, words[0], words[1]);
+        if(j > 8)
+            NSStringHashRound(state, 1, words[2], words[3]);
+    }
+}
+
+static inline void NSStringHashByteRounds(NSStringHashState *state, const uint8_t *buffer, NSUInteger length) {
+    NSUInteger i;
+
+#if defined(__SSE2__) && defined(__x86_64__)
+    for(i = 0; i + 16 <= length; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(buffer + i)), zero = _mm_setzero_si128();
+        __m128i low = _mm_unpacklo_epi8(bytes, zero), high = _mm_unpackhi_epi8(bytes, zero);
+
+        NSStringHashRound(state, 0, (uint64_t)_mm_cvtsi128_si64(low), (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(low, low)));
+        NSStringHashRound(state, 1, (uint64_t)_mm_cvtsi128_si64(high), (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(high, high)));
+    }
+#else
+    for(i = 0; i + 16 <= length; i += 16) {
+        NSStringHashRound(state, 0, NSStringHashLoadBytes(buffer + i), NSStringHashLoadBytes(buffer + i + 4));
+        NSStringHashRound(state, 1, NSStringHashLoadBytes(buffer + i + 8), NSStringHashLoadBytes(buffer + i + 12));
+    }
+#endif
+
+    if(i < length) {
+        uint64_t words[4] = { 0, 0, 0, 0 };
+        NSUInteger j;
+
+        for(j = 0; i + j + 4 <= length; j += 4)
+            words[j >> 2] = NSStringHashLoadBytes(buffer + i + j);
+        for(; i + j < length; j++)
+            words[j >> 2] |= (uint64_t)buffer[i + j] << ((j & 3) * 16);
+        NSStringHashRound(state, 0, words[0], words[1]);
+        if(j > 8)
+            NSStringHashRound(state, 1, words[2], words[3]);
+    }
+}
+
+static inline NSUInteger NSStringHashFinish(NSStringHashState *state, NSUInteger length) {
+    uint64_t result = NSStringHashMix(state->lanes[0] ^ NSStringHashSecret2, state->lanes[1] ^ (uint64_t)length);
+
+    if(sizeof(NSUInteger) < sizeof(uint64_t))
+        result ^= result >> 32;
+
+    return (NSUInteger)result;
+}
+
+static inline NSUInteger NSStringHashUnicode(const unichar *buffer, NSUInteger length) {
+    NSStringHashState state = NSStringHashBegin(length);
+
+    NSStringHashUnicodeRounds(&state, buffer, length);
+    return NSStringHashFinish(&state, length);
+}
+
+// The bytes are the characters 0 to 255, as for ASCII and ISO Latin 1
+static inline NSUInteger NSStringHashASCII(const char *buffer, NSUInteger length) {
+    NSStringHashState state = NSStringHashBegin(length);
+
+    NSStringHashByteRounds(&state, (const uint8_t *)buffer, length);
+    return NSStringHashFinish(&state, length);
+}
+
+static inline NSUInteger NSStringHashZeroTerminatedASCII(const char *buffer) {
+    return NSStringHashASCII(buffer, strlen(buffer));
 }
@@ -0,0 +1,19 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSString.h>
+
+// Searching and comparing characters already copied out of a string. Case insensitive means the
+// uppercase characters from NSUnicodeCaseMapping.h are compared, nothing is allocated either way.
+
+// Index of the first character which differs, or length
+NSUInteger NSUnicodeMismatch(const unichar *characters, const unichar *other, NSUInteger length, BOOL caseInsensitive);
+
+NSComparisonResult NSUnicodeCompare(const unichar *characters, NSUInteger length, const unichar *other, NSUInteger otherLength, BOOL caseInsensitive);
+
+// Honors NSCaseInsensitiveSearch, NSBackwardsSearch and NSAnchoredSearch, the range is relative to characters
+NSRange NSUnicodeRangeOfCharacters(const unichar *characters, NSUInteger length, const unichar *pattern, NSUInteger patternLength, NSStringCompareOptions options);
@@ -0,0 +1,306 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSStringSearch.h>
+#import <Foundation/NSUnicodeCaseMapping.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Patterns are found by checking 8 positions at a time for the first and last character and
+// comparing the pattern wherever both match. A pattern which keeps almost matching falls back to
+// Two-Way, which stays linear however the pattern and text repeat.
+#define NSStringSearchFilterBudget 256
+
+#if defined(__SSE2__)
+// characters known to be below 0x80
+static inline __m128i uppercaseASCII(__m128i characters) {
+    __m128i lowercase = _mm_and_si128(_mm_cmpgt_epi16(characters, _mm_set1_epi16('a' - 1)), _mm_cmplt_epi16(characters, _mm_set1_epi16('z' + 1)));
+
+    return _mm_sub_epi16(characters, _mm_and_si128(lowercase, _mm_set1_epi16('a' - 'A')));
+}
+
+static inline BOOL isASCII(__m128i characters) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(characters, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128())) == 0xFFFF;
+}
+#endif
+
+NSUInteger NSUnicodeMismatch(const unichar *characters, const unichar *other, NSUInteger length, BOOL caseInsensitive) {
+    NSUInteger i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 8 <= length; i += 8) {
+        __m128i check = _mm_loadu_si128((const __m128i *)(characters + i));
+        __m128i otherCheck = _mm_loadu_si128((const __m128i *)(other + i));
+        int mask;
+
+        if (caseInsensitive) {
+            if (!isASCII(_mm_or_si128(check, otherCheck))) {
+                NSUInteger j;
+
+                for (j = i; j < i + 8; j++)
+                    if (NSUnicodeUppercaseCharacter(characters[j]) != NSUnicodeUppercaseCharacter(other[j]))
+                        return j;
+                continue;
+            }
+            check = uppercaseASCII(check);
+            otherCheck = uppercaseASCII(otherCheck);
+        }
+
+        if ((mask = _mm_movemask_epi8(_mm_cmpeq_epi16(check, otherCheck))) != 0xFFFF)
+            return i + __builtin_ctz(~mask) / 2;
+    }
+#endif
+
+    if (caseInsensitive) {
+        for (; i < length; i++)
+            if (NSUnicodeUppercaseCharacter(characters[i]) != NSUnicodeUppercaseCharacter(other[i]))
+                return i;
+    } else {
+        for (; i < length; i++)
+            if (characters[i] != other[i])
+                return i;
+    }
+
+    return length;
+}
+
+NSComparisonResult NSUnicodeCompare(const unichar *characters, NSUInteger length, const unichar *other, NSUInteger otherLength, BOOL caseInsensitive) {
+    NSUInteger common = MIN(length, otherLength);
+    NSUInteger i = NSUnicodeMismatch(characters, other, common, caseInsensitive);
+
+    if (i < common) {
+        unichar check = characters[i], otherCheck = other[i];
+
+        if (caseInsensitive) {
+            check = NSUnicodeUppercaseCharacter(check);
+            otherCheck = NSUnicodeUppercaseCharacter(otherCheck);
+        }
+        return (check < otherCheck) ? NSOrderedAscending : NSOrderedDescending;
+    }
+
+    if (length == otherLength)
+        return NSOrderedSame;
+
+    return (length < otherLength) ? NSOrderedAscending : NSOrderedDescending;
+}
+
+// Two-Way (Crochemore and Perrin) reads the text and pattern through a view, so the same code
+// searches backwards by reading both reversed and case insensitively by reading them uppercase.
+typedef struct {
+    const unichar *characters;
+    NSUInteger length;
+    BOOL reversed;
+    BOOL caseInsensitive;
+} NSStringSearchView;
+
+static inline unichar viewCharacter(const NSStringSearchView *view, NSUInteger index) {
+    unichar result = view->reversed ? view->characters[view->length - 1 - index] : view->characters[index];
+
+    return view->caseInsensitive ? NSUnicodeUppercaseCharacter(result) : result;
+}
+
+// start of the maximal suffix of the pattern, for the character order or its reverse
+static NSInteger maximalSuffix(const NSStringSearchView *pattern, BOOL reverseOrder, NSInteger *periodp) {
+    NSInteger length = pattern->length;
+    NSInteger suffix = -1, j = 0, k = 1, period = 1;
+
+    while (j + k < length) {
+        unichar check = viewCharacter(pattern, j + k);
+        unichar other = viewCharacter(pattern, suffix + k);
+
+        if (reverseOrder ? (check > other) : (check < other)) {
+            j += k;
+            k = 1;
+            period = j - suffix;
+        } else if (check == other) {
+            if (k != period)
+                k++;
+            else {
+                j += period;
+                k = 1;
+            }
+        } else {
+            suffix = j;
+            j = suffix + 1;
+            k = period = 1;
+        }
+    }
+
+    *periodp = period;
+    return suffix;
+}
+
+static NSUInteger twoWaySearch(const NSStringSearchView *text, const NSStringSearchView *pattern) {
+    NSInteger length = text->length, patternLength = pattern->length;
+    NSInteger period, otherPeriod, critical, otherCritical, i, j, memory;
+
+    critical = maximalSuffix(pattern, NO, &period);
+    otherCritical = maximalSuffix(pattern, YES, &otherPeriod);
+    if (otherCritical > critical) {
+        critical = otherCritical;
+        period = otherPeriod;
+    }
+
+    for (i = 0; i <= critical; i++)
+        if (period + i >= patternLength || viewCharacter(pattern, i) != viewCharacter(pattern, period + i))
+            break;
+
+    if (i > critical) {
+        // periodic pattern, remember how much of the period already matched
+        for (j = 0, memory = -1; j <= length - patternLength;) {
+            for (i = MAX(critical, memory) + 1; i < patternLength && viewCharacter(pattern, i) == viewCharacter(text, i + j); i++)
+                ;
+            if (i < patternLength) {
+                j += i - critical;
+                memory = -1;
+                continue;
+            }
+            for (i = critical; i > memory && viewCharacter(pattern, i) == viewCharacter(text, i + j); i--)
+                ;
+            if (i <= memory)
+                return j;
+            j += period;
+            memory = patternLength - period - 1;
+        }
+    } else {
+        period = MAX(critical + 1, patternLength - critical - 1) + 1;
+        for (j = 0; j <= length - patternLength;) {
+            for (i = critical + 1; i < patternLength && viewCharacter(pattern, i) == viewCharacter(text, i + j); i++)
+                ;
+            if (i < patternLength) {
+                j += i - critical;
+                continue;
+            }
+            for (i = critical; i >= 0 && viewCharacter(pattern, i) == viewCharacter(text, i + j); i--)
+                ;
+            if (i < 0)
+                return j;
+            j += period;
+        }
+    }
+
+    return NSNotFound;
+}
+
+static NSUInteger twoWayLocation(const unichar *characters, NSUInteger length, const unichar *pattern, NSUInteger patternLength, BOOL caseInsensitive, BOOL backwards) {
+    NSStringSearchView text = { characters, length, backwards, caseInsensitive };
+    NSStringSearchView view = { pattern, patternLength, backwards, caseInsensitive };
+    NSUInteger result = twoWaySearch(&text, &view);
+
+    if (backwards && result != NSNotFound)
+        result = length - result - patternLength;
+
+    return result;
+}
+
+#if defined(__SSE2__)
+// The lanes where a match could start. A case insensitive search can't tell what a character
+// outside ASCII folds to without the table, those lanes are always checked.
+static inline int candidateMask(const unichar *text, NSUInteger patternLength, __m128i first, __m128i firstOther, __m128i final, BOOL caseInsensitive) {
+    __m128i block = _mm_loadu_si128((const __m128i *)text);
+
+    if (caseInsensitive) {
+        __m128i match = _mm_or_si128(_mm_cmpeq_epi16(block, first), _mm_cmpeq_epi16(block, firstOther));
+        __m128i high = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128());
+
+        return _mm_movemask_epi8(_mm_or_si128(match, _mm_xor_si128(high, _mm_set1_epi16(-1))));
+    } else {
+        __m128i end = _mm_loadu_si128((const __m128i *)(text + patternLength - 1));
+
+        return _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(block, first), _mm_cmpeq_epi16(end, final)));
+    }
+}
+
+// Each position whose first and last characters match costs a compare, when those add up to
+// more than a few characters per position the rest of the text is searched with Two-Way.
+static NSUInteger filterSearch(const unichar *text, NSUInteger length, const unichar *pattern, NSUInteger patternLength, BOOL caseInsensitive, BOOL backwards) {
+    NSUInteger starts = length - patternLength + 1, i, work = 0, matched;
+    unichar firstCharacter = pattern[0], firstOther = pattern[0];
+    __m128i first, other, final;
+
+    if (caseInsensitive) {
+        firstCharacter = firstOther = NSUnicodeUppercaseCharacter(firstCharacter);
+        if (firstCharacter >= 'A' && firstCharacter <= 'Z')
+            firstOther = firstCharacter + ('a' - 'A');
+    }
+    first = _mm_set1_epi16(firstCharacter);
+    other = _mm_set1_epi16(firstOther);
+    final = _mm_set1_epi16(pattern[patternLength - 1]);
+
+    if (!backwards) {
+        for (i = 0; i + 8 <= starts; i += 8) {
+            int mask = candidateMask(text + i, patternLength, first, other, final, caseInsensitive);
+
+            for (; mask != 0; mask &= mask - 1, mask &= mask - 1) {
+                NSUInteger check = i + __builtin_ctz(mask) / 2;
+
+                if ((matched = NSUnicodeMismatch(text + check, pattern, patternLength, caseInsensitive)) == patternLength)
+                    return check;
+                work += matched + 1;
+            }
+            if (work > NSStringSearchFilterBudget + i * 4) {
+                NSUInteger result = twoWayLocation(text + i + 8, length - i - 8, pattern, patternLength, caseInsensitive, NO);
+
+                return (result == NSNotFound) ? NSNotFound : result + i + 8;
+            }
+        }
+        for (; i < starts; i++)
+            if (NSUnicodeMismatch(text + i, pattern, patternLength, caseInsensitive) == patternLength)
+                return i;
+    } else {
+        for (i = starts; i >= 8; i -= 8) {
+            int mask = candidateMask(text + i - 8, patternLength, first, other, final, caseInsensitive);
+
+            for (; mask != 0; mask &= ~(3 << ((31 - __builtin_clz(mask)) & ~1))) {
+                NSUInteger check = i - 8 + (31 - __builtin_clz(mask)) / 2;
+
+                if ((matched = NSUnicodeMismatch(text + check, pattern, patternLength, caseInsensitive)) == patternLength)
+                    return check;
+                work += matched + 1;
+            }
+            if (work > NSStringSearchFilterBudget + (starts - i) * 4)
+                return twoWayLocation(text, i - 8 + patternLength - 1, pattern, patternLength, caseInsensitive, YES);
+        }
+        while (i > 0) {
+            i--;
+            if (NSUnicodeMismatch(text + i, pattern, patternLength, caseInsensitive) == patternLength)
+                return i;
+        }
+    }
+
+    return NSNotFound;
+}
+#endif
+
+NSRange NSUnicodeRangeOfCharacters(const unichar *characters, NSUInteger length, const unichar *pattern, NSUInteger patternLength, NSStringCompareOptions options) {
+    BOOL caseInsensitive = (options & NSCaseInsensitiveSearch) ? YES : NO;
+    BOOL backwards = (options & NSBackwardsSearch) ? YES : NO;
+    NSUInteger location;
+
+    if (patternLength == 0 || patternLength > length)
+        return NSMakeRange(NSNotFound, 0);
+
+    if (options & NSAnchoredSearch) {
+        location = backwards ? length - patternLength : 0;
+        if (NSUnicodeMismatch(characters + location, pattern, patternLength, caseInsensitive) != patternLength)
+            return NSMakeRange(NSNotFound, 0);
+        return NSMakeRange(location, patternLength);
+    }
+
+#if defined(__SSE2__)
+    location = filterSearch(characters, length, pattern, patternLength, caseInsensitive, backwards);
+#else
+    location = twoWayLocation(characters, length, pattern, patternLength, caseInsensitive, backwards);
+#endif
+
+    if (location == NSNotFound)
+        return NSMakeRange(NSNotFound, 0);
+
+    return NSMakeRange(location, patternLength);
+}
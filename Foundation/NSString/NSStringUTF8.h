@@ -7,6 +7,93 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #import <Foundation/NSString.h>
+#include <stdint.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Runs of 8 bit characters are checked, widened and narrowed 16 characters at a time with SSE2
+// and a word at a time otherwise.
+
+// The number of leading bytes below 0x80
+static inline NSUInteger NSBytesASCIIPrefixLength(const uint8_t *bytes, NSUInteger length) {
+    NSUInteger i = 0;
+
+#if defined(__SSE2__)
+    for(; i + 16 <= length; i += 16) {
+        int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(bytes + i)));
+
+        if(mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    for(; i + sizeof(uintptr_t) <= length; i += sizeof(uintptr_t)) {
+        uintptr_t word;
+
+        memcpy(&word, bytes + i, sizeof(word));
+        if(word & (UINTPTR_MAX / 0xFF * 0x80))
+            break;
+    }
+    for(; i < length; i++)
+        if(bytes[i] & 0x80)
+            break;
+
+    return i;
+}
+
+// The number of leading characters below 0x80 when limit is 0x80, or below 0x100 when it is 0x100
+static inline NSUInteger NSUnicodePrefixLengthBelow(const unichar *characters, NSUInteger length, unichar limit) {
+    NSUInteger i = 0;
+
+#if defined(__SSE2__)
+    __m128i high = _mm_set1_epi16((short)(unichar)~(limit - 1));
+
+    for(; i + 8 <= length; i += 8) {
+        __m128i units = _mm_loadu_si128((const __m128i *)(characters + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, high), _mm_setzero_si128()));
+
+        if(mask != 0xFFFF)
+            return i + __builtin_ctz(~mask) / 2;
+    }
+#endif
+    for(; i < length; i++)
+        if(characters[i] >= limit)
+            break;
+
+    return i;
+}
+
+static inline void NSWidenBytesToUnicode(const uint8_t *bytes, NSUInteger length, unichar *characters) {
+    NSUInteger i = 0;
+
+#if defined(__SSE2__)
+    for(; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(bytes + i));
+
+        _mm_storeu_si128((__m128i *)(characters + i), _mm_unpacklo_epi8(chunk, _mm_setzero_si128()));
+        _mm_storeu_si128((__m128i *)(characters + i + 8), _mm_unpackhi_epi8(chunk, _mm_setzero_si128()));
+    }
+#endif
+    for(; i < length; i++)
+        characters[i] = bytes[i];
+}
+
+// The characters must all be below 0x100
+static inline void NSNarrowUnicodeToBytes(const unichar *characters, NSUInteger length, uint8_t *bytes) {
+    NSUInteger i = 0;
+
+#if defined(__SSE2__)
+    for(; i + 16 <= length; i += 16) {
+        __m128i low = _mm_loadu_si128((const __m128i *)(characters + i));
+        __m128i high = _mm_loadu_si128((const __m128i *)(characters + i + 8));
+
+        _mm_storeu_si128((__m128i *)(bytes + i), _mm_packus_epi16(low, high));
+    }
+#endif
+    for(; i < length; i++)
+        bytes[i] = (uint8_t)characters[i];
+}
 
 NSUInteger NSConvertUTF16toUTF8(const unichar *utf16, NSUInteger utf16Length, uint8_t *utf8);
 
@@ -20,3 +107,4 @@ char *NSUnicodeToUTF8(const unichar *characters, NSUInteger length,
 NSUInteger NSConvertUTF8toUTF16(const unsigned char *utf8, NSUInteger utf8Length, unichar *utf16);
 
 BOOL NSUTF8IsASCII(const char *utf8, NSUInteger length);
+BOOL NSUnicodeIsISOLatin1(const unichar *characters, NSUInteger length);
@@ -9,54 +9,90 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSStringSymbol.h>
 #import <Foundation/NSRaise.h>
 
+// Both directions copy ASCII runs in bulk and transcode the rest one scalar at a time.
+// Malformed UTF-8 decodes to U+FFFD for each maximal invalid subsequence and unpaired
+// surrogates encode as U+FFFD, so lengths are always consistent between the two directions.
+
+#define NSUTF8ReplacementCharacter 0xFFFD
+
+// Returns the number of UTF-8 bytes, writes them if utf8 is not NULL
+static NSUInteger encodeUTF16toUTF8(const unichar *utf16,NSUInteger utf16Length,uint8_t *utf8){
+   NSUInteger i=0,utf8Length=0;
+
+   while(i<utf16Length){
+    NSUInteger ascii=NSUnicodePrefixLengthBelow(utf16+i,utf16Length-i,0x80);
+    uint32_t   code32;
+
+    if(ascii>0){
+     if(utf8!=NULL)
+      NSNarrowUnicodeToBytes(utf16+i,ascii,utf8+utf8Length);
+     i+=ascii;
+     utf8Length+=ascii;
+     if(i==utf16Length)
+      break;
+    }
+
+    code32=utf16[i++];
+    if(code32>=0xD800 && code32<0xE000){
+     if(code32<0xDC00 && i<utf16Length && utf16[i]>=0xDC00 && utf16[i]<0xE000)
+      code32=0x10000+((code32-0xD800)<<10)+(utf16[i++]-0xDC00);
+     else
+      code32=NSUTF8ReplacementCharacter;
+    }
+
+    if(code32<0x800){
+     if(utf8!=NULL){
+      utf8[utf8Length]=0xC0|(code32>>6);
+      utf8[utf8Length+1]=0x80|(code32&0x3F);
+     }
+     utf8Length+=2;
+    }
+    else if(code32<0x10000){
+     if(utf8!=NULL){
+      utf8[utf8Length]=0xE0|(code32>>12);
+      utf8[utf8Length+1]=0x80|((code32>>6)&0x3F);
+      utf8[utf8Length+2]=0x80|(code32&0x3F);
+     }
+     utf8Length+=3;
+    }
+    else {
+     if(utf8!=NULL){
+      utf8[utf8Length]=0xF0|(code32>>18);
+      utf8[utf8Length+1]=0x80|((code32>>12)&0x3F);
+      utf8[utf8Length+2]=0x80|((code32>>6)&0x3F);
+      utf8[utf8Length+3]=0x80|(code32&0x3F);
+     }
+     utf8Length+=4;
+    }
+   }
+
+   return utf8Length;
+}
+
 NSUInteger _NSGetUTF8CStringWithMaxLength(const unichar *characters,NSUInteger length,NSUInteger *location,char *cString,NSUInteger maxLength, BOOL zeroTerminate){
-    NSUInteger utf8Length=0;
-    NSUInteger i;
-    
-    for(i=0;i<length;i++){
-        uint32_t      code32=characters[i];
-        uint8_t       tmp[4];
-        int           tmpLength=0;
-        
-        if(code32<0x80)
-            tmp[tmpLength++]=code32;
-        else if(code32<0x800){
-            tmp[tmpLength++]=0x80|(code32&0x3F);
-            tmp[tmpLength++]=0xC0|(code32>>6);
-        }
-        else if(code32<0x10000) {
-            tmp[tmpLength++]=0x80|(code32&0x3F);
-            tmp[tmpLength++]=0x80|((code32>>6) & 0x3F);
-            tmp[tmpLength++]=0xE0|((code32>>12) & 0x0F);
-        }
-        else {
-            tmp[tmpLength++]=0x80|(code32&0x3F);
-            tmp[tmpLength++]=0x80|((code32>>6) & 0x3F);
-            tmp[tmpLength++]=0x80|((code32>>12) & 0x3F);
-            tmp[tmpLength++]=0xF0|((code32>>18) & 0x07);
-        }
-        
-        if(cString==NULL)
-            utf8Length+=tmpLength;
-        else{
-            if (tmpLength + utf8Length <= maxLength){
-                while(--tmpLength>=0)   {
-                    cString[utf8Length++]=tmp[tmpLength];
-                }
-            }
-            else {
-                cString[0]='\0';
-                //buffer too small
-                return NSNotFound;
-            }
+    NSUInteger utf8Length;
+
+    // a UTF-16 code unit never takes more than 3 bytes, skip counting when that fits
+    if(cString==NULL || maxLength<length*3+(zeroTerminate?1:0)){
+        utf8Length=encodeUTF16toUTF8(characters,length,NULL);
+
+        if(cString!=NULL && utf8Length>maxLength){
+            //buffer too small
+            cString[0]='\0';
+            return NSNotFound;
         }
     }
-    
+
     if (location != NULL) {
-        *location=i;
+        *location=length;
     }
-    
-    if (zeroTerminate && cString) {
+
+    if(cString==NULL)
+        return utf8Length;
+
+    utf8Length=encodeUTF16toUTF8(characters,length,(uint8_t *)cString);
+
+    if (zeroTerminate) {
         //check if zero termination has space
         if (maxLength <= utf8Length) {
             cString[0]='\0';
@@ -70,41 +106,7 @@ NSUInteger _NSGetUTF8CStringWithMaxLength(const unichar *characters,NSUInteger l
 }
 
 NSUInteger NSConvertUTF16toUTF8(const unichar *utf16,NSUInteger utf16Length,uint8_t *utf8){
-   NSUInteger utf8Length=0;
-   NSUInteger i;
-   
-   for(i=0;i<utf16Length;i++){
-    uint32_t      code32=utf16[i];
-    uint8_t       tmp[4];
-	int           tmpLength=0;
-	
-	if(code32<0x80)
-	 tmp[tmpLength++]=code32;
-	else if(code32<0x800){
-	 tmp[tmpLength++]=0x80|(code32&0x3F);
-	 tmp[tmpLength++]=0xC0|(code32>>6);
-	}
-	else if(code32<0x10000) {
-	 tmp[tmpLength++]=0x80|(code32&0x3F);
-	 tmp[tmpLength++]=0x80|((code32>>6) & 0x3F);
-	 tmp[tmpLength++]=0xE0|((code32>>12) & 0x0F);
-	}
-	else {
-	 tmp[tmpLength++]=0x80|(code32&0x3F);
-	 tmp[tmpLength++]=0x80|((code32>>6) & 0x3F);
-	 tmp[tmpLength++]=0x80|((code32>>12) & 0x3F);
-	 tmp[tmpLength++]=0xF0|((code32>>18) & 0x07);
-	}
-	
-	if(utf8==NULL)
-	 utf8Length+=tmpLength;
-	else{
-	 while(--tmpLength>=0)	 
-	  utf8[utf8Length++]=tmp[tmpLength];
-	}
-   }
-   
-   return utf8Length;
+   return encodeUTF16toUTF8(utf16,utf16Length,utf8);
 }
 
 NSUInteger NSGetUTF8CStringWithMaxLength(const unichar *characters,NSUInteger length,NSUInteger *location,char *cString,NSUInteger maxLength){    
@@ -113,87 +115,113 @@ NSUInteger NSGetUTF8CStringWithMaxLength(const unichar *characters,NSUInteger le
 
 char    *NSUnicodeToUTF8(const unichar *characters,NSUInteger length,
   BOOL lossy,NSUInteger *resultLength,NSZone *zone,BOOL zeroTerminate){
-  NSUInteger  utf8Length=_NSGetUTF8CStringWithMaxLength(characters,length,NULL, NULL, UINT_MAX, NO);
-    NSUInteger maxLength = utf8Length+(zeroTerminate?1:0);
-  char     *utf8=NSZoneMalloc(NULL,maxLength*sizeof(unsigned char));
-
-  *resultLength=_NSGetUTF8CStringWithMaxLength(characters,length,NULL, utf8, maxLength, zeroTerminate);
-  if(zeroTerminate){
-   (*resultLength)++;
-  }
-  
+  NSUInteger utf8Length=encodeUTF16toUTF8(characters,length,NULL);
+  char      *utf8=NSZoneMalloc(NULL,(utf8Length+(zeroTerminate?1:0))*sizeof(unsigned char));
+
+  encodeUTF16toUTF8(characters,length,(uint8_t *)utf8);
+  if(zeroTerminate)
+   utf8[utf8Length++]='\0';
+  *resultLength=utf8Length;
+
   return utf8;
 }
 
+// Returns the length of the valid sequence starting at utf8[0], or of its longest valid
+// prefix if it is malformed in which case *code32 is the replacement character.
+static inline NSUInteger decodeUTF8Sequence(const uint8_t *utf8,NSUInteger utf8Length,uint32_t *code32){
+   uint8_t    lead=utf8[0],low=0x80,high=0xBF;
+   NSUInteger need,i;
+   uint32_t   result;
+
+   if(lead>=0xC2 && lead<=0xDF){
+    need=1;
+    result=lead&0x1F;
+   }
+   else if(lead>=0xE0 && lead<=0xEF){
+    need=2;
+    result=lead&0x0F;
+    if(lead==0xE0)
+     low=0xA0; // overlong
+    else if(lead==0xED)
+     high=0x9F; // surrogates
+   }
+   else if(lead>=0xF0 && lead<=0xF4){
+    need=3;
+    result=lead&0x07;
+    if(lead==0xF0)
+     low=0x90; // overlong
+    else if(lead==0xF4)
+     high=0x8F; // above 0x10FFFF
+   }
+   else {
+    *code32=NSUTF8ReplacementCharacter;
+    return 1;
+   }
+
+   for(i=1;i<=need;i++){
+    if(i>=utf8Length || utf8[i]<low || utf8[i]>high){
+     *code32=NSUTF8ReplacementCharacter;
+     return i;
+    }
+    result=(result<<6)|(utf8[i]&0x3F);
+    low=0x80;
+    high=0xBF;
+   }
+
+   *code32=result;
+   return need+1;
+}
 
 NSUInteger NSConvertUTF8toUTF16(const unsigned char *utf8,NSUInteger utf8Length,unichar *utf16){
-   NSUInteger i,utf16Length=0;
-   uint32_t code32=0;
-   enum {
-    stateThreeLeft,
-	stateTwoLeft,
-	stateOneLeft,
-    stateFirstByte,
-   } state=stateFirstByte;
-   
-   for(i=0;i<utf8Length;i++){
-    unsigned char code8=utf8[i];
-	
-	switch(state){
-
-	 case stateThreeLeft:
-	 case stateTwoLeft:
-	 case stateOneLeft:
-	  code32<<=6;
-	  code32|=code8&0x7F;
-	  state++;
-	  break;
-	
-	 case stateFirstByte:
-	  if(code8<0x80)
-	   code32=code8;
-      else if((code8&0xF0)==0xF0){
-	   code32=code8&0x0F;
-	   state=stateThreeLeft;
-	  }
-	  else if((code8&0xE0)==0xE0){
-	   code32=code8&0x1F;
-	   state=stateTwoLeft;
-	  }
-	  else if((code8&0xC0)==0xC0){
-	   code32=code8&0x3F;
-	   state=stateOneLeft;
-	  }
+   NSUInteger i=0,utf16Length=0;
+
+   while(i<utf8Length){
+    NSUInteger ascii=NSBytesASCIIPrefixLength(utf8+i,utf8Length-i);
+    uint32_t   code32;
+
+    if(ascii>0){
+     if(utf16!=NULL)
+      NSWidenBytesToUnicode(utf8+i,ascii,utf16+utf16Length);
+     i+=ascii;
+     utf16Length+=ascii;
+     if(i==utf8Length)
       break;
-	  	  
-	}
-	if(state==stateFirstByte){
-	 if(utf16!=NULL)
-	  utf16[utf16Length]=code32;
-	 utf16Length++;
-	}
+    }
+
+    i+=decodeUTF8Sequence(utf8+i,utf8Length-i,&code32);
+    if(code32<0x10000){
+     if(utf16!=NULL)
+      utf16[utf16Length]=code32;
+     utf16Length++;
+    }
+    else {
+     if(utf16!=NULL){
+      utf16[utf16Length]=0xD800+((code32-0x10000)>>10);
+      utf16[utf16Length+1]=0xDC00+((code32-0x10000)&0x3FF);
+     }
+     utf16Length+=2;
+    }
    }
    
    return utf16Length;
 }
 
+// UTF-8 never needs more UTF-16 code units than bytes, decode once and give back the excess
 unichar *NSUTF8ToUnicode(const char *utf8,NSUInteger length,
   NSUInteger *resultLength,NSZone *zone) {
-   NSUInteger utf16Length=NSConvertUTF8toUTF16((unsigned char *)utf8,length,NULL);
-   unichar *utf16=NSZoneMalloc(NULL,utf16Length*sizeof(unichar));
+   unichar *utf16=NSZoneMalloc(NULL,length*sizeof(unichar));
 
    *resultLength=NSConvertUTF8toUTF16((unsigned char *)utf8,length,utf16);
+   if(*resultLength<length/2)
+    utf16=NSZoneRealloc(NULL,utf16,(*resultLength)*sizeof(unichar));
 
    return utf16;
 }
 
 BOOL NSUTF8IsASCII(const char *utf8,NSUInteger length) {
-  int i;
-
-  for(i=0;i<length;i++)
-   if(utf8[i]&0x80)
-    return NO;
-
-  return YES;
+   return (NSBytesASCIIPrefixLength((const uint8_t *)utf8,length)==length)?YES:NO;
 }
 
+BOOL NSUnicodeIsISOLatin1(const unichar *characters,NSUInteger length) {
+   return (NSUnicodePrefixLengthBelow(characters,length,0x100)==length)?YES:NO;
+}
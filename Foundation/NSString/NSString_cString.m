@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSString_isoLatin1.h>
 #import <Foundation/NSString_isoLatin2.h>
 #import <Foundation/NSStringUTF8.h>
+#import <Foundation/NSString_tagged.h>
 #import <Foundation/NSAutoreleasePool-private.h>
 #import <Foundation/NSRaise.h>
 #import <Foundation/NSRaiseException.h>
@@ -150,6 +151,12 @@ char *NSString_unicodeToAnyCString(NSStringEncoding encoding, const unichar *cha
 
 NSString *NSString_anyCStringNewWithBytes(NSStringEncoding encoding, NSZone *zone, const char *bytes,NSUInteger length)
 {
+    NSString *tagged = NSString_taggedNewWithBytes(encoding, bytes, length);
+
+    if (tagged != nil) {
+        return tagged;
+    }
+
     switch(encoding) {
         case NSNEXTSTEPStringEncoding:
             return NSNEXTSTEPCStringNewWithBytes(zone,bytes,length);
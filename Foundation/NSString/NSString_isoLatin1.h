@@ -8,8 +8,13 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #import <Foundation/NSString.h>
 
+// Also the compact form of any string whose characters are all below 0x100. The bytes are
+// zero terminated, and when they are all ASCII they are returned as is for UTF-8 and the
+// other ASCII compatible encodings.
 @interface NSString_isoLatin1 : NSString {
     NSUInteger _length;
+    NSUInteger _hash; // 0 until computed
+    BOOL _isASCII;
     unsigned char _bytes[1];
 }
 
@@ -24,6 +29,8 @@ char *NSUnicodeToISOLatin1(const unichar *characters, NSUInteger length,
 void NSString_isoLatin1Initialize(void);
 NSString *NSString_isoLatin1NewWithBytes(NSZone *zone,
     const char *bytes, NSUInteger length);
+NSString *NSString_isoLatin1NewWithCharacters(NSZone *zone,
+    const unichar *characters, NSUInteger length);
 
 NSUInteger NSGetISOLatin1CStringWithMaxLength(const unichar *characters, NSUInteger length,
     NSUInteger *location, char *cString, NSUInteger maxLength, BOOL lossy);
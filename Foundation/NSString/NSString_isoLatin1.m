@@ -8,16 +8,18 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSString_isoLatin1.h>
 #import <Foundation/NSRaise.h>
 #import <Foundation/NSRaiseException.h>
+#import <Foundation/NSStringHashing.h>
+#import <Foundation/NSStringUTF8.h>
+#import <Foundation/NSData.h>
+#include <string.h>
 
 unichar *NSISOLatin1ToUnicode(const char *cString,NSUInteger length,
   NSUInteger *resultLength,NSZone *zone) {
    unichar *characters=NSZoneMalloc(zone,sizeof(unichar)*length);
-   int      i;
 
-   for(i=0;i<length;i++)
-    characters[i]=((uint8_t *)cString)[i];
+   NSWidenBytesToUnicode((const uint8_t *)cString,length,characters);
 
-   *resultLength=i;
+   *resultLength=length;
    return characters;
 }
 
@@ -104,14 +106,50 @@ NSString *NSString_isoLatin1NewWithBytes(NSZone *zone,
    NSString_isoLatin1 *self=NSAllocateObject([NSString_isoLatin1 class],length*sizeof(char),zone);
     if (self) {
        self->_length=length;
-        int i;
-       for(i=0;i<length;i++)
-        self->_bytes[i]=((uint8_t *)bytes)[i];
-       self->_bytes[i]='\0';
+       self->_isASCII=NSUTF8IsASCII(bytes,length);
+       memcpy(self->_bytes,bytes,length);
+       self->_bytes[length]='\0';
     }
    return self;
 }
 
+NSString *NSString_isoLatin1NewWithCharacters(NSZone *zone,
+ const unichar *characters,NSUInteger length) {
+   NSString_isoLatin1 *self=NSAllocateObject([NSString_isoLatin1 class],length*sizeof(char),zone);
+
+   if(self){
+    self->_length=length;
+    self->_isASCII=(NSUnicodePrefixLengthBelow(characters,length,0x80)==length)?YES:NO;
+    NSNarrowUnicodeToBytes(characters,length,self->_bytes);
+    self->_bytes[length]='\0';
+   }
+   return self;
+}
+
+static inline BOOL encodingIsASCIICompatible(NSStringEncoding encoding){
+   switch(encoding){
+    case NSASCIIStringEncoding:
+    case NSNEXTSTEPStringEncoding:
+    case NSUTF8StringEncoding:
+    case NSISOLatin1StringEncoding:
+    case NSISOLatin2StringEncoding:
+    case NSWindowsCP1252StringEncoding:
+    case NSMacOSRomanStringEncoding:
+     return YES;
+
+    default:
+     return NO;
+   }
+}
+
+// the bytes as they are in the encoding, NULL if they have to be converted
+static inline const char *bytesInEncoding(NSString_isoLatin1 *self,NSStringEncoding encoding){
+   if(encoding==NSISOLatin1StringEncoding || (self->_isASCII && encodingIsASCIICompatible(encoding)))
+    return (const char *)self->_bytes;
+
+   return NULL;
+}
+
 -(NSUInteger)length {
    return _length;
 }
@@ -126,10 +164,7 @@ NSString *NSString_isoLatin1NewWithBytes(NSZone *zone,
 }
 
 -(void)getCharacters:(unichar *)buffer {
-   int i;
-
-   for(i=0;i<_length;i++)
-    buffer[i]=_bytes[i];
+   NSWidenBytesToUnicode(_bytes,_length,buffer);
 }
 
 -(void)getCharacters:(unichar *)buffer range:(NSRange)range {
@@ -140,8 +175,80 @@ NSString *NSString_isoLatin1NewWithBytes(NSZone *zone,
      NSStringFromRange(range),[self length]);
    }
 
-   for(i=0;i<len;i++)
-    buffer[i]=_bytes[loc+i];
+   NSWidenBytesToUnicode(_bytes+loc,len,buffer);
+}
+
+// the bytes are the characters
+-(NSUInteger)hash {
+   if(_hash==0)
+    _hash=NSStringHashASCII((const char *)_bytes,_length);
+
+   return _hash;
+}
+
+static inline BOOL isEqualToLatin1(NSString_isoLatin1 *self,NSString_isoLatin1 *other){
+   if(self->_length!=other->_length)
+    return NO;
+   if(self->_hash!=0 && other->_hash!=0 && self->_hash!=other->_hash)
+    return NO;
+
+   return (memcmp(self->_bytes,other->_bytes,self->_length)==0)?YES:NO;
+}
+
+-(BOOL)isEqual:other {
+   if(self==other)
+    return YES;
+   if(object_getClass(other)==object_getClass(self))
+    return isEqualToLatin1(self,other);
+
+   return [super isEqual:other];
+}
+
+-(BOOL)isEqualToString:(NSString *)other {
+   if(self==other)
+    return YES;
+   if(object_getClass(other)==object_getClass(self))
+    return isEqualToLatin1(self,(NSString_isoLatin1 *)other);
+
+   return [super isEqualToString:other];
+}
+
+-(NSUInteger)lengthOfBytesUsingEncoding:(NSStringEncoding)encoding {
+   if(bytesInEncoding(self,encoding)!=NULL)
+    return _length;
+   if(encoding==NSUTF8StringEncoding){
+    NSUInteger i,result=_length;
+
+    // characters from 0x80 take two bytes
+    for(i=0;i<_length;i++)
+     result+=_bytes[i]>>7;
+
+    return result;
+   }
+
+   return [super lengthOfBytesUsingEncoding:encoding];
+}
+
+-(const char *)UTF8String {
+   if(_isASCII)
+    return (const char *)_bytes;
+
+   return [super UTF8String];
+}
+
+-(const char *)cStringUsingEncoding:(NSStringEncoding)encoding {
+   const char *result=bytesInEncoding(self,encoding);
+
+   return (result!=NULL)?result:[super cStringUsingEncoding:encoding];
+}
+
+-(NSData *)dataUsingEncoding:(NSStringEncoding)encoding allowLossyConversion:(BOOL)lossy {
+   const char *bytes=bytesInEncoding(self,encoding);
+
+   if(bytes!=NULL)
+    return [NSData dataWithBytes:bytes length:_length];
+
+   return [super dataUsingEncoding:encoding allowLossyConversion:lossy];
 }
 
 @end
@@ -10,6 +10,7 @@
 
 @interface NSString_isoLatin2 : NSString {
     NSUInteger _length;
+    NSUInteger _hash; // 0 until computed
     unsigned char _bytes[1];
 }
 
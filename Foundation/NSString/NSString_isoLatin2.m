@@ -292,4 +292,11 @@ NSString *NSString_isoLatin2NewWithBytes(NSZone *zone,
 		buffer[i]=_mapISOLatin2ToUnichar(_bytes[loc+i]);
 }
 
+-(NSUInteger)hash {
+   if(_hash==0)
+    _hash=[super hash];
+
+   return _hash;
+}
+
 @end
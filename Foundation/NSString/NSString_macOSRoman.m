@@ -321,4 +321,11 @@ NSString *NSString_macOSRomanNewWithBytes(NSZone *zone,
 		buffer[i]=_mapMacOSRomanToUnichar(_bytes[loc+i]);
 }
 
+-(NSUInteger)hash {
+   if(_hash==0)
+    _hash=[super hash];
+
+   return _hash;
+}
+
 @end
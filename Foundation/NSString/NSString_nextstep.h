@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 @interface NSString_nextstep : NSString {
     NSUInteger _length;
+    NSUInteger _hash; // 0 until computed
     char _bytes[1];
 }
 @end
@@ -178,4 +178,11 @@ NSString *NSNEXTSTEPStringNewWithBytes(NSZone *zone,
     buffer[i]=NEXTSTEPToUnicode[((unsigned char *)_bytes)[loc+i]];
 }
 
+-(NSUInteger)hash {
+   if(_hash==0)
+    _hash=[super hash];
+
+   return _hash;
+}
+
 @end
@@ -11,6 +11,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSString_cString.h>
 #import <Foundation/NSString_unicode.h>
 #import <Foundation/NSString_unicodePtr.h>
+#import <Foundation/NSString_tagged.h>
 #import <Foundation/NSString_defaultEncoding.h>
 #import <Foundation/NSUnicodeCaseMapping.h>
 #import <Foundation/NSString_nextstep.h>
@@ -42,7 +43,17 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 - initWithCharactersNoCopy:(unichar *)characters length:(NSUInteger)length freeWhenDone:(BOOL)freeWhenDone
 {
+    NSString *tagged = NSString_taggedNewWithCharacters(characters, length);
+
     NSDeallocateObject(self);
+
+    if (tagged != nil) {
+        if (freeWhenDone) {
+            NSZoneFree(NSZoneFromPointer(characters), characters);
+        }
+        return (NSString_placeholder *)tagged;
+    }
+
     return (NSString_placeholder *)NSString_unicodePtrNewNoCopy(NULL, characters, length, freeWhenDone);
 }
 
@@ -50,8 +61,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 // Copied from former -initWithData:(NSData *)data encoding:(NSStringEncoding)encoding;
 - initWithBytes:(const void *)bytes length:(NSUInteger)length encoding:(NSStringEncoding)encoding
 {
+    NSString *tagged = NSString_taggedNewWithBytes(encoding, bytes, length);
+
     NSDeallocateObject(self);
 
+    if (tagged != nil) {
+        return (NSString_placeholder *)tagged;
+    }
+
     if (encoding == defaultEncoding()) {
         return (NSString_placeholder *)NSString_cStringNewWithBytes(NULL, bytes, length);
     }
@@ -67,8 +84,10 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
         case NSNEXTSTEPStringEncoding:
             return (NSString_placeholder *)NSNEXTSTEPStringNewWithBytes(NULL, bytes, length);
 
-// FIX, not nextstep
         case NSASCIIStringEncoding:
+            return (NSString_placeholder *)NSString_isoLatin1NewWithBytes(NULL, bytes, length);
+
+// FIX, not nextstep
         case NSNonLossyASCIIStringEncoding:
             return (NSString_placeholder *)NSNEXTSTEPStringNewWithBytes(NULL, bytes, length);
 
@@ -80,6 +99,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
             return (NSString_placeholder *)NSString_unicodePtrNewNoCopy(NULL, characters, resultLength, YES);
 
         case NSUTF8StringEncoding:
+            if (NSUTF8IsASCII(bytes, length)) {
+                return (NSString_placeholder *)NSString_isoLatin1NewWithBytes(NULL, bytes, length);
+            }
             characters = NSUTF8ToUnicode(bytes, length, &resultLength, NULL);
             return (NSString_placeholder *)NSString_unicodePtrNewNoCopy(NULL, characters, resultLength, YES);
 
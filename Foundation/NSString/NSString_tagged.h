@@ -0,0 +1,21 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import <Foundation/NSString.h>
+
+// Immutable ASCII strings of up to 8 characters stored in the object pointer itself on 64
+// bit, see objc_makeTaggedPointer. The low 4 bits of the payload are the length, followed
+// by the characters at 7 bits each.
+@interface NSString_tagged : NSString
+@end
+
+#define NSStringTaggedMaximumLength 8
+
+// These return nil if the characters don't fit in a tagged pointer or there are none on this platform
+NSString *NSString_taggedNewWithBytes(NSStringEncoding encoding, const char *bytes, NSUInteger length);
+NSString *NSString_taggedNewWithCharacters(const unichar *characters, NSUInteger length);
@@ -0,0 +1,177 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <Foundation/NSString_tagged.h>
+#import <Foundation/NSStringHashing.h>
+#import <Foundation/NSException.h>
+#import <Foundation/NSRaiseException.h>
+#include <limits.h>
+
+static inline NSUInteger NSStringTaggedLength(NSString *self) {
+   return objc_getTaggedPointerValue(self)&0xF;
+}
+
+static inline unichar NSStringTaggedCharacter(NSString *self,NSUInteger index) {
+   return (objc_getTaggedPointerValue(self)>>(4+index*7))&0x7F;
+}
+
+static NSString *NSStringTaggedMake(uintptr_t payload) {
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   if(objc_taggedPointerClasses[OBJC_TAG_NSString]==Nil)
+    objc_registerTaggedPointerClass(OBJC_TAG_NSString,[NSString_tagged class]);
+
+   return objc_makeTaggedPointer(OBJC_TAG_NSString,payload);
+#else
+   return nil;
+#endif
+}
+
+// Only encodings which agree with ASCII for every byte below 0x80
+static BOOL NSStringTaggedEncodingIsASCIICompatible(NSStringEncoding encoding) {
+   switch(encoding){
+    case NSASCIIStringEncoding:
+    case NSNEXTSTEPStringEncoding:
+    case NSUTF8StringEncoding:
+    case NSISOLatin1StringEncoding:
+    case NSISOLatin2StringEncoding:
+    case NSWindowsCP1252StringEncoding:
+    case NSMacOSRomanStringEncoding:
+     return YES;
+
+    default:
+     return NO;
+   }
+}
+
+NSString *NSString_taggedNewWithBytes(NSStringEncoding encoding,const char *bytes,NSUInteger length) {
+   uintptr_t  payload=length;
+   NSUInteger i;
+
+   if(length>NSStringTaggedMaximumLength || !NSStringTaggedEncodingIsASCIICompatible(encoding))
+    return nil;
+
+   for(i=0;i<length;i++){
+    uint8_t code=((const uint8_t *)bytes)[i];
+
+    if(code>=0x80)
+     return nil;
+    payload|=(uintptr_t)code<<(4+i*7);
+   }
+
+   return NSStringTaggedMake(payload);
+}
+
+NSString *NSString_taggedNewWithCharacters(const unichar *characters,NSUInteger length) {
+   uintptr_t  payload=length;
+   NSUInteger i;
+
+   if(length>NSStringTaggedMaximumLength)
+    return nil;
+
+   for(i=0;i<length;i++){
+    if(characters[i]>=0x80)
+     return nil;
+    payload|=(uintptr_t)characters[i]<<(4+i*7);
+   }
+
+   return NSStringTaggedMake(payload);
+}
+
+@implementation NSString_tagged
+
+// [[self class] alloc] gets a regular instance, which may well turn out tagged again
++allocWithZone:(NSZone *)zone {
+   return [NSString allocWithZone:zone];
+}
+
++(BOOL)accessInstanceVariablesDirectly {
+   return NO;
+}
+
+-(void)dealloc {
+   return;
+   [super dealloc];  // Silence compiler warning
+}
+
+-(id)retain {
+   return self;
+}
+
+-(oneway void)release {
+}
+
+-(id)autorelease {
+   return self;
+}
+
+-(NSUInteger)retainCount {
+   return UINT_MAX;
+}
+
+-copyWithZone:(NSZone *)zone {
+   return self;
+}
+
+-(NSUInteger)length {
+   return NSStringTaggedLength(self);
+}
+
+-(unichar)characterAtIndex:(NSUInteger)location {
+   if(location>=NSStringTaggedLength(self)){
+    NSRaiseException(NSRangeException,self,_cmd,@"index %d beyond length %d",
+     location,[self length]);
+   }
+
+   return NSStringTaggedCharacter(self,location);
+}
+
+-(void)getCharacters:(unichar *)buffer {
+   NSUInteger i,length=NSStringTaggedLength(self);
+
+   for(i=0;i<length;i++)
+    buffer[i]=NSStringTaggedCharacter(self,i);
+}
+
+-(void)getCharacters:(unichar *)buffer range:(NSRange)range {
+   NSUInteger i;
+
+   if(NSMaxRange(range)>NSStringTaggedLength(self)){
+    NSRaiseException(NSRangeException,self,_cmd,@"range %@ beyond length %d",
+     NSStringFromRange(range),[self length]);
+   }
+
+   for(i=0;i<range.length;i++)
+    buffer[i]=NSStringTaggedCharacter(self,range.location+i);
+}
+
+// same value as -[NSString hash], the characters are all ASCII
+-(NSUInteger)hash {
+   char       ascii[NSStringTaggedMaximumLength];
+   NSUInteger i,length=NSStringTaggedLength(self);
+
+   for(i=0;i<length;i++)
+    ascii[i]=NSStringTaggedCharacter(self,i);
+
+   return NSStringHashASCII(ascii,length);
+}
+
+// the encoding is canonical, two tagged strings are equal only if they are the same pointer
+-(BOOL)isEqualToString:(NSString *)other {
+   if(objc_isTaggedPointer(other) && object_getClass(other)==object_getClass(self))
+    return (self==other)?YES:NO;
+
+   return [super isEqualToString:other];
+}
+
+-(BOOL)isEqual:other {
+   if(objc_isTaggedPointer(other) && object_getClass(other)==object_getClass(self))
+    return (self==other)?YES:NO;
+
+   return [super isEqual:other];
+}
+
+@end
@@ -82,7 +82,10 @@ char *NSUnicodeToUnicode(const unichar *characters,NSUInteger length,NSUInteger
 }
 
 -(NSUInteger)hash {
-   return NSStringHashUnicode(_unicode,MIN(_length,NSHashStringLength));
+   if(_hash==0)
+    _hash=NSStringHashUnicode(_unicode,_length);
+
+   return _hash;
 }
 
 @end
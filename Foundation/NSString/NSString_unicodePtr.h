@@ -10,6 +10,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 @interface NSString_unicodePtr : NSString {
     NSUInteger _length;
+    NSUInteger _hash; // 0 until computed
     BOOL _freeWhenDone;
     const unichar *_unicode;
 }
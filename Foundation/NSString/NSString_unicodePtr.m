@@ -10,11 +10,23 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSStringHashing.h>
 #import <Foundation/NSRaiseException.h>
 #import <Foundation/NSStringUTF8.h>
+#import <Foundation/NSString_isoLatin1.h>
 
 @implementation NSString_unicodePtr
 
+// Characters handed over to be freed are kept a byte each when they all fit, the caller did not
+// ask for its buffer to be used as is.
 NSString *NSString_unicodePtrNewNoCopy(NSZone *zone,const unichar *unicode,NSUInteger length,BOOL freeWhenDone) {
-   NSString_unicodePtr *self=NSAllocateObject([NSString_unicodePtr class],0,zone);
+   NSString_unicodePtr *self;
+
+   if(freeWhenDone && NSUnicodeIsISOLatin1(unicode,length)){
+    NSString *result=NSString_isoLatin1NewWithCharacters(zone,unicode,length);
+
+    NSZoneFree(NSZoneFromPointer((void *)unicode),(void *)unicode);
+    return result;
+   }
+
+   self=NSAllocateObject([NSString_unicodePtr class],0,zone);
 
     if (self) {
        self->_length=length;
@@ -89,7 +101,10 @@ NSString *NSString_unicodePtrNew(NSZone *zone,const unichar *unicode,NSUInteger
 }
 
 -(NSUInteger)hash {
-   return NSStringHashUnicode(_unicode,MIN(_length,NSHashStringLength));
+   if(_hash==0)
+    _hash=NSStringHashUnicode(_unicode,_length);
+
+   return _hash;
 }
 
 @end
@@ -10,6 +10,7 @@
 
 @interface NSString_win1252 : NSString {
     NSUInteger _length;
+    NSUInteger _hash; // 0 until computed
     unsigned char _bytes[1];
 }
 
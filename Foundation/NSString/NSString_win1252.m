@@ -231,4 +231,11 @@ NSString *NSString_win1252NewWithBytes(NSZone *zone,
 		buffer[i]=_mapWin1252ToUnichar(_bytes[loc+i]);
 }
 
+-(NSUInteger)hash {
+   if(_hash==0)
+    _hash=[super hash];
+
+   return _hash;
+}
+
 @end
@@ -8,6 +8,18 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #import <Foundation/NSString.h>
 
+// Simple one to one mappings. Case insensitive comparisons compare the uppercase characters.
+FOUNDATION_EXPORT const short *const NSUnicodeUppercaseDeltas[256];
+FOUNDATION_EXPORT const short *const NSUnicodeLowercaseDeltas[256];
+
+static inline unichar NSUnicodeUppercaseCharacter(unichar character) {
+    return character + NSUnicodeUppercaseDeltas[character >> 8][character & 0xFF];
+}
+
+static inline unichar NSUnicodeLowercaseCharacter(unichar character) {
+    return character + NSUnicodeLowercaseDeltas[character >> 8][character & 0xFF];
+}
+
 void NSUnicodeToUppercase(unichar *characters, NSUInteger length);
 void NSUnicodeToLowercase(unichar *characters, NSUInteger length);
 void NSUnicodeToCapitalized(unichar *characters, NSUInteger length);
@@ -690,32 +690,510 @@ FF59 FF39
 FF5A FF3A
 #endif
 
-static unichar _toUpperCase(unichar character){
-   if(character>='a' && character<='z')
-    return character-('a'-'A');
-   return character;
-}
+// The mappings above as the difference to add to each character, a page of 256 characters at a
+// time. Pages without cased characters share the page of zeros.
+static const short NSUnicodeCaseDeltaNone[256];
+
+static const short NSUnicodeUppercaseDeltasPage00[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,
+ -32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ -32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,
+ -32,-32,-32,-32,-32,-32,-32,0,-32,-32,-32,-32,-32,-32,-32,121
+};
+
+static const short NSUnicodeUppercaseDeltasPage01[256]={
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,0,0,-1,0,-1,0,-1,0,0,-1,0,-1,0,-1,0,
+ -1,0,-1,0,-1,0,-1,0,-1,0,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,0,-1,0,-1,0,-1,-300,
+ 0,0,0,-1,0,-1,0,0,-1,0,0,0,-1,0,0,0,
+ 0,0,-1,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+ 0,-1,0,-1,0,-1,0,0,-1,0,0,0,0,-1,0,0,
+ -1,0,0,0,-1,0,-1,0,0,-1,0,0,0,-1,0,0,
+ 0,0,0,0,0,-1,-2,0,-1,-2,0,-1,-2,0,-1,0,
+ -1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,0,-1,-2,0,-1,0,0,0,0,0,-1,0,-1,0,-1
+};
+
+static const short NSUnicodeUppercaseDeltasPage02[256]={
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,-210,-206,0,0,-205,-202,-202,0,-203,0,0,0,0,
+ -205,0,0,-207,0,0,0,0,-209,-211,0,0,0,0,0,-211,
+ 0,0,-213,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,-218,0,0,0,0,-218,0,-217,-217,0,0,0,0,
+ 0,0,-219,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage03[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,-38,-37,-37,-37,
+ 0,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,
+ -32,-32,0,-32,-32,-32,-32,-32,-32,-32,-32,-32,-64,-63,-63,0,
+ -62,-57,0,0,0,-47,-54,0,0,0,0,0,0,0,0,0,
+ 0,0,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ -86,-80,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage04[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ -32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,
+ -32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,
+ 0,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,-80,0,-80,-80,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,0,-1,0,-1,0,0,0,-1,0,0,0,-1,0,0,0,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,0,0,-1,
+ 0,-1,0,-1,0,-1,0,0,0,-1,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage05[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,
+ -48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,-48,
+ -48,-48,-48,-48,-48,-48,-48,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage1E[256]={
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,0,0,0,0,0,0,0,0,0,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,0,-1,
+ 0,-1,0,-1,0,-1,0,-1,0,-1,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage1F[256]={
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,0,0,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,0,0,0,0,0,0,0,0,0,0,
+ 0,8,0,8,0,8,0,8,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 74,74,86,86,86,86,100,100,128,128,112,112,126,126,0,0,
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,0,
+ 8,8,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+ 8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 8,8,0,0,0,7,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage21[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ -16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,-16,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPage24[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ -26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,-26,
+ -26,-26,-26,-26,-26,-26,-26,-26,-26,-26,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeUppercaseDeltasPageFF[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,
+ -32,-32,-32,-32,-32,-32,-32,-32,-32,-32,-32,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+const short *const NSUnicodeUppercaseDeltas[256]={
+ NSUnicodeUppercaseDeltasPage00,NSUnicodeUppercaseDeltasPage01,NSUnicodeUppercaseDeltasPage02,NSUnicodeUppercaseDeltasPage03,NSUnicodeUppercaseDeltasPage04,NSUnicodeUppercaseDeltasPage05,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeUppercaseDeltasPage1E,NSUnicodeUppercaseDeltasPage1F,
+ NSUnicodeCaseDeltaNone,NSUnicodeUppercaseDeltasPage21,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeUppercaseDeltasPage24,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeUppercaseDeltasPageFF
+};
+
+static const short NSUnicodeLowercaseDeltasPage00[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+ 32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+ 32,32,32,32,32,32,32,0,32,32,32,32,32,32,32,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage01[256]={
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 0,0,1,0,1,0,1,0,0,1,0,1,0,1,0,1,
+ 0,1,0,1,0,1,0,1,0,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,-121,1,0,1,0,1,0,0,
+ 0,210,1,0,1,0,206,1,0,0,205,1,0,0,202,202,
+ 203,1,0,205,207,0,211,209,1,0,0,0,211,213,0,0,
+ 1,0,1,0,1,0,0,1,0,218,0,0,1,0,218,1,
+ 0,217,217,1,0,1,0,219,1,0,0,0,1,0,0,0,
+ 0,0,0,0,2,0,0,2,0,0,2,0,0,1,0,1,
+ 0,1,0,1,0,1,0,1,0,1,0,1,0,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 0,2,0,0,1,0,0,0,0,0,1,0,1,0,1,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage02[256]={
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage03[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,38,0,37,37,37,0,64,0,63,63,
+ 0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+ 32,32,0,32,32,32,32,32,32,32,32,32,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage04[256]={
+ 0,80,80,80,80,80,80,80,80,80,80,80,80,0,80,80,
+ 32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+ 32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 0,1,0,1,0,0,0,1,0,0,0,1,0,0,0,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,0,0,1,0,
+ 1,0,1,0,1,0,0,0,1,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage05[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+ 48,48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage1E[256]={
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+ 1,0,1,0,1,0,1,0,1,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage1F[256]={
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,0,0,
+ 0,0,0,0,0,0,0,0,0,-8,0,-8,0,-8,0,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-8,-8,-8,-8,-8,-8,
+ 0,0,0,0,0,0,0,0,-8,-8,-74,-74,-9,0,0,0,
+ 0,0,0,0,0,0,0,0,-86,-86,-86,-86,-9,0,0,0,
+ 0,0,0,0,0,0,0,0,-8,-8,-100,-100,0,0,0,0,
+ 0,0,0,0,0,0,0,0,-8,-8,-112,-112,-7,0,0,0,
+ 0,0,0,0,0,0,0,0,-128,-128,-126,-126,-9,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage21[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPage24[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,26,26,26,26,26,26,26,26,26,26,
+ 26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+static const short NSUnicodeLowercaseDeltasPageFF[256]={
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+ 32,32,32,32,32,32,32,32,32,32,32,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+const short *const NSUnicodeLowercaseDeltas[256]={
+ NSUnicodeLowercaseDeltasPage00,NSUnicodeLowercaseDeltasPage01,NSUnicodeLowercaseDeltasPage02,NSUnicodeLowercaseDeltasPage03,NSUnicodeLowercaseDeltasPage04,NSUnicodeLowercaseDeltasPage05,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeLowercaseDeltasPage1E,NSUnicodeLowercaseDeltasPage1F,
+ NSUnicodeCaseDeltaNone,NSUnicodeLowercaseDeltasPage21,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeLowercaseDeltasPage24,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,
+ NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeCaseDeltaNone,NSUnicodeLowercaseDeltasPageFF
+};
 
-// FIX
 void NSUnicodeToUppercase(unichar *characters,NSUInteger length) {
    NSUInteger i;
 
    for(i=0;i<length;i++)
-    characters[i]=_toUpperCase(characters[i]);
-}
-
-static unichar _toLowerCase(unichar character){
-   if(character>='A' && character<='Z')
-    return character+('a'-'A');
-   return character;
+    characters[i]=NSUnicodeUppercaseCharacter(characters[i]);
 }
 
-// FIX
 void NSUnicodeToLowercase(unichar *characters,NSUInteger length) {
    NSUInteger i;
 
    for(i=0;i<length;i++)
-    characters[i]=_toLowerCase(characters[i]);
+    characters[i]=NSUnicodeLowercaseCharacter(characters[i]);
 }
 
 
@@ -725,7 +1203,7 @@ void NSUnicodeToCapitalized(unichar *characters,NSUInteger length) {
 
    for(i=0;i<length;i++){
     if(prev==' ')
-     characters[i]=_toUpperCase(characters[i]);
+     characters[i]=NSUnicodeUppercaseCharacter(characters[i]);
     else
      characters[i]=characters[i];
 
@@ -40,6 +40,10 @@ FOUNDATION_EXPORT void NSDeallocateObject(id object);
 FOUNDATION_EXPORT id NSCopyObject(id object, NSUInteger extraBytes, NSZone *zone);
 FOUNDATION_EXPORT BOOL NSShouldRetainWithZone(id object, NSZone *zone);
 
+// Gives the instances NSDeallocateObject keeps for reuse back to malloc, those cached by other
+// threads are returned as the threads allocate or exit. Call under memory pressure.
+FOUNDATION_EXPORT void NSTrimObjectCaches(void);
+
 FOUNDATION_EXPORT void NSIncrementExtraRefCount(id object);
 FOUNDATION_EXPORT BOOL NSDecrementExtraRefCountWasZero(id object);
 FOUNDATION_EXPORT NSUInteger NSExtraRefCount(id object);
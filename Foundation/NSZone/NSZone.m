@@ -13,7 +13,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <Foundation/NSZombieObject.h>
 #import <Foundation/NSDebug.h>
 #import <objc/objc_arc.h>
+#import <objc/objc_atomic.h>
 #include <string.h>
+#include <stdlib.h>
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+#import <objc/objc_tls.h>
+#import <objc/objc_lock.h>
+#import <objc/objc_census.h>
+#endif
 #ifdef WIN32
 #include <windows.h>
 #else
@@ -46,15 +53,328 @@ void NSSetAllocateObjectHook(void (*hook)(id object))
 }
 
 
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+
+// Freed instances of the default zone are kept per thread for the next allocation of the same
+// size, in magazines of blocks with a shared depot of full magazines behind them. A thread which
+// only frees fills the depot, one which only allocates drains it, and both go to malloc only
+// when the depot is full or empty.
+//
+// Blocks are filed under their instance size rounded down to NSObjectCacheGranularity, and
+// handed out for allocations of the size rounded up, so a block is never smaller than the
+// object placed in it even when it was allocated elsewhere at its exact size. An object
+// allocated with extra bytes is bigger than its class says, instances of any class that has
+// ever been allocated that way go back to NSZoneFree instead.
+
+#define NSObjectCacheGranularity 8
+#define NSObjectCacheSizeClasses 32 // up to 256 bytes
+#define NSObjectCacheMagazineSize 32
+#define NSObjectCacheDepotLimit 64 // full magazines per size class
+
+typedef struct NSObjectMagazine {
+    struct NSObjectMagazine *next;
+    NSUInteger count;
+    void *blocks[NSObjectCacheMagazineSize];
+} NSObjectMagazine;
+
+typedef struct NSObjectCache {
+    NSObjectMagazine *loaded[NSObjectCacheSizeClasses];
+    NSObjectMagazine *previous[NSObjectCacheSizeClasses];
+} NSObjectCache;
+
+typedef struct {
+    objc_lock lock;
+    NSUInteger fullCount;
+    NSObjectMagazine *full;
+    NSObjectMagazine *empty;
+} NSObjectDepot;
+
+static NSObjectDepot objectDepots[NSObjectCacheSizeClasses];
+
+static void objectCacheThreadExit(objc_tls *tls);
+
+static NSObjectCache *objectCacheForThread(objc_tls *tls) {
+    if (tls->objectCache == NULL) {
+        objc_tlsObjectCacheExit = objectCacheThreadExit;
+        tls->objectCache = calloc(1, sizeof(NSObjectCache));
+    }
+    return tls->objectCache;
+}
+
+static void freeMagazineBlocks(NSObjectMagazine *magazine) {
+    NSUInteger i;
+
+    for (i = 0; i < magazine->count; i++) {
+        free(magazine->blocks[i]);
+    }
+    magazine->count = 0;
+}
+
+// Swaps an empty magazine for a full one from the depot, NULL if there is none
+static NSObjectMagazine *depotExchangeEmpty(NSObjectDepot *depot, NSObjectMagazine *empty) {
+    NSObjectMagazine *result;
+
+    objc_lock_lock(&depot->lock);
+    if ((result = depot->full) != NULL) {
+        depot->full = result->next;
+        depot->fullCount--;
+        if (empty != NULL) {
+            empty->next = depot->empty;
+            depot->empty = empty;
+        }
+    }
+    objc_lock_unlock(&depot->lock);
+
+    return result;
+}
+
+// Takes a full magazine, returns an empty one in its place
+static NSObjectMagazine *depotExchangeFull(NSObjectDepot *depot, NSObjectMagazine *full) {
+    NSObjectMagazine *result;
+
+    objc_lock_lock(&depot->lock);
+    if (depot->fullCount < NSObjectCacheDepotLimit) {
+        full->next = depot->full;
+        depot->full = full;
+        depot->fullCount++;
+        full = NULL;
+    }
+    if ((result = depot->empty) != NULL) {
+        depot->empty = result->next;
+    }
+    objc_lock_unlock(&depot->lock);
+
+    if (full != NULL) {
+        freeMagazineBlocks(full);
+        if (result == NULL) {
+            return full;
+        }
+        free(full);
+    }
+    if (result == NULL) {
+        result = calloc(1, sizeof(NSObjectMagazine));
+    }
+    return result;
+}
+
+static void depotReturn(NSObjectDepot *depot, NSObjectMagazine *magazine) {
+    if (magazine == NULL) {
+        return;
+    }
+    if (magazine->count == 0) {
+        objc_lock_lock(&depot->lock);
+        magazine->next = depot->empty;
+        depot->empty = magazine;
+        objc_lock_unlock(&depot->lock);
+    } else {
+        free(depotExchangeFull(depot, magazine));
+    }
+}
+
+static void objectCacheThreadExit(objc_tls *tls) {
+    NSObjectCache *cache = tls->objectCache;
+    int i;
+
+    for (i = 0; i < NSObjectCacheSizeClasses; i++) {
+        depotReturn(objectDepots + i, cache->loaded[i]);
+        depotReturn(objectDepots + i, cache->previous[i]);
+    }
+    tls->objectCache = NULL;
+    free(cache);
+}
+
+void NSTrimObjectCaches(void) {
+    objc_tls *tls = objc_tlsCurrent();
+    int i;
+
+    if (tls->objectCache != NULL) {
+        objectCacheThreadExit(tls);
+    }
+
+    for (i = 0; i < NSObjectCacheSizeClasses; i++) {
+        NSObjectDepot *depot = objectDepots + i;
+        NSObjectMagazine *full, *empty, *next;
+
+        objc_lock_lock(&depot->lock);
+        full = depot->full;
+        empty = depot->empty;
+        depot->full = depot->empty = NULL;
+        depot->fullCount = 0;
+        objc_lock_unlock(&depot->lock);
+
+        for (; full != NULL; full = next) {
+            next = full->next;
+            freeMagazineBlocks(full);
+            free(full);
+        }
+        for (; empty != NULL; empty = next) {
+            next = empty->next;
+            free(empty);
+        }
+    }
+}
+
+// Per class counters, a fixed open addressed table which stops taking classes once full
+#define NSObjectCacheStatisticsSize 8192
+
+typedef struct {
+    Class volatile cls;
+    volatile NSUInteger hits;
+    volatile NSUInteger misses;
+} NSObjectCacheCounters;
+
+static volatile BOOL objectCacheStatisticsEnabled = NO;
+static NSObjectCacheCounters *objectCacheCounters = NULL;
+
+static void countAllocation(Class class, BOOL hit) {
+    uintptr_t index = ((uintptr_t)class >> 4) & (NSObjectCacheStatisticsSize - 1);
+    NSUInteger probes;
+
+    for (probes = 0; probes < NSObjectCacheStatisticsSize; probes++, index = (index + 1) & (NSObjectCacheStatisticsSize - 1)) {
+        NSObjectCacheCounters *counters = objectCacheCounters + index;
+        Class check = OBJCAtomicLoad(&counters->cls);
+
+        if (check == Nil && __sync_bool_compare_and_swap(&counters->cls, Nil, class)) {
+            check = class;
+        }
+        if (check == class) {
+            __sync_fetch_and_add(hit ? &counters->hits : &counters->misses, 1);
+            return;
+        }
+    }
+}
+
+void NSSetObjectCacheStatisticsEnabled(BOOL enabled) {
+    if (enabled && objectCacheCounters == NULL) {
+        NSObjectCacheCounters *counters = calloc(NSObjectCacheStatisticsSize, sizeof(NSObjectCacheCounters));
+
+        if (!__sync_bool_compare_and_swap(&objectCacheCounters, NULL, counters)) {
+            free(counters);
+        }
+    }
+    objectCacheStatisticsEnabled = enabled;
+}
+
+static int compareAllocations(const void *a, const void *b) {
+    const NSObjectCacheStatistics *left = a, *right = b;
+    NSUInteger leftCount = left->hits + left->misses, rightCount = right->hits + right->misses;
+
+    return (leftCount > rightCount) ? -1 : (leftCount < rightCount) ? 1 : 0;
+}
+
+NSObjectCacheStatistics *NSCopyObjectCacheStatistics(NSUInteger *count) {
+    NSObjectCacheStatistics *result = malloc(sizeof(NSObjectCacheStatistics) * NSObjectCacheStatisticsSize);
+    NSUInteger i, resultCount = 0;
+
+    for (i = 0; objectCacheCounters != NULL && i < NSObjectCacheStatisticsSize; i++) {
+        NSObjectCacheCounters *counters = objectCacheCounters + i;
+
+        if (counters->cls != Nil && (counters->hits != 0 || counters->misses != 0)) {
+            result[resultCount].cls = counters->cls;
+            result[resultCount].hits = counters->hits;
+            result[resultCount].misses = counters->misses;
+            resultCount++;
+        }
+    }
+
+    qsort(result, resultCount, sizeof(NSObjectCacheStatistics), compareAllocations);
+    *count = resultCount;
+    return result;
+}
+
+// Classes stay in the table, their counters start over
+void NSResetObjectCacheStatistics(void) {
+    NSUInteger i;
+
+    for (i = 0; objectCacheCounters != NULL && i < NSObjectCacheStatisticsSize; i++) {
+        objectCacheCounters[i].hits = 0;
+        objectCacheCounters[i].misses = 0;
+    }
+}
+
+static id objectCacheAllocate(Class class, NSUInteger size) {
+    NSUInteger sizeClass = (size + NSObjectCacheGranularity - 1) / NSObjectCacheGranularity - 1;
+    NSObjectCache *cache = objectCacheForThread(objc_tlsCurrent());
+    NSObjectMagazine *magazine = cache->loaded[sizeClass];
+    id result = nil;
+
+    if (magazine == NULL || magazine->count == 0) {
+        NSObjectMagazine *previous = cache->previous[sizeClass];
+
+        if (previous != NULL && previous->count > 0) {
+            cache->previous[sizeClass] = magazine;
+            cache->loaded[sizeClass] = magazine = previous;
+        } else if ((previous = depotExchangeEmpty(objectDepots + sizeClass, previous)) != NULL) {
+            cache->previous[sizeClass] = magazine;
+            cache->loaded[sizeClass] = magazine = previous;
+        } else {
+            magazine = NULL;
+        }
+    }
+
+    if (magazine != NULL) {
+        result = magazine->blocks[--magazine->count];
+        memset(result, 0, (sizeClass + 1) * NSObjectCacheGranularity);
+    } else {
+        result = calloc(1, (sizeClass + 1) * NSObjectCacheGranularity);
+    }
+
+    if (objectCacheStatisticsEnabled) {
+        countAllocation(class, magazine != NULL);
+    }
+
+    return result;
+}
+
+static void objectCacheFree(id object, NSUInteger size) {
+    NSUInteger sizeClass = size / NSObjectCacheGranularity - 1;
+    NSObjectCache *cache = objectCacheForThread(objc_tlsCurrent());
+    NSObjectMagazine *magazine = cache->loaded[sizeClass];
+
+    if (magazine == NULL || magazine->count == NSObjectCacheMagazineSize) {
+        NSObjectMagazine *previous = cache->previous[sizeClass];
+
+        if (previous == NULL || previous->count < NSObjectCacheMagazineSize) {
+            if (previous == NULL) {
+                previous = calloc(1, sizeof(NSObjectMagazine));
+            }
+            cache->previous[sizeClass] = magazine;
+            cache->loaded[sizeClass] = magazine = previous;
+        } else {
+            // both full, the older one goes to the depot for an empty one
+            cache->previous[sizeClass] = magazine;
+            cache->loaded[sizeClass] = magazine = depotExchangeFull(objectDepots + sizeClass, previous);
+        }
+    }
+
+    magazine->blocks[magazine->count++] = object;
+}
+
+static inline BOOL objectCacheableSize(NSUInteger size) {
+    return size >= NSObjectCacheGranularity && size <= NSObjectCacheSizeClasses * NSObjectCacheGranularity;
+}
+
+#endif
+
 id NSAllocateObject(Class class, NSUInteger extraBytes, NSZone *zone)
 {
     id result;
+    NSUInteger size = class_getInstanceSize(class) + extraBytes;
 
     if (zone == NULL) {
         zone = NSDefaultMallocZone();
     }
 
-    result = NSZoneCalloc(zone, 1, class_getInstanceSize(class) + extraBytes);
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+    if (extraBytes > 0) {
+        OBJCClassNoteExtraBytes(class);
+    }
+
+    if (zone == NSDefaultMallocZone() && objectCacheableSize(size)) {
+        result = objectCacheAllocate(class, size);
+    } else
+#endif
+    result = NSZoneCalloc(zone, 1, size);
 
     if (result) {
 #if defined(GCC_RUNTIME_3)
@@ -71,6 +391,12 @@ id NSAllocateObject(Class class, NSUInteger extraBytes, NSZone *zone)
         }
 #endif
 
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+        if (result && objc_census_enabled) {
+            OBJCCensusCountAllocation(class, size);
+        }
+#endif
+
         if (__NSAllocateObjectHook) {
             __NSAllocateObjectHook(result);
         }
@@ -82,6 +408,12 @@ id NSAllocateObject(Class class, NSUInteger extraBytes, NSZone *zone)
 
 void NSDeallocateObject(id object)
 {
+#if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+    if (objc_census_enabled) {
+        OBJCCensusCountDeallocation(object->isa);
+    }
+#endif
+
 #if defined(GCC_RUNTIME_3)
     // TODO As of gcc 4.6.2 the GCC runtime does not have support for C++ destructor calling.
 #elif defined(APPLE_RUNTIME_4)
@@ -91,6 +423,8 @@ void NSDeallocateObject(id object)
 #endif
 
 #if !defined(APPLE_RUNTIME_4)
+    object_clearWeakReferences(object);
+
     //delete associations
     objc_removeAssociatedObjects(object);
 #endif
@@ -105,7 +439,16 @@ void NSDeallocateObject(id object)
         }
 
 #if !defined(GCC_RUNTIME_3) && !defined(APPLE_RUNTIME_4)
+        Class class = object->isa;
+        NSUInteger size = class_getInstanceSize(class);
+        NSZone *objectZone = NSZoneFromPointer(object);
+
         object->isa = 0;
+
+        if ((objectZone == NULL || objectZone == NSDefaultMallocZone()) && objectCacheableSize(size) && !OBJCClassMayHaveExtraBytes(class)) {
+            objectCacheFree(object, size);
+            return;
+        }
 #endif
 
         NSZoneFree(zone, object);
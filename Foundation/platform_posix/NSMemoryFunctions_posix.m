@@ -19,10 +19,14 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <unistd.h>
 #include <pthread.h>
 #include <errno.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#import <objc/objc_lock.h>
+#import <objc/objc_atomic.h>
 
 // some notes:
 // - this uses POSIX thread local storage functions
-// - there is no zone support
 
 void *NSAllocateMemoryPages(NSUInteger byteCount) {
     void *buffer = malloc(byteCount);
@@ -45,31 +49,320 @@ void NSCopyMemoryPages(const void *src,void *dst,NSUInteger byteCount) {
     dstb[i]=srcb[i];
 }
 
+// Zones other than the default zone are arenas. Memory is bumped out of chunks mapped at
+// NSArenaChunkSize alignment and a two level map from chunk address to chunk descriptor tells
+// any pointer's zone without locking, so NSZoneFree and NSZoneRealloc go by the pointer and
+// not by the zone they are passed. Freeing arena memory is deferred to NSRecycleZone, which
+// unmaps every chunk at once without visiting the objects in them.
+//
+// Objects must not outlive their zone. With NSZoneDebugEnabled each block carries a header,
+// NSRecycleZone reports the blocks never freed (by class if they are objects) and leaves the
+// chunks mapped but inaccessible so that any later use faults.
+
+#define NSArenaChunkShift 16
+#define NSArenaChunkSize ((NSUInteger)1<<NSArenaChunkShift)
+#define NSArenaMaxChunkSize ((NSUInteger)4<<20)
+#define NSArenaAlignment 16
+#define NSArenaDebugAllocated 0xA110CA7EU
+#define NSArenaDebugFreed 0xF7EED0U
+
+typedef struct NSArenaChunk {
+   struct NSArenaChunk *next;
+   struct NSArenaZone  *zone; // NULL once recycled in debug mode
+   uint8_t             *base;
+   NSUInteger           size;
+   uint8_t             *used; // end of the blocks bumped so far, for debug walks
+} NSArenaChunk;
+
+typedef struct {
+   NSUInteger size;
+   NSUInteger state;
+} NSArenaDebugHeader;
+
+typedef struct NSArenaZone {
+   objc_lock     lock;
+   NSArenaChunk *chunks;
+   NSArenaChunk *current; // the chunk being bumped through
+   uint8_t      *next;
+   uint8_t      *limit;
+   NSUInteger    granularity;
+   BOOL          debug;
+   NSString     *name;
+} NSArenaZone;
+
+static NSArenaZone defaultZone;
+
+// 16 bits of chunk map per level, covers 48 bit addresses
+static NSArenaChunk **chunkMap[1<<16];
+static objc_lock chunkMapLock=0;
+
+static inline NSArenaChunk *chunkForPointer(const void *pointer) {
+   uint64_t      address=(uintptr_t)pointer;
+   NSArenaChunk **level;
+
+   if((address>>48)!=0)
+      return NULL;
+   if((level=OBJCAtomicLoad(&chunkMap[address>>32]))==NULL)
+      return NULL;
+
+   return OBJCAtomicLoad(&level[(address>>NSArenaChunkShift)&0xFFFF]);
+}
+
+static void setChunkMap(uint8_t *base,NSUInteger size,NSArenaChunk *chunk) {
+   uint64_t address;
+
+   objc_lock_lock(&chunkMapLock);
+   for(address=(uintptr_t)base;address<(uintptr_t)base+size;address+=NSArenaChunkSize){
+      NSArenaChunk **level=chunkMap[address>>32];
+
+      if(level==NULL){
+         level=calloc(1<<16,sizeof(NSArenaChunk *));
+         OBJCAtomicStore(&chunkMap[address>>32], level);
+      }
+      OBJCAtomicStore(&level[(address>>NSArenaChunkShift)&0xFFFF], chunk);
+   }
+   objc_lock_unlock(&chunkMapLock);
+}
+
+// zone lock held
+static NSArenaChunk *arenaAddChunk(NSArenaZone *zone,NSUInteger minimum) {
+   NSUInteger    size=(minimum+NSArenaChunkSize-1)&~(NSArenaChunkSize-1);
+   uint8_t      *mapped,*base;
+   NSArenaChunk *chunk;
+
+   if(size<zone->granularity)
+      size=zone->granularity;
+
+   // over allocate so an aligned run of size fits, and give back the ends
+   if((mapped=mmap(NULL,size+NSArenaChunkSize,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANON,-1,0))==MAP_FAILED){
+      fprintf(stderr,"NSZone arena allocation of %lu bytes failed. Error: %s\n",(unsigned long)size,strerror(errno));
+      return NULL;
+   }
+   base=(uint8_t *)(((uintptr_t)mapped+NSArenaChunkSize-1)&~(uintptr_t)(NSArenaChunkSize-1));
+   if(base>mapped)
+      munmap(mapped,base-mapped);
+   munmap(base+size,(mapped+size+NSArenaChunkSize)-(base+size));
+
+   if(((uint64_t)(uintptr_t)base+size)>>48){
+      fprintf(stderr,"NSZone arena chunk %p is outside the chunk map\n",base);
+      munmap(base,size);
+      return NULL;
+   }
+
+   chunk=malloc(sizeof(NSArenaChunk));
+   chunk->zone=zone;
+   chunk->base=base;
+   chunk->size=size;
+   chunk->used=base;
+   chunk->next=zone->chunks;
+   zone->chunks=chunk;
+   setChunkMap(base,size,chunk);
+
+   return chunk;
+}
+
+// mapped memory is zero filled and never reused, so this is calloc as well
+static void *arenaAllocate(NSArenaZone *zone,NSUInteger size) {
+   NSUInteger total=(size+(zone->debug?sizeof(NSArenaDebugHeader):0)+NSArenaAlignment-1)&~(NSUInteger)(NSArenaAlignment-1);
+   uint8_t   *result;
+
+   if(total<size){
+      errno=ENOMEM;
+      return NULL;
+   }
+   if(total==0)
+      total=NSArenaAlignment;
+
+   objc_lock_lock(&zone->lock);
+   if((NSUInteger)(zone->limit-zone->next)<total){
+      NSArenaChunk *chunk;
+
+      // big blocks get a chunk of their own and the current chunk keeps bumping
+      if(total>zone->granularity/2){
+         if((chunk=arenaAddChunk(zone,total))==NULL){
+            objc_lock_unlock(&zone->lock);
+            return NULL;
+         }
+         chunk->used=chunk->base+total;
+         objc_lock_unlock(&zone->lock);
+         result=chunk->base;
+         goto done;
+      }
+
+      if((chunk=arenaAddChunk(zone,zone->granularity))==NULL){
+         objc_lock_unlock(&zone->lock);
+         return NULL;
+      }
+      zone->current=chunk;
+      zone->next=chunk->base;
+      zone->limit=chunk->base+chunk->size;
+      if(zone->granularity<NSArenaMaxChunkSize)
+         zone->granularity*=2;
+   }
+   result=zone->next;
+   zone->next+=total;
+   zone->current->used=zone->next;
+   objc_lock_unlock(&zone->lock);
+
+done:
+   if(zone->debug){
+      NSArenaDebugHeader *header=(NSArenaDebugHeader *)result;
+
+      header->size=total;
+      header->state=NSArenaDebugAllocated;
+      result+=sizeof(NSArenaDebugHeader);
+   }
+   return result;
+}
+
+static void arenaFree(NSArenaChunk *chunk,void *pointer) {
+   NSArenaDebugHeader *header;
+
+   if(chunk->zone==NULL){
+      fprintf(stderr,"NSZoneFree(%p): freed after its zone was recycled\n",pointer);
+      return;
+   }
+   if(!chunk->zone->debug)
+      return;
+
+   header=(NSArenaDebugHeader *)pointer-1;
+   if(header->state!=NSArenaDebugAllocated)
+      fprintf(stderr,"NSZoneFree(%p): not allocated or freed twice in zone %p\n",pointer,chunk->zone);
+   header->state=NSArenaDebugFreed;
+}
+
+static int compareClasses(const void *a,const void *b) {
+   uintptr_t left=*(uintptr_t *)a,right=*(uintptr_t *)b;
+
+   return (left<right)?-1:(left>right)?1:0;
+}
+
+// Blocks of a debug zone which were never freed, the ones starting with a class are objects
+static void arenaReportLiveBlocks(NSArenaZone *zone) {
+   int           classCount=objc_getClassList(NULL,0);
+   Class        *classes=malloc(sizeof(Class)*(classCount+1));
+   NSUInteger    blocks=0,objects=0;
+   NSArenaChunk *chunk;
+
+   classCount=objc_getClassList(classes,classCount);
+   qsort(classes,classCount,sizeof(Class),compareClasses);
+
+   for(chunk=zone->chunks;chunk!=NULL;chunk=chunk->next){
+      uint8_t *check;
+
+      for(check=chunk->base;check<chunk->used;){
+         NSArenaDebugHeader *header=(NSArenaDebugHeader *)check;
+
+         if(header->state==NSArenaDebugAllocated){
+            id object=(id)(header+1);
+            Class cls=object_getClass(object);
+
+            blocks++;
+            if(header->size>=sizeof(NSArenaDebugHeader)+sizeof(id) && bsearch(&cls,classes,classCount,sizeof(Class),compareClasses)!=NULL){
+               objects++;
+               fprintf(stderr,"NSRecycleZone(%p): <%s: %p> outlives its zone\n",zone,class_getName(cls),object);
+            }
+         }
+         check+=header->size;
+      }
+   }
+   if(blocks>0)
+      fprintf(stderr,"NSRecycleZone(%p): %lu blocks still allocated, %lu of them objects\n",zone,(unsigned long)blocks,(unsigned long)objects);
+   free(classes);
+}
+
 NSZone *NSCreateZone(NSUInteger startSize,NSUInteger granularity,BOOL canFree){
-   return NULL;
+   NSArenaZone *zone=calloc(1,sizeof(NSArenaZone));
+
+   zone->granularity=(granularity<NSArenaChunkSize)?NSArenaChunkSize:(granularity+NSArenaChunkSize-1)&~(NSArenaChunkSize-1);
+   zone->debug=NSZoneDebugEnabled;
+
+   // reserve the starting size up front, as the first chunk
+   if(startSize>0){
+      NSArenaChunk *chunk;
+
+      if((chunk=arenaAddChunk(zone,startSize))!=NULL){
+         zone->current=chunk;
+         zone->next=chunk->base;
+         zone->limit=chunk->base+chunk->size;
+      }
+   }
+
+   return (NSZone *)zone;
 }
 
 NSZone *NSDefaultMallocZone(void){
-   return NULL;
+   return (NSZone *)&defaultZone;
 }
 
-void NSRecycleZone(NSZone *zone) {
+void NSRecycleZone(NSZone *zoneX) {
+   NSArenaZone  *zone=(NSArenaZone *)zoneX;
+   NSArenaChunk *chunk,*next;
+
+   if(zone==NULL || zone==&defaultZone)
+      return;
+
+   if(zone->debug)
+      arenaReportLiveBlocks(zone);
+
+   for(chunk=zone->chunks;chunk!=NULL;chunk=next){
+      next=chunk->next;
+
+      if(zone->debug){
+         chunk->zone=NULL;
+         mprotect(chunk->base,chunk->size,PROT_NONE);
+      }
+      else {
+         setChunkMap(chunk->base,chunk->size,NULL);
+         munmap(chunk->base,chunk->size);
+         free(chunk);
+      }
+   }
+
+   [zone->name release];
+   free(zone);
 }
 
-void NSSetZoneName(NSZone *zone,NSString *name){
+void NSSetZoneName(NSZone *zoneX,NSString *name){
+   NSArenaZone *zone=(zoneX==NULL)?&defaultZone:(NSArenaZone *)zoneX;
 
+   name=[name copy];
+   [zone->name release];
+   zone->name=name;
 }
 
-NSString *NSZoneName(NSZone *zone) {
-   return @"zone";
+NSString *NSZoneName(NSZone *zoneX) {
+   NSArenaZone *zone=(zoneX==NULL)?&defaultZone:(NSArenaZone *)zoneX;
+
+   if(zone->name!=nil)
+      return zone->name;
+
+   return (zone==&defaultZone)?@"DefaultMallocZone":@"zone";
 }
 
 NSZone *NSZoneFromPointer(void *pointer){
-   return NULL;
+   NSArenaChunk *chunk=chunkForPointer(pointer);
+
+   if(chunk!=NULL && chunk->zone!=NULL)
+      return (NSZone *)chunk->zone;
+
+   return (NSZone *)&defaultZone;
 }
 
 void *NSZoneCalloc(NSZone *zone,NSUInteger numElems,NSUInteger numBytes){
-    void *buffer = calloc(numElems,numBytes);
+    void *buffer;
+
+    if(zone!=NULL && zone!=(NSZone *)&defaultZone){
+        // calloc checks this itself
+        if(numBytes!=0 && numElems>NSUIntegerMax/numBytes){
+            errno=ENOMEM;
+            buffer=NULL;
+        }
+        else
+            buffer = arenaAllocate((NSArenaZone *)zone,numElems*numBytes);
+    }
+    else
+        buffer = calloc(numElems,numBytes);
     if (buffer == NULL) {
         fprintf(stderr, "NSZoneCalloc(zone, %u, %u) failed. Error: %s\n", numElems, numBytes, strerror(errno));
     }
@@ -77,11 +370,21 @@ void *NSZoneCalloc(NSZone *zone,NSUInteger numElems,NSUInteger numBytes){
 }
 
 void NSZoneFree(NSZone *zone,void *pointer){
-   free(pointer);
+   NSArenaChunk *chunk=chunkForPointer(pointer);
+
+   if(chunk!=NULL)
+      arenaFree(chunk,pointer);
+   else
+      free(pointer);
 }
 
 void *NSZoneMalloc(NSZone *zone,NSUInteger size){
-   void *buffer = malloc(size);
+   void *buffer;
+
+   if(zone!=NULL && zone!=(NSZone *)&defaultZone)
+      buffer = arenaAllocate((NSArenaZone *)zone,size);
+   else
+      buffer = malloc(size);
     if (buffer == NULL) {
         fprintf(stderr, "NSZoneMalloc(zone, %u) failed. Error: %s\n", size, strerror(errno));
     }
@@ -89,7 +392,31 @@ void *NSZoneMalloc(NSZone *zone,NSUInteger size){
 }
 
 void *NSZoneRealloc(NSZone *zone,void *pointer,NSUInteger size){
-    void *buffer = realloc(pointer, size);
+    NSArenaChunk *chunk=chunkForPointer(pointer);
+    void *buffer;
+
+    if(pointer==NULL)
+        return NSZoneMalloc(zone,size);
+
+    if(chunk==NULL)
+        buffer = realloc(pointer, size);
+    else if(chunk->zone==NULL){
+        fprintf(stderr, "NSZoneRealloc(zone, %p, %u): reallocated after its zone was recycled\n", pointer, size);
+        return NULL;
+    }
+    else {
+        // The old size isn't kept outside of debug zones. Everything up to the end of the chunk
+        // belongs to the zone so copying past the old block is harmless, it may run into the new one.
+        NSUInteger available=(chunk->base+chunk->size)-(uint8_t *)pointer;
+
+        if(chunk->zone->debug)
+            available=((NSArenaDebugHeader *)pointer-1)->size-sizeof(NSArenaDebugHeader);
+
+        if((buffer=arenaAllocate(chunk->zone,size))!=NULL){
+            memmove(buffer,pointer,(size<available)?size:available);
+            arenaFree(chunk,pointer);
+        }
+    }
     if (buffer == NULL && size > 0) {
         fprintf(stderr, "NSZoneRealloc(zone, %p, %u) failed. Error: %s\n", pointer, size, strerror(errno));
     }
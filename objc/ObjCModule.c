@@ -11,6 +11,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import "objc_log.h"
 #import "objc_malloc.h"
 #import "objc_protocol.h"
+#import "objc_atomic.h"
 #if defined(__APPLE__)
 #import "OBJCRegisterModule_Darwin.h"
 #endif
@@ -39,8 +40,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 static Class *unresolvedClasses = NULL;
 static int unresolvedClassesSize = 0;
-static Class *sentLoadMessageClasses = NULL;
-static int sentLoadMessageClassesSize = 0;
+
+objc_startup_statistics OBJCStartupStatistics;
 
 static OBJCArray *OBJCObjectFileImageArray(void) {
     static OBJCArray *objectFileImageArray = NULL;
@@ -157,6 +158,7 @@ static void OBJCSymbolTableRegisterSelectors(OBJCSymbolTable *symbolTable) {
         while(objc_getSelectorReferenceName(selectorReferences) != NULL) {
             objc_setSelectorReferenceName(&selectorReferences, sel_registerNameNoCopy(objc_getSelectorReferenceName(selectorReferences)));
             selectorReferences++;
+            OBJCStartupStatistics.selectorReferences++;
         }
     }
 }
@@ -210,16 +212,9 @@ BOOL OBJCCheckClassIsResolved(Class class) {
     }
 }
 void OBJCSendLoadMessage(Class class) {
-
-    int i = 0;
-
-    for(; i < sentLoadMessageClassesSize; i++) {
-        if(sentLoadMessageClasses[i] == NULL) {
-            break;
-        } else if(sentLoadMessageClasses[i] == class) {
-            //message already sent
-            return;
-        }
+    if(class->info & CLASS_INFO_LOADED) {
+        //message already sent
+        return;
     }
 
     if(class->super_class != 0) {
@@ -227,33 +222,17 @@ void OBJCSendLoadMessage(Class class) {
         OBJCSendLoadMessage(class->super_class);
     }
 
-    //check for space and increase size if neeeded
-    if(i == sentLoadMessageClassesSize) {
-        int newCSize = 0;
-        if(sentLoadMessageClassesSize == 0) {
-            newCSize = INITIAL_CLASS_ARRAY_SIZE;
-        } else {
-            newCSize = 2 * sentLoadMessageClassesSize;
-        }
-        sentLoadMessageClasses = (Class *)realloc(sentLoadMessageClasses, newCSize * sizeof(Class));
-        for(int j = sentLoadMessageClassesSize; j < newCSize; j++) {
-            sentLoadMessageClasses[j] = NULL;
-        }
-        sentLoadMessageClasses[sentLoadMessageClassesSize] = class;
-        sentLoadMessageClassesSize = newCSize;
-    } else {
-        sentLoadMessageClasses[i] = class;
-    }
+    OBJCAtomicOr(&class->info, CLASS_INFO_LOADED);
 
-    SEL loadSelector = sel_registerName("load");
-    Method m = class_getClassMethod(class, loadSelector);
-    if(m) {
-        IMP imp = method_getImplementation(m);
-        if(imp) {
-            (*imp)((id) class, loadSelector);
-        }
+    IMP imp = OBJCLookupLoadMethod(class);
+    if(imp) {
+        unsigned long long start = OBJCNanoseconds();
+
+        (*imp)((id) class, sel_registerName("load"));
+        OBJCStartupStatistics.loadNanoseconds += OBJCNanoseconds() - start;
     }
 }
+
 void OBJCSendLoadMessages() {
 
     //until NSObject is not in runtime we don't need to check
@@ -294,8 +273,8 @@ static void OBJCSymbolTableRegisterClasses(OBJCSymbolTable *symbolTable) {
         struct objc_class *class = (struct objc_class *)symbolTable->definitions[i];
 
         // mark class and metaclass as having a direct method list pointer
-        class->info |= CLASS_NO_METHOD_ARRAY;
-        class->isa->info |= CLASS_NO_METHOD_ARRAY;
+        OBJCAtomicOr(&class->info, CLASS_NO_METHOD_ARRAY);
+        OBJCAtomicOr(&class->isa->info, CLASS_NO_METHOD_ARRAY);
 
         OBJCRegisterClass(class);
         OBJCAddToUnResolvedClasses(class);
@@ -419,8 +398,31 @@ static void OBJCSymbolTableRegisterProtocolsIfNeeded(OBJCSymbolTable *symbolTabl
 #endif
 }
 
+static void OBJCLogStartupStatistics(void) {
+    objc_startup_statistics stats;
+
+    objc_getStartupStatistics(&stats);
+    OBJCLog("startup: %lu modules, %lu classes registered in %.3f ms (+load %.3f ms), %lu selector references", stats.modules, stats.classesRegistered, stats.imageNanoseconds / 1e6, stats.loadNanoseconds / 1e6, stats.selectorReferences);
+    OBJCLog("startup: %lu classes realized in %.3f ms, %lu method selectors", stats.classesRealized, stats.realizeNanoseconds / 1e6, stats.methodSelectors);
+}
+
+void objc_getStartupStatistics(objc_startup_statistics *stats) {
+    *stats = OBJCStartupStatistics;
+}
+
 void OBJCQueueModule(OBJCModule *module) {
+    static BOOL checkedEnvironment = NO;
+
+    if(!checkedEnvironment) {
+        checkedEnvironment = YES;
+        if(getenv("OBJC_PRINT_STARTUP") != NULL)
+            atexit(OBJCLogStartupStatistics);
+    }
+
     if(module->symbolTable != NULL) {
+        unsigned long long start = OBJCNanoseconds();
+
+        OBJCStartupStatistics.modules++;
         OBJCArrayAdd(OBJCModuleQueue(), module);
         OBJCLinkModuleToActiveObjectFile(module);
         OBJCSymbolTableRegisterSelectors(module->symbolTable);
@@ -435,6 +437,7 @@ void OBJCQueueModule(OBJCModule *module) {
 #if !defined(__APPLE__)
         OBJCSendLoadMessages();
 #endif
+        OBJCStartupStatistics.imageNanoseconds += OBJCNanoseconds() - start;
     }
 }
 
@@ -8,6 +8,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #import "ObjCArray.h"
 #import "objc_sel.h"
+#import <objc/runtime.h>
+#import <time.h>
 
 typedef struct {
     unsigned long selectorCount;
@@ -35,4 +37,12 @@ typedef struct {
 } OBJCObjectFile;
 
 OBJC_EXPORT void OBJCQueueModule(OBJCModule *module);
-OBJC_EXPORT void OBJCSendLoadMessages();
\ No newline at end of file
+OBJC_EXPORT void OBJCSendLoadMessages();
+OBJC_EXPORT objc_startup_statistics OBJCStartupStatistics;
+
+static inline unsigned long long OBJCNanoseconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
@@ -7,6 +7,10 @@ struct objc_super {
 
 OBJC_EXPORT id objc_msgSend(id self, SEL selector, ...);
 OBJC_EXPORT id objc_msgSendSuper(struct objc_super *super, SEL op, ...);
+#ifdef __x86_64__
+// super->super_class is the class of the sending method, the search starts at its superclass
+OBJC_EXPORT id objc_msgSendSuper2(struct objc_super *super, SEL op, ...);
+#endif
 
 OBJC_EXPORT void objc_msgSend_stret(id self, SEL selector, ...);
 OBJC_EXPORT void objc_msgSendSuper_stret(struct objc_super *super, SEL selector, ...);
@@ -16,6 +16,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #define OBJC_TYPED_SELECTORS 1
 #endif
 
+// @try is unwound from the DWARF tables the compiler emits, see objc_exception_unwind.c. Only
+// clang emits them for Objective-C here, gcc 4.3 still uses objc_exception_try_enter.
+#if defined(__clang__) && defined(__linux__) && !defined(__USING_SJLJ_EXCEPTIONS__) && !defined(__arm__)
+#define OBJC_ZERO_COST_EXCEPTIONS 1
+#endif
+
 #else
 #define OBJC_DLLEXPORT __declspec(dllexport)
 #define OBJC_DLLIMPORT __declspec(dllimport)
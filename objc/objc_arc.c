@@ -1,157 +1,218 @@
 #import <objc/runtime.h>
+#import "objc_arc.h"
 #import "objc_tls.h"
 #import "objc_lock.h"
+#import "objc_atomic.h"
+#import "objc_cache.h"
 #import <objc/message.h>
 #import <pthread.h>
 
 typedef unsigned long objc_uinteger;
 typedef signed long objc_integer;
 
+// flags, an entry with any flag set stays in the table even when its count is back to 1
+#define RefCountWeaklyReferenced 0x1
+#define RefCountDeallocating 0x2
+
 typedef struct RefCountBucket {
     struct RefCountBucket *next;
     void *object;
     objc_uinteger count;
+    objc_uinteger flags;
+    id **referrers;
+    objc_uinteger referrerCount;
+    objc_uinteger referrerCapacity;
 } RefCountBucket;
 
+// Retain counts are kept in a side table split into shards by object address, each shard
+// has its own lock and bucket free list so unrelated objects don't contend and a retain
+// doesn't have to malloc. The shard count must be a power of 2.
+//
+// Zeroing weak references live in the same entries, the addresses of the weak variables
+// pointing at an object are its referrers. Sharing the shard lock with the retain count is
+// what makes objc_loadWeakRetained safe against a concurrent final release.
+#define RefCountShardCount 64
+#define RefCountShardMask (RefCountShardCount - 1)
+#define RefCountShardInitialBuckets 64
+
 typedef struct {
+    objc_lock lock;
     objc_uinteger count;
     objc_uinteger nBuckets;
     RefCountBucket **buckets;
-} RefCountTable;
+    RefCountBucket *freeBuckets;
+    // Number of weakly referenced objects in the shard, and one bit per object hash so
+    // dealloc of an object which was never weakly referenced can skip the lock. Bits are
+    // only cleared when weakObjects drops to 0.
+    objc_uinteger weakObjects;
+    volatile objc_uinteger weakFilter;
+} __attribute__((aligned(64))) RefCountShard;
 
-static objc_lock RefCountLock = 0;
+static RefCountShard RefCountShards[RefCountShardCount];
 
-static inline RefCountTable *CreateRefCountTable() {
-    RefCountTable *table;
+static inline objc_uinteger hashObject(id ptr) {
+    return (objc_uinteger)ptr >> 4;
+}
 
-    table = malloc(sizeof(RefCountTable));
-    table->count = 0;
-    table->nBuckets = 1024;
-    table->buckets = calloc(table->nBuckets, sizeof(RefCountBucket *));
+static inline RefCountShard *shardForObject(id object) {
+    objc_uinteger hash = hashObject(object);
 
-    return table;
+    return RefCountShards + ((hash ^ (hash >> 6)) & RefCountShardMask);
 }
 
-static inline RefCountBucket *AllocBucketFromTable(RefCountTable *table) {
-    return malloc(sizeof(RefCountBucket));
+// The low bits already selected the shard, don't reuse them for the bucket index
+static inline objc_uinteger bucketIndex(RefCountShard *shard, id object) {
+    return (hashObject(object) >> 6) & (shard->nBuckets - 1);
 }
 
-static inline void FreeBucketFromTable(RefCountTable *table, RefCountBucket *bucket) {
-    free(bucket);
+static inline objc_uinteger weakFilterBit(id object) {
+    return (objc_uinteger)1 << ((hashObject(object) >> 12) & 63);
 }
 
-static inline objc_uinteger hashObject(id ptr) {
-    return (objc_uinteger)ptr >> 4;
+static inline RefCountBucket *AllocBucketFromShard(RefCountShard *shard) {
+    RefCountBucket *result = shard->freeBuckets;
+
+    if(result != NULL)
+        shard->freeBuckets = result->next;
+    else
+        result = malloc(sizeof(RefCountBucket));
+
+    result->flags = 0;
+    result->referrers = NULL;
+    result->referrerCount = 0;
+    result->referrerCapacity = 0;
+
+    return result;
+}
+
+static inline void FreeBucketFromShard(RefCountShard *shard, RefCountBucket *bucket) {
+    free(bucket->referrers);
+    bucket->next = shard->freeBuckets;
+    shard->freeBuckets = bucket;
 }
 
-static inline RefCountBucket *XXHashGet(RefCountTable *table, id object) {
-    objc_uinteger i = hashObject(object) % table->nBuckets;
+static inline RefCountBucket *XXHashGet(RefCountShard *shard, id object) {
     RefCountBucket *check;
 
-    for(check = table->buckets[i]; check != NULL; check = check->next)
+    if(shard->buckets == NULL)
+        return NULL;
+
+    for(check = shard->buckets[bucketIndex(shard, object)]; check != NULL; check = check->next)
         if(check->object == object)
             return check;
 
     return NULL;
 }
 
-static inline void XXHashInsert(RefCountTable *table, RefCountBucket *insert) {
-    objc_uinteger hash = hashObject(insert->object);
-    objc_uinteger i = hash % table->nBuckets;
+static inline void XXHashInsert(RefCountShard *shard, RefCountBucket *insert) {
+    objc_uinteger i;
 
-    if(table->count >= table->nBuckets) {
-        objc_integer oldnBuckets = table->nBuckets;
-        RefCountBucket **buckets = table->buckets;
+    if(shard->buckets == NULL) {
+        shard->nBuckets = RefCountShardInitialBuckets;
+        shard->buckets = calloc(shard->nBuckets, sizeof(RefCountBucket *));
+    } else if(shard->count >= shard->nBuckets) {
+        objc_uinteger oldnBuckets = shard->nBuckets;
+        RefCountBucket **buckets = shard->buckets;
 
-        table->nBuckets = oldnBuckets * 2;
-        table->buckets = calloc(table->nBuckets, sizeof(RefCountBucket *));
+        shard->nBuckets = oldnBuckets * 2;
+        shard->buckets = calloc(shard->nBuckets, sizeof(RefCountBucket *));
         for(i = 0; i < oldnBuckets; i++) {
             RefCountBucket *check, *next;
 
             for(check = buckets[i]; check != NULL; check = next) {
-                objc_uinteger newi = hashObject(check->object) % table->nBuckets;
+                objc_uinteger newi = bucketIndex(shard, check->object);
                 next = check->next;
-                check->next = table->buckets[newi];
-                table->buckets[newi] = check;
+                check->next = shard->buckets[newi];
+                shard->buckets[newi] = check;
             }
         }
         free(buckets);
-        i = hash % table->nBuckets;
     }
 
-    insert->next = table->buckets[i];
-    table->buckets[i] = insert;
-    table->count++;
+    i = bucketIndex(shard, insert->object);
+    insert->next = shard->buckets[i];
+    shard->buckets[i] = insert;
+    shard->count++;
 }
 
-static inline void XXHashRemove(RefCountTable *table, RefCountBucket *remove) {
-    objc_uinteger i = hashObject(remove->object) % table->nBuckets;
-    RefCountBucket *check = table->buckets[i], *prev = check;
+static inline void XXHashRemove(RefCountShard *shard, RefCountBucket *remove) {
+    objc_uinteger i = bucketIndex(shard, remove->object);
+    RefCountBucket *check = shard->buckets[i], *prev = check;
 
     for(; check != NULL; check = check->next) {
         if(check == remove) {
             if(prev == check)
-                table->buckets[i] = check->next;
+                shard->buckets[i] = check->next;
             else
                 prev->next = check->next;
 
-            FreeBucketFromTable(table, check);
-            table->count--;
+            FreeBucketFromShard(shard, check);
+            shard->count--;
             return;
         }
         prev = check;
     }
 }
 
-static inline RefCountTable *refTable(void) {
-    static RefCountTable *refCountTable = NULL;
-
-    if(refCountTable == NULL)
-        refCountTable = CreateRefCountTable();
-
-    return refCountTable;
-}
-
 void objc_IncrementExtraRefCount(id object) {
+    RefCountShard *shard;
     RefCountBucket *refCount;
-    RefCountTable *table = refTable();
 
-    objc_lock_lock(&RefCountLock);
-    if((refCount = XXHashGet(table, object)) == NULL) {
-        refCount = AllocBucketFromTable(table);
+    if(objc_isTaggedPointer(object))
+        return;
+
+    shard = shardForObject(object);
+    objc_lock_lock(&shard->lock);
+    if((refCount = XXHashGet(shard, object)) == NULL) {
+        refCount = AllocBucketFromShard(shard);
         refCount->object = object;
         refCount->count = 1;
-        XXHashInsert(refTable(), refCount);
+        XXHashInsert(shard, refCount);
     }
     refCount->count++;
-    objc_lock_unlock(&RefCountLock);
+    objc_lock_unlock(&shard->lock);
 }
 
 bool objc_DecrementExtraRefCountWasZero(id object) {
+    RefCountShard *shard;
     bool result = false;
     RefCountBucket *refCount;
 
-    objc_lock_lock(&RefCountLock);
-    if((refCount = XXHashGet(refTable(), object)) == NULL)
+    if(objc_isTaggedPointer(object))
+        return false;
+
+    shard = shardForObject(object);
+    objc_lock_lock(&shard->lock);
+    if((refCount = XXHashGet(shard, object)) == NULL)
+        result = true;
+    else if(refCount->count == 1) {
+        // only in the table because it is weakly referenced, block objc_loadWeakRetained
+        refCount->flags |= RefCountDeallocating;
         result = true;
-    else {
+    } else {
         refCount->count--;
-        if(refCount->count == 1)
-            XXHashRemove(refTable(), refCount);
+        if(refCount->count == 1 && refCount->flags == 0)
+            XXHashRemove(shard, refCount);
     }
-    objc_lock_unlock(&RefCountLock);
+    objc_lock_unlock(&shard->lock);
 
     return result;
 }
 
 objc_uinteger objc_ExtraRefCount(id object) {
+    RefCountShard *shard;
     objc_uinteger result = 1;
     RefCountBucket *refCount;
 
-    objc_lock_lock(&RefCountLock);
-    if((refCount = XXHashGet(refTable(), object)) != NULL)
+    // never deallocated, same as the retain count of a constant object
+    if(objc_isTaggedPointer(object))
+        return ~(objc_uinteger)0 >> 1;
+
+    shard = shardForObject(object);
+    objc_lock_lock(&shard->lock);
+    if((refCount = XXHashGet(shard, object)) != NULL)
         result = refCount->count;
-    objc_lock_unlock(&RefCountLock);
+    objc_lock_unlock(&shard->lock);
 
     return result;
 }
@@ -168,12 +229,234 @@ unsigned long object_externalRefCount(id value) {
     return objc_ExtraRefCount(value);
 }
 
+static void RefCountLockShards(RefCountShard *a, RefCountShard *b) {
+    if(a == NULL || a == b)
+        objc_lock_lock(&b->lock);
+    else if(b == NULL)
+        objc_lock_lock(&a->lock);
+    else if(a < b) {
+        objc_lock_lock(&a->lock);
+        objc_lock_lock(&b->lock);
+    } else {
+        objc_lock_lock(&b->lock);
+        objc_lock_lock(&a->lock);
+    }
+}
+
+static void RefCountUnlockShards(RefCountShard *a, RefCountShard *b) {
+    if(a != NULL)
+        objc_lock_unlock(&a->lock);
+    if(b != NULL && b != a)
+        objc_lock_unlock(&b->lock);
+}
+
+// shard must be locked, returns false if object is already being deallocated
+static bool WeakRegisterReferrer(RefCountShard *shard, id object, id *location) {
+    RefCountBucket *refCount;
+
+    if((refCount = XXHashGet(shard, object)) == NULL) {
+        refCount = AllocBucketFromShard(shard);
+        refCount->object = object;
+        refCount->count = 1;
+        XXHashInsert(shard, refCount);
+    }
+
+    if(refCount->flags & RefCountDeallocating)
+        return false;
+
+    if(refCount->referrerCount >= refCount->referrerCapacity) {
+        refCount->referrerCapacity = (refCount->referrerCapacity == 0) ? 4 : refCount->referrerCapacity * 2;
+        refCount->referrers = realloc(refCount->referrers, refCount->referrerCapacity * sizeof(id *));
+    }
+    refCount->referrers[refCount->referrerCount++] = location;
+
+    if(!(refCount->flags & RefCountWeaklyReferenced)) {
+        refCount->flags |= RefCountWeaklyReferenced;
+        shard->weakObjects++;
+        OBJCAtomicOr(&shard->weakFilter, weakFilterBit(object));
+    }
+
+    return true;
+}
+
+// shard must be locked
+static void WeakUnregisterReferrer(RefCountShard *shard, id object, id *location) {
+    RefCountBucket *refCount = XXHashGet(shard, object);
+    objc_uinteger i;
+
+    if(refCount == NULL)
+        return;
+
+    for(i = 0; i < refCount->referrerCount; i++)
+        if(refCount->referrers[i] == location) {
+            refCount->referrers[i] = refCount->referrers[--refCount->referrerCount];
+            break;
+        }
+
+    // a deallocating object keeps its entry until object_clearWeakReferences
+    if(refCount->referrerCount == 0 && refCount->flags == RefCountWeaklyReferenced) {
+        refCount->flags = 0;
+        if(--shard->weakObjects == 0)
+            shard->weakFilter = 0;
+        if(refCount->count == 1)
+            XXHashRemove(shard, refCount);
+    }
+}
+
+id objc_storeWeak(id *location, id value) {
+    for(;;) {
+        id old = *(id volatile *)location;
+        // tagged pointers never go away, they are stored like nil without a registration
+        RefCountShard *oldShard = (old == nil || objc_isTaggedPointer(old)) ? NULL : shardForObject(old);
+        RefCountShard *newShard = (value == nil || objc_isTaggedPointer(value)) ? NULL : shardForObject(value);
+        id result = value;
+
+        if(oldShard == NULL && newShard == NULL) {
+            *location = value;
+            return value;
+        }
+
+        RefCountLockShards(oldShard, newShard);
+        // a concurrent store changed it before we got the locks
+        if(*(id volatile *)location != old) {
+            RefCountUnlockShards(oldShard, newShard);
+            continue;
+        }
+
+        if(oldShard != NULL)
+            WeakUnregisterReferrer(oldShard, old, location);
+        if(newShard != NULL && !WeakRegisterReferrer(newShard, value, location))
+            result = nil;
+
+        *location = result;
+        RefCountUnlockShards(oldShard, newShard);
+
+        return result;
+    }
+}
+
+id objc_initWeak(id *location, id value) {
+    *location = nil;
+    return objc_storeWeak(location, value);
+}
+
+void objc_destroyWeak(id *location) {
+    objc_storeWeak(location, nil);
+}
+
+id objc_loadWeakRetained(id *location) {
+    for(;;) {
+        id value = *(id volatile *)location;
+        RefCountShard *shard;
+        RefCountBucket *refCount;
+
+        if(value == nil || objc_isTaggedPointer(value))
+            return value;
+
+        shard = shardForObject(value);
+        objc_lock_lock(&shard->lock);
+        if(*(id volatile *)location != value) {
+            objc_lock_unlock(&shard->lock);
+            continue;
+        }
+
+        // a registered weak reference always has an entry
+        refCount = XXHashGet(shard, value);
+        if(refCount == NULL || (refCount->flags & RefCountDeallocating))
+            value = nil;
+        else
+            refCount->count++;
+        objc_lock_unlock(&shard->lock);
+
+        return value;
+    }
+}
+
+id objc_loadWeak(id *location) {
+    id value = objc_loadWeakRetained(location);
+
+    return (value == nil) ? nil : objc_autorelease(value);
+}
+
+void objc_copyWeak(id *to, id *from) {
+    id value = objc_loadWeakRetained(from);
+
+    objc_initWeak(to, value);
+    if(value != nil)
+        objc_release(value);
+}
+
+void objc_moveWeak(id *to, id *from) {
+    for(;;) {
+        id value = *(id volatile *)from;
+        RefCountShard *shard;
+        RefCountBucket *refCount;
+        objc_uinteger i;
+
+        if(value == nil || objc_isTaggedPointer(value)) {
+            *to = value;
+            *from = nil;
+            return;
+        }
+
+        shard = shardForObject(value);
+        objc_lock_lock(&shard->lock);
+        if(*(id volatile *)from != value) {
+            objc_lock_unlock(&shard->lock);
+            continue;
+        }
+
+        // hand the registration over, even if value is deallocating it will clear *to
+        if((refCount = XXHashGet(shard, value)) != NULL)
+            for(i = 0; i < refCount->referrerCount; i++)
+                if(refCount->referrers[i] == from) {
+                    refCount->referrers[i] = to;
+                    break;
+                }
+        *to = value;
+        *from = nil;
+        objc_lock_unlock(&shard->lock);
+        return;
+    }
+}
+
+void object_clearWeakReferences(id object) {
+    RefCountShard *shard;
+    RefCountBucket *refCount;
+    objc_uinteger i;
+
+    if(objc_isTaggedPointer(object))
+        return;
+
+    shard = shardForObject(object);
+    if(!(OBJCAtomicLoadRelaxed(&shard->weakFilter) & weakFilterBit(object)))
+        return;
+
+    objc_lock_lock(&shard->lock);
+    if((refCount = XXHashGet(shard, object)) != NULL && (refCount->flags & RefCountWeaklyReferenced)) {
+        for(i = 0; i < refCount->referrerCount; i++)
+            if(*refCount->referrers[i] == object)
+                *refCount->referrers[i] = nil;
+
+        if(--shard->weakObjects == 0)
+            shard->weakFilter = 0;
+        XXHashRemove(shard, refCount);
+    }
+    objc_lock_unlock(&shard->lock);
+}
+
 id objc_retain(id value) {
+    if(value == nil || objc_isTaggedPointer(value))
+        return value;
+
     objc_IncrementExtraRefCount(value);
     return value;
 }
 
 void objc_release(id value) {
+    if(value == nil || objc_isTaggedPointer(value))
+        return;
+
     if(objc_DecrementExtraRefCountWasZero(value)) {
         static SEL selector = NULL;
 
@@ -186,93 +469,191 @@ void objc_release(id value) {
     }
 }
 
-static objc_autoreleasepool *objc_autoreleaseCurrentPool() {
-    return objc_tlsCurrent()->pool;
+/* Autorelease pools are a per-thread stack of fixed size pages. A push stores a nil
+   boundary marker and returns its address, a pop releases everything above the marker.
+   Neither allocates once the thread has a page, an emptied page stays linked as the child
+   of the hot page so the next overflow reuses it.
+ */
+#define OBJCAutoreleasePageBytes 4096
+
+static inline id *OBJCAutoreleasePageEnd(objc_autoreleasepage *page) {
+    return (id *)((char *)page + OBJCAutoreleasePageBytes);
 }
 
-static void objc_autoreleaseSetCurrentPool(objc_autoreleasepool *pool) {
-    objc_tlsCurrent()->pool = pool;
+static objc_autoreleasepage *OBJCAutoreleasePageNew(objc_autoreleasepage *parent) {
+    objc_autoreleasepage *page = malloc(OBJCAutoreleasePageBytes);
+
+    page->parent = parent;
+    page->child = NULL;
+    page->next = page->slots;
+    if(parent != NULL)
+        parent->child = page;
+
+    return page;
 }
 
-#define PAGESIZE 1024
+static id *OBJCAutoreleasePageAddSlow(objc_tls *tls, id object) {
+    objc_autoreleasepage *page = tls->pool;
 
-void *objc_autoreleasePoolPush() {
-    objc_autoreleasepool *current = objc_autoreleaseCurrentPool();
-    objc_autoreleasepool *pool = malloc(sizeof(objc_autoreleasepool));
+    if(page == NULL)
+        page = OBJCAutoreleasePageNew(NULL);
+    else if(page->child != NULL)
+        page = page->child;
+    else
+        page = OBJCAutoreleasePageNew(page);
 
-    pool->_parent = current;
+    tls->pool = page;
+    *page->next = object;
+    return page->next++;
+}
 
-    pool->_pageCount = 1;
-    pool->_pages = malloc(pool->_pageCount * sizeof(id *));
-    pool->_pages[0] = malloc(PAGESIZE * sizeof(id));
-    pool->_nextSlot = 0;
+static inline id *OBJCAutoreleasePageAdd(objc_tls *tls, id object) {
+    objc_autoreleasepage *page = tls->pool;
 
-    if(current != NULL)
-        current->_childPool = pool;
-    pool->_childPool = NULL;
+    if(page != NULL && page->next < OBJCAutoreleasePageEnd(page)) {
+        *page->next = object;
+        return page->next++;
+    }
 
-    objc_autoreleaseSetCurrentPool(pool);
+    return OBJCAutoreleasePageAddSlow(tls, object);
+}
 
-    return pool;
+void objc_autoreleaseNoPool(id object) {
+    //  NSCLog("autorelease pool is nil, leaking %x %s",object,object_getClassName(object));
+}
+
+static inline void OBJCAutoreleaseInThread(objc_tls *tls, id object) {
+    objc_autoreleasepage *page = tls->pool;
+
+    // every pool starts with a marker, an empty root page means no pool
+    if(page == NULL || (page->parent == NULL && page->next == page->slots))
+        objc_autoreleaseNoPool(object);
+    else
+        OBJCAutoreleasePageAdd(tls, object);
 }
 
-void objc_autoreleasePoolPop(void *poolX) {
-    objc_autoreleasepool *pool = poolX;
-    int i;
+// The return value handed off by objc_autoreleaseReturnValue is owed an autorelease
+static inline void OBJCAutoreleaseFlushReturnValue(objc_tls *tls) {
+    id pending = tls->returnValue;
 
-    if(pool == NULL)
+    if(pending != nil) {
+        tls->returnValue = nil;
+        OBJCAutoreleaseInThread(tls, pending);
+    }
+}
+
+void *objc_autoreleasePoolPush() {
+    objc_tls *tls = objc_tlsCurrent();
+
+    OBJCAutoreleaseFlushReturnValue(tls);
+
+    return OBJCAutoreleasePageAdd(tls, nil);
+}
+
+void objc_autoreleasePoolPop(void *token) {
+    objc_tls *tls = objc_tlsCurrent();
+    id *stop = token;
+    objc_autoreleasepage *page;
+
+    if(stop == NULL || tls->pool == NULL)
         return;
 
-    objc_autoreleasePoolPop(pool->_childPool);
+    OBJCAutoreleaseFlushReturnValue(tls);
 
-    for(i = 0; i < pool->_nextSlot; i++) {
-        //      NS_DURING
-        id object = pool->_pages[i / PAGESIZE][i % PAGESIZE];
+    // one object at a time from the top, releases can autorelease more objects
+    for(;;) {
+        bool onPage;
+        id object;
 
-        objc_release(object);
+        page = tls->pool;
+        onPage = (stop >= page->slots && stop < OBJCAutoreleasePageEnd(page));
 
-        //    NS_HANDLER
-        //   NSLog("Exception while autoreleasing %@",localException);
-        //  NS_ENDHANDLER
-    }
+        if(onPage && page->next <= stop)
+            break;
 
-    for(i = 0; i < pool->_pageCount; i++)
-        free(pool->_pages[i]);
+        if(!onPage && page->next == page->slots) {
+            // a token which isn't on the stack anymore
+            if(page->parent == NULL)
+                break;
+            tls->pool = page->parent;
+            continue;
+        }
 
-    free(pool->_pages);
+        object = *--page->next;
+        if(object != nil)
+            objc_release(object);
+    }
 
-    objc_autoreleaseSetCurrentPool(pool->_parent);
+    // keep one empty page for reuse, free the rest
+    page = tls->pool->child;
+    if(page != NULL) {
+        objc_autoreleasepage *check, *next;
 
-    if(pool->_parent != NULL)
-        pool->_parent->_childPool = NULL;
+        for(check = page->child; check != NULL; check = next) {
+            next = check->child;
+            free(check);
+        }
+        page->child = NULL;
+    }
 
-    free(pool);
+    OBJCCacheQuiescentPoint();
 }
 
-void objc_autoreleaseNoPool(id object) {
-    //  NSCLog("autorelease pool is nil, leaking %x %s",object,object_getClassName(object));
+// objects always go to the innermost pool
+void objc_autoreleasePoolAdd(void *pool, id object) {
+    objc_autorelease(object);
 }
 
-void objc_autoreleasePoolAdd(objc_autoreleasepool *pool, id object) {
-    if(pool->_nextSlot >= pool->_pageCount * PAGESIZE) {
-        pool->_pageCount++;
-        pool->_pages = realloc(pool->_pages, pool->_pageCount * sizeof(id *));
-        pool->_pages[pool->_pageCount - 1] = malloc(PAGESIZE * sizeof(id));
-    }
+id objc_autorelease(id object) {
+    objc_tls *tls;
 
-    pool->_pages[pool->_nextSlot / PAGESIZE][pool->_nextSlot % PAGESIZE] = object;
-    pool->_nextSlot++;
+    if(objc_isTaggedPointer(object))
+        return object;
+
+    tls = objc_tlsCurrent();
+
+    OBJCAutoreleaseFlushReturnValue(tls);
+    OBJCAutoreleaseInThread(tls, object);
+
+    return object;
 }
 
-id objc_autorelease(id object) {
-    objc_autoreleasepool *pool = objc_autoreleaseCurrentPool();
+/* The object is parked in the thread state instead of the pool. If the caller retains
+   it right away with objc_retainAutoreleasedReturnValue the autorelease and retain cancel
+   out, otherwise it is autoreleased for real by the next autorelease, push or pop on
+   this thread, which is indistinguishable from having been autoreleased now.
+ */
+id objc_autoreleaseReturnValue(id object) {
+    objc_tls *tls;
 
-    if(pool == NULL) {
-        objc_autoreleaseNoPool(object);
+    if(object == nil || objc_isTaggedPointer(object))
         return object;
-    }
 
-    objc_autoreleasePoolAdd(pool, object);
+    tls = objc_tlsCurrent();
+    OBJCAutoreleaseFlushReturnValue(tls);
+    tls->returnValue = object;
 
     return object;
 }
+
+id objc_retainAutoreleasedReturnValue(id object) {
+    objc_tls *tls;
+
+    if(object == nil || objc_isTaggedPointer(object))
+        return object;
+
+    tls = objc_tlsCurrent();
+    if(tls->returnValue == object) {
+        tls->returnValue = nil;
+        return object;
+    }
+
+    return objc_retain(object);
+}
+
+id objc_retainAutoreleaseReturnValue(id object) {
+    if(object == nil)
+        return nil;
+
+    return objc_autoreleaseReturnValue(objc_retain(object));
+}
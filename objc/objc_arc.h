@@ -3,8 +3,28 @@
 
 OBJC_EXPORT id objc_retain(id value);
 OBJC_EXPORT void objc_release(id value);
+OBJC_EXPORT id objc_autorelease(id value);
+
+OBJC_EXPORT void *objc_autoreleasePoolPush(void);
+OBJC_EXPORT void objc_autoreleasePoolPop(void *pool);
+OBJC_EXPORT void objc_autoreleasePoolAdd(void *pool, id value);
+
+// Lets an autoreleased return value be retained by the caller without going through the pool
+OBJC_EXPORT id objc_autoreleaseReturnValue(id value);
+OBJC_EXPORT id objc_retainAutoreleasedReturnValue(id value);
+OBJC_EXPORT id objc_retainAutoreleaseReturnValue(id value);
+
+// Zeroing weak references, location is cleared when the object is deallocated
+OBJC_EXPORT id objc_storeWeak(id *location, id value);
+OBJC_EXPORT id objc_initWeak(id *location, id value);
+OBJC_EXPORT void objc_destroyWeak(id *location);
+OBJC_EXPORT id objc_loadWeakRetained(id *location);
+OBJC_EXPORT id objc_loadWeak(id *location);
+OBJC_EXPORT void objc_copyWeak(id *to, id *from);
+OBJC_EXPORT void objc_moveWeak(id *to, id *from);
 
 // Private to CF/Foundation/objc
 OBJC_EXPORT void object_incrementExternalRefCount(id value);
 OBJC_EXPORT bool object_decrementExternalRefCount(id value);
 OBJC_EXPORT unsigned long object_externalRefCount(id value);
+OBJC_EXPORT void object_clearWeakReferences(id object);
@@ -1,355 +1,328 @@
 #import <objc/runtime.h>
 #import <Foundation/NSObject.h>
-#import <Foundation/NSObject.h>
-#ifdef WIN32
-#include <windows.h>
-#else
-#include <unistd.h>
-#endif
+#import "objc_lock.h"
+#import "objc_atomic.h"
+#import "objc_malloc.h"
+#import "objc_cache.h"
+#include <string.h>
+
+typedef unsigned long objc_uinteger;
+
+// Associations are kept in a side table split into shards by object address like the retain
+// counts in objc_arc.c. Each shard is an open addressed table from object to the array of that
+// object's associations. Readers never lock: a writer fills in an entry before publishing it
+// and replaces, rather than edits, anything a reader may be walking. Writers take the shard
+// lock. The replaced memory goes on the shard's retired list, tagged with a method cache
+// epoch, and is freed by a later writer once every thread has been through a quiescent point.
+// The retired list is bounded like the method cache one, past the limit the oldest entries
+// are leaked.
+//
+// A key set to nil keeps its entry with a nil value so entries never move under a reader.
 
-// the cache entry size must be a power of 2
 typedef struct {
-    void                    *nextEntry;
-    const void              *key;
-    id                      object;
+    const void *key;
+    id volatile value;
     objc_AssociationPolicy policy;
-} AssociationObjectEntry;
-
-#define BucketsInitialSize 509 // Some prime size (and as a bonus, next three n*2+1 are prime too)
-#define AssociationObjectEntrySize    5
+} AssociationEntry;
 
-#define HASHPTR(p) (((unsigned int)p)>>5)
+typedef struct {
+    objc_uinteger count; // entries readers may look at
+    objc_uinteger capacity;
+    AssociationEntry entries[1];
+} AssociationMap;
 
-typedef struct AssociationHashBucket {
-    struct AssociationHashBucket    *next;
-    id                              key;
-    AssociationObjectEntry          *value;
-} AssociationHashBucket;
+typedef struct {
+    id volatile object;
+    AssociationMap *volatile map;
+} AssociationSlot;
 
-typedef struct AssociationTable {
-    unsigned int              count;
-    unsigned int              nBuckets;
-    AssociationHashBucket **buckets;
+typedef struct {
+    objc_uinteger mask;
+    objc_uinteger used; // live and removed slots, the probe length depends on both
+    AssociationSlot slots[1];
 } AssociationTable;
 
-AssociationTable *CreateAssociationTable(unsigned int capacity) {
-    AssociationTable *table=malloc(sizeof(AssociationTable));
+// marks a slot whose object's associations were removed, probes continue past it
+#define AssociationRemovedObject ((id)(uintptr_t)1)
 
-    table->count=0;
-    table->nBuckets=(capacity<5)?5:capacity;
-    table->buckets=calloc(table->nBuckets,sizeof(AssociationHashBucket *));
-    
-    return table;
+#define AssociationShardCount 64 // power of 2
+#define AssociationShardMask (AssociationShardCount - 1)
+#define AssociationTableInitialSize 16 // power of 2
+#define AssociationMapInitialCapacity 4
+#define AssociationRetiredLimit 64
+
+typedef struct AssociationRetired {
+    struct AssociationRetired *next;
+    void *memory;
+    uintptr_t epoch;
+} AssociationRetired;
+
+typedef struct {
+    objc_lock lock;
+    AssociationTable *volatile table;
+    AssociationRetired *retired; // newest first
+    // Number of objects with associations in the shard, and one bit per object hash so dealloc of
+    // an object which never had associations can skip the shard. Bits are only cleared when
+    // objects drops to 0.
+    objc_uinteger objects;
+    volatile objc_uinteger filter;
+} __attribute__((aligned(64))) AssociationShard;
+
+static AssociationShard AssociationShards[AssociationShardCount];
+
+static inline objc_uinteger hashObject(id object) {
+    return (objc_uinteger)object >> 4;
 }
 
-AssociationObjectEntry *AssociationTableGet(AssociationTable *table,id key){
-    unsigned int i=HASHPTR(key)%table->nBuckets;
-    AssociationHashBucket *j;
-    
-    for(j=table->buckets[i];j!=NULL;j=j->next)
-        if(j->key==key)
-            return j->value;
-    
-    return NULL;
+static inline AssociationShard *shardForObject(id object) {
+    objc_uinteger hash = hashObject(object);
+
+    return AssociationShards + ((hash ^ (hash >> 6)) & AssociationShardMask);
 }
 
+// The low bits already selected the shard, don't reuse them for the slot index
+static inline objc_uinteger slotIndex(AssociationTable *table, id object) {
+    return (hashObject(object) >> 6) & table->mask;
+}
 
-void AssociationTableInsert(AssociationTable *table,id key, AssociationObjectEntry *value){
-    unsigned int        hash=HASHPTR(key);
-    unsigned int        i=hash%table->nBuckets;
-    AssociationHashBucket *j;
-    
-    for(j=table->buckets[i];j!=NULL;j=j->next) {
-        if(j->key==key){
-            AssociationObjectEntry *oldValue=j->value;
-            
-            j->value=value;
-            
-            free(oldValue);
-            return;
-        }
-    }
-    int newSize = 0;
-    if (table->count>=table->nBuckets) {
-        // Expand the buckets size to limit collisions
-        newSize=table->nBuckets*2+1; // Let"s use odd size
-    } else if (table->count > BucketsInitialSize && table->count < table->nBuckets/2) {
-        // Compact the table - plenty of free room
-        newSize=table->nBuckets/2;
-        if (newSize%2) {
-            // Let"s use odd size
-            newSize+=1;
-        }
-    }
-    if(newSize != 0){
-        unsigned int         nBuckets=table->nBuckets;
-        AssociationHashBucket **buckets=table->buckets;
-        
-        table->nBuckets=newSize;
-        table->buckets=calloc(table->nBuckets,sizeof(AssociationHashBucket *));
-        
-        // Get all of the existing buckets and place them into the new list
-        for(i=0;i<nBuckets;i++) {
-            j = buckets[i];
-            while (j) {
-                unsigned int newi=HASHPTR(j->key)%table->nBuckets;
-                
-                AssociationHashBucket *next = j->next;
-                j->next=table->buckets[newi];
-                table->buckets[newi]=j;
-
-                j = next;
-            }
-        }
-        free(buckets);
-        i=hash%table->nBuckets;
+static inline objc_uinteger filterBit(id object) {
+    return (objc_uinteger)1 << ((hashObject(object) >> 12) & 63);
+}
+
+static AssociationSlot *AssociationTableFind(AssociationTable *table, id object) {
+    objc_uinteger index;
+
+    if(table == NULL)
+        return NULL;
+
+    for(index = slotIndex(table, object);; index = (index + 1) & table->mask) {
+        AssociationSlot *slot = table->slots + index;
+        id check = OBJCAtomicLoad(&slot->object);
+
+        if(check == object)
+            return slot;
+        if(check == nil)
+            return NULL;
     }
-    
-    j=malloc(sizeof(AssociationHashBucket));
-    j->key=key;
-    j->value=value;
-    j->next=table->buckets[i];
-    table->buckets[i]=j;
-    table->count++;
 }
 
-void *AssociationTableInsertIfAbsent(AssociationTable *table, id key, AssociationObjectEntry *value){
-    void *old=AssociationTableGet(table,key);
-    
-    if(old!=NULL)
-        return old;
-    AssociationTableInsert(table,key,value);
-    return NULL;
+static AssociationMap *AssociationMapLookup(id object) {
+    AssociationShard *shard = shardForObject(object);
+    AssociationSlot *slot;
+
+    OBJCCacheRegisterReader();
+    slot = AssociationTableFind(OBJCAtomicLoad(&shard->table), object);
+
+    return (slot == NULL) ? NULL : OBJCAtomicLoad(&slot->map);
 }
 
-typedef unsigned int AssociationSpinLock;
-
-void AssociationSpinLockLock( volatile AssociationSpinLock *__lock )
-{
-    while(!__sync_bool_compare_and_swap(__lock, 0, 1))
-    {
-#ifdef WIN32
-        Sleep(0);
-#else
-        usleep(1);
-#endif
+// shard lock held
+static void AssociationRetire(AssociationShard *shard, void *memory) {
+    AssociationRetired *retired = objc_malloc(sizeof(AssociationRetired)), **check;
+    objc_uinteger count = 0;
+    uintptr_t oldest;
+
+    retired->memory = memory;
+    retired->epoch = OBJCCacheAdvanceEpoch();
+    retired->next = shard->retired;
+    shard->retired = retired;
+
+    oldest = OBJCCacheOldestEpoch();
+    for(check = &shard->retired; *check != NULL;) {
+        retired = *check;
+
+        if(retired->epoch <= oldest || count == AssociationRetiredLimit) {
+            *check = retired->next;
+            if(retired->epoch <= oldest)
+                objc_free(retired->memory);
+            objc_free(retired);
+        } else {
+            check = &retired->next;
+            count++;
+        }
     }
 }
 
-void AssociationSpinLockUnlock( volatile AssociationSpinLock *__lock )
-{
-    __sync_bool_compare_and_swap(__lock, 1, 0);
+static AssociationTable *AssociationTableCreate(objc_uinteger size) {
+    AssociationTable *result = objc_calloc(1, sizeof(AssociationTable) + (size - 1) * sizeof(AssociationSlot));
+
+    result->mask = size - 1;
+
+    return result;
 }
 
-static AssociationSpinLock AssociationLock=0;
-static AssociationTable *associationTable = NULL;
-
-
-void AssociationTableRemove(AssociationTable *table,id key){
-    AssociationSpinLockLock(&AssociationLock);
-    
-    unsigned int i=HASHPTR(key)%table->nBuckets;
-    AssociationHashBucket *j=table->buckets[i],*prev=j;
-
-    for(;j!=NULL;j=j->next){
-        if(j->key==key){
-            // array to keep track of the objects to release - that must be done outside of the lock
-            // since the release can trigger more association changes
-            int releaseCount = 0;
-            int releaseTableSize = 0;
-            id *objectsToRelease = NULL;
-            
-            if(prev==j)
-                table->buckets[i]=j->next;
-            else
-                prev->next=j->next;
-            
-            AssociationObjectEntry *entry = j->value;
-
-            for (int i = 0; i < AssociationObjectEntrySize; i++) {
-                AssociationObjectEntry *e = entry + i;
-                while (e) {
-                    switch (e->policy) {
-                        case OBJC_ASSOCIATION_ASSIGN:
-                            break;
-                        case OBJC_ASSOCIATION_RETAIN_NONATOMIC:
-                        case OBJC_ASSOCIATION_RETAIN:
-                        case OBJC_ASSOCIATION_COPY_NONATOMIC:
-                        case OBJC_ASSOCIATION_COPY:
-                            if (releaseCount >= releaseTableSize) {
-                                if (releaseTableSize == 0) {
-                                    releaseTableSize = 8;
-                                } else {
-                                    releaseTableSize *= 2;
-                                }
-                                objectsToRelease = realloc(objectsToRelease, sizeof(id)*releaseTableSize);
-                            }
-                            objectsToRelease[releaseCount++] = e->object;
-                            break;
-                    }
-                    AssociationObjectEntry *currentEntry = e;
-                    e = e->nextEntry;
-                    // Don't free the first entry of the list - it's part of the "entry" block that will be freed after the loop
-                    if (currentEntry != entry + i) {
-                        free(currentEntry);
-                    }
-                }
+// shard lock held, rehashes into a new table when the live and removed slots pass 3/4
+static AssociationSlot *AssociationTableInsert(AssociationShard *shard, id object, AssociationMap *map) {
+    AssociationTable *table = shard->table;
+    AssociationSlot *slot;
+    objc_uinteger index;
+
+    if(table == NULL)
+        OBJCAtomicStore(&shard->table, table = AssociationTableCreate(AssociationTableInitialSize));
+    else if((table->used + 1) * 4 > (table->mask + 1) * 3) {
+        objc_uinteger size = AssociationTableInitialSize, i;
+        AssociationTable *rehashed;
+
+        while((shard->objects + 1) * 2 > size)
+            size *= 2;
+
+        rehashed = AssociationTableCreate(size);
+        for(i = 0; i <= table->mask; i++) {
+            id check = table->slots[i].object;
+
+            if(check != nil && check != AssociationRemovedObject) {
+                for(index = slotIndex(rehashed, check); rehashed->slots[index].object != nil; index = (index + 1) & rehashed->mask)
+                    ;
+                rehashed->slots[index] = table->slots[i];
+                rehashed->used++;
             }
-            
-            free(entry);
-            free(j);
-            table->count--;
-            
-            AssociationSpinLockUnlock(&AssociationLock);
-
-            // Do the cleaning outside of the lock since it might trigger more association playing
-            for (int i = 0; i < releaseCount; ++i) {
-                [objectsToRelease[i] release];
-            }
-            free(objectsToRelease);
-            
-            return;
         }
-        prev=j;
+
+        OBJCAtomicStore(&shard->table, rehashed);
+        AssociationRetire(shard, table);
+        table = rehashed;
     }
-    AssociationSpinLockUnlock(&AssociationLock);
+
+    for(index = slotIndex(table, object); table->slots[index].object != nil; index = (index + 1) & table->mask)
+        ;
+
+    slot = table->slots + index;
+    slot->map = map;
+    OBJCAtomicStore(&slot->object, object);
+    table->used++;
+    shard->objects++;
+    OBJCAtomicOr(&shard->filter, filterBit(object));
+
+    return slot;
 }
 
-void objc_removeAssociatedObjects(id object)
-{
-    if (associationTable == NULL) {
-        return;
-    }
-    AssociationTableRemove(associationTable, object);
-    
+static AssociationMap *AssociationMapCreate(objc_uinteger capacity) {
+    AssociationMap *result = objc_calloc(1, sizeof(AssociationMap) + (capacity - 1) * sizeof(AssociationEntry));
+
+    result->capacity = capacity;
+
+    return result;
 }
 
-void objc_setAssociatedObject(id object, const void *key, id value, objc_AssociationPolicy policy)
-{
-    AssociationSpinLockLock(&AssociationLock);
+static id AssociationRetainValue(id value, objc_AssociationPolicy policy) {
+    switch(policy) {
+        case OBJC_ASSOCIATION_ASSIGN:
+            return value;
 
-    if (associationTable == NULL) {
-        associationTable = CreateAssociationTable(BucketsInitialSize);
-    }
-    
-    AssociationObjectEntry   *objectTable = AssociationTableGet(associationTable, object);
-    if (objectTable == NULL) {
-        objectTable = calloc(sizeof(AssociationObjectEntry), AssociationObjectEntrySize);
-        AssociationTableInsert(associationTable, object, objectTable);
-    }
-    
-    uintptr_t               index = HASHPTR(key) % AssociationObjectEntrySize;
-    AssociationObjectEntry *entry = ((AssociationObjectEntry *)objectTable) + index;
-    if (entry->object == nil) {
-        entry->policy = policy;
-        entry->key = key;
-        switch (policy) {
-            case OBJC_ASSOCIATION_ASSIGN:
-                entry->object = value;
-                break;
-            case OBJC_ASSOCIATION_RETAIN_NONATOMIC:
-            case OBJC_ASSOCIATION_RETAIN:
-                entry->object = [value retain];
-                break;
-            case OBJC_ASSOCIATION_COPY_NONATOMIC:
-            case OBJC_ASSOCIATION_COPY:
-                entry->object = [value copy];
-                break;
-        }
-    }
-    else {
-        AssociationObjectEntry *newEntry;
-        do {
-            if (entry->key == key) {
-                id objectToRelease = nil;
-                
-                switch (entry->policy) {
-                    case OBJC_ASSOCIATION_ASSIGN:
-                        break;
-                    case OBJC_ASSOCIATION_RETAIN_NONATOMIC:
-                    case OBJC_ASSOCIATION_RETAIN:
-                    case OBJC_ASSOCIATION_COPY_NONATOMIC:
-                    case OBJC_ASSOCIATION_COPY:
-                        objectToRelease = entry->object;
-                        break;
-                }
-                entry->policy = policy;
-                switch (policy) {
-                    case OBJC_ASSOCIATION_ASSIGN:
-                        entry->object = value;
-                        break;
-                    case OBJC_ASSOCIATION_RETAIN_NONATOMIC:
-                    case OBJC_ASSOCIATION_RETAIN:
-                        entry->object = [value retain];
-                        break;
-                    case OBJC_ASSOCIATION_COPY_NONATOMIC:
-                    case OBJC_ASSOCIATION_COPY:
-                        entry->object = [value copy];
-                        break;
-                }
-                AssociationSpinLockUnlock(&AssociationLock);
-                
-                // Do the cleaning outside of the lock since it might trigger more association playing
-                [objectToRelease release];
-
-                return;
-            }
-            if (entry->nextEntry != nil) {
-                entry = entry->nextEntry;
-            }
-        } while (entry->nextEntry != nil);
-        
-        newEntry = malloc(sizeof(AssociationObjectEntry));
-        newEntry->policy = policy;
-        newEntry->key = key;
-        switch (policy) {
-            case OBJC_ASSOCIATION_ASSIGN:
-                newEntry->object = value;
-                break;
-            case OBJC_ASSOCIATION_RETAIN_NONATOMIC:
-            case OBJC_ASSOCIATION_RETAIN:
-                newEntry->object = [value retain];
-                break;
-            case OBJC_ASSOCIATION_COPY_NONATOMIC:
-            case OBJC_ASSOCIATION_COPY:
-                newEntry->object = [value copy];
-                break;
-        }
-        newEntry->nextEntry = NULL;
-        entry->nextEntry = newEntry;
+        case OBJC_ASSOCIATION_RETAIN_NONATOMIC:
+        case OBJC_ASSOCIATION_RETAIN:
+            return [value retain];
+
+        case OBJC_ASSOCIATION_COPY_NONATOMIC:
+        case OBJC_ASSOCIATION_COPY:
+            return [value copy];
     }
 
-    AssociationSpinLockUnlock(&AssociationLock);
+    return value;
 }
 
-id objc_getAssociatedObject(id object, const void *key)
-{
+static void AssociationReleaseValue(id value, objc_AssociationPolicy policy) {
+    if(policy != OBJC_ASSOCIATION_ASSIGN)
+        [value release];
+}
 
-    if (associationTable == NULL) {
-        return nil;
+void objc_removeAssociatedObjects(id object) {
+    AssociationShard *shard;
+    AssociationSlot *slot;
+    AssociationMap *map = NULL;
+    objc_uinteger i;
+
+    if(object == nil)
+        return;
+
+    shard = shardForObject(object);
+    if(!(OBJCAtomicLoadRelaxed(&shard->filter) & filterBit(object)))
+        return;
+
+    objc_lock_lock(&shard->lock);
+    if((slot = AssociationTableFind(shard->table, object)) != NULL) {
+        map = slot->map;
+        OBJCAtomicStore(&slot->object, AssociationRemovedObject);
+        if(--shard->objects == 0)
+            shard->filter = 0;
     }
+    objc_lock_unlock(&shard->lock);
 
-    AssociationSpinLockLock(&AssociationLock);
+    if(map == NULL)
+        return;
 
+    // outside the lock, a release can dealloc an object which has associations of its own
+    for(i = 0; i < map->count; i++)
+        AssociationReleaseValue(map->entries[i].value, map->entries[i].policy);
 
-    AssociationObjectEntry   *objectTable = AssociationTableGet(associationTable, object);
-    if (objectTable == NULL) {
-        AssociationSpinLockUnlock(&AssociationLock);
-        return nil;
+    // nothing reads the associations of an object which is being deallocated
+    objc_free(map);
+}
+
+void objc_setAssociatedObject(id object, const void *key, id value, objc_AssociationPolicy policy) {
+    AssociationShard *shard = shardForObject(object);
+    AssociationSlot *slot;
+    AssociationMap *map;
+    id old = nil;
+    objc_AssociationPolicy oldPolicy = OBJC_ASSOCIATION_ASSIGN;
+    objc_uinteger i;
+
+    // -copy and -retain can come back here
+    value = AssociationRetainValue(value, policy);
+
+    objc_lock_lock(&shard->lock);
+
+    if((slot = AssociationTableFind(shard->table, object)) == NULL) {
+        if(value == nil) {
+            objc_lock_unlock(&shard->lock);
+            return;
+        }
+        slot = AssociationTableInsert(shard, object, AssociationMapCreate(AssociationMapInitialCapacity));
     }
 
-    uintptr_t               index = HASHPTR(key) % AssociationObjectEntrySize;
-    AssociationObjectEntry *entry = ((AssociationObjectEntry *)objectTable) + index;
-    while (entry) {
-        if (entry->key == key) {
+    map = slot->map;
+    for(i = 0; i < map->count; i++)
+        if(map->entries[i].key == key)
             break;
+
+    if(i < map->count) {
+        old = map->entries[i].value;
+        oldPolicy = map->entries[i].policy;
+        map->entries[i].policy = policy;
+        OBJCAtomicStore(&map->entries[i].value, value);
+    } else if(value != nil) {
+        if(map->count == map->capacity) {
+            AssociationMap *grown = AssociationMapCreate(map->capacity * 2);
+
+            memcpy(grown->entries, map->entries, map->count * sizeof(AssociationEntry));
+            grown->count = map->count;
+            OBJCAtomicStore(&slot->map, grown);
+            AssociationRetire(shard, map);
+            map = grown;
         }
-        entry = entry->nextEntry;
+
+        map->entries[i].key = key;
+        map->entries[i].value = value;
+        map->entries[i].policy = policy;
+        OBJCAtomicStore(&map->count, i + 1);
     }
-    AssociationSpinLockUnlock(&AssociationLock);
-    if (entry) {
-        return entry->object;        
-    } else {
+
+    objc_lock_unlock(&shard->lock);
+
+    AssociationReleaseValue(old, oldPolicy);
+}
+
+id objc_getAssociatedObject(id object, const void *key) {
+    AssociationMap *map = AssociationMapLookup(object);
+    objc_uinteger i, count;
+
+    if(map == NULL)
         return nil;
-    }
+
+    count = OBJCAtomicLoad(&map->count);
+    for(i = 0; i < count; i++)
+        if(map->entries[i].key == key)
+            return OBJCAtomicLoad(&map->entries[i].value);
+
+    return nil;
 }
@@ -0,0 +1,47 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+// Atomic loads and stores for the lock free readers in the runtime and Foundation. These are
+// built on the __sync builtins which every supported compiler has, the __atomic ones need
+// gcc 4.7. A barrier after a load and before a store gives the acquire and release ordering,
+// aligned word loads and stores are themselves atomic on every target.
+
+// x86 only moves stores after later loads, which acquire and release allow, so only the
+// compiler has to be held back
+#if defined(__i386__) || defined(__x86_64__)
+#define OBJCAtomicBarrier() __asm__ __volatile__("" : : : "memory")
+#else
+#define OBJCAtomicBarrier() __sync_synchronize()
+#endif
+
+#define OBJCAtomicLoad(pointer) ({ \
+    __typeof__(*(pointer)) __value = *(volatile __typeof__(*(pointer)) *)(pointer); \
+    OBJCAtomicBarrier(); \
+    __value; \
+})
+
+#define OBJCAtomicStore(pointer, value) do { \
+    OBJCAtomicBarrier(); \
+    *(volatile __typeof__(*(pointer)) *)(pointer) = (value); \
+} while(0)
+
+// No ordering, for counters and hints which are read on their own
+#define OBJCAtomicLoadRelaxed(pointer) (*(volatile __typeof__(*(pointer)) *)(pointer))
+#define OBJCAtomicStoreRelaxed(pointer, value) (*(volatile __typeof__(*(pointer)) *)(pointer) = (value))
+
+// Read-modify-write operations, full barriers
+#define OBJCAtomicOr(pointer, bits) __sync_fetch_and_or((pointer), (bits))
+#define OBJCAtomicAnd(pointer, bits) __sync_fetch_and_and((pointer), (bits))
+#define OBJCAtomicIncrement(pointer) __sync_add_and_fetch((pointer), 1)
+#define OBJCAtomicDecrement(pointer) __sync_sub_and_fetch((pointer), 1)
+
+// __sync_lock_test_and_set only promises acquire, the barrier in front adds release
+#define OBJCAtomicExchange(pointer, value) ({ \
+    OBJCAtomicBarrier(); \
+    __sync_lock_test_and_set((pointer), (value)); \
+})
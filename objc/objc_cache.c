@@ -0,0 +1,333 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "objc_cache.h"
+#import "objc_class.h"
+#import "objc_malloc.h"
+#import "objc_lock.h"
+#import "objc_atomic.h"
+#import "objc_tls.h"
+
+static struct objc_method empty_method = {
+    0, NULL, NULL};
+
+// Shared by every class until its first method is cached, never written to
+OBJCMethodCache OBJCEmptyMethodCache = {
+    0, 0, {&empty_method}};
+
+static objc_lock cacheLock = 0;
+
+/* Tables replaced by a grow or flush may still be in use by a lock-free reader, so they
+   are retired instead of freed. Every retire bumps the global epoch and the retired table
+   is tagged with the new value. Threads record the epoch whenever they are at a quiescent
+   point, a place where they can't be in the middle of a cache probe (the lookup slow path,
+   autorelease pool pops). Once the oldest recorded epoch has reached a table's tag, every
+   thread has been quiescent since it was retired and it can be freed.
+
+   A thread which blocks outside the runtime never gets to a quiescent point and holds the
+   epoch back for as long as it sleeps. So the list doesn't grow without bound meanwhile,
+   past OBJCRetiredCacheLimit tables the oldest ones are dropped from it and leaked.
+ */
+typedef struct OBJCRetiredCache {
+    struct OBJCRetiredCache *next;
+    OBJCMethodCache *cache;
+    uintptr_t epoch;
+} OBJCRetiredCache;
+
+#define OBJCRetiredCacheLimit 1024
+
+static volatile uintptr_t cacheEpoch = 1;
+static OBJCRetiredCache *retiredCaches = NULL;
+static unsigned long retiredCachesCount = 0;
+static volatile unsigned long cacheMisses = 0;
+static volatile unsigned long cacheNegativeHits = 0;
+
+// bumped whenever method lists change, fills which raced with the change are discarded
+static volatile uintptr_t cacheGeneration = 0;
+
+// Classes whose cache isn't the empty one, so invalidation doesn't have to walk every class
+static Class *cachedClasses = NULL;
+static unsigned long cachedClassesCount = 0;
+static unsigned long cachedClassesCapacity = 0;
+
+// One shared negative entry per selector, method_imp NULL
+static struct objc_method **negativeMethods = NULL;
+static uintptr_t negativeMethodsMask = 0;
+static uintptr_t negativeMethodsCount = 0;
+
+uintptr_t OBJCCacheCurrentEpoch(void) {
+    return cacheEpoch;
+}
+
+void OBJCCacheQuiescentPoint(void) {
+    objc_tlsCurrent()->cacheEpoch = cacheEpoch;
+}
+
+uintptr_t OBJCCacheAdvanceEpoch(void) {
+    uintptr_t result = __sync_add_and_fetch(&cacheEpoch, 1);
+
+    // the retiring thread isn't probing anything
+    OBJCCacheQuiescentPoint();
+
+    return result;
+}
+
+void OBJCCacheCountMiss(void) {
+    __sync_fetch_and_add(&cacheMisses, 1);
+}
+
+void OBJCCacheCountNegativeHit(void) {
+    __sync_fetch_and_add(&cacheNegativeHits, 1);
+}
+
+uintptr_t OBJCMethodCacheGeneration(void) {
+    return OBJCAtomicLoad(&cacheGeneration);
+}
+
+// cacheLock must be held
+static struct objc_method *OBJCNegativeMethodForSelector(SEL selector) {
+    struct objc_method *result;
+    uintptr_t index;
+
+    if((negativeMethodsCount + 1) * 2 > negativeMethodsMask + 1) {
+        struct objc_method **old = negativeMethods;
+        uintptr_t i, oldMask = negativeMethodsMask;
+
+        negativeMethodsMask = (old == NULL) ? 255 : oldMask * 2 + 1;
+        negativeMethods = objc_calloc(negativeMethodsMask + 1, sizeof(struct objc_method *));
+
+        for(i = 0; old != NULL && i <= oldMask; i++)
+            if(old[i] != NULL) {
+                for(index = ((uintptr_t)old[i]->method_name >> 2) & negativeMethodsMask; negativeMethods[index] != NULL;)
+                    index = (index + 1) & negativeMethodsMask;
+                negativeMethods[index] = old[i];
+            }
+        objc_free(old);
+    }
+
+    for(index = ((uintptr_t)selector >> 2) & negativeMethodsMask; (result = negativeMethods[index]) != NULL;) {
+        if(result->method_name == selector)
+            return result;
+        index = (index + 1) & negativeMethodsMask;
+    }
+
+    result = objc_calloc(1, sizeof(struct objc_method));
+    result->method_name = selector;
+    negativeMethods[index] = result;
+    negativeMethodsCount++;
+
+    return result;
+}
+
+static OBJCMethodCache *OBJCAllocateMethodCache(uintptr_t numberOfEntries) {
+    OBJCMethodCache *result = objc_malloc(sizeof(OBJCMethodCache) + (numberOfEntries - 1) * sizeof(struct objc_method *));
+    uintptr_t i;
+
+    result->mask = numberOfEntries - 1;
+    result->occupied = 0;
+    for(i = 0; i < numberOfEntries; i++)
+        result->table[i] = &empty_method;
+
+    return result;
+}
+
+static void OBJCInsertIntoMethodCache(OBJCMethodCache *cache, struct objc_method *method) {
+    uintptr_t index = OBJCMethodCacheIndex(cache, method->method_name);
+
+    while(cache->table[index]->method_name != NULL)
+        index = (index + 1) & cache->mask;
+
+    OBJCAtomicStore(cache->table + index, method);
+    cache->occupied++;
+}
+
+static void OBJCOldestThreadEpoch(objc_tls *tls, void *context) {
+    uintptr_t *oldest = context;
+
+    if(tls->cacheEpoch < *oldest)
+        *oldest = tls->cacheEpoch;
+}
+
+uintptr_t OBJCCacheOldestEpoch(void) {
+    uintptr_t oldest = cacheEpoch;
+
+    objc_tlsEnumerate(OBJCOldestThreadEpoch, &oldest);
+
+    return oldest;
+}
+
+// cacheLock must be held
+static void OBJCReclaimRetiredCaches(void) {
+    uintptr_t oldest = OBJCCacheOldestEpoch();
+    OBJCRetiredCache **check;
+
+    for(check = &retiredCaches; *check != NULL;) {
+        OBJCRetiredCache *retired = *check;
+
+        if(retired->epoch <= oldest) {
+            *check = retired->next;
+            retiredCachesCount--;
+            objc_free(retired->cache);
+            objc_free(retired);
+        } else
+            check = &retired->next;
+    }
+
+    // newest first, anything past the limit is older than the rest
+    if(retiredCachesCount > OBJCRetiredCacheLimit) {
+        unsigned long count = 0;
+
+        for(check = &retiredCaches; count < OBJCRetiredCacheLimit; check = &(*check)->next)
+            count++;
+
+        while(*check != NULL) {
+            OBJCRetiredCache *retired = *check;
+
+            *check = retired->next;
+            retiredCachesCount--;
+            objc_free(retired);
+        }
+    }
+}
+
+// cacheLock must be held
+static void OBJCRetireMethodCache(OBJCMethodCache *cache) {
+    OBJCRetiredCache *retired;
+
+    if(cache == NULL || cache == &OBJCEmptyMethodCache)
+        return;
+
+    retired = objc_malloc(sizeof(OBJCRetiredCache));
+    retired->cache = cache;
+    retired->epoch = OBJCCacheAdvanceEpoch();
+    retired->next = retiredCaches;
+    retiredCaches = retired;
+    retiredCachesCount++;
+
+    OBJCReclaimRetiredCaches();
+}
+
+// cacheLock must be held
+static void OBJCSetMethodCache(Class class, OBJCMethodCache *cache) {
+    OBJCMethodCache *old = class->cache;
+
+    if(old == NULL || old == &OBJCEmptyMethodCache) {
+        if(cachedClassesCount >= cachedClassesCapacity) {
+            cachedClassesCapacity = (cachedClassesCapacity == 0) ? 256 : cachedClassesCapacity * 2;
+            cachedClasses = objc_realloc(cachedClasses, cachedClassesCapacity * sizeof(Class));
+        }
+        cachedClasses[cachedClassesCount++] = class;
+    }
+
+    OBJCAtomicStore(&class->cache, cache);
+    OBJCRetireMethodCache(old);
+}
+
+void OBJCCacheMethodInClass(Class class, SEL selector, struct objc_method *method, uintptr_t generation) {
+    objc_lock_lock(&cacheLock);
+    if(generation == cacheGeneration) {
+        OBJCMethodCache *cache = (class->cache == NULL) ? &OBJCEmptyMethodCache : class->cache;
+
+        if(method == NULL)
+            method = OBJCNegativeMethodForSelector(selector);
+
+        if(OBJCMethodCacheLookup(cache, method->method_name) == NULL) {
+            // keep the load factor at or below 3/4 so probes stay short
+            if((cache->occupied + 1) * 4 > (cache->mask + 1) * 3) {
+                uintptr_t numberOfEntries = (cache == &OBJCEmptyMethodCache) ? OBJCMethodCacheInitialNumberOfEntries : (cache->mask + 1) * 2;
+                OBJCMethodCache *grown = OBJCAllocateMethodCache(numberOfEntries);
+                uintptr_t i;
+
+                for(i = 0; i <= cache->mask; i++)
+                    if(cache->table[i]->method_name != NULL)
+                        OBJCInsertIntoMethodCache(grown, cache->table[i]);
+
+                OBJCInsertIntoMethodCache(grown, method);
+                OBJCSetMethodCache(class, grown);
+            } else
+                OBJCInsertIntoMethodCache(cache, method);
+        }
+    }
+    objc_lock_unlock(&cacheLock);
+}
+
+static BOOL OBJCClassInheritsFrom(Class class, Class ancestor) {
+    for(; class != Nil; class = class->super_class)
+        if(class == ancestor)
+            return YES;
+
+    return NO;
+}
+
+// Flushes every cache which might have seen ancestor's methods, ancestor==Nil flushes them all
+static void OBJCFlushMethodCachesInheritingFrom(Class ancestor) {
+    unsigned long i;
+
+    objc_lock_lock(&cacheLock);
+    OBJCAtomicIncrement(&cacheGeneration);
+
+    for(i = 0; i < cachedClassesCount;) {
+        Class check = cachedClasses[i];
+
+        if(ancestor == Nil || OBJCClassInheritsFrom(check, ancestor)) {
+            OBJCMethodCache *cache = check->cache;
+
+            cachedClasses[i] = cachedClasses[--cachedClassesCount];
+            OBJCAtomicStore(&check->cache, &OBJCEmptyMethodCache);
+            OBJCRetireMethodCache(cache);
+        } else
+            i++;
+    }
+    objc_lock_unlock(&cacheLock);
+}
+
+void OBJCInvalidateMethodCachesForClass(Class class) {
+    OBJCFlushMethodCachesInheritingFrom(class);
+}
+
+void OBJCFlushAllMethodCaches(void) {
+    OBJCFlushMethodCachesInheritingFrom(Nil);
+}
+
+static void OBJCAddMethodCacheStatistics(OBJCMethodCache *cache, objc_method_cache_statistics *stats) {
+    uintptr_t i;
+
+    if(cache == NULL || cache == &OBJCEmptyMethodCache)
+        return;
+
+    stats->caches++;
+    stats->capacity += cache->mask + 1;
+    stats->occupied += cache->occupied;
+
+    for(i = 0; i <= cache->mask; i++) {
+        struct objc_method *method = cache->table[i];
+
+        if(method->method_name != NULL) {
+            unsigned long probeLength = ((i - OBJCMethodCacheIndex(cache, method->method_name)) & cache->mask) + 1;
+
+            if(method->method_imp == NULL)
+                stats->negative++;
+            stats->totalProbeLength += probeLength;
+            if(probeLength > stats->maxProbeLength)
+                stats->maxProbeLength = probeLength;
+        }
+    }
+}
+
+void objc_getMethodCacheStatistics(objc_method_cache_statistics *stats) {
+    unsigned long i;
+
+    memset(stats, 0, sizeof(objc_method_cache_statistics));
+
+    objc_lock_lock(&cacheLock);
+    for(i = 0; i < cachedClassesCount; i++)
+        OBJCAddMethodCacheStatistics(cachedClasses[i]->cache, stats);
+    objc_lock_unlock(&cacheLock);
+
+    stats->misses = cacheMisses;
+    stats->negativeHits = cacheNegativeHits;
+}
@@ -1,14 +1,66 @@
 #import <objc/objc-class.h>
+#import "objc_tls.h"
 
-// the cache entry size must be a power of 2
-typedef struct {
-    intptr_t offsetToNextEntry;
-    struct objc_method *method;
-} OBJCMethodCacheEntry;
-
-#define OBJCMethodCacheNumberOfEntries 64
-#define OBJCMethodCacheMask ((OBJCMethodCacheNumberOfEntries - 1) * sizeof(OBJCMethodCacheEntry))
-
+// Per class method cache, open addressed with linear probing. The number of entries is
+// always a power of 2 and empty slots point at a method with a NULL name so a probe
+// never has to test for NULL entries. A method with a name but a NULL imp is a negative
+// entry, the class is known not to respond to that selector. Readers (objc_msgSend) never lock, writers are
+// serialized and replace the whole table when it has to grow, the old table is
+// reclaimed once every thread has passed a quiescent point (see objc_cache.c).
+//
+// The layout is known to the objc_msgSend assembly: mask at offset 0, table at 2 words.
 typedef struct objc_cache {
-    OBJCMethodCacheEntry table[OBJCMethodCacheNumberOfEntries];
+    uintptr_t mask;
+    uintptr_t occupied;
+    struct objc_method *table[1];
 } OBJCMethodCache;
+
+#define OBJCMethodCacheInitialNumberOfEntries 8
+
+OBJC_EXPORT OBJCMethodCache OBJCEmptyMethodCache;
+
+// Selector names are either packed strings or malloc'd (16 byte aligned), fold the higher
+// bits in so the latter don't all land on the same few home slots
+static inline uintptr_t OBJCMethodCacheIndex(OBJCMethodCache *cache, SEL uniqueId) {
+    return ((uintptr_t)uniqueId ^ ((uintptr_t)uniqueId >> 4)) & cache->mask;
+}
+
+static inline struct objc_method *OBJCMethodCacheLookup(OBJCMethodCache *cache, SEL uniqueId) {
+    uintptr_t index = OBJCMethodCacheIndex(cache, uniqueId);
+
+    for(;;) {
+        struct objc_method *check = cache->table[index];
+
+        if(((SEL)check->method_name) == uniqueId)
+            return check;
+        if(check->method_name == NULL)
+            return NULL;
+
+        index = (index + 1) & cache->mask;
+    }
+}
+
+// method==NULL caches a negative entry for selector. generation is OBJCMethodCacheGeneration()
+// from before the method lists were searched, the entry is dropped if they changed since.
+void OBJCCacheMethodInClass(Class class, SEL selector, struct objc_method *method, uintptr_t generation);
+uintptr_t OBJCMethodCacheGeneration(void);
+void OBJCInvalidateMethodCachesForClass(Class class);
+void OBJCFlushAllMethodCaches(void);
+uintptr_t OBJCCacheCurrentEpoch(void);
+void OBJCCacheQuiescentPoint(void);
+// Other lock-free tables retire memory by the same rule as method caches, without cacheLock:
+// tag it with a new epoch, free it once the oldest thread epoch has reached the tag
+uintptr_t OBJCCacheAdvanceEpoch(void);
+uintptr_t OBJCCacheOldestEpoch(void);
+
+// A thread which isn't on the objc_tls list doesn't hold back the epoch, so a table could be
+// freed under it. Every lock-free read path calls this before loading a table, only a thread's
+// first call does any work.
+static inline void OBJCCacheRegisterReader(void) {
+#ifdef OBJC_TLS_CURRENT
+    if(__builtin_expect(objc_tls_current == NULL, 0))
+#endif
+        objc_tlsCurrent();
+}
+void OBJCCacheCountMiss(void);
+void OBJCCacheCountNegativeHit(void);
@@ -0,0 +1,196 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "objc_census.h"
+#import "objc_lock.h"
+#import "objc_atomic.h"
+#import "objc_tls.h"
+#import <stdlib.h>
+#import <string.h>
+
+// Every thread which allocates or deallocates while the census is on counts into its own fixed
+// size open addressed table of classes, so counting is a probe and three stores with no atomic
+// operations. As in the message profiler a slot's class is published after it is filled in and
+// the counters are single writer, a snapshot reads live tables while their threads keep going.
+// Classes which don't fit in a thread's table are counted in the shared table under the lock.
+
+#define OBJC_CENSUS_BUFFER_CAPACITY 1024 // power of 2
+
+typedef struct {
+    Class volatile cls;
+    volatile long liveInstances;
+    volatile unsigned long allocations;
+    volatile unsigned long allocatedBytes;
+} objc_census_slot;
+
+typedef struct objc_census_buffer {
+    objc_census_slot slots[OBJC_CENSUS_BUFFER_CAPACITY];
+} objc_census_buffer;
+
+// Totals of exited threads and of classes which overflowed a thread's table
+typedef struct {
+    unsigned count;
+    unsigned capacity;
+    objc_census_slot *slots;
+} objc_census_table;
+
+volatile int objc_census_enabled = 0;
+
+static objc_lock censusLock = 0;
+static objc_census_table shared = { 0, 0, NULL };
+
+static inline uintptr_t OBJCCensusHash(Class cls) {
+    uintptr_t hash = (uintptr_t)cls >> 4;
+
+    return hash ^ (hash >> 10);
+}
+
+static void OBJCCensusTableAdd(objc_census_table *table, Class cls, long liveInstances, unsigned long allocations, unsigned long allocatedBytes) {
+    uintptr_t index;
+
+    if(table->count * 2 >= table->capacity) {
+        objc_census_table grown = { 0, (table->capacity == 0) ? 256 : table->capacity * 2, NULL };
+        unsigned i;
+
+        grown.slots = calloc(grown.capacity, sizeof(objc_census_slot));
+        for(i = 0; i < table->capacity; i++)
+            if(table->slots[i].cls != Nil)
+                OBJCCensusTableAdd(&grown, table->slots[i].cls, table->slots[i].liveInstances, table->slots[i].allocations, table->slots[i].allocatedBytes);
+        free(table->slots);
+        *table = grown;
+    }
+
+    for(index = OBJCCensusHash(cls);; index++) {
+        objc_census_slot *slot = table->slots + (index & (table->capacity - 1));
+
+        if(slot->cls == Nil) {
+            slot->cls = cls;
+            table->count++;
+        } else if(slot->cls != cls)
+            continue;
+
+        slot->liveInstances += liveInstances;
+        slot->allocations += allocations;
+        slot->allocatedBytes += allocatedBytes;
+        return;
+    }
+}
+
+static objc_census_slot *OBJCCensusBufferSlot(Class cls) {
+    objc_tls *tls = objc_tlsCurrent();
+    objc_census_buffer *buffer = tls->census;
+    uintptr_t index = OBJCCensusHash(cls);
+    unsigned probes;
+
+    if(buffer == NULL) {
+        if((buffer = calloc(1, sizeof(objc_census_buffer))) == NULL)
+            return NULL;
+        tls->census = buffer;
+    }
+
+    for(probes = 0; probes < OBJC_CENSUS_BUFFER_CAPACITY / 2; probes++, index++) {
+        objc_census_slot *slot = buffer->slots + (index & (OBJC_CENSUS_BUFFER_CAPACITY - 1));
+
+        if(slot->cls == cls)
+            return slot;
+        if(slot->cls == Nil) {
+            OBJCAtomicStore(&slot->cls, cls);
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+void OBJCCensusCountAllocation(Class cls, size_t bytes) {
+    objc_census_slot *slot = OBJCCensusBufferSlot(cls);
+
+    if(slot == NULL) {
+        objc_lock_lock(&censusLock);
+        OBJCCensusTableAdd(&shared, cls, 1, 1, bytes);
+        objc_lock_unlock(&censusLock);
+        return;
+    }
+
+    OBJCAtomicStoreRelaxed(&slot->liveInstances, slot->liveInstances + 1);
+    OBJCAtomicStoreRelaxed(&slot->allocations, slot->allocations + 1);
+    OBJCAtomicStoreRelaxed(&slot->allocatedBytes, slot->allocatedBytes + bytes);
+}
+
+void OBJCCensusCountDeallocation(Class cls) {
+    objc_census_slot *slot = OBJCCensusBufferSlot(cls);
+
+    if(slot == NULL) {
+        objc_lock_lock(&censusLock);
+        OBJCCensusTableAdd(&shared, cls, -1, 0, 0);
+        objc_lock_unlock(&censusLock);
+        return;
+    }
+
+    OBJCAtomicStoreRelaxed(&slot->liveInstances, slot->liveInstances - 1);
+}
+
+static void OBJCCensusTableAddBuffer(objc_census_table *table, objc_census_buffer *buffer) {
+    unsigned i;
+
+    for(i = 0; i < OBJC_CENSUS_BUFFER_CAPACITY; i++) {
+        objc_census_slot *slot = buffer->slots + i;
+        Class cls = OBJCAtomicLoad(&slot->cls);
+
+        if(cls != Nil)
+            OBJCCensusTableAdd(table, cls, OBJCAtomicLoadRelaxed(&slot->liveInstances), OBJCAtomicLoadRelaxed(&slot->allocations), OBJCAtomicLoadRelaxed(&slot->allocatedBytes));
+    }
+}
+
+void OBJCCensusThreadExit(objc_census_buffer *buffer) {
+    objc_lock_lock(&censusLock);
+    OBJCCensusTableAddBuffer(&shared, buffer);
+    objc_lock_unlock(&censusLock);
+
+    free(buffer);
+}
+
+static void OBJCCensusMergeThread(objc_tls *tls, void *context) {
+    if(tls->census != NULL)
+        OBJCCensusTableAddBuffer(context, tls->census);
+}
+
+void objc_setCensusEnabled(BOOL enabled) {
+    objc_census_enabled = enabled;
+}
+
+objc_census_entry *objc_copyCensus(unsigned *countp) {
+    objc_census_table table = { 0, 0, NULL };
+    objc_census_entry *result;
+    unsigned i, count = 0;
+
+    objc_lock_lock(&censusLock);
+    for(i = 0; i < shared.capacity; i++)
+        if(shared.slots[i].cls != Nil)
+            OBJCCensusTableAdd(&table, shared.slots[i].cls, shared.slots[i].liveInstances, shared.slots[i].allocations, shared.slots[i].allocatedBytes);
+    objc_tlsEnumerate(OBJCCensusMergeThread, &table);
+    objc_lock_unlock(&censusLock);
+
+    result = malloc(sizeof(objc_census_entry) * (table.count + 1));
+    for(i = 0; i < table.capacity; i++) {
+        objc_census_slot *slot = table.slots + i;
+
+        if(slot->cls != Nil) {
+            result[count].cls = slot->cls;
+            result[count].liveInstances = slot->liveInstances;
+            result[count].allocations = slot->allocations;
+            result[count].allocatedBytes = slot->allocatedBytes;
+            count++;
+        }
+    }
+    free(table.slots);
+
+    if(countp != NULL)
+        *countp = count;
+
+    return result;
+}
@@ -0,0 +1,20 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <objc/runtime.h>
+
+// Heap census, see objc_setCensusEnabled. Allocators test objc_census_enabled before counting,
+// which is all it costs while off.
+OBJC_EXPORT volatile int objc_census_enabled;
+
+struct objc_census_buffer;
+
+OBJC_EXPORT void OBJCCensusCountAllocation(Class cls, size_t bytes);
+OBJC_EXPORT void OBJCCensusCountDeallocation(Class cls);
+
+// Folds the counts of an exiting thread into the process totals and frees them
+void OBJCCensusThreadExit(struct objc_census_buffer *buffer);
@@ -13,9 +13,11 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import "ObjCModule.h"
 #import <stdio.h>
 #import "objc_cache.h"
+#import "objc_census.h"
 #import <objc/deprecated.h>
 #import <objc/message.h>
 #import "objc_lock.h"
+#import "objc_atomic.h"
 
 #ifdef SOLARIS
 #import <stdarg.h>
@@ -242,17 +244,57 @@ Ivar class_getClassVariable(Class cls, const char *name) {
     return NULL;
 }
 
+// Method lists are sorted by selector address once their selectors are registered (see
+// OBJCSortMethodList) so anything but short lists can be binary searched
+#define OBJCMethodListLinearSearchLimit 8
+
 static inline struct objc_method *OBJCLookupUniqueIdInMethodList(struct objc_method_list *list, SEL uniqueId) {
+    struct objc_method *methods = list->method_list;
+    SEL selector = sel_getSelector(uniqueId);
     int i;
 
-    for(i = 0; i < list->method_count; i++) {
-        if(((SEL)list->method_list[i].method_name) == sel_getSelector(uniqueId))
-            return list->method_list + i;
+    if(list->method_count <= OBJCMethodListLinearSearchLimit) {
+        for(i = 0; i < list->method_count; i++) {
+            if(((SEL)methods[i].method_name) == selector)
+                return methods + i;
+        }
+    } else {
+        int low = 0, high = list->method_count - 1;
+
+        while(low <= high) {
+            int middle = low + (high - low) / 2;
+            SEL check = methods[middle].method_name;
+
+            if(check == selector)
+                return methods + middle;
+            if((uintptr_t)check < (uintptr_t)selector)
+                low = middle + 1;
+            else
+                high = middle - 1;
+        }
     }
 
     return NULL;
 }
 
+static int OBJCCompareMethodsBySelector(const void *a, const void *b) {
+    uintptr_t selectorA = (uintptr_t)((const struct objc_method *)a)->method_name;
+    uintptr_t selectorB = (uintptr_t)((const struct objc_method *)b)->method_name;
+
+    return (selectorA < selectorB) ? -1 : (selectorA > selectorB) ? 1 : 0;
+}
+
+static void OBJCSortMethodList(struct objc_method_list *list) {
+    int i;
+
+    for(i = 1; i < list->method_count; i++)
+        if((uintptr_t)list->method_list[i - 1].method_name > (uintptr_t)list->method_list[i].method_name)
+            break;
+
+    if(i < list->method_count)
+        qsort(list->method_list, list->method_count, sizeof(struct objc_method), OBJCCompareMethodsBySelector);
+}
+
 struct objc_method *OBJCLookupUniqueIdInOnlyThisClass(Class class, SEL uniqueId) {
     void *iterator = 0;
     struct objc_method_list *check;
@@ -302,50 +344,6 @@ const char *class_getIvarLayout(Class cls) {
     return NULL;
 }
 
-static inline void OBJCInitializeCacheEntryOffset(OBJCMethodCacheEntry *entry) {
-    entry->offsetToNextEntry = -((intptr_t)entry);
-}
-
-// FIXME, better allocator
-static inline OBJCMethodCacheEntry *allocateCacheEntry() {
-    OBJCMethodCacheEntry *result = objc_malloc(sizeof(OBJCMethodCacheEntry));
-
-    OBJCInitializeCacheEntryOffset(result);
-
-    return result;
-}
-
-static inline void OBJCCacheMethodInClass(Class class, struct objc_method *method) {
-    SEL uniqueId = method->method_name;
-    uintptr_t index = (uintptr_t)uniqueId & OBJCMethodCacheMask;
-    OBJCMethodCacheEntry *check = ((void *)class->cache->table) + index;
-
-    if(check->method->method_name == NULL)
-        check->method = method;
-    else {
-        BOOL success = NO;
-        while(!success) {
-            intptr_t offset = 0;
-            do {
-                check = ((void *)check) + offset;
-                if(method == check->method) {
-                    // already cached
-                    return;
-                }
-            } while(offset = check->offsetToNextEntry, ((void *)check) + offset != NULL);
-
-            OBJCMethodCacheEntry *entry = allocateCacheEntry();
-
-            entry->method = method;
-
-            success = __sync_bool_compare_and_swap(&check->offsetToNextEntry, offset, ((void *)entry) - ((void *)check));
-        }
-    }
-}
-
-static struct objc_method empty_method = {
-    0, NULL, NULL};
-
 static int msg_tracing = 0;
 static int msgLoggingCount = 0;
 
@@ -353,22 +351,7 @@ OBJC_EXPORT void objc_enableMessageLoggingWithCount(int count) {
     msg_tracing = 1;
     msgLoggingCount = count;
 
-    int i, capacity = objc_getClassList(NULL, 0);
-    Class list[capacity];
-
-    objc_getClassList(list, capacity);
-
-    for(i = 0; i < capacity; i++) {
-        OBJCMethodCache *cache = list[i]->cache;
-        int j;
-
-        // FIXME: this leaks because it does not free entries in the linked list
-
-        for(j = 0; j < OBJCMethodCacheNumberOfEntries; j++) {
-            OBJCInitializeCacheEntryOffset(cache->table + j);
-            cache->table[j].method = &empty_method;
-        }
-    }
+    OBJCFlushAllMethodCaches();
 
     OBJCLog("msg tracing ENABLED count=%d", count);
 }
@@ -406,20 +389,31 @@ void objc_logMsgSendSuper(struct objc_super *super, SEL selector) {
 }
 
 static inline IMP OBJCLookupAndCacheUniqueIdInClass(Class class, SEL selector) {
+    OBJCMethodCache *cache;
     struct objc_method *method;
+    uintptr_t generation;
 
-    if((method = class_getInstanceMethod(class, selector)) != NULL) {
-
-        // When msg_tracing is on we don't cache the result so there is always a cache miss
-        // and we always get the chance to log the msg
+    OBJCCacheRegisterReader();
+    cache = OBJCAtomicLoad(&class->cache);
 
-        if(!msg_tracing)
-            OBJCCacheMethodInClass(class, method);
+    if(cache != NULL && (method = OBJCMethodCacheLookup(cache, sel_getSelector(selector))) != NULL) {
+        if(method->method_imp == NULL)
+            OBJCCacheCountNegativeHit();
 
         return method->method_imp;
     }
 
-    return NULL;
+    OBJCCacheCountMiss();
+    generation = OBJCMethodCacheGeneration();
+    method = class_getInstanceMethod(class, selector);
+
+    // When msg_tracing is on we don't cache the result so there is always a cache miss
+    // and we always get the chance to log the msg. Nothing is cached before +initialize
+    // has run or a send could hit the cache and skip it.
+    if(!msg_tracing && (class->info & CLASS_INFO_INITIALIZED))
+        OBJCCacheMethodInClass(class, sel_getSelector(selector), method, generation);
+
+    return (method != NULL) ? method->method_imp : NULL;
 }
 
 void default_handler() {
@@ -633,7 +627,34 @@ BOOL class_addIvar(Class cls, const char *name, size_t size, uint8_t alignment,
     return YES;
 }
 
-void class_addMethods(Class class, struct objc_method_list *methodList) {
+static SEL OBJCRegisterMethod(struct objc_method *method) {
+    return sel_registerNameNoCopy((const char *)method->method_name);
+}
+
+static void OBJCRegisterSelectorsInMethodList(struct objc_method_list *list) {
+    int i;
+
+    for(i = 0; i < list->method_count; i++)
+        list->method_list[i].method_name = OBJCRegisterMethod(list->method_list + i);
+
+    OBJCStartupStatistics.methodSelectors += list->method_count;
+    OBJCSortMethodList(list);
+}
+
+// Classes are registered at image load with their method lists as the compiler emitted them,
+// names not yet uniqued and unsorted. The first time anything walks the method lists of a
+// class (a lookup, class_copyMethodList, class_addMethods) it is realized: the names are
+// registered as selectors and the lists sorted. Most classes linked into a process are never
+// messaged, they never pay for it. Realization is per class object, a class and its
+// metaclass are realized independently.
+static objc_lock realizeLock = 0;
+
+static inline BOOL OBJCClassIsRealized(Class class) {
+    return (OBJCAtomicLoad(&class->info) & CLASS_INFO_REALIZED) ? YES : NO;
+}
+
+// prepends a list to the method list array, no selector work and no cache invalidation
+static void OBJCInsertMethodList(Class class, struct objc_method_list *methodList) {
     struct objc_method_list **methodLists = class->methodLists;
     struct objc_method_list **newLists = NULL;
     int i;
@@ -661,6 +682,50 @@ void class_addMethods(Class class, struct objc_method_list *methodList) {
         free(methodLists);
 }
 
+// The compiler may emit a single list (or an old-style linked list of them) in place of the
+// array, turn that into an array at registration so categories can be queued on top of it
+static void OBJCConvertMethodListsOfClass(Class class) {
+    if(class->info & CLASS_NO_METHOD_ARRAY) {
+        struct objc_method_list *methodLists = (struct objc_method_list *)class->methodLists, *cur;
+
+        class->methodLists = NULL;
+        for(cur = methodLists; cur; cur = cur->obsolete)
+            OBJCInsertMethodList(class, cur);
+        OBJCAtomicAnd(&class->info, ~CLASS_NO_METHOD_ARRAY);
+    }
+}
+
+void OBJCRealizeClass(Class class) {
+    unsigned long long start;
+    int i;
+
+    if(OBJCClassIsRealized(class))
+        return;
+
+    objc_lock_lock(&realizeLock);
+    if(!OBJCClassIsRealized(class)) {
+        start = OBJCNanoseconds();
+        OBJCConvertMethodListsOfClass(class);
+        for(i = 0; class->methodLists != NULL && class->methodLists[i] != NULL; i++)
+            OBJCRegisterSelectorsInMethodList(class->methodLists[i]);
+
+        OBJCStartupStatistics.classesRealized++;
+        OBJCStartupStatistics.realizeNanoseconds += OBJCNanoseconds() - start;
+        OBJCAtomicOr(&class->info, CLASS_INFO_REALIZED);
+    }
+    objc_lock_unlock(&realizeLock);
+}
+
+// methodList holds registered selectors already
+void class_addMethods(Class class, struct objc_method_list *methodList) {
+    // realize first, the lists already there must not be mixed up with this one
+    OBJCRealizeClass(class);
+    OBJCSortMethodList(methodList);
+    OBJCInsertMethodList(class, methodList);
+    // cached lookups, negative ones in particular, may be stale for this class and its subclasses
+    OBJCInvalidateMethodCachesForClass(class);
+}
+
 BOOL class_addMethod(Class cls, SEL name, IMP imp, const char *types) {
     struct objc_method *newMethod = calloc(sizeof(struct objc_method), 1);
     struct objc_method_list *methodList = calloc(sizeof(struct objc_method_list) + sizeof(struct objc_method), 1);
@@ -723,12 +788,33 @@ BOOL class_conformsToProtocol(Class class, Protocol *protocol) {
     return NO;
 }
 
+void OBJCClassNoteExtraBytes(Class cls) {
+    if(!(cls->info & CLASS_INFO_EXTRA_BYTES))
+        OBJCAtomicOr(&cls->info, CLASS_INFO_EXTRA_BYTES);
+}
+
+// An object can have been allocated as any class up its chain with the same instance size,
+// KVO and other isa swizzling only add subclasses without ivars
+BOOL OBJCClassMayHaveExtraBytes(Class cls) {
+    long size = cls->instance_size;
+
+    for(; cls != Nil && cls->instance_size == size; cls = cls->super_class)
+        if(cls->info & CLASS_INFO_EXTRA_BYTES)
+            return YES;
+
+    return NO;
+}
+
 id class_createInstance(Class cls, size_t extraBytes) {
     if(Nil == cls) {
         return nil;
     }
     id obj = malloc(cls->instance_size + extraBytes);
     obj->isa = cls;
+    if(extraBytes > 0)
+        OBJCClassNoteExtraBytes(cls);
+    if(objc_census_enabled)
+        OBJCCensusCountAllocation(cls, cls->instance_size + extraBytes);
     return obj;
 }
 
@@ -738,58 +824,67 @@ IMP class_replaceMethod(Class cls, SEL selector, IMP imp, const char *types) {
 }
 
 BOOL class_respondsToSelector(Class cls, SEL selector) {
-    return (class_getInstanceMethod(cls, selector) != NULL) ? YES : NO;
-}
+    if(cls == Nil)
+        return NO;
 
-static SEL OBJCRegisterMethod(struct objc_method *method) {
-    return sel_registerNameNoCopy((const char *)method->method_name);
+    return (OBJCLookupAndCacheUniqueIdInClass(cls, selector) != NULL) ? YES : NO;
 }
 
-static void OBJCRegisterSelectorsInMethodList(struct objc_method_list *list) {
-    int i;
+static void OBJCAppendMethodListToClass(Class class, struct objc_method_list *methodList) {
+    objc_lock_lock(&realizeLock);
+    if(!OBJCClassIsRealized(class)) {
+        // registered along with the rest when the class is realized
+        OBJCInsertMethodList(class, methodList);
+        objc_lock_unlock(&realizeLock);
+        return;
+    }
+    objc_lock_unlock(&realizeLock);
 
-    for(i = 0; i < list->method_count; i++)
-        list->method_list[i].method_name = OBJCRegisterMethod(list->method_list + i);
+    OBJCRegisterSelectorsInMethodList(methodList);
+    class_addMethods(class, methodList);
 }
 
-static void OBJCRegisterSelectorsInClass(Class class) {
-    struct objc_method_list *cur = NULL;
+// +load is looked for without realizing anything, this runs for every class at image load.
+// Same search as class_getClassMethod, the method names of unrealized classes are still strings.
+IMP OBJCLookupLoadMethod(Class class) {
+    static SEL loadSelector = NULL;
+    Class check;
+    IMP result = NULL;
+    int i, j;
 
-    if(class->info & CLASS_NO_METHOD_ARRAY) {
-        // we have been called by via OBJCSymbolTableRegisterClasses; the methodLists pointer really
-        // points to a single method list.
+    if(loadSelector == NULL)
+        loadSelector = sel_registerName("load");
 
-        // remember direct-style method lists
-        struct objc_method_list *methodLists = (struct objc_method_list *)class->methodLists;
+    objc_lock_lock(&realizeLock);
+    for(check = class->isa; check != Nil && result == NULL; check = check->super_class) {
+        if(OBJCClassIsRealized(check)) {
+            struct objc_method *method = OBJCLookupUniqueIdInOnlyThisClass(check, loadSelector);
 
-        class->methodLists = NULL;
-        // just in case this is really an old-style method list setup with a linked list, walk it.
-        for(cur = methodLists; cur; cur = cur->obsolete) {
-            OBJCRegisterSelectorsInMethodList(cur);
-            class_addMethods(class, cur);
+            if(method != NULL)
+                result = method->method_imp;
+            continue;
         }
-        class->info &= ~CLASS_NO_METHOD_ARRAY;
-    } else {
-        // this is a properly setup class; just walk through all method lists and register the selectors
-        void *iterator = 0;
-        while((cur = class_nextMethodList(class, &iterator))) {
-            OBJCRegisterSelectorsInMethodList(cur);
+
+        OBJCConvertMethodListsOfClass(check);
+        for(i = 0; result == NULL && check->methodLists != NULL && check->methodLists[i] != NULL; i++) {
+            struct objc_method_list *list = check->methodLists[i];
+
+            for(j = 0; j < list->method_count; j++)
+                if(strcmp((const char *)list->method_list[j].method_name, "load") == 0) {
+                    result = list->method_list[j].method_imp;
+                    break;
+                }
         }
     }
+    objc_lock_unlock(&realizeLock);
+
+    return result;
 }
 
 static void OBJCCreateCacheForClass(Class class) {
-    if(class->cache == NULL) {
-        int i;
-
-        class->cache = objc_calloc(1, sizeof(OBJCMethodCache));
-
-        for(i = 0; i < OBJCMethodCacheNumberOfEntries; i++) {
-            OBJCMethodCacheEntry *entry = class->cache->table + i;
-            OBJCInitializeCacheEntryOffset(entry);
-            entry->method = &empty_method;
-        }
-    }
+    // the real table is allocated by the first OBJCCacheMethodInClass
+    if(class->cache == NULL)
+        class->cache = &OBJCEmptyMethodCache;
 }
 
 void OBJCRegisterClass(Class class) {
@@ -807,8 +902,9 @@ void OBJCRegisterClass(Class class) {
     OBJCHashInsertValueForKey(OBJCClassTable(), class->name, class);
     objc_lock_unlock(&classTableLock);
 
-    OBJCRegisterSelectorsInClass(class);
-    OBJCRegisterSelectorsInClass(class->isa);
+    OBJCConvertMethodListsOfClass(class);
+    OBJCConvertMethodListsOfClass(class->isa);
+    OBJCStartupStatistics.classesRegistered++;
 
     {
         struct objc_protocol_list *protocols;
@@ -831,15 +927,10 @@ void OBJCRegisterClass(Class class) {
         // Root class
         class->isa->isa = class->isa;
         class->isa->super_class = class;
-        class->info |= CLASS_INFO_LINKED;
+        OBJCAtomicOr(&class->info, CLASS_INFO_LINKED);
     }
 }
 
-static void OBJCAppendMethodListToClass(Class class, struct objc_method_list *methodList) {
-    OBJCRegisterSelectorsInMethodList(methodList);
-    class_addMethods(class, methodList);
-}
-
 void OBJCRegisterCategoryInClass(Category category, Class class) {
     struct objc_protocol_list *protos;
 
@@ -866,9 +957,9 @@ static void OBJCLinkClass(Class class) {
 
         if(superClass != NULL) {
             class->super_class = superClass;
-            class->info |= CLASS_INFO_LINKED;
+            OBJCAtomicOr(&class->info, CLASS_INFO_LINKED);
             class->isa->super_class = class->super_class->isa;
-            class->isa->info |= CLASS_INFO_LINKED;
+            OBJCAtomicOr(&class->isa->info, CLASS_INFO_LINKED);
             class->isa->isa = (metaRoot == NULL) ? NULL : metaRoot->isa;
         }
     }
@@ -899,8 +990,8 @@ void OBJCInitializeClass(Class class) {
 		 once for the non-implementing subclass." */
             struct objc_method *method = class_getClassMethod(class, selector);
 
-            class->info |= CLASS_INFO_INITIALIZED;
-            class->isa->info |= CLASS_INFO_INITIALIZED;
+            OBJCAtomicOr(&class->info, CLASS_INFO_INITIALIZED);
+            OBJCAtomicOr(&class->isa->info, CLASS_INFO_INITIALIZED);
 
             if(method != NULL)
                 method->method_imp((id) class, selector);
@@ -914,6 +1005,8 @@ void objc_setForwardHandler(void *handler, void *handler_stret) {
 }
 
 IMP OBJCLookupAndCacheUniqueIdForSuper(struct objc_super *super, SEL selector) {
+    OBJCCacheQuiescentPoint();
+
     if(msg_tracing)
         objc_logMsgSendSuper(super, selector);
 
@@ -922,25 +1015,47 @@ IMP OBJCLookupAndCacheUniqueIdForSuper(struct objc_super *super, SEL selector) {
     return result;
 }
 
-IMP OBJCInitializeLookupAndCacheUniqueIdForObject(id object, SEL selector) {
+IMP OBJCLookupAndCacheUniqueIdForSuper_stret(struct objc_super *super, SEL selector) {
+    OBJCCacheQuiescentPoint();
+
+    if(msg_tracing)
+        objc_logMsgSendSuper(super, selector);
+
+    return class_getMethodImplementation_stret(super->super_class, selector);
+}
+
+// called from the objc_msgSend miss path, no cache table is referenced at this point
+static inline Class OBJCInitializeClassForLookup(id object, SEL selector) {
+    OBJCCacheQuiescentPoint();
+
     if(msg_tracing)
         objc_logMsgSend(object, selector);
 
-    Class class = object->isa;
+    Class class = OBJCObjectGetClass(object);
 
     if(!(class->info & CLASS_INFO_INITIALIZED)) {
         Class checkInit = (class->info & CLASS_INFO_META) ? (Class)object : class;
         OBJCInitializeClass(checkInit);
     }
 
-    IMP result = class_getMethodImplementation(class, selector);
+    return class;
+}
 
-    return result;
+IMP OBJCInitializeLookupAndCacheUniqueIdForObject(id object, SEL selector) {
+    return class_getMethodImplementation(OBJCInitializeClassForLookup(object, selector), selector);
+}
+
+// unknown selectors get the forwarder which knows the first argument is the structure address
+IMP OBJCInitializeLookupAndCacheUniqueIdForObject_stret(id object, SEL selector) {
+    return class_getMethodImplementation_stret(OBJCInitializeClassForLookup(object, selector), selector);
 }
 
 struct objc_method_list *class_nextMethodList(Class class, void **iterator) {
     int *it = (int *)iterator;
     struct objc_method_list *ret = NULL;
+
+    OBJCRealizeClass(class);
+
     if(!class->methodLists)
         return NULL;
 
@@ -21,7 +21,10 @@ enum {
     CLASS_INFO_POSING = 0x008,
     CLASS_INFO_LINKED = 0x100,
     CLASS_HAS_CXX_STRUCTORS = 0x2000,
-    CLASS_NO_METHOD_ARRAY = 0x4000
+    CLASS_NO_METHOD_ARRAY = 0x4000,
+    CLASS_INFO_REALIZED = 0x10000, // method list selectors registered, see OBJCRealizeClass
+    CLASS_INFO_LOADED = 0x40000,   // +load has been sent, 0x20000 is the compiler's hidden class flag
+    CLASS_INFO_EXTRA_BYTES = 0x80000 // an instance was allocated with extra bytes, see OBJCClassNoteExtraBytes
 };
 
 typedef struct OBJCMethodDescriptionList {
@@ -35,8 +38,20 @@ OBJC_EXPORT void OBJCRegisterCategoryInClass(Category category, Class class);
 struct objc_method *OBJCLookupUniqueIdInOnlyThisClass(Class class, SEL uniqueId);
 OBJC_EXPORT IMP OBJCInitializeLookupAndCacheUniqueIdForObject(id object, SEL message);
 OBJC_EXPORT IMP OBJCLookupAndCacheUniqueIdForSuper(struct objc_super *super, SEL selector);
+OBJC_EXPORT IMP OBJCInitializeLookupAndCacheUniqueIdForObject_stret(id object, SEL message);
+OBJC_EXPORT IMP OBJCLookupAndCacheUniqueIdForSuper_stret(struct objc_super *super, SEL selector);
 
 OBJC_EXPORT void OBJCLinkClassTable(void);
+OBJC_EXPORT void OBJCRealizeClass(Class class);
+OBJC_EXPORT IMP OBJCLookupLoadMethod(Class class);
+
+// the class of a non-nil object, tagged pointers included
+static inline Class OBJCObjectGetClass(id object) {
+    if(objc_isTaggedPointer(object))
+        return objc_taggedPointerClasses[objc_getTaggedPointerSlot(object)];
+
+    return object->isa;
+}
 
 BOOL object_cxxConstruct(id self, Class c);
 BOOL object_cxxDestruct(id self, Class c);
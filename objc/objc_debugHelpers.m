@@ -25,6 +25,8 @@ BOOL _objc_checkObject(volatile id object)
    // assume no objects below a certain address 
    if(object<(id)0x2000)
       return NO;
+   if(objc_isTaggedPointer(object))
+      return (OBJCObjectGetClass(object)!=Nil)?YES:NO;
    // objects begin at even addresses
    if((long)object%4!=0)
       return NO;
@@ -104,10 +104,12 @@ id objc_exception_extract(void *exceptionFrame) {
     return (id)frame->exception;
 }
 
+#ifndef OBJC_ZERO_COST_EXCEPTIONS
 void objc_exception_throw(id exception) {
     _NSRaiseException(exception);
     abort();
 }
+#endif
 
 static BOOL isKindOfClass(id object, Class kindOf) {
     Class class = object_getClass(object);
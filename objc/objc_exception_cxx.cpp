@@ -0,0 +1,205 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#include <typeinfo>
+#include <exception>
+#include <cxxabi.h>
+#import "objc_exception_unwind.h"
+#import "objc_atomic.h"
+
+#ifdef OBJC_ZERO_COST_EXCEPTIONS
+
+// Objective-C++ frames use __gnustep_objcxx_personality_v0, which leaves everything to the C++
+// personality. An Objective-C exception reaching one is handed over as a C++ exception whose
+// thrown type is __objc_id_type_info; the type_info classes clang references for @catch in
+// Objective-C++ match it against the class they name. A C++ catch never matches it, and
+// @catch never matches a C++ exception.
+
+extern "C" _Unwind_Reason_Code __gxx_personality_v0(int version, _Unwind_Action actions, _Unwind_Exception_Class exceptionClass, struct _Unwind_Exception *header, struct _Unwind_Context *context);
+
+namespace {
+
+// The Itanium C++ ABI exception header, and the reference count libstdc++ puts in front of it.
+// The thrown object follows.
+struct OBJCCXXExceptionHeader {
+    std::type_info *exceptionType;
+    void (*exceptionDestructor)(void *);
+    std::unexpected_handler unexpectedHandler;
+    std::terminate_handler terminateHandler;
+    OBJCCXXExceptionHeader *nextException;
+    int handlerCount;
+    int handlerSwitchValue;
+    const unsigned char *actionRecord;
+    const unsigned char *languageSpecificData;
+    _Unwind_Ptr catchTemp;
+    void *adjustedPtr;
+    _Unwind_Exception unwindHeader;
+};
+
+struct OBJCCXXException {
+    int referenceCount; // _Atomic_word
+    OBJCCXXExceptionHeader header;
+};
+
+struct OBJCCXXPayload {
+    id object;
+    objc_exception *original; // freed with the C++ exception once that is the one caught
+};
+
+OBJCCXXException *OBJCCXXExceptionFromHeader(struct _Unwind_Exception *header) {
+    return reinterpret_cast<OBJCCXXException *>(reinterpret_cast<char *>(header) - offsetof(OBJCCXXException, header.unwindHeader));
+}
+
+OBJCCXXPayload *OBJCCXXPayloadFromHeader(struct _Unwind_Exception *header) {
+    return reinterpret_cast<OBJCCXXPayload *>(OBJCCXXExceptionFromHeader(header) + 1);
+}
+
+BOOL OBJCIsKindOfClass(id object, Class kindOf) {
+    for(Class check = object_getClass(object); check != Nil; check = class_getSuperclass(check))
+        if(check == kindOf)
+            return YES;
+
+    return NO;
+}
+
+}
+
+namespace gnustep {
+namespace libobjc {
+
+// @catch(id)
+struct __objc_id_type_info : std::type_info {
+    __objc_id_type_info() : std::type_info("@id") {
+    }
+    virtual ~__objc_id_type_info();
+    virtual bool __do_catch(const std::type_info *thrownType, void **object, unsigned outer) const;
+};
+
+// @catch(SomeClass *), clang emits these with the class name as the type name
+struct __objc_class_type_info : std::type_info {
+    virtual ~__objc_class_type_info();
+    virtual bool __do_catch(const std::type_info *thrownType, void **object, unsigned outer) const;
+};
+
+}
+}
+
+extern "C" gnustep::libobjc::__objc_id_type_info __objc_id_type_info;
+gnustep::libobjc::__objc_id_type_info __objc_id_type_info;
+
+gnustep::libobjc::__objc_id_type_info::~__objc_id_type_info() {
+}
+
+// object points at the thrown id, the landing pad gets the id itself
+bool gnustep::libobjc::__objc_id_type_info::__do_catch(const std::type_info *thrownType, void **object, unsigned outer) const {
+    if(thrownType != &::__objc_id_type_info)
+        return false;
+
+    *object = **reinterpret_cast<id **>(object);
+    return true;
+}
+
+gnustep::libobjc::__objc_class_type_info::~__objc_class_type_info() {
+}
+
+bool gnustep::libobjc::__objc_class_type_info::__do_catch(const std::type_info *thrownType, void **object, unsigned outer) const {
+    Class kindOf;
+    id thrown;
+
+    if(thrownType != &::__objc_id_type_info)
+        return false;
+
+    thrown = **reinterpret_cast<id **>(object);
+    if((kindOf = (Class)objc_lookUpClass(name())) == Nil || !OBJCIsKindOfClass(thrown, kindOf))
+        return false;
+
+    *object = thrown;
+    return true;
+}
+
+static void OBJCCXXPayloadDestroy(void *payloadX) {
+    OBJCCXXPayload *payload = static_cast<OBJCCXXPayload *>(payloadX);
+
+    if(payload->original != NULL) {
+        payload->original->cxxException = NULL;
+        OBJCExceptionFree(payload->original);
+    }
+}
+
+static void OBJCCXXExceptionCleanup(_Unwind_Reason_Code reason, struct _Unwind_Exception *header) {
+    OBJCCXXException *exception = OBJCCXXExceptionFromHeader(header);
+
+    if(OBJCAtomicDecrement(&exception->referenceCount) == 0) {
+        OBJCCXXPayloadDestroy(exception + 1);
+        __cxxabiv1::__cxa_free_exception(exception + 1);
+    }
+}
+
+extern "C" struct _Unwind_Exception *OBJCCXXExceptionCreate(objc_exception *original) {
+    OBJCCXXPayload *payload = static_cast<OBJCCXXPayload *>(__cxxabiv1::__cxa_allocate_exception(sizeof(OBJCCXXPayload)));
+    OBJCCXXException *exception = reinterpret_cast<OBJCCXXException *>(payload) - 1;
+
+    payload->object = original->object;
+    payload->original = original;
+
+    exception->referenceCount = 1;
+    exception->header.exceptionType = &__objc_id_type_info;
+    exception->header.exceptionDestructor = OBJCCXXPayloadDestroy;
+    exception->header.terminateHandler = std::get_terminate();
+    exception->header.unwindHeader.exception_class = OBJC_CXX_EXCEPTION_CLASS;
+    exception->header.unwindHeader.exception_cleanup = OBJCCXXExceptionCleanup;
+
+    return &exception->header.unwindHeader;
+}
+
+// the original was caught, the C++ exception made for it never will be
+extern "C" void OBJCCXXExceptionDetach(struct _Unwind_Exception *header) {
+    OBJCCXXPayloadFromHeader(header)->original = NULL;
+    _Unwind_DeleteException(header);
+}
+
+extern "C" BOOL OBJCCXXExceptionGetObject(struct _Unwind_Exception *header, id *object) {
+    if(OBJCCXXExceptionFromHeader(header)->header.exceptionType != &__objc_id_type_info)
+        return NO;
+
+    *object = OBJCCXXPayloadFromHeader(header)->object;
+    return YES;
+}
+
+extern "C" void OBJCCXXBeginCatch(struct _Unwind_Exception *header) {
+    __cxxabiv1::__cxa_begin_catch(header);
+}
+
+extern "C" void OBJCCXXEndCatch(void) {
+    __cxxabiv1::__cxa_end_catch();
+}
+
+extern "C" _Unwind_Reason_Code __gnustep_objcxx_personality_v0(int version, _Unwind_Action actions, _Unwind_Exception_Class exceptionClass, struct _Unwind_Exception *header, struct _Unwind_Context *context) {
+    _Unwind_Reason_Code result;
+
+    if(exceptionClass != OBJC_EXCEPTION_CLASS)
+        return __gxx_personality_v0(version, actions, exceptionClass, header, context);
+
+    objc_exception *exception = OBJCExceptionFromHeader(header);
+
+    if(exception->cxxException == NULL)
+        exception->cxxException = OBJCCXXExceptionCreate(exception);
+
+    result = __gxx_personality_v0(version, actions, OBJC_CXX_EXCEPTION_CLASS, exception->cxxException, context);
+
+    // The landing pad gets the C++ exception and resumes with it if it is only a cleanup, the
+    // unwinder's state has to go with it
+    exception->cxxException->private_1 = header->private_1;
+    exception->cxxException->private_2 = header->private_2;
+
+    if(result == _URC_INSTALL_CONTEXT)
+        OBJCExceptionPopFramesBelow(context);
+
+    return result;
+}
+
+#endif
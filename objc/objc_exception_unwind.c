@@ -0,0 +1,466 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "objc_exception_unwind.h"
+#import "objc_tls.h"
+#import "objc_malloc.h"
+#import <string.h>
+
+#ifdef OBJC_ZERO_COST_EXCEPTIONS
+
+// Exceptions are found from the call site tables the compiler emits, so a @try costs nothing
+// until something is thrown. The personality below reads the tables for Objective-C frames,
+// objc_exception_cxx.cpp handles frames compiled as Objective-C++.
+
+typedef struct objc_exception_catch {
+    struct objc_exception_catch *next;
+    struct _Unwind_Exception *header;
+    enum {
+        OBJCCatchNative,
+        OBJCCatchCXX,
+        OBJCCatchForeign,
+    } kind;
+} objc_exception_catch;
+
+void _NSRaiseException(id exception);
+
+objc_exception *OBJCExceptionFromHeader(struct _Unwind_Exception *header) {
+    return (objc_exception *)((char *)header - offsetof(objc_exception, header));
+}
+
+void OBJCExceptionFree(objc_exception *exception) {
+    if(exception->cxxException != NULL)
+        OBJCCXXExceptionDetach(exception->cxxException);
+
+    objc_free(exception);
+}
+
+// setjmp based handlers (objc_exception_try_enter, NS_DURING in code built without zero cost
+// exceptions) pushed between the throw and a landing pad are unwound past and must not stay on
+// the thread's handler list. The stack grows down, those are the ones below the frame's CFA.
+void OBJCExceptionPopFramesBelow(struct _Unwind_Context *context) {
+    objc_tls *tls = objc_tlsCurrent();
+    uintptr_t cfa = _Unwind_GetCFA(context);
+
+    while(tls->exception_frame != NULL && (uintptr_t)tls->exception_frame < cfa)
+        tls->exception_frame = tls->exception_frame->parent;
+}
+
+static void OBJCExceptionCleanup(_Unwind_Reason_Code reason, struct _Unwind_Exception *header) {
+    OBJCExceptionFree(OBJCExceptionFromHeader(header));
+}
+
+// the thrown object if header is an Objective-C exception, either ours or one a C++ frame rethrew
+static BOOL OBJCExceptionGetObject(struct _Unwind_Exception *header, id *object) {
+    if(header->exception_class == OBJC_EXCEPTION_CLASS) {
+        *object = OBJCExceptionFromHeader(header)->object;
+        return YES;
+    }
+    if(header->exception_class == OBJC_CXX_EXCEPTION_CLASS)
+        return OBJCCXXExceptionGetObject(header, object);
+
+    return NO;
+}
+
+static BOOL OBJCExceptionMatches(id object, const char *typeName) {
+    Class kindOf, check;
+
+    // @catch(id) in the non-fragile ABIs
+    if(strcmp(typeName, "@id") == 0)
+        return YES;
+
+    if((kindOf = (Class)objc_lookUpClass(typeName)) == Nil)
+        return NO;
+
+    for(check = object_getClass(object); check != Nil; check = class_getSuperclass(check))
+        if(check == kindOf)
+            return YES;
+
+    return NO;
+}
+
+enum {
+    DW_EH_PE_absptr = 0x00,
+    DW_EH_PE_uleb128 = 0x01,
+    DW_EH_PE_udata2 = 0x02,
+    DW_EH_PE_udata4 = 0x03,
+    DW_EH_PE_udata8 = 0x04,
+    DW_EH_PE_sleb128 = 0x09,
+    DW_EH_PE_sdata2 = 0x0A,
+    DW_EH_PE_sdata4 = 0x0B,
+    DW_EH_PE_sdata8 = 0x0C,
+    DW_EH_PE_pcrel = 0x10,
+    DW_EH_PE_textrel = 0x20,
+    DW_EH_PE_datarel = 0x30,
+    DW_EH_PE_funcrel = 0x40,
+    DW_EH_PE_aligned = 0x50,
+    DW_EH_PE_indirect = 0x80,
+    DW_EH_PE_omit = 0xFF,
+};
+
+static uintptr_t OBJCReadULEB128(const uint8_t **pointer) {
+    const uint8_t *p = *pointer;
+    uintptr_t result = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+
+    do {
+        byte = *p++;
+        result |= (uintptr_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while(byte & 0x80);
+
+    *pointer = p;
+    return result;
+}
+
+static intptr_t OBJCReadSLEB128(const uint8_t **pointer) {
+    const uint8_t *p = *pointer;
+    uintptr_t result = 0;
+    unsigned shift = 0;
+    uint8_t byte;
+
+    do {
+        byte = *p++;
+        result |= (uintptr_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while(byte & 0x80);
+
+    if(shift < sizeof(result) * 8 && (byte & 0x40))
+        result |= -((uintptr_t)1 << shift);
+
+    *pointer = p;
+    return (intptr_t)result;
+}
+
+static size_t OBJCEncodedSize(uint8_t encoding) {
+    if(encoding == DW_EH_PE_omit)
+        return 0;
+
+    switch(encoding & 0x0F) {
+        case DW_EH_PE_absptr:
+            return sizeof(void *);
+        case DW_EH_PE_udata2:
+        case DW_EH_PE_sdata2:
+            return 2;
+        case DW_EH_PE_udata4:
+        case DW_EH_PE_sdata4:
+            return 4;
+        case DW_EH_PE_udata8:
+        case DW_EH_PE_sdata8:
+            return 8;
+    }
+
+    abort();
+}
+
+static uintptr_t OBJCReadEncodedPointer(const uint8_t **pointer, uint8_t encoding, struct _Unwind_Context *context) {
+    const uint8_t *p = *pointer;
+    uintptr_t result;
+
+    if(encoding == DW_EH_PE_omit)
+        return 0;
+
+    if(encoding == DW_EH_PE_aligned) {
+        p = (const uint8_t *)(((uintptr_t)p + sizeof(void *) - 1) & ~(sizeof(void *) - 1));
+        memcpy(&result, p, sizeof(result));
+        *pointer = p + sizeof(result);
+        return result;
+    }
+
+    switch(encoding & 0x0F) {
+        case DW_EH_PE_absptr: {
+            void *value;
+
+            memcpy(&value, p, sizeof(value));
+            result = (uintptr_t)value;
+            p += sizeof(value);
+        } break;
+
+        case DW_EH_PE_uleb128:
+            result = OBJCReadULEB128(&p);
+            break;
+
+        case DW_EH_PE_sleb128:
+            result = OBJCReadSLEB128(&p);
+            break;
+
+        case DW_EH_PE_udata2: {
+            uint16_t value;
+
+            memcpy(&value, p, sizeof(value));
+            result = value;
+            p += sizeof(value);
+        } break;
+
+        case DW_EH_PE_sdata2: {
+            int16_t value;
+
+            memcpy(&value, p, sizeof(value));
+            result = value;
+            p += sizeof(value);
+        } break;
+
+        case DW_EH_PE_udata4: {
+            uint32_t value;
+
+            memcpy(&value, p, sizeof(value));
+            result = value;
+            p += sizeof(value);
+        } break;
+
+        case DW_EH_PE_sdata4: {
+            int32_t value;
+
+            memcpy(&value, p, sizeof(value));
+            result = value;
+            p += sizeof(value);
+        } break;
+
+        case DW_EH_PE_udata8:
+        case DW_EH_PE_sdata8: {
+            uint64_t value;
+
+            memcpy(&value, p, sizeof(value));
+            result = (uintptr_t)value;
+            p += sizeof(value);
+        } break;
+
+        default:
+            abort();
+    }
+
+    if(result != 0) {
+        switch(encoding & 0x70) {
+            case DW_EH_PE_pcrel:
+                result += (uintptr_t)*pointer;
+                break;
+            case DW_EH_PE_textrel:
+                result += _Unwind_GetTextRelBase(context);
+                break;
+            case DW_EH_PE_datarel:
+                result += _Unwind_GetDataRelBase(context);
+                break;
+            case DW_EH_PE_funcrel:
+                result += _Unwind_GetRegionStart(context);
+                break;
+        }
+
+        if(encoding & DW_EH_PE_indirect)
+            result = *(uintptr_t *)result;
+    }
+
+    *pointer = p;
+    return result;
+}
+
+typedef enum {
+    OBJCHandlerNone,
+    OBJCHandlerCleanup,
+    OBJCHandlerCatch,
+} OBJCHandlerKind;
+
+// Finds the landing pad for the current call site of context, and the switch value it expects.
+// A catch only matches if isObjC, apart from the catch all used by the fragile @catch(id)
+static OBJCHandlerKind OBJCFindHandler(struct _Unwind_Context *context, BOOL isObjC, id object, BOOL cleanupOnly, uintptr_t *landingPad, intptr_t *switchValue) {
+    const uint8_t *lsda = (const uint8_t *)_Unwind_GetLanguageSpecificData(context);
+    const uint8_t *p, *typeTable = NULL, *callSiteEnd, *actionTable;
+    uintptr_t functionStart, landingPadBase, ip;
+    uint8_t typeEncoding, callSiteEncoding;
+    int ipBefore = 0;
+
+    if(lsda == NULL)
+        return OBJCHandlerNone;
+
+    functionStart = _Unwind_GetRegionStart(context);
+    ip = _Unwind_GetIPInfo(context, &ipBefore);
+    if(!ipBefore)
+        ip--;
+
+    p = lsda;
+    {
+        uint8_t landingPadEncoding = *p++;
+
+        landingPadBase = (landingPadEncoding == DW_EH_PE_omit) ? functionStart : OBJCReadEncodedPointer(&p, landingPadEncoding, context);
+    }
+
+    if((typeEncoding = *p++) != DW_EH_PE_omit) {
+        uintptr_t offset = OBJCReadULEB128(&p);
+
+        typeTable = p + offset;
+    }
+
+    callSiteEncoding = *p++;
+    {
+        uintptr_t length = OBJCReadULEB128(&p);
+
+        callSiteEnd = p + length;
+    }
+    actionTable = callSiteEnd;
+
+    while(p < callSiteEnd) {
+        uintptr_t start = OBJCReadEncodedPointer(&p, callSiteEncoding, context);
+        uintptr_t length = OBJCReadEncodedPointer(&p, callSiteEncoding, context);
+        uintptr_t pad = OBJCReadEncodedPointer(&p, callSiteEncoding, context);
+        uintptr_t action = OBJCReadULEB128(&p);
+        const uint8_t *record;
+        BOOL cleanup = NO;
+
+        // the table is sorted by start address
+        if(ip < functionStart + start)
+            break;
+        if(ip >= functionStart + start + length)
+            continue;
+
+        if(pad == 0)
+            return OBJCHandlerNone;
+
+        *landingPad = landingPadBase + pad;
+
+        if(action == 0) {
+            *switchValue = 0;
+            return OBJCHandlerCleanup;
+        }
+
+        for(record = actionTable + action - 1; record != NULL;) {
+            const uint8_t *next = record;
+            intptr_t filter = OBJCReadSLEB128(&next);
+            const uint8_t *displacementAt = next;
+            intptr_t displacement = OBJCReadSLEB128(&next);
+
+            if(filter == 0)
+                cleanup = YES;
+            else if(filter > 0 && !cleanupOnly) {
+                const uint8_t *entry = typeTable - filter * OBJCEncodedSize(typeEncoding);
+                const char *typeName = (const char *)OBJCReadEncodedPointer(&entry, typeEncoding, context);
+
+                if(typeName == NULL || (isObjC && OBJCExceptionMatches(object, typeName))) {
+                    *switchValue = filter;
+                    return OBJCHandlerCatch;
+                }
+            }
+            // negative filters are C++ exception specifications, which never name Objective-C types
+
+            record = (displacement == 0) ? NULL : displacementAt + displacement;
+        }
+
+        if(cleanup) {
+            *switchValue = 0;
+            return OBJCHandlerCleanup;
+        }
+
+        return OBJCHandlerNone;
+    }
+
+    return OBJCHandlerNone;
+}
+
+static _Unwind_Reason_Code OBJCPersonality(int version, _Unwind_Action actions, struct _Unwind_Exception *header, struct _Unwind_Context *context) {
+    BOOL cleanupOnly = (actions & _UA_FORCE_UNWIND) ? YES : NO;
+    id object = nil;
+    BOOL isObjC = OBJCExceptionGetObject(header, &object);
+    uintptr_t landingPad = 0;
+    intptr_t switchValue = 0;
+    OBJCHandlerKind kind;
+
+    if(version != 1)
+        return _URC_FATAL_PHASE1_ERROR;
+
+    kind = OBJCFindHandler(context, isObjC, object, cleanupOnly, &landingPad, &switchValue);
+
+    if(actions & _UA_SEARCH_PHASE)
+        return (kind == OBJCHandlerCatch) ? _URC_HANDLER_FOUND : _URC_CONTINUE_UNWIND;
+
+    if(kind == OBJCHandlerNone || (kind == OBJCHandlerCatch && !(actions & _UA_HANDLER_FRAME)))
+        return _URC_CONTINUE_UNWIND;
+
+    OBJCExceptionPopFramesBelow(context);
+
+    _Unwind_SetGR(context, __builtin_eh_return_data_regno(0), (uintptr_t)header);
+    _Unwind_SetGR(context, __builtin_eh_return_data_regno(1), switchValue);
+    _Unwind_SetIP(context, landingPad);
+
+    return _URC_INSTALL_CONTEXT;
+}
+
+// GCC and clang with -fobjc-runtime=gcc
+_Unwind_Reason_Code __gnu_objc_personality_v0(int version, _Unwind_Action actions, _Unwind_Exception_Class exceptionClass, struct _Unwind_Exception *header, struct _Unwind_Context *context) {
+    return OBJCPersonality(version, actions, header, context);
+}
+
+// clang with -fobjc-runtime=gnustep
+_Unwind_Reason_Code __gnustep_objc_personality_v0(int version, _Unwind_Action actions, _Unwind_Exception_Class exceptionClass, struct _Unwind_Exception *header, struct _Unwind_Context *context) {
+    return OBJCPersonality(version, actions, header, context);
+}
+
+void objc_exception_throw(id object) {
+    objc_exception *exception = objc_calloc(1, sizeof(objc_exception));
+
+    exception->object = object;
+    exception->header.exception_class = OBJC_EXCEPTION_CLASS;
+    exception->header.exception_cleanup = OBJCExceptionCleanup;
+
+    _Unwind_RaiseException(&exception->header);
+
+    // Nothing in the unwind tables wants it, the stack is untouched. Handlers pushed by code
+    // built with the setjmp based NS_DURING get a chance before the uncaught exception handler.
+    objc_free(exception);
+    _NSRaiseException(object);
+    abort();
+}
+
+void objc_exception_rethrow(id object) {
+    objc_exception_throw(object);
+}
+
+void *objc_begin_catch(void *headerX) {
+    struct _Unwind_Exception *header = headerX;
+    objc_exception_catch *caught = objc_malloc(sizeof(objc_exception_catch));
+    objc_tls *tls = objc_tlsCurrent();
+    id object = nil;
+
+    caught->header = header;
+
+    if(header->exception_class == OBJC_EXCEPTION_CLASS) {
+        caught->kind = OBJCCatchNative;
+        object = OBJCExceptionFromHeader(header)->object;
+    } else if(header->exception_class == OBJC_CXX_EXCEPTION_CLASS && OBJCCXXExceptionGetObject(header, &object)) {
+        caught->kind = OBJCCatchCXX;
+        OBJCCXXBeginCatch(header);
+    } else
+        caught->kind = OBJCCatchForeign;
+
+    caught->next = tls->caught;
+    tls->caught = caught;
+
+    return object;
+}
+
+void objc_end_catch(void) {
+    objc_tls *tls = objc_tlsCurrent();
+    objc_exception_catch *caught = tls->caught;
+
+    tls->caught = caught->next;
+
+    switch(caught->kind) {
+        case OBJCCatchNative:
+            OBJCExceptionFree(OBJCExceptionFromHeader(caught->header));
+            break;
+
+        case OBJCCatchCXX:
+            OBJCCXXEndCatch();
+            break;
+
+        case OBJCCatchForeign:
+            _Unwind_DeleteException(caught->header);
+            break;
+    }
+
+    objc_free(caught);
+}
+
+#endif
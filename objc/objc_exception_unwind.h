@@ -0,0 +1,43 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import <objc/runtime.h>
+#include <stddef.h>
+#include <unwind.h>
+
+// Objective-C exceptions raised through the platform unwinder, used when the compiler emits
+// DWARF unwind tables for @try (OBJC_ZERO_COST_EXCEPTIONS). The exception classes are the ones
+// the GNU runtimes use so foreign unwinders recognize them.
+
+#define OBJC_EXCEPTION_CLASS 0x474E55434F424A43ULL     // "GNUCOBJC"
+#define OBJC_CXX_EXCEPTION_CLASS 0x474E5543432B2B00ULL // "GNUCC++\0"
+
+typedef struct objc_exception {
+    id object;
+    // a C++ exception carrying object, made the first time this unwinds through an Objective-C++ frame
+    struct _Unwind_Exception *cxxException;
+    struct _Unwind_Exception header;
+} objc_exception;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+objc_exception *OBJCExceptionFromHeader(struct _Unwind_Exception *header);
+void OBJCExceptionFree(objc_exception *exception);
+void OBJCExceptionPopFramesBelow(struct _Unwind_Context *context);
+
+// objc_exception_cxx.cpp
+struct _Unwind_Exception *OBJCCXXExceptionCreate(objc_exception *exception);
+void OBJCCXXExceptionDetach(struct _Unwind_Exception *cxxException);
+BOOL OBJCCXXExceptionGetObject(struct _Unwind_Exception *header, id *object);
+void OBJCCXXBeginCatch(struct _Unwind_Exception *header);
+void OBJCCXXEndCatch(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,102 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "objc_lock.h"
+#import "objc_atomic.h"
+#import <objc/runtime.h>
+#import <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#endif
+
+#ifdef LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <sched.h>
+#endif
+
+// Runtime critical sections are a handful of instructions, a short spin usually sees the
+// lock released before it is worth a syscall
+#define OBJC_LOCK_SPIN_LIMIT 100
+
+volatile int objc_lock_statisticsEnabled = 0;
+
+static volatile unsigned long lockAcquisitions = 0;
+static volatile unsigned long lockSpins = 0;
+static volatile unsigned long lockParks = 0;
+
+static inline void objc_lock_relax(void) {
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+}
+
+static inline void objc_lock_park(volatile objc_lock *lock) {
+#if defined(LINUX)
+    // returns right away if the lock word is no longer 2
+    syscall(SYS_futex, lock, FUTEX_WAIT_PRIVATE, 2, NULL, NULL, 0);
+#elif defined(WIN32)
+    Sleep(0);
+#else
+    sched_yield();
+#endif
+}
+
+void objc_lock_countAcquisition(void) {
+    __sync_fetch_and_add(&lockAcquisitions, 1);
+}
+
+void objc_lock_lockContended(volatile objc_lock *lock) {
+    unsigned spins;
+
+    for(spins = 1; spins <= OBJC_LOCK_SPIN_LIMIT; spins++) {
+        objc_lock_relax();
+
+        if(*lock == 0 && __sync_bool_compare_and_swap(lock, 0, 1)) {
+            if(objc_lock_statisticsEnabled)
+                __sync_fetch_and_add(&lockSpins, spins);
+            return;
+        }
+    }
+
+    if(objc_lock_statisticsEnabled)
+        __sync_fetch_and_add(&lockSpins, spins - 1);
+
+    // Taking the lock as 2 is conservative: we can't tell whether others are still parked,
+    // so the next unlock pays for a wake which may turn out to be unneeded
+    while(OBJCAtomicExchange(lock, 2) != 0) {
+        if(objc_lock_statisticsEnabled)
+            __sync_fetch_and_add(&lockParks, 1);
+
+        objc_lock_park(lock);
+    }
+}
+
+void objc_lock_wake(volatile objc_lock *lock) {
+#ifdef LINUX
+    syscall(SYS_futex, lock, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#endif
+}
+
+void objc_setLockStatisticsEnabled(BOOL enabled) {
+    objc_lock_statisticsEnabled = enabled;
+}
+
+void objc_getLockStatistics(objc_lock_statistics *stats) {
+    stats->acquisitions = lockAcquisitions;
+    stats->spins = lockSpins;
+    stats->parks = lockParks;
+}
+
+void objc_resetLockStatistics(void) {
+    lockAcquisitions = 0;
+    lockSpins = 0;
+    lockParks = 0;
+}
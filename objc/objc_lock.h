@@ -1,22 +1,29 @@
 #import <stdbool.h>
-#include <unistd.h>
+#import "objc_atomic.h"
 
+// 0 unlocked, 1 locked, 2 locked and there may be parked waiters
 typedef unsigned int objc_lock;
 
+// Contention counters, only maintained while enabled
+extern volatile int objc_lock_statisticsEnabled;
+
+void objc_lock_countAcquisition(void);
+void objc_lock_lockContended(volatile objc_lock *__lock);
+void objc_lock_wake(volatile objc_lock *__lock);
+
 static inline bool objc_lock_try(volatile objc_lock *__lock) {
     return __sync_bool_compare_and_swap(__lock, 0, 1);
 }
 
 static inline void objc_lock_lock(volatile objc_lock *__lock) {
-    while(!__sync_bool_compare_and_swap(__lock, 0, 1)) {
-#ifdef WIN32
-        Sleep(0);
-#else
-        usleep(1);
-#endif
-    }
+    if(__builtin_expect(objc_lock_statisticsEnabled, 0))
+        objc_lock_countAcquisition();
+
+    if(!__sync_bool_compare_and_swap(__lock, 0, 1))
+        objc_lock_lockContended(__lock);
 }
 
 static inline void objc_lock_unlock(volatile objc_lock *__lock) {
-    __sync_bool_compare_and_swap(__lock, 1, 0);
+    if(OBJCAtomicExchange(__lock, 0) == 2)
+        objc_lock_wake(__lock);
 }
@@ -10,7 +10,9 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #import <objc/message.h>
 #import "objc_cache.h"
 #import "objc_class.h"
+#import "objc_atomic.h"
 #import "objc_log.h"
+#import "objc_profile.h"
 
 //we must return a 64 bit type for clearing both registers (32 bit systems)
 static unsigned long long nil_message(id object, SEL message, ...) {
@@ -18,38 +20,34 @@ static unsigned long long nil_message(id object, SEL message, ...) {
 }
 
 IMP objc_msg_lookup(id object, SEL selector) {
+    if(__builtin_expect(objc_profile_enabled, 0))
+        OBJCProfileSend((object != nil) ? OBJCObjectGetClass(object) : Nil, selector, __builtin_return_address(0));
+
     if(object == nil)
         return (IMP)nil_message;
     else {
-        OBJCMethodCache *cache = object->isa->cache;
-        uintptr_t index = (uintptr_t)sel_getSelector(selector) & OBJCMethodCacheMask;
-        OBJCMethodCacheEntry *checkEntry = ((void *)cache->table) + index;
-
-        do {
-            struct objc_method *check = checkEntry->method;
-
-            if(((SEL)check->method_name) == sel_getSelector(selector))
-                return check->method_imp;
+        OBJCCacheRegisterReader();
+        OBJCMethodCache *cache = OBJCAtomicLoad(&OBJCObjectGetClass(object)->cache);
+        struct objc_method *check = OBJCMethodCacheLookup(cache, sel_getSelector(selector));
 
-            checkEntry = ((void *)checkEntry) + checkEntry->offsetToNextEntry;
-        } while(checkEntry != NULL);
+        // negative entries have a NULL imp, the slow path turns those into the forward handler
+        if(check != NULL && check->method_imp != NULL)
+            return check->method_imp;
     }
 
     return OBJCInitializeLookupAndCacheUniqueIdForObject(object, selector);
 }
 
 IMP objc_msg_lookup_super(struct objc_super *super, SEL selector) {
-    uintptr_t index = (uintptr_t)sel_getSelector(selector) & OBJCMethodCacheMask;
-    OBJCMethodCacheEntry *checkEntry = ((void *)super->super_class->cache->table) + index;
-
-    do {
-        struct objc_method *check = checkEntry->method;
+    if(__builtin_expect(objc_profile_enabled, 0))
+        OBJCProfileSend(super->super_class, selector, __builtin_return_address(0));
 
-        if(((SEL)check->method_name) == sel_getSelector(selector))
-            return check->method_imp;
+    OBJCCacheRegisterReader();
+    OBJCMethodCache *cache = OBJCAtomicLoad(&super->super_class->cache);
+    struct objc_method *check = OBJCMethodCacheLookup(cache, sel_getSelector(selector));
 
-        checkEntry = ((void *)checkEntry) + checkEntry->offsetToNextEntry;
-    } while(checkEntry != NULL);
+    if(check != NULL && check->method_imp != NULL)
+        return check->method_imp;
 
     return OBJCLookupAndCacheUniqueIdForSuper(super, selector);
 }
@@ -7,12 +7,20 @@ The above copyright notice and this permission notice shall be included in all c
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #import <objc/runtime.h>
 #import "objc_class.h"
+#import "objc_census.h"
+
+Class objc_taggedPointerClasses[OBJC_TAG_SLOT_COUNT];
+
+void objc_registerTaggedPointerClass(unsigned slot, Class cls) {
+    if(slot < OBJC_TAG_SLOT_COUNT)
+        objc_taggedPointerClasses[slot] = cls;
+}
 
 Class object_getClass(id object) {
     if(object == nil) {
         return Nil;
     }
-    return object->isa;
+    return OBJCObjectGetClass(object);
 }
 
 const char *object_getClassName(id object) {
@@ -41,6 +49,9 @@ void *object_getIndexedIvars(id object) {
 Class object_setClass(id object, Class cls) {
     if(object == nil)
         return Nil;
+    // there is no isa to change
+    if(objc_isTaggedPointer(object))
+        return OBJCObjectGetClass(object);
 
     Class result = object->isa;
 
@@ -78,6 +89,8 @@ id object_copy(id object, size_t size) {
 }
 
 id object_dispose(id object) {
+    if(objc_census_enabled && object != nil)
+        OBJCCensusCountDeallocation(object->isa);
     free(object);
     return nil;
 }
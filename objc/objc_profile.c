@@ -0,0 +1,394 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#if !defined(WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // for dladdr(), before anything pulls in features.h
+#endif
+#import "objc_profile.h"
+#import "objc_class.h"
+#import "objc_lock.h"
+#import "objc_atomic.h"
+#import "objc_tls.h"
+#import <stdio.h>
+#import <stdlib.h>
+#import <string.h>
+#import <time.h>
+
+#ifndef WIN32
+#import <dlfcn.h>
+#endif
+
+// Every thread which sends while profiling is on gets a fixed size open addressed table of
+// (class, selector, call site) samples. Only the owning thread writes it: a slot's key is
+// filled in before the slot is published, the counters are single writer, so a merge can
+// read every live buffer without stopping the threads. A full table counts what it drops
+// instead of growing, a reader must never see the slots move.
+//
+// A sample also measures the time until the thread's next send, that is roughly the cost of
+// the method itself up to its first message, so the next send after a sample always comes
+// through here to close the measurement.
+
+#define OBJC_PROFILE_BUFFER_CAPACITY 4096 // power of 2
+#define OBJC_PROFILE_DEFAULT_INTERVAL 997 // prime, so it does not beat with loops
+
+typedef struct {
+    volatile int used;
+    Class cls;
+    SEL selector;
+    void *caller;
+    volatile unsigned long sends; // samples weighted by the interval they were taken at
+    volatile unsigned long samples;
+    volatile unsigned long long cycles;
+} objc_profile_slot;
+
+typedef struct objc_profile_buffer {
+    unsigned long generation;
+    long countdown;
+    objc_profile_slot *pending;
+    unsigned long long pendingStart;
+    volatile unsigned long dropped;
+    objc_profile_slot slots[OBJC_PROFILE_BUFFER_CAPACITY];
+} objc_profile_buffer;
+
+// Merged samples, for threads which have exited and for building snapshots
+typedef struct {
+    unsigned count;
+    unsigned capacity;
+    objc_profile_slot *slots;
+} objc_profile_table;
+
+volatile int objc_profile_enabled = 0;
+
+static volatile unsigned long profileInterval = OBJC_PROFILE_DEFAULT_INTERVAL;
+static volatile unsigned long profileGeneration = 1;
+static objc_lock profileLock = 0;
+static objc_profile_table retired = { 0, 0, NULL };
+static unsigned long retiredDropped = 0;
+
+static inline unsigned long long OBJCProfileTimestamp(void) {
+#if defined(__i386__) || defined(__x86_64__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL + now.tv_nsec;
+#endif
+}
+
+static inline uintptr_t OBJCProfileHash(Class cls, SEL selector, void *caller) {
+    uintptr_t hash = (uintptr_t)cls ^ ((uintptr_t)selector << 7) ^ ((uintptr_t)caller << 13);
+
+    return hash ^ (hash >> 16) ^ (hash >> 5);
+}
+
+static objc_profile_slot *OBJCProfileBufferSlot(objc_profile_buffer *buffer, Class cls, SEL selector, void *caller) {
+    uintptr_t index = OBJCProfileHash(cls, selector, caller);
+    unsigned probes;
+
+    for(probes = 0; probes < OBJC_PROFILE_BUFFER_CAPACITY / 2; probes++, index++) {
+        objc_profile_slot *slot = buffer->slots + (index & (OBJC_PROFILE_BUFFER_CAPACITY - 1));
+
+        if(!slot->used) {
+            slot->cls = cls;
+            slot->selector = selector;
+            slot->caller = caller;
+            OBJCAtomicStore(&slot->used, 1);
+            return slot;
+        }
+        if(slot->cls == cls && slot->selector == selector && slot->caller == caller)
+            return slot;
+    }
+
+    return NULL;
+}
+
+static void OBJCProfileBufferClear(objc_profile_buffer *buffer, unsigned long generation) {
+    memset(buffer->slots, 0, sizeof(buffer->slots));
+    buffer->dropped = 0;
+    buffer->pending = NULL;
+    OBJCAtomicStore(&buffer->generation, generation);
+}
+
+void OBJCProfileSend(Class cls, SEL selector, void *caller) {
+    objc_tls *tls = objc_tlsCurrent();
+    objc_profile_buffer *buffer = tls->profile;
+    unsigned long generation = profileGeneration;
+    unsigned long long now;
+    objc_profile_slot *slot;
+
+    if(buffer == NULL) {
+        if((buffer = calloc(1, sizeof(objc_profile_buffer))) == NULL)
+            return;
+        buffer->generation = generation;
+        tls->profile = buffer;
+    }
+
+    if(--buffer->countdown > 0)
+        return;
+
+    now = OBJCProfileTimestamp();
+
+    if(buffer->generation != generation)
+        OBJCProfileBufferClear(buffer, generation);
+
+    if(buffer->pending != NULL) {
+        OBJCAtomicStoreRelaxed(&buffer->pending->cycles, buffer->pending->cycles + (now - buffer->pendingStart));
+        buffer->pending = NULL;
+        if((buffer->countdown = profileInterval - 1) > 0)
+            return;
+    }
+
+    if((slot = OBJCProfileBufferSlot(buffer, cls, selector, caller)) == NULL) {
+        OBJCAtomicStoreRelaxed(&buffer->dropped, buffer->dropped + 1);
+        buffer->countdown = profileInterval;
+        return;
+    }
+
+    OBJCAtomicStoreRelaxed(&slot->sends, slot->sends + profileInterval);
+    OBJCAtomicStoreRelaxed(&slot->samples, slot->samples + 1);
+    buffer->pending = slot;
+    buffer->countdown = 1;
+    buffer->pendingStart = OBJCProfileTimestamp();
+}
+
+static void OBJCProfileTableAdd(objc_profile_table *table, Class cls, SEL selector, void *caller, unsigned long sends, unsigned long samples, unsigned long long cycles) {
+    uintptr_t index;
+
+    if(table->count * 2 >= table->capacity) {
+        objc_profile_table grown = { 0, (table->capacity == 0) ? 256 : table->capacity * 2, NULL };
+        unsigned i;
+
+        grown.slots = calloc(grown.capacity, sizeof(objc_profile_slot));
+        for(i = 0; i < table->capacity; i++)
+            if(table->slots[i].used)
+                OBJCProfileTableAdd(&grown, table->slots[i].cls, table->slots[i].selector, table->slots[i].caller, table->slots[i].sends, table->slots[i].samples, table->slots[i].cycles);
+        free(table->slots);
+        *table = grown;
+    }
+
+    for(index = OBJCProfileHash(cls, selector, caller);; index++) {
+        objc_profile_slot *slot = table->slots + (index & (table->capacity - 1));
+
+        if(!slot->used) {
+            slot->used = 1;
+            slot->cls = cls;
+            slot->selector = selector;
+            slot->caller = caller;
+            table->count++;
+        } else if(slot->cls != cls || slot->selector != selector || slot->caller != caller)
+            continue;
+
+        slot->sends += sends;
+        slot->samples += samples;
+        slot->cycles += cycles;
+        return;
+    }
+}
+
+static unsigned long OBJCProfileTableAddBuffer(objc_profile_table *table, objc_profile_buffer *buffer, unsigned long generation) {
+    unsigned i;
+
+    if(OBJCAtomicLoad(&buffer->generation) != generation)
+        return 0;
+
+    for(i = 0; i < OBJC_PROFILE_BUFFER_CAPACITY; i++) {
+        objc_profile_slot *slot = buffer->slots + i;
+
+        if(OBJCAtomicLoad(&slot->used))
+            OBJCProfileTableAdd(table, slot->cls, slot->selector, slot->caller, OBJCAtomicLoadRelaxed(&slot->sends), OBJCAtomicLoadRelaxed(&slot->samples), OBJCAtomicLoadRelaxed(&slot->cycles));
+    }
+
+    return buffer->dropped;
+}
+
+void OBJCProfileThreadExit(objc_profile_buffer *buffer) {
+    objc_lock_lock(&profileLock);
+    retiredDropped += OBJCProfileTableAddBuffer(&retired, buffer, profileGeneration);
+    objc_lock_unlock(&profileLock);
+
+    free(buffer);
+}
+
+typedef struct {
+    objc_profile_table *table;
+    unsigned long generation;
+    unsigned long dropped;
+} objc_profile_merge;
+
+static void OBJCProfileMergeThread(objc_tls *tls, void *context) {
+    objc_profile_merge *merge = context;
+
+    if(tls->profile != NULL)
+        merge->dropped += OBJCProfileTableAddBuffer(merge->table, tls->profile, merge->generation);
+}
+
+// Samples of every thread, the live ones are read while they keep running
+static unsigned long OBJCProfileSnapshot(objc_profile_table *table) {
+    objc_profile_merge merge = { table, 0, 0 };
+    unsigned i;
+
+    objc_lock_lock(&profileLock);
+    merge.generation = profileGeneration;
+    merge.dropped = retiredDropped;
+    for(i = 0; i < retired.capacity; i++)
+        if(retired.slots[i].used)
+            OBJCProfileTableAdd(table, retired.slots[i].cls, retired.slots[i].selector, retired.slots[i].caller, retired.slots[i].sends, retired.slots[i].samples, retired.slots[i].cycles);
+    objc_tlsEnumerate(OBJCProfileMergeThread, &merge);
+    objc_lock_unlock(&profileLock);
+
+    return merge.dropped;
+}
+
+void objc_startMessageProfiling(unsigned interval) {
+    profileInterval = (interval == 0) ? OBJC_PROFILE_DEFAULT_INTERVAL : interval;
+    objc_profile_enabled = 1;
+}
+
+void objc_stopMessageProfiling(void) {
+    objc_profile_enabled = 0;
+}
+
+void objc_resetMessageProfile(void) {
+    objc_lock_lock(&profileLock);
+    free(retired.slots);
+    retired.slots = NULL;
+    retired.count = retired.capacity = 0;
+    retiredDropped = 0;
+    // live buffers notice at their next sample and clear themselves, merges skip them until then
+    __sync_fetch_and_add(&profileGeneration, 1);
+    objc_lock_unlock(&profileLock);
+}
+
+static int OBJCProfileEntryCompare(const void *a, const void *b) {
+    const objc_message_profile_entry *entry = a, *other = b;
+
+    if(entry->sends != other->sends)
+        return (entry->sends > other->sends) ? -1 : 1;
+    if(entry->cycles != other->cycles)
+        return (entry->cycles > other->cycles) ? -1 : 1;
+
+    return 0;
+}
+
+static objc_message_profile_entry *OBJCProfileCopyEntries(unsigned *countp, unsigned long *droppedp) {
+    objc_profile_table table = { 0, 0, NULL }, byMessage = { 0, 0, NULL };
+    objc_message_profile_entry *result;
+    unsigned i, count = 0;
+
+    *droppedp = OBJCProfileSnapshot(&table);
+
+    // the call site is only kept for collapsed stacks
+    for(i = 0; i < table.capacity; i++)
+        if(table.slots[i].used)
+            OBJCProfileTableAdd(&byMessage, table.slots[i].cls, table.slots[i].selector, NULL, table.slots[i].sends, table.slots[i].samples, table.slots[i].cycles);
+    free(table.slots);
+
+    result = malloc(sizeof(objc_message_profile_entry) * (byMessage.count + 1));
+    for(i = 0; i < byMessage.capacity; i++) {
+        objc_profile_slot *slot = byMessage.slots + i;
+
+        if(slot->used) {
+            result[count].cls = slot->cls;
+            result[count].selector = slot->selector;
+            result[count].sends = slot->sends;
+            result[count].samples = slot->samples;
+            result[count].cycles = slot->cycles;
+            count++;
+        }
+    }
+    free(byMessage.slots);
+
+    qsort(result, count, sizeof(objc_message_profile_entry), OBJCProfileEntryCompare);
+    *countp = count;
+
+    return result;
+}
+
+objc_message_profile_entry *objc_copyMessageProfile(unsigned *countp) {
+    unsigned count;
+    unsigned long dropped;
+    objc_message_profile_entry *result = OBJCProfileCopyEntries(&count, &dropped);
+
+    if(countp != NULL)
+        *countp = count;
+
+    return result;
+}
+
+static void OBJCProfileWriteMessage(FILE *file, Class cls, SEL selector) {
+    if(cls == Nil)
+        fprintf(file, "nil %s", sel_getName(selector));
+    else
+        fprintf(file, "%c[%s %s]", class_isMetaClass(cls) ? '+' : '-', class_getName(cls), sel_getName(selector));
+}
+
+static void OBJCProfileWriteCaller(FILE *file, void *caller) {
+#ifndef WIN32
+    Dl_info info;
+
+    if(dladdr(caller, &info) && info.dli_sname != NULL) {
+        fprintf(file, "%s", info.dli_sname);
+        return;
+    }
+#endif
+    fprintf(file, "%p", caller);
+}
+
+BOOL objc_writeMessageProfile(const char *path, objc_message_profile_format format) {
+    FILE *file = (path == NULL) ? stderr : fopen(path, "w");
+    unsigned long interval = profileInterval;
+    unsigned i;
+
+    if(file == NULL)
+        return NO;
+
+    if(format == OBJC_PROFILE_COLLAPSED_STACKS) {
+        objc_profile_table table = { 0, 0, NULL };
+
+        // one line per call site and message, weighted by estimated sends
+        OBJCProfileSnapshot(&table);
+        for(i = 0; i < table.capacity; i++) {
+            objc_profile_slot *slot = table.slots + i;
+
+            if(slot->used) {
+                OBJCProfileWriteCaller(file, slot->caller);
+                fputc(';', file);
+                OBJCProfileWriteMessage(file, slot->cls, slot->selector);
+                fprintf(file, " %lu\n", slot->sends);
+            }
+        }
+        free(table.slots);
+    } else {
+        unsigned count;
+        unsigned long dropped;
+        objc_message_profile_entry *entries = OBJCProfileCopyEntries(&count, &dropped);
+        unsigned long long totalSends = 0, totalSamples = 0, totalCycles = 0;
+
+        for(i = 0; i < count; i++) {
+            totalSends += entries[i].sends;
+            totalSamples += entries[i].samples;
+            totalCycles += entries[i].cycles;
+        }
+
+        fprintf(file, "%llu samples, 1 in %lu sends, %llu ticks, %lu samples dropped by full buffers\n", totalSamples, interval, totalCycles, dropped);
+        fprintf(file, "%14s %7s %14s %12s  %s\n", "sends", "%", "ticks", "ticks/sample", "message");
+        for(i = 0; i < count; i++) {
+            fprintf(file, "%14lu %6.2f%% %14llu %12.1f  ", entries[i].sends, (totalSends == 0) ? 0.0 : 100.0 * entries[i].sends / totalSends, entries[i].cycles, (double)entries[i].cycles / entries[i].samples);
+            OBJCProfileWriteMessage(file, entries[i].cls, entries[i].selector);
+            fputc('\n', file);
+        }
+        free(entries);
+    }
+
+    if(file != stderr)
+        fclose(file);
+    else
+        fflush(file);
+
+    return YES;
+}
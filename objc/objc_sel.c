@@ -6,50 +6,247 @@ The above copyright notice and this permission notice shall be included in all c
 
 THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #import "objc_sel.h"
-#import "ObjCHashTable.h"
 #import "objc_log.h"
 #import "objc_malloc.h"
 #import "objc_class.h"
 #import "objc_cache.h"
+#import "objc_lock.h"
+#import "objc_atomic.h"
+#import <stdint.h>
+
+// Selector names are uniqued in two places. The selectors the frameworks declare or implement
+// are in a static perfect hash table (objc_sel_builtin.h, generated by
+// Tools/Scripts/generate-builtin-selectors) so most lookups are one probe into read only data
+// and those selectors are never registered at all. Anything else goes into an open
+// addressed table which is read without locking: a slot is filled in before its key is
+// published, the table is replaced when it grows and old tables are never freed, a reader may
+// still be probing one. They add up to less than the size of the current table.
+
+typedef struct {
+    uint64_t hash;
+    const char *name;
+} OBJCBuiltinSelector;
+
+#import "objc_sel_builtin.h"
+
+typedef struct {
+    const char *volatile key;
+    const void *value;
+    uint64_t hash;
+} OBJCSelectorSlot;
+
+typedef struct OBJCSelectorTable {
+    struct OBJCSelectorTable *retired;
+    uintptr_t mask;
+    uintptr_t count;
+    OBJCSelectorSlot slots[1];
+} OBJCSelectorTable;
+
+#define INITIAL_SELECTOR_TABLE_SIZE 4096 // power of 2
+
+static objc_lock selectorLock = 0;
+static OBJCSelectorTable *volatile nameToNumber = NULL;
+#ifdef OBJC_TYPED_SELECTORS
+static OBJCSelectorTable *volatile nameToSelector = NULL;
+#endif
 
-#define INITIAL_SELECTOR_TABLE_SIZE 4096 // Big System has about 3700 selectors
+#ifndef __has_attribute
+#define __has_attribute(x) 0
+#endif
 
-static OBJCHashTable *nameToNumber = NULL;
-static OBJCHashTable *nameToSelector = NULL;
+// the word loads may read past the terminator, never past its page
+#if __has_attribute(no_sanitize_address)
+#define OBJC_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define OBJC_NO_SANITIZE_ADDRESS
+#endif
 
-const char *sel_registerNameNoCopy(const char *name) {
-    const char *result;
+static inline uint64_t OBJCSelectorRotate(uint64_t value, int count) {
+    return (value << count) | (value >> (64 - count));
+}
 
-    if(nameToNumber == NULL)
-        nameToNumber = OBJCCreateHashTable(INITIAL_SELECTOR_TABLE_SIZE);
+OBJC_NO_SANITIZE_ADDRESS static inline uint64_t OBJCSelectorLoadWord(const unsigned char *bytes) {
+    uint64_t word;
 
-    result = OBJCHashValueForKey(nameToNumber, name);
+    memcpy(&word, bytes, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
 
-    if(result == NULL) {
-        result = OBJCHashInsertValueForKey(nameToNumber, name, name);
+// Hashes eight bytes at a time, little endian order whatever the host. A word is loaded whole
+// unless it would cross into the next page, the bytes past the terminator are masked off.
+OBJC_NO_SANITIZE_ADDRESS static uint64_t OBJCSelectorHash(const char *name) {
+    const unsigned char *bytes = (const unsigned char *)name;
+    uint64_t result = 0;
+    size_t length = 0;
+
+    for(;;) {
+        uint64_t word, zeros;
+
+        if(((uintptr_t)bytes & 4095) <= 4096 - sizeof(uint64_t))
+            word = OBJCSelectorLoadWord(bytes);
+        else {
+            int i;
+
+            for(i = 0, word = 0; i < 8; i++) {
+                word |= (uint64_t)bytes[i] << (i * 8);
+                if(bytes[i] == '\0')
+                    break;
+            }
+        }
+
+        zeros = (word - 0x0101010101010101ULL) & ~word & 0x8080808080808080ULL;
+
+        if(zeros != 0) {
+            int count = __builtin_ctzll(zeros) / 8;
+
+            if(count > 0)
+                result = OBJCSelectorRotate((result ^ (word & ((1ULL << (count * 8)) - 1))) * 0x9E3779B97F4A7C15ULL, 31);
+            length += count;
+            break;
+        }
+
+        result = OBJCSelectorRotate((result ^ word) * 0x9E3779B97F4A7C15ULL, 31);
+        length += 8;
+        bytes += 8;
+    }
+
+    result ^= length * 0xC2B2AE3D27D4EB4FULL;
+    result ^= result >> 29;
+    result *= 0xFF51AFD7ED558CCDULL;
+    result ^= result >> 32;
+
+    return result;
+}
+
+static const char *OBJCBuiltinSelectorLookup(const char *name, uint64_t hash) {
+    uint32_t low = (uint32_t)hash;
+    uint64_t displacement = OBJCBuiltinSelectorDisplacements[low % OBJC_BUILTIN_SELECTOR_BUCKETS];
+    const OBJCBuiltinSelector *check = OBJCBuiltinSelectors + ((hash >> 32) + displacement * (low | 1)) % OBJC_BUILTIN_SELECTOR_SLOTS;
+
+    if(check->hash == hash && check->name != NULL && strcmp(check->name, name) == 0)
+        return check->name;
+
+    return NULL;
+}
+
+static const void *OBJCSelectorTableLookup(OBJCSelectorTable *table, const char *key, uint64_t hash) {
+    uintptr_t index;
+
+    if(table == NULL)
+        return NULL;
+
+    for(index = hash & table->mask;; index = (index + 1) & table->mask) {
+        OBJCSelectorSlot *slot = table->slots + index;
+        const char *check = OBJCAtomicLoad(&slot->key);
+
+        if(check == NULL)
+            return NULL;
+        if(slot->hash == hash && (check == key || strcmp(check, key) == 0))
+            return slot->value;
     }
+}
+
+static OBJCSelectorTable *OBJCSelectorTableCreate(uintptr_t capacity) {
+    OBJCSelectorTable *result = objc_calloc(1, sizeof(OBJCSelectorTable) + (capacity - 1) * sizeof(OBJCSelectorSlot));
+
+    result->mask = capacity - 1;
 
     return result;
 }
 
+static void OBJCSelectorTableStore(OBJCSelectorTable *table, const char *key, uint64_t hash, const void *value) {
+    uintptr_t index;
+
+    for(index = hash & table->mask; table->slots[index].key != NULL; index = (index + 1) & table->mask)
+        ;
+
+    table->slots[index].hash = hash;
+    table->slots[index].value = value;
+    OBJCAtomicStore(&table->slots[index].key, key);
+    table->count++;
+}
+
+// called with selectorLock held, the table is kept at most 3/4 full
+static void OBJCSelectorTableInsert(OBJCSelectorTable *volatile *tablep, const char *key, uint64_t hash, const void *value) {
+    OBJCSelectorTable *table = *tablep;
+
+    if(table == NULL)
+        OBJCAtomicStore(tablep, table = OBJCSelectorTableCreate(INITIAL_SELECTOR_TABLE_SIZE));
+    else if((table->count + 1) * 4 > (table->mask + 1) * 3) {
+        OBJCSelectorTable *grown = OBJCSelectorTableCreate((table->mask + 1) * 2);
+        uintptr_t i;
+
+        for(i = 0; i <= table->mask; i++)
+            if(table->slots[i].key != NULL)
+                OBJCSelectorTableStore(grown, table->slots[i].key, table->slots[i].hash, table->slots[i].value);
+
+        grown->retired = table;
+        OBJCAtomicStore(tablep, table = grown);
+    }
+
+    OBJCSelectorTableStore(table, key, hash, value);
+}
+
+static inline OBJCSelectorTable *OBJCSelectorTableCurrent(OBJCSelectorTable *volatile *tablep) {
+    return OBJCAtomicLoad(tablep);
+}
+
+// the unique name for name, name itself if it is new
+static const char *OBJCRegisterNameWithHash(const char *name, uint64_t hash) {
+    const char *result;
+
+    if((result = OBJCBuiltinSelectorLookup(name, hash)) != NULL)
+        return result;
+    if((result = OBJCSelectorTableLookup(OBJCSelectorTableCurrent(&nameToNumber), name, hash)) != NULL)
+        return result;
+
+    objc_lock_lock(&selectorLock);
+    if((result = OBJCSelectorTableLookup(nameToNumber, name, hash)) == NULL) {
+        OBJCSelectorTableInsert(&nameToNumber, name, hash, name);
+        result = name;
+    }
+    objc_lock_unlock(&selectorLock);
+
+    return result;
+}
+
+static const char *OBJCLookupName(const char *name, uint64_t hash) {
+    const char *result;
+
+    if((result = OBJCBuiltinSelectorLookup(name, hash)) != NULL)
+        return result;
+
+    return OBJCSelectorTableLookup(OBJCSelectorTableCurrent(&nameToNumber), name, hash);
+}
+
+const char *sel_registerNameNoCopy(const char *name) {
+    return OBJCRegisterNameWithHash(name, OBJCSelectorHash(name));
+}
+
 SEL sel_registerSelectorNoCopyName(const char *name) {
 #ifndef OBJC_TYPED_SELECTORS
     return sel_registerNameNoCopy(name);
 #else
-    SEL result;
-
-    if(nameToSelector == NULL)
-        nameToSelector = OBJCCreateHashTable(INITIAL_SELECTOR_TABLE_SIZE);
-
-    result = (SEL)OBJCHashValueForKey(nameToSelector, name);
+    uint64_t hash = OBJCSelectorHash(name);
+    SEL result = (SEL)OBJCSelectorTableLookup(OBJCSelectorTableCurrent(&nameToSelector), name, hash);
 
     if(result == NULL) {
-        objc_selector_internal *ughp;
-
-        ughp = objc_malloc(sizeof(objc_selector_internal));
-        ughp->name = sel_registerNameNoCopy(name);
-
-        result = (SEL)OBJCHashInsertValueForKey(nameToSelector, (char *)name, ughp);
+        const char *unique = OBJCRegisterNameWithHash(name, hash);
+
+        objc_lock_lock(&selectorLock);
+        if((result = (SEL)OBJCSelectorTableLookup(nameToSelector, unique, hash)) == NULL) {
+            objc_selector_internal *ughp;
+
+            ughp = objc_malloc(sizeof(objc_selector_internal));
+            ughp->name = unique;
+            ughp->types = NULL;
+            OBJCSelectorTableInsert(&nameToSelector, unique, hash, ughp);
+            result = (SEL)ughp;
+        }
+        objc_lock_unlock(&selectorLock);
     }
 
     return result;
@@ -60,43 +257,34 @@ const char *sel_getName(SEL selector) {
     if(selector == NULL)
         return NULL;
 
-    if(nameToNumber == NULL)
-        return NULL;
-
     selector = sel_getSelector(selector);
 
-    return (const char *)OBJCHashValueForKey(nameToNumber, selector);
+    return OBJCLookupName((const char *)selector, OBJCSelectorHash((const char *)selector));
 }
 
 SEL sel_getUid(const char *selectorName) {
+    uint64_t hash = OBJCSelectorHash(selectorName);
     SEL result;
 
 #ifndef OBJC_TYPED_SELECTORS
-    if(nameToNumber == NULL)
-        result = NULL;
-    else
-        result = (SEL)OBJCHashValueForKey(nameToNumber, selectorName);
-
-    if(result == NULL) {
-        char *copy = objc_malloc(sizeof(char) * (strlen(selectorName) + 1));
-
-        strcpy(copy, selectorName);
-        result = (SEL)sel_registerNameNoCopy(copy);
-    }
+    result = (SEL)OBJCLookupName(selectorName, hash);
 #else
-    if(nameToSelector == NULL)
-        result = NULL;
-    else
-        result = (SEL)OBJCHashValueForKey(nameToSelector, selectorName);
+    result = (SEL)OBJCSelectorTableLookup(OBJCSelectorTableCurrent(&nameToSelector), selectorName, hash);
+#endif
 
     if(result == NULL) {
         char *copy = objc_malloc(sizeof(char) * (strlen(selectorName) + 1));
 
         strcpy(copy, selectorName);
-
+#ifndef OBJC_TYPED_SELECTORS
+        result = (SEL)OBJCRegisterNameWithHash(copy, hash);
+#else
         result = sel_registerSelectorNoCopyName(copy);
-    }
 #endif
+        // somebody else registered it first
+        if((const char *)sel_getSelector(result) != copy)
+            objc_free(copy);
+    }
 
     return result;
 }
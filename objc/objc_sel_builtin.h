@@ -0,0 +1,8110 @@
+// Generated by Tools/Scripts/generate-builtin-selectors, do not edit.
+// 6399 selectors declared or implemented in Foundation and AppKit.
+
+#define OBJC_BUILTIN_SELECTOR_SLOTS 7999
+#define OBJC_BUILTIN_SELECTOR_BUCKETS 1599
+
+static const uint16_t OBJCBuiltinSelectorDisplacements[OBJC_BUILTIN_SELECTOR_BUCKETS] = {
+    13, 29, 13, 3, 0, 29, 5, 1, 0, 2, 2, 3, 0, 0, 21, 7,
+    13, 12, 1, 11, 30, 3, 5, 8, 48, 4, 12, 1, 0, 1, 1, 4,
+    3, 18, 31, 6, 4, 3, 0, 2, 4, 0, 16, 10, 4, 11, 0, 3,
+    15, 91, 0, 2, 8, 3, 15, 0, 0, 4, 30, 0, 15, 6, 2, 4,
+    0, 11, 27, 20, 0, 42, 8, 12, 11, 11, 4, 2, 8, 16, 17, 0,
+    12, 1, 1, 0, 1, 21, 4, 1, 0, 47, 32, 5, 1, 0, 15, 56,
+    7, 9, 9, 11, 2, 11, 35, 1, 0, 0, 3, 5, 0, 25, 3, 31,
+    0, 6, 1, 1, 3, 2, 1, 1, 11, 18, 6, 2, 35, 2, 3, 8,
+    4, 9, 0, 6, 2, 5, 0, 0, 40, 4, 2, 1, 1, 0, 9, 14,
+    6, 0, 4, 8, 18, 29, 5, 2, 0, 11, 4, 22, 1, 16, 9, 0,
+    2, 3, 2, 19, 24, 2, 0, 10, 2, 54, 9, 28, 2, 5, 1, 13,
+    2, 16, 4, 7, 2, 11, 7, 12, 6, 0, 1, 0, 19, 23, 1, 14,
+    6, 24, 2, 25, 11, 10, 36, 2, 7, 13, 14, 1, 11, 15, 1, 4,
+    0, 4, 8, 11, 0, 2, 14, 0, 19, 39, 0, 6, 3, 1, 0, 25,
+    2, 3, 7, 8, 2, 0, 0, 35, 9, 1, 12, 9, 13, 12, 0, 1,
+    1, 2, 0, 1, 4, 0, 0, 18, 0, 10, 3, 0, 2, 4, 8, 3,
+    0, 42, 4, 23, 5, 3, 2, 2, 13, 0, 2, 3, 3, 7, 6, 18,
+    0, 1, 0, 13, 24, 14, 2, 4, 1, 1, 10, 1, 4, 8, 5, 0,
+    9, 10, 4, 1, 8, 4, 2, 25, 4, 0, 3, 26, 21, 2, 0, 2,
+    14, 5, 1, 33, 4, 13, 20, 18, 0, 7, 7, 0, 12, 0, 23, 2,
+    14, 0, 1, 20, 3, 34, 5, 12, 1, 28, 20, 34, 25, 5, 28, 7,
+    0, 15, 1, 1, 5, 1, 0, 6, 6, 8, 22, 6, 13, 22, 3, 0,
+    23, 5, 0, 15, 20, 33, 35, 2, 0, 0, 4, 0, 22, 0, 60, 7,
+    41, 0, 1, 8, 4, 0, 0, 7, 0, 27, 7, 30, 1, 0, 11, 4,
+    6, 6, 8, 33, 3, 1, 1, 8, 9, 1, 5, 16, 11, 0, 3, 15,
+    8, 5, 3, 1, 4, 7, 9, 0, 6, 0, 0, 13, 4, 2, 14, 4,
+    48, 3, 25, 0, 8, 6, 4, 38, 14, 1, 19, 2, 2, 13, 41, 3,
+    42, 1, 4, 1, 32, 4, 1, 1, 3, 2, 2, 0, 13, 3, 0, 5,
+    13, 6, 4, 0, 10, 1, 34, 23, 2, 5, 17, 14, 16, 5, 0, 5,
+    4, 35, 1, 0, 35, 1, 55, 88, 26, 0, 14, 6, 22, 7, 39, 2,
+    22, 8, 4, 16, 3, 0, 10, 4, 3, 4, 30, 3, 9, 41, 5, 13,
+    0, 46, 20, 18, 10, 17, 2, 2, 6, 2, 4, 12, 33, 0, 1, 1,
+    1, 1, 20, 4, 2, 3, 9, 30, 16, 18, 3, 4, 4, 2, 19, 0,
+    17, 9, 8, 0, 6, 0, 45, 1, 55, 0, 13, 32, 0, 0, 0, 0,
+    1, 46, 0, 10, 33, 10, 0, 6, 15, 14, 0, 16, 1, 5, 9, 9,
+    0, 2, 21, 3, 18, 1, 1, 3, 16, 1, 12, 1, 3, 7, 7, 8,
+    6, 6, 0, 20, 0, 1, 4, 18, 4, 11, 0, 7, 9, 29, 0, 23,
+    0, 1, 3, 9, 2, 0, 5, 0, 22, 4, 0, 3, 1, 14, 0, 37,
+    0, 13, 24, 4, 1, 17, 0, 0, 1, 10, 11, 8, 27, 39, 4, 29,
+    25, 7, 0, 20, 113, 29, 9, 14, 1, 2, 3, 23, 4, 4, 40, 51,
+    2, 27, 1, 5, 19, 0, 53, 7, 7, 42, 18, 27, 0, 2, 1, 10,
+    4, 16, 39, 12, 0, 0, 2, 33, 20, 9, 2, 1, 1, 27, 1, 9,
+    0, 7, 0, 1, 11, 4, 4, 6, 12, 4, 6, 1, 1, 0, 6, 6,
+    1, 14, 2, 0, 0, 0, 4, 66, 24, 18, 80, 16, 1, 34, 23, 30,
+    5, 24, 8, 0, 4, 8, 16, 109, 22, 39, 5, 12, 8, 5, 6, 2,
+    4, 9, 10, 0, 2, 2, 15, 4, 35, 0, 7, 0, 58, 0, 11, 31,
+    4, 1, 43, 17, 9, 34, 7, 0, 9, 0, 53, 0, 18, 9, 29, 3,
+    134, 43, 5, 10, 54, 31, 0, 1, 14, 55, 11, 33, 0, 0, 0, 87,
+    28, 35, 5, 4, 0, 0, 3, 0, 0, 14, 7, 6, 11, 6, 4, 5,
+    13, 0, 61, 27, 45, 9, 2, 0, 52, 3, 6, 0, 46, 2, 0, 21,
+    28, 12, 2, 0, 5, 0, 9, 13, 0, 5, 15, 41, 0, 100, 9, 8,
+    3, 0, 27, 7, 0, 27, 1, 0, 5, 15, 1, 3, 3, 8, 9, 10,
+    1, 0, 3, 55, 64, 0, 13, 14, 3, 3, 25, 8, 6, 4, 2, 4,
+    19, 9, 52, 7, 0, 2, 0, 10, 17, 4, 3, 1, 23, 9, 90, 18,
+    0, 22, 21, 0, 4, 1, 1, 22, 16, 26, 10, 0, 38, 4, 30, 0,
+    2, 51, 8, 0, 6, 4, 4, 6, 7, 2, 25, 2, 0, 0, 1, 35,
+    11, 22, 2, 9, 19, 51, 0, 40, 2, 8, 4, 0, 35, 0, 1, 21,
+    11, 4, 3, 7, 15, 5, 0, 7, 8, 10, 9, 4, 40, 0, 3, 1,
+    0, 2, 1, 93, 27, 1, 15, 71, 81, 63, 35, 0, 25, 42, 5, 0,
+    3, 1, 127, 2, 67, 3, 0, 0, 4, 7, 6, 6, 0, 1, 5, 1,
+    18, 2, 49, 5, 0, 0, 9, 3, 4, 0, 0, 26, 7, 58, 10, 16,
+    0, 23, 1, 4, 11, 19, 14, 0, 11, 4, 34, 19, 4, 1, 2, 26,
+    59, 35, 0, 3, 17, 36, 17, 0, 18, 5, 0, 10, 21, 53, 19, 10,
+    34, 5, 15, 41, 11, 0, 0, 4, 22, 0, 53, 72, 46, 172, 1, 54,
+    13, 3, 1, 11, 19, 16, 15, 9, 1, 83, 33, 4, 1, 3, 18, 20,
+    5, 61, 6, 24, 6, 2, 20, 18, 66, 4, 0, 1, 16, 4, 6, 12,
+    44, 4, 2, 0, 1, 4, 29, 0, 7, 0, 3, 9, 36, 6, 7, 2,
+    10, 9, 1, 25, 17, 22, 0, 34, 30, 0, 2, 29, 7, 6, 10, 12,
+    58, 21, 0, 16, 13, 39, 25, 15, 13, 13, 0, 6, 13, 11, 97, 3,
+    0, 22, 207, 0, 0, 6, 21, 19, 10, 0, 0, 6, 16, 1, 27, 6,
+    7, 12, 11, 8, 15, 21, 17, 16, 2, 11, 8, 2, 0, 2, 22, 14,
+    2, 6, 12, 2, 8, 3, 0, 0, 12, 13, 28, 0, 14, 3, 15, 15,
+    8, 19, 24, 18, 10, 22, 8, 1, 37, 5, 32, 78, 5, 19, 52, 20,
+    0, 36, 0, 2, 15, 1, 24, 40, 5, 31, 27, 15, 5, 4, 2, 33,
+    3, 6, 5, 9, 35, 4, 46, 59, 8, 0, 2, 15, 0, 18, 16, 5,
+    11, 1, 24, 50, 22, 7, 86, 3, 0, 0, 2, 1, 18, 8, 2, 0,
+    50, 62, 37, 3, 28, 6, 17, 1, 10, 93, 19, 1, 4, 0, 0, 3,
+    0, 8, 53, 21, 4, 5, 7, 102, 3, 0, 41, 16, 1, 48, 7, 9,
+    2, 7, 0, 2, 19, 68, 99, 0, 3, 17, 1, 22, 15, 8, 5, 7,
+    2, 102, 17, 1, 11, 20, 24, 7, 0, 8, 3, 19, 0, 8, 30, 18,
+    3, 102, 22, 0, 5, 45, 2, 11, 1, 3, 17, 21, 5, 12, 50, 15,
+    79, 6, 9, 42, 8, 0, 6, 25, 1, 4, 1, 16, 26, 16, 38, 39,
+    96, 2, 4, 30, 3, 0, 2, 12, 24, 14, 22, 2, 20, 33, 2, 13,
+    11, 13, 0, 7, 41, 0, 6, 67, 6, 1, 27, 1, 4, 22, 9, 14,
+    3, 19, 5, 10, 18, 23, 18, 40, 33, 43, 6, 60, 7, 4, 30, 10,
+    56, 2, 38, 18, 31, 47, 28, 5, 17, 8, 9, 14, 8, 14, 2, 22,
+    10, 15, 22, 9, 0, 3, 6, 15, 329, 56, 31, 6, 14, 9, 0, 4,
+    0, 7, 23, 7, 3, 35, 3, 35, 16, 3, 76, 12, 9, 1, 1, 1,
+    3, 32, 46, 9, 11, 34, 12, 4, 31, 3, 32, 37, 2, 1, 8, 37,
+    3, 11, 71, 0, 70, 0, 31, 114, 5, 11, 13, 2, 1, 4, 11, 60,
+    8, 5, 23, 59, 6, 1, 14, 4, 14, 0, 14, 61, 3, 15, 1, 3,
+    72, 13, 40, 13, 32, 2, 0, 0, 35, 3, 12, 14, 19, 1, 1, 15,
+    7, 17, 5, 4, 5, 10, 4, 0, 15, 2, 107, 11, 130, 38, 23, 19,
+    4, 71, 2, 41, 11, 12, 47, 46, 50, 17, 3, 4, 0, 9, 49, 23,
+    7, 19, 9, 2, 1, 30, 23, 9, 31, 22, 0, 33, 0, 29, 9, 30,
+    12, 12, 3, 4, 12, 15, 14, 4, 1, 25, 12, 2, 15, 13, 1, 6,
+    14, 1, 1, 15, 5, 3, 3, 11, 52, 0, 81, 0, 18, 0, 2, 1,
+    10, 4, 30, 3, 24, 21, 0, 0, 0, 16, 14, 12, 39, 5, 6, 77,
+    69, 8, 12, 0, 4, 1, 3, 14, 18, 92, 6, 21, 13, 22, 0, 7,
+    0, 20, 60, 17, 3, 3, 42, 1, 9, 0, 61, 5, 134, 0, 9,
+};
+
+static const OBJCBuiltinSelector OBJCBuiltinSelectors[OBJC_BUILTIN_SELECTOR_SLOTS] = {
+    { 0xb0459dc41618ec74ULL, "infoDictionary" },
+    { 0xf9336ea34b18b72aULL, "preferredFontNames" },
+    { 0x8676f9b2a72428c3ULL, "saturationComponent" },
+    { 0x6b425bfc99295b4bULL, "setAutovalidates:" },
+    { 0, NULL },
+    { 0x0329bc49dd483c52ULL, "draggingLocation" },
+    { 0xf2e724ea234bd6bfULL, "synchronizeLineAttributes" },
+    { 0x1b1884cf3f0bda82ULL, "setBezeled:" },
+    { 0x8f2b7ca11764e7a9ULL, "socketHandle" },
+    { 0x9a503c38526db034ULL, "setShouldReportNamespacePrefixes:" },
+    { 0xc435d8deaee97285ULL, "removeObserver:forKeyPath:" },
+    { 0x2d230809e1d1b5cfULL, "CIContext" },
+    { 0x3b9d3dc1a36af5dfULL, "decodeBoolForKey:" },
+    { 0x275c45e13e708e5fULL, "setFinished:" },
+    { 0x424fbdd524aa2227ULL, "integerValue" },
+    { 0, NULL },
+    { 0xf5f65fffa42bd385ULL, "setCachePolicy:" },
+    { 0xf82ea8f423124ebcULL, "positiveFormat" },
+    { 0x7c5a6486fd89d538ULL, "getLineStart:end:contentsEnd:forRange:" },
+    { 0xea0af6265bad5f76ULL, "boundingRectWithSize:options:attributes:" },
+    { 0x62456a5e0fa40c83ULL, "componentsSeparatedByString:" },
+    { 0x9b08ffb4fafdd14bULL, "verticalRulerView" },
+    { 0x70abef0fd875b66bULL, "beginPageInRect:atPlacement:" },
+    { 0x6e42796cb3c25c34ULL, "hidePanel" },
+    { 0xec61497d7145c687ULL, "verticalScrollerFrame" },
+    { 0x81803c40ff44e259ULL, "substringWithRange:" },
+    { 0x4066d293afdaec80ULL, "indexGreaterThanOrEqualToIndex:" },
+    { 0xe049884773d3c3dcULL, "nextDaylightSavingTimeTransition" },
+    { 0x250586ea1d1d4510ULL, "noteNewRecentDocumentURL:" },
+    { 0, NULL },
+    { 0x1d9cf8e83cb8b798ULL, "_moveUp:extend:" },
+    { 0x3e2db031772f2fa8ULL, "decodeBytesForKey:returnedLength:" },
+    { 0x9e7c32e7995ed4b5ULL, "removePortForName:" },
+    { 0x19fdb6fb52303614ULL, "zeroSymbol" },
+    { 0x29a7f3584f4fb083ULL, "findNext:" },
+    { 0x7e88cc264c56e82eULL, "browseCallback:flags:interface:error:name:type:domain:" },
+    { 0, NULL },
+    { 0x064a820e2f101450ULL, "platformWindowActivated:displayIfNeeded:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xfc83dd36de21e49aULL, "sharedSpellChecker" },
+    { 0x775a0c9e6d474888ULL, "comboBoxCell:completedString:" },
+    { 0x1dd291d623bf2b93ULL, "decodeArrayOfObjCType:count:at:" },
+    { 0xbb571519d6f9484dULL, "debugDescription" },
+    { 0xb0f3290426a0d52bULL, "setTitle:" },
+    { 0xfdad584bbea87f1bULL, "dragFile:fromRect:slideBack:event:" },
+    { 0, NULL },
+    { 0x5a2138350a73a5a0ULL, "drawAttributedString:atPoint:inSize:" },
+    { 0x58e5e2d9bc0636b2ULL, "readDataOfLength:" },
+    { 0xfd8234a646795c00ULL, "maximumDecimalNumber" },
+    { 0xe242a25707003951ULL, "_addItemWithTitle:" },
+    { 0x7caf62f0fc0b39faULL, "setContentWidth:type:" },
+    { 0x5bf05dafc04313cbULL, "transformedValueClass" },
+    { 0x3cd1da847e8fafa6ULL, "setManagedObjectContext:" },
+    { 0x32c04f4b1db207dbULL, "_validateDraggedRow:" },
+    { 0x3802d7b1a28c17c6ULL, "commonPrefixWithString:options:" },
+    { 0xdfc1893b52265ae7ULL, "isLenient" },
+    { 0x3e69bcc90e3c5fb5ULL, "systemFontSize" },
+    { 0x8398e78cf11be386ULL, "mostCompatibleStringEncoding" },
+    { 0xc7e668d1d6fdc3d5ULL, "archiver:willReplaceObject:withObject:" },
+    { 0xfa4ca7e061e765e4ULL, "pathControl:validateDrop:" },
+    { 0x60753bb947a787a0ULL, "wantsToTrackMouse" },
+    { 0xe9227b2a40d58541ULL, "textStorage:edited:range:changeInLength:invalidatedRange:" },
+    { 0x9bc87bc2efd4a19dULL, "hasPrefix:" },
+    { 0x82ec5929ba56d2a8ULL, "takeFloatValueFrom:" },
+    { 0xb73e6e8a465d6d9bULL, "setDidEndSelector:" },
+    { 0x6172c37f932ab2d4ULL, "attributedStringWithData:" },
+    { 0xa5c39b11ad4dfeecULL, "arguments" },
+    { 0x65f2e93f339886c8ULL, "setAnimates:" },
+    { 0x8a32357b3446d534ULL, "setCell:" },
+    { 0xcf55789984359ce9ULL, "getCharacters:range:" },
+    { 0x82207ca576ec3785ULL, "_removeCursorRect:cursor:view:" },
+    { 0x923036e9283a3677ULL, "drawerFrameWithContentSize:parentWindow:leadingOffset:trailingOffset:edge:state:" },
+    { 0x3066752085f3e68eULL, "persistentDomainNames" },
+    { 0x29cbd9fc3df59974ULL, "menu" },
+    { 0, NULL },
+    { 0x1d9a088557069986ULL, "appendBezierPathWithRect:" },
+    { 0xcc96210938bf8056ULL, "deltaZ" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x90bce86d0e482deaULL, "connectToHost:port:immediate:" },
+    { 0x54fe7c40fba1517bULL, "shouldProcessNamespaces" },
+    { 0xfb32e3b997a66e4cULL, "_viewRectForCharacterRange:" },
+    { 0x46e9f4014848be4bULL, "undo:" },
+    { 0xb32c05d55a603c0dULL, "yellowColor" },
+    { 0, NULL },
+    { 0xb61b63e34488e6f1ULL, "tile" },
+    { 0xfabfdd44e3474939ULL, "URLProtocol:didReceiveResponse:cacheStoragePolicy:" },
+    { 0x11187dad3d487b30ULL, "acceptConnectionInBackgroundAndNotifyForModes:" },
+    { 0, NULL },
+    { 0xc10e0c6298032f81ULL, "removeCursorRect:cursor:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc0c91a17738fd255ULL, "dragLinkCursor" },
+    { 0x43c622be56f0017aULL, "pageLayout" },
+    { 0xb5238ac27849c109ULL, "daylightSavingTimeOffset" },
+    { 0x1d43a1a36e552956ULL, "registerTable:forEncoding:" },
+    { 0x495328b77a54d1a7ULL, "setCornerView:" },
+    { 0, NULL },
+    { 0x434105a226c8e0bbULL, "scalesWhenResized" },
+    { 0, NULL },
+    { 0xa473c340a3804f5cULL, "presentError:modalForWindow:delegate:didPresentSelector:contextInfo:" },
+    { 0, NULL },
+    { 0x982c15200ddef6daULL, "canInsert" },
+    { 0x147251d82fb3b0c8ULL, "setThousandSeparator:" },
+    { 0xbd4b66af1be64ac1ULL, "parser:didStartElement:namespaceURI:qualifiedName:attributes:" },
+    { 0x3cfc8d41566639f3ULL, "keyEquivalent" },
+    { 0, NULL },
+    { 0x1761f8b50a520f8dULL, "abbreviationForDate:" },
+    { 0x635c2ccd02085541ULL, "circularSliderForegroundGradient" },
+    { 0x98253c266d6875dfULL, "isKindOfClass:" },
+    { 0, NULL },
+    { 0x29187772dbaf7070ULL, "colorWithAlphaComponent:" },
+    { 0, NULL },
+    { 0x7342cf9d1f59be12ULL, "_background_beginSheetForDirectory:file:types:modalForWindow:modalDelegate:didEndSelector:contextInfo:" },
+    { 0x4133c340bba1e1bbULL, "textContainers" },
+    { 0x391c228fc696b414ULL, "bundlePathFromModulePath:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6e6bf646ca619f23ULL, "setDefaultLineWidth:" },
+    { 0x7bde7ae50c234a0bULL, "isDataRetained" },
+    { 0, NULL },
+    { 0x4110b30d71c01010ULL, "GiveFeedback:" },
+    { 0xf6dfbe1731f2dd9eULL, "stringByAppendingString:" },
+    { 0, NULL },
+    { 0x20bfe772f101b5f3ULL, "stopCode" },
+    { 0x798b80ac795451f3ULL, "isDragging" },
+    { 0x476d9fe7e017c714ULL, "scalePage::" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd8a6be0e3c782050ULL, "homeDirectory" },
+    { 0, NULL },
+    { 0x08894e0a9acdd6f8ULL, "removeTemporaryAttribute:forCharacterRange:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5d3239ba744c361aULL, "dragEnter:" },
+    { 0x2b487864ff188bf9ULL, "slideImage:from:to:" },
+    { 0x2746045141cae42aULL, "_delegateChangeSelectionFromRanges:toRanges:" },
+    { 0xca0a8004abea1614ULL, "inputSelectSet" },
+    { 0, NULL },
+    { 0xbea00f0f4dd5f87dULL, "trackingAreas" },
+    { 0x8a76e1c62d024d17ULL, "terminationStatus" },
+    { 0xa8b50e542a93856eULL, "currentMemoryUsage" },
+    { 0x25dd14cec76fd1ceULL, "updateRowValues" },
+    { 0x747705b0699d9223ULL, "moveWordRight:" },
+    { 0x95754c5a98ef267fULL, "setParagraphStyle:" },
+    { 0x5f8bb60efa82afecULL, "setSearchButtonCell:" },
+    { 0xc98ffc0cb3027c6aULL, "removeObjectsInArray:" },
+    { 0xb9dc7ad2f67ecc69ULL, "setPositiveInfinitySymbol:" },
+    { 0x9cacadfa3051d5fcULL, "titleForHighlight" },
+    { 0xac78cec78459b358ULL, "resizeDownCursor" },
+    { 0x0d5f4707a7303e79ULL, "_headerView" },
+    { 0x906076369786806cULL, "indexOfSelectedItem" },
+    { 0x759d348bdaf28edaULL, "openHandCursor" },
+    { 0x8be72f063df3a60cULL, "mutableBytes" },
+    { 0, NULL },
+    { 0x4370d9c469aadbb7ULL, "windowDidBecomeMain:" },
+    { 0x7a03d04c5f3ca9bdULL, "nextValidKeyView" },
+    { 0x1608691cd0e34199ULL, "exchangeObjectAtIndex:withObjectAtIndex:" },
+    { 0x527ccd88d2a1480bULL, "invalidate" },
+    { 0x5ef7cd9b888bcac5ULL, "drawRect:" },
+    { 0x4a257049fa77a009ULL, "fontDescriptorWithMatrix:" },
+    { 0, NULL },
+    { 0xc9fccee980577396ULL, "setByAddingObject:" },
+    { 0x4a094f6ba8f2d8d0ULL, "KVO_notifying_change_setObject:forKey:" },
+    { 0x6128d21bceed8124ULL, "setPanel:" },
+    { 0x837c77a39f6afa7aULL, "maximumLengthOfBytesUsingEncoding:" },
+    { 0xa2c942737fcac4baULL, "fetchSharedGlyphRangeTable" },
+    { 0xd232b11820c78324ULL, "relinquishFunction" },
+    { 0x8d4680729634bccbULL, "windowDidLoad" },
+    { 0x52f24d413c6f3a22ULL, "setAllowsTickMarkValuesOnly:" },
+    { 0xef0f41c2a8ae8878ULL, "menuDidClose:" },
+    { 0x786901a8ac3087b7ULL, "DragEnter::::" },
+    { 0x0bbc5bcbc1a5d58fULL, "setUsesRuler:" },
+    { 0xfddc75ccaaa1fc07ULL, "_appendClassVersion:" },
+    { 0xc718cdc43d812b56ULL, "windowNibName" },
+    { 0x79df779dc367a8d5ULL, "preparedCellAtColumn:row:" },
+    { 0xa60ec212c0e4025dULL, "disableFlushWindow" },
+    { 0x939576d2448eb096ULL, "runLoopModes" },
+    { 0xb88e8b62d882632eULL, "decimalTabMarkerWithRulerView:location:" },
+    { 0x34ad35bbdc26e56fULL, "setClip" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8c00af88f6fdb20aULL, "traitsOfFont:" },
+    { 0xffaeb5eaca87b76aULL, "connectionWithRegisteredName:host:usingNameServer:" },
+    { 0xd30d6193bfbb7428ULL, "rangeOfCharacterFromSet:options:range:" },
+    { 0x86a24c75e4ed9ce8ULL, "drawInRect:withAttributes:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x88857970371d3b95ULL, "portForName:" },
+    { 0, NULL },
+    { 0xff1fb59bfbd35b72ULL, "setValue:type:forDimension:" },
+    { 0x69849a0d37636e62ULL, "typeOfFile:error:" },
+    { 0x2551e52180bacc4bULL, "connectionDidFinishLoading:" },
+    { 0, NULL },
+    { 0x65125d968860018aULL, "_dateToSystemTime:" },
+    { 0xfe0c0d33275bd607ULL, "substringToIndex:" },
+    { 0, NULL },
+    { 0xf8f62051fdbd3e59ULL, "_extractCStringString" },
+    { 0x1ab5b5fa2789f2fdULL, "allowsMultipleSelection" },
+    { 0x2d210566e6b65920ULL, "viewsNeedDisplay" },
+    { 0, NULL },
+    { 0xa3b5ad5b17f77718ULL, "enterFullScreenMode:withOptions:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x95cb9c26172dedeaULL, "countKeyPath" },
+    { 0xe678c332e2761533ULL, "classFallbacksForKeyedArchiver" },
+    { 0xb52a36e34f2db4eeULL, "executablePath" },
+    { 0xad73a6c435afff5dULL, "searchForDomain:" },
+    { 0xdb077712eae9855bULL, "registerProcessNameDefaults" },
+    { 0x25231f60aa139195ULL, "setFillColor:" },
+    { 0xb13b91ed0171e86fULL, "getArgument:atIndex:" },
+    { 0xf625bb6686c757ebULL, "scrollColumnsLeftBy:" },
+    { 0x4399e9dc02d95c82ULL, "deleteToBeginningOfLine:" },
+    { 0xc6b7b0e66bc654f2ULL, "selectSetOutputNotification:" },
+    { 0x485e7dc8439d7b70ULL, "addTypefaces:" },
+    { 0, NULL },
+    { 0x16b05e8e9b60aeb9ULL, "setTitle:ofColumn:" },
+    { 0x688a3b115db34143ULL, "_mouseDownList:" },
+    { 0x917282b61dc355a7ULL, "bitmapData" },
+    { 0x469eb053d0d2a2d0ULL, "drawCircularSliderWithFrame:inView:" },
+    { 0x7f5a9479ec709a55ULL, "displayNameAtPath:" },
+    { 0xf1f796f1f3fe7d12ULL, "cmykTextChanged:" },
+    { 0x4046d147175d46d0ULL, "setJobDisposition:" },
+    { 0xf88f1630abe57c65ULL, "unhideAllApplications:" },
+    { 0x6651b60742c2ad16ULL, "currencySymbol" },
+    { 0xce1c15ed0a6ca5ffULL, "selectPrevious:" },
+    { 0x54ae09b7754f90c4ULL, "setFocusRingType:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe4955f9125df00a6ULL, "componentsFromLocaleIdentifier:" },
+    { 0x25c9dab0431a772eULL, "_stepperFrameForFrame:" },
+    { 0, NULL },
+    { 0x6939ce3c19692921ULL, "changeWindowsItem:title:filename:" },
+    { 0, NULL },
+    { 0xda0a25ac46e9ee9aULL, "absoluteURL" },
+    { 0xd111f59008015821ULL, "contentSize" },
+    { 0xc8586019d073958eULL, "fontWithName:size:" },
+    { 0x61f3bb3334fc038cULL, "setMenuFormRepresentation:" },
+    { 0xc059548f8424f32bULL, "cellSizeForBounds:" },
+    { 0x262a705d4461c830ULL, "setTextAttributesForZero:" },
+    { 0x5b8d75b3eed01ddbULL, "relativePath" },
+    { 0xdb18b1e5710e5427ULL, "_recentDocumentPaths" },
+    { 0xc0d0dad2ea452528ULL, "_infoForType:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8c966d3fda92c5aaULL, "capitalizedString" },
+    { 0xf580f54fa8da405aULL, "focusRingType" },
+    { 0, NULL },
+    { 0x9f62b5a707097aafULL, "init" },
+    { 0x74d2a4b7f9102010ULL, "setObservationInfo:" },
+    { 0, NULL },
+    { 0xc3a3c8a6da1b62fdULL, "didChangeAlreadyChanging" },
+    { 0x34dff7f2b52cfbb8ULL, "longValue" },
+    { 0, NULL },
+    { 0xde13bf74aeb7b83aULL, "applyToCell:inRow:" },
+    { 0x916048db6ddd2e91ULL, "createVerticalScrollerIfNeeded" },
+    { 0, NULL },
+    { 0x02e07bf358a79f94ULL, "outlineTableColumn" },
+    { 0xe2bbfe7e0b4d3dc8ULL, "setWindingRule:" },
+    { 0x87cd982f95e7df6fULL, "setPrintInfo:" },
+    { 0x7ec3883f64cb40b1ULL, "textAttributesForNegativeInfinity" },
+    { 0x9f11104c435c50cdULL, "addFontToCache:" },
+    { 0x2c52b8eada60f030ULL, "_labelSize" },
+    { 0xff1a88c9950fe7abULL, "setCookies:forURL:mainDocumentURL:" },
+    { 0xe68192619a4b8f6fULL, "cursorHandle" },
+    { 0, NULL },
+    { 0xdcf3b26b8584d09bULL, "lockFocusIfCanDrawInContext:" },
+    { 0xcec001b3d5ef890aULL, "parser:didStartMappingPrefix:toURI:" },
+    { 0xbb833a827ac403f7ULL, "getPartId:stateId:forButtonImage:enabled:mixed:" },
+    { 0x88bba4edfe436031ULL, "setSelectedRange:affinity:stillSelecting:" },
+    { 0x66ef75e3bab776baULL, "updateSpellingPanelWithMisspelledWord:" },
+    { 0, NULL },
+    { 0x22cce0951bf0916bULL, "savePanel" },
+    { 0x5bdf865d0ea9ddb6ULL, "decomposedStringWithCompatibilityMapping" },
+    { 0x1d30c565a97206deULL, "setFont:" },
+    { 0x569830d4dbbf748fULL, "draggedDistance" },
+    { 0, NULL },
+    { 0xf0474452a1b7ce8bULL, "defaultCredentialForProtectionSpace:" },
+    { 0xfbec3e940c31dd2cULL, "platformWindowShouldZoom:" },
+    { 0xc25e50067f01919eULL, "_replaceCharactersInRange:withString:allowsTypingCoalescing:" },
+    { 0xd2644136df3ccc3dULL, "lineJoinStyle" },
+    { 0x29a869e7e505463aULL, "docFormatFromRange:documentAttributes:" },
+    { 0x718e6ae57070b2dfULL, "versionForClassName:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc95473e8de61a23eULL, "setAllowedTypes:" },
+    { 0x4f6a08123747fed3ULL, "insertCompletion:forPartialWordRange:movement:isFinal:" },
+    { 0xf9f80ff4cde310e1ULL, "cursorUpdate:" },
+    { 0, NULL },
+    { 0x9cb9359be1206114ULL, "drawBoxWithLineInRect:" },
+    { 0xd6b8dd5b765510c6ULL, "convertFont:toFamily:" },
+    { 0xab3da4d4137d42e8ULL, "runModalForDirectory:file:" },
+    { 0x7057733050f12170ULL, "getObjects:range:" },
+    { 0xe004272271c11c1aULL, "runModalPageLayoutWithPrintInfo:delegate:didRunSelector:contextInfo:" },
+    { 0x1f3c9d5e0f0fff8cULL, "replaceBytesInRange:withBytes:length:" },
+    { 0xc6d16b21a0b7341eULL, "undoRedo:" },
+    { 0, NULL },
+    { 0x618c028b37d906a6ULL, "setAutomaticallyIdentifiesLanguages:" },
+    { 0x122b8ae241a2279fULL, "print:" },
+    { 0x6d0081e6f65faa93ULL, "decimalNumberBySubtracting:withBehavior:" },
+    { 0x14f62fb47e34c01cULL, "isFirstResponder" },
+    { 0xa3bbffa2769b95e8ULL, "fileURLWithPathComponents:" },
+    { 0xd0abcc4a29122a5dULL, "postKeyboardMSG:type:location:modifierFlags:window:keyboardState:" },
+    { 0xd17d90bc065c808eULL, "setFont:range:" },
+    { 0x08df924188672da7ULL, "matchesOnMultipleResolution" },
+    { 0x88c159505120e93bULL, "terminate:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc6deb6d188bbbfc0ULL, "isFlipped" },
+    { 0, NULL },
+    { 0xdef763fd89c9e597ULL, "setFlipped:" },
+    { 0, NULL },
+    { 0xbd7d6101b4b242f2ULL, "registerCallback:flags:error:name:type:domain:" },
+    { 0x5cf6554ffc7bce6eULL, "tabViewDidChangeNumberOfTabViewItems:" },
+    { 0x5ae087dc4b83015aULL, "parentWindowDidDeminiaturize:" },
+    { 0xa816e46bc43711e2ULL, "keyDown:" },
+    { 0x9bd3e56e4ad86a1eULL, "backgroundColor" },
+    { 0xbca4e8c8f1e3c804ULL, "glyphRangeForCharacterRange:actualCharacterRange:" },
+    { 0x0f23a8cff0e4e2c2ULL, "_appendArrayOfObjCType:length:at:" },
+    { 0x31f740a41c67ef3bULL, "fontWithFamily:traits:weight:size:" },
+    { 0x264d9d5d83c0183dULL, "bundleWithPath:" },
+    { 0xdd13517d33445d39ULL, "objectsForXQuery:error:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4eb0ebe1c4899fd3ULL, "deleteCharactersInRange:" },
+    { 0, NULL },
+    { 0x7b5e72af1aaff1b1ULL, "setChildren:" },
+    { 0, NULL },
+    { 0x61b414358c2d2411ULL, "layoutNextFragment" },
+    { 0xb27ce6b2439a304bULL, "tighteningFactorForTruncation" },
+    { 0, NULL },
+    { 0x7793096b66fbc29aULL, "lineNumber" },
+    { 0x137ddbbb625f315bULL, "isLocked" },
+    { 0xe9033d3da00ee9a5ULL, "grammarCheckingResultWithRange:details:" },
+    { 0x46bfcb5d1c4d0310ULL, "encodeData:indent:" },
+    { 0, NULL },
+    { 0x514d87cb3f37b66bULL, "declareTypes:owner:" },
+    { 0xae1548beb063c49eULL, "stopWaitCursor" },
+    { 0xb0715da75116e1a3ULL, "setPreferredBackingLocation:" },
+    { 0xda3ecd48563e02e2ULL, "fetchAdvances" },
+    { 0, NULL },
+    { 0x3c42d147a5869b9cULL, "draggingManager" },
+    { 0xdfa84f08b300c41bULL, "waitForEventsAndMultipleObjects:count:milliseconds:" },
+    { 0x27ff14f0be0b3176ULL, "matchingFontDescriptorsWithMandatoryKeys:" },
+    { 0x8885932646054a40ULL, "searchForServicesOfType:inDomain:" },
+    { 0xe502a16e97264791ULL, "childrenKeyPath" },
+    { 0x89a2706e762bdcc8ULL, "isFileHiddenAtPath:" },
+    { 0x032f5547a2b9d66eULL, "GetDataHere::" },
+    { 0xc8ec9173c110b56aULL, "pushState" },
+    { 0x06e2edc76a82f5bcULL, "scanDecimal:" },
+    { 0, NULL },
+    { 0xf3e8cec8557c2b4aULL, "setButtonType:" },
+    { 0, NULL },
+    { 0xaa059877a16e7dfeULL, "_numberFromString:error:" },
+    { 0x0fa87f34f632cfa3ULL, "curveToPoint:controlPoint1:controlPoint2:" },
+    { 0xfd102ace1ea3b96eULL, "arrangeObjects:" },
+    { 0x7f13d0d6cef4eb33ULL, "bundleWithIdentifier:" },
+    { 0x643519ea5606a625ULL, "mouseDragged:" },
+    { 0, NULL },
+    { 0xda4a4dbb640f9c8bULL, "indexOfTabViewItem:" },
+    { 0x5f343d03d4633710ULL, "cachesBezierPath" },
+    { 0x2de9ae146e8d751cULL, "drawTextViewInsertionPointInRect:color:" },
+    { 0x2d18d3b3c758453fULL, "windowProcedure:wParam:lParam:" },
+    { 0x4b41d297a94e6b10ULL, "rangeOfTextBlock:atIndex:" },
+    { 0x2e411c4de555a53bULL, "splitView:canCollapseSubview:" },
+    { 0x92432802c9d63f8fULL, "receiver" },
+    { 0x66152942cb28cf15ULL, "encodeInteger:forKey:" },
+    { 0xa0b9f1cbccabb632ULL, "appendBezierPathWithGlyph:inFont:" },
+    { 0, NULL },
+    { 0x52ca1ef503283649ULL, "setDefaultParagraphStyle:" },
+    { 0x4b2e0343a39e8320ULL, "setFileName:" },
+    { 0x388ac3e290f32d2eULL, "allowedTypes" },
+    { 0x3644a5dca9a3dfe1ULL, "trayIconID" },
+    { 0x2d5bd7b08eca8145ULL, "requestIsCacheEquivalent:toRequest:" },
+    { 0x1bdb12f145f64d92ULL, "setAutosizesCells:" },
+    { 0xd98b0312d0a1a897ULL, "timer:" },
+    { 0x65ae03059279efffULL, "renewRows:columns:" },
+    { 0, NULL },
+    { 0x4e6a79a9e335d905ULL, "doubleAction" },
+    { 0x8e39a37ee2eee5b7ULL, "fileSize" },
+    { 0x6b66352be2af0c69ULL, "containsIndex:" },
+    { 0x647a584f1f80ae62ULL, "knobRectFlipped:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x357017012172fc24ULL, "writeToFile:atomically:" },
+    { 0xd16c527632ed6b80ULL, "setDouble:forKey:" },
+    { 0xc2860518ab4f41abULL, "isWindowLoaded" },
+    { 0, NULL },
+    { 0x67240fe43b9a0379ULL, "stopWhenAnimation:reachesProgress:" },
+    { 0xa9aaf6d56070e67bULL, "isMiniaturized" },
+    { 0x8133323944010d49ULL, "cachePolicy" },
+    { 0xf9633ba0757dec07ULL, "recache" },
+    { 0x012de0462ba48b6dULL, "preferredLocalizations" },
+    { 0xce62dd1f37b8d6c1ULL, "appendFormat:" },
+    { 0xd9542804d9e4272eULL, "makeNextSegmentKey" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x50c976ecaa16b0b6ULL, "titleFrameOfColumn:" },
+    { 0xb3c922d5fa2b3636ULL, "sharedFontPanel" },
+    { 0, NULL },
+    { 0x5b31fcd92731574cULL, "enabledTextCheckingTypes" },
+    { 0x139dc9dbb2a82785ULL, "setMarkers:" },
+    { 0xed7c7aeab03d9999ULL, "pathForResource:ofType:inDirectory:" },
+    { 0, NULL },
+    { 0x277893f593c09defULL, "firstResponder" },
+    { 0x79dd72fae0849e41ULL, "leftIndentMarkerWithRulerView:location:" },
+    { 0xc46ec4d35e46d77cULL, "_resetCursorRectsInView:" },
+    { 0xe9d0b07deeea13cdULL, "keyNames" },
+    { 0x75882e98661d5048ULL, "rootProxyForConnectionWithRegisteredName:host:usingNameServer:" },
+    { 0x2d2ac50fac835566ULL, "rulerAccessoryViewForTextView:paragraphStyle:ruler:enabled:" },
+    { 0, NULL },
+    { 0xcf2f84a54a43a38dULL, "setRichText:" },
+    { 0x3182ef7a913be259ULL, "dateFormat" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x97d3b4b7050018efULL, "setMaxWidth:" },
+    { 0x05a15cfc738532d0ULL, "stringByAppendingFormat:" },
+    { 0x5998c5f5674df76eULL, "canAdd" },
+    { 0x3d737877becaf4a2ULL, "setLayoutAlgorithm:" },
+    { 0x7e66e04a8ae07fbbULL, "URLByAppendingPathComponent:isDirectory:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2bc469bf8f15f611ULL, "sizeForMenuItems:" },
+    { 0xa8767dc85166aca5ULL, "_deselectAllCells" },
+    { 0x940304835c632bd2ULL, "setDefaultButtonCell:" },
+    { 0xf4588f665e678fe2ULL, "setRepresentedURL:" },
+    { 0x32440b9852ad7a1eULL, "frameOfScroller" },
+    { 0xd3093d89eb244376ULL, "setMenu:" },
+    { 0xb3e7e1c4237eec8cULL, "allowsCutCopyPaste" },
+    { 0x7cda08724f10b923ULL, "defaultKeyBindingManager" },
+    { 0x9560f30e38ceed35ULL, "imageScalingForSegment:" },
+    { 0x5c4603386795a923ULL, "resetCursorRects" },
+    { 0xcbe1e31a72f79d84ULL, "setMinimum:" },
+    { 0, NULL },
+    { 0xd2ee42cd3c915ebdULL, "formIntersectionWithCharacterSet:" },
+    { 0x3dfccdc8a2642b2fULL, "_setFontFamilyName:" },
+    { 0x953428cab43c23ceULL, "isStandalone" },
+    { 0, NULL },
+    { 0xf01438016797a852ULL, "_rangeForSelectedParagraph" },
+    { 0x9abff3d11730bee3ULL, "customSelector" },
+    { 0xedd61281cd7c007aULL, "automaticallyRearrangesObjects" },
+    { 0xa7a6861756c2b30dULL, "setMaximumRecents:" },
+    { 0xadd7993380e62383ULL, "graphicsContextWithBitmapImageRep:" },
+    { 0x56991a7c57e23f62ULL, "attributedTitle" },
+    { 0, NULL },
+    { 0xf1aabe6e79378fb4ULL, "_addSystemColor:forName:" },
+    { 0x326ac62a23ac65efULL, "fileSystemAttributesAtPath:" },
+    { 0x641b2c973586ad57ULL, "readFromFileWrapper:ofType:error:" },
+    { 0xdecabf2df45c29d7ULL, "_waitForConditionBeforeDate:" },
+    { 0x529a3603a9ba09d6ULL, "rootDocument" },
+    { 0, NULL },
+    { 0x075a7648ccecb895ULL, "whiteComponent" },
+    { 0x0bffc43944f4bcc9ULL, "descriptionFunction" },
+    { 0x79ec215354b7ef55ULL, "setArray:" },
+    { 0xa9876c420166daf3ULL, "setAnimationDelay:" },
+    { 0xf932665ef884f1f3ULL, "alphaControlAddedOrRemoved:" },
+    { 0xecd8763c6bb75b50ULL, "isCancelled" },
+    { 0xbf9899728787b1feULL, "setTextStorage:" },
+    { 0, NULL },
+    { 0xbc835ad1b80a86a7ULL, "encodeByrefObject:" },
+    { 0x4fd14d38145fa0a6ULL, "maxValue" },
+    { 0, NULL },
+    { 0x1d42180f49521abeULL, "operationWouldBlock" },
+    { 0x8c09bb4467cc0cfaULL, "setPreferredFontNames:" },
+    { 0x699f8a64602313c9ULL, "archiverWllFinish:" },
+    { 0x2ec18ca56ad6d6c8ULL, "absoluteString" },
+    { 0x4d58e2764c516e5cULL, "setApplicationIconImage:" },
+    { 0x363ff84cf5c9cdf1ULL, "lowercaseString" },
+    { 0xca815de2e5e5a8baULL, "_scanModifierMapFor:longForm:" },
+    { 0x16a5f06042465663ULL, "tableView" },
+    { 0xfaf4cd703d8e8b8cULL, "mountNewRemovableMedia" },
+    { 0x38d36e59b3790a60ULL, "dictionaryFromTXTRecordData:" },
+    { 0x26697ea6666865e9ULL, "multipleValuesPlaceholder" },
+    { 0xf876e245aed89577ULL, "isUndoRegistrationEnabled" },
+    { 0x739386d868fb1f95ULL, "setVisible:" },
+    { 0x329e97a5d963d8d4ULL, "clearStopAnimation" },
+    { 0xd2d7cdaf4098952cULL, "replaceCharactersInRange:withRTF:" },
+    { 0, NULL },
+    { 0x44bf9c28a6802945ULL, "seekToEndOfFile" },
+    { 0x28d707e58c6a9a01ULL, "addTextContainer:" },
+    { 0xcbbcb0bc219047beULL, "rangeOfCharacterFromSet:options:" },
+    { 0x49c538b9fb43361fULL, "unionSet:" },
+    { 0xf2a23746dc6b9616ULL, "startTrackingLinearSliderAt:inView:" },
+    { 0xf82cc4e390eff2fdULL, "setVerticalPagination:" },
+    { 0xe75f09187c9ad787ULL, "isEqualToArray:" },
+    { 0xaf9bccee13142a1fULL, "negativeFormat" },
+    { 0x891b9b54ff8ec9d6ULL, "setBrightness:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xa159bfd85f117166ULL, "_KVO_class" },
+    { 0x4abedae4c1715191ULL, "TIFFRepresentationOfImageRepsInArray:usingCompression:factor:" },
+    { 0x77b1091ef6b3a6a8ULL, "isDescendantOf:" },
+    { 0xf324c89f80e8434bULL, "launchedTaskWithLaunchPath:arguments:" },
+    { 0xb9843e8c8a7ae563ULL, "dataSourceObjectValueForTableColumn:row:" },
+    { 0, NULL },
+    { 0x3089558a640c7a01ULL, "release" },
+    { 0, NULL },
+    { 0x3ee17a339edfbca1ULL, "contentMaxSize" },
+    { 0, NULL },
+    { 0xdfb8ca3119b34017ULL, "raisesForNotApplicableKeys" },
+    { 0xc586ee64d65b95e7ULL, "reviewUnsavedDocumentsWithAlertTitle:cancellable:delegate:didReviewAllSelector:info:" },
+    { 0x2a4966bace2b1061ULL, "setStandalone:" },
+    { 0xc4916166b28a51efULL, "stringFromNumber10_0:" },
+    { 0, NULL },
+    { 0x29f843a813932f63ULL, "fieldEditor:forObject:" },
+    { 0x065595708f438639ULL, "objectIsForcedForKey:inDomain:" },
+    { 0x53bc234ebda7d30aULL, "headers:" },
+    { 0xca5a9d1b9e6cd4d0ULL, "setUsesThreadedAnimation:" },
+    { 0, NULL },
+    { 0x5b620e7ed5e4e316ULL, "setCountKeyPath:" },
+    { 0x0d7178ded35d9675ULL, "setRightMargin:" },
+    { 0x7f72ad588defc4fbULL, "showsToolbarButton" },
+    { 0x60f4e126266c31ddULL, "KVO_notifying_change_replaceObjectInKeyAtIndex:withObject:" },
+    { 0, NULL },
+    { 0xc585373cdc7d1dfbULL, "decimalNumberWithMantissa:exponent:isNegative:" },
+    { 0, NULL },
+    { 0x9c668d837bba2483ULL, "isMovable" },
+    { 0xcaa831f615d9f4e6ULL, "removeObserver:fromObjectsAtIndexes:forKeyPath:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4d12c2f89ce6a210ULL, "arrayByAddingObject:" },
+    { 0xefe89597f12409ceULL, "keyPathsForValuesAffectingSelectedTag" },
+    { 0x3ecc1b082353d072ULL, "insertObjects:atArrangedObjectIndexes:" },
+    { 0xd3105f3bb6edc789ULL, "setHidden:" },
+    { 0, NULL },
+    { 0x0a21ad8ff0b40482ULL, "changeColorWhenActive:" },
+    { 0xf19f4ff4c550d0d6ULL, "paddingCharacter" },
+    { 0xb6a899cc5e92456dULL, "isCopyingOperation" },
+    { 0xbd744ae065cc2512ULL, "operatingSystemName" },
+    { 0x5a195044f33f0c44ULL, "clipViewFrame" },
+    { 0xb50f892d936e95b3ULL, "xHeight" },
+    { 0xff0852cf1310c4d6ULL, "registerImageRepClass:" },
+    { 0xe084eb056ad829dbULL, "_allowedToolbarItems" },
+    { 0, NULL },
+    { 0x5de628d8a8045b7fULL, "setVerticallyCentered:" },
+    { 0xb4dbb5a4126b887aULL, "setRecentsAutosaveName:" },
+    { 0xfc759fb4ca312e37ULL, "_setContentValues:" },
+    { 0xd0cb4b5e3e7d6e27ULL, "minute" },
+    { 0xcc576610f79ab799ULL, "defaultLineCapStyle" },
+    { 0xd075459f5a78775fULL, "breakUndoCoalescing" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x89c8784c499b4898ULL, "_setContentSet:" },
+    { 0x1d2df289ee98c78fULL, "count" },
+    { 0x73a27b3fba4a5575ULL, "insertTab:" },
+    { 0x05548d63a77b42abULL, "_setAsyncState:forModes:" },
+    { 0xcd2947c613a77834ULL, "drawProgressIndicatorChunk:" },
+    { 0xa8c35442db78d5a7ULL, "ignoresMouseEvents" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6f17917cf18c04e9ULL, "listOptions" },
+    { 0x9e6980db8648c98bULL, "noResponderFor:" },
+    { 0x8f2692858e966b6aULL, "predicateWithSubstitutionVariables:" },
+    { 0x6ae9823eb5ce6433ULL, "animationBlockingMode" },
+    { 0x74a8d94f99cba086ULL, "appendString:" },
+    { 0x178489250b5b9f7bULL, "_drawGlyphsForSubGlyphRange:forFragment:atPoint:subRangeXOffset:inContainer:withAttributes:usedHeight:" },
+    { 0xe73f52629b8d98a5ULL, "browser:numberOfRowsInColumn:" },
+    { 0x20c6691693b2773fULL, "animate:" },
+    { 0xcbc51e34ee3325d9ULL, "stopAnimation" },
+    { 0, NULL },
+    { 0xc1226f99825442c9ULL, "countByEnumeratingWithState:objects:count:" },
+    { 0x9da39485845cbba5ULL, "colorWithPatternImage:" },
+    { 0x4af77502bea273b7ULL, "minSize" },
+    { 0x3d234776360fbff9ULL, "rectOfTickMarkAtIndex:" },
+    { 0x0dfdacc0e51ddd07ULL, "currencyGroupingSeparator" },
+    { 0x7c9fab912df0e429ULL, "isClient" },
+    { 0x2c2d11afe7d5bde6ULL, "attributedStringForNotANumber" },
+    { 0x22f414122b1bc5daULL, "scrollClipView:toPoint:" },
+    { 0, NULL },
+    { 0x62e26c020ef06fc2ULL, "hostName" },
+    { 0x500d2ca18f390bb5ULL, "preferredFilename" },
+    { 0x4c9ae0d5d690849aULL, "application:openFiles:" },
+    { 0, NULL },
+    { 0xfd45f5e5c74c0171ULL, "URLProtocol:didFailWithError:" },
+    { 0x1bda513fb0e73009ULL, "flushBuffer" },
+    { 0xdff715da76c11721ULL, "_KVO_swizzledClass" },
+    { 0xb49255d80111d4d5ULL, "setCanBecomeVisibleWithoutLogin:" },
+    { 0x248cdf10733193d3ULL, "baselineLocation" },
+    { 0, NULL },
+    { 0x16ab9aca81a69bdeULL, "availablePointSizes" },
+    { 0x98b0440a774a1aa8ULL, "sortDescriptors" },
+    { 0x4315a4a9a99e809aULL, "_validateEditing" },
+    { 0x11749107834583b9ULL, "launchPath" },
+    { 0x0be2784b37cbfc77ULL, "insertRow:withCells:" },
+    { 0x521e4993a2f2fee1ULL, "defaultMarkerImage" },
+    { 0x77c7c8ab0dce2416ULL, "colorWithDeviceRed:green:blue:alpha:" },
+    { 0, NULL },
+    { 0x9d725f18ba4891e3ULL, "wantsRestingTouches" },
+    { 0xc9da27d7949d5696ULL, "getRow:column:forPoint:" },
+    { 0xbd3a8fb65078a614ULL, "contentsAtPath:" },
+    { 0x16f1a3ddcec25139ULL, "outlineView:setObjectValue:forTableColumn:byItem:" },
+    { 0x657684f335377735ULL, "widthTracksTextView" },
+    { 0, NULL },
+    { 0x0ebfc83edbc1e5a7ULL, "_setContentWithoutKVO:" },
+    { 0xa1d1c8a64b14761aULL, "stringByAppendingPathComponent:" },
+    { 0x65e07161c75c1326ULL, "_allFileTypes" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5c7d1a570d86e100ULL, "writeData:" },
+    { 0x8b30a3b8cbd4d396ULL, "setUsesSignificantDigits:" },
+    { 0x7bb0e0df647caf4bULL, "attributeValue:" },
+    { 0x3bd73a00ff468f89ULL, "instantiateNibWithExternalNameTable:" },
+    { 0x40997e1118a7390cULL, "localNameForName:" },
+    { 0, NULL },
+    { 0xddcef3183eefbc13ULL, "branchArrow" },
+    { 0, NULL },
+    { 0x90f057e6c75fcc45ULL, "tickMarkValueAtIndex:" },
+    { 0xe51831e92f206d29ULL, "flatness" },
+    { 0x45aa94ef7123f219ULL, "roundingIncrement" },
+    { 0x2cd08a5e86aa9975ULL, "runModalForTypes:" },
+    { 0xfb32b5a79bd5a27cULL, "download:shouldDecodeSourceDataOfMIMEType:" },
+    { 0x17035190533a6cb8ULL, "_uiFontOfType:size:fallbackName:" },
+    { 0, NULL },
+    { 0x4c809457f6e49b65ULL, "mouseMoved:" },
+    { 0x4f70a8b29748c701ULL, "synchronizeWindowTitleWithDocumentName" },
+    { 0x4fc0caafb3539157ULL, "calcSize" },
+    { 0x16af9f31b6256f89ULL, "selectKeyViewPrecedingView:" },
+    { 0xb5a5a16bd5d5d600ULL, "setCurrentDestination:" },
+    { 0, NULL },
+    { 0xca0df6ff1bb60017ULL, "_drawGlyphs:length:range:atPoint:inContainer:withAttributes:origin:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc9c7f0e3ef5f6c15ULL, "setRunLoopModes:" },
+    { 0x45fcbb2e60dd5e31ULL, "_didPublish" },
+    { 0xb7ccd332e1292120ULL, "verticalRulerFrame" },
+    { 0x2add83dc7d29de6eULL, "ascender" },
+    { 0xc94d30e20de68325ULL, "splitView:additionalEffectiveRectOfDividerAtIndex:" },
+    { 0xa6c547dcb8dd839fULL, "cStringUsingEncoding:" },
+    { 0xcc9d2874a53baf07ULL, "addRunLoop:" },
+    { 0xe0bf6b5c421bee05ULL, "compare:" },
+    { 0xb4080d3eee167bb5ULL, "netServiceDidPublish:" },
+    { 0x9b4b26802c5a4126ULL, "applicationWillHide:" },
+    { 0x868db0c2cfb9c3adULL, "setEntryType:" },
+    { 0xb75732c576036310ULL, "datePickerElements" },
+    { 0x81792364ffb0ae33ULL, "insertGlyph:atGlyphIndex:characterIndex:" },
+    { 0xbaead6d44a6a231dULL, "showDefinitionForAttributedString:atPoint:" },
+    { 0x7879cff21c730c29ULL, "operatingSystemVersionString" },
+    { 0xde2192a896abb978ULL, "animations" },
+    { 0x9d0792f615d7ced4ULL, "intersectSet:" },
+    { 0x49d63b0b436c1c97ULL, "drawSliderKnobInRect:vertical:highlighted:hasTickMarks:tickMarkPosition:" },
+    { 0x21217c103b1c14f6ULL, "setSubview:" },
+    { 0x4f0c443d9dc84895ULL, "_view" },
+    { 0xecf9df0a3ee442ecULL, "completes" },
+    { 0x13731fad969748e8ULL, "glyphRangeForTextContainer:" },
+    { 0x23dacd24603e5b7eULL, "addTypes:owner:" },
+    { 0x2e754c676a3e3443ULL, "indexPathWithIndex:" },
+    { 0xa244eada87ac1240ULL, "initWithObject:" },
+    { 0x19dba7fa8b49fadcULL, "tableForEncoding:" },
+    { 0x939b040dd89f7df3ULL, "containsPoint:" },
+    { 0x8aa7bd154683fd02ULL, "data" },
+    { 0x76a28992a2ab4c00ULL, "mainDocumentURL" },
+    { 0x6a76c80cbab75f8aULL, "registerLanguage:byVendor:" },
+    { 0xe25ffd70281ccca4ULL, "insertEntry:atIndex:" },
+    { 0, NULL },
+    { 0x3e75c1706243a9e0ULL, "showWindow:" },
+    { 0xb83571d986b67951ULL, "rangeValue" },
+    { 0x7916b2bf1e72aac0ULL, "characterAtIndex:" },
+    { 0x69487b3f4bb01662ULL, "processName" },
+    { 0x64688f70f33df5b7ULL, "setObject:forKey:" },
+    { 0x354845cc0de13eecULL, "contextToTransformWindow:startRect:targetRect:resizeTime:display:" },
+    { 0, NULL },
+    { 0xf788d278eeb24b84ULL, "setOffStateImage:" },
+    { 0xffffc3e4dc598863ULL, "applicationWillUnhide:" },
+    { 0xb8c89ee2c80bc607ULL, "restOfPathObserver" },
+    { 0xc9ce341856aa1889ULL, "drawBrowserTitleBackgroundInRect:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x252ee60056f8950fULL, "setRepresentedFilename:" },
+    { 0, NULL },
+    { 0x6bc82ca5eadaa6f1ULL, "minimumFractionDigits" },
+    { 0x24028f5445bf47c7ULL, "expressionForKeyPathLeft:right:" },
+    { 0xd7f1031dd6fc79d3ULL, "availableColorLists" },
+    { 0, NULL },
+    { 0x38b113e6836bd7d0ULL, "_platformLocaleAdditionalDescriptionForIdentifier:" },
+    { 0x118409ecd28c6570ULL, "hyphenationFactorForGlyphAtIndex:" },
+    { 0, NULL },
+    { 0xa50f1a9313b40e95ULL, "borderColorForEdge:" },
+    { 0x2b06fda38d840e2cULL, "minItemSize" },
+    { 0xa392a8824da53a81ULL, "clickSizeMatrix:" },
+    { 0, NULL },
+    { 0x0e3245f4674a3d8cULL, "setSelectionIndexPaths:" },
+    { 0xd416010d1ede80e6ULL, "nullTerminatedASCIIDataWithString:" },
+    { 0x756d319a0cd5740fULL, "removeObserver:name:object:" },
+    { 0x8b530f72abe821aaULL, "fontDescriptor" },
+    { 0x69cf41438412fae6ULL, "indexPathByAddingIndex:" },
+    { 0xf6acd29107b31539ULL, "removeFromSuperview" },
+    { 0xd959c56af2e82b0fULL, "reloadGuessesForCurrentWord" },
+    { 0, NULL },
+    { 0x75b2a29c8f9768f6ULL, "contentMinSize" },
+    { 0x3b4ae8d2af78c5b8ULL, "copyPath:toPath:handler:" },
+    { 0x0b0d5e69ec8d9d11ULL, "cannotDecodeType:" },
+    { 0x4574787c3ecec1a5ULL, "canInitWithWindow:" },
+    { 0x18e135a15128dd00ULL, "exitFullScreenModeWithOptions:" },
+    { 0xf0671cb302a1d25aULL, "paragraphRangeForRange:" },
+    { 0x09942b85df99bd44ULL, "setScalesWhenResized:" },
+    { 0x0cb92aca825e5403ULL, "invert" },
+    { 0x8439ad704bc1c055ULL, "hideOtherApplications" },
+    { 0x5873a2487a3bff1eULL, "fileWrappers" },
+    { 0xbe9a3d10e973fb47ULL, "directoryAttributes" },
+    { 0, NULL },
+    { 0x1b3d0f827652e136ULL, "groupsByEvent" },
+    { 0, NULL },
+    { 0xaa853eae4e547d1eULL, "applicationWillFinishLaunching:" },
+    { 0x0abc724d7eec733bULL, "pathsForResourcesOfType:inDirectory:forLocalization:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xeca33ec55b05e279ULL, "backgroundFilters" },
+    { 0x098d36de5ac03806ULL, "paletteLabel" },
+    { 0xf35727359c83aa8aULL, "elementDeclarationForName:" },
+    { 0x63b5ac62af8524bdULL, "setPullsDown:" },
+    { 0x1fc2d5befe75634bULL, "interrupt" },
+    { 0xfd7ff44511c325bcULL, "leadingOffset" },
+    { 0xbcba20bab0ecb607ULL, "setStyleMask:" },
+    { 0xa7c22106064e7070ULL, "frameOfScrollerBorder" },
+    { 0, NULL },
+    { 0x6a1f16c600927b05ULL, "rearrangeObjects" },
+    { 0x79e45ca638f4bd0fULL, "browser:willDisplayCell:atRow:column:" },
+    { 0xf1c584bad476d0cdULL, "_isDirectory:" },
+    { 0, NULL },
+    { 0x3ce4bc2d306c826aULL, "recalculateKeyViewLoop" },
+    { 0xcdcc67006e509013ULL, "removeObserver:selector:" },
+    { 0xdb439bc2a8753e33ULL, "increment" },
+    { 0xed97a317afc20497ULL, "setIndentationMarkerFollowsCell:" },
+    { 0xac87986f4e0a3007ULL, "draggingSourceOperationMaskForLocal:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdf1ad469e903c97aULL, "descriptor" },
+    { 0x822e7b0c2d82a8b5ULL, "netServiceWillPublish:" },
+    { 0, NULL },
+    { 0x987cb0ef6de1753cULL, "moveToBeginningOfDocument:" },
+    { 0x37cc8dbe534f312cULL, "spellingPanel" },
+    { 0x518e3e7b7479c524ULL, "invalidType:" },
+    { 0xd58e8884ae76786fULL, "paragraphSeparatorCharacterRange" },
+    { 0, NULL },
+    { 0x19a14be2a66287f6ULL, "updateWindows" },
+    { 0x7485437ef24bbf2cULL, "hasSpaceAvailable" },
+    { 0x051ae267fb127758ULL, "setVisibilityPriority:" },
+    { 0x833441c8499515caULL, "boundingBox" },
+    { 0xd5149ca0653a827cULL, "setSelectedSegment:" },
+    { 0xcdda0ff761eae221ULL, "setShadowBlurRadius:" },
+    { 0xab748ab6b4789ce4ULL, "registerUnit:" },
+    { 0, NULL },
+    { 0x640e70979b179dbaULL, "hasVerticalScroller" },
+    { 0x76005566344defa4ULL, "tableView:setObjectValue:forTableColumn:row:" },
+    { 0xf65a394dc8a2ed14ULL, "drawWithFrame:inView:characterIndex:" },
+    { 0x1231abb1b8ebd1b7ULL, "drawMenuSeparatorInRect:" },
+    { 0, NULL },
+    { 0xb71e6a1baf8ec0aaULL, "rightMargin" },
+    { 0xf24a9615d9f9b2b8ULL, "miniaturize" },
+    { 0xf58501f128beb061ULL, "browser:isColumnValid:" },
+    { 0xe74832ff49ed4cf7ULL, "removeFileWrapper:" },
+    { 0xe7c087c8b422052fULL, "postXEvent:" },
+    { 0x53fcee04bccf333fULL, "compositingFilter" },
+    { 0x0203090226c2b0fdULL, "scaleUnitSquareToSize:" },
+    { 0x20225e74153edcc0ULL, "_binderClassForBinding:" },
+    { 0x6f7ed8c95d0bca4fULL, "_windowDidBecomeDeactive:" },
+    { 0, NULL },
+    { 0x717564eb15169718ULL, "sliderKnobSizeForControlSize:" },
+    { 0, NULL },
+    { 0x1554561a202a250fULL, "knobProportion" },
+    { 0x1f4b7616bd0b0f55ULL, "lineWidth" },
+    { 0, NULL },
+    { 0xc5358731f7a1b76eULL, "notationDeclarationForName:" },
+    { 0, NULL },
+    { 0xa7bfbfd38781611aULL, "setAutohidesScrollers:" },
+    { 0x88771ad5377566e4ULL, "_parentWindowDidExitMove:" },
+    { 0x68f64b45dbb50c31ULL, "WM_SYSCOMMAND_wParam:lParam:" },
+    { 0, NULL },
+    { 0xa9b93c84e6a8a81eULL, "addEntriesFromDictionary:" },
+    { 0xc21a391fc02080aaULL, "encodeRect:forKey:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x9c099e6556ee9411ULL, "resizedColumn" },
+    { 0x1757184fb4ecf376ULL, "setHighlightsBy:" },
+    { 0x69210fcd93a63558ULL, "setPixel:atX:y:" },
+    { 0x33888875f4e62ac7ULL, "date" },
+    { 0x2b6133a8e61f1a75ULL, "indent:" },
+    { 0xc0254c0c36acfa64ULL, "_broadcastCondition" },
+    { 0xabdf8425dd7da228ULL, "DragLeave" },
+    { 0, NULL },
+    { 0xeb53464b2c1b9ac3ULL, "selectedItemAttributes" },
+    { 0, NULL },
+    { 0xaa7d021b1a55c563ULL, "launchApplication:" },
+    { 0x7dda24a048558dc9ULL, "useOptimizedDrawing:" },
+    { 0xa02e13c48b6fdfd0ULL, "isRulerVisible" },
+    { 0xe1fda69c2e55a782ULL, "rectValue" },
+    { 0xd1a76723206801d9ULL, "sharedFontManager" },
+    { 0x935ce8fe5e503e7dULL, "isAutomaticSpellingCorrectionEnabled" },
+    { 0x3326542d6cb90194ULL, "_setCircularDoubleValueFromPoint:flipped:" },
+    { 0, NULL },
+    { 0xa34a7ec264715e50ULL, "isRotatedFromBase" },
+    { 0x4fa34f4fbbf31a09ULL, "headerTextColor" },
+    { 0, NULL },
+    { 0xd1aa48ec6b78f10cULL, "applyFromObject:inRow:keyPath:" },
+    { 0x376e1c9697c627d7ULL, "changeCaseOfLetter:" },
+    { 0x61ce9b6ad4750fe8ULL, "setKeyCell:" },
+    { 0xf6ab07944466806fULL, "rangeForUserCharacterAttributeChange" },
+    { 0x269568f5f189bae1ULL, "timestamp" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3ef870dc51814fa3ULL, "maximumSignificantDigits" },
+    { 0x16910002b3f96796ULL, "colorWithDeviceCyan:magenta:yellow:black:alpha:" },
+    { 0, NULL },
+    { 0x855ce911578178c0ULL, "createContext" },
+    { 0x7c60f2ee338c091dULL, "isExcludedFromWindowsMenu" },
+    { 0x697354e4640f40c0ULL, "setTypesetter:" },
+    { 0x7725b1fa27b059cdULL, "setIndentationPerLevel:" },
+    { 0xd08aaadba1934588ULL, "layoutManagerOwnsFirstResponderInWindow:" },
+    { 0xf9dabcbdb38bbb8dULL, "_kvo_operator_avg:" },
+    { 0xd99b7cb782f176d0ULL, "setUsesEPSOnResolutionMismatch:" },
+    { 0x14ba768129d282f7ULL, "prepareOpenGL" },
+    { 0xdd1f403bb380c3a3ULL, "cancelPerformSelector:target:argument:" },
+    { 0, NULL },
+    { 0x9fcf36d574f42b95ULL, "formatEtcs" },
+    { 0, NULL },
+    { 0xa0c981b47f2e1efdULL, "fileAttributes" },
+    { 0xae73ca973f2ff05cULL, "drawCell:" },
+    { 0xa2eef4c9ebd9c041ULL, "dateWithNaturalLanguageString:" },
+    { 0xf89ef681d76f4054ULL, "forwardSelector:arguments:" },
+    { 0x3a01953195d5680cULL, "establishConnections" },
+    { 0, NULL },
+    { 0x39667cd8ebe0fbc3ULL, "_setFontSize:" },
+    { 0x35cdabfc55f8e332ULL, "disappearingItemCursor" },
+    { 0, NULL },
+    { 0x1417d1588cb2ed40ULL, "layoutManager" },
+    { 0x6bd2d6321ce0e2ffULL, "startReading" },
+    { 0x49c12c0f50ccff8bULL, "className" },
+    { 0xa4274aa74a239231ULL, "cancelPreviousPerformRequestsWithTarget:" },
+    { 0xdb7ac041479d0897ULL, "setAction:" },
+    { 0x3dea25319c760377ULL, "KVO_notifying_change_addKey:" },
+    { 0, NULL },
+    { 0x01b45adf4ee11059ULL, "applicationWillTerminate:" },
+    { 0x505639180793ebbaULL, "_expressionWithSubstitutionVariables:" },
+    { 0x528c50e747ba29cfULL, "integerForKey:" },
+    { 0x4eceb7aa443ffa73ULL, "textView:willChangeSelectionFromCharacterRanges:toCharacterRanges:" },
+    { 0xd8334e455b3a99a9ULL, "normalizedHeaderWithName:" },
+    { 0x038bb2c26e2e7b87ULL, "loadView" },
+    { 0x5c519c846696de05ULL, "streamError" },
+    { 0xb99535ce626c0921ULL, "image" },
+    { 0xb0859d5dd27de54bULL, "localizedCaseInsensitiveCompare:" },
+    { 0x5b07cc47227224c2ULL, "centimetersMeasurementUnit" },
+    { 0xb83d619201d9909fULL, "checkMarkBackgroundMargins" },
+    { 0x5495ce290e082760ULL, "colorPanel" },
+    { 0x79c6797056110309ULL, "canBeCompressedUsing:" },
+    { 0xfa913a4bd055962aULL, "setIgnoredWords:" },
+    { 0xaeafe2da8d1ba622ULL, "itemTitleAtIndex:" },
+    { 0x738952972056ff78ULL, "isValid" },
+    { 0x16bd6dc431723209ULL, "allowsEditingMultipleValues" },
+    { 0, NULL },
+    { 0xa990da2312cfefa1ULL, "getGlyphsInRange:glyphs:characterIndexes:glyphInscriptions:elasticBits:bidiLevels:" },
+    { 0x661f12a492307fa5ULL, "canCloseDocument" },
+    { 0x1f1a3660cd2e686aULL, "nextDaylightSavingTimeTransitionAfterDate:" },
+    { 0x0dfd521ef4b09bedULL, "fixParagraphStyleAttributeInRange:" },
+    { 0, NULL },
+    { 0xea1471c9a567f082ULL, "URLByDeletingPathExtension" },
+    { 0, NULL },
+    { 0x6bfd3d1a51be70ddULL, "selectItemAtIndex:" },
+    { 0, NULL },
+    { 0x01d43762b6c02690ULL, "echosBullets" },
+    { 0x4f423381577379f0ULL, "setPatternPhase:" },
+    { 0x0f7afe27a72b25e9ULL, "stringFromNumberNoStyle:" },
+    { 0x1ec97f1ef3cfbb9eULL, "setMaxValue:" },
+    { 0x631775ab07625c35ULL, "dissolveToPoint:fromRect:fraction:" },
+    { 0xdac73020b047660cULL, "standardWindowButton:forStyleMask:" },
+    { 0, NULL },
+    { 0xade1d97ab211ca4dULL, "class" },
+    { 0, NULL },
+    { 0xa624a49972bc5373ULL, "addTemporaryAttributes:forCharacterRange:" },
+    { 0x4d4cda717aa53702ULL, "bezierPathWithCGPath:" },
+    { 0, NULL },
+    { 0x3aea76a54d8f9a74ULL, "tabView:willSelectTabViewItem:" },
+    { 0, NULL },
+    { 0xb0ed89855c43c73dULL, "setCachedSeparately:" },
+    { 0xf9409ab7747f56d2ULL, "removeSelectionIndexes:" },
+    { 0x2ee4af2bff4248d1ULL, "cancelButtonRectForBounds:" },
+    { 0x79652819286eae06ULL, "dataCell" },
+    { 0x29700ff053d0531aULL, "_openRecentDocument:" },
+    { 0xf5f1ebe8819705cfULL, "scrollToEndOfDocument:" },
+    { 0x28ad36715072e9cfULL, "isActiveExcludingWindow:" },
+    { 0x79bbcedc02b32b1fULL, "suspended" },
+    { 0x963c89902013abc2ULL, "brownColor" },
+    { 0xb75ef8f94e87755fULL, "getInfoForFile:application:type:" },
+    { 0x94c36324598e498cULL, "removeAllPoints" },
+    { 0x81d8c25aa97d9122ULL, "setBecomesKeyOnlyIfNeeded:" },
+    { 0, NULL },
+    { 0x598f7d823f4e5e2dULL, "closeTheme" },
+    { 0xe0c23f8d80ae944bULL, "_enabledCellAtPoint:row:column:" },
+    { 0x2489a8007048194aULL, "_invalidateTrackingAreas" },
+    { 0x37395bda35c3e125ULL, "formUnionWithCharacterSet:" },
+    { 0x2e477e0b85259f26ULL, "_setContent:" },
+    { 0xe8eaae1b08b98b5eULL, "reduceDiskCacheForSize:" },
+    { 0, NULL },
+    { 0x263b82e6d3a6af28ULL, "_headerValue" },
+    { 0x7e11b05e8763c912ULL, "createCGLContextObjIfNeeded" },
+    { 0x6cde27c835eb7d97ULL, "timeoutInterval" },
+    { 0xa03820550f9fe86eULL, "currentProgress" },
+    { 0, NULL },
+    { 0xc1cb7f062e62d088ULL, "_defaultTabStops" },
+    { 0x8f0173607a9d7413ULL, "objectValueForTableColumn:" },
+    { 0, NULL },
+    { 0x69822fd93598b48dULL, "resignKeyWindow" },
+    { 0xbf3fbc7594b11347ULL, "addItemWithTitle:" },
+    { 0x70782131f4efd27fULL, "contentIsChunked" },
+    { 0x602fa4fdccfbb560ULL, "tableColumnWithIdentifier:" },
+    { 0, NULL },
+    { 0xee5a372bd84e2812ULL, "readBytesAvailable" },
+    { 0x716e47a178545d2dULL, "graphicsContextWithWindow:" },
+    { 0xfcf96cfe2eb0e5dcULL, "_didNotPublish:" },
+    { 0x14c627a52709e8dfULL, "_scaledAndAlignedImageFrame:" },
+    { 0xb2e359df698b6649ULL, "center" },
+    { 0x675b728b41ad3825ULL, "queryFrame" },
+    { 0, NULL },
+    { 0x7f63c81fa88d262fULL, "didChangeValueForKey:" },
+    { 0, NULL },
+    { 0x8e71436fcdcfa38bULL, "_headerKey" },
+    { 0xe3c9e2857ff2aa4bULL, "canInitWithData:" },
+    { 0x93a6f845fb40db2cULL, "prefixForName:" },
+    { 0, NULL },
+    { 0x913778bb12e96089ULL, "_cell" },
+    { 0x1b1796eb5394a854ULL, "hyphenCharacterForGlyphAtIndex:" },
+    { 0xef1feb090b9ccc55ULL, "_acceptConnectionInBackgroundAndNotifyForModes:" },
+    { 0, NULL },
+    { 0x08f46da3ac562a85ULL, "windowNibPath" },
+    { 0x9f3ade2e093e1c23ULL, "numberWithUnsignedLongLong:" },
+    { 0x8764620e82256e22ULL, "standardOutput" },
+    { 0xb2cd3904660a6d0fULL, "autoresizesSubviews" },
+    { 0xc8c330631acb6d06ULL, "setArguments:" },
+    { 0x6767ecae3b334f9bULL, "concreteSubclass" },
+    { 0x483a06673124915bULL, "toolbar" },
+    { 0xd2a8b2f9acfb5b53ULL, "dataWithPropertyList:" },
+    { 0x1327f134d0436920ULL, "setContentAspectRatio:" },
+    { 0x7cf417b9e1dba9f8ULL, "readRTFDFromFile:" },
+    { 0xa66109c6bbacbb24ULL, "openGLFlushBufferOnlyContext:" },
+    { 0x0a586f28e343168dULL, "notificationWithName:object:" },
+    { 0xf12c4e32fe2e733eULL, "resourcePath" },
+    { 0xd5ad1290f1e981e3ULL, "leftTabMarkerWithRulerView:location:" },
+    { 0, NULL },
+    { 0x489ea8c120a19e58ULL, "setEditable:" },
+    { 0x6b481ef989905dbaULL, "sharedPrintInfo" },
+    { 0, NULL },
+    { 0xec9b6be92c476d77ULL, "bitBltWindow" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x01e9f0d43879d186ULL, "setWindowsMenu:" },
+    { 0, NULL },
+    { 0x1f8dcf309bf6df95ULL, "_softLineRangeForCharacterAtIndex:" },
+    { 0, NULL },
+    { 0x96b2b5fcebee509dULL, "forceLoadOfFontsAtPaths:" },
+    { 0x932b03c0378a4088ULL, "checkGrammarInString:language:details:" },
+    { 0xbbe65765013bc41eULL, "_findExecutable" },
+    { 0x107384ea6539b5ecULL, "tabView:didSelectTabViewItem:" },
+    { 0xa58bec1e84e82a05ULL, "frameOfInsideOfColumn:" },
+    { 0xd634a88410c614e0ULL, "documentRect" },
+    { 0x49c2f831aa689ca8ULL, "visual" },
+    { 0x5f89d266bbefe07eULL, "_baseHost" },
+    { 0xb7743f0d1c8d5f57ULL, "focusStack" },
+    { 0x2041c9987153623dULL, "shouldDrawInsertionPoint" },
+    { 0xad6349af253e501fULL, "timeZoneTypeWithSecondsFromGMT:isDaylightSavingTime:abbreviation:" },
+    { 0x77575efe54e3261dULL, "_extractWordFour" },
+    { 0xcba6a91f563dbfb6ULL, "methodSignatureForSelector:" },
+    { 0x93d147a940bf2925ULL, "attachColorList:" },
+    { 0x688d1806e0286ab6ULL, "autovalidates" },
+    { 0x94cb0cbfc426791aULL, "subpredicates" },
+    { 0xa63e05f2779a10dcULL, "bezierPathWithOvalInRect:" },
+    { 0xd02fd79a84e2abc5ULL, "earlierDate:" },
+    { 0x3540cae0b464dfe5ULL, "setShowsSuppressionButton:" },
+    { 0xcd4bc39c7aa3d6e0ULL, "isContinuous" },
+    { 0x85e4836f19c81ae4ULL, "parser:resolveExternalEntityName:systemID:" },
+    { 0xeff2a966d3bcac28ULL, "rulerView:didAddMarker:" },
+    { 0, NULL },
+    { 0x9a2f0853b83f3161ULL, "replaceCharactersInRange:withString:" },
+    { 0x5a62f7c5ed6a0649ULL, "selectKeyViewFollowingView:" },
+    { 0x100a11a7e4710ee9ULL, "stopMonitoring" },
+    { 0x8ee2d6432f0efb03ULL, "setBezelStyle:" },
+    { 0, NULL },
+    { 0x2807c1db735d592cULL, "heightOfMenuItem:" },
+    { 0, NULL },
+    { 0xa42d669906ca5ac1ULL, "standardizedURL" },
+    { 0, NULL },
+    { 0x62c26beab1824de1ULL, "makeKey" },
+    { 0xe8521d1215976303ULL, "postScrollWheelMSG:type:location:modifierFlags:window:" },
+    { 0x2c8891490f7e1e2aULL, "setupPixelFormat" },
+    { 0x47dc728c650130c3ULL, "wait" },
+    { 0x9ec7c3f70707eff5ULL, "notificationCenterForType:" },
+    { 0x441ff0037aa136faULL, "flushHostCache" },
+    { 0x04bcf1e9fe2759ffULL, "endGrouping" },
+    { 0x363e59a4b163677bULL, "setTarget:" },
+    { 0, NULL },
+    { 0x0859dab0c1206b36ULL, "activateContextHelpMode:" },
+    { 0, NULL },
+    { 0x2553761223f1f8fbULL, "tokenize" },
+    { 0xe06cef0c320f4799ULL, "documentVisibleRect" },
+    { 0x20f2c3121446257aULL, "setCharacterEncoding:" },
+    { 0x1ce6317c2dac9dc3ULL, "willChangeValueForKey:withSetMutation:usingObjects:" },
+    { 0x1959e563c5918241ULL, "setCanChooseDirectories:" },
+    { 0x804edc6c9306367eULL, "invalidateGlyphsForCharacterRange:changeInLength:actualCharacterRange:" },
+    { 0, NULL },
+    { 0x0f93ad0ac0e83b3aULL, "popUpContextMenu:withEvent:forView:" },
+    { 0x1d73b8dd4ff9094cULL, "setMinDate:" },
+    { 0x2da1f628b4ba21b0ULL, "checkSpaceForParts" },
+    { 0x6ff9ffbdd275c7b3ULL, "pathForAuxiliaryExecutable:" },
+    { 0x685b8c2c09aa75b1ULL, "modifierMaskWithKeyComponents:" },
+    { 0x691e1a737812a954ULL, "setShowsBaselineSeparator:" },
+    { 0x83c6144ff8e5021dULL, "archivedDataWithRootObject:" },
+    { 0xc6bc89bc8becc4cbULL, "forwardInvocation:" },
+    { 0x8c26d3d985548c05ULL, "undoManager" },
+    { 0xcac7b1631dd3d89dULL, "addSelectionIndexes:" },
+    { 0xf4a420fcabe4781cULL, "headerView" },
+    { 0xb32d39c03d8ab7a3ULL, "setMinimumIntegerDigits:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x00921ebfbd7fe594ULL, "getCompression:factor:" },
+    { 0xcb0cc5936e762785ULL, "isContextHelpModeActive" },
+    { 0x778f7a20964039c6ULL, "currentDestination" },
+    { 0, NULL },
+    { 0x6e8409b8abed297fULL, "_locationIsLeftToRight:" },
+    { 0, NULL },
+    { 0x09be13ccb67447e7ULL, "localizedRecoveryOptions" },
+    { 0xb7b1054144080695ULL, "toggle:" },
+    { 0x183bbd3d253cf04eULL, "beginDocument" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x820fc62e056ee90bULL, "openURL:" },
+    { 0x4ee62c9773fd2b07ULL, "setTableView:" },
+    { 0x139761419a23a852ULL, "drawMenuBarBackgroundInRect:" },
+    { 0x22b86a7f167e26f8ULL, "aspectRatio" },
+    { 0x23cb0e050ed5394dULL, "removeAllActions" },
+    { 0x3b1aafcb327ff47eULL, "moveWordBackward:" },
+    { 0x313be1e5f4c3eae4ULL, "imageRepClassForData:" },
+    { 0xf3cacae40067b29fULL, "colorListNamed:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd80cdccfc9edf393ULL, "drawMenuSelectionInRect:enabled:" },
+    { 0xd6899373724bb0f4ULL, "encodeString:indent:" },
+    { 0xfdffb667a93590b1ULL, "failureResponse" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xaf2fb0c0f83ae459ULL, "predicateWithLeftExpression:rightExpression:modifier:type:options:" },
+    { 0, NULL },
+    { 0x3d88cead790d64aeULL, "leftMarginMarkerWithRulerView:location:" },
+    { 0x69f27ace7f4680e1ULL, "canonicalLocaleIdentifierFromString:" },
+    { 0, NULL },
+    { 0x0269dbd18d4de03fULL, "nibBundle" },
+    { 0, NULL },
+    { 0x44b7fb216427a33cULL, "containsObjectForWrite:" },
+    { 0, NULL },
+    { 0xa111053cb263e104ULL, "createSymbolicLinkAtPath:pathContent:" },
+    { 0x484fdd9524a884f8ULL, "setCurrentColor:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4c3df2068313d321ULL, "draggingUpdated:" },
+    { 0xe7ba61a62d682ef1ULL, "netServiceDidResolveAddress:" },
+    { 0x37f2140480a8a54fULL, "internalError:" },
+    { 0xbd2c557a09bd8fd2ULL, "windowDidMiniaturize:" },
+    { 0xd7986b89a9ac9f7cULL, "encodePortObject:" },
+    { 0, NULL },
+    { 0x6a935f03fb5f1baeULL, "preferredEdge" },
+    { 0xfe21ec49ae9df0beULL, "setNegativePrefix:" },
+    { 0x0a4116e08b52b7f0ULL, "setDrawsOutsideLineFragment:forGlyphRange:" },
+    { 0, NULL },
+    { 0xbd66bff8230f668fULL, "application:openFile:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x196357366117832fULL, "setNonBlocking:" },
+    { 0x010ad4230904c520ULL, "isRedoing" },
+    { 0x5902db116fa89272ULL, "cookies" },
+    { 0, NULL },
+    { 0x0808a716c006548aULL, "centerScanRect:" },
+    { 0x48ee858d0df1e164ULL, "normalImage" },
+    { 0, NULL },
+    { 0xd1a6d0ca51bef9d9ULL, "subpathsAtPath:" },
+    { 0xc1d3bc688c1ba519ULL, "canRedo" },
+    { 0x7ec905d7147bce10ULL, "application:printFiles:withSettings:showPrintPanels:" },
+    { 0x0a8bb71c98862e51ULL, "locationInWindow" },
+    { 0, NULL },
+    { 0xe2b565f42b7f7d34ULL, "setWindow:" },
+    { 0x6ea11f134ea5107aULL, "portList" },
+    { 0xf3b2b54afdb870b7ULL, "bezierPathWithRoundedRect:xRadius:yRadius:" },
+    { 0x7517cdb9c1583b6bULL, "classForClassName:" },
+    { 0x0503ba05f744ee76ULL, "removeChildAtIndex:" },
+    { 0xb2f5bf449dce0973ULL, "parentWindowDidChangeFrame:" },
+    { 0xbbe1c99f87f1ac09ULL, "readEncrypted:maxLength:" },
+    { 0xe161cf350bb45ca0ULL, "absolutePathForAppBundleWithIdentifier:" },
+    { 0xc3d843b52311c593ULL, "bindingPath" },
+    { 0xa06c2f9194078d08ULL, "usesAlternatingRowBackgroundColors" },
+    { 0xaa48a102d0662cedULL, "platformWindowDidEndSizing:" },
+    { 0x6a3e1a6c1b54b31dULL, "setLaunchPath:" },
+    { 0, NULL },
+    { 0x619f8c37579bb632ULL, "_imageValue" },
+    { 0xfc596ec16f9c7b94ULL, "encodeBytes:length:forKey:" },
+    { 0x70daf8c813c47a4dULL, "doubleClickAtIndex:" },
+    { 0x5ac868ec3e9c918eULL, "setLineBreakMode:" },
+    { 0x5b4b9b4dcc1017ceULL, "fileWrapperOfType:error:" },
+    { 0xe0e38c5dd751fa03ULL, "menuWillOpen:" },
+    { 0x7970426de282ec4fULL, "setUsesStrongWriteBarrier:" },
+    { 0x1a4f89549409ba06ULL, "_incrementByPercentageAndConstrain:decrement:" },
+    { 0x176a4620b562f8f9ULL, "removeProgressMark:" },
+    { 0, NULL },
+    { 0x0293ec1fcf6aa64aULL, "waitForDataInBackgroundAndNotify" },
+    { 0, NULL },
+    { 0xfb92d82df8aa01a6ULL, "drawTableViewCornerInRect:" },
+    { 0x2592e9c9f8352618ULL, "unexpectedIn:" },
+    { 0xd1c94a06894fc482ULL, "textUnfilteredPasteboardTypes" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe41a0e2c46007406ULL, "trackingMode" },
+    { 0xe6d3303aa61d5859ULL, "contextualMenuCursor" },
+    { 0xef6675fee1ff2970ULL, "hasDynamicDepthLimit" },
+    { 0x6cb988551187ea24ULL, "newObject" },
+    { 0x17990f39fe58fe15ULL, "addAttribute:value:range:" },
+    { 0x65b5e278bc3481f0ULL, "initWithAttributes:range:" },
+    { 0xbf35c455d50a41e7ULL, "netServiceBrowser:didNotSearch:" },
+    { 0x30cfd3b15b4de3c6ULL, "_tightenUpColumn:forItem:" },
+    { 0x64ad3126240767dbULL, "drawSwatchInRect:" },
+    { 0x3e6869d0a3e550b6ULL, "PDFOperationWithView:insideRect:toData:" },
+    { 0, NULL },
+    { 0xcb1e66390dbca5f6ULL, "setMovable:" },
+    { 0xc6db42a152b98cedULL, "_itemsWithIdentifiers:" },
+    { 0x3bf0f53b3737236dULL, "loadNibFile:externalNameTable:withZone:" },
+    { 0xa27f28e21feebc4bULL, "decodeClassName:asClassName:" },
+    { 0x1db11e217640f8f9ULL, "takeStringValueFrom:" },
+    { 0x1d22027f6c5d1014ULL, "hasHorizontalScroller" },
+    { 0xae71b522dc2cf2e0ULL, "enableKeyEquivalentForDefaultButtonCell" },
+    { 0xc8869852b65adfbfULL, "setStandardError:" },
+    { 0xef4d66cdf1bd7e0fULL, "setLevel:" },
+    { 0xfc809689eff28e21ULL, "_netServiceDidStop" },
+    { 0xe0972eee99dcd3a1ULL, "itemIdentifiers" },
+    { 0x6dc9fdd86c8cdab3ULL, "setQuartzDebuggingEnabled:" },
+    { 0x9cfbcfba3679dd85ULL, "measurementUnitNamed:" },
+    { 0x4555e2a1b794902bULL, "setAutoenablesItems:" },
+    { 0xd9380e4107637828ULL, "stringByFoldingWithOptions:locale:" },
+    { 0x871e6e0eefc4ddabULL, "setFontPanel:" },
+    { 0xd3f1a54627e8fb6bULL, "_encodeString:" },
+    { 0xa2848eafe837e97cULL, "strikethroughGlyphRange:strikethroughType:lineFragmentRect:lineFragmentGlyphRange:containerOrigin:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xba518692eeb3ce18ULL, "_unloadAfterColumn:" },
+    { 0x45bd4f4fdb506358ULL, "setImageScaling:forSegment:" },
+    { 0, NULL },
+    { 0x4090ac8e562cc712ULL, "unsignedIntegerValue" },
+    { 0xb8f81b6d6196cc6eULL, "sendsActionOnEndEditing" },
+    { 0x7c59e03a4448a7bcULL, "cyanColor" },
+    { 0x9e37a56823fa7e4bULL, "numberOfRowsInTableView:" },
+    { 0, NULL },
+    { 0xdc9b9f8bd031aa65ULL, "postNotificationName:object:userInfo:" },
+    { 0x367ebc29b101de0cULL, "instantiateNibWithOwner:topLevelObjects:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2914f08e80a9e16dULL, "setEchosBullets:" },
+    { 0x51e09100e52a0743ULL, "readInBackgroundAndNotify" },
+    { 0x84beb52ec16fb8d4ULL, "decimalNumberByRoundingAccordingToBehavior:" },
+    { 0xf3632836cda12163ULL, "performSelector:withObject:afterDelay:inModes:" },
+    { 0xdf5bc1f87774a3ebULL, "undoNestedGroup" },
+    { 0, NULL },
+    { 0x03dbd053d9bae13eULL, "setScrollable:" },
+    { 0x349e2e6534cfaff9ULL, "addMarker:" },
+    { 0x10c4b0ee7a960753ULL, "initWithParent:object:" },
+    { 0xd57655c0f05c26dcULL, "setAttributedStringValue:" },
+    { 0x23e152aa9a2cc4c0ULL, "checkMark" },
+    { 0x3266a35ea730beefULL, "setRulersVisible:" },
+    { 0xecd06de9c2e04a73ULL, "keyPathsForValuesAffectingValueForKey:" },
+    { 0x66b8c7ad7f0b7913ULL, "canChooseFiles" },
+    { 0, NULL },
+    { 0x47891c2ba81289beULL, "removeToolTip:" },
+    { 0x684c5ef2536a51c7ULL, "GetData::" },
+    { 0x90ec45baa055d709ULL, "isPartialStringValid:proposedSelectedRange:originalString:originalSelectedRange:errorDescription:" },
+    { 0xc377a7a4f69cea6aULL, "scrollItemAtIndexToVisible:" },
+    { 0xf3dba3876708d445ULL, "type:conformsToType:" },
+    { 0x047dcfeac47a5d1eULL, "_updateBidiLevelsForRange:" },
+    { 0xec12995d3b004092ULL, "fileHandleForWriting" },
+    { 0xb1233778ffa3febcULL, "cachedResponseForRequest:" },
+    { 0x5983bc8eefaa27eeULL, "draggedImageLocation" },
+    { 0x650f217f81c5a128ULL, "windowWillMove:" },
+    { 0, NULL },
+    { 0x0b659f3b62607e23ULL, "deselectAllCells" },
+    { 0x9c4699589ab5c5cbULL, "encodeDictionary:indent:" },
+    { 0x7a555293f76e700fULL, "removeChildWindow:" },
+    { 0xac11f2302443326cULL, "methodForSelector:" },
+    { 0xc1459ffa20d99451ULL, "setSourceOperationMask:" },
+    { 0xed0de9afb7ed76d6ULL, "autosaveExpandedItems" },
+    { 0x5c3373040cfa1d94ULL, "addInvocation:" },
+    { 0xddbca420ea281843ULL, "_extractCStringBytes" },
+    { 0xb032132c6adf3ff6ULL, "entityName" },
+    { 0xb6d1bfa2c620e6e5ULL, "_extractArrayOfObjCType:length:at:" },
+    { 0, NULL },
+    { 0x6798c2845c448f71ULL, "_allFileExtensions" },
+    { 0xce1d14d6e46fd189ULL, "setHeaderLevel:" },
+    { 0x5c6d8c59171c0fe3ULL, "characterEncoding" },
+    { 0x5f62426020e8a2f7ULL, "pageDown:" },
+    { 0x58515ee8ad4ba404ULL, "modifyFontViaPanel:" },
+    { 0xe0dbaecaff4f2b6dULL, "timerWithTimeInterval:invocation:repeats:" },
+    { 0xaf3991cd1d4ded04ULL, "placeholderAttributedString" },
+    { 0x9ee160d9af02b716ULL, "getFirstUnlaidCharacterIndex:glyphIndex:" },
+    { 0x4d45ea233b107983ULL, "identifier" },
+    { 0xada340f0fd2d1f69ULL, "textBackgroundColor" },
+    { 0x8de7748e976ef6c0ULL, "dataRepresentationOfType:" },
+    { 0xc3f9e111675d91deULL, "createDirectoryAtPath:withIntermediateDirectories:attributes:error:" },
+    { 0x716b7372914688fcULL, "setPercentSymbol:" },
+    { 0xe9e6c1939051170cULL, "objectEnumerator" },
+    { 0x66a38dfa585d650bULL, "initWithIndex:" },
+    { 0, NULL },
+    { 0x13094f7f5c5a4e9fULL, "systemFontOfSize:" },
+    { 0x76aab0af8a7dd0a5ULL, "_createDefaultColorLists" },
+    { 0xe830c886140d9d37ULL, "changeColor:" },
+    { 0, NULL },
+    { 0x28bca0bb18d300a2ULL, "setValue:forUndefinedKey:" },
+    { 0x53e903bf51e65a7fULL, "applicationDockMenu:" },
+    { 0x2e0ebf5cc4dfea86ULL, "scrollView" },
+    { 0x693be47f9fc49c05ULL, "setAllowsTruncatedLabels:" },
+    { 0x87a94b8849503f0cULL, "groupingSeparator" },
+    { 0, NULL },
+    { 0x7bbe144c6b4afac1ULL, "setAutosaveTableColumns:" },
+    { 0xb7b706ec719277a6ULL, "advanceStateWithData:" },
+    { 0x58e40b2502615b2fULL, "close:" },
+    { 0x1e1572c934c61063ULL, "setMaximumIntegerDigits:" },
+    { 0, NULL },
+    { 0x6ef8551779784db1ULL, "setFrame:display:animate:" },
+    { 0x03f169f86287061dULL, "hasIdleNotificationsInMode:" },
+    { 0x570b5b48b82f807fULL, "typefaces" },
+    { 0x786d81e295263facULL, "indexOfItem:" },
+    { 0, NULL },
+    { 0xc108993cb4e304e1ULL, "textView:completions:forPartialWordRange:indexOfSelectedItem:" },
+    { 0x1e018db42fc7d073ULL, "removeCredential:forProtectionSpace:" },
+    { 0x0497a85b89f0ce0cULL, "fileWrapper" },
+    { 0xb32f148635bb45feULL, "fileDescriptor" },
+    { 0x18e86f230745413fULL, "predicateWithFormat:" },
+    { 0xacbd8c82c91fa395ULL, "_setItemViewFrame:" },
+    { 0x5a8dbae0b8996354ULL, "setValueWraps:" },
+    { 0xe357a6f2c04a56a0ULL, "outlineViewSelectionIsChanging:" },
+    { 0x5234932a313193c1ULL, "publicID" },
+    { 0xa73d86e7cf9faae6ULL, "setPaddingPosition:" },
+    { 0xeb47626a55282b43ULL, "setColorPanel:" },
+    { 0, NULL },
+    { 0x4d4a97cc6453415bULL, "fileNamesFromRunningOpenPanel" },
+    { 0, NULL },
+    { 0xb5f6f0c12acc9cedULL, "selectedTabViewItem" },
+    { 0, NULL },
+    { 0x7f11cfdc30e44979ULL, "_selectedIndex" },
+    { 0xf165b6955cafa3e1ULL, "performSelectorOnMainThread:withObject:waitUntilDone:" },
+    { 0xed57d14430edc2e1ULL, "removeTrackingArea:" },
+    { 0xad4b722809ad72daULL, "fontFamilies" },
+    { 0x9984481ad4df3471ULL, "bezierPathByReversingPath" },
+    { 0x0b50f8ba5024e393ULL, "_selectedColorPicker" },
+    { 0x6d91bc2c729a4e31ULL, "isConcurrent" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x578a12845103ccdfULL, "cancelUserAttentionRequest:" },
+    { 0x0cec425c55577935ULL, "firstWeekday" },
+    { 0x062e85dcf5cf8723ULL, "cachedResponse" },
+    { 0, NULL },
+    { 0x4d9e087c6e51de7bULL, "selectedControlColor" },
+    { 0x1f0063e5fd72e501ULL, "removeObjectsFromIndices:numIndices:" },
+    { 0x77469e37ebf20800ULL, "revertToSavedFromFile:ofType:" },
+    { 0, NULL },
+    { 0xa1f7c561f05090e0ULL, "setNegativeSuffix:" },
+    { 0x1f9d6b963073b220ULL, "setVerticalRulerView:" },
+    { 0x41c98d04b6c6162aULL, "threadPriority" },
+    { 0x435a011e2af45de0ULL, "removeObjectsAtArrangedObjectIndexes:" },
+    { 0xc74d3f6b3c557c22ULL, "availableFontFamilies" },
+    { 0xaff4dc97b7683b14ULL, "setClientView:" },
+    { 0xd8880de58123b178ULL, "pathComponentCells" },
+    { 0x24fb5c5c0c8e0e7aULL, "localizedNameForTIFFCompressionType:" },
+    { 0x22ade0787e326fd4ULL, "setFrame:display:" },
+    { 0xb29bcb9c9a65b41fULL, "adjustPageWidthNew:left:right:limit:" },
+    { 0xff588e67ced07d5bULL, "minFrameWidthWithTitle:styleMask:" },
+    { 0x95cf2e92fce13ae8ULL, "deactivate" },
+    { 0x2df4f44b4b7b18fbULL, "characterIsMember:" },
+    { 0xac09ddb8dbf59f55ULL, "_KVO_classForCoder" },
+    { 0x7772e6dba0e238b5ULL, "toolbarItemClass" },
+    { 0, NULL },
+    { 0x9da9785c2cc1ffb0ULL, "userInfo" },
+    { 0xaca477bc29d1036fULL, "rightMouseDragged:" },
+    { 0x8078f80700751cf8ULL, "highlightColorInView:" },
+    { 0x5352c1558347f559ULL, "printInfo" },
+    { 0xbcbab9561335b2beULL, "isAutodisplay" },
+    { 0xccfab805ee7ac4c5ULL, "setStackSize:" },
+    { 0x95aff5e5438dd57eULL, "searchList" },
+    { 0xd1aaf6989892882cULL, "setImageScaling:" },
+    { 0x8a382554dfde57c9ULL, "drawGlyphsForGlyphRange:atPoint:" },
+    { 0xaf90d9e89b44f95aULL, "cString" },
+    { 0x2814b8170dda3998ULL, "drawRulerlineLocationsInRect:" },
+    { 0x98fc501c8f4cf286ULL, "nextWordFromIndex:forward:" },
+    { 0xc1d1a245f2b035b9ULL, "notifyObserver:" },
+    { 0xcf8e993891173931ULL, "dataForKey:" },
+    { 0x494bc985825caa1fULL, "glyphIsEncoded:" },
+    { 0x9ad3914b63ef4752ULL, "performSelectorOnMainThread:withObject:waitUntilDone:modes:" },
+    { 0x0deb5b2dad2ea306ULL, "rootProxyForConnectionWithRegisteredName:host:" },
+    { 0xe981d32b36ccbd28ULL, "isDaylightSavingTimeForDate:" },
+    { 0x6e5a266ffad4d454ULL, "fixupSelectionInRange:changeInLength:" },
+    { 0x654c79ed29bf8d72ULL, "DUnadvise:" },
+    { 0xd2dcc0214ec5ba38ULL, "setPreferredFilename:" },
+    { 0x22b298563c905f2fULL, "openOnEdge:" },
+    { 0x9376f036a7828e42ULL, "realm" },
+    { 0x1ff852134f9e3e95ULL, "roundingMode" },
+    { 0x4a78e409a8be7d6aULL, "predicateWithValue:" },
+    { 0, NULL },
+    { 0xaa80bce685ff35ffULL, "buildFamilyMatrix" },
+    { 0x3628dd1b1898d4bfULL, "usesScreenFonts" },
+    { 0xd70f3af56eac0badULL, "error" },
+    { 0xf9b5417bfd69b6efULL, "subviews" },
+    { 0xaab40046b56ff465ULL, "defaultManager" },
+    { 0, NULL },
+    { 0xc087e311bd6644a2ULL, "_evaluateValue:withObject:" },
+    { 0xda876de589c5ab97ULL, "stringFromDate:" },
+    { 0x736a45e018d4064aULL, "didChangeArrangementCriteria" },
+    { 0x142a424c2fbd1adaULL, "cells" },
+    { 0x4cf1d3452e3dfb1fULL, "typeChanged:" },
+    { 0x0048bb4418fec591ULL, "currentLanguage" },
+    { 0xd50e6452b3a15725ULL, "caseInsensitiveCompare:" },
+    { 0, NULL },
+    { 0x7c36daa514f13266ULL, "markers" },
+    { 0x75a0a9e2561b8547ULL, "dayOfCommonEra" },
+    { 0x1751e149ac496b28ULL, "removeItemWithTitle:" },
+    { 0x4758760f12b05dbfULL, "controlTextDidBeginEditing:" },
+    { 0x4e1e0188d591041dULL, "rangeOfComposedCharacterSequenceAtIndex:" },
+    { 0x449edac2742dcbbdULL, "_selectedLabel" },
+    { 0, NULL },
+    { 0xff56b9ebdacde224ULL, "fileURL" },
+    { 0x48bff5eafe4d125eULL, "_binderForBinding:" },
+    { 0xfbe9c3598c19a9d1ULL, "graphicsPortForPrintOperationWithView:printInfo:pageRange:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x070eaddd80f11de1ULL, "invalidateHashMarks" },
+    { 0x0f6bd34b2195f4faULL, "pathForImageResource:" },
+    { 0x87ae1062fb808213ULL, "checkSpellingOfString:startingAt:language:wrap:inSpellDocumentWithTag:wordCount:" },
+    { 0, NULL },
+    { 0xf2569591ef026b9fULL, "setLineCapStyle:" },
+    { 0, NULL },
+    { 0x80ed1d0f38514c6eULL, "animationDidEnd:" },
+    { 0xc2fb9def6055ce50ULL, "splitView:constrainMinCoordinate:ofSubviewAt:" },
+    { 0, NULL },
+    { 0x8797120b9251ef09ULL, "overflowRect" },
+    { 0, NULL },
+    { 0xf73e0945d0a09819ULL, "animates" },
+    { 0x878ce7276eabd415ULL, "outputStream:handleEvent:" },
+    { 0xd0bfc0628f80e3e8ULL, "suspend" },
+    { 0x733d7593569dd533ULL, "defaultCompletionDelay" },
+    { 0x74f9da4eba20ab27ULL, "connection:willCacheResponse:" },
+    { 0x6b94f5088cc7e936ULL, "itemArray" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x214611f037295ff7ULL, "setFormat:" },
+    { 0, NULL },
+    { 0x649dd5a086912b2aULL, "displayModeChanged:" },
+    { 0x7fd85c316dda9ce1ULL, "_bestUncachedRepresentationForDevice:" },
+    { 0x05731c20d90947fcULL, "appendBezierPath:" },
+    { 0xd0a4d0d141a55af2ULL, "_tokenFieldCell" },
+    { 0xe45d37caaec42f80ULL, "resolverCallback:flags:interface:error:fullname:target:port:length:record:" },
+    { 0xb01bbb289feb874bULL, "_popUpItemAction:" },
+    { 0xeb89ce29b2de06e5ULL, "windowNumbersWithOptions:" },
+    { 0, NULL },
+    { 0x9ad48a792c05f51dULL, "respondsToSelector:" },
+    { 0x410c2a19c6c277c3ULL, "connectionForProxy" },
+    { 0, NULL },
+    { 0xb7ccbbd495748f86ULL, "getOrderedGlyphs:range:baseLevel:order:" },
+    { 0x69d1f42dfe8d6afeULL, "currentContextDrawingToScreen" },
+    { 0xa4989d8f4458d57fULL, "commitEditing" },
+    { 0x3c13996ca168ff61ULL, "removeIndex:" },
+    { 0xd5dcae27a1880126ULL, "writePlaintext:maxLength:" },
+    { 0xbfd675598fe3e055ULL, "_menuWithName:" },
+    { 0x56ad8ddd09538b47ULL, "setFontManagerFactory:" },
+    { 0x6a1e220012b7b894ULL, "removeObserver:" },
+    { 0x2ac3ced83b30ac2eULL, "invocation" },
+    { 0x9c7f751ba27a915bULL, "connectionWithReceivePort:sendPort:" },
+    { 0x29b296f8a57eeafbULL, "encodePropertyList:" },
+    { 0xabdb2437820e060fULL, "resourceDataUsingCache:" },
+    { 0x86cb9b906726d18eULL, "removeObjectIdenticalTo:inRange:" },
+    { 0x2d1d06fbd40d761eULL, "setImageAlignment:" },
+    { 0xd2e0138a385076fcULL, "windowNumber" },
+    { 0x17a806cdfee1e0c1ULL, "protectionSpace" },
+    { 0x6123375330f117aaULL, "rulerMarkersForTextView:paragraphStyle:ruler:" },
+    { 0, NULL },
+    { 0x8c3a060d7c3fc439ULL, "postNotification:" },
+    { 0, NULL },
+    { 0xfac7137222b797abULL, "setSelectionFrom:to:anchor:highlight:" },
+    { 0xc2af93b404593557ULL, "cacheArrayKeyPath" },
+    { 0x74e55b6ae186b3f6ULL, "focusView" },
+    { 0x84485c016489fa78ULL, "RTFDFileWrapperFromRange:documentAttributes:" },
+    { 0, NULL },
+    { 0xef14da6b509f2605ULL, "cursor" },
+    { 0, NULL },
+    { 0x5d755823b82c20c3ULL, "setAllowsMixedState:" },
+    { 0x5a25561a4d2a494dULL, "resume" },
+    { 0, NULL },
+    { 0xe2b41270e039130bULL, "isFlushWindowDisabled" },
+    { 0x077abd718df30995ULL, "moveForwardAndModifySelection:" },
+    { 0, NULL },
+    { 0xc0dc6d2bc8d4220eULL, "frameOfOutlineCellAtRow:" },
+    { 0x09a81fd35abac4d9ULL, "scrollPageUp:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4d01f85bf3d1f68aULL, "getHue:saturation:brightness:alpha:" },
+    { 0x9a2fa4f9c75f9977ULL, "reloadData" },
+    { 0xc518d4c8e8a721e9ULL, "cookiesForURL:" },
+    { 0x13d3c23b6c25f5d0ULL, "download:willResumeWithResponse:fromByte:" },
+    { 0x4f593c9652296000ULL, "addCharactersInRange:" },
+    { 0xee6b3d3173e9dc9dULL, "ensureLayoutForTextContainer:" },
+    { 0x1363460ea069762fULL, "invertedSet" },
+    { 0, NULL },
+    { 0x669d5c503d0aaaffULL, "secondOfMinute" },
+    { 0x5e36532b2f1a844fULL, "maximum" },
+    { 0x25254d0b011ca981ULL, "disableUndoRegistration" },
+    { 0xfccbe8bd81ce97faULL, "expandItem:" },
+    { 0x16c54c72a2935219ULL, "appendData:" },
+    { 0x90f7e7aa6e94e49dULL, "incrementChangeCount" },
+    { 0x1ddf6673587e40c8ULL, "setValues:forParameter:" },
+    { 0xf4e4035ec6e033a1ULL, "setSubmenu:forItem:" },
+    { 0x903fc72ed2e0b588ULL, "verticalPagination" },
+    { 0x17f9e78e3b91a1aaULL, "timeInterval" },
+    { 0xe330f64b31fd58ccULL, "fireDate" },
+    { 0xc23fef8932667067ULL, "popState" },
+    { 0x9cae8b93850ad594ULL, "orientation" },
+    { 0xc5f1e094916d357dULL, "initSymbolicLinkWithDestination:" },
+    { 0x84f90dd76f55145fULL, "valueWithRect:" },
+    { 0x07ce112efc3e1eacULL, "setFormatWidth:" },
+    { 0xf71289876a952d61ULL, "completePathIntoString:caseSensitive:matchesIntoArray:filterTypes:" },
+    { 0xf8e5395be23625cfULL, "_zoneinfoPath" },
+    { 0, NULL },
+    { 0x75ea2ffd693d652eULL, "setNextUndoManager:" },
+    { 0x4642b7f10984e4dbULL, "ISOCountryCodes" },
+    { 0, NULL },
+    { 0x29dae9a466c7a32cULL, "waitForSingleInputForMode:beforeDate:" },
+    { 0x42232cef6fece577ULL, "lossyCString" },
+    { 0, NULL },
+    { 0x3ca6282f6efea930ULL, "beginSheetForDirectory:file:modalForWindow:modalDelegate:didEndSelector:contextInfo:" },
+    { 0, NULL },
+    { 0x7669dbed42d01966ULL, "statusBar" },
+    { 0x3d3eb676ba17d411ULL, "setOrientation:" },
+    { 0xa9f0a2726a8d801eULL, "synchronize" },
+    { 0xce8458aac5849379ULL, "uppercaseWord:" },
+    { 0x07ac5846754928aaULL, "acceptConnectionInBackgroundAndNotify" },
+    { 0x13ecb3dea0dcbe68ULL, "usedRectForTextContainer:" },
+    { 0x818038d373b01e6eULL, "attributesForLabel" },
+    { 0xf301686bf72d1f0dULL, "mouseLocation" },
+    { 0x27b30eddf9a85ac3ULL, "beginSheetModalForWindow:modalDelegate:didEndSelector:contextInfo:" },
+    { 0x86c5ffc4f18838b1ULL, "writableTypesForSaveOperation:" },
+    { 0xc0cf4ef82afb1737ULL, "allKeysForObject:" },
+    { 0, NULL },
+    { 0x6ec5fb71a235d547ULL, "setEnabled:" },
+    { 0, NULL },
+    { 0x5b40a9c42f2d69b2ULL, "reloadItem:" },
+    { 0x95ac4b9b52aa3583ULL, "fixAttributesInRange:" },
+    { 0xfbdcb3e457b4fdd7ULL, "_unregisterPerform" },
+    { 0x065292ca305bf35aULL, "titlePosition" },
+    { 0xb0b5f6e26728f655ULL, "createCustomInstance" },
+    { 0xf56135fe3e51db46ULL, "addTrackingRect:owner:userData:assumeInside:" },
+    { 0x0b2e08e510cde9c4ULL, "_draggedTypes" },
+    { 0xd0194a9407a43829ULL, "_displayIfNeededWithoutViewWillDraw" },
+    { 0x1db535b0862a995cULL, "appendBezierPathWithRoundedRect:xRadius:yRadius:" },
+    { 0xdba04989366803bfULL, "attributesAtIndex:effectiveRange:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf21f088fd9915d75ULL, "addItemWithObjectValue:" },
+    { 0, NULL },
+    { 0x61262bd5e940666dULL, "download:didCancelAuthenticationChallenge:" },
+    { 0xa06dca13dd2fc431ULL, "validate" },
+    { 0x675eacf0f9a50faaULL, "scanString:intoString:" },
+    { 0x5fb797482a161be0ULL, "displayRect:" },
+    { 0x4b4393f03c2f084fULL, "resignFirstResponder" },
+    { 0, NULL },
+    { 0x5272880aa5a788ecULL, "iconForFile:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x9c6c62e6d323f86aULL, "gridStyleMask" },
+    { 0x0e8e1313d83cc8e5ULL, "fileManager:shouldRemoveItemAtPath:" },
+    { 0, NULL },
+    { 0xf734d80e1f9ac6e2ULL, "label" },
+    { 0xc06b851614ba6f5aULL, "requestUserAttention:" },
+    { 0, NULL },
+    { 0xc763680fcec97e20ULL, "splitView:constrainMaxCoordinate:ofSubviewAt:" },
+    { 0x9814cc9b5ed43e74ULL, "isFinished" },
+    { 0x7f2d6156d6a4a0c2ULL, "getReturnValue:" },
+    { 0, NULL },
+    { 0x817c19a70054e0ccULL, "makeFirstResponder:" },
+    { 0x6c284e670a8b2de0ULL, "setLeadingOffset:" },
+    { 0x26a7c21495788609ULL, "scrollWheel:" },
+    { 0, NULL },
+    { 0xcd985bd87669daeeULL, "namespaces" },
+    { 0, NULL },
+    { 0x707d5f2f11e62de9ULL, "generateData" },
+    { 0, NULL },
+    { 0x8b5cf580ebbe1630ULL, "removeTableColumn:" },
+    { 0x90e22cc874edd17fULL, "mouseExited:" },
+    { 0x82c596990451c1e8ULL, "closestTickMarkValueToValue:" },
+    { 0xad23109cc724355cULL, "cursorRectWithCursor:" },
+    { 0x18cefea999011b91ULL, "_syncToNewColor" },
+    { 0x0ca88d42514d97bcULL, "QueryGetData:" },
+    { 0x58000c1b4776c031ULL, "drawerWillClose:" },
+    { 0xd666f5bb654c77bfULL, "condition" },
+    { 0xb6588eb1345217ccULL, "keysSortedByValueUsingSelector:" },
+    { 0x33bc56b8881d4c7fULL, "setWidth:type:forLayer:edge:" },
+    { 0x2ccb51e2ed5acf0eULL, "autoscroll:" },
+    { 0, NULL },
+    { 0x3d6b880a84756af2ULL, "userDefaultsDidChange:" },
+    { 0xdf5d59d34e004b49ULL, "invoke" },
+    { 0xbfc8ca51eb8927f9ULL, "colorWithHue:saturation:brightness:alpha:spaceName:" },
+    { 0x04446a675ce401baULL, "initWithAffectedRange:layoutManager:undoManager:replacementRange:" },
+    { 0xba8ebb6041892683ULL, "textUnfilteredFileTypes" },
+    { 0xab7843b42a107f93ULL, "reservedThicknessForAccessoryView" },
+    { 0xee43918be6b3becfULL, "_replaceCharactersInRange:withString:useTypingAttributes:" },
+    { 0xcbfff6811a012115ULL, "moveWordLeftAndModifySelection:" },
+    { 0x1a24ca0f863e4f45ULL, "setGroupingSeparator:" },
+    { 0, NULL },
+    { 0x54ecb69aba55f76fULL, "scheme" },
+    { 0, NULL },
+    { 0x0535b310565de18fULL, "setControlView:" },
+    { 0, NULL },
+    { 0x453ae7b4328b729dULL, "containsValueForKey:" },
+    { 0x9ec16d3944ec568dULL, "adjustEventLocation:childWindow:" },
+    { 0, NULL },
+    { 0x0d1e75432a71bd2cULL, "drawSelector" },
+    { 0x9eafd9cc90531d5eULL, "preparePageLayout:" },
+    { 0x6289453584f95aa3ULL, "_extractCString" },
+    { 0, NULL },
+    { 0x2ad891339149b784ULL, "netService:didNotResolve:" },
+    { 0x201f88ea6a5607d2ULL, "names" },
+    { 0xc7fdb96992797738ULL, "setDividerStyle:" },
+    { 0x05715320155474b8ULL, "rulerView:handleMouseDown:" },
+    { 0, NULL },
+    { 0xdc6976dda379c407ULL, "Clone:" },
+    { 0xe9a87160c32b1962ULL, "frame" },
+    { 0x0bfd796abe2523b7ULL, "buttonRectForBounds:" },
+    { 0x3b338cd989f92b9eULL, "currentFontAction" },
+    { 0x33eb6571462473e8ULL, "setTextColor:range:" },
+    { 0x96c0cf6a7e904e5dULL, "allowsReverseTransformation" },
+    { 0, NULL },
+    { 0xc32913059eac12aeULL, "drawer" },
+    { 0, NULL },
+    { 0xb2a0c816df2d2984ULL, "_boundValuesChanged" },
+    { 0xfa7c9aabbced7c76ULL, "noteNewRecentDocument:" },
+    { 0xc4ed899719062a32ULL, "isLayeredWindow" },
+    { 0x9b84ad561fbb56d3ULL, "setAllowsConcurrentViewDrawing:" },
+    { 0xc122888e404c6cdfULL, "setWraps:" },
+    { 0xe5b683b706480eb5ULL, "objectAtIndex:" },
+    { 0x5308a4b7e81dc6f0ULL, "extractFromNegativeFormat" },
+    { 0x184a9b3fe71e8cdbULL, "blueColor" },
+    { 0, NULL },
+    { 0x160e5d19c2e8196bULL, "componentsSeparatedByCharactersInSet:" },
+    { 0xfb0e10a182023213ULL, "setTXTRecordData:" },
+    { 0x69c6e9e42f196333ULL, "subpathsOfDirectoryAtPath:error:" },
+    { 0, NULL },
+    { 0x247323a003fec598ULL, "drawWithRect:options:" },
+    { 0xe2d66675c797e665ULL, "instancesRespondToSelector:" },
+    { 0xf5232bd5b42e4292ULL, "frameOfIncrementPage" },
+    { 0xeda8db75ed6a9f5eULL, "_bestFontForCharacter:userFont:" },
+    { 0x1412366f446c2742ULL, "drawable" },
+    { 0x8a76e2dea5b8f56fULL, "getPeriodicDelay:interval:" },
+    { 0x37cd975e3c369c8fULL, "HTTPMethod" },
+    { 0x1a09a4eaee799889ULL, "createUserDefaultsDirectoryIfNeeded" },
+    { 0x7bebdbc90f444eb3ULL, "locationForGlyphAtIndex:" },
+    { 0, NULL },
+    { 0x94e6e7024d221cb6ULL, "URLByDeletingLastPathComponent" },
+    { 0x13d17c76b20a67e5ULL, "revertToSavedFromURL:ofType:" },
+    { 0, NULL },
+    { 0xd5d2c93be213074fULL, "sendPort" },
+    { 0x579dd958cc362ed6ULL, "drawPath:" },
+    { 0, NULL },
+    { 0xaf21a548dfb8fbd1ULL, "columnWithIdentifier:" },
+    { 0, NULL },
+    { 0xcbf6e9522d764b40ULL, "getArgumentTypeAtIndex:" },
+    { 0xdd06b7acb78374a0ULL, "undoActionName" },
+    { 0x72437e74e688bad4ULL, "_startObservingSelectedObjects" },
+    { 0x8709cd4cfec7148cULL, "sendAction:to:from:" },
+    { 0xf92f98b967148fd4ULL, "removeAttributeForName:" },
+    { 0xb321f03e07afeedaULL, "performSelectorInBackground:withObject:" },
+    { 0x8ccfc8348dbe56b3ULL, "dividerIndexAtPoint:" },
+    { 0xdf4b67a276a70ff4ULL, "_runThreadedAnimation:" },
+    { 0xd7bb3a2cc9ca099aULL, "insertItemWithTitle:action:keyEquivalent:atIndex:" },
+    { 0xc4e22535cadca3acULL, "addAttributes:range:" },
+    { 0x63bfe4d002409697ULL, "_setMainWindow:" },
+    { 0xf0c28562926e9927ULL, "typesetter" },
+    { 0x5e1b358be94a1117ULL, "mainMenuBarColor" },
+    { 0xb9865a8be82af25eULL, "encodeInteger:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xad37f407b93bc21eULL, "handleMonitor" },
+    { 0x4cd206a9f4f1a6b7ULL, "netServiceBrowserDidStopSearch:" },
+    { 0x89fcf2a8dd065802ULL, "accessInstanceVariablesDirectly" },
+    { 0, NULL },
+    { 0x3dc058e6f6aeed4fULL, "horizontalRulerView" },
+    { 0xa5a3b3db76c85fe4ULL, "addSuiteNamed:" },
+    { 0x7b82076f5f94db03ULL, "colorWithCatalogName:colorName:color:" },
+    { 0xc0f9852b9f20c896ULL, "removeCharactersInString:" },
+    { 0, NULL },
+    { 0x5657e66b6eb22cd9ULL, "removeFontFromCache:" },
+    { 0xd852e754eb621f65ULL, "renderingMode" },
+    { 0, NULL },
+    { 0x7000f15912d26e58ULL, "magentaComponent" },
+    { 0x9f3ec747fac54ef3ULL, "imageDimsWhenDisabled" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xfb518eb0cb34d7beULL, "hostNameByAddress:" },
+    { 0xc3cc2c85ba705f06ULL, "tryLockWhenCondition:" },
+    { 0x7450082a4c35c0a1ULL, "splitView:shouldCollapseSubview:forDoubleClickOnDividerAtIndex:" },
+    { 0x5e5be0fe24188f2fULL, "callStackReturnAddresses" },
+    { 0x1cd2124089e3028fULL, "menuBackgroundColor" },
+    { 0x691706babf807b66ULL, "laterDate:" },
+    { 0xe5c4ee87be3a5dbbULL, "setImage:" },
+    { 0x791c8edf9925ad32ULL, "lineSpacing" },
+    { 0xc1298cdaf2d04cf5ULL, "applicationDidUpdate:" },
+    { 0, NULL },
+    { 0x2b03b59cbda8c612ULL, "drawHashMarksAndLabelsInRect:" },
+    { 0x158f3e5969a69132ULL, "colorWithName:" },
+    { 0, NULL },
+    { 0x41ad2c969d82b3cbULL, "delete:" },
+    { 0x5d247456e7f29cb7ULL, "setItemPrototype:" },
+    { 0x0073a25e631ed4bbULL, "widthAdjustLimit" },
+    { 0x6a1b38892db69337ULL, "finalize" },
+    { 0x9d003e7a5f3931daULL, "selectedCells" },
+    { 0xf90d1f9b47a08521ULL, "resizeLeftRightCursor" },
+    { 0xcf1039395c61d90aULL, "increaseLengthBy:" },
+    { 0xa915288fa9e97ba2ULL, "replyTimeout" },
+    { 0, NULL },
+    { 0xeea3052b7e22b998ULL, "paddingPosition" },
+    { 0xf262bd3556f1103eULL, "setTabStops:" },
+    { 0, NULL },
+    { 0x6bdedbcd681d0d91ULL, "typingAttributes" },
+    { 0xbc87e374bfb3befbULL, "drawMenuBarItemBorderInRect:hover:selected:" },
+    { 0x6979357d3368b831ULL, "spellServer:didForgetWord:inLanguage:" },
+    { 0x7448bbdecb5e64d8ULL, "rectOfColumn:" },
+    { 0x2cbd5bdb536b457cULL, "resolveClassMethod:" },
+    { 0x5f61c85572786872ULL, "_closure" },
+    { 0x8089d2bead830d9cULL, "setParagraphSpacingBefore:" },
+    { 0xf19e0d668d84785cULL, "parserDidStartDocument:" },
+    { 0x3b10d1932fe8c146ULL, "currentGuesses" },
+    { 0, NULL },
+    { 0xba586889619a9b49ULL, "drawHighlightedSelectionForColumn:row:inRect:" },
+    { 0xbebf71d43b2327d0ULL, "sslHandler" },
+    { 0x7704ed87520e973aULL, "tableView:mouseDownInHeaderOfTableColumn:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x47c8b6deda5184a3ULL, "windowBorderType" },
+    { 0x38e87735bda05815ULL, "unhide" },
+    { 0xecea6dc03b0f6bacULL, "saturation" },
+    { 0, NULL },
+    { 0x78b1d4e600d4901aULL, "setWidth:" },
+    { 0xc7621b1da73191baULL, "_configurationKey" },
+    { 0x962a48a6234bcd79ULL, "removeIndexes:" },
+    { 0x220dcf2e14ccc593ULL, "createFontInfo" },
+    { 0, NULL },
+    { 0xee85cf40c25153c7ULL, "fontWithDescriptor:size:" },
+    { 0x4ce7a0bc5cf8f523ULL, "canBeConvertedToEncoding:" },
+    { 0xa04d06b0087b1811ULL, "topLevelObjects" },
+    { 0xd8d87f50fbe13dd1ULL, "showsBaselineSeparator" },
+    { 0x6c9554d291c85507ULL, "userName" },
+    { 0x04665cc6e84758a4ULL, "source" },
+    { 0xbe245227ac44c7fbULL, "setLineFragmentRect:forGlyphRange:usedRect:" },
+    { 0xe3d46618bd98b307ULL, "allKeys" },
+    { 0, NULL },
+    { 0xbb0f15687add1592ULL, "sharedFontPanelExists" },
+    { 0x885a76db1886a1cbULL, "applicationWillBecomeActive:" },
+    { 0x1be51d9d1d707a98ULL, "unarchiveObjectWithData:" },
+    { 0x81cde6c28dd2bc1fULL, "isAutomaticTextReplacementEnabled" },
+    { 0x322c6ace944f2081ULL, "releaseGState" },
+    { 0, NULL },
+    { 0x05ebcea1138955a2ULL, "predicateWithLeftExpression:rightExpression:customSelector:" },
+    { 0x4c1617b250eaaa14ULL, "_showMenuViewIfNeeded" },
+    { 0x835a141b8c8cc111ULL, "_addLayerToSuperlayer" },
+    { 0, NULL },
+    { 0x56bf96131b971a67ULL, "drawAtPoint:withAttributes:" },
+    { 0xbb9afaf42704c93bULL, "clearChangeDictionary" },
+    { 0x851e06b01dc04c7dULL, "descender" },
+    { 0x561dfb3eb5e8c022ULL, "scrollsDynamically" },
+    { 0xbc2eb45ccf29dc15ULL, "setDay:" },
+    { 0x018679f1f890b795ULL, "setFloatValue:" },
+    { 0xe9c075dd7c7246abULL, "tabViewItemAtPoint:" },
+    { 0xb09fcef27860e759ULL, "compositeToPoint:fromRect:operation:" },
+    { 0x5ed5510c8ca9b735ULL, "setFill" },
+    { 0xa7752d8ed195eb8fULL, "continueTrackingLinearSliderAtPoint:at:inView:" },
+    { 0x9da0b644e8aa1270ULL, "colorSpaceName" },
+    { 0x5f06f4380d1870beULL, "alignJustified:" },
+    { 0x2df53fd35b4ecadbULL, "_appendWordFour:" },
+    { 0xb0ba0ce17bd646a7ULL, "encodeReal:" },
+    { 0xc4dff039b87d9394ULL, "crosshairCursor" },
+    { 0x332e7d4df9fbd412ULL, "_checkForTerminate" },
+    { 0x677c27f9b9b48348ULL, "setStandardOutput:" },
+    { 0x4ae1d3927d6ae233ULL, "numberWithChar:" },
+    { 0xb7e7f37d2dd8de1cULL, "selectItemWithObjectValue:" },
+    { 0x061ff1e6c3659a7fULL, "resizeWithOldSuperviewSize:" },
+    { 0x97b18cc10bb81a5fULL, "sheetOrderOutToFrame:" },
+    { 0, NULL },
+    { 0xf1d391cd434e77d1ULL, "minimum" },
+    { 0x884de5a5d6d68880ULL, "elementAtIndex:associatedPoints:" },
+    { 0x644ea85fb7e58bc3ULL, "setKeyEquivalent:" },
+    { 0x70d729d158ff679fULL, "encodeIndent:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x29d6e5c3e7be056fULL, "timeZoneTransitionWithTransitionDate:typeIndex:" },
+    { 0x73f333c74185a988ULL, "toggleAutomaticSpellingCorrection:" },
+    { 0x11cc88d37a10c939ULL, "bundleWithModulePath:" },
+    { 0x131046707ff7e9c5ULL, "connection:didFailWithError:" },
+    { 0xb3821eaa34949476ULL, "drawMenuCheckmarkInRect:enabled:selected:" },
+    { 0x8f09fd0e1c5aff96ULL, "setIndex:" },
+    { 0x58f79f780ac4bc31ULL, "pointsPerUnit" },
+    { 0x81800e8e6752c60bULL, "automaticallyIdentifiesLanguages" },
+    { 0x0d6459488822aa0fULL, "setSharedObject:forClassName:" },
+    { 0, NULL },
+    { 0x80ece93fbef7f825ULL, "saveToFile:saveOperation:delegate:didSaveSelector:contextInfo:" },
+    { 0x8dd56590febdebabULL, "nullTerminatedASCIIDataWithPropertyList:" },
+    { 0xe533cbcd96037474ULL, "continuouslyUpdatesValue" },
+    { 0x9aaa22a049f230c7ULL, "drawMenuWindowBackgroundInRect:" },
+    { 0x98455bdc6a066ddeULL, "grammarDetails" },
+    { 0x1c6990e6cf17daa3ULL, "performSelector:withObject:afterDelay:" },
+    { 0, NULL },
+    { 0xbbd936a64bac36a9ULL, "lineFragmentPadding" },
+    { 0xff29249b876c8c7cULL, "EPSRepresentation" },
+    { 0x84f06487ccff6073ULL, "setUsesDataSource:" },
+    { 0xacb05dd967f795eaULL, "transformPoint:" },
+    { 0xe7b49ceca61a8c4eULL, "separatesColumns" },
+    { 0xc982135e1f9200ebULL, "minContentSize" },
+    { 0xe86d9eead0d3fe46ULL, "defaultLineJoinStyle" },
+    { 0x67294498d6d321d8ULL, "characterCollection" },
+    { 0x5a105b468566e502ULL, "invalidatedRange" },
+    { 0x3bd2976da56f3848ULL, "isEditable" },
+    { 0, NULL },
+    { 0x59ba5bae31725712ULL, "attributes" },
+    { 0xdac61db83db5fff3ULL, "numberOfPoofImages" },
+    { 0x87f45d1886bbb3afULL, "_detachDrawer:" },
+    { 0x927b5e7f6e95cb7cULL, "setWindow:forID:" },
+    { 0x3b93266ef4c47d83ULL, "setFrameRotation:" },
+    { 0, NULL },
+    { 0x4f03bedafde4abd9ULL, "updatePanels" },
+    { 0xf66d14675f32a455ULL, "alloc" },
+    { 0xf9cb1c316764ea36ULL, "drawerWindow:constrainSize:edge:" },
+    { 0, NULL },
+    { 0x0993bf0c146c6b45ULL, "dominantScript" },
+    { 0, NULL },
+    { 0x6bc67304b4b03592ULL, "stepUpCycle" },
+    { 0xd996e185262177ddULL, "setPreviousText:" },
+    { 0x611cf10834c18abbULL, "setOffscreen:width:height:rowbytes:" },
+    { 0xe84b124f6dffd2ebULL, "hourOfDay" },
+    { 0x11280e397710a31dULL, "restoreCachedImage" },
+    { 0xe89fb210c307a27dULL, "valueForKey:" },
+    { 0x8dd217601c1c8e35ULL, "setHour:" },
+    { 0x8c83bb222fa25e0eULL, "attributedStringForObjectValue10_4:withDefaultAttributes:" },
+    { 0, NULL },
+    { 0x32f0e07240f24f5dULL, "showContextHelpForObject:locationHint:" },
+    { 0x0f7b76942efada45ULL, "toolbarSelectableItemIdentifiers:" },
+    { 0x5e0017a682055640ULL, "pause" },
+    { 0xa407b9aac663cd76ULL, "set" },
+    { 0xd831fe03aa4e247cULL, "drawString:withAttributes:inRect:" },
+    { 0x06ffeabaead8d033ULL, "poof:" },
+    { 0, NULL },
+    { 0x809b18cd4d6445a1ULL, "_cellForSegment:" },
+    { 0xf6794b71f36a0f57ULL, "KVO_notifying_change_removeObjectFromKeyAtIndex:" },
+    { 0x21fcb3a9972e3658ULL, "colorWithCalibratedWhite:alpha:" },
+    { 0x998ea9ff0b36113eULL, "boundsRectForBlock:contentRect:inRect:textContainer:characterRange:" },
+    { 0x024e47a65a789a44ULL, "_postNoteWillResize" },
+    { 0, NULL },
+    { 0x48660ae4cbe7d066ULL, "setDestination:allowOverwrite:" },
+    { 0xebcd5e393b0da760ULL, "drawScrollerTrackInRect:vertical:upOrLeft:" },
+    { 0x681b0dc70edc7a98ULL, "executableArchitectures" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb545369f976234b8ULL, "charactersIgnoringModifiers" },
+    { 0x9e1c46129a644d84ULL, "initWithRulerView:markerLocation:image:imageOrigin:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x880d4a78e6ba758bULL, "drawItemAtIndex:" },
+    { 0xdd057451decc6033ULL, "registerClassDescription:forClass:" },
+    { 0xee6e2c982220cd9fULL, "drawInRect:" },
+    { 0x0c363e27c36f3380ULL, "dateFromString:" },
+    { 0x6a1e4efb0a9f4e57ULL, "_reloadColumn:preserveSelection:" },
+    { 0xbec366c9c35645ccULL, "_setItemsWithIdentifiersFromArray:" },
+    { 0xc2199e9d7fb02650ULL, "deviceRGBColorSpace" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdbf9923946904e79ULL, "characterIdentifier" },
+    { 0, NULL },
+    { 0x94d2ad5a612e7d96ULL, "setDepthLimit:" },
+    { 0xc10ecdb78e49c3efULL, "prepareSavePanel:" },
+    { 0xe149ff3a5ceb5150ULL, "readDataToEndOfFile" },
+    { 0x38014948cd8bdafcULL, "application:openTempFile:" },
+    { 0xa5b13acaf797ab73ULL, "currentDiskUsage" },
+    { 0x574e1187659ac869ULL, "startTrackingCircularSliderAt:inView:" },
+    { 0x25eaff6581e1d147ULL, "arrayFromElement:" },
+    { 0x1089deb99b23e6b9ULL, "setState:" },
+    { 0x6a3683c5fbdf93e5ULL, "cellFrameAtRow:column:" },
+    { 0, NULL },
+    { 0x11c916c67181b221ULL, "appendBezierPathWithPoints:count:" },
+    { 0, NULL },
+    { 0x372b2a6392b12752ULL, "documentCursor" },
+    { 0x442079532e04ed21ULL, "tableViewSelectionIsChanging:" },
+    { 0x22e99d1f465e6381ULL, "systemTimeZone" },
+    { 0, NULL },
+    { 0x5ac308907297b05aULL, "setContentBorderThickness:forEdge:" },
+    { 0x6181ca6ec094c326ULL, "capHeight" },
+    { 0x985cc5a20cac7d7aULL, "requestHeaderFieldsWithCookies:" },
+    { 0x867cc68e738492edULL, "_setContentObjects:" },
+    { 0x0f877b2cc8184f3dULL, "setPositiveSuffix:" },
+    { 0x84ba2efaae0152f5ULL, "defaultParagraphStyle" },
+    { 0x01c9f15e2730146fULL, "selectedMenuItemTextColor" },
+    { 0x87b4adf024e70865ULL, "visibleFrame" },
+    { 0, NULL },
+    { 0x557c412723927edcULL, "advancementForNominalGlyphs:count:" },
+    { 0, NULL },
+    { 0xf3ce567855b1185cULL, "setAutomaticallyRearrangesObjects:" },
+    { 0xa7f36286590ec39dULL, "allImages" },
+    { 0xf5495f76fb27741bULL, "hideOtherApplications:" },
+    { 0, NULL },
+    { 0x89e0228db79a01c3ULL, "_tightenUpColumn:" },
+    { 0, NULL },
+    { 0xf93b8576701e8bf3ULL, "setCanDrawConcurrently:" },
+    { 0xefdf90d64c96deb3ULL, "modifierFlags" },
+    { 0xa75d8fa87b1a0924ULL, "createWindowHandle" },
+    { 0x507189fbb22ea688ULL, "_configureMenu:forFont:" },
+    { 0, NULL },
+    { 0x57803e18e75858b3ULL, "edge" },
+    { 0, NULL },
+    { 0x76d963af568fe5a0ULL, "dataFromPropertyList:format:errorDescription:" },
+    { 0xe70932d2d25b20deULL, "contextHelpForObject:" },
+    { 0x7eeffcd4372e7aceULL, "incrementStepperUnderPoint:inView:" },
+    { 0x9d3baf50642c285cULL, "dependantKeyObservers" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x56044c22668c3253ULL, "draggedColumn" },
+    { 0xf2a98edb8094d4d1ULL, "_undoManagerDidUndoChange:" },
+    { 0xf8ca7f9233233900ULL, "mutableArrayValueForKey:" },
+    { 0x19450f0b7513622eULL, "registerPort:name:nameServerPortNumber:" },
+    { 0xa8d6ee23c0a3326eULL, "canInitWithPasteboard:" },
+    { 0xfca1734d3550230aULL, "_mouseDownRadio:" },
+    { 0xf3bdfe33a2ca2fe9ULL, "parser:foundExternalEntityDeclarationWithName:publicID:systemID:" },
+    { 0x023002ca26e9e51cULL, "dataSourceCanSetObjectValue" },
+    { 0x28665ce7fd91b1a1ULL, "setImageFrameStyle:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd570c7afa8b54d87ULL, "WM_SYSCOLORCHANGE_wParam:lParam:" },
+    { 0x2f3ae0a8f78804deULL, "currencyCode" },
+    { 0x229eb8cb10d08f7bULL, "becomesKeyOnlyIfNeeded" },
+    { 0x0d3b4ec4c16941e0ULL, "allFontFamilyNames" },
+    { 0xb957fdd4264c5760ULL, "setName:" },
+    { 0x6be499374e49ac17ULL, "setIndependentConversationQueueing:" },
+    { 0xc6f936f92943926cULL, "measurementUnitWithName:abbreviation:pointsPerUnit:stepUpCycle:stepDownCycle:" },
+    { 0xbb84ad019428943aULL, "connection:didReceiveData:" },
+    { 0x7ee12655d7139885ULL, "contentView" },
+    { 0xd4730faf7bcd4942ULL, "removeObjectAtIndex:" },
+    { 0x06241c92cc81a0b4ULL, "dataWithPDFInsideRect:" },
+    { 0x1023503060aeb38eULL, "makeWindowControllers" },
+    { 0, NULL },
+    { 0xc76712b080c72632ULL, "setPixelFormat:" },
+    { 0xe8455838c13b8898ULL, "_unhideCursorForMouseMove" },
+    { 0xfb42cd12a5da652fULL, "startTrackingAt:inView:" },
+    { 0, NULL },
+    { 0x9fe7743f3bf7d951ULL, "setBorderColor:" },
+    { 0x895ec8cadcbfdaefULL, "sharedApplication" },
+    { 0xf5ea92293c9cbbbfULL, "saveDocument:" },
+    { 0xb5a9986acca185a2ULL, "_invalidateNetService" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0397987905031e64ULL, "menuHeight" },
+    { 0x4a4fdf42dad036abULL, "scanLocation" },
+    { 0x8cd04f444e68851cULL, "createFileAtPath:contents:attributes:" },
+    { 0xa87271ed2d7b8a42ULL, "resizeLeftCursor" },
+    { 0x4b6f173dcb4db54fULL, "setRulerVisible:" },
+    { 0xcc73f0da1aec4534ULL, "tabView:shouldSelectTabViewItem:" },
+    { 0, NULL },
+    { 0x9c7f9c9e806fa44aULL, "setTextureImageToPixelBuffer:colorBuffer:" },
+    { 0xb6ffaff999e726b0ULL, "setReturnValue:" },
+    { 0xcadbf6eeef6ec0e7ULL, "incrementalLoadFromData:complete:" },
+    { 0x8b6fd31a5a4d686fULL, "setViewAnimations:" },
+    { 0x35671a7ba26ad041ULL, "addSelectedObjects:" },
+    { 0, NULL },
+    { 0xe5a0568ecd35e4b1ULL, "alphaComponent" },
+    { 0x8005f4ee62dc6b92ULL, "_buildResourceSpecifier" },
+    { 0x19a176d23e1bee87ULL, "URLProtocolDidFinishLoading:" },
+    { 0xb076d3486ef03bd6ULL, "_reopen" },
+    { 0xc64f8dad737c7744ULL, "isEqualToSet:" },
+    { 0xdb07f0b17f602a87ULL, "nextEventMatchingMask:" },
+    { 0xe6eb38a2873a0196ULL, "addWindowController:" },
+    { 0x2d13fef2a6ddebabULL, "removeSelectionIndexPaths:" },
+    { 0xbf07b479f35a6ebeULL, "setBinding:" },
+    { 0x93fb0ab0500b2969ULL, "startingColumn" },
+    { 0x19c0c5d91044ea14ULL, "setDefaultSetView:" },
+    { 0, NULL },
+    { 0x602e31d8ab22ec8bULL, "setCurrencyGroupingSeparator:" },
+    { 0x506ec1af9f4ce789ULL, "_udpdateSelectedFont" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4e407c4d1a756a54ULL, "setHiddenUntilMouseMoves:" },
+    { 0xe8ccf3473ee6d83aULL, "compare:options:range:" },
+    { 0x6afd8c8e4383fae1ULL, "modifierFlagsForState:" },
+    { 0x19236cc64fc5ca1fULL, "WM_ACTIVATE_wParam:lParam:" },
+    { 0xad96afec07fe3823ULL, "menuItemBranchArrowSize" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdb5d70b38dc67604ULL, "setBounds:" },
+    { 0xa642943b67fe3db2ULL, "loadFileWrapperRepresentation:ofType:" },
+    { 0, NULL },
+    { 0xc245140d765709ddULL, "sendActionOn:" },
+    { 0x74f078d435d0d12eULL, "setLineScroll:" },
+    { 0, NULL },
+    { 0xb322515d55d86d9bULL, "contentRect" },
+    { 0xdf37b894014ebd32ULL, "initImageCell:" },
+    { 0xfc949ab18a5ca282ULL, "setFloatingPanel:" },
+    { 0x36f62500ef35e51dULL, "imageRectInRuler" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2657eabcadf5b354ULL, "minTitleKeyEquivalentWidth" },
+    { 0xf37ede7ac6a8b043ULL, "validateValue:forKeyPath:error:" },
+    { 0, NULL },
+    { 0xe60e081600af5cf5ULL, "setMeasurementUnits:" },
+    { 0xec8b14b5bd8a7e9fULL, "_drawingOrigin" },
+    { 0x3c59b8438bf73bebULL, "setPrefersColorMatch:" },
+    { 0x992a3716729d2f01ULL, "buildFontFamilies" },
+    { 0x77f7a9d87cf3c223ULL, "encodePoint:forKey:" },
+    { 0x2560a128d5ce54bcULL, "setBorderColor:forEdge:" },
+    { 0, NULL },
+    { 0x97b71871e9822580ULL, "_paragraphStyleAfterGlyphIndex:" },
+    { 0xec6dac29e6b0d303ULL, "borderRectFromTitleRect:" },
+    { 0xc908232e4088d0c5ULL, "comboBoxSelectionDidChange:" },
+    { 0x431e79d1a1dcfa5bULL, "columnSpan" },
+    { 0x837aba2e6aae0aadULL, "userQuotesArrayForLanguage:" },
+    { 0x4edd7d87ec0e2951ULL, "_buildTimer" },
+    { 0x2e0f371f146a9cdcULL, "isEqualToData:" },
+    { 0x51922f33b05478dfULL, "addKeyObserver:" },
+    { 0xa8a5c9b23c1d50bcULL, "performClose:" },
+    { 0, NULL },
+    { 0x6a5d9637ac189395ULL, "rootProxy" },
+    { 0xde57af7c84a33195ULL, "platformWindowExitMove:" },
+    { 0, NULL },
+    { 0xc578cbb21c5baba4ULL, "netService:didUpdateTXTRecordData:" },
+    { 0xbc499ba0460f8aafULL, "addTypeface:" },
+    { 0x6bec3acb47c1d2a9ULL, "splitView:shouldHideDividerAtIndex:" },
+    { 0, NULL },
+    { 0x8ad405212182235fULL, "textStorageDidProcessEditing:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf974f8649e90654bULL, "orderFrontCharacterPalette:" },
+    { 0x3a4fca535521ed35ULL, "setInContext:" },
+    { 0x03d8675261db1a67ULL, "_GetWindowRectDidSize:" },
+    { 0x30d49eb1ebab35afULL, "classDescriptionForClass:" },
+    { 0xb66227b78d86969dULL, "windowWillUseStandardFrame:defaultFrame:" },
+    { 0xcc84202360390d26ULL, "gradientType" },
+    { 0xd33bc9f3cd1b50caULL, "setWeekdayOrdinal:" },
+    { 0, NULL },
+    { 0xcd6558c987512457ULL, "lineScroll" },
+    { 0xd911383595eb702fULL, "setShowsProgressPanel:" },
+    { 0, NULL },
+    { 0xb8ff9885f2e77673ULL, "XMLDataWithOptions:" },
+    { 0x718ae1926ce50c56ULL, "transformFromWindow" },
+    { 0x36e6ce4d6a66b058ULL, "setWeekday:" },
+    { 0x8cf8c7a31c6669d7ULL, "setToolTip:forCell:" },
+    { 0x6b2f3a708db9d075ULL, "valueWraps" },
+    { 0xd45eeb1e4548e8b3ULL, "_willSearch" },
+    { 0, NULL },
+    { 0xc901ce345174083bULL, "encodeArrayOfObjCType:count:at:" },
+    { 0x020946eb10fb4ef1ULL, "verticalPageScroll" },
+    { 0x12082a85b8cc68e3ULL, "DTDKind" },
+    { 0xb5fef0da0debf281ULL, "lockFocusOnRepresentation:" },
+    { 0x0f33251f188cfe76ULL, "postAwakeFromNib" },
+    { 0xdeab66d2fb21911bULL, "setStringValue:resolvingEntities:" },
+    { 0, NULL },
+    { 0xfc791e4c3dbbe852ULL, "setDuration:" },
+    { 0x4e7889115997fc25ULL, "_setFieldEditorUndoManager:" },
+    { 0x8bc7298561174235ULL, "avoidsEmptySelection" },
+    { 0x997e4fda1825d535ULL, "tryLock" },
+    { 0x0c47b83a2ca42496ULL, "appendTransform:" },
+    { 0, NULL },
+    { 0x7ee3a0f818e8b753ULL, "addObserver:object:" },
+    { 0x6d5359092178a38bULL, "setSegmentStyle:" },
+    { 0xa26fd21968c231d0ULL, "setMinimumSignificantDigits:" },
+    { 0xbe25779ef7be53ddULL, "recoveryAttempter" },
+    { 0x6d27576967d5fee5ULL, "numberWithLongLong:" },
+    { 0, NULL },
+    { 0xd0f49c3c696ca1b3ULL, "setBackgroundColor:" },
+    { 0x2582673d5d5e9984ULL, "addObserver:selector:" },
+    { 0x969f2cace45e4474ULL, "disableKeyEquivalentForDefaultButtonCell" },
+    { 0x8682635f4d9a97c1ULL, "conditionLockClass" },
+    { 0, NULL },
+    { 0x721652fad31eb9d3ULL, "defaultWindingRule" },
+    { 0x6d151dcc45655e69ULL, "setGroupingSize:" },
+    { 0x847430679fa98a1aULL, "platformWindowMiniaturized:" },
+    { 0x5ff6ee99e164b4b3ULL, "keyObserversForKey:" },
+    { 0, NULL },
+    { 0xf74f0bb0b7b92cfcULL, "alignRight:" },
+    { 0xacd9f5c2356812bfULL, "timeZoneForSecondsFromGMT:" },
+    { 0xe114777bf6f6fcadULL, "readPlaintext:maxLength:" },
+    { 0x751818a92a248f01ULL, "transitionDate" },
+    { 0x7b87a3e2b996eea9ULL, "availableData" },
+    { 0x477083f702b7a147ULL, "removeFontTrait:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0bea9968f339288cULL, "save:" },
+    { 0x96d5410e461c7001ULL, "intersectsSet:" },
+    { 0xc8e3aee6f4d401ebULL, "setSubmenu:" },
+    { 0xf34a3a08dc6d5388ULL, "_setMenu:" },
+    { 0, NULL },
+    { 0x67d9ed100dfcda80ULL, "buildSizeMatrix" },
+    { 0x3b3fe00f5f00d76bULL, "resetCancelButtonCell" },
+    { 0xcaefe8e48b147871ULL, "colorUsingColorSpaceName:device:" },
+    { 0, NULL },
+    { 0x9c31cc46bd534931ULL, "updateFromPrintInfo" },
+    { 0x543fb4a122a19440ULL, "setProtocolSpecificInformation:" },
+    { 0x01661da5f9526657ULL, "relativeLineToPoint:" },
+    { 0x4e1e04d08f44009fULL, "expressionForEvaluatedObject" },
+    { 0x1a8a455cf67412a4ULL, "sizeToFit" },
+    { 0x0492df44a9cca460ULL, "selectRowIndexes:byExtendingSelection:" },
+    { 0x1c90ddf250a44cebULL, "sheetContextWithSheet:modalDelegate:didEndSelector:contextInfo:frame:" },
+    { 0x560f76979f1937f4ULL, "publishWithOptions:" },
+    { 0x18c46cae7d9367b4ULL, "replaceOccurrencesOfString:withString:options:range:" },
+    { 0xb75bc00e5d8ba715ULL, "setProcessName:" },
+    { 0xacc164f4a1d61be3ULL, "setSelected:forSegment:" },
+    { 0x3477f5381123c035ULL, "WM_SIZE_wParam:lParam:" },
+    { 0, NULL },
+    { 0xec3e831aa8019653ULL, "applicationDidHide:" },
+    { 0x0c8df81b485f9813ULL, "menuItemBranchArrowMargins" },
+    { 0xb033250d080ae3c0ULL, "setRoundingMode:" },
+    { 0x313e3e2e6f7d210aULL, "checkForRemovableMedia" },
+    { 0x392ee0dfd9e62f9aULL, "addRepresentations:" },
+    { 0x20dc51a540945510ULL, "dateFromComponents:" },
+    { 0x0ef9a8738b3919ffULL, "frameSizeForContentSize:hasHorizontalScroller:hasVerticalScroller:borderType:" },
+    { 0x5c6c7997848f2061ULL, "decimalNumberByRaisingToPower:" },
+    { 0xef5b15da60df6460ULL, "selectedRow" },
+    { 0x9e6028142007ddbaULL, "outlineViewColumnDidMove:" },
+    { 0, NULL },
+    { 0x6b6b66b7761c607aULL, "boxType" },
+    { 0x26628fade5d6654eULL, "defaultQueue" },
+    { 0, NULL },
+    { 0xbd311fb4b0e2c550ULL, "_didUpdateTXTRecordData:" },
+    { 0x6a95873bf043e4fcULL, "EPSOperationWithView:insideRect:toData:" },
+    { 0, NULL },
+    { 0xd9457ed352948099ULL, "_windowWillBecomeDeactive:" },
+    { 0x3df50349466264bcULL, "tableView:writeRowsWithIndexes:toPasteboard:" },
+    { 0xcc713726ac5d843aULL, "arrangedObjects" },
+    { 0x69a2abf116e83754ULL, "deleteToEndOfLine:" },
+    { 0x90209cad0bc7a949ULL, "screenFont" },
+    { 0, NULL },
+    { 0xb2b025992682a875ULL, "pageHeader" },
+    { 0xca78292c096cbba2ULL, "_canConvertFont:toHaveTrait:" },
+    { 0xe4ae845fc7740dd7ULL, "pasteboardWithName:" },
+    { 0xf54c4b31d8de432aULL, "observationInfo" },
+    { 0x1ac335c1d3ec2e11ULL, "pageUpAndModifySelection:" },
+    { 0x53a7817f9942cdf3ULL, "setDrawsOutsideLineFragment:forGlyphAtIndex:" },
+    { 0x23dfb291890de952ULL, "reopenDocumentForURL:withContentsOfURL:error:" },
+    { 0xd2a3d8c09311143dULL, "frameRectForContentRect:styleMask:" },
+    { 0x09ca4d15b80e12f5ULL, "sharingType" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe076b8e2bfc160f4ULL, "_showContextMenu" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x14dd877200aff2e8ULL, "domain" },
+    { 0x4c7bce63c9988598ULL, "_didRemoveDomain:moreComing:" },
+    { 0, NULL },
+    { 0x2078d5b816e0ca20ULL, "convertPOINTLToBase:" },
+    { 0x66c7ef2509cd3961ULL, "makeMainWindow" },
+    { 0xbb215e096007abafULL, "registerServicesMenuSendTypes:returnTypes:" },
+    { 0, NULL },
+    { 0xfdd20dd2c7407431ULL, "mapContentsOfFile:length:" },
+    { 0xddfd98c6eb5df026ULL, "samplesPerPixel" },
+    { 0x17103358e56a9758ULL, "setAttachmentSize:forGlyphRange:" },
+    { 0x6f36d14a3f5a1267ULL, "decodePoint" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xed944d91ab9244dcULL, "setNextResponder:" },
+    { 0x9497629173de784dULL, "orderFront:" },
+    { 0, NULL },
+    { 0x9cd8ba08e7741b0bULL, "writeEncrypted:maxLength:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0318b0f70105312fULL, "isEqualToString:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x946a6d617922194cULL, "selectedTag" },
+    { 0xf02a52045660e7a0ULL, "_removeTrackingRect:" },
+    { 0x9645b5ade74eeb27ULL, "setDrawsCellBackground:" },
+    { 0xef4af995d0be44d6ULL, "hasVerticalRuler" },
+    { 0x3d9664394ef2f04fULL, "_trackingArea" },
+    { 0x3ef57ad5e9d8a476ULL, "_cacheIndexOfFontWithName:size:" },
+    { 0x023f431e89b718a1ULL, "start" },
+    { 0x36cfd868cb439c09ULL, "didStartElement" },
+    { 0xa85b24a6d33a44c9ULL, "sizeMode" },
+    { 0x1583a4dfbf183688ULL, "usesSignificantDigits" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x62dbb7e414d35a13ULL, "PDFOperationWithView:insideRect:toData:printInfo:" },
+    { 0x9ac43df752ae4206ULL, "setAutoresizesSubviews:" },
+    { 0, NULL },
+    { 0xbf38eedb3207cea2ULL, "startLoading" },
+    { 0xe12f3e791bea862cULL, "controlPointBounds" },
+    { 0x44986c201ef5b934ULL, "changeDictionaryWithInfo:" },
+    { 0xf9293871499f986bULL, "platformWindowDeminiaturized:" },
+    { 0x7d5fc9f55c90f7faULL, "enableMultipleThreads" },
+    { 0x9d2e6060c86e9af4ULL, "setShadowColor:" },
+    { 0x17c0eab3c8c5fbefULL, "relativeString" },
+    { 0xd0e30946c8c16920ULL, "tagForSegment:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x490756630088ba05ULL, "revert" },
+    { 0x6d894d0f82473997ULL, "KVO_notifying_change_insertKey:atIndexes:" },
+    { 0x70e7e3ab161b6676ULL, "persistantDomainClass" },
+    { 0x52e51cecf7c96a69ULL, "setWindowController:" },
+    { 0xf53ef331634a0179ULL, "_bestFontForCharacter:userFont:usingFontNames:" },
+    { 0xa7d38877c7ac2e3eULL, "insertObject:atArrangedObjectIndexPath:" },
+    { 0xcb15429c73d2d7cfULL, "setColor:atX:y:" },
+    { 0xd3cc90ebeef9b672ULL, "setAllowsColumnResizing:" },
+    { 0x0ac80a839f8f6851ULL, "dequeueNotificationsMatching:coalesceMask:" },
+    { 0x5c27eb74dc47e33bULL, "addOperation:" },
+    { 0x7d394dc7137b2fa3ULL, "insetBounds" },
+    { 0, NULL },
+    { 0x9dd7cf94d10e0043ULL, "dataWithEPSInsideRect:" },
+    { 0, NULL },
+    { 0x20ccee85108cf30eULL, "_setSelectedTag:" },
+    { 0x542fc55b52bf2991ULL, "spellServer:findMisspelledWordInString:language:wordCount:countOnly:" },
+    { 0xc27ad343420ca403ULL, "view" },
+    { 0x987d9a4026d2d9d5ULL, "getObjectValue:forString:errorDescription:" },
+    { 0x0f9435a5f5ef6015ULL, "download:didReceiveDataOfLength:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x354859b440852279ULL, "hue" },
+    { 0xf137f1e951a70d95ULL, "copyItemAtPath:toPath:error:" },
+    { 0, NULL },
+    { 0xfbd44df9c6c2498eULL, "relativeCurveToPoint:controlPoint1:controlPoint2:" },
+    { 0, NULL },
+    { 0x50076e2e18cac76dULL, "pasteboard:provideDataForType:" },
+    { 0, NULL },
+    { 0x53a004f9a760fc8bULL, "isResizable" },
+    { 0x85adb1ac93668d80ULL, "setBidiLevels:forGlyphRange:" },
+    { 0xb1c35de51e37a95aULL, "messageText" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x76efad95f5d315e3ULL, "imageRepsWithContentsOfFile:" },
+    { 0, NULL },
+    { 0xd64d568ec87f2ef1ULL, "internationalCurrencySymbol" },
+    { 0xda7644bab3cad016ULL, "_showForActivation" },
+    { 0xa25b8430e0fb2710ULL, "setValueTransformer:forName:" },
+    { 0xba395f69c88d10baULL, "defaults" },
+    { 0xb1438da5a8c809bfULL, "_resolveAddressesIfNeeded" },
+    { 0x1a3431a932f2bcf5ULL, "colorSpace" },
+    { 0, NULL },
+    { 0xa76d41052f20155bULL, "unregisterClass:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8c8fab355c63fee7ULL, "setIncrement:" },
+    { 0, NULL },
+    { 0xb2686e62303f5467ULL, "titleWidth:" },
+    { 0x5d4f1daa58b1b3dcULL, "cairo_font_face" },
+    { 0x3d0bd6febdad6b2bULL, "alpha" },
+    { 0xc55befc4e75e1351ULL, "loadPrivateFonts" },
+    { 0x2151ba6b9ff4bd7aULL, "decrementServerCount" },
+    { 0, NULL },
+    { 0x57aec10ed5f16723ULL, "setNeedsDisplayInRect:" },
+    { 0x904516c2eabd442cULL, "localizations" },
+    { 0, NULL },
+    { 0xbc189a78d7e038cfULL, "glyphWithName:" },
+    { 0xeae6ece4b70ffb93ULL, "setMode:" },
+    { 0, NULL },
+    { 0x2f3bb60bee368d3eULL, "convertSizeFromBase:" },
+    { 0, NULL },
+    { 0xb37684fbec0e36f3ULL, "drawInRect:relativeCenterPosition:" },
+    { 0x5e099a96ec6b0156ULL, "isSuspended" },
+    { 0x6e975a2e7a5a56c0ULL, "setBaseWritingDirection:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4a6ea8b078bbfdb1ULL, "contentsOfDirectoryAtPath:error:" },
+    { 0x3cb94ad1238fa37cULL, "platformWindowStyleChanged:" },
+    { 0x96f2e105bfbfcf7bULL, "addObserver:selector:name:object:" },
+    { 0x6937e7d2157efe66ULL, "prepareForDragOperation:" },
+    { 0x60f5252dffa4b3eeULL, "setHorizontalScroller:" },
+    { 0, NULL },
+    { 0x99592198625d035cULL, "mainRunLoop" },
+    { 0xbbd66975015d264dULL, "_periodicEvent:" },
+    { 0x8afe27c2c2a5edf5ULL, "doubleClickInterval" },
+    { 0x0b6c5452e81d85fcULL, "setFile:" },
+    { 0x7ee08520612930acULL, "indexOfObjectIdenticalTo:" },
+    { 0x087f80390f8a6d14ULL, "concludeDragOperation:" },
+    { 0xed9251432f442505ULL, "previousFailureCount" },
+    { 0xc8796d1046cee60fULL, "components" },
+    { 0x164c80997548ad8dULL, "_appendCStringBytes:" },
+    { 0x6e226270a292bdcfULL, "frameLength" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1391653c93e668d8ULL, "saveToURL:ofType:forSaveOperation:error:" },
+    { 0xc0ceda5cae62b6c3ULL, "browserDidScroll:" },
+    { 0x90ba97ae91057fc1ULL, "sizeForContents" },
+    { 0xe649c11bd8f1ff33ULL, "displayRectIgnoringOpacity:" },
+    { 0, NULL },
+    { 0x72d635ffdb3ca343ULL, "invalidHeader" },
+    { 0x7d2a6a135495c69dULL, "timeZoneWithAbbreviation:" },
+    { 0x12969824f82dda4eULL, "runModalSavePanelForSaveOperation:delegate:didSaveSelector:contextInfo:" },
+    { 0x554dbade272231e9ULL, "graphicsContextWithGraphicsPort:flipped:" },
+    { 0x8efa8721d34142d8ULL, "query" },
+    { 0xd5d956ccd13be872ULL, "marginsOfPartId:stateId:uxthClassId:margins:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x158632f57bae9216ULL, "controlDarkShadowColor" },
+    { 0x017a8c27185a39e5ULL, "addSubview:" },
+    { 0x57902157e78e1b1fULL, "insertNewlineIgnoringFieldEditor:" },
+    { 0x3aa2d8cb0f56f82fULL, "setType:" },
+    { 0x2e77e65245e7dc67ULL, "_stringFromNumber:" },
+    { 0x70846e2bccede10cULL, "setDescriptor:" },
+    { 0xe58b31f41256787bULL, "firstTextView" },
+    { 0xe2d667c562e5e156ULL, "setInitialFirstResponder:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x523d377f44b24603ULL, "document" },
+    { 0x3beaa473d20b7d0aULL, "orangeColor" },
+    { 0x71cd3458ae0ed11aULL, "createSymbolicLinkAtPath:withDestinationPath:error:" },
+    { 0x97160a6fb077df26ULL, "parser:foundNotationDeclarationWithName:publicID:systemID:" },
+    { 0x9a18560cf4a001f5ULL, "bottomMargin" },
+    { 0xf7c3dd29de4f71dfULL, "_setSheetContext:" },
+    { 0, NULL },
+    { 0x3232d820471318d1ULL, "bitmapImageRepForCachingDisplayInRect:" },
+    { 0xce001be12428deefULL, "_refresh" },
+    { 0x8938bddd513707bdULL, "initRegularFileWithContents:" },
+    { 0x9d49fd3dc31ee20cULL, "arrowPosition" },
+    { 0x3592d81316f1b360ULL, "insertString:atIndex:" },
+    { 0, NULL },
+    { 0xa406b2dac557220eULL, "graphicsContext" },
+    { 0xfaa1cfff8061a31cULL, "searchForBrowsableDomains" },
+    { 0xd596fd3d20d05f98ULL, "replaceCharactersInRange:withAttributedString:" },
+    { 0x3f8d5cc13ec67be0ULL, "application:delegateHandlesKey:" },
+    { 0x56b5702460505b8bULL, "detachDrawingThread:toTarget:withObject:" },
+    { 0, NULL },
+    { 0x76f481ead42a59d4ULL, "_setToolbar:" },
+    { 0x0c09c629bed2fa98ULL, "allocWithKeyedUnarchiver:" },
+    { 0x9aff35325e17d48dULL, "applicationShouldHandleReopen:hasVisibleWindows:" },
+    { 0xefd0046cf03d21c4ULL, "changeInLength" },
+    { 0xa52bc21495140b5dULL, "doDoubleClick:" },
+    { 0xee1245b2aa3e7cb8ULL, "selectionIndexes" },
+    { 0, NULL },
+    { 0xd0073799e27ab0eaULL, "pathContentOfSymbolicLinkAtPath:" },
+    { 0x2df8d7a1e1eb5896ULL, "setAnimations:" },
+    { 0xa965959d51cebea4ULL, "setHasUndoManager:" },
+    { 0x8b145d5aa0fbe303ULL, "drawColorWellBorderInRect:enabled:bordered:active:" },
+    { 0x87d883d29a302247ULL, "paperRect" },
+    { 0x89337368ceba39ddULL, "sendAction" },
+    { 0x2d15e42662810d2bULL, "rectForItemAtIndex:" },
+    { 0xcf3e6882204566daULL, "glyphIndexForPoint:fractionOfDistanceThroughGlyph:" },
+    { 0xc18591fb742f1287ULL, "_alphaChanged:" },
+    { 0x2a304a04492ec66dULL, "underlineGlyphRange:underlineType:lineFragmentRect:lineFragmentGlyphRange:containerOrigin:" },
+    { 0xe0ef889ddeaff7d9ULL, "isMainWindow" },
+    { 0xec80b73a1d65c227ULL, "setArrowPosition:" },
+    { 0x64397e56d399f83dULL, "PDFRepresentation" },
+    { 0x32cede0326590051ULL, "setNumberStyle:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8822edcc21ee888fULL, "textContainerInset" },
+    { 0x07ac82acab513701ULL, "_setPreviousKeyView:" },
+    { 0x384805ef1c687cb7ULL, "level" },
+    { 0, NULL },
+    { 0x45dcb8c2684d648bULL, "scrollToBeginningOfDocument:" },
+    { 0x176d6908c55e903bULL, "addressesForDNSHostName:" },
+    { 0, NULL },
+    { 0xcc216e8b7c0a704fULL, "redoActionName" },
+    { 0x7825b8b04b099b19ULL, "bundlePath" },
+    { 0, NULL },
+    { 0xaa909e5a0fb37f32ULL, "appendBytes:length:" },
+    { 0xd95a9c95d53aaf39ULL, "isEqualToTimeZone:" },
+    { 0, NULL },
+    { 0x44618535e713766cULL, "drawTabInRect:clipRect:color:selected:" },
+    { 0x44c21541a9de6662ULL, "acceptsMouseMovedEvents" },
+    { 0xbf3b34f0df746c05ULL, "reverseObjectEnumerator" },
+    { 0x73ad56d12ef4ac03ULL, "setOperationWouldBlock:" },
+    { 0x6f0d27981c938634ULL, "abortParsing" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xab3a9edf0b767bcdULL, "CGColorSpace" },
+    { 0x17edfa5183d79635ULL, "rotateByDegrees:" },
+    { 0xaf414bf9fcf83172ULL, "extractFromPositiveFormat" },
+    { 0, NULL },
+    { 0x77c7261f541ec53fULL, "keyEventWithType:location:modifierFlags:window:characters:charactersIgnoringModifiers:isARepeat:keyCode:" },
+    { 0x62baf37d828d1771ULL, "decodePointForKey:" },
+    { 0x1c92284e54dbdf81ULL, "highlight:withFrame:inView:" },
+    { 0xc2c24d6e94e32762ULL, "KVO_notifying_change_removeKey:" },
+    { 0xab20fe0de27f12bcULL, "day" },
+    { 0xd011daa22d64cabcULL, "attributedStringForZero" },
+    { 0, NULL },
+    { 0x8c6c003ad95e2217ULL, "calendar" },
+    { 0x6eaedc76f3b8399cULL, "arrowCursor" },
+    { 0x6f1dd1f8ee618344ULL, "longLongValue" },
+    { 0x11950f1fa367c1a1ULL, "standaloneWeekdaySymbols" },
+    { 0, NULL },
+    { 0x542aa75a134d289cULL, "encodeNumber:indent:" },
+    { 0x2a9d5b350bfb6df2ULL, "textTypes" },
+    { 0x55d30b073396e19dULL, "parentWindow" },
+    { 0x3b615049a4599ec7ULL, "keyPathsForValuesAffectingSelectedLabel" },
+    { 0xb44df1a870e99535ULL, "setPickerMask:" },
+    { 0x78322b743f44fcc6ULL, "setQuartzDebugMode:" },
+    { 0xc25acd1aaee15a2bULL, "setDefaultFormatterBehavior:" },
+    { 0x7deab38a3cdf160eULL, "convertSizeToBase:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6ef7d8b664e37943ULL, "selectInputSource:selectEvent:" },
+    { 0x82a8605f84c76f42ULL, "linkItemAtURL:toURL:error:" },
+    { 0x7c5a690eef659082ULL, "fontWithDescriptor:size:textTransform:" },
+    { 0xd6d54f5a3de93db4ULL, "runPageLayout:" },
+    { 0x9d1a2720297c2195ULL, "setPath:" },
+    { 0xc798b65011ccb93aULL, "face" },
+    { 0xe21c581f709028b7ULL, "removeObjectAtArrangedObjectIndexPath:" },
+    { 0x8a59407a753dcb73ULL, "stopPeriodicEvents" },
+    { 0x71c16b6ebf6e8508ULL, "entityDeclarationForName:" },
+    { 0xfa66b8c79beaef72ULL, "selector" },
+    { 0x0e2c46db2b5e0908ULL, "nextState" },
+    { 0x5e7b3675f3d0544cULL, "charRef:" },
+    { 0xe10c5027d43ce2bcULL, "setDocumentCursor:" },
+    { 0, NULL },
+    { 0xe89ee4816a590f16ULL, "didLoadData:" },
+    { 0x80daca59940b646cULL, "textFileTypes" },
+    { 0xfdbbc830ce3a803fULL, "sortSubviewsUsingFunction:context:" },
+    { 0x2ee5c3a09d1cf6b2ULL, "menu:updateItem:atIndex:shouldCancel:" },
+    { 0xf9a48cb6aac2bca7ULL, "setCollapsesBorders:" },
+    { 0, NULL },
+    { 0x2c45b120f0f916b6ULL, "_indicatorCell" },
+    { 0, NULL },
+    { 0xe7c750ddc7c73fc7ULL, "addRow" },
+    { 0x60f4972a534df8b5ULL, "currentContext" },
+    { 0, NULL },
+    { 0x25ac75a8ade474c1ULL, "indexPathByRemovingLastIndex" },
+    { 0, NULL },
+    { 0x6c2ae799ab1b83d4ULL, "removeAllIndexes" },
+    { 0, NULL },
+    { 0x863712b67706e69bULL, "setKeyboardFocusRingNeedsDisplayInRect:" },
+    { 0, NULL },
+    { 0x17ab4b247965f9d8ULL, "setContainerSize:" },
+    { 0x7171520e56b14d3dULL, "invalidateContextsWithNewSize:forceRebuild:" },
+    { 0x179571cef34d1327ULL, "componentsJoinedByString:" },
+    { 0x979db79856d6a465ULL, "removeLastObject" },
+    { 0xacd8e8437e7a7dfdULL, "imageableRect" },
+    { 0xe20b779d303bab36ULL, "_setupFieldEditorWithFrame:controlView:editor:delegate:" },
+    { 0x661c8057f2f88c1eULL, "stringByTrimmingCharactersInSet:" },
+    { 0xc51953f3c9982683ULL, "didFinishLoading" },
+    { 0xa9ebd8b408852a1aULL, "openPanel:runModalForDirectory:file:types:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x06883bbea5f30637ULL, "runTrackingWithEvent:" },
+    { 0xd08ee56826c5692fULL, "underlinePosition" },
+    { 0xa650fa969f84d2bbULL, "setLayerContentsRedrawPolicy:" },
+    { 0x37ccbfbacc91b83dULL, "stringWithPropertyList:" },
+    { 0x577353433e5aa555ULL, "_drawingScale" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8f78fb144d2cc402ULL, "removeLayoutManager:" },
+    { 0xa43a43e5508a2463ULL, "_getDraggedRow:" },
+    { 0xb0f81edeb7cbf70fULL, "sizeFunction" },
+    { 0x5ea932918e2dafacULL, "getControlSizeAdjustment:" },
+    { 0x812842fd6e541f9aULL, "imageRepsWithPasteboard:" },
+    { 0x4741e1849ee6f675ULL, "setParagraphGlyphRange:separatorGlyphRange:" },
+    { 0x9f2dfc1bed46183eULL, "addContent:" },
+    { 0, NULL },
+    { 0xd7f7bfde9696274aULL, "documentClassNames" },
+    { 0x206b3ff58bbb12cfULL, "setAlternateTitle:" },
+    { 0xc9f3b239c18a9698ULL, "setLenient:" },
+    { 0x18dd4c0aa1ddd4e6ULL, "registerName:withNameServer:" },
+    { 0, NULL },
+    { 0x6dc8bfe04865968fULL, "persistantDomainWithName:" },
+    { 0x672b1492cffa7fc0ULL, "archiver:willEncodeObject:" },
+    { 0xbdf2287d569951cdULL, "currentCursor" },
+    { 0, NULL },
+    { 0x8da1afdd4ac31c6cULL, "addFontDescriptors:toCollection:" },
+    { 0xb9e70e28d1b6cf65ULL, "description" },
+    { 0xc51eed8ed930c4b1ULL, "scanDouble:" },
+    { 0xf50291837ce777c3ULL, "rotateByRadians:" },
+    { 0x140a0290282eeabbULL, "fileHandleForReading" },
+    { 0, NULL },
+    { 0xaf329c760cd23399ULL, "addConnection:toRunLoop:forMode:" },
+    { 0x246a2124f208ef42ULL, "localDraggingSource" },
+    { 0xbd7cabdea77735d7ULL, "setLayoutManager:" },
+    { 0x5797bb701f7ccb40ULL, "applyFromObject:inRow:" },
+    { 0, NULL },
+    { 0x61aa60a6fa32f861ULL, "runModalSession:" },
+    { 0xe6b63b8cfdeb93a3ULL, "setHeadIndent:" },
+    { 0x6987045d96155dc0ULL, "rangeOfString:options:" },
+    { 0xfe24b069db7dd05fULL, "keyPath" },
+    { 0x9e8faaf9a764ffcbULL, "textEncodingName" },
+    { 0x67b9e37b7837d78aULL, "predicateWithFormat:arguments:" },
+    { 0xdaedef5e1d302793ULL, "sendDoubleAction" },
+    { 0, NULL },
+    { 0xa2e5dc51dfe858b8ULL, "content" },
+    { 0, NULL },
+    { 0x8c983ff2527716c0ULL, "drawScrollerButtonInRect:enabled:pressed:vertical:upOrLeft:" },
+    { 0xe1e86c648284ea52ULL, "reset" },
+    { 0xbb26146b71ddd2caULL, "checkSpelling:" },
+    { 0, NULL },
+    { 0xa2dcb33e7308fdfeULL, "resolveNamespaceForName:" },
+    { 0x1d89d46d0f247804ULL, "actionForControlCharacterAtIndex:" },
+    { 0x10c0394b5bb28054ULL, "representationOfImageRepsInArray:usingType:properties:" },
+    { 0x2d8853da02270b96ULL, "convertScreenToBase:" },
+    { 0, NULL },
+    { 0x47ec090938b1052cULL, "stringForObjectValue:" },
+    { 0xe1251e3bdb8c181bULL, "setCurrentUnicodeCharacterBytesCount:" },
+    { 0, NULL },
+    { 0xd6b8432720e36904ULL, "setMIMEType:" },
+    { 0x570e44b648a92a4dULL, "alternateButton:" },
+    { 0xbd45ccf9997e5633ULL, "enterExitEventWithType:location:modifierFlags:timestamp:windowNumber:context:eventNumber:trackingNumber:userData:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xbd1ceed3c1cd5d1fULL, "elementsForLocalName:URI:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x88077745a3911dbdULL, "dividerRectAtIndex:" },
+    { 0xad392378786aba68ULL, "discardEditing" },
+    { 0x19510dda89ca0f1eULL, "setAllowsOtherFileTypes:" },
+    { 0x03f9908020aff4b2ULL, "setContentSize:" },
+    { 0xf16b97fc4bafbeb3ULL, "setLineSpacing:" },
+    { 0xcef29a4b943eafb0ULL, "typeIndex" },
+    { 0xf48ca9f4d564c338ULL, "writeToFile:ofType:originalFile:saveOperation:" },
+    { 0x2c46dffdedd3f8c2ULL, "view:stringForToolTip:point:userData:" },
+    { 0x74de8746cf19ed45ULL, "proxyType" },
+    { 0x472c149594de71e7ULL, "setAllowsToolTipsWhenApplicationIsInactive:" },
+    { 0x2c145286418a9d65ULL, "visibleItemArray" },
+    { 0x322e3abaa077b172ULL, "layoutManager:didCompleteLayoutForTextContainer:atEnd:" },
+    { 0, NULL },
+    { 0x9b0bde457a5b5a42ULL, "propertyListForType:" },
+    { 0x178620d1b5f89d00ULL, "multiplier" },
+    { 0xbc8033068f0d3a09ULL, "setFrameCenterRotation:" },
+    { 0xaf6ba98cf2bd5ea9ULL, "getColor:location:atIndex:" },
+    { 0x96e63bb484d63b18ULL, "itemAtIndex:" },
+    { 0, NULL },
+    { 0xa3479ef6afb54545ULL, "columnNumber" },
+    { 0x4ac820c87a4305d7ULL, "rangeOfUnit:inUnit:forDate:" },
+    { 0x1c496d076f23574bULL, "horizontalScroller" },
+    { 0x02281bd0b21bb4a0ULL, "objectValues" },
+    { 0x9cdcb780cead1ba2ULL, "textAttributesForPositiveInfinity" },
+    { 0x5d926da5fade32dfULL, "_GetOpenFileName" },
+    { 0x9a5561e5d6e35453ULL, "sharedWorkspace" },
+    { 0xcc8c5ee691597d79ULL, "autorecalculatesContentBorderThicknessForEdge:" },
+    { 0x8126fbd72badc48eULL, "animationResizeTime:" },
+    { 0x80e22358a23e47d5ULL, "allMeasurementUnits" },
+    { 0xc3a4f67c1a73bc60ULL, "maximumAdvancement" },
+    { 0xf1bcf7dd08733caeULL, "setCompositingOperation:" },
+    { 0xf1a14a5c259ee13eULL, "drawButtonPartId:stateId:inRect:" },
+    { 0xd23b14b38597bcddULL, "applicationDidChangeScreenParameters:" },
+    { 0x94e0359a3717478bULL, "_kvo_operator_count:" },
+    { 0x15a8e051c0b03b8aULL, "gridColor" },
+    { 0x372663afd83e10efULL, "setDTDKind:" },
+    { 0x5b450942fa797c11ULL, "colorListBrowserClicked:" },
+    { 0xa9e95f3522b7cc77ULL, "createScrollViewAtIndex:" },
+    { 0x52bd98c9e8fe6241ULL, "destroyContext" },
+    { 0, NULL },
+    { 0x0acc6c1564196cb2ULL, "initTextCell:" },
+    { 0xdc6b82072a28a7a5ULL, "splitView:effectiveRect:forDrawnRect:ofDividerAtIndex:" },
+    { 0x55dd8f1789a7a902ULL, "setPropertyList:forType:" },
+    { 0xb7323a2181e35d05ULL, "attributedStringForNil" },
+    { 0x6151dd6b067df5deULL, "_didFindService:moreComing:" },
+    { 0x486fcab8d4caf9a4ULL, "makeBackingLayer" },
+    { 0, NULL },
+    { 0x58b6908a580645f0ULL, "setDatePickerElements:" },
+    { 0x7a9b594f9b406ef7ULL, "selectLastTabViewItem:" },
+    { 0, NULL },
+    { 0xab7ad8a64bf9e72cULL, "WM_MOUSEACTIVATE_wParam:lParam:" },
+    { 0x3fb1dc3dde957014ULL, "uniqueSpellDocumentTag" },
+    { 0x48b4e24833dda7f8ULL, "getStreamsToHost:port:inputStream:outputStream:" },
+    { 0, NULL },
+    { 0x686e80b8e9be92f2ULL, "rulersVisible" },
+    { 0x386264b55d0cb8c2ULL, "viewAnimations" },
+    { 0xd6a1874c90bea805ULL, "exit" },
+    { 0xd8fb8f73975245c7ULL, "_attachDrawer:" },
+    { 0x4e4cae57ae231d0eULL, "setShowsToolbarButton:" },
+    { 0xca04b77b8bd0fe5eULL, "removeItemAtIndex:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf957e8d18611de21ULL, "drawers" },
+    { 0xc1eb397fc40fd708ULL, "unarchiver:cannotDecodeObjectOfClassName:originalClasses:" },
+    { 0x1f46ea278afff1caULL, "destinationOfSymbolicLinkAtPath:error:" },
+    { 0xdefe5790c11fa697ULL, "resolveWithTimeout:" },
+    { 0, NULL },
+    { 0x6cc6b372f886de32ULL, "stringWithSavedFrame" },
+    { 0x255c5b3b219d67a6ULL, "edited:range:changeInLength:" },
+    { 0x164e79d2050b0324ULL, "setLabel:" },
+    { 0, NULL },
+    { 0xa91fdc43abf9b58eULL, "appendCTM" },
+    { 0xe9e846df36de8dd8ULL, "setMovableByWindowBackground:" },
+    { 0, NULL },
+    { 0xff1cc5e810ef6527ULL, "cancelAllOperations" },
+    { 0xf653b70e041524baULL, "usesDataSource" },
+    { 0, NULL },
+    { 0xf223db36d51ce955ULL, "controlTextColor" },
+    { 0x2c72604b5ac64c03ULL, "mnemonicLocation" },
+    { 0x139085561eb3e03dULL, "setFirstLineHeadIndent:" },
+    { 0xd28df93a067a4e27ULL, "patternPhase" },
+    { 0, NULL },
+    { 0x4eac96221357b83eULL, "drawPackedGlyphs:atPoint:" },
+    { 0x31b90b711e57be72ULL, "proposedCredential" },
+    { 0xd5ea8f11c406d635ULL, "informativeText" },
+    { 0x0c6c6030e68c2f88ULL, "rightMouseUp:" },
+    { 0x8a05c1b7ece74c0fULL, "_attributedStrings" },
+    { 0x76ec14a73f32f5d5ULL, "numberOfMajorTickMarks" },
+    { 0xd8bf7c6a97538e9cULL, "week" },
+    { 0xb757d21bb86ec44fULL, "unlearnWord:" },
+    { 0, NULL },
+    { 0x0a8ac3a3ac5dadcdULL, "_defaultNewObject" },
+    { 0x5b4b23c82aa4d587ULL, "_resetTrackingAreas" },
+    { 0x25f9a56a57de65bdULL, "controllerDidChange" },
+    { 0x29c034cfae0710baULL, "lockWhenCondition:" },
+    { 0x8985db06959d0abeULL, "attributedStringValue" },
+    { 0xb546d590283c5d9fULL, "modalWindow" },
+    { 0xea7a976ea4c03778ULL, "standardAboutPanel" },
+    { 0, NULL },
+    { 0x3cc5fe9f3638d841ULL, "_hideMenuViewIfNeeded" },
+    { 0x907704b4efef32fcULL, "addEntriesToDeviceDictionary:" },
+    { 0, NULL },
+    { 0xbf0f552ed72ba39aULL, "_extractDataFloat" },
+    { 0x8fde2695a93289cfULL, "displayNameForType:" },
+    { 0, NULL },
+    { 0xbed94b2d2f897a86ULL, "_mouseDownTrack:" },
+    { 0x400c56a4516c751dULL, "selectionHighlightStyle" },
+    { 0, NULL },
+    { 0x4d4c8f5d742c7b00ULL, "updateSelectedIndex:" },
+    { 0x0223cc8085b691e6ULL, "setAutoresizesOutlineColumn:" },
+    { 0, NULL },
+    { 0x873b006132ceae09ULL, "backingLocation" },
+    { 0x2b5b9a59fd29d539ULL, "lineBreakByHyphenatingBeforeIndex:withinRange:" },
+    { 0xc9732412d9e412a1ULL, "surface" },
+    { 0, NULL },
+    { 0x7ae64aac14eae0d3ULL, "setImagePosition:" },
+    { 0x5922f68c4f29cc48ULL, "noteSelectionIsChanging" },
+    { 0x1adb6af3514c52a5ULL, "thickness" },
+    { 0x1b7012fa8cbd518cULL, "highlightColor" },
+    { 0x1cd4b525e84ded66ULL, "loadNibNamed:owner:" },
+    { 0, NULL },
+    { 0x0334ebcbfbc16f80ULL, "keyBindings" },
+    { 0xd2eb1e8ffa20df8eULL, "autosavingDelay" },
+    { 0x455cda15aade6777ULL, "insertNewline:" },
+    { 0xd6a41b254a7b5671ULL, "affectedRange" },
+    { 0xb5adb56cc6c1231cULL, "insertObject:atArrangedObjectIndex:" },
+    { 0x02a3bc4217ddfcb6ULL, "continueTrackingCircularSliderAtPoint:at:inView:" },
+    { 0x3e1dcf9731c9cdcfULL, "allowsConcurrentViewDrawing" },
+    { 0x3b4795df5914de8dULL, "code" },
+    { 0, NULL },
+    { 0xc3c69b944343c79cULL, "otherEventWithType:location:modifierFlags:timestamp:windowNumber:context:subtype:data1:data2:" },
+    { 0x32ffe5461404ed4aULL, "removePropertyForKey:inRequest:" },
+    { 0xb131895664f56b21ULL, "drawGridInClipRect:" },
+    { 0xe3f0925578e3ad1cULL, "moveParagraphForwardAndModifySelection:" },
+    { 0xdef4663e6789a9ceULL, "control:textView:doCommandBySelector:" },
+    { 0x0b1b4d2c107f3ab6ULL, "matrix" },
+    { 0xda325d4258549d4bULL, "alertWithMessageText:defaultButton:alternateButton:otherButton:informativeTextWithFormat:" },
+    { 0xdd5400dae90d4852ULL, "sharedCredentialStorage" },
+    { 0, NULL },
+    { 0x97e31e05608af08cULL, "monthOfYear" },
+    { 0x6fc67e233dd77346ULL, "negativePrefix" },
+    { 0xbba715898fd24132ULL, "makeKeyAndOrderFront:" },
+    { 0xa8024972ad88cd8eULL, "_registerPerform" },
+    { 0x7b3a24d9a535d16bULL, "setCredential:forProtectionSpace:" },
+    { 0x80c4e9721812ddc2ULL, "swapBuffers" },
+    { 0xb6b78ac59851ecf9ULL, "usesWeakReadAndWriteBarriers" },
+    { 0x999cb66a91ae577aULL, "temporaryAttributesAtCharacterIndex:effectiveRange:" },
+    { 0x1a2701e066cf6e91ULL, "boundingRectForFont" },
+    { 0x1ef2a1ea5cd27599ULL, "localeIdentifier" },
+    { 0x2f4d3e2eb53bd25aULL, "dataSourceSetObjectValue:forTableColumn:row:" },
+    { 0x0e76e2ae5d309308ULL, "shouldRunSavePanelWithAccessoryView" },
+    { 0, NULL },
+    { 0xe19bbbfe8f99d723ULL, "setYear:" },
+    { 0, NULL },
+    { 0x2eb909b8341032aaULL, "drawProgressIndicatorBackground:clipRect:bezeled:" },
+    { 0x37200ef6668cff5fULL, "heightTracksTextView" },
+    { 0x5cef41161c53cd02ULL, "tabStops" },
+    { 0, NULL },
+    { 0x29670af31ef9af91ULL, "allFrameworks" },
+    { 0xc061f3bbbe39e187ULL, "orderFrontStandardAboutPanel:" },
+    { 0xe99f2333e42f63ffULL, "_baseUser" },
+    { 0, NULL },
+    { 0xd02f3621ec9c6dacULL, "drawSheetBorderWithSize:" },
+    { 0, NULL },
+    { 0xdb84e482c2a54ff5ULL, "getFileSystemRepresentation:maxLength:" },
+    { 0xd47c6fe28df3ee53ULL, "isScrollable" },
+    { 0x2a429e23b5353a50ULL, "decimalNumberWithDecimal:" },
+    { 0, NULL },
+    { 0xec2b8e5a0680ddacULL, "onStateImage" },
+    { 0x9a08e0d10cb79b16ULL, "WM_EXITSIZEMOVE_wParam:lParam:" },
+    { 0x9563b77b4799d6cfULL, "isCachedSeparately" },
+    { 0x493ff7acb159223bULL, "setContextHelp:forObject:" },
+    { 0, NULL },
+    { 0xdb4287caa9ec5422ULL, "minPossiblePositionOfDividerAtIndex:" },
+    { 0x8a641afb6f97d0bcULL, "invocationWithMethodSignature:" },
+    { 0x4acc3fab8f516228ULL, "replacementCheckingResultWithRange:replacementString:" },
+    { 0xe41ceabca88dc3f5ULL, "waitUntilDate:" },
+    { 0x904b6420d4d7ee6eULL, "isEqualToIndexSet:" },
+    { 0, NULL },
+    { 0xd1e55fde127b8669ULL, "isActive" },
+    { 0x939b136ed5b58a31ULL, "quarter" },
+    { 0xfffb4696b8723c7fULL, "setTabState:" },
+    { 0x1a206f6789cae957ULL, "resolveCommonModes:" },
+    { 0x84be70bc7e1a401eULL, "openGLFlushBuffer" },
+    { 0x7b9c49c14c11d1f3ULL, "allowsDuplicatesInToolbar" },
+    { 0x9a6d8854c5e087daULL, "_selectTextCell:" },
+    { 0xaa7eb923b753093eULL, "_selectedTag" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x7aeec677e88bae60ULL, "encodeChar:" },
+    { 0, NULL },
+    { 0xf89dc3bb83b3c994ULL, "notPredicateWithSubpredicate:" },
+    { 0x00a7d665029b2253ULL, "drawPageBorderWithSize:" },
+    { 0, NULL },
+    { 0xf26368fe32954c22ULL, "toManyRelationshipKeys" },
+    { 0x40d0b9eaff91de51ULL, "isAbsolutePath" },
+    { 0xc3e89eed84e339e4ULL, "scrollRect:by:" },
+    { 0, NULL },
+    { 0x916ab1859931c2deULL, "rangeOfString:" },
+    { 0x800495630fba61a3ULL, "paste:" },
+    { 0x09cc64a5d7fa6803ULL, "encodeInt:forKey:" },
+    { 0xafa541936d4cf65fULL, "setLength:" },
+    { 0x397396a597bfc5ebULL, "tabViewItemAtIndex:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x42f8d2d2fcab6157ULL, "startingRow" },
+    { 0x7543ed6a4a681fb4ULL, "bitmapRepresentation" },
+    { 0x0c2b5f7f46d9c151ULL, "timeIntervalSinceDate:" },
+    { 0x49c096407c03707dULL, "isSheet" },
+    { 0x94f7d4e47d5e770cULL, "checkExtensionsInString:" },
+    { 0x45479d9ace1ef7b8ULL, "filteredSetUsingPredicate:" },
+    { 0x8666621314e59d6aULL, "replaceObjectsInRange:withObjectsFromArray:range:" },
+    { 0xd963a9bcb9d3ddf7ULL, "floatForKey:" },
+    { 0xe538f55c6b110353ULL, "_flashWindow" },
+    { 0xef948de036fa5723ULL, "setServicesMenu:" },
+    { 0x44e481cbb2940b59ULL, "languagesForScript:" },
+    { 0x6ace0db9b4c3df54ULL, "rectOfPathComponentCell:withFrame:inView:" },
+    { 0xe8ea7c801d3b53f4ULL, "orderFrontStandardAboutPanelWithOptions:" },
+    { 0x16909376d863ae72ULL, "renewGState" },
+    { 0xe1265797632ebac2ULL, "order" },
+    { 0x7f1a31629bae1f2cULL, "setUsesGroupingSeparator:" },
+    { 0xda10ee5c885921deULL, "openFile:fromImage:at:inView:" },
+    { 0x71163d0a1d7f76c5ULL, "application:openFileWithoutUI:" },
+    { 0x6859c8b551598399ULL, "mainBundle" },
+    { 0x57e5a62018276074ULL, "visibleRect" },
+    { 0x239ffe65e6c12f50ULL, "reloadColumn:" },
+    { 0, NULL },
+    { 0x3b9060c5b71fc1b9ULL, "reservedThicknessForMarkers" },
+    { 0x981218860e56c8bcULL, "unarchiveObjectWithFile:" },
+    { 0xab0ffba6a3d1c790ULL, "makeObjectsPerformSelector:" },
+    { 0, NULL },
+    { 0xec5c0fe97de3a1f6ULL, "setDecimalSeparator:" },
+    { 0xdbf77b5b9c0e34eeULL, "decodeSizeForKey:" },
+    { 0xef30f491149179c2ULL, "revertToContentsOfURL:ofType:error:" },
+    { 0x027e45f2ebc1a0edULL, "characterRangeForGlyphRange:actualGlyphRange:" },
+    { 0x164f4be1420f3019ULL, "parser:foundProcessingInstructionWithTarget:data:" },
+    { 0x2a0ebf9dfa58c31fULL, "typesetterBehavior" },
+    { 0x9ab913c72e725d8eULL, "_kvo_operator_sum:" },
+    { 0, NULL },
+    { 0x0ddca2cbeec88934ULL, "unsignedIntValue" },
+    { 0, NULL },
+    { 0xd99043bb11fc6d76ULL, "adjustScroll:" },
+    { 0x7ce6c4c47da162c4ULL, "setUsesAlternatingRowBackgroundColors:" },
+    { 0xb2a5cfd32056bd16ULL, "archiveRootObject:toFile:" },
+    { 0x56d197956e140314ULL, "windowDidEndSheet:" },
+    { 0xe6fbb675bc9aa470ULL, "orderedIndex" },
+    { 0, NULL },
+    { 0x4e990fb449a88778ULL, "setInitialValues:" },
+    { 0xf56a7db903da0ba9ULL, "timeZoneAdjustedInterval" },
+    { 0x287a25fc8506eb7dULL, "frameRectForContentRect:" },
+    { 0, NULL },
+    { 0xe6ee255c55717698ULL, "setAllowsColumnReordering:" },
+    { 0x358d05229d2a971aULL, "components:fromDate:" },
+    { 0xef45f14ee96e764aULL, "isFilePackageAtPath:" },
+    { 0x5a9c982c2447aae9ULL, "currentDisplay" },
+    { 0, NULL },
+    { 0x00d0fb503b90aff9ULL, "setCurrentVirtualScreen:" },
+    { 0xd0a74b0d98bd22b3ULL, "lastPathComponent" },
+    { 0xf36dbbc1da412e52ULL, "windowWillMiniaturize:" },
+    { 0x820144e08a5052e9ULL, "argument" },
+    { 0xdd23e5739eadbd4fULL, "setCacheDepthMatchesImageDepth:" },
+    { 0xd456f7b573965208ULL, "takesTitleFromPreviousColumn" },
+    { 0x1ef717382e6b5d02ULL, "substringFromIndex:" },
+    { 0xd75a1add149ee08bULL, "setDefaultBehavior:" },
+    { 0x5f8b6f7002ada949ULL, "setSupermenu:" },
+    { 0x7e2dc9e48ff97f45ULL, "setCharacterIndex:forGlyphAtIndex:" },
+    { 0xa94e85cce74ee9e7ULL, "isLoaded" },
+    { 0x0c980c1f765d245cULL, "rangeOfString:options:range:locale:" },
+    { 0xc99684e906ddc475ULL, "outlineViewItemDidExpand:" },
+    { 0x934645787a4b1009ULL, "systemID" },
+    { 0x6152e512fc538dd6ULL, "mergeUsingFunction:context:A:left:right:end:B:" },
+    { 0x05ef794744550c2bULL, "removeFromRunLoop:forMode:" },
+    { 0x6b7817f9d72b0a2fULL, "setDiskCapacity:" },
+    { 0x28f35973b2f9f4c6ULL, "_parentWindowDidDeactivate:" },
+    { 0x46bb4d5fad9af62dULL, "setUsesFontPanel:" },
+    { 0, NULL },
+    { 0xf50dc67dc59f5778ULL, "startWhenAnimation:reachesProgress:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xfe7bca9031c1da10ULL, "performMiniaturize:" },
+    { 0x378d3b6bf80d0095ULL, "_extractWordEight" },
+    { 0xae2deca5b2271788ULL, "decimalNumberWithString:locale:" },
+    { 0x2b2e3377fe2390c0ULL, "drawButtonImage:inRect:enabled:mixed:" },
+    { 0x90c61c27ea6f6ed7ULL, "allocWithZone:" },
+    { 0, NULL },
+    { 0xfc4ff10e31e795f8ULL, "initWithContentsOfURL:byReference:" },
+    { 0x521d7af575487a99ULL, "addDocument:" },
+    { 0, NULL },
+    { 0x8788ea0882bffe09ULL, "formatWidth" },
+    { 0x13f87722c9de0858ULL, "unsignedLongLongValue" },
+    { 0, NULL },
+    { 0x151ad2bceb56084fULL, "decrement" },
+    { 0x21d5b8f0aa13d590ULL, "selectToMark:" },
+    { 0xb32c28ed252edf44ULL, "placeBelowWindow:" },
+    { 0, NULL },
+    { 0x2931b3d91a361abaULL, "isSymbolicLink" },
+    { 0, NULL },
+    { 0x861672d56ba74406ULL, "scrollRectToVisible:" },
+    { 0xbde4ad94b90b9a60ULL, "resizeUpCursor" },
+    { 0xb8818426e06cbe38ULL, "nilSymbol" },
+    { 0, NULL },
+    { 0xabe7664b568ff6fcULL, "boolForKey:" },
+    { 0xcce39d29f046911eULL, "draggedImage" },
+    { 0x70328461bc46dcf0ULL, "readInBackgroundAndNotifyForModes:" },
+    { 0xc00940f9a3088ce5ULL, "isHandshaking" },
+    { 0x091d0c2510942411ULL, "compoundPredicateType" },
+    { 0x05e2870c382bf782ULL, "willRemoveSubview:" },
+    { 0x672adfd580eca00cULL, "moveWordForwardAndModifySelection:" },
+    { 0, NULL },
+    { 0xcf5c782fd79ac4e1ULL, "flushWindowIfNeeded" },
+    { 0x26dfa06b54d7718bULL, "_buildDictionaryRep" },
+    { 0x50b5b9d9b1c57d98ULL, "operations" },
+    { 0, NULL },
+    { 0x3447817497593ea8ULL, "defaultNameServerPortNumber" },
+    { 0xff0e7daf8888923bULL, "typefaceWithName:" },
+    { 0x5aeff73c1ab61b7aULL, "setRootElement:" },
+    { 0, NULL },
+    { 0xce57e49ce5f58026ULL, "open:" },
+    { 0xa3705e6815387fb8ULL, "drawTabPaneInRect:" },
+    { 0xfb23915f30917163ULL, "pointerValue" },
+    { 0x8d7affcd56a08481ULL, "setValue:forKeyPath:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xba30bcb17191790eULL, "scaleBy:" },
+    { 0x96762df6d59f3f96ULL, "objectsAtIndexes:" },
+    { 0x2c2b1bb042011644ULL, "discardCursorRects" },
+    { 0x676ee33223d6cb57ULL, "_didResolveAddress" },
+    { 0xc222b80ba62e5acaULL, "setNamespaces:" },
+    { 0x5b9d93b64b9b1be2ULL, "archiverDidFinish:" },
+    { 0, NULL },
+    { 0x7b57f01dcc04cffbULL, "runModalSavePanel:withAccessoryView:" },
+    { 0xc1a5a61fa8b39f95ULL, "key" },
+    { 0, NULL },
+    { 0xc366e39de4016345ULL, "setLeaf:" },
+    { 0xc238e0bfcb2e341aULL, "waitInBackgroundInMode:" },
+    { 0x4f7a7f48fae791baULL, "setLevelIndicatorStyle:" },
+    { 0xd29f4b956c70937bULL, "didSelectToolbarItem:" },
+    { 0, NULL },
+    { 0x6953e950aeeda02bULL, "tabState" },
+    { 0x7d2003bc0ae86819ULL, "_labelAttributes" },
+    { 0x92900901ff2ab370ULL, "setResizeIncrements:" },
+    { 0xa505587b02fa9fdcULL, "clientView" },
+    { 0x6bf635128d89c623ULL, "tokenStyle" },
+    { 0xd159cf3bc00cc70fULL, "selectNextKeyView:" },
+    { 0xf0738ae24a49d6cbULL, "applicationDidResignActive:" },
+    { 0x63f26c33e21b64cbULL, "previousValidKeyView" },
+    { 0x3b987318447b01f0ULL, "textContainerOrigin" },
+    { 0xf280bc3c9178bc32ULL, "setToolTip:forSegment:" },
+    { 0x2ba1e3e777ffb0b7ULL, "download:didReceiveAuthenticationChallenge:" },
+    { 0x32d03efa1dc72554ULL, "layoutGlyphsInLayoutManager:startingAtGlyphIndex:maxNumberOfLineFragments:nextGlyphIndex:" },
+    { 0, NULL },
+    { 0x2dcb9aa32ea3f9b5ULL, "prefersColorMatch" },
+    { 0x6c7771d9f646f0dbULL, "printOperationWithSettings:error:" },
+    { 0x56ab36c14bd0d38eULL, "canHide" },
+    { 0x6b81a039f042e19fULL, "updateTrackingAreas" },
+    { 0, NULL },
+    { 0x842a9838bd7e9781ULL, "lineBreakMode" },
+    { 0, NULL },
+    { 0x9c6dfd76e38158e9ULL, "textStorage" },
+    { 0x9b3ec47418bcf127ULL, "setShadowOffset:" },
+    { 0, NULL },
+    { 0x18a4b3a605b256f2ULL, "addTimer:" },
+    { 0xa22df71958bbc7f5ULL, "encodeSize:forKey:" },
+    { 0x205907189e7ea90fULL, "minimumIntegerDigits" },
+    { 0x89c788b72c51e9e3ULL, "propertyListFromElement:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe83c441926e5ad95ULL, "decodeClassFromDictionary:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xaf05dce4afb99102ULL, "controlShadowColor" },
+    { 0xb7e7abca47ca82eeULL, "objectsForKeys:notFoundMarker:" },
+    { 0, NULL },
+    { 0xb9fc6d1d8c5fe76aULL, "setHTTPShouldHandleCookies:" },
+    { 0x587a4d18165f6d21ULL, "resolveInstanceMethod:" },
+    { 0xeb7fea67e70f1b14ULL, "keepBackupFile" },
+    { 0xa7d9286d19d1c594ULL, "_updateTrackingAreas" },
+    { 0xc4c36e4766cd3e87ULL, "setView:" },
+    { 0xd6ac6a691b23a513ULL, "compareKeyViewPosition:" },
+    { 0, NULL },
+    { 0x44a3457bbd004685ULL, "bezierPathWithRect:" },
+    { 0x7790d3234f331d80ULL, "fontDescriptorWithFace:" },
+    { 0x1f19b194b52a47f6ULL, "uppercaseString" },
+    { 0x5131bc084b13266aULL, "mouseUp:" },
+    { 0xdeb6ee38eecf34aaULL, "fileManager:shouldCopyItemAtPath:toPath:" },
+    { 0xad846fb4f020dcafULL, "_startRunningCopyPipe" },
+    { 0xdc4bd437ee291523ULL, "loadPrivateFontPaths:" },
+    { 0xe442abc28278d08aULL, "initialFirstResponder" },
+    { 0x2faf58cc083c5d66ULL, "isEnabled" },
+    { 0x34a925369527b71aULL, "setExtraLineFragmentRect:usedRect:textContainer:" },
+    { 0, NULL },
+    { 0x5090416600639edeULL, "setSelectedItemIndex:" },
+    { 0x6efb915df88a6e89ULL, "setPosition:ofDividerAtIndex:" },
+    { 0x1886b240d8102c09ULL, "setResizingMask:" },
+    { 0xb984b01e25eb140fULL, "validateGlyphsAndLayoutForContainer:" },
+    { 0x48a1f6f7a7d2f526ULL, "loadDefaultItemsIfNeeded" },
+    { 0, NULL },
+    { 0xcee12b5b61a6259eULL, "rootElement" },
+    { 0x47b98ca5042367c0ULL, "addWindowsItem:title:filename:" },
+    { 0, NULL },
+    { 0x5119b72bdeabaf78ULL, "_fontForGlyphRange:" },
+    { 0xeedfd9f31911bf43ULL, "fontManager:willIncludeFont:" },
+    { 0x3ca4d5dbe7f40d78ULL, "_willDisplayCell:forTableColumn:row:" },
+    { 0xe1b8178c581d4e70ULL, "isEqualToValue:" },
+    { 0x659bced55f67a9baULL, "viewSizeChanged:" },
+    { 0x6c58e4df099d13abULL, "moveDownAndModifySelection:" },
+    { 0xb7361b0f93bbf60cULL, "selectedControlTextColor" },
+    { 0x27313b5a53d4a800ULL, "browser:createRowsForColumn:inMatrix:" },
+    { 0, NULL },
+    { 0xf27946a96c9b8fcbULL, "removeCharactersInRange:" },
+    { 0xee5e2d4e8a37c15dULL, "setString:" },
+    { 0x1e9445c269873577ULL, "replaceLayoutManager:" },
+    { 0x12e837e8a3fd3ddeULL, "configureMenu" },
+    { 0, NULL },
+    { 0xe7d1683827133322ULL, "executeWithError:" },
+    { 0x4cbf7d37e7a14debULL, "registerTables" },
+    { 0x12a723bbdeb0a822ULL, "prepareGState" },
+    { 0, NULL },
+    { 0x3624565bf5f8e3e8ULL, "_setFrameAutosaveNameNoIO:" },
+    { 0xb79513cb8ad6c62cULL, "windowDidUpdate:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3485afde0d61e777ULL, "getAdvancements:forPackedGlyphs:length:" },
+    { 0xd51b6758b8139411ULL, "registerWindow:dragTypes:" },
+    { 0x70c3296f646534f5ULL, "deletesFileUponFailure" },
+    { 0xb600428323c1de06ULL, "setAcceptsTouchEvents:" },
+    { 0x26d0a509183cbc3dULL, "drawTitleOfColumn:inRect:" },
+    { 0x8a60051b71d6f3cfULL, "textCaretBlinkInterval" },
+    { 0x0a5c775a85fb60dbULL, "preferredFilenameExtensionForType:" },
+    { 0x391f869d35ab804fULL, "temporaryDirectory" },
+    { 0x9b788bfacd1ad57aULL, "drawMarkersInRect:" },
+    { 0x95bcd763375c85cdULL, "canStoreColor" },
+    { 0xc9dbd790b2c83918ULL, "controlColor" },
+    { 0x569dcfdf6a378adaULL, "removeConnection:fromRunLoop:forMode:" },
+    { 0xed5bb82935f34dd4ULL, "addDependency:" },
+    { 0xcab4ecea9fce369bULL, "placeAboveWindow:" },
+    { 0x4f78224bc2724cc9ULL, "isEqualFunction" },
+    { 0x3ceba0bacff56f57ULL, "needsToBeUpdatedFromPath:" },
+    { 0xe5c323c770541219ULL, "fileTypeFromLastRunSavePanel" },
+    { 0xe4684bbd1697030dULL, "pollInputForMode:" },
+    { 0x528d6342879dca28ULL, "attemptRecoveryFromError:optionIndex:delegate:didRecoverSelector:contextInfo:" },
+    { 0xba804e5a431d2d0cULL, "alignLeft:" },
+    { 0x927dc62c2aba4161ULL, "mouseEventWithType:location:modifierFlags:timestamp:windowNumber:context:eventNumber:clickCount:pressure:" },
+    { 0x6457d41693e25f14ULL, "setFullScreen" },
+    { 0xc52d4cd90aea4e19ULL, "encodeValuesOfObjCTypes:" },
+    { 0x29a6368179b1fa25ULL, "sharedColorPanelExists" },
+    { 0x5bfc00c1a49d0c4dULL, "purpleColor" },
+    { 0x454913fe22ae510aULL, "_performKeyEquivalent:" },
+    { 0xba865b1feb4f99cfULL, "setCurrencyCode:" },
+    { 0x639949981b5b3290ULL, "insertTabViewItem:atIndex:" },
+    { 0xa79c528db54bc082ULL, "rowSpan" },
+    { 0xeb0e4da1e0e48810ULL, "uniqueSelf" },
+    { 0, NULL },
+    { 0x45fef596ae5749d5ULL, "CGLPixelFormatObj" },
+    { 0x1b87fb5786671938ULL, "observer" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd09461a0f766a547ULL, "imageFileTypes" },
+    { 0xc8a51b1f214e0624ULL, "setColorSpaceName:" },
+    { 0x5b922e711ef05a67ULL, "doClick:" },
+    { 0x43518125e86aceccULL, "entity" },
+    { 0x6a18a0cb441604a3ULL, "controlLightHighlightColor" },
+    { 0x599d1ce9dcf2f63bULL, "_setContentDictionary:" },
+    { 0x04abcad06f43ee16ULL, "separatorItem" },
+    { 0xebdc916d88ad94f4ULL, "imageRepClassForFileType:" },
+    { 0x6a6cef95716e68f8ULL, "rangeOfString:options:range:" },
+    { 0, NULL },
+    { 0xc637db91b650532bULL, "shortValue" },
+    { 0xd14adb5eb0496e23ULL, "FORMATETC" },
+    { 0, NULL },
+    { 0xf955efab83dab9eaULL, "setTighteningFactorForTruncation:" },
+    { 0x13841f964917a078ULL, "calculateVisibleRect" },
+    { 0xeb52d29b1db8607aULL, "rgbSliderChanged:" },
+    { 0x48bb7868f3da9e71ULL, "currentRunLoop" },
+    { 0x37a4000385fbb1cdULL, "sendBeforeDate:" },
+    { 0, NULL },
+    { 0x85847ddc44a8d036ULL, "objectDidBeginEditing:" },
+    { 0, NULL },
+    { 0xd6a634a29211ca7eULL, "didLearnWord:inLanguage:" },
+    { 0xd15a8a467175bde9ULL, "nextFileForDiskCache" },
+    { 0xdd8940e3a8fe3772ULL, "drawSpellingState:glyphRange:container:origin:" },
+    { 0xe3617b673d1856a1ULL, "setAllowsFloats:" },
+    { 0x5509e7cd2a9594d6ULL, "setSystemID:" },
+    { 0x6a7c775ac580f89eULL, "defaultType" },
+    { 0xc7b13c57aafe2be9ULL, "_appendBytes:length:" },
+    { 0, NULL },
+    { 0xfff936f115475957ULL, "_clipAndDrawInRect:withAttributes:truncatingTail:" },
+    { 0x99504fb1041dd127ULL, "initWithRect:options:owner:userInfo:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0cdf24b9bb6852b0ULL, "setProtocolForProxy:" },
+    { 0x08a67266b2d88248ULL, "decomposedStringWithCanonicalMapping" },
+    { 0xf3e7e3dee2e25a3aULL, "rulerViewClass" },
+    { 0, NULL },
+    { 0x1235d2fd87651cb7ULL, "classNamed:" },
+    { 0x05fda4a90bcd63efULL, "isEqualToPerform:" },
+    { 0x9ded31af884c0ebeULL, "receivesCredentialsSecurely" },
+    { 0x394aaaf118eda59fULL, "horizontalLineScroll" },
+    { 0xf43588f0ba7a24c5ULL, "setUpFieldEditorAttributes:" },
+    { 0x914f0a283d0cd6cdULL, "levelForRow:" },
+    { 0x2bf7d8d121fe0903ULL, "headerCell" },
+    { 0xed2ffa3ddcc8a53eULL, "writePropertyList:toFile:atomically:" },
+    { 0x10f58d6d1ab971d8ULL, "setFrameSize:" },
+    { 0x5bdfafe2289c2158ULL, "fileManager:shouldProceedAfterError:removingItemAtPath:" },
+    { 0xeb500d7620d595b6ULL, "panelWithFrame:styleMask:backingType:" },
+    { 0xdac79249e09e7ea5ULL, "suggestGuessesForWord:inLanguage:" },
+    { 0xe262f5147261109eULL, "trackForEvent:" },
+    { 0xe3bf1db4cf85beacULL, "isOpaque" },
+    { 0xa25cac2488bc19baULL, "drawUnderlineForGlyphRange:underlineType:baselineOffset:lineFragmentRect:lineFragmentGlyphRange:containerOrigin:" },
+    { 0xe8c55148c840cf3fULL, "browser:selectCellWithString:inColumn:" },
+    { 0, NULL },
+    { 0xd510b793b0bdd1c8ULL, "toolbarDidRemoveItem:" },
+    { 0x31bc957a4c235102ULL, "nullPlaceholder" },
+    { 0xb514ad0cca16fc10ULL, "platformWindowDeactivated:checkForAppDeactivation:" },
+    { 0x7b22c54e593d14d5ULL, "scrollRangeToVisible:" },
+    { 0xb215e5a47109ab0bULL, "setAllHTTPHeaderFields:" },
+    { 0xc26dbab3629ee350ULL, "isDocumentEdited" },
+    { 0, NULL },
+    { 0xc48b68df029713a8ULL, "undo" },
+    { 0x4be65233d81715ecULL, "itemSizeDidChange" },
+    { 0xc7db032afcea2589ULL, "minusSet:" },
+    { 0xc397fe3a611df661ULL, "allowsUndo" },
+    { 0, NULL },
+    { 0x8395e4015c8eeffcULL, "setReusesColumns:" },
+    { 0xd7b96a8edd5f7483ULL, "killBufferIsAdditive" },
+    { 0x41cd5efd258cd803ULL, "_arrowRectForRect:" },
+    { 0xb9df92d54e455ae2ULL, "initWithWindow:targetRect:stepRect:stepCount:stepInterval:display:" },
+    { 0x281d19d00ef65430ULL, "removeAttribute:range:" },
+    { 0x44ebcaae95cbf05cULL, "endModalSession:" },
+    { 0x9807fbdd35cdfedcULL, "animation:didReachProgressMark:" },
+    { 0x6854027320de47c9ULL, "setNibFontTranslator:" },
+    { 0xb13383a7b75090ccULL, "availableTraitsInFamily:" },
+    { 0xd9d9ee360fcc4ab6ULL, "setFrameOrigin:" },
+    { 0xf93e71df72cbd66dULL, "_updatePlatformWindowTitle" },
+    { 0, NULL },
+    { 0xa9b9532e7bdc8d69ULL, "_extractReference" },
+    { 0x85245c2d813617a0ULL, "beginUndoGrouping" },
+    { 0x1e22c756d17680efULL, "textContainerChangedGeometry:" },
+    { 0, NULL },
+    { 0xf9d63c5473c1bcbaULL, "setDateFormat:" },
+    { 0x52728e516d8c84eeULL, "hasThousandSeparators" },
+    { 0, NULL },
+    { 0x5f160c969452e59aULL, "_clipAndDrawInRect:truncatingTail:" },
+    { 0x2c2e3f405d723fa6ULL, "addItemsWithTitles:" },
+    { 0xb0c8f5ddf2f78d8aULL, "menuHasKeyEquivalent:forEvent:target:action:" },
+    { 0xe5008b9252123bd5ULL, "_changeSpellingFromMenuItem:" },
+    { 0x1643dfa8047ed01cULL, "WM_APP1_wParam:lParam:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xba10bee54d2d1ae2ULL, "rgbTextChanged:" },
+    { 0xbcde2a3bb78fd9c9ULL, "establishFontStateInDeviceIfDirty" },
+    { 0, NULL },
+    { 0x1fa77ca14ce4e99cULL, "abortEditing" },
+    { 0xec46e3d523e1a3a6ULL, "isRemovable" },
+    { 0xa440dd9338d7f2c9ULL, "fontTypefaceWithName:" },
+    { 0xb24468d95af495b7ULL, "rulerView:willSetClientView:" },
+    { 0x8853a3c437ce5d9dULL, "outlineView:shouldSelectItem:" },
+    { 0x5bf5da86790c91d4ULL, "setWindowsNeedUpdate:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4326e3a78d9a7c25ULL, "propertyListWithInfo:" },
+    { 0x2269774d128d4f18ULL, "setAutorecalculatesKeyViewLoop:" },
+    { 0, NULL },
+    { 0xd665a3c8c6166f34ULL, "intersectsIndexesInRange:" },
+    { 0x39863b4c3af2786fULL, "numberWithInteger:" },
+    { 0x7c232d894222276aULL, "arrayWithContentsOfFile:" },
+    { 0, NULL },
+    { 0x71aa4ea420fcc098ULL, "resizeWithNewSize:" },
+    { 0, NULL },
+    { 0x5067c3bcba93e67cULL, "dragColor:withEvent:fromView:" },
+    { 0x0277506a6354f24eULL, "postMouseMSG:type:location:modifierFlags:window:" },
+    { 0, NULL },
+    { 0x50239c633c72b2dfULL, "processCommandEvent:" },
+    { 0, NULL },
+    { 0x730fcce99b1a804dULL, "_adjustedFrame:forCell:" },
+    { 0xe7ecb3a0f8f1a13fULL, "decimalNumberByRaisingToPower:withBehavior:" },
+    { 0x545773536d9bd8dbULL, "outlineView:isItemExpandable:" },
+    { 0x4024e8feae9b5491ULL, "setBordered:" },
+    { 0xe8ce0eb48ec9d238ULL, "windowWithWindowNumber:" },
+    { 0x3dc2905d8a74abaaULL, "format" },
+    { 0x579e6b6262d8dcdfULL, "setIgnoredWords:inSpellDocumentWithTag:" },
+    { 0x7f405bd0200a75b4ULL, "putCell:atRow:column:" },
+    { 0xcc3e4c756881f584ULL, "preferredLocalizationsFromArray:" },
+    { 0x2393abf0da1cb5a7ULL, "updateScroller" },
+    { 0x4a96bd43f7209aaaULL, "descriptionWithLocale:" },
+    { 0, NULL },
+    { 0x5f51a5f5bfc19388ULL, "menuForEvent:" },
+    { 0xf2d848979ecf61faULL, "removeObjectForWrite:" },
+    { 0x7e58edd996209bf7ULL, "clickFamilyMatrix:" },
+    { 0x4556c44276b15ac2ULL, "acceptsTouchEvents" },
+    { 0xf7921a2fed6077dfULL, "constrainedSize" },
+    { 0, NULL },
+    { 0x48ef118f3073fef6ULL, "DAdvise::::" },
+    { 0xac60bcac6a2a53efULL, "finishDecoding" },
+    { 0x68dad7f4d2103314ULL, "brightnessChanged:" },
+    { 0x99647339cd1407c9ULL, "minuteOfHour" },
+    { 0x5dc24b4df0d9dbecULL, "preservesContentDuringLiveResize" },
+    { 0x41a7864a13e5fa7dULL, "autosavingFileType" },
+    { 0xeb1723817e37afd5ULL, "applyFromCell:inRow:" },
+    { 0x7078cfffc3bdb083ULL, "searchButtonCell" },
+    { 0xf03af940b0305e65ULL, "exposeBinding:" },
+    { 0xfd223f4ff4f68a82ULL, "autorepeat" },
+    { 0xa78be688f3509f82ULL, "_readHeader" },
+    { 0x60a110d04c8dea25ULL, "positiveSuffix" },
+    { 0xc14d09ebcc52cc71ULL, "_willPublish" },
+    { 0, NULL },
+    { 0x1b8fa0560a15ff45ULL, "undoGroupWithParentGroup:" },
+    { 0x7a9e783fa26416afULL, "frameOfCellAtColumn:row:" },
+    { 0x3d7935ce67faec04ULL, "collapseItem:" },
+    { 0x1e593b37c97f325dULL, "fontPanel:" },
+    { 0x862be4cb00102287ULL, "_GetOpenFileNameForTypes:" },
+    { 0x0374ad24b833d6ceULL, "selectedTextBackgroundColor" },
+    { 0x770dae60625e8e35ULL, "deleteCookie:" },
+    { 0x4ff309d7906ed396ULL, "classForPortCoder" },
+    { 0, NULL },
+    { 0x3eda79f3f55c9978ULL, "setDocumentContentKind:" },
+    { 0xbd804ab63a8ea36bULL, "loadDataRepresentation:ofType:" },
+    { 0x807ce8197cf79e7aULL, "addSelectionIndexPaths:" },
+    { 0xb9707b12c39c4889ULL, "registerName:" },
+    { 0x8ef9857aec3d5585ULL, "setNumberOfTickMarks:" },
+    { 0xed203efc0b098f71ULL, "isEqualTo:" },
+    { 0x18fe4b4cd2561dd3ULL, "isMemberOfClass:" },
+    { 0x367276724169f6fdULL, "_parentWindowDidChangeFrame:" },
+    { 0x33c2b5803a3405b1ULL, "_keyEquivalentDescription" },
+    { 0xafbdc5d3a884f5afULL, "pixelsHigh" },
+    { 0x476bdec895856e6fULL, "imageForHighlight" },
+    { 0xc6ee8a2b25eaadacULL, "numberWithShort:" },
+    { 0x75eb208fd75dc8c3ULL, "initWithTextStorage:range:" },
+    { 0x651c23b3ba187f07ULL, "temporaryAttribute:atCharacterIndex:effectiveRange:" },
+    { 0xb002fbd0c1c3ec86ULL, "setAffectedRange:" },
+    { 0xb5a4efa41f2dcf61ULL, "runModalPageLayoutWithPrintInfo:" },
+    { 0x6b32a4427a8102e7ULL, "setFrameUsingName:" },
+    { 0, NULL },
+    { 0xb9378ea488e594a4ULL, "clearCurrentWithGLContext:" },
+    { 0, NULL },
+    { 0x9702644221e5a0ebULL, "editedMask" },
+    { 0x3c6aebaacb9b92acULL, "setSubviews:" },
+    { 0x2d0ec02c063ea9e3ULL, "removeNamespaceForPrefix:" },
+    { 0x5cb3e8eef32359a7ULL, "download:decideDestinationWithSuggestedFilename:" },
+    { 0, NULL },
+    { 0xc730d12beb9ff7aeULL, "setNotShownAttribute:forGlyphAtIndex:" },
+    { 0x297408a4cf1d18adULL, "rangeOfComposedCharacterSequencesForRange:" },
+    { 0x28522eeed397521dULL, "concat" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x55c97b911239268bULL, "isHorizontallyCentered" },
+    { 0xeaab290debf761f1ULL, "control:didFailToFormatString:errorDescription:" },
+    { 0, NULL },
+    { 0x0d896f04266f7ae9ULL, "writeToFile:ofType:" },
+    { 0, NULL },
+    { 0xf7b082e80e687e23ULL, "destination" },
+    { 0x07a955cf210e4e3fULL, "filenames" },
+    { 0x5c1eb6cc88e7efaeULL, "imageUnfilteredFileTypes" },
+    { 0x9d1d2663ef5c9579ULL, "attributesOfFileSystemForPath:error:" },
+    { 0xb9220626a3445553ULL, "datePickerMode" },
+    { 0xd6449abc23691c3eULL, "sendEvent:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x26e0a4da625923b3ULL, "setServicesProvider:" },
+    { 0x9dd3f372bd55d25dULL, "_didRemoveService:moreComing:" },
+    { 0, NULL },
+    { 0xcc313233a1d49532ULL, "closeAllDocumentsWithDelegate:didCloseAllSelector:contextInfo:" },
+    { 0, NULL },
+    { 0x217b8d362024a2aeULL, "canPlaceNotification:inQueue:coalesceMask:" },
+    { 0x84027ae1b61d97e6ULL, "setArgument:atIndex:" },
+    { 0x3858dfff5c19b621ULL, "shadowBlurRadius" },
+    { 0x6dc4643165b2ff7bULL, "activateIgnoringOtherApps:" },
+    { 0x67a03d6ac17355a1ULL, "extendPowerOffBy:" },
+    { 0xd0707f843b323e8bULL, "protocol" },
+    { 0x457bb0bbe95dbbf1ULL, "appendBezierPathWithArcFromPoint:toPoint:radius:" },
+    { 0, NULL },
+    { 0xe071f9aa71800644ULL, "parentWindowDidActivate:" },
+    { 0x42082b13c4bba614ULL, "lineCapStyle" },
+    { 0xe56733c4dcfb4f6cULL, "invocations" },
+    { 0xd36cd9ff7039f096ULL, "unsignedCharValue" },
+    { 0x5d18fc496210df6dULL, "setNextKeyBindingManager:" },
+    { 0xdcbfe8e644f25fe4ULL, "minWidth" },
+    { 0x41172728b3a3824eULL, "sizeLastColumnToFit" },
+    { 0x8abf421060405c17ULL, "transformStruct" },
+    { 0, NULL },
+    { 0xac41ca10380a9a70ULL, "setAttributedAlternateTitle:" },
+    { 0x7ca4e3928aac6d18ULL, "setCanChooseFiles:" },
+    { 0x28be04818a92310bULL, "setHeaderCell:" },
+    { 0xf04b6d92c32ab19bULL, "selectedObjects" },
+    { 0xdf19431a11f4743cULL, "setWidthTracksTextView:" },
+    { 0x66011cd426973598ULL, "insertionColor" },
+    { 0, NULL },
+    { 0x7517be469cde14eeULL, "containsObjectForRead:" },
+    { 0x88036af4bb5e144eULL, "registeredDraggedTypes" },
+    { 0x709cff4bc1379367ULL, "msgid" },
+    { 0, NULL },
+    { 0xf7d462de33a49ff4ULL, "_hasObserverForKey:" },
+    { 0x8238581571410bd8ULL, "_wrapValue:ofType:" },
+    { 0xd70e13e654bb81bfULL, "dataFromElement:" },
+    { 0x196e324122d9ccb1ULL, "setObjectZone:" },
+    { 0xca9aa8bf18a3ad14ULL, "textShouldEndEditing:" },
+    { 0xe27c269dcc282bbdULL, "attributedStringWithContentsOfFile:" },
+    { 0, NULL },
+    { 0x9aa28957d9549874ULL, "handleApplicationClose" },
+    { 0xb4b4fcd6f3a87fbbULL, "hasMainMenuForStyleMask:" },
+    { 0, NULL },
+    { 0xeedb83532a64a8a8ULL, "grayColor" },
+    { 0x8eb861f37d02385dULL, "hasSubmenu" },
+    { 0x91c43c3a9bdc0f03ULL, "instanceMethodSignatureForSelector:" },
+    { 0x2f9546876b187b5dULL, "attributeWithName:value:" },
+    { 0, NULL },
+    { 0xa4ae986814c1d3e5ULL, "applicationDidFinishLaunching:" },
+    { 0xdfae53dae29ea409ULL, "appendFlip" },
+    { 0, NULL },
+    { 0x2a8ac69d2d822584ULL, "_drawAttachment:atCharacterIndex:atPoint:" },
+    { 0, NULL },
+    { 0xff39043d31fe3ec1ULL, "contentRectForFrameRect:styleMask:" },
+    { 0x211690fbcbbfd747ULL, "frameCenterRotation" },
+    { 0x362e845ea940636cULL, "_invalidateTimer" },
+    { 0x9fd7d1bd91e3c990ULL, "isHidden" },
+    { 0x81b4e17fc36d2633ULL, "layoutManager:shouldUseTemporaryAttributes:forDrawingToScreen:atCharacterIndex:effectiveRange:" },
+    { 0, NULL },
+    { 0x14683f9f025d8accULL, "owner" },
+    { 0x2a0ed5de897155e2ULL, "setMinContentSize:" },
+    { 0x154ff2503045fd3fULL, "_stepDownImage" },
+    { 0x285ee18b91e60d73ULL, "isExecutableFileAtPath:" },
+    { 0x4e4efae0236e96c3ULL, "findString:inBook:" },
+    { 0x4af0e7b860683830ULL, "setTextBlocks:" },
+    { 0x3650d061df1223b5ULL, "loadOutputQueue" },
+    { 0, NULL },
+    { 0x1c09c8140d677399ULL, "mountedRemovableMedia" },
+    { 0x97c6674332bbc6b2ULL, "setDisplayedWhenStopped:" },
+    { 0xac1ab403b9e4fcf4ULL, "setContentMinSize:" },
+    { 0xd81d212762dda85eULL, "dominantLanguageForScript:" },
+    { 0x81bc561b6bd83bb5ULL, "setDTD:" },
+    { 0x9d21c8ddc3a9f6cbULL, "addCGLContext:" },
+    { 0, NULL },
+    { 0x89a93d4af1f192ccULL, "drawerWillOpen:" },
+    { 0xaab0980e1e4fe724ULL, "_selectTextWithRange:" },
+    { 0x92c87edf2bce3ce5ULL, "_undoManagerDidCloseGroup:" },
+    { 0x581ec0e6b20e45d0ULL, "reusesColumns" },
+    { 0x348d44aeaa337bf8ULL, "encodeKey:indent:" },
+    { 0x1bff9be104261bb5ULL, "canBecomeVisibleWithoutLogin" },
+    { 0x4bff971a39c9db4bULL, "download:didFailWithError:" },
+    { 0xc3d0c186896f22eeULL, "updateInsertionPointStateAndRestartTimer:" },
+    { 0x25a63ca7145151feULL, "isVerticallyResizable" },
+    { 0x62bcb20108fdc388ULL, "outlineViewSelectionDidChange:" },
+    { 0x89f15386543809acULL, "_selector_savePanelDidEnd:returnCode:contextInfo:" },
+    { 0x107563cf42b4733fULL, "boundingRectForGlyph:" },
+    { 0x754e5bf1847bec8eULL, "noteSelectionDidChange" },
+    { 0x789625ff2f51f573ULL, "drawAttributedMenuItemText:inRect:enabled:selected:" },
+    { 0xb4bd4b8afcb87320ULL, "checkString:range:types:options:inSpellDocumentWithTag:orthography:wordCount:" },
+    { 0x8d896ef2a0228fafULL, "selectColumn:byExtendingSelection:" },
+    { 0x22b2204ca1d93278ULL, "outputFormat" },
+    { 0xfd22a9c498b41cbaULL, "drawPartId:stateId:uxthClassId:inRect:" },
+    { 0xe8e6d6a4365a7dafULL, "setSelectedFont:isMultiple:" },
+    { 0x301c80664ace74e6ULL, "dateFromElement:" },
+    { 0, NULL },
+    { 0xcdac06e81d4c94f5ULL, "highlightSelectionInClipRect:" },
+    { 0xa9bf109a9775b049ULL, "setWarningValue:" },
+    { 0xa270d739b2f4d9cbULL, "filenameExtension:isValidForType:" },
+    { 0x11999847b58b897dULL, "changeCount" },
+    { 0, NULL },
+    { 0x8e1bf6b90ac8a00aULL, "currentString" },
+    { 0, NULL },
+    { 0x327aede528c03ac0ULL, "drawerWindowDidActivate:" },
+    { 0xbdbeb747caf132d6ULL, "ignoredWordsInSpellDocumentWithTag:" },
+    { 0x2f2a252df12e1d47ULL, "draggedImage:movedTo:" },
+    { 0x8159f35873d7b679ULL, "setCalendar:" },
+    { 0x34556bdbd2fb18eaULL, "setWorksWhenModal:" },
+    { 0xb4b9618e9bf668c7ULL, "callStackSymbols" },
+    { 0x7f80be3531d4c460ULL, "checkMarkMargins" },
+    { 0x6bbb551cef98a7b2ULL, "sharedStringDrawer" },
+    { 0x797f1c5162179ab5ULL, "_parentWindowDidClose:" },
+    { 0, NULL },
+    { 0x6f9b4528ffe915ebULL, "_subviewsInDisplayOrderEnumerator" },
+    { 0xe9c69213c74c66e7ULL, "initWithPath:" },
+    { 0x8bc0372dc2204b41ULL, "_soundUnfilteredFileTypes" },
+    { 0x3d895d63bf6f9d42ULL, "scrollLineDown:" },
+    { 0x9eef5487f003bfc9ULL, "needsDisplay" },
+    { 0x0ef1a115b3e74a8dULL, "setTailIndent:" },
+    { 0x63f1f84a3ef3c75fULL, "makeWindowsPerform:inOrder:" },
+    { 0, NULL },
+    { 0xb3ec832a842c98c7ULL, "_createTrayIcon" },
+    { 0, NULL },
+    { 0x1eb92bd6e5866d0cULL, "selectsInsertedObjects" },
+    { 0x33047b91a26085f9ULL, "usesRuler" },
+    { 0xc38af9dc75718b37ULL, "_kvo_operator_max:" },
+    { 0xc01eea482ebf1c3cULL, "setHeaderView:" },
+    { 0xd3ff51824367417aULL, "deleteGlyphsInRange:" },
+    { 0x3cda8ba28a3e225dULL, "parser:validationErrorOccurred:" },
+    { 0xe126300c8ae5a5e4ULL, "saveAllDocuments:" },
+    { 0xc30e75584b58ee36ULL, "saveDocumentTo:" },
+    { 0x227c2b2b8a683e38ULL, "socketInputSourceWithSocket:" },
+    { 0x834f98e464a6a861ULL, "raise:format:arguments:" },
+    { 0x2258893f26977ea6ULL, "adjustPageHeightNew:top:bottom:limit:" },
+    { 0x6470c6d2988c79abULL, "setCompletionDelay:" },
+    { 0xb0fa6a7319fcae19ULL, "openGLContext" },
+    { 0x177aa6603d03daa2ULL, "windowDeviceContext" },
+    { 0, NULL },
+    { 0xdd8345edd1c1ec0fULL, "completionsForPartialWordRange:indexOfSelectedItem:" },
+    { 0xb8564c9c72cd334cULL, "traits" },
+    { 0, NULL },
+    { 0x6b67daacbf71ebd5ULL, "soundUnfilteredFileTypes" },
+    { 0x2858c7244493814dULL, "discardCachedImage" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd226df533aaf2baaULL, "displayPoofImageAtIndex:" },
+    { 0, NULL },
+    { 0x917985600aa3b3a4ULL, "rightExpression" },
+    { 0xad1af18811d1cf9dULL, "range" },
+    { 0x534c6289ed2612e8ULL, "pixelBufferCubeMapFace" },
+    { 0xfa3e7a4f1a86c9a6ULL, "leftMargin" },
+    { 0x67d46c250161e494ULL, "canonicalXMLStringPreservingComments:" },
+    { 0x30b59281a1b868e8ULL, "setMinimumLineHeight:" },
+    { 0x024cee3918f9a4ddULL, "addFileWrapper:" },
+    { 0, NULL },
+    { 0x4a8076a9869e03f4ULL, "hidesOnDeactivate" },
+    { 0x23f7937b7b93e165ULL, "removeIndexesInRange:" },
+    { 0x3f720c8ea3bd0d01ULL, "sheetDidEnd:returnCode:contextInfo:" },
+    { 0x4f0b410d598525e1ULL, "outlineView:shouldSelectTableColumn:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3555c15d7b6116acULL, "animationDidStop:" },
+    { 0, NULL },
+    { 0x938a2ee090dd048eULL, "highlightCell:atRow:column:" },
+    { 0x7367e9233e9a7dc6ULL, "operand" },
+    { 0x92694c7ff909ecc0ULL, "toolTip" },
+    { 0x30887a2adf99334fULL, "setHelpAnchor:" },
+    { 0x9b628b824b8c03a0ULL, "setPublicID:" },
+    { 0x1f65871960d43b5aULL, "setCurrentActivity:" },
+    { 0xa54243385ca7992dULL, "addInputSource:" },
+    { 0xbe4772448890c6b6ULL, "setOriginOffset:" },
+    { 0xf99604d73f851de2ULL, "contentSizeForItem:" },
+    { 0x32dee3cdcd8c9b88ULL, "lastVisibleColumn" },
+    { 0x789ac067d824be5dULL, "getIndexes:" },
+    { 0x6743c2974b93c9caULL, "textureMaxMipMapLevel" },
+    { 0x8b8b3de5d7b4f102ULL, "perform" },
+    { 0, NULL },
+    { 0x051b76a3841dc5ffULL, "drawImage:withFrame:inView:" },
+    { 0x42cf04ac0ab346f3ULL, "lineRangeForRange:" },
+    { 0x754913b52fe3a027ULL, "windowControllers" },
+    { 0x6dacda2afcc523a3ULL, "_setSheetOriginAndFront" },
+    { 0x4f6e8b218228255eULL, "currentTextContainer" },
+    { 0x15bc2c58198ca455ULL, "textLists" },
+    { 0xee038cfc812769cbULL, "verticalScroller" },
+    { 0xc164e70dedc6d4edULL, "initWithFrame:pixelFormat:" },
+    { 0x7382c0d011f95fd1ULL, "drawMenuBranchArrowInRect:enabled:selected:" },
+    { 0xbb9a8da49b9a821bULL, "showValue:" },
+    { 0x9c122264c44eb585ULL, "openHelpAnchor:inBook:" },
+    { 0xb6163dd71ada45bfULL, "findApplications" },
+    { 0x5a8f2fbef8d33d6bULL, "canCloseDocumentWithDelegate:shouldCloseSelector:contextInfo:" },
+    { 0x0f108a05bf0a2b3fULL, "knownTimeZoneNames" },
+    { 0, NULL },
+    { 0x2f35df4f0a881a3fULL, "pasteboard" },
+    { 0x8cd93e822d255241ULL, "sliderType" },
+    { 0xc87ce850a0021ecfULL, "makeCurrentContext" },
+    { 0x99457dfdb645cc6aULL, "preferredLanguages" },
+    { 0, NULL },
+    { 0x409fa65492902a81ULL, "unhideWithoutActivation" },
+    { 0x2c16b85cd8935355ULL, "validateToolbarItem:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x12e36fa296ec6e5bULL, "receiverWithSession:" },
+    { 0x43bcbc8a5dedce48ULL, "URLByResolvingSymlinksInPath" },
+    { 0x1528443c44ede04fULL, "rightTabMarkerWithRulerView:location:" },
+    { 0x06780af8f4279fe6ULL, "fontName" },
+    { 0x5123f84bbd177d99ULL, "lockDate" },
+    { 0xb9fc466fb73c06a9ULL, "learnWord:" },
+    { 0x57834d0aa1d6196cULL, "beginModalSessionForWindow:" },
+    { 0xee65664cf4a63d5eULL, "rectForPage:" },
+    { 0, NULL },
+    { 0xf8d00cb950f58177ULL, "second" },
+    { 0xf3c8f9bfe818797cULL, "address" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x48ff08e51615a7fbULL, "contentAspectRatio" },
+    { 0x311ff3c28e8f4248ULL, "_extractObject" },
+    { 0x204cedb362b9315fULL, "highlightedBranchImage" },
+    { 0, NULL },
+    { 0xf9765ca5bfc14402ULL, "automaticallyPreparesContent" },
+    { 0x6c855b83fd14a879ULL, "insertItemWithItemIdentifier:atIndex:" },
+    { 0x74a7246394f10aacULL, "setTextAlignment:" },
+    { 0x3df1cf0f887e4246ULL, "clearStartAnimation" },
+    { 0x8063fcd27e15dab3ULL, "hyphenationFactor" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x14133ef1cded6ae7ULL, "hasBytesAvailable" },
+    { 0x45558d0e92c491dbULL, "collapsesBorders" },
+    { 0, NULL },
+    { 0xba7cc9350ea591d2ULL, "replaceObjectsInRange:withObjectsFromArray:" },
+    { 0xa70030fd8ccad50cULL, "titleBarFontOfSize:" },
+    { 0xe4b7c1b37d00b19fULL, "indexOfTickMarkAtPoint:" },
+    { 0, NULL },
+    { 0x8dc84cef8f41b213ULL, "setUpPrintOperationDefaultValues" },
+    { 0x385f127b9147438dULL, "makeCurrentWithGLContext:" },
+    { 0, NULL },
+    { 0xa55cb325dcae2ab4ULL, "canSelectPrevious" },
+    { 0x07552bd0ef068e66ULL, "URLProtocol:didReceiveAuthenticationChallenge:" },
+    { 0xadacc5f872fecd07ULL, "setImage:forSegment:" },
+    { 0xd9b724d6731bfff7ULL, "localizedStringForStatusCode:" },
+    { 0xc80cef4272901281ULL, "_setRepresentedObject:" },
+    { 0, NULL },
+    { 0x70c14bde36d45ca6ULL, "validateEditing" },
+    { 0, NULL },
+    { 0xc2b640711e9d4ffdULL, "decimalNumberByMultiplyingBy:withBehavior:" },
+    { 0x39e8d7bfc71cb327ULL, "resumeData" },
+    { 0x93b2581762e21808ULL, "setCurrentPage:" },
+    { 0x9ab30e53fbfc5bdaULL, "cacheDisplayInRect:toBitmapImageRep:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1011a384516411eaULL, "resolvePrefixForNamespaceURI:" },
+    { 0x64e59ac0043b4130ULL, "selectWithFrame:inView:editor:delegate:start:length:" },
+    { 0x55d23f0e0dc9cc53ULL, "volatileDomainForName:" },
+    { 0x85e37a1763be2ce3ULL, "nextElement" },
+    { 0x272365ef237a8405ULL, "data2" },
+    { 0xbfb0e52d59acc2adULL, "createCGContextIfNeeded" },
+    { 0, NULL },
+    { 0xf3393cbc43c0fef8ULL, "setRequiredFileType:" },
+    { 0x50384d7a68ffcc3cULL, "itemIndexForPoint:" },
+    { 0xcea96201ed6b73d8ULL, "handleFailureInMethod:object:file:lineNumber:description:" },
+    { 0x0c141f684f027662ULL, "_syncSlidersToNewColor" },
+    { 0, NULL },
+    { 0x3079ff909cc5b7a7ULL, "lookInDirectories" },
+    { 0xfce5340a5a33f67cULL, "windowTitleForDocumentDisplayName:" },
+    { 0xd22641bb479818ceULL, "endLineWithGlyphRange:" },
+    { 0xa3c3ff47e53186cfULL, "drawParts" },
+    { 0, NULL },
+    { 0xb099b3b563eff730ULL, "startPeriodicEventsAfterDelay:withPeriod:" },
+    { 0xbdea45e320f6fa52ULL, "setNeedsDisplay:" },
+    { 0x7cfc45ec02d91e0eULL, "pathForResource:ofType:" },
+    { 0xa25095d1b4a70871ULL, "isSetOnMouseEntered" },
+    { 0x758bfd57c28495a3ULL, "subarrayWithRange:" },
+    { 0x178c4dc8e30b6521ULL, "movePath:toPath:handler:" },
+    { 0xc89f3569974a771aULL, "selectComponentUnderPoint:inView:" },
+    { 0x753a310dc5070e3eULL, "setTitleWidth:" },
+    { 0xf5aa0f04ea62b9a2ULL, "transformBezierPath:" },
+    { 0x5a7d9f21bf2f168eULL, "drawTabViewBackgroundInRect:" },
+    { 0x142e98c0c48ad2baULL, "isPartialStringValid:newEditingString:errorDescription:" },
+    { 0, NULL },
+    { 0x410f7daa54250d9dULL, "treatsFilePackagesAsDirectories" },
+    { 0xa48c9c52a1dfdf17ULL, "isSeparatorItem" },
+    { 0xdbfef97d613094e7ULL, "_removeLayerBackedViewsFromTree" },
+    { 0x78869f50d5f1cb79ULL, "name" },
+    { 0x78f63d99eb696c4fULL, "changeWindowStyle" },
+    { 0x6a9ca074d0f0f000ULL, "GetCanonicalFormatEtc::" },
+    { 0x19a949dd31d11c35ULL, "readFromURL:ofType:error:" },
+    { 0xd185f76208b90371ULL, "mainThread" },
+    { 0xe8015d2ee48c8762ULL, "boundsRotation" },
+    { 0, NULL },
+    { 0x36bd61e0abf5da4cULL, "showPackedGlyphs:length:glyphRange:atPoint:font:color:printingAdjustment:" },
+    { 0x0aff1cd91d84e4adULL, "textShouldBeginEditing:" },
+    { 0x31eb15418a0635eaULL, "decodeArrayOfFloats:forKey:" },
+    { 0x3383fa48f9d4d3ceULL, "DragOver:::" },
+    { 0x2a6dbe05dc5a0755ULL, "sharedHelpManager" },
+    { 0, NULL },
+    { 0x9e386f1b700e8da9ULL, "_drawTexturedBezelWithFrame:" },
+    { 0x7527d68a0efc0e19ULL, "setFormatEtcs:" },
+    { 0xfc625899d3128b80ULL, "queuePriority" },
+    { 0xcd3084c0c5cac7f3ULL, "descriptionWithCalendarFormat:timeZone:locale:" },
+    { 0x8e8c6795eec35b40ULL, "runOperation" },
+    { 0xb5f44ab5202b4b5aULL, "drawInteriorWithFrame:inView:" },
+    { 0x3e84307312e1584cULL, "windowControllerWillLoadNib:" },
+    { 0xa5818b044fab34bbULL, "dataFromBase64String:" },
+    { 0xa5c5d46cf72e5878ULL, "fileManager:shouldProceedAfterError:copyingItemAtPath:toPath:" },
+    { 0xc973a2bab53f7526ULL, "fileSystemRepresentation" },
+    { 0xa8926d1955038fe4ULL, "allowsEditingForRow:" },
+    { 0x051c98a63fb09ec8ULL, "setDocument:" },
+    { 0x87855ef8ae417009ULL, "setLeafPathKey:" },
+    { 0x1b3771cb4cc5ad0aULL, "predefinedEntityDeclarationForName:" },
+    { 0xb561ce86777cf6daULL, "addOperations:waitUntilFinished:" },
+    { 0, NULL },
+    { 0x244b577daf5a2b28ULL, "setThreadPriority:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1a9318fd3ebe57dbULL, "labelFontSize" },
+    { 0x56d092e8df0117d6ULL, "toolTipsFontOfSize:" },
+    { 0x405657da5b237a37ULL, "control:textShouldBeginEditing:" },
+    { 0xbc97f019efd4a715ULL, "textView:shouldChangeTextInRange:replacementString:" },
+    { 0x04c26ef0771a8b72ULL, "runToolbarCustomizationPalette:" },
+    { 0x6477b69b97ca0850ULL, "bytesPerRow" },
+    { 0, NULL },
+    { 0xa6d44b4c136020b3ULL, "request" },
+    { 0xac1c5f6db94999d0ULL, "lockWithPath:" },
+    { 0x8248f00bd7ae220eULL, "segmentStyle" },
+    { 0, NULL },
+    { 0xc748fd3b56aa68f7ULL, "_currentLanguage" },
+    { 0, NULL },
+    { 0x7572f2c831c8c099ULL, "setCanCreateDirectories:" },
+    { 0x10335f887cc6b842ULL, "ruleThickness" },
+    { 0xa9fc25dc3f773635ULL, "shouldChangeTextInRange:replacementString:" },
+    { 0x1b0bede7d518a618ULL, "addChild:" },
+    { 0xcd7743fda4c4e3bfULL, "windowShouldZoom:toFrame:" },
+    { 0xc9b74b8a73dadaf2ULL, "connection" },
+    { 0xe349362f0fa0c18aULL, "weekdayOrdinal" },
+    { 0x638ca3e7ff0cc25fULL, "extraTitleGutterMargin" },
+    { 0xbe36f0e877f0cc90ULL, "_removeFromModes" },
+    { 0, NULL },
+    { 0x1db35f63632c4528ULL, "expandItem:expandChildren:" },
+    { 0x62798b2f95a06ddeULL, "emptyElementTag" },
+    { 0x4ec91c4b8efddf81ULL, "_dragHitTest:" },
+    { 0, NULL },
+    { 0x8b1da601e0a0f48dULL, "removeDependency:" },
+    { 0x02b6a532de190cb7ULL, "canInitWithRequest:" },
+    { 0x8d8b25611623e5d5ULL, "doubleForKey:" },
+    { 0xd8a809a8132e9dbdULL, "setAutoscroll:" },
+    { 0xbdc32f1447152423ULL, "moveBackward:" },
+    { 0, NULL },
+    { 0x214c7fbf4fd83021ULL, "isReadableFileAtPath:" },
+    { 0, NULL },
+    { 0xf53a9a5497e65219ULL, "currentModifierFlagsWithKeyboardState:" },
+    { 0x7dc08f894a192df5ULL, "toolbarItems" },
+    { 0, NULL },
+    { 0x3b46f6cfcfb0b3f5ULL, "awakeFromNib" },
+    { 0x8819f3cfd6ea3425ULL, "selectedSegment" },
+    { 0x53fe4a4cae269ad6ULL, "userPreferredLanguages" },
+    { 0x279dd62bbc269a55ULL, "printDocument:" },
+    { 0x1990564e0e6bfbf0ULL, "decimalNumberByMultiplyingBy:" },
+    { 0x30b14201a0a6d7d2ULL, "precomposedStringWithCanonicalMapping" },
+    { 0xf2414e6d46a70ab4ULL, "transformSize:" },
+    { 0, NULL },
+    { 0x81840dea1b0cac58ULL, "requiredThickness" },
+    { 0xcad08bc4f97fd8c5ULL, "updateCell:" },
+    { 0x7fa78f7ff4dc869eULL, "state" },
+    { 0x561fc5cf895f92a0ULL, "styleMask" },
+    { 0xefd711e577fa98b0ULL, "platformWindowWillBeginSizing:" },
+    { 0, NULL },
+    { 0x2cdd8316d8c14cdaULL, "familyName" },
+    { 0xaedaf8b88adad433ULL, "scanFloat:" },
+    { 0xa11190a21f8ef0e9ULL, "destroyWindowHandle" },
+    { 0xbc185a073d9cd9c9ULL, "formatterBehavior" },
+    { 0x54987a0dd093a17cULL, "doCommandBySelector:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb57e69d79a3edadaULL, "isBordered" },
+    { 0xc9f1101f21058cfcULL, "setAttributesAsDictionary:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5f37bf86adc09752ULL, "isHighlighted" },
+    { 0xcbfc15d338624595ULL, "registerClass:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x83d31de6ee1ef7efULL, "tableView:shouldSelectRow:" },
+    { 0x2ef95f720998bc16ULL, "outlineViewItemWillCollapse:" },
+    { 0xd4e48dcf872e13cfULL, "readFromData:ofType:error:" },
+    { 0xea0b0da8462a4c5cULL, "invokeWithTarget:" },
+    { 0, NULL },
+    { 0x016346f06621464bULL, "_cornerView" },
+    { 0, NULL },
+    { 0x1b7d8762180bb9e6ULL, "popUpStatusItemMenu:" },
+    { 0xee187cf9ebeca355ULL, "encodeBytes:length:" },
+    { 0x62703c0e5d72841aULL, "valueForPartId:stateId:propId:uxthClassId:value:" },
+    { 0x7e897b350ae029b9ULL, "controllerWillChange" },
+    { 0x7bd0bf7ffb1fa153ULL, "leading" },
+    { 0x5612110d45818a0bULL, "setSearchMenuTemplate:" },
+    { 0x0980af1724bf98fcULL, "hide:" },
+    { 0x42836f45b6f2a31dULL, "maxNumberOfRows" },
+    { 0xe198ed0fcc75a3baULL, "timeZone" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8f5d5fdfc92b7ce2ULL, "setAltIncrementValue:" },
+    { 0x6035e869f14ff807ULL, "convertRect:toView:" },
+    { 0x510e24f0a94ed877ULL, "learn:" },
+    { 0x7ae00a2fd56265d0ULL, "KVO_notifying_change_removeKeyObject:" },
+    { 0x9b0011b41f72cc1aULL, "encodeString:escape:" },
+    { 0x7a690f630b8e193bULL, "prependTransform:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe13c33f107e6e9c8ULL, "_stringAttributes" },
+    { 0x6e1ce965b59fa411ULL, "registeredImageRepClasses" },
+    { 0xf88a81dee30b3479ULL, "supportsMode:" },
+    { 0x519a37d2e95d1cb7ULL, "symbolicLinkDestination" },
+    { 0x5fb694b7667d5665ULL, "setImageOrigin:" },
+    { 0x1c0dc6015aee3779ULL, "drawerWindowDidResize:" },
+    { 0xd7b2c622ca578b83ULL, "controlTextDidEndEditing:" },
+    { 0, NULL },
+    { 0xc8e6f32efcec8c71ULL, "setPartialStringValidationEnabled:" },
+    { 0, NULL },
+    { 0xf54668010f3ef820ULL, "drawRepresentation:inRect:" },
+    { 0x9cc82668e79dd192ULL, "rulerView:shouldRemoveMarker:" },
+    { 0x915306199bf16b6fULL, "draw" },
+    { 0x36bee284e3b52e09ULL, "paperName" },
+    { 0xc5e206d8b8b3bd3eULL, "resetSearchButtonCell" },
+    { 0x4320223540567cdcULL, "notationName" },
+    { 0xe7dd1f7a95aec451ULL, "shouldBreakLineByHyphenatingBeforeCharacterAtIndex:" },
+    { 0x44d061921ebeed1dULL, "datePickerStyle" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x93ba0283049bb7a0ULL, "precomposedStringWithCompatibilityMapping" },
+    { 0xcb1cb5e64d0d0528ULL, "frameOfDecrementPage" },
+    { 0x52db8348ee9484d2ULL, "startingInMode:" },
+    { 0xa830d0b9e16ae2d3ULL, "draggingDestinationWindow" },
+    { 0x870115e7cfaa07fbULL, "KVO_notifying_change_removeObjectForKey:" },
+    { 0x8b77ba886fdf6936ULL, "drawOutlineViewGridInRect:" },
+    { 0, NULL },
+    { 0xc88aa73facc1e09cULL, "setUsesScreenFonts:" },
+    { 0x30f352db06fff3daULL, "stepDownCycle" },
+    { 0x4598bd1082717159ULL, "setAcceptsMouseMovedEvents:" },
+    { 0xdf2a1385aee79ef2ULL, "inLiveResize" },
+    { 0, NULL },
+    { 0x0b1c0172d45ae2a0ULL, "string" },
+    { 0, NULL },
+    { 0xf0ca7098045721adULL, "processEditing" },
+    { 0x61ac0d63cb96a5c8ULL, "toggleContinuousSpellChecking:" },
+    { 0xc07ea662194ea341ULL, "developmentLocalization" },
+    { 0x1d2954d896dd80d6ULL, "platformWindow:frameChanged:didSize:" },
+    { 0x77cd354f1abf4f5cULL, "boundingRect" },
+    { 0, NULL },
+    { 0xdda4f76860775a2aULL, "keyBindingWithString:modifierFlags:" },
+    { 0xef9900705bfa2b25ULL, "encodeBycopyObject:" },
+    { 0xa74cce4598516973ULL, "messageFontOfSize:" },
+    { 0xc1c2b6060cbacd30ULL, "disableCursorRects" },
+    { 0xb9bb0eaf7a641bcdULL, "setURI:" },
+    { 0x46efad7c9fc9b57cULL, "overflowImage" },
+    { 0x926144972c29fc05ULL, "rectArrayForCharacterRange:withinSelectedCharacterRange:inTextContainer:rectCount:" },
+    { 0x2845d0f9752204bdULL, "storagePolicy" },
+    { 0, NULL },
+    { 0x3cc2f90d65fc519dULL, "redo:" },
+    { 0xfcdadbea87fa3673ULL, "deepestScreen" },
+    { 0x3b5d6a51cfc80f2aULL, "cellBaselineOffset" },
+    { 0xeb3d682d5e446166ULL, "dataFromRange:documentAttributes:error:" },
+    { 0x697bba4d879475aaULL, "convertFont:toNotHaveTrait:" },
+    { 0x1866f2e2150f31e5ULL, "parser:foundElementDeclarationWithName:model:" },
+    { 0x6710b0d08443cee9ULL, "contentDictionary" },
+    { 0x0262a0394f0286bbULL, "displayNameForKey:value:" },
+    { 0x5fce2996ef1febb6ULL, "unlock" },
+    { 0xeb96543c14f46508ULL, "initWithContentsOfFile:byReference:" },
+    { 0xc43c56614ec36ad5ULL, "abortDocument" },
+    { 0xa6e36a578cc58958ULL, "HTTPShouldHandleCookies" },
+    { 0xa00c1ac46ad8a9f9ULL, "searchButtonRectForBounds:" },
+    { 0x87e8137ed709b90aULL, "provideNewButtonImage" },
+    { 0, NULL },
+    { 0x0971bef2c6e3f2e4ULL, "seperatorWidth" },
+    { 0xb182041b9d74fb22ULL, "scaleXBy:yBy:" },
+    { 0x7a8c730f549f06daULL, "waitForSelectWithOutputSet:beforeDate:" },
+    { 0x5bacad78e1155643ULL, "localizedRecoverySuggestion" },
+    { 0xabd349b8f72c7d52ULL, "setHyphenationFactor:" },
+    { 0x276843d20ee33467ULL, "fileManager:willProcessPath:" },
+    { 0x17949ffb4d2e890fULL, "clearColor" },
+    { 0xccd356a9bdcd52b3ULL, "_replaceCharactersInRange:withString:" },
+    { 0x63fde60c34ed3d2aULL, "maximumFractionDigits" },
+    { 0, NULL },
+    { 0x1f6fe01af6d69aa2ULL, "defaultDepthLimit" },
+    { 0xa5a02f5fc0432708ULL, "setCurrentContext:" },
+    { 0, NULL },
+    { 0x4b1d6328b080fa2dULL, "sizeValue" },
+    { 0xa0d4166922042fcfULL, "entityRef:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x48cb2f06ba58f731ULL, "unscheduleFromRunLoop:forMode:" },
+    { 0xebf24b01814d3ac1ULL, "nextResponder" },
+    { 0x7e205e9236184863ULL, "pixelsWide" },
+    { 0x4134b9eda2444842ULL, "buildConnectionsWithNameTable:" },
+    { 0x9337ecd72e8f1991ULL, "setBottomMargin:" },
+    { 0x55882c7d439e2922ULL, "_currentGlyphRangeForTextContainer:" },
+    { 0x6ce24be7db029aa9ULL, "menuItemGutterGap" },
+    { 0x7fffba6f111fe453ULL, "slideDraggedImageTo:" },
+    { 0xd9e1109c91570d64ULL, "persistentStoreTypeForFileType:" },
+    { 0xb3cba015c6593756ULL, "orPredicateWithSubpredicates:" },
+    { 0, NULL },
+    { 0xd5977f727fe10253ULL, "hostWithName:" },
+    { 0xe3030f1f700d586eULL, "_trayNotificationForID:event:" },
+    { 0x081a0982241a3b65ULL, "function" },
+    { 0x9075b9432869e044ULL, "stepInterval" },
+    { 0x8b85275f81319df8ULL, "userData" },
+    { 0x6c7939a500710de8ULL, "pasteRuler:" },
+    { 0xc22da90600b02b1aULL, "windowWillReturnUndoManager:" },
+    { 0x43bd4532305b32deULL, "setState:atRow:column:" },
+    { 0xb7fdcaa84f6b1de9ULL, "_continuousSpellCheck" },
+    { 0x62abcd49c39e9cc6ULL, "URLForResource:withExtension:subdirectory:" },
+    { 0xa94afd7f94082502ULL, "scanUpToString:intoString:" },
+    { 0x3841bf7ed9fe3ab2ULL, "setDatePickerStyle:" },
+    { 0xf55a121add172037ULL, "credentialWithUser:password:persistence:" },
+    { 0x33eea33fd5446969ULL, "selectionIndexPath" },
+    { 0x991fd65f809c6408ULL, "drawFromCenter:radius:toCenter:radius:options:" },
+    { 0, NULL },
+    { 0x1086fd83272fedfcULL, "setShouldCloseDocument:" },
+    { 0x7ea871f9873c3a13ULL, "pointSize" },
+    { 0xcbe5fbea08449fc5ULL, "deleteWordBackward:" },
+    { 0x8881026097c798e4ULL, "flashWindow" },
+    { 0xbb2b80b76adbcb97ULL, "imageRepsWithData:" },
+    { 0xc9367844b04601c0ULL, "bestRepresentationForDevice:" },
+    { 0x8599d18ad88c8efdULL, "_checkAndGetPWEnt" },
+    { 0xc2dafa8b88a5a1c1ULL, "outlineView:willDisplayCell:forTableColumn:item:" },
+    { 0xf5fc746cd7990465ULL, "setProperty:forKey:inRequest:" },
+    { 0, NULL },
+    { 0xb582b1497b5e2bb7ULL, "gState" },
+    { 0x4f4bbf3a910d30c0ULL, "wakeUp" },
+    { 0xc9d4351ffb1552bcULL, "performKeyEquivalent:" },
+    { 0x1a5d3605c3d62134ULL, "didAddSubview:" },
+    { 0x5708b99c7efa4d55ULL, "dominantLanguage" },
+    { 0x12f5d0380e2b9a5fULL, "msg" },
+    { 0x2fc9e080dccfdbfdULL, "writeToURL:ofType:forSaveOperation:originalContentsURL:error:" },
+    { 0xd80ad3df80b9b985ULL, "_verticalScroll:" },
+    { 0x581b4847c0abefceULL, "propertyListFromContentsOfElement:" },
+    { 0, NULL },
+    { 0xc323dd1250adb08bULL, "_windowWillClose:" },
+    { 0x24b4b5121d14d7faULL, "collectionView" },
+    { 0x38ecb22ce8a3cf93ULL, "borderType" },
+    { 0xc65a6b0953fbb482ULL, "_toolbarSizeDidChangeFromOldHeight:" },
+    { 0x93e0bb123da06392ULL, "desiredSize" },
+    { 0x77dcb2096b26eadeULL, "availableMembersOfFontFamily:" },
+    { 0xde8a2cf71b5ff46cULL, "setAnimationDelegate:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4917bb209939f1e0ULL, "numberOfArguments" },
+    { 0, NULL },
+    { 0x690bb6743e8c068cULL, "menuItemTextSize:" },
+    { 0x2db88df28730e91bULL, "screens" },
+    { 0xd97cb03a975ab998ULL, "isRowSelected:" },
+    { 0x513e5bbac8663af7ULL, "showHelp:" },
+    { 0x593fa0ef819cf53bULL, "pathComponentCellAtPoint:withFrame:inView:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xcc2c0e96e4d5d25bULL, "predicateFormat" },
+    { 0xabcf56691afa1b8cULL, "URLProtocol:didLoadData:" },
+    { 0x2c8154a6fd8a69c8ULL, "setImageInterpolation:" },
+    { 0x2eb1c8071ed88fd9ULL, "main" },
+    { 0, NULL },
+    { 0x20209ab28a264f20ULL, "run" },
+    { 0x3253bd7e889f90f7ULL, "platformWindow:needsDisplayInRect:" },
+    { 0xab228d6961d55783ULL, "worksWhenModal" },
+    { 0, NULL },
+    { 0x2d45dd0290da8c52ULL, "_extractDataDouble" },
+    { 0, NULL },
+    { 0xe3194af81489de91ULL, "attributeForName:" },
+    { 0xf3bc2f7e68b72090ULL, "setGridColor:" },
+    { 0x778f9cc1123bac0cULL, "titleWidth" },
+    { 0, NULL },
+    { 0x5acca3bd2714f6efULL, "setLineWidth:" },
+    { 0x8673d31d847ace0fULL, "_appendWordTwo:" },
+    { 0xf66c99208cf6e6b2ULL, "titleOfSelectedItem" },
+    { 0x97946bbefe8f469dULL, "isKeyWindow" },
+    { 0x087fb1d203c3d617ULL, "textStorageWillProcessEditing:" },
+    { 0x047906133ef75b77ULL, "_trackAddMarker:" },
+    { 0xde054f6f9ad5aa67ULL, "registerDefaults:" },
+    { 0x346e27f3dfde7019ULL, "encodeDouble:forKey:" },
+    { 0x9eec4d073c0ba771ULL, "_separatedStringIfNeededWithString:" },
+    { 0x09bfb8ac469aa947ULL, "numberWithUnsignedShort:" },
+    { 0x227e84295b3a4972ULL, "rulerView:shouldMoveMarker:" },
+    { 0x4992da6173e18604ULL, "alignment" },
+    { 0xdaf941ac5ab93263ULL, "setShouldAntialias:" },
+    { 0xfe628584091ae6d1ULL, "platformWindowWillClose:" },
+    { 0x1856bcf24d7873c0ULL, "_updateTypingAttributes" },
+    { 0x69db54343415a76eULL, "tableViewSelectionDidChange:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x720e06431f08578aULL, "platformWindowIgnoreModalMessages:" },
+    { 0xf80063ba3578ef59ULL, "classForArchiver" },
+    { 0x13acb5a2d6a63d7bULL, "parser:foundCharacters:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x788d9495f727d94aULL, "setTextView:" },
+    { 0xe77349392cd56211ULL, "setTitleWithRepresentedFilename:" },
+    { 0xdd4ab5a528b6b4daULL, "unlockFocus" },
+    { 0x7a3822f0dadbef04ULL, "pathForResourceFile:inDirectory:" },
+    { 0xce570f08b5221c33ULL, "dataSource" },
+    { 0x5ddeddbeee4a332aULL, "attemptRecoveryFromError:optionIndex:" },
+    { 0x0fd870c92cea5b9eULL, "classForKeyedUnarchiver" },
+    { 0xfafb0e82d75b552eULL, "miniwindowTitle" },
+    { 0, NULL },
+    { 0x7a1961bfa30fc604ULL, "decodeSize" },
+    { 0x305a978215df53a9ULL, "spellCheckerDocumentTag" },
+    { 0xb2378221649d2160ULL, "secondarySelectedControlColor" },
+    { 0x6d16b6b912acf255ULL, "_workThread" },
+    { 0x1bdde46ca3d573c1ULL, "titleRectForItem:previousBorderRect:" },
+    { 0xc4cde61321fbcb1dULL, "titleBaseWritingDirection" },
+    { 0xd1320f930531702eULL, "decimalSeparator" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6bab4a7a5de8bcd9ULL, "canUndo" },
+    { 0xa78707462dde24cbULL, "popElement" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x900de63fca0e41bdULL, "stringForKey:" },
+    { 0, NULL },
+    { 0xc494d1c507950158ULL, "windowsMenu" },
+    { 0xa074b324546cab82ULL, "numberWithInt:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x7809d1282c029392ULL, "usesGroupingSeparator" },
+    { 0x4a74eb8863546750ULL, "_isToolTip" },
+    { 0x79240dce2eb90514ULL, "setFrameAutosaveName:" },
+    { 0xe56d0a36b8ac3984ULL, "one" },
+    { 0xcfabbb7998ccd5f8ULL, "closeAllDocuments" },
+    { 0xd8d05ea9f87bac9dULL, "transform" },
+    { 0xd904649ef69e2e34ULL, "setDefaultMiterLimit:" },
+    { 0x84b643d6da97bd13ULL, "isEditing" },
+    { 0x7556cdd355e2acefULL, "moveToPoint:" },
+    { 0x889ed16c0791b3adULL, "rowHeight" },
+    { 0x1a15c84aed869f07ULL, "fontDescriptorWithSize:" },
+    { 0xf227cfde021f6e82ULL, "setAttachmentCell:" },
+    { 0, NULL },
+    { 0xec1bcc1b8d107f3cULL, "tabViewItems" },
+    { 0x56581ac457f36ae1ULL, "knobColor" },
+    { 0x70478725f04b8224ULL, "itemIndexAtPoint:" },
+    { 0xf862ef5af8c2df45ULL, "inputStream:handleEvent:" },
+    { 0x578498ae7117c0d3ULL, "startObservingChanges" },
+    { 0x6e433d918579114bULL, "ISOLanguageCodes" },
+    { 0xda8e196a49ccbf03ULL, "addInvocationsFromArray:" },
+    { 0x2a0cd2f1c7f81542ULL, "removePort:forMode:" },
+    { 0x5b4d01f1f793c4ccULL, "recordResponse:toCorrection:forWord:language:inSpellDocumentWithTag:" },
+    { 0x8016a289b23287feULL, "_setAndScrollToRange:upstream:" },
+    { 0x419fc26ea9c476b8ULL, "isExecuting" },
+    { 0, NULL },
+    { 0xc3b730f3a7a64ac9ULL, "ordinalityOfUnit:inUnit:forDate:" },
+    { 0x95919cee57dabcf2ULL, "isAnimating" },
+    { 0xe75e6acbbd64e3c2ULL, "deviceContext" },
+    { 0xfbf845c280234bf5ULL, "setTabKeyTraversesCells:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x453fae5dab3d7c2bULL, "setHTTPBodyStream:" },
+    { 0, NULL },
+    { 0x1eb1d6c85934afbcULL, "colorName" },
+    { 0xc3b4ba188fa425dbULL, "directoryContentsAtPath:" },
+    { 0x1c957644ff5498bbULL, "namesOfPromisedFilesDroppedAtDestination:" },
+    { 0, NULL },
+    { 0xcf0b5176e8cbcea4ULL, "_contentSet" },
+    { 0x9165d7820564a035ULL, "insertChild:atIndex:" },
+    { 0x7091f5e890ee6dc1ULL, "threadDictionary" },
+    { 0x1f05f431956a5382ULL, "scrollerWidth" },
+    { 0xac5a245ab3f1d4a1ULL, "isWritableFileAtPath:" },
+    { 0x874dee686f7aa639ULL, "setAutodisplay:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x7c507a9cff8c433cULL, "valueForUndefinedKey:" },
+    { 0x9305d24733c77a3fULL, "tokenizingCharacterSet" },
+    { 0x4bc3b4140a5896adULL, "kind" },
+    { 0, NULL },
+    { 0xbf3a1a71979a1f0aULL, "defaultLineHeightForFont:" },
+    { 0xb85963f948911f5fULL, "stringByAppendingPathExtension:" },
+    { 0x51b58c4387e192c1ULL, "filename" },
+    { 0xf2824398b7b0b6f8ULL, "privateFrameworksPath" },
+    { 0x6532dfbc93a92d55ULL, "setAllowsColumnSelection:" },
+    { 0x18481db043c0a07bULL, "compare:options:" },
+    { 0x3e51df83852a732fULL, "moveLeft:" },
+    { 0x502fc1aad744970cULL, "setColor:" },
+    { 0x4e23465ee5f732f1ULL, "attributeDeclarationForName:elementName:" },
+    { 0xea0d2f807759ab3eULL, "addObject:" },
+    { 0, NULL },
+    { 0x293df0f98e0f99a7ULL, "maxNumberOfColumns" },
+    { 0, NULL },
+    { 0xd5197bb6737eb617ULL, "Reset" },
+    { 0x2b9bb217ce7d8e4eULL, "extraLineFragmentRect" },
+    { 0xb6e654223101e732ULL, "_mainThreadRunModalForWindow:" },
+    { 0, NULL },
+    { 0x598da86e34285905ULL, "lineFragmentRectForProposedRect:sweepDirection:movementDirection:remainingRect:" },
+    { 0xc72010c9b195d355ULL, "openFiles" },
+    { 0xf610cae159cfaa7fULL, "clipToState:" },
+    { 0, NULL },
+    { 0xed64fa2edb7a9e15ULL, "setDateValue:" },
+    { 0x135e55c38cb62656ULL, "setMinusSign:" },
+    { 0xb00b2d56eb35cd5eULL, "cancel:" },
+    { 0xbdbd73e082de5ae0ULL, "_getDataWithWindowsName:registryName:" },
+    { 0xebe462923b251afbULL, "setAutorecalculatesContentBorderThickness:forEdge:" },
+    { 0x01f8079d9bfb19c2ULL, "action" },
+    { 0x75b936e75e6f88ebULL, "applicationShouldTerminate:" },
+    { 0, NULL },
+    { 0xd3dfcb415bd39720ULL, "setShowsApplicationBadge:" },
+    { 0xbe9bc2ba93354f6eULL, "compositeToPoint:fromRect:operation:fraction:" },
+    { 0x050cfe9bbf61f256ULL, "_incrementAndConstrainBy:" },
+    { 0, NULL },
+    { 0x7e765fdee0066cb3ULL, "setBackingType:" },
+    { 0x2b24fb1f9d26256cULL, "constrainFrameRect:toScreen:" },
+    { 0xd27c5535b0dd720dULL, "contentWidthValueType" },
+    { 0x1371c78a876c2765ULL, "removeObjectsAtIndexes:" },
+    { 0x9df4cc19e9fd8fbcULL, "stackSize" },
+    { 0x8b90bec32293b1b2ULL, "selectedRowIndexes" },
+    { 0, NULL },
+    { 0xdcda4d531dd82230ULL, "control:didFailToValidatePartialString:errorDescription:" },
+    { 0x69925a7cac57b78bULL, "intValue" },
+    { 0x7bc029db70d84690ULL, "setTimeInterval:" },
+    { 0x4eb2dd81d5822bceULL, "cancelPerformSelectorsWithTarget:" },
+    { 0x81c48b5fbf50a27dULL, "classNameForClass:" },
+    { 0x4c704a3d0a120292ULL, "miniaturizeAll:" },
+    { 0, NULL },
+    { 0xd0cc8454ebe98fa8ULL, "publish" },
+    { 0x32ce22eae90c3398ULL, "fileName" },
+    { 0, NULL },
+    { 0x2ba81b1387bbc6b3ULL, "pasteboardTypesIntersectTypes:" },
+    { 0x39acc446dae8bc36ULL, "writeSelectionToPasteboard:types:" },
+    { 0x85b1bc107815bb1eULL, "setRemovable:" },
+    { 0, NULL },
+    { 0xb341aef6baa044c4ULL, "createCGImageIfNeeded" },
+    { 0xc3d6b0b896e23d3cULL, "moveUpAndModifySelection:" },
+    { 0xf413da5523d666a2ULL, "wantsLayer" },
+    { 0x9383c4f55d78fff0ULL, "_establishBindingsWithDestinationIfUnbound:" },
+    { 0x2c2fdd889110c845ULL, "hasUndoManager" },
+    { 0x4bf8ca08f871dfd9ULL, "setClientEvents:callBack:context:" },
+    { 0x0d295ca62df14ef9ULL, "makeUntitledDocumentOfType:error:" },
+    { 0x86cd69584e57b057ULL, "performFileOperation:source:destination:files:tag:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc40c23bc303c687dULL, "swapWithMark:" },
+    { 0x59f6dec07179e2c6ULL, "menuItemAttributedTextSize:" },
+    { 0, NULL },
+    { 0xa9511b9c0dd99175ULL, "getGlyphsInRange:glyphs:characterIndexes:glyphInscriptions:elasticBits:" },
+    { 0xc3460e144da8c6a9ULL, "trailingOffset" },
+    { 0, NULL },
+    { 0xc0eb146499a70c2eULL, "delegateShouldSelectRow:" },
+    { 0x4f45df37ef8562d2ULL, "valueWithBytes:objCType:" },
+    { 0x10bf5390a2d79e5fULL, "_insertItem:atIndex:" },
+    { 0, NULL },
+    { 0x2144adba18b610abULL, "WM_SETFOCUS_wParam:lParam:" },
+    { 0x740cbdb09307c265ULL, "_removeAttribute:range:" },
+    { 0xdff9e553c8980b7aULL, "_cachedImageRepCreateIfNeeded" },
+    { 0xd0401be3b090f9a4ULL, "pop" },
+    { 0xa334d87a8afb8956ULL, "beginPrintingWithDocumentName:" },
+    { 0x7171951db2d8debcULL, "overflowImageSizeWithMargins" },
+    { 0xadfe95d9a11cd934ULL, "translateToNibFontName:" },
+    { 0x63bcc7d31795f6d3ULL, "_KVO_buildDependencyUnion" },
+    { 0x844931e4ac6cfafeULL, "managedObjectModel" },
+    { 0xf843392112dde7dfULL, "drawProgressIndicatorDeterminate:clipRect:bezeled:value:" },
+    { 0x618108757d3ceb05ULL, "portForName:host:nameServerPortNumber:" },
+    { 0x4b847af166ff1ce4ULL, "_selectedColor" },
+    { 0, NULL },
+    { 0xe4b9c7ab0d16bc06ULL, "saveDocumentAs:" },
+    { 0, NULL },
+    { 0x46d85933934f1f46ULL, "save" },
+    { 0, NULL },
+    { 0x20e3e77660ee8661ULL, "setAlpha:" },
+    { 0x70adf1baa6238bb4ULL, "URLByAppendingPathComponent:" },
+    { 0, NULL },
+    { 0x679301229ff48b35ULL, "_fontSize" },
+    { 0x49a23be850ad55dcULL, "RTFDFromRange:documentAttributes:" },
+    { 0x6b13f097773f4953ULL, "showGuessPanel:" },
+    { 0, NULL },
+    { 0x8c6ba9de684f4efaULL, "endPage" },
+    { 0xcff9701acad1eb75ULL, "isDisplayedWhenStopped" },
+    { 0xd5ffc96a1cd55a05ULL, "spellServer:suggestCompletionsForPartialWordRange:inString:language:" },
+    { 0x4479ba33ae6279c1ULL, "colorWithCatalogName:colorName:" },
+    { 0x99bf4ceeb079cc04ULL, "_didNotSearch:" },
+    { 0xc75600a85aa392cdULL, "setParagraphSpacing:" },
+    { 0x44aa468704a93d9dULL, "accessoryView" },
+    { 0, NULL },
+    { 0x66d0cdc237b71fedULL, "target" },
+    { 0x19b37dcbea493534ULL, "drawKnob" },
+    { 0, NULL },
+    { 0x05e5a6b54defe793ULL, "updateFromPath:" },
+    { 0x30111bd5cb161dafULL, "isSetOnMouseExited" },
+    { 0x8820d4c12573e54eULL, "getCharacters:forGlyphs:length:" },
+    { 0, NULL },
+    { 0x457bfde7cb3bfbaaULL, "containsAndRemovePeriodicEvents" },
+    { 0xa4b7dcd30b4e74daULL, "setRulerViewClass:" },
+    { 0x360cef73aad15210ULL, "imageRectForBounds:" },
+    { 0xeeb7123b326a8268ULL, "copyRuler:" },
+    { 0xa76e21c685e0a0dbULL, "pullsDown" },
+    { 0x7398be2effc2c6d0ULL, "setAppliesImmediately:" },
+    { 0x964686e267c34f6fULL, "filenameForPattern:" },
+    { 0x9fcf34397155bdb9ULL, "autoresizingMask" },
+    { 0, NULL },
+    { 0xde6d24458289fee3ULL, "unsignedShortValue" },
+    { 0x0dfd7db8850f3581ULL, "MIMEType" },
+    { 0, NULL },
+    { 0xd623b3458ab70b46ULL, "dataForType:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb5329cf23c6264dbULL, "setTextContainer:" },
+    { 0x030d09c4e87b803eULL, "expressionForVariable:" },
+    { 0xb75d7f8cb0f1a666ULL, "setDefaultTimeZone:" },
+    { 0xa516f6b29cd90fc1ULL, "sendBeforeDate:msgid:components:from:reserved:" },
+    { 0x0f9aa78e5cee3e10ULL, "configurePersistentStoreCoordinatorForURL:ofType:modelConfiguration:storeOptions:error:" },
+    { 0x4e3ced583e67073dULL, "setSelectedRanges:" },
+    { 0xaa54ebf99159761aULL, "getNumberOfRows:columns:" },
+    { 0x19c0f21b63a31dd5ULL, "windowDidChangeScreen:" },
+    { 0xad3d1bd20a97bb93ULL, "setFileWrapper:" },
+    { 0x1bbf8e34e1a5a9b9ULL, "applyDisplayedValue" },
+    { 0, NULL },
+    { 0x2b3fb6a2298f9170ULL, "revert:" },
+    { 0xc5c10fe6ae30d25cULL, "initWithAffectedRange:layoutManager:undoManager:" },
+    { 0x71b1a8cbdeac20d4ULL, "components:fromDate:toDate:options:" },
+    { 0x220e736da2745b0aULL, "addIndex:" },
+    { 0xcff13eac5081e09bULL, "_updateRecentDocumentsMenu" },
+    { 0xedeb31eb671b8cadULL, "bundleForClass:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x27d49680f9f36f38ULL, "enqueueNotification:postingStyle:" },
+    { 0x992925905bb0a42bULL, "stringForSelf" },
+    { 0xdbeb5502e0d055efULL, "frameRate" },
+    { 0x885b31c03882a618ULL, "_appendObject:conditional:" },
+    { 0x4093306e598a72bdULL, "setBorderType:" },
+    { 0xe037532924c94386ULL, "setPostsBoundsChangedNotifications:" },
+    { 0xf9b56ad0bd223691ULL, "_parentWindowDidMiniaturize:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xab5d111622f21f36ULL, "menuFont" },
+    { 0x4eb8727e36a70ac7ULL, "setMinSize:" },
+    { 0xb5fca7a7364a651eULL, "localizedPaperName" },
+    { 0, NULL },
+    { 0x573c1b3f058f7994ULL, "initWithString:" },
+    { 0x3955caf19f2de119ULL, "textDidBeginEditing:" },
+    { 0, NULL },
+    { 0xf65284e1ebafd9f7ULL, "continueTracking:at:inView:" },
+    { 0, NULL },
+    { 0x6828b1db17012bb3ULL, "addIndexesInRange:" },
+    { 0x59dc70e851093f3cULL, "imageForSegment:" },
+    { 0xda447e4351814032ULL, "getObjects:andKeys:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe5b96bb849f30ac7ULL, "addFontFamily:" },
+    { 0xeebb94ae1600250dULL, "URLProtocol:cachedResponseIsValid:" },
+    { 0x1ad3e76a8118bd4bULL, "shouldDelayWindowOrderingForEvent:" },
+    { 0x5f26efee1992aebbULL, "addTabViewItem:" },
+    { 0x0434a568e6074debULL, "initWithWindowRef:" },
+    { 0xad719981d21e8d24ULL, "getBitmapDataPlanes:" },
+    { 0, NULL },
+    { 0x7776338850b05368ULL, "setDefaultCredential:forProtectionSpace:" },
+    { 0x3d24471978eb2e94ULL, "willChange:valuesAtIndexes:forKey:" },
+    { 0x39749af761eb8002ULL, "setLocalizesFormat:" },
+    { 0xc07aba2652269d18ULL, "setMixedStateImage:" },
+    { 0, NULL },
+    { 0x6485f6a6d1d734ccULL, "showWindowForAppActivation:" },
+    { 0x094125fbefcb088dULL, "indexLessThanOrEqualToIndex:" },
+    { 0, NULL },
+    { 0x3029e1257356b117ULL, "_appendWordOne:" },
+    { 0x8cdfa5fcbea4e16aULL, "selectionIndexPaths" },
+    { 0x761aa5884f2adc96ULL, "handleMonitorIndicatesSignaled:" },
+    { 0x46933279191dd924ULL, "setHostCacheEnabled:" },
+    { 0xa673443818703f15ULL, "setLocation:withAdvancements:forStartOfGlyphRange:" },
+    { 0xc4b4818f471b83efULL, "setAlignment:" },
+    { 0xac29cccbbaf3f83fULL, "yellowComponent" },
+    { 0x8a9dce0ff0bc4a16ULL, "setSliderType:" },
+    { 0xc32545e8bae9820dULL, "createCurrentString" },
+    { 0x934ada6914cb3a4cULL, "windowWithFrame:styleMask:backingType:" },
+    { 0xc0786ca3ad3ed363ULL, "removeAllObjects" },
+    { 0xda165b407a73232dULL, "stopModalWithCode:" },
+    { 0x9d902db85a2458deULL, "sharedColorPanel" },
+    { 0, NULL },
+    { 0xd75bc921558a1d39ULL, "insert:" },
+    { 0xc738c7310fe43e7dULL, "editWithFrame:inView:editor:delegate:event:" },
+    { 0, NULL },
+    { 0xd765a7ba01d28a16ULL, "discardEventsMatchingMask:beforeEvent:" },
+    { 0x5624d2ef188f636aULL, "searchTextRectForBounds:" },
+    { 0xf8e8f9302b6b45b2ULL, "layer" },
+    { 0x56a984dd6967bd9fULL, "writeToPasteboard:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xec388297ad5da10eULL, "resizeSubviewsWithOldSize:" },
+    { 0x62b9bc81e3d09987ULL, "decodeDataObject" },
+    { 0xf06fc76e3fb9e1c2ULL, "pointingHandCursor" },
+    { 0xa719ea59d9094c8aULL, "orderFrontFontPanel:" },
+    { 0x8b882b7822643a58ULL, "secondsFromGMT" },
+    { 0xc220ba6d3e8d89a8ULL, "headerClipViewFrame" },
+    { 0x660653a86c7e3414ULL, "textAttributesForNil" },
+    { 0x35d8f541cf1ddb20ULL, "setMiterLimit:" },
+    { 0x9a83dbd36c6ae0e5ULL, "setRefusesFirstResponder:" },
+    { 0xcd13958688fbe6dbULL, "setContent:" },
+    { 0x6e38b12ad5400fb4ULL, "maxContentSize" },
+    { 0, NULL },
+    { 0x909c11b122f14484ULL, "setPreservesContentDuringLiveResize:" },
+    { 0xe6e1d49f97bea907ULL, "fileSystemChanged" },
+    { 0xaffd4ef8436419fbULL, "runModalForWindow:" },
+    { 0x1a787bf11db7653cULL, "_setHICONFromImage:" },
+    { 0x51f864263c112a12ULL, "play" },
+    { 0xc68fb7e6dbc09a0fULL, "setEnabled:forSegment:" },
+    { 0x768a4bbc22db49acULL, "setTopMargin:" },
+    { 0xa4fe6369c7362b65ULL, "setSelected:" },
+    { 0x532fbcee69f56690ULL, "revertDocumentToSaved:" },
+    { 0xf3665746ccc2d7b4ULL, "mountedLocalVolumePaths" },
+    { 0x26c8d2297e756c00ULL, "dispatch" },
+    { 0, NULL },
+    { 0x656a5bc79364b1c4ULL, "decodeCharForKey:" },
+    { 0xf520f527836bf536ULL, "_appendStringToKillBuffer:" },
+    { 0, NULL },
+    { 0xb7e688662263cb26ULL, "locationOfPrintRect:" },
+    { 0xc491068bc3486c09ULL, "storeCachedResponse:forRequest:" },
+    { 0x699c228672892355ULL, "superclass" },
+    { 0x229c097678436da5ULL, "removeCGLContext:" },
+    { 0xce3326a6496c8951ULL, "insertNewButtonImage:in:" },
+    { 0x4c75c1afed77f765ULL, "createRunningCopyPipe" },
+    { 0x30317b8f77ae6e3cULL, "invalidateTimerWithDelayedPerform:" },
+    { 0x828db4e4c7d1a860ULL, "takeIntegerValueFrom:" },
+    { 0xa968be278bcd63d2ULL, "parseError:token:info:" },
+    { 0xb04b4471eab59fc0ULL, "selectionShouldChangeInOutlineView:" },
+    { 0xe3c3f71a48a2d72dULL, "_currentSpellEngine" },
+    { 0xf76f744b433eaa81ULL, "objCType" },
+    { 0x1a381c83b4276237ULL, "documentWithContentsOfFile:" },
+    { 0x73a4069cdaa0d0beULL, "glyphIndexForPoint:inTextContainer:fractionOfDistanceThroughGlyph:" },
+    { 0, NULL },
+    { 0x349b11f10463f8f6ULL, "replaceObject:withObject:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1615c5e2c362bea8ULL, "parentWindowDidDeactivate:" },
+    { 0x67e3980f53f3790aULL, "cascadeTopLeftFromPoint:" },
+    { 0x7e33e95aff7e308eULL, "removeFile" },
+    { 0x4aba7e90efaf7d5aULL, "runLoopModesForAnimating" },
+    { 0x716633d1e19e17d2ULL, "makeTransparent" },
+    { 0xd26ed70a9de1f30aULL, "invalidateClassDescriptionCache" },
+    { 0x55d48475fa93c233ULL, "itemAttributes" },
+    { 0x3672fa23fa6537c6ULL, "cancelBackgroundMonitoring" },
+    { 0x97b1b50616a2d05cULL, "displayName" },
+    { 0x66fccf60707751c5ULL, "deselectItemAtIndex:" },
+    { 0xe8ff34c7aa9a1866ULL, "_removeTrayIcon" },
+    { 0xbb96524f3dbe7c79ULL, "moveToEndOfDocument:" },
+    { 0xa3e6217d26de3f12ULL, "sleepForTimeInterval:" },
+    { 0x2dfd1acc49de18f5ULL, "menuFontOfSize:" },
+    { 0x73e22c9a3cd99b4cULL, "textContainer" },
+    { 0x1c909f9a83f533abULL, "groupingLevel" },
+    { 0x020d245753d367daULL, "elementAtIndex:" },
+    { 0xad3b0d68a2da873aULL, "rulerView:willAddMarker:atLocation:" },
+    { 0x6a81d1c3e94dc33aULL, "_systemtimeToDate:" },
+    { 0x4e418594e130d2ddULL, "_setAlignment:range:" },
+    { 0, NULL },
+    { 0x1479772818d19b99ULL, "numberWithUnsignedInt:" },
+    { 0x955876d279db2725ULL, "setDefaultFlatness:" },
+    { 0x0a869302569055b6ULL, "performSelector:onThread:withObject:waitUntilDone:" },
+    { 0xe4e49e66dc55e93bULL, "enableFlushWindow" },
+    { 0xba97cc23642c0a3eULL, "cannotEncodeType:" },
+    { 0xd91fffcafb10c120ULL, "setPositiveFormat:" },
+    { 0, NULL },
+    { 0x15c5b48e6d2bd1a4ULL, "inQuartzDebugMode" },
+    { 0xdc135505cc75e7eeULL, "tabKeyTraversesCells" },
+    { 0x3008afde76cb2e5eULL, "netServiceBrowser:didFindService:moreComing:" },
+    { 0x868855f837a4d4d5ULL, "setSecond:" },
+    { 0xc897aad29fd36ba1ULL, "glyphName" },
+    { 0xf55ef3fc14210ba0ULL, "eTag:" },
+    { 0xd4e06cb8e627713cULL, "receiveAllDataInMode:" },
+    { 0x9ae95ccd49b51915ULL, "secondaryGroupingSize" },
+    { 0x77d6ebf902633612ULL, "registerDelegate" },
+    { 0x1e848d6b344b7e39ULL, "systemFontSizeForControlSize:" },
+    { 0x32c633ac639e5309ULL, "WM_ERASEBKGND_wParam:lParam:" },
+    { 0, NULL },
+    { 0x9a0f7783af508ef2ULL, "deselectAll:" },
+    { 0x4b67abe22b3b8eafULL, "netServiceBrowser:didRemoveDomain:moreComing:" },
+    { 0x1086afc06477f9f2ULL, "_performSelectorOnThreadHelper:" },
+    { 0, NULL },
+    { 0x0058f37fb0e46080ULL, "representedURL" },
+    { 0x33eff232c8dc2a26ULL, "flushSurface:flip:textureId:setup:reload:origin:" },
+    { 0x3188cd60cdfbda33ULL, "trackKnob:" },
+    { 0xff0bd369ad953318ULL, "centerSelectionInVisibleArea:" },
+    { 0x7aae47e424468cabULL, "boundingRectForGlyphRange:inTextContainer:" },
+    { 0xd5c7bfef4690200dULL, "textPasteboardTypes" },
+    { 0x63714d99d268a61bULL, "numberOfVirtualScreens" },
+    { 0xe3961556b258ae28ULL, "setVertical:" },
+    { 0x29a7c47f35fe54b8ULL, "charValue" },
+    { 0xf1deb6634b32f677ULL, "setBindingPath:" },
+    { 0x4bfeeaf73a4dd2caULL, "dateByAddingComponents:toDate:options:" },
+    { 0xae9136fab1d7f2ffULL, "setTextAttributesForNegativeValues:" },
+    { 0xdf84db2417be55a3ULL, "selectionRangeForProposedRange:granularity:" },
+    { 0x18fa6767124b34beULL, "_setItemArray:" },
+    { 0xc69bc9cf9e27c045ULL, "controlTextDidChange:" },
+    { 0, NULL },
+    { 0x1b833fa693458634ULL, "setHorizontalPagination:" },
+    { 0x1cfe1b87c8551a29ULL, "layerContentsPlacement" },
+    { 0xed9987970d4e47c5ULL, "alwaysUsesMultipleValuesMarker" },
+    { 0x7541bf88da314c76ULL, "URLForResource:withExtension:" },
+    { 0xe607bda4eb1d59baULL, "stop:" },
+    { 0xf8c9c5805ec06332ULL, "setHasVerticalRuler:" },
+    { 0x5d7de52a190e1f87ULL, "setSocketHandle:" },
+    { 0, NULL },
+    { 0xed829f7d08042855ULL, "scanHexLongLong:" },
+    { 0xe1e0490801a5f453ULL, "spellServer:checkGrammarInString:language:details:" },
+    { 0x8843067c416bb833ULL, "setRelinquishFunction:" },
+    { 0x546f2970b3e26933ULL, "_deepResignFirstResponder" },
+    { 0x517456a9acbe5affULL, "fileNameFromRunningSavePanelForSaveOperation:" },
+    { 0x2a8c3157fd3d252cULL, "defaultFocusRingType" },
+    { 0x836b1da03430976fULL, "removeStatusItem:" },
+    { 0xa3163f6de8ab98a5ULL, "bytesPerPlane" },
+    { 0xa3098c24c1330eeeULL, "_removeViewWithoutDisplay:" },
+    { 0x05e625cc7bd5f588ULL, "_wakeUp" },
+    { 0x9c1f65ea3f5339b6ULL, "componentsToDisplayForPath:" },
+    { 0xbdacd8163783af3cULL, "selectedRowEnumerator" },
+    { 0xdc7e1524e8b41563ULL, "activeFontInfo" },
+    { 0x31134f91d1a6c082ULL, "processIdentifier" },
+    { 0xd010fa6beb36d963ULL, "isEqualToAttributedString:" },
+    { 0x863650cc49dbbaccULL, "maximumRecents" },
+    { 0, NULL },
+    { 0x9b624c1b4f2f2052ULL, "setTabViewType:" },
+    { 0xdd6b01c1aef6507dULL, "validInputSources" },
+    { 0x8776eab562006d4aULL, "setSelectionIndexes:" },
+    { 0x934e5cd717f6c03cULL, "setAlwaysShowsDecimalSeparator:" },
+    { 0xad7acfbea08bb312ULL, "buttonToolTip" },
+    { 0x385570a989c19179ULL, "copiesOnScroll" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x961bd23b70e5fcc8ULL, "setAnimationBlockingMode:" },
+    { 0xf4791d83b91bb88eULL, "isHostCacheEnabled" },
+    { 0x8b5e1238e4c1bf22ULL, "systemVersion" },
+    { 0xbce95d437004cbe9ULL, "textDidEndEditing:" },
+    { 0x2576aa750e0da709ULL, "windowWillClose:" },
+    { 0, NULL },
+    { 0x483df75559553f32ULL, "socketType" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb5dc5cb7ea6fa342ULL, "indexOfItemWithTitle:" },
+    { 0x12838517701e847bULL, "keyWindow" },
+    { 0xc55d9b36d7b54efbULL, "writeBytesAvailable" },
+    { 0x33c2cead567820afULL, "netServiceBrowserWillSearch:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x7ee15deb1a267497ULL, "timeZoneTypeForDate:" },
+    { 0, NULL },
+    { 0xd190fec79818666eULL, "extraLineFragmentTextContainer" },
+    { 0xe45bdd8a5d5bc941ULL, "sizeOfButtonImage:enabled:mixed:" },
+    { 0x4d56f954a5bfc549ULL, "orderBack:" },
+    { 0x3fc951eb2a9b9fc5ULL, "stopResolving:" },
+    { 0, NULL },
+    { 0x27efd1d327204dfcULL, "_allUsedBinders" },
+    { 0xbc02af55111787c1ULL, "bounds" },
+    { 0, NULL },
+    { 0xea67f821d37c9a76ULL, "shiftIndexesStartingAtIndex:by:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3ca20bd17f92e200ULL, "_trackingAreasChanged" },
+    { 0, NULL },
+    { 0x3ae38886e67ce903ULL, "numberOfTickMarks" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xba57137ef1329b9aULL, "eventWithMSG:" },
+    { 0, NULL },
+    { 0xef1e557a2aba8c63ULL, "selectedColumnEnumerator" },
+    { 0x0864f1869bb61e23ULL, "setCookieAcceptPolicy:" },
+    { 0xb80722893175e76eULL, "insertText:" },
+    { 0x2d19aaf4abb4fa55ULL, "layoutOptions" },
+    { 0x5aec55b92b8aeb18ULL, "visibleEdgeWithPreferredEdge:parentWindow:drawerWindow:" },
+    { 0xf05e07ab5d80ea45ULL, "elementCount" },
+    { 0, NULL },
+    { 0xc1052b4454028926ULL, "data1" },
+    { 0, NULL },
+    { 0x1d1e740b291872adULL, "verticalLineScroll" },
+    { 0x06186b485c2b5000ULL, "isEqualToNumber:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x73e49f98151abbfaULL, "setSortDescriptors:" },
+    { 0x840f084c08fc1c7aULL, "_frameLengthForSelector:" },
+    { 0x5efdf21e09c6073dULL, "firstUnlaidCharacterIndex" },
+    { 0, NULL },
+    { 0x17cb0d232366895aULL, "password" },
+    { 0xd6707e9450fb3d8fULL, "labelForSegment:" },
+    { 0x4a85061dfed6df1dULL, "_argumentsData" },
+    { 0x3f8ff3dfc5c2c22fULL, "proxyWithTarget:connection:" },
+    { 0x31bc1844ad57493aULL, "_URLProtocolClassForRequest:" },
+    { 0x9db4d2d39e297374ULL, "selectFirstTabViewItem:" },
+    { 0x45744cff711f84ffULL, "Next:::" },
+    { 0x16d397a53130624fULL, "setInterlineSpacing:" },
+    { 0xb417b9942f920f97ULL, "controlView" },
+    { 0x4b25f10784b12db4ULL, "outlineView:widthOfCell:forTableColumn:byItem:" },
+    { 0x5eff71c6d2f7ddd7ULL, "comment" },
+    { 0x4526e9e9ad773b48ULL, "recalculateKeyViewLoopIfNeeded" },
+    { 0x7bee6f3aefb61769ULL, "toggleRuler:" },
+    { 0x062ba236be745fd4ULL, "decodeIntForKey:" },
+    { 0xa05ae1993ee71f0dULL, "numberOfColumns" },
+    { 0x0635b55446bd1a32ULL, "prompt" },
+    { 0xcbc676239c351204ULL, "decodeValuesOfObjCTypes:" },
+    { 0xdc546c44a354e23bULL, "decimalNumberWithString:" },
+    { 0, NULL },
+    { 0x53014fe0b8b44c3eULL, "printJobTitle" },
+    { 0xa8c44834fe5d6e1fULL, "getParagraphStart:end:contentsEnd:forRange:" },
+    { 0xfb54cc1bedb6efefULL, "convertAttributes:" },
+    { 0xa9deefba4f1dfc7cULL, "selectCell:" },
+    { 0x0b66e952d5aa8c4bULL, "hsbSliderChanged:" },
+    { 0x1d4c1a35a95f8bb7ULL, "drawTextFieldBorderInRect:bezeledNotLine:" },
+    { 0x05ad481790e9a05eULL, "setMainMenu:" },
+    { 0x857151f3323bc0d1ULL, "length" },
+    { 0x2e2f6a1bef950e79ULL, "stopAnimation:" },
+    { 0xc210fc84e27ff5e0ULL, "hide" },
+    { 0xdbd36079c21f3204ULL, "setInternationalCurrencySymbol:" },
+    { 0, NULL },
+    { 0x82305dffdc9b28b4ULL, "cleanUpAfterDragOperation" },
+    { 0x7647f814cd8cddcbULL, "unmountAndEjectDeviceAtPath:" },
+    { 0x40236c6d588b7c80ULL, "processInputImmediately" },
+    { 0, NULL },
+    { 0xd6442cf34ad43ea2ULL, "_insertionPointTimerFired:" },
+    { 0x7e5b1ef6964b38e1ULL, "acceptsFirstMouse:" },
+    { 0x8054a598d4bdd1b8ULL, "takeValuesFromDictionary:" },
+    { 0, NULL },
+    { 0x7d967e430d3401f9ULL, "parentWindowDidMiniaturize:" },
+    { 0x1aae2476cbd3d8caULL, "setSeparatesColumns:" },
+    { 0xb3a9a681a3554ea0ULL, "decimalValue" },
+    { 0, NULL },
+    { 0xf309e6888a4fca56ULL, "showCorrectionIndicatorOfType:primaryString:alternativeStrings:forStringInRect:view:completionHandler:" },
+    { 0x6464a2f499a44f2bULL, "setHTTPMethod:" },
+    { 0, NULL },
+    { 0xad279bb8ce771f62ULL, "_mouseDownHighlight:" },
+    { 0xa0003f5f1ae0109cULL, "drawDividerInRect:" },
+    { 0x797efcaa3e0860bdULL, "setAvoidsEmptySelection:" },
+    { 0xd97bb87e3b214abdULL, "fontFamilyWithTypefaceName:" },
+    { 0x0362e4dababed7d1ULL, "detach" },
+    { 0x41e02a3f1b531ba6ULL, "canResumeDownloadDecodedWithEncodingMIMEType:" },
+    { 0, NULL },
+    { 0xb06d337b5c18c1dbULL, "representationUsingType:properties:" },
+    { 0x648c02936cfb7431ULL, "defaultTypesetterBehavior" },
+    { 0x1a2b7f360134123aULL, "stringWithFileSystemRepresentation:length:" },
+    { 0x21236459eb826df9ULL, "validateVisibleItems" },
+    { 0x40384f134aa0ef22ULL, "levelIndicatorStyle" },
+    { 0x3a2e1374da73508bULL, "_registeredClasses" },
+    { 0x396ecbea44c3a747ULL, "scanCharactersFromSet:intoString:" },
+    { 0, NULL },
+    { 0xb0f69e1e945f9952ULL, "textDidChange:" },
+    { 0, NULL },
+    { 0x068cca835896226aULL, "openFile:" },
+    { 0x5c8deca9421b26e9ULL, "limitDateForMode:" },
+    { 0x5e6cc16d87ee1d5fULL, "dockTile" },
+    { 0x2ed73da30ce874d4ULL, "portForName:host:" },
+    { 0x8ca43e9488438cd0ULL, "indexOfItemWithSubmenu:" },
+    { 0x25dd7c393b5af99cULL, "removeRequestMode:" },
+    { 0, NULL },
+    { 0x8997ee9d65a1afbbULL, "shortStandaloneWeekdaySymbols" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd6635493a7e2a523ULL, "setNilSymbol:" },
+    { 0xfe586d2e4fc38c2fULL, "_resetWindowOrdering:" },
+    { 0x8ccb9a5b320caeb7ULL, "stringByReplacingOccurrencesOfString:withString:options:range:" },
+    { 0xbd18ceac8d784b80ULL, "monitorWithHandle:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4b2c1e5291e95093ULL, "didChangeValueForKey:withSetMutation:usingObjects:" },
+    { 0xff5a9962203486feULL, "setDefaultTabInterval:" },
+    { 0x23c09c161ea14622ULL, "drawingRectForBounds:" },
+    { 0xd077da4be7994532ULL, "criticalValue" },
+    { 0x13604e75fb432913ULL, "requestModes" },
+    { 0xa5adf6094c376dccULL, "menuNeedsUpdate:" },
+    { 0x358b345f619bf87cULL, "compositingOperation" },
+    { 0xb78c84a1740a67afULL, "pathForResource:ofType:inDirectory:forLocalization:" },
+    { 0xa2029b9dddf22abeULL, "clickTypefaceMatrix:" },
+    { 0xd7dde876ee6102a3ULL, "_windowWillBecomeActive:" },
+    { 0xdbab593ddea6e621ULL, "appkitWindow" },
+    { 0, NULL },
+    { 0x230b4ddddec48a2eULL, "detachColorList:" },
+    { 0x8bed81be3cd1dfc9ULL, "TXTRecordData" },
+    { 0x3af8aceb5ff1f45fULL, "setFlatness:" },
+    { 0xeb0a019360fedb30ULL, "setSelectedRanges:affinity:stillSelecting:" },
+    { 0x21d678aae78bfd69ULL, "registerUndoWithTarget:selector:object:" },
+    { 0x19abbe2b6ee3ffdcULL, "blueComponent" },
+    { 0x2f67e08e5200203eULL, "stroke" },
+    { 0x49d4a7e3a9d4d514ULL, "resetSystemTimeZone" },
+    { 0x54ad49475bd0df39ULL, "recursiveLockClass" },
+    { 0, NULL },
+    { 0x4b09f5128187b1cbULL, "addObserver:toObjectsAtIndexes:forKeyPath:options:context:" },
+    { 0x28b1b524585f6269ULL, "setMaxContentSize:" },
+    { 0x1bd7d912602ef9c1ULL, "enqueueNotification:postingStyle:coalesceMask:forModes:" },
+    { 0xed580a1d968a492eULL, "setKillBufferAdditive:" },
+    { 0x72f64b6e00b6e984ULL, "ISOCurrencyCodes" },
+    { 0, NULL },
+    { 0x1a9178a868791e97ULL, "showsFirstResponder" },
+    { 0x48c4792378b6f686ULL, "arrayForKey:" },
+    { 0xa2efdbf3c0926f2fULL, "isDeletableFileAtPath:" },
+    { 0x8d9fbafccaba4a28ULL, "makeKeyWindow" },
+    { 0xeda7a883ce5e4b33ULL, "drawsCellBackground" },
+    { 0x073382f6a24a018bULL, "expressionWithVariable:expression:" },
+    { 0x45cd80fbbc093d1bULL, "indentationLevel" },
+    { 0x48d71b46a888f849ULL, "_setSelectedIndex:" },
+    { 0x32d9c331c01a81a1ULL, "readFromURL:ofType:" },
+    { 0x2e1357db274ca19dULL, "setAcquireFunction:" },
+    { 0xcc7dedf0cbe58bc0ULL, "performClick:" },
+    { 0, NULL },
+    { 0x3c04f720423c7456ULL, "initWithContentSize:preferredEdge:" },
+    { 0x4f51a37a87e6ee95ULL, "presentError:" },
+    { 0x3bbf1335f7a89a1bULL, "addLayoutManager:" },
+    { 0, NULL },
+    { 0x0d08ed36e3b2dc61ULL, "selectWord:" },
+    { 0x89d3d4c6dce295f8ULL, "setMaxItemSize:" },
+    { 0x796c536988c35e3bULL, "setSizeFunction:" },
+    { 0xe2ea28d89c4b7ef2ULL, "isTransparent" },
+    { 0xc2d07e078b6256bbULL, "offStateImage" },
+    { 0x39e74bb76e74d98eULL, "connection:didReceiveAuthenticationChallenge:" },
+    { 0xc9da21833f4e4a25ULL, "setFieldEditor:" },
+    { 0, NULL },
+    { 0x031d92a3041227beULL, "reloadItem:reloadChildren:" },
+    { 0x1ecb406408249d06ULL, "setKeyEquivalentFont:size:" },
+    { 0x2c3b7e7514f384c1ULL, "confinementRectForMenu:onScreen:" },
+    { 0x480f43a84a7d882dULL, "cgContext" },
+    { 0x7f8c4a4120c214fdULL, "pixelBufferMipMapLevel" },
+    { 0, NULL },
+    { 0xc25afc5db10048bdULL, "_SHBrowseForFolder:" },
+    { 0x39284723aa17a02fULL, "pathComponentCellClass" },
+    { 0xcd592966bb9a94feULL, "finishEncoding" },
+    { 0x8c08338e835a2766ULL, "WM_WINDOWPOSCHANGED_wParam:lParam:" },
+    { 0xa90ba4c025968624ULL, "rowForItem:" },
+    { 0x95f1c380f84d7b40ULL, "brightness" },
+    { 0x9a42820c9b6ab6eaULL, "initWithFileDescriptor:closeOnDealloc:" },
+    { 0x9a1e9b0277627105ULL, "invalidateCursorRectsForView:" },
+    { 0xa03205137383002bULL, "interpretKeyEvents:" },
+    { 0xa3808e8878515075ULL, "addIndexes:" },
+    { 0, NULL },
+    { 0x03e7e44075e1513aULL, "valueTypeForDimension:" },
+    { 0, NULL },
+    { 0xbe95943991fdd73cULL, "_isLegacy" },
+    { 0x07d2f81e3320a4feULL, "showsHelp" },
+    { 0x09b88eb7b47ca964ULL, "firstRectForCharacterRange:" },
+    { 0xcb78fa61add1fe8aULL, "imageAlignment" },
+    { 0x4de550115250cd24ULL, "scrollColumnToVisible:" },
+    { 0x61b68431724dd4e6ULL, "user" },
+    { 0x42e8760d8fe9e871ULL, "isContinuousSpellCheckingEnabled" },
+    { 0x8913cd7945ac3104ULL, "setAccessoryView:" },
+    { 0, NULL },
+    { 0xa82a640cfb57a90aULL, "dividerStyle" },
+    { 0x254b8f99f2ed62cfULL, "glyphIndexForPoint:inTextContainer:" },
+    { 0xc318239e638e004eULL, "itemIdentifier" },
+    { 0x7fe0f09264a03eecULL, "numberOfSelectedColumns" },
+    { 0x7675e67f938b46cdULL, "writeToFile:atomically:updateFilenames:" },
+    { 0x078e0655a82f5c10ULL, "evaluateObject:" },
+    { 0x2d0d84c862fe1058ULL, "lengthOfBytesUsingEncoding:" },
+    { 0xb7437711022820cbULL, "runModal" },
+    { 0x706c5306b088c381ULL, "typeForContentsOfURL:error:" },
+    { 0xb0b1e9a450300bc6ULL, "moveToBeginningOfLineAndModifySelection:" },
+    { 0xe89ec55c7a81e8fcULL, "_indexesOfArrangedObjects:" },
+    { 0x8ed54b1685e88808ULL, "takeIntValueFrom:" },
+    { 0x3a36bb68099be60aULL, "postEvent:atStart:" },
+    { 0, NULL },
+    { 0x735330a7061c169aULL, "getValues:forParameter:" },
+    { 0, NULL },
+    { 0xb87fb3f73690a40cULL, "addObjects:" },
+    { 0xb9e3ddd60a24b474ULL, "_setRectInWindow:" },
+    { 0xa6065a2ae4d7c92cULL, "lightGrayColor" },
+    { 0, NULL },
+    { 0x8f7e38ed524670cfULL, "removeEntryAtIndex:" },
+    { 0, NULL },
+    { 0xf3a30ceddb929bf3ULL, "runModalPrintPanelWithPrintInfoDictionary:" },
+    { 0x5e2d7cc3efe32318ULL, "isRunning" },
+    { 0x54eebdd87e4217abULL, "recentDocumentURLs" },
+    { 0xcb653e310295d18dULL, "rowAtPoint:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6692beffaa13095bULL, "pixelFormat" },
+    { 0x05c5aa18866cce6aULL, "undoMenuTitleForUndoActionName:" },
+    { 0xb6f7cb104610f753ULL, "displayMode" },
+    { 0x3652db320a24a3c5ULL, "rectForSelectedItem" },
+    { 0x853d55af9d1a0dffULL, "keyCode" },
+    { 0, NULL },
+    { 0x2029b25750efdf65ULL, "documentView" },
+    { 0x54b3cd7294bbe2eaULL, "paragraphSpacingBeforeGlyphAtIndex:withProposedLineFragmentRect:" },
+    { 0x2b7702917302a1b3ULL, "KVO_notifying_change_insertObject:inKeyAtIndex:" },
+    { 0x69bba852a05679a6ULL, "setMinValue:" },
+    { 0x7940926bbd030770ULL, "insertAttributedString:atIndex:" },
+    { 0x509c64e1253b0e4bULL, "becomeFirstResponder" },
+    { 0x30c73783aa0fbe85ULL, "spellServer:checkString:offset:types:options:orthography:wordCount:" },
+    { 0x8c3e31abee6fff54ULL, "cornerRadius" },
+    { 0x98a3fdd9024fc096ULL, "setChildrenKeyPath:" },
+    { 0x07e267ee93ea9905ULL, "selectPreviousKeyView:" },
+    { 0x8e4e9eddd8a9b29aULL, "setPaddingCharacter:" },
+    { 0x21948693c57dd6e8ULL, "pageDownAndModifySelection:" },
+    { 0, NULL },
+    { 0xd66c17d5ec3ca64eULL, "windowWillLoad" },
+    { 0x70f11e0b266be177ULL, "scrollViaScroller:" },
+    { 0x40850b5aca92b00fULL, "parent" },
+    { 0x919b7cf6e1089389ULL, "ignoreWord:" },
+    { 0xf3a11061c1294404ULL, "dragImage:at:offset:event:pasteboard:source:slideBack:" },
+    { 0, NULL },
+    { 0x73b63b749647f997ULL, "setEnabledTextCheckingTypes:" },
+    { 0x0b2e8a655ca47f76ULL, "isVertical" },
+    { 0x73f1455838fe3960ULL, "segmentCount" },
+    { 0xeb3879137835c107ULL, "initWithContentRect:styleMask:backing:defer:" },
+    { 0xa330638948afd112ULL, "isFileURL" },
+    { 0, NULL },
+    { 0x04b1c3c4766498cbULL, "colorizeByMappingGray:toColor:blackMapping:whiteMapping:" },
+    { 0, NULL },
+    { 0x0f20b076571ad047ULL, "_setKeyWindow:" },
+    { 0, NULL },
+    { 0x7ca65fd9ba2f193bULL, "screen" },
+    { 0, NULL },
+    { 0x4f464c98a5e69ba0ULL, "setSelectedObjects:" },
+    { 0xcac9029b12d7f39aULL, "writeToFile:atomically:encoding:error:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x60be0be4b3fa6315ULL, "didForgetWord:inLanguage:" },
+    { 0x70ea6ed323cde680ULL, "parserDidEndDocument:" },
+    { 0x48a942408c01bc23ULL, "setNumberOfColumns:" },
+    { 0x636ab66280199ffaULL, "setFrameUsingName:force:" },
+    { 0, NULL },
+    { 0xc3fa5b6dc1f54e0dULL, "URLProtocol:didCancelAuthenticationChallenge:" },
+    { 0xe981e94827df0ebeULL, "delegateSelectionShouldChange" },
+    { 0xfb3e28b306459bcbULL, "checkSpellingOfString:startingAt:" },
+    { 0x0e9c1731642bdf39ULL, "redoMenuTitleForUndoActionName:" },
+    { 0x915129900d425d26ULL, "EPSOperationWithView:insideRect:toData:printInfo:" },
+    { 0xdf401843d70f3515ULL, "ignoreWord:inSpellDocumentWithTag:" },
+    { 0x0910e0eaf9c4410bULL, "defaultMenu" },
+    { 0, NULL },
+    { 0x1226a7f6269ed6a6ULL, "setHorizontalPageScroll:" },
+    { 0xd5879977d48af02bULL, "formatIsValid:" },
+    { 0x75f5d7deda355624ULL, "availableLanguages" },
+    { 0xfe90d4aecf3b0613ULL, "pixelsPerInch" },
+    { 0x0f17b588912f9ae9ULL, "displayIfNeeded" },
+    { 0xc34d4bb9609ffdd0ULL, "applyToObject:inRow:" },
+    { 0, NULL },
+    { 0x4ab28f417befbbcdULL, "alertShowHelp:" },
+    { 0x865eb73e538acff8ULL, "superview" },
+    { 0x77e6ec10e623b000ULL, "shouldChangePrintInfo:" },
+    { 0xd98de20b66c5ef0bULL, "noop:" },
+    { 0x8978b32db259685bULL, "timeZoneWithName:" },
+    { 0x1f717ef949686624ULL, "layoutAlgorithm" },
+    { 0x5905938918f9588fULL, "viewDidEndLiveResize" },
+    { 0x1513e73f8bff709eULL, "verticalAlignment" },
+    { 0x8d033e28660c263eULL, "setSendsActionOnEndEditing:" },
+    { 0x8dd53d1433c1f8b1ULL, "currentModifierFlags" },
+    { 0, NULL },
+    { 0xf160d4cb10b66863ULL, "deminiaturize:" },
+    { 0xb75f1ead01f716acULL, "parentDeathInputSource" },
+    { 0x4f21f07dcc95a704ULL, "setAlertStyle:" },
+    { 0x83e07cfb3dd123dcULL, "_replaceCharactersInRange:withString:useTypingAttributes:allowsTypingCoalescing:" },
+    { 0x785b6ea9f3cafc86ULL, "authenticationMethod" },
+    { 0x6f60dc284c7424aaULL, "_appendCString:" },
+    { 0x4427b4d145e4e0cdULL, "dictionaryForKey:" },
+    { 0x6c336d86c02be2baULL, "methodSignature" },
+    { 0x0da67c1d0785e34cULL, "_trackMoveMarker:" },
+    { 0xbd7d774796764f06ULL, "pageCount" },
+    { 0x399e4d1b791f302fULL, "circularSliderBackgroundGradient" },
+    { 0x22fcd54d0b61dce9ULL, "classNameDecodedForArchiveClassName:" },
+    { 0, NULL },
+    { 0xcb79d0a6a7650d46ULL, "decimalNumberByMultiplyingByPowerOf10:" },
+    { 0xd63b7634a6a86f5fULL, "filterPredicate" },
+    { 0x256740addca4c779ULL, "calendarFormat" },
+    { 0xb1644fb26b2309e0ULL, "_isActive" },
+    { 0x238db6706d6b52cdULL, "_collectTrackingAreasForWindowInto:" },
+    { 0x4b9015b6e9549aa1ULL, "_errorHandler:src:dest:operation:" },
+    { 0x39f1581cd936fd80ULL, "copy:" },
+    { 0x76e34e6beb2bd082ULL, "reloadDefaultFontFamilies" },
+    { 0, NULL },
+    { 0xc0976bf3469c806dULL, "isVisible" },
+    { 0x51e5f3c27e8992adULL, "typefaceWithTraits:" },
+    { 0x158618e2e5480e04ULL, "restoreAttributesOfTextStorage:" },
+    { 0x41f82a49f8713caaULL, "encodePropertyList:escape:indent:" },
+    { 0xc4a944e7e1b54443ULL, "autorelease" },
+    { 0xd721fe2e561143b0ULL, "printer" },
+    { 0x1a8ea2544a5503daULL, "connection:willSendRequest:redirectResponse:" },
+    { 0xa44c8c8304851184ULL, "imageRepsWithContentsOfURL:" },
+    { 0xc816d9fcb5c8f797ULL, "drawWellInside:" },
+    { 0x392dec5951e88003ULL, "unprocessedEvents" },
+    { 0x8ae5363167bba2ceULL, "setNegativeFormat:" },
+    { 0, NULL },
+    { 0xa2056598ac01bbffULL, "setCompositingFilter:" },
+    { 0, NULL },
+    { 0xac09ba9a9fa5bc0bULL, "frameRotation" },
+    { 0xa69d826702cf6983ULL, "mnemonic" },
+    { 0xbd19ec07f03b0fe6ULL, "attachment" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x96f452c4c8813ccbULL, "_setContentObject:" },
+    { 0xa2f9bc198189e5d9ULL, "synchronizeTitleAndSelectedItem" },
+    { 0x8793a48c2a485e15ULL, "setSSLProperties:" },
+    { 0xe25d8248e3bda5b3ULL, "leftExpression" },
+    { 0, NULL },
+    { 0xc89d3ea92e2d20e0ULL, "availableFontNamesWithTraits:" },
+    { 0x4880efb2ffbfb1f5ULL, "removeColorWithKey:" },
+    { 0xbb7b08283c354d2aULL, "maxDate" },
+    { 0xbada81d7da84d482ULL, "selectFontInDefaultDC" },
+    { 0x724c14ebbeb41909ULL, "writeEPSInsideRect:toPasteboard:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x34576cd6512d9238ULL, "CGLContextObj" },
+    { 0xa4466130a5e7c2fdULL, "ignoredWords" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xec5f156df293aaccULL, "matchingFontDescriptorWithMandatoryKeys:" },
+    { 0xe69aed46829f97c3ULL, "runModalWithPrintInfo:" },
+    { 0x3535398722c09ac5ULL, "endEditing" },
+    { 0x97864337a4505b2eULL, "allowsEmptySelection" },
+    { 0xe9971c5a156b156fULL, "autosavedContentsFileURL" },
+    { 0xe306a82353148a23ULL, "printShowingPrintPanel:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x53efbcfc937b6eebULL, "acceptInputForMode:beforeDate:" },
+    { 0x419e344d34869b18ULL, "removeSuiteNamed:" },
+    { 0x3e6631cfb6380cb7ULL, "controlHighlightColor" },
+    { 0x491cf76ce42f2401ULL, "_reloadSelectionInColumn:" },
+    { 0xf82f37501375739dULL, "canonicalRequestForRequest:" },
+    { 0x69363372713b672bULL, "encodeArray:forKey:" },
+    { 0, NULL },
+    { 0xb9bffc1a9756a010ULL, "textTabForGlyphLocation:writingDirection:maxLocation:" },
+    { 0xc572a1565fd36971ULL, "_createLayerContextIfNeeded" },
+    { 0x64216238c60bfc37ULL, "defaultLineWidth" },
+    { 0x2310baadeb8563a1ULL, "_detachSheetContextAnimateAndOrderOut" },
+    { 0xb88ace16681b0fadULL, "panelConvertFont:" },
+    { 0, NULL },
+    { 0xe741071af05279c7ULL, "linkCheckingResultWithRange:URL:" },
+    { 0xe9f2c155f23764ecULL, "setContentView:" },
+    { 0xf7419cbb1b2e0a18ULL, "socket" },
+    { 0, NULL },
+    { 0x8c80475667748901ULL, "overflowIndex" },
+    { 0x0533aab91a484bbeULL, "classForKeyedArchiver" },
+    { 0xb2d3d217fe8d35aeULL, "horizontalRulerFrame" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6aa23a605dea731fULL, "rectForItemLabelAtIndex:" },
+    { 0x6ffb238f77153822ULL, "convertSize:fromView:" },
+    { 0x7435a56dd2250bd7ULL, "removeDecorationForWindow:onDisplay:" },
+    { 0x38872ca96cfb3518ULL, "setBackgroundStyle:" },
+    { 0x4f2684a8ace22d69ULL, "_wasDrawnWithFrame:inView:" },
+    { 0x770b49c28a1165dbULL, "_windowsZones" },
+    { 0x9fe06ba3eda73258ULL, "badgeLabel" },
+    { 0, NULL },
+    { 0xdc0964c613fa602eULL, "_bezelFrameForFrame:" },
+    { 0, NULL },
+    { 0x6a5c9ed737e0dc03ULL, "isSelected" },
+    { 0xa22b1d0bdae48afbULL, "unregisterImageRepClass:" },
+    { 0xca2156c41ed3d20cULL, "setCancelButtonCell:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xaa6335b9e17b9765ULL, "textBlocks" },
+    { 0x4ee091e3ddde08ecULL, "centerTabMarkerWithRulerView:location:" },
+    { 0, NULL },
+    { 0xe2cee0d809e2633eULL, "setTitleAlignment:" },
+    { 0xb697df558a0c55e8ULL, "printOperationWithView:" },
+    { 0x83984ec33a005f5cULL, "getCString:maxLength:" },
+    { 0xbff714244b0a18aeULL, "automaticallyNotifiesObserversForKey:" },
+    { 0x8720ef6e8a321cb8ULL, "contentLength" },
+    { 0x214f71f2d47f360eULL, "checkGrammarOfString:startingAt:language:wrap:inSpellDocumentWithTag:details:" },
+    { 0xe979fb90b52ba858ULL, "bind" },
+    { 0xc2b44d2608e8789dULL, "unregisterDelegate" },
+    { 0xd64b6be64a7b15f5ULL, "Release" },
+    { 0x4b4db029abea0629ULL, "parser:foundUnparsedEntityDeclarationWithName:publicID:systemID:notationName:" },
+    { 0, NULL },
+    { 0x7da17c0c4f5dc1c4ULL, "attributeForLocalName:URI:" },
+    { 0xac2b87495b1d8006ULL, "mouseDown:" },
+    { 0x01ff9df6cef89392ULL, "setUndoManager:" },
+    { 0, NULL },
+    { 0xf8ef16609d48a109ULL, "setCurrencyDecimalSeparator:" },
+    { 0x23cc735a6f68a6bfULL, "maximumRecentDocumentCount" },
+    { 0x915fb0731a9e460dULL, "textAttributesForNotANumber" },
+    { 0x3fe4ecdf03d8159bULL, "lastItem" },
+    { 0x2b0a9e0fb1fea74dULL, "unhideCursor" },
+    { 0x2355f724643aa096ULL, "_timeZoneInformation" },
+    { 0xe8d6cca01ee5f611ULL, "asapProcessMode:" },
+    { 0xcbad603b99cff281ULL, "setCellClass:" },
+    { 0xe0265802db294351ULL, "setIndeterminate:" },
+    { 0x3dcec5b2380784b1ULL, "containsAttachments" },
+    { 0x2c22f96bc5b2f526ULL, "mouseEntered:" },
+    { 0x9ed64d4108a3360dULL, "comboBoxWillPopUp:" },
+    { 0xe0dbdce890c63d79ULL, "browserWillScroll:" },
+    { 0xf5e980af109cd0baULL, "formatEtcWithFORMATETC:" },
+    { 0x45f6ea5ab6b6d29dULL, "setAttributedStringForNil:" },
+    { 0x132a3ea25294e47eULL, "otherButton:" },
+    { 0x15cba121ad17631cULL, "_deallocateClosure" },
+    { 0x1629f8bda526250eULL, "containerSize" },
+    { 0x49242b38152468e4ULL, "setTokenStyle:" },
+    { 0xbe3cfc6c5322b7c9ULL, "scanLongLong:" },
+    { 0x0880970de00a5984ULL, "setHashFunction:" },
+    { 0x396f9b8044ab742dULL, "_kvo_operator_min:" },
+    { 0x1b00a8401a69103eULL, "mainWindow" },
+    { 0x2f39afa702eb2cb1ULL, "encodeObject:" },
+    { 0x1dc50266e7cfd532ULL, "transferOneBufferFromSocketToSSL:" },
+    { 0x4b0109bc6a2e27f8ULL, "_closeSplashImage" },
+    { 0, NULL },
+    { 0xc9d91562f5c54644ULL, "readToEndOfFileInBackgroundAndNotifyForModes:" },
+    { 0xee1a8c0538791345ULL, "queryCallback:flags:interface:error:fullname:type:class:length:data:ttl:" },
+    { 0x5c955fe93ba28a32ULL, "getFileSystemInfoForPath:isRemovable:isWritable:isUnmountable:description:type:" },
+    { 0xb27e2b6e01477b5dULL, "processorCount" },
+    { 0x8bae07c520c42d05ULL, "Skip:" },
+    { 0x1fc0d08d05258642ULL, "setOnMouseExited:" },
+    { 0x969278868d160203ULL, "groupingSize" },
+    { 0x5eb461b5652b8b3fULL, "enumCallback:flags:interface:error:domain:" },
+    { 0x94e40f3ef68f475aULL, "requiredFileType" },
+    { 0xc8d5905936d6479cULL, "setAutosavedContentsFileURL:" },
+    { 0xbb1c96d962b89c09ULL, "currencyDecimalSeparator" },
+    { 0x418aa8e166e57d13ULL, "drawOutlineViewBranchInRect:expanded:" },
+    { 0x4ff6598029fccf84ULL, "noteNumberOfRowsChanged" },
+    { 0x30cd8ddc7a504a91ULL, "columnOfMatrix:" },
+    { 0, NULL },
+    { 0x685d3c0f629b0a6bULL, "attributesAtIndex:longestEffectiveRange:inRange:" },
+    { 0x8da541673bed3fecULL, "scrollToPoint:" },
+    { 0x6ed56a1361695935ULL, "colorWithColorRef:spaceName:" },
+    { 0, NULL },
+    { 0xa2029c2120b49850ULL, "setArrowsPosition:" },
+    { 0x57cb2e386071450fULL, "dataOfType:error:" },
+    { 0xf0b138c4cefa669cULL, "unbind" },
+    { 0x6744d8df512c3854ULL, "maximumRangeOfUnit:" },
+    { 0xe22a2698b45dcdcaULL, "drawCellAtIndex:" },
+    { 0, NULL },
+    { 0xb91de7b8a9bd4cc9ULL, "defaultCenter" },
+    { 0x510a5356e236f216ULL, "fetchGlyphKerning" },
+    { 0x85a3d2fbca21bea8ULL, "_wrapReturnValueForSelector:" },
+    { 0, NULL },
+    { 0x9e3bd8131b796dc4ULL, "clearCurrentContext" },
+    { 0x9eed4ff2d81a5b55ULL, "localizedNameForFamily:face:" },
+    { 0xf2870df37e89a12fULL, "registerArgumentDefaults" },
+    { 0x7e665e48529b18f4ULL, "ruler" },
+    { 0x42ebf6170b7d79f4ULL, "setActionName:" },
+    { 0x3a78b76477bb9583ULL, "decodeDoubleForKey:" },
+    { 0xe54cfc060ca79584ULL, "knowsPageRange:" },
+    { 0x9161409fbd10f6bdULL, "screenFontWithRenderingMode:" },
+    { 0, NULL },
+    { 0xfd751ff6c969793fULL, "didEndElement" },
+    { 0xc98e404f243f8f0fULL, "isOneShot" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2f1501ac6b8077dfULL, "replyToOpenOrPrint:" },
+    { 0x78b3982be1459ae4ULL, "_contentArray" },
+    { 0x2e4a5d6661069995ULL, "_stepUpImage" },
+    { 0x915910e63228f8c8ULL, "convertSize:toView:" },
+    { 0xeb8923cc763e57dcULL, "_upArrowFrameForFrame:" },
+    { 0x8597a47f7499aa3eULL, "_addAttributes:range:" },
+    { 0, NULL },
+    { 0xdb8a0d03ca952e5aULL, "_setAndScrollToRange:" },
+    { 0xa3b69ded5d6bf355ULL, "localName" },
+    { 0x99cf73dee8fcd470ULL, "incrementCounter" },
+    { 0xd48d90983f0d296fULL, "initialValues" },
+    { 0xcba107f016342ccdULL, "read" },
+    { 0x77762f364dc1da18ULL, "TIFFRepresentation" },
+    { 0x8c64699053c60c87ULL, "drawBackgroundForGlyphRange:atPoint:" },
+    { 0x18354b222024b226ULL, "documentClassForType:" },
+    { 0xa638e7737a5642cdULL, "setROI:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x42b87130fb26d46cULL, "cancel" },
+    { 0x6e80b146d319c96eULL, "closedHandCursor" },
+    { 0x6dd7d8a99606934fULL, "fileManager:shouldProceedAfterError:" },
+    { 0x54280d19746e92eaULL, "moveForward:" },
+    { 0xa95cd4798bdddf51ULL, "appliesImmediately" },
+    { 0x0846fe9bcd180a7cULL, "propertyListFromData:" },
+    { 0xe235bc48b241e2edULL, "validateUserInterfaceItem:" },
+    { 0xd2efaad030ced547ULL, "setValuePath:" },
+    { 0xd7990a677970d4fcULL, "correctionForWordRange:inString:language:inSpellDocumentWithTag:" },
+    { 0x3110060e4aef2872ULL, "stringByReplacingPercentEscapesUsingEncoding:" },
+    { 0x1918cde9cc02b3a1ULL, "setToolbarItem:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5d346ef4e278e4f2ULL, "nextKeyBindingManager" },
+    { 0x3164badd0954816fULL, "setTrackingMode:" },
+    { 0x90ec25ffd21b8750ULL, "itemPrototype" },
+    { 0xc28af103eaebe357ULL, "highlight:" },
+    { 0xee93281ffc8aa6b5ULL, "beginPage" },
+    { 0x43bff6c5165dee22ULL, "moveDown:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8fe715212b879b01ULL, "setAllowsUserCustomization:" },
+    { 0xd23ae3298c69b621ULL, "setPositivePrefix:" },
+    { 0x7023113c4a15e2ccULL, "getGlyphs:range:" },
+    { 0x58023db079b4f730ULL, "resultType" },
+    { 0x2574b805d9f32d3aULL, "resizeRightCursor" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x99846323ce58640aULL, "saveConfiguration" },
+    { 0xf65fa0908f8fc78bULL, "shouldBreakLineByWordBeforeCharacterAtIndex:" },
+    { 0x46299204f976a813ULL, "representedObject" },
+    { 0x829c1386458a11bdULL, "wantsToTrackMouseForEvent:inRect:ofView:atCharacterIndex:" },
+    { 0xa52cff70cea5733cULL, "selectionShouldChangeInTableView:" },
+    { 0xc22f776821238beeULL, "isVisuallyHighlighted" },
+    { 0, NULL },
+    { 0x0a6896426f1c355fULL, "resourceSpecifier" },
+    { 0x9078c1cc52d85f94ULL, "moveUp:" },
+    { 0, NULL },
+    { 0x985ff216fde15414ULL, "setBidiProcessingEnabled:" },
+    { 0, NULL },
+    { 0xa3cd4e1df103d86aULL, "caseSensitive" },
+    { 0xdedff44ebc6e58e3ULL, "fullUserName" },
+    { 0x079ada3e05c5e0b3ULL, "setZeroSymbol:" },
+    { 0x169b0120f1195f92ULL, "isAutoscroll" },
+    { 0, NULL },
+    { 0xfdcc8a0930ed4725ULL, "selectParagraph:" },
+    { 0xd3e893e7ca4515a5ULL, "infoForBinding:" },
+    { 0x0e7837af2c165597ULL, "newDocument:" },
+    { 0x92fe411caaf6ec03ULL, "fontAttributes" },
+    { 0x73faf411eb101e3bULL, "sharedSpellCheckerExists" },
+    { 0, NULL },
+    { 0xaeffc4ab81309589ULL, "setAnimationCurve:" },
+    { 0x1e4397a4b581fb98ULL, "writeSafelyToURL:ofType:forSaveOperation:error:" },
+    { 0xefc688b657b6eacfULL, "currentEditor" },
+    { 0x6cee3e18b7b45b58ULL, "mode" },
+    { 0, NULL },
+    { 0x98c0678338905ecbULL, "_setSuperview:" },
+    { 0x09fc1e269a892f91ULL, "setAutoresizingMask:" },
+    { 0x6cc83a93314ffe6dULL, "removeObjectIdenticalTo:" },
+    { 0xe9727eda3a9d733eULL, "autohidesScrollers" },
+    { 0xe0a864be49abedf8ULL, "download:willSendRequest:redirectResponse:" },
+    { 0xa7b52e32b1d5002dULL, "setImportsGraphics:" },
+    { 0, NULL },
+    { 0x178ec15466b98aa5ULL, "selectedFont" },
+    { 0x3809cfde2700a730ULL, "timeIntervalSinceNow" },
+    { 0xebbac6de92fed215ULL, "setDocumentEdited:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3b23afac60a008b3ULL, "setSelectable:" },
+    { 0x43dd5a232a534eceULL, "setAutosavesConfiguration:" },
+    { 0, NULL },
+    { 0xe1922f399b14954bULL, "setLayerContentsPlacement:" },
+    { 0x9de4dd17cd5e3166ULL, "colorWithGray:alpha:spaceName:" },
+    { 0x31f7fd1e815d125bULL, "deltaY" },
+    { 0x2bfd7f6741287acdULL, "setTakesTitleFromPreviousColumn:" },
+    { 0x6f49059184962091ULL, "negativeInfinitySymbol" },
+    { 0, NULL },
+    { 0x5228ee1a1bf2e844ULL, "itemAtSelectedIndex" },
+    { 0, NULL },
+    { 0x39bca2b7e640b37eULL, "setMaximumSignificantDigits:" },
+    { 0xf60eda98816f2088ULL, "addPort:forMode:" },
+    { 0xd3100b56828cac05ULL, "setGradientType:" },
+    { 0xbadc8c62aed3f9fcULL, "setPreferredEdge:" },
+    { 0xe36c72d208518004ULL, "cornerViewFrame" },
+    { 0x2fff5fe8cace9bdaULL, "removeAllRanges" },
+    { 0x704066d836643aeaULL, "getBytes:" },
+    { 0, NULL },
+    { 0xad6427a650301b49ULL, "principalClass" },
+    { 0xc308c36c9402e094ULL, "showsResizeIndicator" },
+    { 0x547bee5fbccc0391ULL, "decodeShortForKey:" },
+    { 0xad05e16824c426dfULL, "endEditing:" },
+    { 0xa823cb02b97ab23eULL, "operationNotAllowedCursor" },
+    { 0x10ccbd6e800011e1ULL, "runModalPrintOperation:delegate:didRunSelector:contextInfo:" },
+    { 0x8dce1878665acf77ULL, "delegateShouldSelectTableColumn:" },
+    { 0x3c69aae5ef7082ebULL, "altIncrementValue" },
+    { 0, NULL },
+    { 0xc14845640abeaf29ULL, "dictionaryWithValuesForKeys:" },
+    { 0x07352d91f652120bULL, "selectorNames" },
+    { 0x7bbcfc3d82882f44ULL, "parser:foundCDATA:" },
+    { 0xe2723b0b1cf2dbadULL, "writeRichText" },
+    { 0x54d9986c3edc35abULL, "clipRect:" },
+    { 0xd6c0b8293f140a3dULL, "tag" },
+    { 0x21d6c4192a2aacd5ULL, "_extractWordOne" },
+    { 0x3e8620a267e0458dULL, "getIndexes:maxCount:inIndexRange:" },
+    { 0x112986c056461a72ULL, "setSuspended:" },
+    { 0x2fa9eacddca20344ULL, "isSubsetOfSet:" },
+    { 0x934bced8f71509aaULL, "decimalNumberBySubtracting:" },
+    { 0x9f2c6a8e0a176f97ULL, "shouldCloseDocument" },
+    { 0xd3d2bb17eff9b82eULL, "operationCount" },
+    { 0xac8b10d913295c8dULL, "heightAdjustLimit" },
+    { 0x3e28fbe446d6d55dULL, "setTag:forSegment:" },
+    { 0, NULL },
+    { 0x71ee8b9d85fb3c29ULL, "initWithDictionary:" },
+    { 0x559e07b56fc70f74ULL, "setCalendarFormat:" },
+    { 0, NULL },
+    { 0x2953434e1fdde723ULL, "removeAllToolTips" },
+    { 0xde722902e822eab0ULL, "performSelector:onThread:withObject:waitUntilDone:modes:" },
+    { 0x601ab35cac08c478ULL, "clearGLContext" },
+    { 0x00604011cb92942cULL, "ensureMapped" },
+    { 0x696c6dec45b50c66ULL, "setKnobThickness:" },
+    { 0x0b8b16990b582573ULL, "compareObject:toObject:" },
+    { 0xf3e887661818dbe4ULL, "hasLearnedWord:" },
+    { 0xb2ad176f39702d71ULL, "setData:" },
+    { 0x143bcd8643b06eeaULL, "setNeedsDisplay" },
+    { 0x82332a67a26c8fd8ULL, "autosaveDocumentWithDelegate:didAutosaveSelector:contextInfo:" },
+    { 0, NULL },
+    { 0x1061a18b6e2407a4ULL, "resizeFlags" },
+    { 0x3037417417c6afddULL, "getAdvancements:forGlyphs:count:" },
+    { 0x46754ae2f6b6a56dULL, "activate:" },
+    { 0xa485b86a8aecbcf7ULL, "signatureWithObjCTypes:" },
+    { 0x7fc7b716d5ec7b52ULL, "setHidesOnDeactivate:" },
+    { 0x6811d51de344918cULL, "setDisplayMode:" },
+    { 0x28f5d26b8e2eaa3fULL, "setWindowFrameAutosaveName:" },
+    { 0x27566be6ded3c6eeULL, "menuItemSeparatorSize" },
+    { 0, NULL },
+    { 0x079fd55a881eb40dULL, "drawInBezierPath:angle:" },
+    { 0x401bf606f7509c43ULL, "maximumIntegerDigits" },
+    { 0xff8df2831517fd27ULL, "windowDidResignMain:" },
+    { 0, NULL },
+    { 0x924c3c12266834caULL, "fileModificationDate" },
+    { 0x2ff63356e8f5817fULL, "_forcedHideForDeactivation" },
+    { 0xba4705e481dc7cc9ULL, "saveDocumentWithDelegate:didSaveSelector:contextInfo:" },
+    { 0, NULL },
+    { 0xa562d0cdb79ef7abULL, "setExecuting:" },
+    { 0x4c313c3d59234203ULL, "setMaxVisibleColumns:" },
+    { 0, NULL },
+    { 0xc6380a0ffff02f54ULL, "setMaximumFractionDigits:" },
+    { 0x4927b954fc53d981ULL, "addObjectForWrite:" },
+    { 0, NULL },
+    { 0x3bd67499dda46bf4ULL, "table" },
+    { 0xa10d2bd4ae2bc137ULL, "numberWithFloat:" },
+    { 0x17b27aa2ecbda0f4ULL, "setCacheMode:" },
+    { 0x77ee311163e4b4cfULL, "_textViewFrameDidChange:" },
+    { 0xe496960ec081a040ULL, "setPageScroll:" },
+    { 0x2b881bb97b6a7ab9ULL, "initWithFrame:" },
+    { 0xd5d7eb507408aa47ULL, "setCompression:factor:" },
+    { 0xde5f04b58f175e91ULL, "registerFrameworks" },
+    { 0, NULL },
+    { 0xb69a00f4695293eeULL, "AddRef" },
+    { 0, NULL },
+    { 0xde7ce533f87b6f26ULL, "setContentViewMargins:" },
+    { 0, NULL },
+    { 0x96f92bf2fe7b598bULL, "toolbarDefaultItemIdentifiers:" },
+    { 0x1b5198044ac5afa0ULL, "keyEnumerator" },
+    { 0x2eb3a0cd77b46d22ULL, "observeValueForKeyPath:ofObject:change:context:" },
+    { 0xa8a0a05199ba9cd7ULL, "accessibilityAttributeNames" },
+    { 0xae69ea745583def3ULL, "windowForID:" },
+    { 0, NULL },
+    { 0x751c10ba4e5d1d66ULL, "servicesMenu" },
+    { 0x9ac784e2fbd90df3ULL, "orderFrontColorPanel:" },
+    { 0x76302e8285b5615aULL, "makeMain" },
+    { 0x4187cec447e9a102ULL, "loadConfiguration" },
+    { 0x0ddd40d30c38b289ULL, "window:willPositionSheet:usingRect:" },
+    { 0x7e30aa3f39d3e752ULL, "lockWhenCondition:beforeDate:" },
+    { 0x901fc5cda5ce22efULL, "_delayedPerform:" },
+    { 0xc1b99961413bc1c1ULL, "_observedKeys" },
+    { 0xa84f5b722108ad9aULL, "setTag:" },
+    { 0x65207026bb19afa4ULL, "cellSize" },
+    { 0x1b80d2a1d207b550ULL, "stringFromNumber10_4:" },
+    { 0x5075c32d02110955ULL, "currentHost" },
+    { 0x43f5d0eb1d0c21d4ULL, "rectForBlock:layoutAtPoint:inRect:textContainer:characterRange:" },
+    { 0xb9ab823f2ddc134fULL, "_initWithRect:options:owner:userData:retainUserData:isToolTip:isLegacy:" },
+    { 0xda052781449969aaULL, "synchronizeFile" },
+    { 0x1fa05484f0b42be5ULL, "dirtyRect:" },
+    { 0x6673c4adbc576c91ULL, "pageUp:" },
+    { 0xd0838473c0ccbe66ULL, "_updateRed:green:blue:" },
+    { 0x763db9f7b5767ea8ULL, "removeTabViewItem:" },
+    { 0, NULL },
+    { 0xab5876d630cf6644ULL, "hidesEmptyCells" },
+    { 0xe5375ee8f37efe21ULL, "applicationIconImage" },
+    { 0, NULL },
+    { 0x0d1a60b0a2b589c5ULL, "measurementUnits" },
+    { 0, NULL },
+    { 0x388b71322b123187ULL, "convertRectFromBase:" },
+    { 0x9b9ab9f4e1e11dd7ULL, "objectValue" },
+    { 0, NULL },
+    { 0x7e06238fb6e3d530ULL, "selectTextAtIndex:" },
+    { 0xc40a071ff830d7b2ULL, "orthographyCheckingResultWithRange:orthography:" },
+    { 0x39f3fcb4be64c2a1ULL, "setTextAttributesForPositiveValues:" },
+    { 0x6c5ec907e304abe4ULL, "setDirectory:" },
+    { 0x75a09c0723cc9a42ULL, "scheduledTimerWithTimeInterval:target:selector:userInfo:repeats:" },
+    { 0x77a6e3c302aa8b99ULL, "isSubviewCollapsed:" },
+    { 0x5e40ec8e209881dfULL, "sizeForSizeMode:displayMode:minSize:maxSize:" },
+    { 0x46ff6da184b95827ULL, "value:withObjCType:" },
+    { 0xaf9424f7cdb435b6ULL, "openFile:withApplication:" },
+    { 0x82b1eda86e33b692ULL, "setShowsAlpha:" },
+    { 0x16ad637794dafc71ULL, "decodeInt64ForKey:" },
+    { 0x501105d0293d8417ULL, "subtype" },
+    { 0x6b23467d3813072dULL, "set:" },
+    { 0xdf63bf922db7fcecULL, "defaultConnection" },
+    { 0xee8565ccccc066c3ULL, "isTitled" },
+    { 0x17f084e6261fa0f9ULL, "displayIfNeededInRect:" },
+    { 0xe0c074a4e3d90404ULL, "showInfoPanel:" },
+    { 0x56bdabe7d4f597d5ULL, "setBadgeLabel:" },
+    { 0x84aef2fd31321372ULL, "itemChanged:" },
+    { 0, NULL },
+    { 0x0e9fe3afff09a8edULL, "setExponentSymbol:" },
+    { 0, NULL },
+    { 0x586d912e268f2809ULL, "setShowsPrintPanel:" },
+    { 0xa3980ec9ebbeee84ULL, "isTemplate" },
+    { 0x441a342edbd9f33bULL, "convertRect:fromView:" },
+    { 0xbcaffb296948cc2dULL, "modes" },
+    { 0x6c5ae573e4f9b0e7ULL, "contentSizeForFrameSize:hasHorizontalScroller:hasVerticalScroller:borderType:" },
+    { 0xa23fae44fc8bb9d9ULL, "yearOfCommonEra" },
+    { 0xf0abf58041b2a860ULL, "getGlyphs:forCharacters:length:" },
+    { 0xeb9dde8b28bbaedaULL, "drawTableViewHeaderInRect:highlighted:" },
+    { 0x223d2dd29b90477fULL, "userDefaultsChanged" },
+    { 0x8076b96a47821966ULL, "volatileDomainNames" },
+    { 0x7a508d93bbe4ed2aULL, "activeProcessorCount" },
+    { 0, NULL },
+    { 0x8e52cd79a7a981adULL, "hueComponent" },
+    { 0xf8a5d802d88a442fULL, "dataFromTXTRecordDictionary:" },
+    { 0, NULL },
+    { 0x289df1a00ddf555eULL, "widthForSegment:" },
+    { 0xf5ba03985410e9e9ULL, "inverseForRelationshipKey:" },
+    { 0xce83f9ecc75fba5eULL, "XMLString" },
+    { 0x1ddff37fcc98a95fULL, "setClassName:forClass:" },
+    { 0x3fdc90658d95baedULL, "connection:didCancelAuthenticationChallenge:" },
+    { 0x0a144277b492c5eeULL, "_selectCell:deselectOthers:" },
+    { 0, NULL },
+    { 0x9ed5989a981b3eefULL, "parentWindowDidExitMove:" },
+    { 0xf682148614553536ULL, "allHTTPHeaderFields" },
+    { 0x39bdd90031e87740ULL, "applicationDidUnhide:" },
+    { 0x41a6eecd532e5028ULL, "_postNoteDidResize" },
+    { 0x7e97ea4c89ec2fc7ULL, "_basePath" },
+    { 0xeda80ccb8ca2d7caULL, "trackMouse:inRect:ofView:atCharacterIndex:untilMouseUp:" },
+    { 0, NULL },
+    { 0xc9f93967002cba59ULL, "expectedContentLength" },
+    { 0, NULL },
+    { 0x64dcbed62acc84c3ULL, "isInFullScreenMode" },
+    { 0, NULL },
+    { 0xa30e526b72863f61ULL, "_ensureLength:" },
+    { 0, NULL },
+    { 0x8b6ff7ff964f3fd6ULL, "endUserCompletion" },
+    { 0x6c28535860d15e55ULL, "nodesForXPath:error:" },
+    { 0, NULL },
+    { 0x7da03cfc43d459afULL, "titleRect" },
+    { 0x3433cc849ddd637cULL, "setSendsActionOnArrowKeys:" },
+    { 0x868fcbeb0772c621ULL, "hideWindow" },
+    { 0xb13f045230f15a2fULL, "setRoundingBehavior:" },
+    { 0x8947c08490ffaa33ULL, "setHue:" },
+    { 0, NULL },
+    { 0x7f31306d3bdbb2aeULL, "glyphRangeForBoundingRect:inTextContainer:" },
+    { 0x7e1ed139d72946fcULL, "borderWidth" },
+    { 0x43472410eb50bfdfULL, "initWithController:" },
+    { 0x3fbb88eac3ddfde8ULL, "layoutFrames:count:" },
+    { 0xe4446000ae6bd3ccULL, "setTokenizingCharacterSet:" },
+    { 0x9dbc2968dc7d9c17ULL, "_undoManagerDidRedoChange:" },
+    { 0x6a08c3bc1439325fULL, "removeObjectForKey:" },
+    { 0, NULL },
+    { 0xe2dd6625298e157bULL, "setUpGState" },
+    { 0x6a193fc779e53b1eULL, "viewDidMoveToSuperview" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xed5899b29de71d15ULL, "notifyDelegateOfCurrentActivity" },
+    { 0xd07117ada7df02abULL, "insertParagraphSeparator:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb16ff42d94e34781ULL, "sharedDictionary" },
+    { 0x73ef9e565755850cULL, "arrowImage" },
+    { 0xb64de63787cad7a9ULL, "disabledControlTextColor" },
+    { 0xa55acd7cf3559df9ULL, "validateValue:forKey:error:" },
+    { 0xbd0af9a0fe3f5d0cULL, "builtInPlugInsPath" },
+    { 0x3d5ef4f91caf5108ULL, "isSelectedForSegment:" },
+    { 0x14ace4cb338f1529ULL, "completionDelay" },
+    { 0x8fe5a1e862b3e094ULL, "KVO_notifying_change_addKeyObject:" },
+    { 0, NULL },
+    { 0xfed76d244174d9d2ULL, "maximumLineHeight" },
+    { 0, NULL },
+    { 0xabc6ddbe9c669613ULL, "customizationPaletteIsRunning" },
+    { 0x9f044b7fff274bd2ULL, "representedFilename" },
+    { 0, NULL },
+    { 0xf51a9e42bf68971cULL, "setNumberOfMajorTickMarks:" },
+    { 0x27a90804c4473b9bULL, "sortIndicatorRectForBounds:" },
+    { 0xaa7767f63ea206bbULL, "warningValue" },
+    { 0xc27ea5b382c7fbfbULL, "defaultTimeZone" },
+    { 0x151c7af32b14d1f7ULL, "finalizeProcess" },
+    { 0x2f2867fe76e309e9ULL, "selectedMenuItemColor" },
+    { 0x95581c94fd183d38ULL, "setContentResizeIncrements:" },
+    { 0x9ee8dbb8c29193e1ULL, "selectTabViewItem:" },
+    { 0, NULL },
+    { 0x9a3008f35132e7d1ULL, "cursorWithName:" },
+    { 0x9f0e01c9ef0c6879ULL, "setWantsRestingTouches:" },
+    { 0x348976fe7899c67aULL, "drawSegment:inFrame:withView:" },
+    { 0xa6b115b95faa426cULL, "activeColorInfo" },
+    { 0x4a0963131209197cULL, "isPlanar" },
+    { 0x22defeceac91358cULL, "options" },
+    { 0xd0c60b69d3c253e1ULL, "headerToolTip" },
+    { 0xb1634365735f1d87ULL, "setDescriptionFunction:" },
+    { 0x88aea55d7edb4629ULL, "defaultTokenizingCharacterSet" },
+    { 0xc5d6e24f3c4c0e52ULL, "restOfPath" },
+    { 0x0734fce088b5bd7cULL, "processImmediateEvents:" },
+    { 0xf20368a32fb08d65ULL, "defaultTabInterval" },
+    { 0, NULL },
+    { 0x535030baba4bd91fULL, "_setWindow:" },
+    { 0, NULL },
+    { 0x3ffd34b78d755fdaULL, "setImageDimsWhenDisabled:" },
+    { 0xbd89a71f86622a5aULL, "backgroundColors" },
+    { 0x0154f3f8878e8994ULL, "removeObject:inRange:" },
+    { 0x3ea194bce53e1ad1ULL, "delegate" },
+    { 0xe044b28f046d48a9ULL, "setSegmentCount:" },
+    { 0, NULL },
+    { 0x31a6fd7822464b97ULL, "availableFonts" },
+    { 0x63672b5e9c370a0eULL, "drawBoxWithGrooveInRect:clipRect:" },
+    { 0xc180095c5aaf8d42ULL, "canAddChid" },
+    { 0x00200dbd03289abdULL, "selectedColumn" },
+    { 0x9456f7ef5277b8f9ULL, "getObjects:" },
+    { 0x73399e3947cdfca4ULL, "timerWithTimeInterval:target:selector:userInfo:repeats:" },
+    { 0, NULL },
+    { 0x7b043096734a17b6ULL, "shouldCascadeWindows" },
+    { 0x6ea56a6a559ce896ULL, "stringByExpandingTildeInPath" },
+    { 0xd12bf65309ef0763ULL, "ascending" },
+    { 0x55c740f43ba2ca9eULL, "moveRight:" },
+    { 0x9fa01b7b8dd62d54ULL, "convertRectToBase:" },
+    { 0x13a6c16784c10661ULL, "setLabel:forSegment:" },
+    { 0x2b19bc554958298aULL, "smallSystemFontSize" },
+    { 0x364a834bfed81719ULL, "setTitlePosition:" },
+    { 0x559ce21b7915c628ULL, "stringByStandardizingPath" },
+    { 0xed3a6ea965a70809ULL, "window" },
+    { 0x1b3f7ca4603b8e89ULL, "methodReturnType" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x43100f11a8e45582ULL, "runInNewThread" },
+    { 0x8a342781e5dd6ee2ULL, "stop" },
+    { 0xcad8a46b7452d40bULL, "setIdentifier:" },
+    { 0x72564cc77b142a09ULL, "availableTypeFromArray:" },
+    { 0x0dcd2ecf353a9122ULL, "blackColor" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xad9a76618dd40424ULL, "CGBitmapInfo" },
+    { 0x65a31bc71ea9d6afULL, "addUnprocessedEvent:" },
+    { 0x3c3edc46a4c82b26ULL, "_didChange" },
+    { 0, NULL },
+    { 0x31aeb23d8ec81fecULL, "handleMonitorWithHandle:" },
+    { 0xec34e615a3e4a2ffULL, "isOnActiveSpace" },
+    { 0, NULL },
+    { 0x75a56783085dc69eULL, "registerUnitWithName:abbreviation:unitToPointsConversionFactor:stepUpCycle:stepDownCycle:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xfdd18c5cc4f49c6cULL, "viewDidUnhide" },
+    { 0x927d97d36dd9fe1dULL, "currentQueue" },
+    { 0xada7f1a487bafa9bULL, "setShowsHelp:" },
+    { 0xbe5e65ef06ce38c6ULL, "windowNumberAtPoint:belowWindowWithWindowNumber:" },
+    { 0x71f81d7bdce5e828ULL, "open" },
+    { 0x715bcbc39dd84709ULL, "collectionNames" },
+    { 0xeae00044ff7351cbULL, "setCanHide:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x182504a6aeef1f1fULL, "autorecalculatesKeyViewLoop" },
+    { 0, NULL },
+    { 0xdfa5ed3403da6d51ULL, "replaceSubview:with:" },
+    { 0, NULL },
+    { 0xbe9194e9e64a7aeaULL, "synchronizeFontCTM" },
+    { 0x39b16f72d5f248ffULL, "beep" },
+    { 0xdf32dc04dd6accc9ULL, "currentOperation" },
+    { 0x06051e353d681fe7ULL, "icon" },
+    { 0x0e04bd959222be1aULL, "setPlusSign:" },
+    { 0x0045c4fd1ffc7223ULL, "_KVO_swizzle" },
+    { 0x1ac9480ff505f414ULL, "customizationPaletteDidFinish:" },
+    { 0xbc6779215d7a9fd3ULL, "autosaveName" },
+    { 0xcdbaaa30bd26551dULL, "setUserFixedPitchFont:" },
+    { 0x2181814e0b6b4fa0ULL, "registerForDraggedTypes:" },
+    { 0x0dc8e155af9f6630ULL, "keyEquivalentModifierMask" },
+    { 0xd9e6c679ec37db0bULL, "subitems" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf333bb21aaaa4965ULL, "fontAttributesInRange:" },
+    { 0xa2b9128a51291d8fULL, "_w32loadMenuItem:withIdentifier:intoMenu:" },
+    { 0x9db91bc9b10fea04ULL, "maxVisibleColumns" },
+    { 0xa5e97696567a6845ULL, "indexOfItemWithTag:" },
+    { 0x520f2252d3e7e0e8ULL, "XMLData" },
+    { 0xb40b2fb40081b78fULL, "fetchMetrics" },
+    { 0x8ec8e131229001b7ULL, "_runOpenPanel" },
+    { 0x4bc33b1cfb89f3b3ULL, "setTitleWithMnemonic:" },
+    { 0, NULL },
+    { 0xb022470901927b1cULL, "drop:" },
+    { 0xec441e93036c62e0ULL, "autosaveTableColumns" },
+    { 0x9c506c550e9be6d6ULL, "makeObjectsPerformSelector:withObject:" },
+    { 0x9427b5372dd775d3ULL, "controlAlternatingRowBackgroundColors" },
+    { 0xadde69736fdad89aULL, "isVerticallyCentered" },
+    { 0xc205ee367bc795c8ULL, "setInitialValue:" },
+    { 0x3ffa8084172ad828ULL, "fractionOfDistanceThroughGlyphForPoint:inTextContainer:" },
+    { 0x67f37bd50a723085ULL, "drawBrowserHorizontalScrollerWellInRect:clipRect:" },
+    { 0xc254406e6e3e14c3ULL, "printProgressPanelController" },
+    { 0, NULL },
+    { 0x0671ff4553ad2aedULL, "clear:" },
+    { 0x8af190feb1ac430eULL, "tailIndent" },
+    { 0xc23fbf1ae8b44a3dULL, "currentValue" },
+    { 0xb6cf4519ef207a4eULL, "drawAtPoint:fromRect:operation:fraction:" },
+    { 0x42d39e5b3d75b172ULL, "endParagraph" },
+    { 0xa5c0265af389f6d5ULL, "colorWellDidBecomeExclusive:" },
+    { 0x97aefbf1ed4d0aa3ULL, "close" },
+    { 0x345ade66f435d7eeULL, "windowDidBecomeKey:" },
+    { 0, NULL },
+    { 0x6001344c2052f003ULL, "setDrawsBackground:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x7b712d2d07641003ULL, "setTreatsFilePackagesAsDirectories:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xcd8aba7a87fe9725ULL, "viewAtSelectedIndexPositionOnScreen:" },
+    { 0x1444af52106f4fdcULL, "application:willPresentError:" },
+    { 0x9f64f32073829b39ULL, "moveWordLeft:" },
+    { 0xcb3f9b684c7d5078ULL, "encodeValueOfObjCType:at:" },
+    { 0xd15deccf644f032aULL, "localizedNameOfStringEncoding:" },
+    { 0xf2cd692bfeff5f01ULL, "getRow:column:ofCell:" },
+    { 0x24e6e4d301e038bdULL, "languageMap" },
+    { 0x19f4620f36ecbe9aULL, "layoutViews" },
+    { 0xc3dc2f5668f0cc6bULL, "attributeKeys" },
+    { 0, NULL },
+    { 0xaa7abb9d814c51a0ULL, "allowsTruncatedLabels" },
+    { 0xc9a7dae6cab28d82ULL, "setSelectionIndexPath:" },
+    { 0x5bc03d051d66f89bULL, "selectedRange" },
+    { 0x6fb6a69c34a81a08ULL, "setMnemonicLocation:" },
+    { 0xa4b6e25e98f81a41ULL, "setSelectEventMask:" },
+    { 0xbb56ecd27faf733bULL, "standardUserDefaults" },
+    { 0xe026d999b8456ba5ULL, "rangeOfTextList:atIndex:" },
+    { 0xc363d626d43b9759ULL, "setSendsSearchStringImmediately:" },
+    { 0, NULL },
+    { 0x4dcabede2617368aULL, "knobThickness" },
+    { 0x3727489824c31575ULL, "numberWithUnsignedChar:" },
+    { 0x1681bb7adf12d3f2ULL, "setNextText:" },
+    { 0xd628a4de43a06490ULL, "updateFontPanel" },
+    { 0xc4fee7fdf9092c64ULL, "allowsUserCustomization" },
+    { 0xca71825ad868e8b4ULL, "primaryScreenHeight" },
+    { 0x837f1b02505c3555ULL, "postsBoundsChangedNotifications" },
+    { 0x93776020256e61faULL, "_labelAttributesForSizeMode:" },
+    { 0xe302323f9fa35d82ULL, "alignCenter:" },
+    { 0xf02abcf0249d7f87ULL, "fileManager:shouldLinkItemAtPath:toPath:" },
+    { 0x6cf0178d9a6d821fULL, "dragOperationForDraggingInfo:type:" },
+    { 0, NULL },
+    { 0xfac84d982031b5ccULL, "setDoubleAction:" },
+    { 0xa8cf7be6ed6685c4ULL, "hasPassword" },
+    { 0xf9fb58396cf0926eULL, "itemWithTitle:" },
+    { 0xc8e4ce7a69211e7cULL, "drawAttributedString:inRect:" },
+    { 0xb50379e0478d30e1ULL, "automaticRearrangementKeyPaths" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb29187cdafd2deb6ULL, "didChangeAppearanceGlobal:" },
+    { 0x8b2868bed2a90c3bULL, "shouldReportNamespacePrefixes" },
+    { 0x7a5f17f48e0b5a11ULL, "changeCurrentDirectoryPath:" },
+    { 0xf4543c172913dbeeULL, "iconForFiles:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x961e35a543013528ULL, "initWithFlipped:" },
+    { 0x2827de23e7b92be1ULL, "application:printFile:" },
+    { 0xc8d8034e84bd11c9ULL, "selectNext:" },
+    { 0x8c457b29c9789115ULL, "_setVisible:" },
+    { 0x6a9368e7530f13f8ULL, "setDestination:" },
+    { 0x52d27193fbd63e9cULL, "hasValidObjectValue" },
+    { 0x8f29bd6cb2544fc3ULL, "lockFocus" },
+    { 0x1949cabde2036d1eULL, "diskCapacity" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3bc24906dd42fe6cULL, "paletteFontOfSize:" },
+    { 0x888746b4436a377eULL, "allowsNaturalLanguage" },
+    { 0x31f8ce4bc64e2e8cULL, "showsAlpha" },
+    { 0xc32e1f015f6c8a81ULL, "indentationPerLevel" },
+    { 0x6784ea3d94f10f15ULL, "_defaultBindingOptionsForBinding:" },
+    { 0x932afb499f6d7e8eULL, "linkItemAtPath:toPath:error:" },
+    { 0, NULL },
+    { 0x01bb6bf89692d9cdULL, "translateXBy:yBy:" },
+    { 0xa00166eb155b4cc9ULL, "shouldCloseWindowController:" },
+    { 0x3f7ff55054dc99cdULL, "setAssociatedPoints:atIndex:" },
+    { 0x7c4ed5e958d90ff2ULL, "setParentWindow:" },
+    { 0, NULL },
+    { 0x1e1d51ad27bb463fULL, "setTextAttributesForPositiveInfinity:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x201cfe2eca38967eULL, "sizeOfLabel:" },
+    { 0x4c5ff51bb6384d2dULL, "setDefaultWindingRule:" },
+    { 0x64bc9bbbb8889470ULL, "displayIfNeededInRectIgnoringOpacity:" },
+    { 0xc225a0c710b6c8afULL, "baselineOffsetInLayoutManager:glyphIndex:" },
+    { 0x12e08b11f9944faaULL, "setKeys:triggerChangeNotificationsForDependentKey:" },
+    { 0x359651fe42e2b5caULL, "port" },
+    { 0x32e72e5c4fcc543cULL, "textAttributesForZero" },
+    { 0xa565cff86e77d0e5ULL, "_downArrowFrameForStepperFrame:" },
+    { 0xdae0ffe3ee22b4baULL, "_setAnimate:" },
+    { 0x3d6941cf50859067ULL, "insertTabIgnoringFieldEditor:" },
+    { 0x0a7d2fe8adc1ac36ULL, "undoMenuItemTitle" },
+    { 0x7808fcccece009fcULL, "drain" },
+    { 0x73b59e74aa201f4bULL, "hitTest:" },
+    { 0, NULL },
+    { 0x512a7c9d8ea92540ULL, "expressionForKeyPath:" },
+    { 0xf2d51d11403e51bfULL, "prepareCell:inRow:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x27f95df2c061bcaaULL, "currentHandler" },
+    { 0, NULL },
+    { 0x5a03aa8aee80323aULL, "removeAllCachedResponses" },
+    { 0, NULL },
+    { 0xc97cc39a367ef4e6ULL, "initWithString:modifierMask:selectorNames:" },
+    { 0x1d0429cafa14f324ULL, "parser:didEndMappingPrefix:" },
+    { 0x6b12c02260ef2ad3ULL, "cornerView" },
+    { 0, NULL },
+    { 0x02b7a4d8fd515739ULL, "toolbarChangedAppearance:" },
+    { 0, NULL },
+    { 0x10514a33d554556bULL, "stopTracking:at:inView:mouseIsUp:" },
+    { 0xec9379ca2527f5f8ULL, "removeTextContainerAtIndex:" },
+    { 0x8a1cfc7892f4fc64ULL, "quoteCheckingResultWithRange:replacementString:" },
+    { 0x5194dc4dbaa85673ULL, "_setSelectedValue:" },
+    { 0x26a6d65e5949942dULL, "visibleWindows" },
+    { 0xcab704534020df70ULL, "getLineFragmentRect:usedRect:forParagraphSeparatorGlyphRange:atProposedOrigin:" },
+    { 0xf3ef3482bdbec2a5ULL, "stopObservingChanges" },
+    { 0x97292d65eacebd29ULL, "setSelectedTextAttributes:" },
+    { 0x78e1b44a2e22b5daULL, "usesStrongWriteBarrier" },
+    { 0x88cc779e4b854752ULL, "setPickerMode:" },
+    { 0xb3c1b14b04a9e303ULL, "circularSliderKnobGradient" },
+    { 0x9f297d221128fd53ULL, "drawPushButtonHighlightedInRect:" },
+    { 0x866d7216fc2bc2aeULL, "stringForType:" },
+    { 0x790e246f98741dacULL, "darkGrayColor" },
+    { 0x70a77d9aa5cee0f7ULL, "subdataWithRange:" },
+    { 0x90427d64ec057fe1ULL, "nextSibling" },
+    { 0x536a5b78c42235feULL, "runHandshakeIfNeeded:" },
+    { 0xea2f83b3a285ac1fULL, "mutableString" },
+    { 0x0c0ef90df2cd3125ULL, "updateCellInside:" },
+    { 0x355458f50fb3b4dfULL, "insertBacktab:" },
+    { 0x0c4dd4ccda51023eULL, "setIntegerValue:" },
+    { 0, NULL },
+    { 0xd18076259c2acf90ULL, "reportException:" },
+    { 0x5ec9b8c4e7a8150cULL, "setMatrixClass:" },
+    { 0xd0d0c64a906c8c02ULL, "selectAll:" },
+    { 0x2bf7dfa4bc9f60a7ULL, "firstTextViewForTextStorage:" },
+    { 0x31712e33ea62320bULL, "pasteboardChangedOwner:" },
+    { 0x45edbd60114d2e02ULL, "addRange:" },
+    { 0xe3f608ec6a5b3b19ULL, "setAllowsMultipleSelection:" },
+    { 0xcaee3fc6afeca380ULL, "setCellSize:" },
+    { 0x6216037853adca0fULL, "inputSourceSetForInputSource:" },
+    { 0, NULL },
+    { 0x215779f4f1849a18ULL, "fileAttributesToWriteToFile:ofType:saveOperation:" },
+    { 0x55b47379d735a4deULL, "_continuation" },
+    { 0x0e68f2d9ebaeb14dULL, "sharedURLCache" },
+    { 0x8ff70265d61b4db3ULL, "stringByReplacingOccurrencesOfString:withString:" },
+    { 0x66b34e64766fb8caULL, "labelAttributes" },
+    { 0xbd4f3de8b50b5e2dULL, "numberOfItems" },
+    { 0x15fb8c92a40452dbULL, "branchImage" },
+    { 0xa3f8f3cbe83e1eedULL, "checkString:offset:types:options:orthography:wordCount:" },
+    { 0x1de63e7efb714f5bULL, "windowController" },
+    { 0x7c6111a5218956d2ULL, "setMarkerLocation:" },
+    { 0x9086135769cb3689ULL, "jobDisposition" },
+    { 0x360be8c9f42c81d5ULL, "clickedColumn" },
+    { 0x8ae38455ca7d867dULL, "createGDIFontSelectedInDC:" },
+    { 0x0b12af7b0b3854f2ULL, "colorWithDeviceHue:saturation:brightness:alpha:" },
+    { 0xe136c898bc442e8dULL, "percentSymbol" },
+    { 0x20740cd7fb508862ULL, "setConfigurationFromDictionary:" },
+    { 0x3b56336435fb106dULL, "breakLock" },
+    { 0xad8aed4b9ade427eULL, "numberWithUnsignedInteger:" },
+    { 0x6a711dc050895128ULL, "frameAutosaveName" },
+    { 0x6729111095e5d081ULL, "style" },
+    { 0x0777f079f60eab9cULL, "moveItemAtPath:toPath:error:" },
+    { 0x4e6e722a87a88c3eULL, "appendBezierPathWithPackedGlyphs:" },
+    { 0xa4bd0788e67dbe90ULL, "setDynamicDepthLimit:" },
+    { 0, NULL },
+    { 0x0fe5a56374ba3fe1ULL, "setDoubleValue:" },
+    { 0, NULL },
+    { 0xe16f0b190559b328ULL, "setTrailingOffset:" },
+    { 0x084381824146ad96ULL, "expressionForOperator:arguments:" },
+    { 0, NULL },
+    { 0x32c6ec70d8a14bcaULL, "downloadDidBegin:" },
+    { 0xd784b58ff8682aa6ULL, "setHidesEmptyCells:" },
+    { 0xd639f7cb838e2c3bULL, "setAutorepeat:" },
+    { 0xdfaab7f88a349ac0ULL, "tableView:shouldEditTableColumn:row:" },
+    { 0x123ceddb3dfd11e2ULL, "fileAttributesAtPath:traverseLink:" },
+    { 0x30cc9d16fcff885aULL, "_discardCursorRectsForView:" },
+    { 0, NULL },
+    { 0x3fac80f36d2b596cULL, "dependencies" },
+    { 0xa2c4f13959ea8fe7ULL, "resetBytesInRange:" },
+    { 0x00264e4b5ecff623ULL, "properties" },
+    { 0xdae0fbc0f3e42353ULL, "setDeletesFileUponFailure:" },
+    { 0x839c22aafa2ed2daULL, "updateFromPath:attributes:" },
+    { 0x305181307453a7f2ULL, "shouldResolveExternalEntities" },
+    { 0xd08d85e3ac299e83ULL, "isFieldEditor" },
+    { 0x493488cc6c5c0f33ULL, "modifyFont:" },
+    { 0x22d1869add7da62fULL, "setColorSpace:" },
+    { 0x1c7397b9af8e1136ULL, "setMinWidth:" },
+    { 0x7b8384779df406dbULL, "unbind:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe9433ea02444c82bULL, "month" },
+    { 0x2d95c35eb8d1abebULL, "windowShouldClose:" },
+    { 0xaf68f18f0a115beaULL, "drawShading:" },
+    { 0, NULL },
+    { 0x9177cd4037b933ecULL, "isBitmapContext" },
+    { 0x6c4dc986295655f1ULL, "documentContentKind" },
+    { 0xb443c318105d4a7bULL, "textContainerForGlyphAtIndex:effectiveRange:" },
+    { 0x667325bf89872b88ULL, "openDocument:" },
+    { 0x3a6daeabbd047fa0ULL, "translateRectsNeedingDisplayInRect:by:" },
+    { 0x6ee9f120dda17fcdULL, "message" },
+    { 0, NULL },
+    { 0x3b6fb8024af7312eULL, "copyWithZone:" },
+    { 0x0b34ea1723e61fecULL, "addItem:" },
+    { 0, NULL },
+    { 0x6053e1fa9286a8cbULL, "setDataSource:" },
+    { 0, NULL },
+    { 0x603b1a85b4a640adULL, "getValues:forAttribute:forVirtualScreen:" },
+    { 0x9fa3a484ef5c08a9ULL, "removeContextHelpForObject:" },
+    { 0xd0193cc5fea9dfd8ULL, "setHardInvalidation:forGlyphRange:" },
+    { 0x32b54c00e85c1b19ULL, "convertFont:" },
+    { 0xe1341b5cec65dbcaULL, "textureTarget" },
+    { 0x95c2ea2d94ac47dbULL, "translateOriginToPoint:" },
+    { 0xc438528c8cf3c552ULL, "writablePasteboardTypes" },
+    { 0xf77bedca422c5211ULL, "willPresentError:" },
+    { 0xb8beb2e4338edc25ULL, "createColorInfo" },
+    { 0x34e03f30d8c8307fULL, "fixAttributesAfterEditingRange:" },
+    { 0xd2efbec44c07a6d5ULL, "trackingNumber" },
+    { 0x4de43eeea15dc2d8ULL, "_platformCurrentLocaleIdentifier" },
+    { 0x92e560c782c8ac49ULL, "_autopaginatePageRange:actualPageRange:context:" },
+    { 0xbfe9470918b0da81ULL, "_setLoaded:" },
+    { 0xcbb941b89bdf23a0ULL, "_documentController:didCloseAll:contextInfo:" },
+    { 0x62d0c5eee82caa3eULL, "skipDescendants" },
+    { 0xfcf044a09a7c3fceULL, "allObjects" },
+    { 0x83d3b129acbb7f0eULL, "alternateTitle" },
+    { 0xf644ad37cfb84f4bULL, "fileAttributesToWriteToURL:ofType:forSaveOperation:originalContentsURL:error:" },
+    { 0, NULL },
+    { 0x5bf0f0dcf7995d58ULL, "CGColorRef" },
+    { 0x0880316e02e77571ULL, "addButtonWithTitle:" },
+    { 0x26065a0971c969d0ULL, "moveWordRightAndModifySelection:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb6e930ebd2a5a3c1ULL, "stringByAddingPercentEscapesUsingEncoding:" },
+    { 0x0bf4376d25652c02ULL, "setFrameRate:" },
+    { 0x170ee4b7c0f854deULL, "setShouldProcessNamespaces:" },
+    { 0x1903b2d29665cfe4ULL, "setIntValue:" },
+    { 0xe05805c72d9b2891ULL, "addObjectForRead:" },
+    { 0xfaefe2ba431e05c3ULL, "acquireFunction" },
+    { 0xa55fc18eda2617faULL, "fileSystemRepresentationW" },
+    { 0x013c97804355b0b8ULL, "skipDescendents" },
+    { 0xc257f39d9fc6911cULL, "replaceObjectsAtIndexes:withObjects:" },
+    { 0, NULL },
+    { 0xbe45b0634ac5e2dcULL, "setTransformStruct:" },
+    { 0x76ba1352897b7619ULL, "setClosestDoubleValue:" },
+    { 0x3ae6324bc49e7495ULL, "draggedImage:endedAt:operation:" },
+    { 0xcd15bf5f5dc0b9c5ULL, "addresses" },
+    { 0xeab9e2a3d18020f6ULL, "makePreviousSegmentKey" },
+    { 0, NULL },
+    { 0xae218bdb40c953fcULL, "generatesDecimalNumbers" },
+    { 0x560a77146ce81aadULL, "brightnessComponent" },
+    { 0x9e2bc19990fbad44ULL, "capitalizeWord:" },
+    { 0xcbae636724587003ULL, "fetchGlyphRanges" },
+    { 0x6439a3af180af20dULL, "windowDidDeminiaturize:" },
+    { 0xad0445677fae3731ULL, "canRemove" },
+    { 0x024b2a4c0b0d7611ULL, "propertyList:isValidForFormat:" },
+    { 0, NULL },
+    { 0x434345889c691945ULL, "encodeClassName:intoClassName:" },
+    { 0, NULL },
+    { 0x40d8a8670326ab99ULL, "isEnabledForSegment:" },
+    { 0x43ab389b158bedd2ULL, "removeObjectsForKeys:" },
+    { 0x1c7acb871dad3ac3ULL, "layout" },
+    { 0x38cb01ec8bd6eb1eULL, "attributesForExtraLineFragment" },
+    { 0, NULL },
+    { 0xa0f51f47096965d5ULL, "size" },
+    { 0x41a3c3387988c727ULL, "setMiniwindowImage:" },
+    { 0x014915a606fefda5ULL, "UTF8String" },
+    { 0x2f6592d08199408dULL, "_initWithDefaults" },
+    { 0xc0769832e4aec291ULL, "windingRule" },
+    { 0xa7268d8491d285e8ULL, "createHeaderAndCornerViewsIfNeeded" },
+    { 0x2f89d2ea42db2876ULL, "invalidateRunningCopyPipe" },
+    { 0xd298f60333a68688ULL, "sizeForSizeMode:displayMode:" },
+    { 0x1a47ff38cf96ed3dULL, "validateVisibleColumns" },
+    { 0xc1763dc3a44a03caULL, "archiver:didEncodeObject:" },
+    { 0, NULL },
+    { 0x25fd66ed60b00ed2ULL, "moveLeftAndModifySelection:" },
+    { 0xb2d8f5ed5ebc8463ULL, "dissolveToPoint:fraction:" },
+    { 0x84317ec6baa57705ULL, "control:textShouldEndEditing:" },
+    { 0xaf8e9b063b8ad572ULL, "clearsFilterPredicateOnInsertion" },
+    { 0x6fd47433e4244cbfULL, "setPlaceholderString:" },
+    { 0x5ddd495951c4df7dULL, "isDaylightSavingTime" },
+    { 0x6826d114b8a6821cULL, "clickCount" },
+    { 0xe213d732d94acbafULL, "cellClass" },
+    { 0x7b7c79d5782ee6eeULL, "setMaxDate:" },
+    { 0x08a902c59d496354ULL, "showsStateBy" },
+    { 0xf10b07417b342781ULL, "itemNumberInTextList:atIndex:" },
+    { 0x04c3bd2bf7352243ULL, "fileExistsAtPath:" },
+    { 0x28bfce16febe1658ULL, "_setSelectedRowIndexes:" },
+    { 0xe65112516b569025ULL, "getLineFragmentRect:usedRect:remainingRect:forStartingGlyphAtIndex:proposedRect:lineSpacing:paragraphSpacingBefore:paragraphSpacingAfter:" },
+    { 0xee22080c51f53817ULL, "_content" },
+    { 0xa0f67a892e368d0aULL, "setNextKeyView:" },
+    { 0x26051dfb6d284fd3ULL, "menuBarFontOfSize:" },
+    { 0xa8fc20456830e2c4ULL, "minimumDecimalNumber" },
+    { 0, NULL },
+    { 0x3535ace25461facdULL, "resolvesAliases" },
+    { 0xb67e1ae775aa77a2ULL, "beginSheetForDirectory:file:types:modalForWindow:modalDelegate:didEndSelector:contextInfo:" },
+    { 0xa7dfe53e7216757bULL, "loadWindow" },
+    { 0xc64f9e0dc4cc03bbULL, "canBecomeMainWindow" },
+    { 0x2790ebaf0640b736ULL, "isLeaf" },
+    { 0xee93cb039c974431ULL, "shadow" },
+    { 0x65635e7b727d5aa7ULL, "peerBinders" },
+    { 0xc85495cf7b39a7b4ULL, "enumeratorAtPath:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xef1c1d0278ce259dULL, "outlineView:shouldExpandItem:" },
+    { 0xc94f62f2f16d70b6ULL, "canInsertChild" },
+    { 0, NULL },
+    { 0x576d99419ad32353ULL, "setMaximum:" },
+    { 0x61b72476930fe4cbULL, "writeToURL:atomically:" },
+    { 0, NULL },
+    { 0xb43fdd20a0c081d8ULL, "zero" },
+    { 0x4c4d86c8c9659d44ULL, "revertToInitialValues" },
+    { 0, NULL },
+    { 0x0adc5072fc4cb955ULL, "setPlaceholderAttributedString:" },
+    { 0x6174ecc4244f60e0ULL, "setContentMaxSize:" },
+    { 0xc11e0d44484b4cddULL, "closeSpellDocumentWithTag:" },
+    { 0xa385939314553d1fULL, "beginSheet:modalForWindow:modalDelegate:didEndSelector:contextInfo:" },
+    { 0xf3f58da27d7f8f88ULL, "download:didReceiveResponse:" },
+    { 0x475b28e35f4f9e90ULL, "fileManager:shouldProceedAfterError:movingItemAtPath:toPath:" },
+    { 0x576babcdb2ae16d2ULL, "colorAtIndex:" },
+    { 0, NULL },
+    { 0xdea0e56e7c6f162cULL, "poofImages" },
+    { 0x4c16fb3db7a027aaULL, "columnsInRect:" },
+    { 0x587312616f874035ULL, "download:didCreateDestination:" },
+    { 0xa97457a0cab7c794ULL, "preflightAndReturnError:" },
+    { 0x107b143b2c73cc19ULL, "removeWindowController:" },
+    { 0xaf691aa5e2734b25ULL, "layoutIfNeeded" },
+    { 0x14335cf45f73c957ULL, "detachNewThreadSelector:toTarget:withObject:" },
+    { 0xbc91051ae00cd67dULL, "rotateByAngle:" },
+    { 0x1e318477d767ceb7ULL, "invalidateShadow" },
+    { 0x249ee2d9eae803b5ULL, "seekToFileOffset:" },
+    { 0x5b1078c6c8f21f42ULL, "setKeyEquivalentModifierMask:" },
+    { 0x671e454a2037187dULL, "rulerView:didMoveMarker:" },
+    { 0x6e661936ba3d191eULL, "sleepUntilDate:" },
+    { 0x51de6175a490e4a1ULL, "attributedStringForObjectValue10_0:withDefaultAttributes:" },
+    { 0xf50f8702367dea7dULL, "initWithIndexes:length:" },
+    { 0x616cba98758f245fULL, "closeFile" },
+    { 0, NULL },
+    { 0x0d2e5facb3483ad3ULL, "scanInteger:" },
+    { 0x68e98dffa9fa73e9ULL, "needsPanelToBecomeKey" },
+    { 0x0c024848d64c0fc9ULL, "drawBackgroundForBlock:withFrame:inView:characterRange:layoutManager:" },
+    { 0x7fa64db9d791fddbULL, "borderRect" },
+    { 0, NULL },
+    { 0x6734605e1abb6c02ULL, "setProperty:forKey:" },
+    { 0x2b8ea29ef8368938ULL, "addTimer:forMode:" },
+    { 0xed455e4e4ad61219ULL, "setBoxType:" },
+    { 0x391959fbc4515867ULL, "parse" },
+    { 0, NULL },
+    { 0x2db967d5befba019ULL, "bezierPathByFlatteningPath" },
+    { 0xa3266a7ad2f54326ULL, "addCollection:options:" },
+    { 0x2bcda92646a6f513ULL, "flushFontInfo" },
+    { 0x75af4287cf6bd02cULL, "miniwindowImage" },
+    { 0x1e73017fc3da3273ULL, "fakeWindow" },
+    { 0, NULL },
+    { 0x9ac9c15df2911cc9ULL, "URLs" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x447c7d1cecbe0634ULL, "drawSliderTrackInRect:vertical:hasTickMarks:" },
+    { 0x076a86bb00ea7902ULL, "dayOfYear" },
+    { 0, NULL },
+    { 0x4937c9846690529fULL, "_rollbackLatestFragment" },
+    { 0, NULL },
+    { 0x82df0e158cfab51dULL, "dataUsingEncoding:" },
+    { 0, NULL },
+    { 0xfb895a6785c916fbULL, "rectForPart:" },
+    { 0xebde0f4def2a00fcULL, "encodeInt64:forKey:" },
+    { 0, NULL },
+    { 0x460748c87fabd1bdULL, "plusSign" },
+    { 0x6340e498ec2e51eeULL, "physicalMemory" },
+    { 0x022ca7646e4c4f9eULL, "setGeneratesDecimalNumbers:" },
+    { 0, NULL },
+    { 0x6768309778da98fdULL, "removeItem:" },
+    { 0xd93ce3269f3f6fb1ULL, "runLoopUndo:" },
+    { 0x6d0c96a1a7a0174cULL, "keyEventWithType:location:modifierFlags:timestamp:windowNumber:context:characters:charactersIgnoringModifiers:isARepeat:keyCode:" },
+    { 0xafc40b4000af5327ULL, "encodePropertyList:indent:" },
+    { 0x6c46a6bf98b955acULL, "targetRect" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf5834bd4fe7bb330ULL, "addObserver:selector:name:object:suspensionBehavior:" },
+    { 0xf4bbc55d208d8fa8ULL, "hostWithAddress:" },
+    { 0xd87754d35c8f6bacULL, "splitView:resizeSubviewsWithOldSize:" },
+    { 0x94578f3669d48e74ULL, "cStringLength" },
+    { 0x94c77be24816b29cULL, "contentViewMargins" },
+    { 0xb0e90d34d6ae5ad9ULL, "setDefaultLineJoinStyle:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf67dae52445f7438ULL, "setTemporaryAttributes:forCharacterRange:" },
+    { 0x4389b5aa5c35c41eULL, "addTemporaryAttribute:value:forCharacterRange:" },
+    { 0xa8b4e52e221be8cbULL, "arrangeInFront:" },
+    { 0, NULL },
+    { 0xc8797ed57ee39d9eULL, "addChildWindow:ordered:" },
+    { 0x0b0daf4f34af4cdfULL, "setRequestTimeout:" },
+    { 0xa8f9c2442909a21eULL, "setPrinter:" },
+    { 0x73d9407f35c40209ULL, "setKeyPath:" },
+    { 0, NULL },
+    { 0x8d120c244684f82fULL, "_continuousSpellCheckWithInvalidatedRange:" },
+    { 0xeee9deb73415b60aULL, "backingType" },
+    { 0xf39621af0bf001ecULL, "_setSelectedIndexFromCell:" },
+    { 0x2f647a1c6c2b2b14ULL, "setDelegate:" },
+    { 0, NULL },
+    { 0x9a0f66ee0da220cfULL, "setOpaque:" },
+    { 0, NULL },
+    { 0x3cc72c351ca1917aULL, "currentSpellEngine" },
+    { 0, NULL },
+    { 0x720a8d941f697797ULL, "getBoundingRects:forGlyphs:count:" },
+    { 0x0b1a570b35de8a0eULL, "textViewForBeginningOfSelection" },
+    { 0x7abbc3ad6bcdc601ULL, "correctionCheckingResultWithRange:replacementString:" },
+    { 0, NULL },
+    { 0xcb0f8f57cc45a5ceULL, "textTransform" },
+    { 0x5a13b330ab3a43b1ULL, "initWithKey:forProxyObject:" },
+    { 0xf46215b7bac1e890ULL, "protocolSpecificInformation" },
+    { 0, NULL },
+    { 0x822b8958d549a3b4ULL, "addSubview:positioned:relativeTo:" },
+    { 0x2ad11d685242a830ULL, "outlineViewItemDidCollapse:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xac94f601846cf90eULL, "_checkBundles" },
+    { 0x4a64fba69b7708acULL, "performSelector:target:argument:order:modes:" },
+    { 0x271e674c9fff41ebULL, "fileOwnerAccountName" },
+    { 0xd1599864ff7c3051ULL, "minimumRangeOfUnit:" },
+    { 0, NULL },
+    { 0x34bb176fda91560dULL, "setPanelFont:isMultiple:" },
+    { 0x9ac3935a4ed63c3fULL, "invocationWithMethodSignature:arguments:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0fe422c81708218dULL, "setPostsFrameChangedNotifications:" },
+    { 0x7393e38174c72b80ULL, "QueryContinueDrag::" },
+    { 0x62172157a12220b6ULL, "substitutionsPanelAccessoryViewController" },
+    { 0x1a65f04629fd6650ULL, "statesForMode:" },
+    { 0x00131e37c02961bdULL, "tableView:shouldSelectTableColumn:" },
+    { 0xb1181717a6db0527ULL, "showsProgressPanel" },
+    { 0x3d84a8c5e967a5d5ULL, "pageScroll" },
+    { 0x770ae4003f53b430ULL, "WM_SETCURSOR_wParam:lParam:" },
+    { 0x97eb3deba0757b4cULL, "windowDidResize:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5e12f9b9f368a082ULL, "setRecentSearches:" },
+    { 0x5e32418d744b0ad9ULL, "index" },
+    { 0, NULL },
+    { 0x0685ed4732d86e42ULL, "dateByAddingYears:months:days:hours:minutes:seconds:" },
+    { 0x2ae58d08cbaf1315ULL, "SetData:::" },
+    { 0x551a8a6e5c9d717dULL, "rangeForUserTextChange" },
+    { 0x731657a927aaeb13ULL, "nextObject" },
+    { 0x7ff18886c0ffe37fULL, "animationDelay" },
+    { 0x5ce5bd970118cd3fULL, "splitViewDidResizeSubviews:" },
+    { 0x0a0010e75a39435dULL, "removeAllActionsWithTarget:" },
+    { 0xd89cfd5fe68820d4ULL, "searchMenuTemplate" },
+    { 0x47709e2faf500764ULL, "sizeOfPartId:stateId:uxthClassId:size:" },
+    { 0x5ed1b21f0a0cb839ULL, "tickMarkPosition" },
+    { 0x6568217fefe775f8ULL, "commitEditingWithDelegate:didCommitSelector:contextInfo:" },
+    { 0x5a424f65f647d9d3ULL, "context" },
+    { 0x87e3e15e9cb6bbb8ULL, "languages" },
+    { 0x8e20f0668f37a2ddULL, "pathControl:willDisplayOpenPanel:" },
+    { 0x2ee8f5ba19c6fbc5ULL, "_setContentArrayForMultipleSelection:" },
+    { 0x69234c39b0f7d47bULL, "cookieAcceptPolicy" },
+    { 0x0f7410d563f2e2aaULL, "handleError:" },
+    { 0xeccf8dc15b178f85ULL, "setCursor:" },
+    { 0xa45604f9a2bec926ULL, "fetchGlyphInfo" },
+    { 0xabd0ce7b30aa99ebULL, "setHTTPBody:" },
+    { 0, NULL },
+    { 0xb19fe649168180dcULL, "bind:toObject:withKeyPath:options:" },
+    { 0xc729c66616c9cbefULL, "selectedPointSize" },
+    { 0x302f2ffe05a7ba7eULL, "setShadow:" },
+    { 0xa7bd693ee6016b59ULL, "_makeSureIsOnAScreen" },
+    { 0xcdd5cd749e155f56ULL, "_updateFileModificationDate" },
+    { 0x9ff6b7d32b6750b2ULL, "_bestUncachedFallbackCachedRepresentationForDevice:size:" },
+    { 0x61edb79a456ff8adULL, "colorWithKey:" },
+    { 0xaff7dad16509f58aULL, "abbreviationDictionary" },
+    { 0, NULL },
+    { 0xdf99df43b10a3352ULL, "zone" },
+    { 0, NULL },
+    { 0x0e7b3c0f0adbda87ULL, "setUserFont:" },
+    { 0xa6e83d22945c12eeULL, "allocateGState" },
+    { 0x5e3fdbc97cff8453ULL, "year" },
+    { 0x4fe995d38e82406bULL, "saveFrameUsingName:" },
+    { 0x5f0d25eb7e25da1bULL, "currentPoint" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x66ed996fb60d54a0ULL, "fetchAdvancementsForGlyph:" },
+    { 0xf654be9bc79a9f39ULL, "client" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6aff0f724df5c155ULL, "buttons" },
+    { 0x0c1af8eccdc3aa49ULL, "rightIndentMarkerWithRulerView:location:" },
+    { 0xe13138edcf354664ULL, "captureEvents" },
+    { 0xdb3d4502fb8752f9ULL, "lock" },
+    { 0xdbd39d813c773626ULL, "windowFrameAutosaveName" },
+    { 0x98eed87eeb359462ULL, "setBorderWidth:" },
+    { 0x82e44e02afe0878cULL, "buildSampleTextField" },
+    { 0x8e2959cf3cc79674ULL, "loadRootItem" },
+    { 0x98f2d7e206830ee1ULL, "parseAttributedString" },
+    { 0xf8d301b48a4266ecULL, "setContentFilters:" },
+    { 0, NULL },
+    { 0x4843405ba7d11e2fULL, "currentThread" },
+    { 0x3b97ecec38f6be4cULL, "setReservedThicknessForMarkers:" },
+    { 0x0e59f36cd6ed3020ULL, "removeObjectsInRange:" },
+    { 0, NULL },
+    { 0xebaed25379a123ddULL, "setLineFragmentPadding:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2730e6307f20fdf2ULL, "setPixelsHigh:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1154c9110c8fb6a8ULL, "setGridStyleMask:" },
+    { 0xdbe45d956a311b0aULL, "_contentValues" },
+    { 0x58dd1242744a59fcULL, "propertyListWithContentsOfFile:" },
+    { 0x653d605d5c58612eULL, "lineFragmentRectForGlyphAtIndex:effectiveRange:" },
+    { 0, NULL },
+    { 0x3e63c7c7363001bfULL, "writeContentsOfFile:bytes:length:options:error:" },
+    { 0xee74314826319ab8ULL, "hasMainMenu" },
+    { 0xfe152ce2340642a5ULL, "isItemExpanded:" },
+    { 0xe5de50b371f3f9ebULL, "stateForMode:" },
+    { 0x05f66e7a8ac45199ULL, "labelFontOfSize:" },
+    { 0x4ae511ec3fc4d706ULL, "setCharactersToBeSkipped:" },
+    { 0, NULL },
+    { 0x2feef07402996f7dULL, "tableView:willDisplayCell:forTableColumn:row:" },
+    { 0xdbf10dfbd436f2f3ULL, "setNilValueForKey:" },
+    { 0x06e4638b0eade07eULL, "secondsFromGMTForDate:" },
+    { 0x6b325520d09423d8ULL, "outlineView:shouldEditTableColumn:item:" },
+    { 0x7790130b6c8c285dULL, "startMonitoring" },
+    { 0xa2deb37bf0b660a0ULL, "allowsColumnSelection" },
+    { 0xc30e2835a679ac1bULL, "initWithTarget:selector:object:" },
+    { 0x049b84b0f266a528ULL, "checkEnvironmentKey:value:" },
+    { 0x5860bd0d791a350eULL, "URL" },
+    { 0x56180868bff4a6c4ULL, "hsbTextChanged:" },
+    { 0xc132034b4c21a4b0ULL, "setMinimumDaysInFirstWeek:" },
+    { 0x827c06dbc97fc22fULL, "imagePasteboardTypes" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x36518b202b01367fULL, "setWantsLayer:" },
+    { 0x2d38482f9711a1afULL, "clickSizeText:" },
+    { 0x9cf554794c7f7d62ULL, "draggingExited:" },
+    { 0xbe3925484b9aff08ULL, "setHasHorizontalScroller:" },
+    { 0xa2467538b6620127ULL, "setExcludedFromWindowsMenu:" },
+    { 0x2b4f0ed2fa99ad94ULL, "scheduledTimerWithTimeInterval:invocation:repeats:" },
+    { 0x3409ae8bf73d1c6fULL, "expressionForArray:" },
+    { 0, NULL },
+    { 0x358df3319229e428ULL, "searchForAllDomains" },
+    { 0xc39c016a72bd9c17ULL, "observableSelection" },
+    { 0, NULL },
+    { 0xf5aa13a64ce3c7feULL, "deselectRow:" },
+    { 0x9a285d41ef31fd5bULL, "decodeRectForKey:" },
+    { 0x58e818b91c5ad924ULL, "WM_PAINT_wParam:lParam:" },
+    { 0, NULL },
+    { 0xb254e9c67e335e43ULL, "containsIndexesInRange:" },
+    { 0xa0ccccd999895f72ULL, "add:" },
+    { 0xf46c8e8039287db6ULL, "pixelBuffer" },
+    { 0x482d8a1bcf472b44ULL, "getPixel:atX:y:" },
+    { 0x19a7fd49fad84829ULL, "defaultBindingOptionsForBinding:" },
+    { 0x124328de6eddd5faULL, "orderOut:" },
+    { 0xdd14866e9aa5784fULL, "cellBackgroundColor" },
+    { 0x30c310bbae02e132ULL, "redo" },
+    { 0x1703164d2034ae8cULL, "windows" },
+    { 0x74253b9080e2533aULL, "widthValueTypeForLayer:edge:" },
+    { 0x7cf0b1a550770a92ULL, "selectedItemIdentifier" },
+    { 0xe06b782dc6934e32ULL, "parser:foundAttributeDeclarationWithName:forElement:type:defaultValue:" },
+    { 0, NULL },
+    { 0x0a05ad50b08c29f1ULL, "revertToInitialValues:" },
+    { 0x65ba3b5afc1d9d4cULL, "alertWithError:" },
+    { 0x9db647287b452434ULL, "trackScrollButtons:" },
+    { 0xf5b3273d10cbb74dULL, "imageablePageBounds" },
+    { 0xfd9e33fb436ced0eULL, "propertyListFromStringsFileFormat" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf2ab6c1a2d836f16ULL, "setHorizontallyResizable:" },
+    { 0x7365cd59a91c0144ULL, "keyBindingsFromDictionary:" },
+    { 0, NULL },
+    { 0x3fc0b99885dbc662ULL, "_document:shouldClose:contextInfo:" },
+    { 0x2114ffc8c78bb390ULL, "setValuesForKeysWithDictionary:" },
+    { 0x3cbe313a95cb3d8aULL, "moveToBeginningOfLine:" },
+    { 0xb0dc42a51c7690dfULL, "sendsActionOnArrowKeys" },
+    { 0xbcd4b4a3109d32afULL, "HTTPBodyStream" },
+    { 0xbdfa821509b7594cULL, "transferOneBufferFromSSLToSocket:" },
+    { 0x67c4a2a987d5aabcULL, "_stringValue:withNumberFormat:" },
+    { 0x81a91f42cb3e9727ULL, "setData:forType:" },
+    { 0x9d6ea9fff926c244ULL, "displayIfNeededIgnoringOpacity" },
+    { 0x8e03c511d594293eULL, "flushCGLContext:" },
+    { 0x9d2fec9c8c4d3baaULL, "_lockFocusInContext:" },
+    { 0xe83ad1be9d892680ULL, "independentConversationQueueing" },
+    { 0xdbae678b00c49293ULL, "setEntryWidth:" },
+    { 0x198c48ebdfc12e05ULL, "wantsPeriodicDraggingUpdates" },
+    { 0x4dd6a1df1b64a9f4ULL, "indexOfTabViewItemWithIdentifier:" },
+    { 0xac48ec56686c581eULL, "isWordInUserDictionaries:caseSensitive:" },
+    { 0x2c5c35ae8ce77ec7ULL, "setRepresentedObject:" },
+    { 0x20abbad700d4f877ULL, "fetchAttributes" },
+    { 0x024bc4cbf3877144ULL, "getInputStream:outputStream:" },
+    { 0x5ff907382c660335ULL, "addObjectsFromArray:" },
+    { 0x62dd09d16b6c3db7ULL, "drawPushButtonNormalInRect:defaulted:" },
+    { 0x7524fc849a0f8da2ULL, "fileGroupOwnerAccountName" },
+    { 0x66530f8ae5b64aafULL, "stepRect" },
+    { 0x39d0cdac330549eaULL, "interpolatedColorAtLocation:" },
+    { 0, NULL },
+    { 0x5fb61cc90e12718dULL, "nextEventMatchingMask:untilDate:inMode:dequeue:" },
+    { 0xb0362eb42fd870aaULL, "_isSelectorOverridden:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1a4fd59e21c434f7ULL, "itemMargins" },
+    { 0x61e19022146721a4ULL, "timeZoneClass" },
+    { 0x60cee5f41aff34deULL, "setMinute:" },
+    { 0xff5294b05b0df473ULL, "_autosaveFrameKeyWithName:" },
+    { 0x10e89917ad674842ULL, "cancelPreviousPerformRequestsWithTarget:selector:object:" },
+    { 0x46acac2a85f078c4ULL, "RTFDFromRange:" },
+    { 0xe72f3d53ebbbcd29ULL, "appendBezierPathWithArcWithCenter:radius:startAngle:endAngle:" },
+    { 0x7f7fd2ccf0294400ULL, "initialKey" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd87f3b54afc4f6a2ULL, "allCredentials" },
+    { 0, NULL },
+    { 0x1f71c14b6835b8aaULL, "_updateCyan:magenta:yellow:black:" },
+    { 0xced1e00537a34216ULL, "clickedPathComponentCell" },
+    { 0x4601ac6ce90f8e1aULL, "numberOfRows" },
+    { 0xf3013e5d64be154cULL, "compositeToPoint:operation:fraction:" },
+    { 0xc037bab9a488ee0dULL, "glyphInfoWithGlyphName:forFont:baseString:" },
+    { 0xbe8e8fc3ef14037dULL, "trackMarker:withMouseEvent:" },
+    { 0xb8f0c0c86f2e690dULL, "postNotificationName:object:userInfo:options:" },
+    { 0xc1a5349e64307b05ULL, "attributedAlternateTitle" },
+    { 0, NULL },
+    { 0xa17bcfd411a2ec63ULL, "addCharactersInString:" },
+    { 0xcd0e9f3b70a3e7f9ULL, "sheet" },
+    { 0xe53f1ea72f28460cULL, "fixFontAttributeInRange:" },
+    { 0x4cf43d96944e1d76ULL, "keyPathsForValuesAffectingSelectedIndex" },
+    { 0x99ec0d65d9b5eb96ULL, "beginGrouping" },
+    { 0, NULL },
+    { 0xc7a0c7fb033eda2aULL, "graphicsPort" },
+    { 0x3b56d060b0230be9ULL, "bundleIdentifier" },
+    { 0, NULL },
+    { 0xa629017218698587ULL, "orderedDocuments" },
+    { 0x347cc91683b4eba1ULL, "_KVC_partBeforeDot:afterDot:" },
+    { 0x87c2b9e5607cf3a0ULL, "replaceGlyphAtIndex:withGlyph:" },
+    { 0, NULL },
+    { 0x816f5b7c97309446ULL, "archiverData" },
+    { 0, NULL },
+    { 0x82f8c2a235b24c4dULL, "windowDidExpose:" },
+    { 0xb318c50a9284d876ULL, "selectedFamilyName" },
+    { 0x86d5f80078cfe621ULL, "setLoaded:" },
+    { 0xb3c743687ca54d27ULL, "setHighlightMode:" },
+    { 0x5c163c2814a32a5cULL, "setSharingType:" },
+    { 0, NULL },
+    { 0xe68a0ed691a3689fULL, "decodeInt32ForKey:" },
+    { 0x31005e2742776376ULL, "resizingMask" },
+    { 0x0f9382159870e388ULL, "controlContentFontOfSize:" },
+    { 0x4c8b7c530d6b7d42ULL, "insertRow:" },
+    { 0xc23521747d955860ULL, "scanHexInt:" },
+    { 0xa948cd043dbb62c2ULL, "trackRect" },
+    { 0x0549ad4cea9780f2ULL, "redoMenuItemTitle" },
+    { 0xf8a0afa81af79dd9ULL, "scrollPageDown:" },
+    { 0x357b9e9ce18fb162ULL, "valueTransformerNames" },
+    { 0xaa8d028e1c154355ULL, "shadowOffset" },
+    { 0x6c06934e9a2ed24cULL, "transformedObject:" },
+    { 0x93dfeaf7675dacc9ULL, "progressMarks" },
+    { 0, NULL },
+    { 0x4ddbad412299160fULL, "colorAtX:y:" },
+    { 0x57aab00a991ee422ULL, "fileManager:shouldMoveItemAtPath:toPath:" },
+    { 0, NULL },
+    { 0xbe56a5d0f8a33a9bULL, "levelsOfUndo" },
+    { 0xb0c10018f7823101ULL, "bezelStyle" },
+    { 0xe8f72eda71efa4b6ULL, "drawRow:clipRect:" },
+    { 0xff77d8a932755517ULL, "removeObjectForException:" },
+    { 0, NULL },
+    { 0x10af867900f6e93cULL, "HTTPBody" },
+    { 0x3612b7693a366810ULL, "setAllowsBranchSelection:" },
+    { 0x769c35e9def61badULL, "keyViewSelectionDirection" },
+    { 0x9aab03c981511428ULL, "remoteObjects" },
+    { 0xb800342c8c0f56c6ULL, "wantsDefaultClipping" },
+    { 0xc2fcd34451dc9da7ULL, "createMatrixInColumn:" },
+    { 0xc14a24a24572c4f5ULL, "postNotificationName:object:" },
+    { 0xff96c570fe5caebcULL, "spellServer:didLearnWord:inLanguage:" },
+    { 0xb733a0805c6ed007ULL, "TIFFRepresentationOfImageRepsInArray:" },
+    { 0xc09224b63957cce1ULL, "validateAndReturnError:" },
+    { 0, NULL },
+    { 0x457392979d90fd31ULL, "dateValue" },
+    { 0xb10ab80368188446ULL, "valueWithSize:" },
+    { 0x3251a4d6219b78dcULL, "runCustomizationPalette:" },
+    { 0, NULL },
+    { 0x876046d9f482c5f9ULL, "takeObjectValueFrom:" },
+    { 0x49b795b90d9aae10ULL, "dragLeave:" },
+    { 0x4b6737378d1e59faULL, "standardError" },
+    { 0xffd86edd16d24502ULL, "_cachedItemRects" },
+    { 0x132f75d1891efa71ULL, "setAllowsCutCopyPaste:" },
+    { 0xc729760dd60559dcULL, "waitForInputInMode:beforeDate:" },
+    { 0xfd141207bc0b4e1bULL, "selectItem:" },
+    { 0x903fb0216402f4c1ULL, "setRuleThickness:" },
+    { 0, NULL },
+    { 0xef62b7a9be9a67faULL, "rootHandle" },
+    { 0, NULL },
+    { 0xaf032a0b2db5c188ULL, "containsObject:" },
+    { 0x57b9b49930d5e0d6ULL, "startWaitCursor" },
+    { 0xb77ec4051d0f6da5ULL, "colorWithCalibratedHue:saturation:brightness:alpha:" },
+    { 0, NULL },
+    { 0xb0c88e51cf7f467fULL, "_displayInsertionPointWithState:" },
+    { 0x53ed6328d3b3566bULL, "guess:" },
+    { 0x9eab4b8ccbe8f9ddULL, "isRichText" },
+    { 0, NULL },
+    { 0x10ada406b06d827fULL, "setCellBackgroundColor:" },
+    { 0x930753ab25260788ULL, "connectionWithRegisteredName:host:" },
+    { 0x166c8f54ba9b0698ULL, "guessesForWordRange:inString:language:inSpellDocumentWithTag:" },
+    { 0xf842a37bb1ef7484ULL, "extraCheckMarkHeight" },
+    { 0, NULL },
+    { 0x00ef81a706663729ULL, "_setCurrentProgressAndEndIfNeeded:" },
+    { 0x903dc4d0ff637735ULL, "era" },
+    { 0xaeda2d07a96b8838ULL, "netServiceBrowser:didRemoveService:moreComing:" },
+    { 0x1dfd6ef31a5638daULL, "currentMode" },
+    { 0x1e94ad8e3efbed4dULL, "addRequestMode:" },
+    { 0x84dc3db8109e20ebULL, "minValue" },
+    { 0x5bfab444d7171f68ULL, "preservesSelection" },
+    { 0xfcd4c27b76c6a9ecULL, "canHandleRequest:" },
+    { 0x6e85f4c275c3e48aULL, "markerForItemNumber:" },
+    { 0x0ac511212f127693ULL, "drawKnobSlotInRect:highlight:" },
+    { 0xfc6f464bdbabfdc8ULL, "updateWindowsItem:" },
+    { 0, NULL },
+    { 0xa0a666bb5594c46cULL, "orderWindow:relativeTo:" },
+    { 0, NULL },
+    { 0x57239d91bfa03418ULL, "setContextInfo:" },
+    { 0x642e92b459fe050eULL, "titleHeight" },
+    { 0x88511be9eecb3d26ULL, "numberOfPlanes" },
+    { 0xbe8b12accaf29e32ULL, "alternateImage" },
+    { 0xd397e050a399b8fdULL, "boundingBoxForControlGlyphAtIndex:forTextContainer:proposedLineFragment:glyphPosition:characterIndex:" },
+    { 0xb38284defb342e15ULL, "containsObjectForException:" },
+    { 0x4481fcbd87f9125aULL, "maxWidth" },
+    { 0, NULL },
+    { 0x6192b8e61313ba21ULL, "sortedArrayUsingSelector:" },
+    { 0xb7bb585a46e78c3eULL, "hideCursor" },
+    { 0, NULL },
+    { 0x771f41d91118d426ULL, "_multiplyCurrentUnitBy:add:" },
+    { 0x1b8572f733de4228ULL, "setTextLists:" },
+    { 0x6a9ce5b5f3ab22dbULL, "endUndoGrouping" },
+    { 0xc14f581b2b570208ULL, "encodePoint:" },
+    { 0x3e73aae628b766f9ULL, "appendStringWithCurrentAttributes:" },
+    { 0x8e21a3cbad50ca89ULL, "_downArrowFrameForFrame:" },
+    { 0x8e0d2b9f28bf50a3ULL, "globallyUniqueString" },
+    { 0x1dfbb604c0d997f7ULL, "drawWithFrame:inView:" },
+    { 0x5406d38774c9ab24ULL, "initWithName:abbreviation:pointsPerUnit:stepUpCycle:stepDownCycle:" },
+    { 0xa0462523073c768fULL, "appendBezierPathWithOvalInRect:" },
+    { 0xf2095d588ca161c7ULL, "printerFont" },
+    { 0x14dbd99eca6041caULL, "setBackgroundColors:" },
+    { 0, NULL },
+    { 0xe719ba0b518077c3ULL, "type" },
+    { 0, NULL },
+    { 0xaac2d6709af4208cULL, "incrementServerCount" },
+    { 0, NULL },
+    { 0x5f96b8ee7b67b152ULL, "flushWindow" },
+    { 0x8e24483f73bd415bULL, "allScripts" },
+    { 0xa4bb511e04b9a42fULL, "setMainDocumentURL:" },
+    { 0xc97c62d77a9233e9ULL, "platformWindowSetCursorEvent:" },
+    { 0xbecf50a1ce2d0e55ULL, "nibFontTranslator" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2d7108df83335a2bULL, "applyValue:" },
+    { 0x7ed2bb76d4379b0dULL, "setGroupsByEvent:" },
+    { 0, NULL },
+    { 0x54961a79d74775c2ULL, "addressComponents" },
+    { 0x4603b90da576aac1ULL, "setAttributes:ofItemAtPath:error:" },
+    { 0x156c4f281b024b61ULL, "enclosingScrollView" },
+    { 0x3d7919bd993c3566ULL, "CGImage" },
+    { 0xa82576fe4644c8e5ULL, "searchForRegistrationDomains" },
+    { 0xf17cfd8039770bb2ULL, "convertFont:toHaveTrait:" },
+    { 0x3124af8512201b92ULL, "blendedColorWithFraction:ofColor:" },
+    { 0xaf0b9fe94f4ca6b1ULL, "_attributedTitle" },
+    { 0xc8f21fffe655a230ULL, "visibleItems" },
+    { 0, NULL },
+    { 0xd129e264bbe78bfaULL, "setFrameFromString:" },
+    { 0xb7137993c985bfd9ULL, "reshape" },
+    { 0xd8dc2ab86e4baf63ULL, "netService:didNotPublish:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x56de08972b8185e1ULL, "_setSelectedLabel:" },
+    { 0x396ee9651a6122b9ULL, "createBitmapIfNeeded" },
+    { 0x18732d9f21bb474aULL, "contextInfo" },
+    { 0x9ee928e57150948eULL, "RTFFromRange:" },
+    { 0xcaef9bc23cf3450bULL, "validateMenuItem:" },
+    { 0x933f55fa73bb0857ULL, "browser:titleOfColumn:" },
+    { 0x576c4ee77370216bULL, "availableFontNamesMatchingFontDescriptor:" },
+    { 0x891c89193a1304fbULL, "decodeFloatForKey:" },
+    { 0x0eb9ab8cd3386deeULL, "numberWithUnsignedLong:" },
+    { 0xe96dfa337ecca36cULL, "getRed:green:blue:alpha:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xa4fc0c041b37b82aULL, "horizontalPagination" },
+    { 0xb8d4985b046be464ULL, "defaultPixelFormat" },
+    { 0x329ed4efc2dc98b8ULL, "setBitsPerSample:" },
+    { 0x1707cbd80be1c605ULL, "rulerView:shouldAddMarker:" },
+    { 0x00705b8213e32813ULL, "toolbarAllowedItemIdentifiers:" },
+    { 0xfd479d2a24e7a4deULL, "update" },
+    { 0x168827b2009335a6ULL, "_setSheetOrigin" },
+    { 0xbe971ba8de5928c5ULL, "_sort" },
+    { 0x110a4f869c6a2704ULL, "menuForSegment:" },
+    { 0xe49a3d99c4ecb48cULL, "setStyle:" },
+    { 0xa4d4b60fdb3d00c0ULL, "headerColor" },
+    { 0x1d1e92cf18b56c31ULL, "setOnClipboard" },
+    { 0x009bc81b198c2009ULL, "broadcast" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x907b4935503a09d4ULL, "iconForFileType:" },
+    { 0xb9b13c92037771d3ULL, "commonISOCurrencyCodes" },
+    { 0xadf24e330280a65bULL, "allowsToolTipsWhenApplicationIsInactive" },
+    { 0xaeaad5e8f1d77082ULL, "addItemWithTitle:action:keyEquivalent:" },
+    { 0x927478ce27009ac7ULL, "suggestCompletionsForPartialWordRange:inString:language:" },
+    { 0x514abaf3ef568716ULL, "entryType" },
+    { 0xa3fee09a143baff2ULL, "insertItem:atIndex:" },
+    { 0xc2d22553549ca3d5ULL, "becomeMainWindow" },
+    { 0x0cca94ee0022a0cfULL, "hasMoreWork" },
+    { 0xb9de53e263b573a6ULL, "supermenu" },
+    { 0x3dcc8799cc6174abULL, "backgroundStyle" },
+    { 0x7073797ba3f93a54ULL, "getBytes:maxLength:usedLength:encoding:options:range:remainingRange:" },
+    { 0x44dad3df46acd035ULL, "attachmentCell" },
+    { 0xd7e5bb84e9ab0c07ULL, "setNotShownAttribute:forGlyphRange:" },
+    { 0x5f4c1715be18bd9cULL, "textView:willChangeSelectionFromCharacterRange:toCharacterRange:" },
+    { 0x88a4e2150acc871eULL, "encodeDataObject:" },
+    { 0x48faf1e5b9c1fdc0ULL, "display" },
+    { 0, NULL },
+    { 0x01096f287526840cULL, "rectForItemBorderAtIndex:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x943e0e7a871b28e7ULL, "copyAttributesFromContext:withMask:" },
+    { 0x5f6e169e047fbccbULL, "setSearchList:" },
+    { 0x80b5ab4251209782ULL, "waitUntilAllOperationsAreFinished" },
+    { 0xa42afdc1d934fa05ULL, "hasUnautosavedChanges" },
+    { 0xe59f20d7702642aeULL, "levelForItem:" },
+    { 0xf8419ea2fd19ee74ULL, "addRepresentation:" },
+    { 0x373092621b6ec5deULL, "insertObjects:atArrangedObjectIndexPaths:" },
+    { 0xa573060789e56e2eULL, "stream:handleEvent:" },
+    { 0xa7926f8d0f591ffeULL, "setCriticalValue:" },
+    { 0xffd05aeacca89c44ULL, "wraps" },
+    { 0x97f7745967d7e820ULL, "setMenu:forSegment:" },
+    { 0x2baee2dcfca19080ULL, "setSelectedIndex:" },
+    { 0x28dbf256d68b9486ULL, "glyphPacking" },
+    { 0xe1e5b05f71ac8e8eULL, "setLeftMargin:" },
+    { 0x3b71ab4f37b92286ULL, "blackComponent" },
+    { 0, NULL },
+    { 0x33df119c2f24754fULL, "notification" },
+    { 0x5505f24c61581428ULL, "contents" },
+    { 0, NULL },
+    { 0xcafb32932333b637ULL, "setSecondaryGroupingSize:" },
+    { 0xf06554577d5e5e19ULL, "drawPushButtonPressedInRect:" },
+    { 0x6af86dbcd22de081ULL, "viewWillMoveToSuperview:" },
+    { 0x8458342a168153ceULL, "_subpathsAtPath:basePath:paths:" },
+    { 0x918504546141b523ULL, "fireFirstTimer" },
+    { 0xbdb8fab908140e7aULL, "convertPoint:toView:" },
+    { 0, NULL },
+    { 0x0164069a56e04decULL, "setProperty:withValue:" },
+    { 0x2444f88fc83bbc35ULL, "_itemViewDidChange:" },
+    { 0, NULL },
+    { 0x54b4c1a537a277e1ULL, "setAutosaveName:" },
+    { 0, NULL },
+    { 0xe51306d7d83ef0a1ULL, "isProxy" },
+    { 0xbb7a5584472fecf5ULL, "setSelectionHighlightStyle:" },
+    { 0xdc33ed4ab5de2c4cULL, "noteUserDefaultsChanged" },
+    { 0x9f6a8a848428804bULL, "flush" },
+    { 0x9ad47de4f0fd206aULL, "countForObject:" },
+    { 0xc060fed350513a30ULL, "setAttributedStringForNotANumber:" },
+    { 0xfaa10f0f4863e1d4ULL, "acceptWithError:" },
+    { 0xac1235a87e591e02ULL, "valueWithPointer:" },
+    { 0xe3ea60c6d7b66640ULL, "previousKeyView" },
+    { 0x8894b66d8d10323aULL, "indexOfItemWithObjectValue:" },
+    { 0x87440cf79be616b6ULL, "rightMouseDown:" },
+    { 0x578157831e4986a1ULL, "_willResolve" },
+    { 0xa5c7307dd7ef947aULL, "setInformativeText:" },
+    { 0xde63ff9582208beeULL, "descriptionInStringsFileFormat" },
+    { 0x1a0e83b9047d8e4bULL, "readToEndOfFileInBackgroundAndNotify" },
+    { 0x3cf11fa35d392d91ULL, "setSubstitutionsPanelAccessoryViewController:" },
+    { 0x1b09c3c554100d30ULL, "setOneShot:" },
+    { 0x8e39815383c8c5e3ULL, "setFormatterBehavior:" },
+    { 0x8278817381da4203ULL, "rangeOfNominallySpacedGlyphsContainingIndex:" },
+    { 0, NULL },
+    { 0xa5a42d06989ea3f4ULL, "sTag:" },
+    { 0x25282c27e4db3dfcULL, "scrollItemAtIndexToTop:" },
+    { 0x4715bc8e6353a2ffULL, "conditionallySetsEnabled" },
+    { 0xe24050672d0cc975ULL, "expressionForConstantValue:" },
+    { 0xc6c421b5bc1a4703ULL, "response" },
+    { 0xce45b99f9dc4c063ULL, "removeVolatileDomainForName:" },
+    { 0x9d96756233ed105dULL, "_setArrangedObjects:" },
+    { 0x5586d0498ef2347cULL, "rectForLayoutAtPoint:inRect:textContainer:characterRange:" },
+    { 0x5bef3bcaa70d82c1ULL, "sharedHTTPCookieStorage" },
+    { 0, NULL },
+    { 0xe28951f1e9d0c867ULL, "_sliderRect" },
+    { 0x124e586acd5d25c2ULL, "setDisplaysWhenScreenProfileChanges:" },
+    { 0x0dcf4750b2acd792ULL, "temporaryAttributesAtCharacterIndex:longestEffectiveRange:inRange:" },
+    { 0x888c0ebc14fa83b7ULL, "mouseExited:withFrame:inView:" },
+    { 0x6bca3abde9b271e9ULL, "setHasThousandSeparators:" },
+    { 0xdfb8b372f9efac5cULL, "makeCellAtRow:column:" },
+    { 0x13ee99fd042e9283ULL, "_sheetContext" },
+    { 0x9581bef3f65d35a9ULL, "sortedKeyViewPositionsWithView:" },
+    { 0xb201d4f3f5478722ULL, "separatorSize" },
+    { 0xee4364f551d3db19ULL, "isFloatingPanel" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe39ac12fcb9a1f7eULL, "postNotificationName:" },
+    { 0x2adf556abc9d98e1ULL, "setTextContainer:forGlyphRange:" },
+    { 0x294820c588f3d9c6ULL, "parserError" },
+    { 0xd7592f399423fffcULL, "zoomedFrame" },
+    { 0x543cc6ecd4cccf19ULL, "_headerTitle" },
+    { 0x3f8f20980fc792f1ULL, "outlineViewColumnDidResize:" },
+    { 0x2fd27dbbc23031e7ULL, "applicationDidBecomeActive:" },
+    { 0x7d36fcd4e60f4338ULL, "_checkForAppActivation" },
+    { 0xda0299bd3e35afccULL, "cyanComponent" },
+    { 0, NULL },
+    { 0xa634e032d339c809ULL, "updateSpellingPanelWithGrammarString:detail:" },
+    { 0x2048ce76068807a0ULL, "scanUpToCharactersFromSet:intoString:" },
+    { 0x499d87ac9f96fd10ULL, "displaysWhenScreenProfileChanges" },
+    { 0, NULL },
+    { 0x30d44a2797f8149fULL, "replaceObjectAtIndex:withObject:" },
+    { 0xea6bd9b0501e7697ULL, "controlBackgroundColor" },
+    { 0x6ac20c35ac64913dULL, "moveBackwardAndModifySelection:" },
+    { 0x004664f2613d3ad9ULL, "boundsRectForContentRect:inRect:textContainer:characterRange:" },
+    { 0, NULL },
+    { 0x1acd902ba0e8a2e1ULL, "sortDescriptorPrototype" },
+    { 0x1c51dac7ceb12ec8ULL, "attributedStringWithAttachment:" },
+    { 0xbcb2cba3f4024418ULL, "activeApplication" },
+    { 0xbf3d344dbbd61c2fULL, "trackPageSlots:" },
+    { 0xffc447a7d216d771ULL, "windowDidMove:" },
+    { 0x811e4eca5e9ee0cbULL, "draggingSequenceNumber" },
+    { 0, NULL },
+    { 0x263f220e0052af4bULL, "invalidateDisplayForGlyphRange:" },
+    { 0xb28e5182a4d0529bULL, "selectedKnobColor" },
+    { 0xeacaedf9ced1a4fbULL, "firstVisibleColumn" },
+    { 0xf26f4f8a3e80003bULL, "columnAtPoint:" },
+    { 0x95f53c09adef2318ULL, "pipeName" },
+    { 0xf15a4fc768e10994ULL, "setAttributedStringForZero:" },
+    { 0xb76c647783e62164ULL, "availableTypes" },
+    { 0xd2c0c32616d92da5ULL, "encodeConditionalObject:forKey:" },
+    { 0, NULL },
+    { 0xee7e189231fcb765ULL, "glyphGenerator" },
+    { 0x428c73b6ab15b54eULL, "headerLevel" },
+    { 0x01e297dcfa6098b0ULL, "dictionaryWithContentsOfFile:" },
+    { 0x624b19c8d28b95f3ULL, "setAutoresizesAllColumnsToFit:" },
+    { 0x7156e7c87662aafdULL, "convertPointFromBase:" },
+    { 0xeb3a85ecc7130023ULL, "encodeArray:indent:" },
+    { 0x753529813dec985dULL, "showsSuppressionButton" },
+    { 0xcd789faa8fba57a5ULL, "WM_CLOSE_wParam:lParam:" },
+    { 0x32a6ec6b50c132fbULL, "null" },
+    { 0x244e8565265f72ecULL, "setAutosaveExpandedItems:" },
+    { 0, NULL },
+    { 0xf508b24adf985f6cULL, "statistics" },
+    { 0xcff56b5f3630004aULL, "dragCopyCursor" },
+    { 0x850e4e02c0eeb4a6ULL, "addProgressMark:" },
+    { 0x80452c160d3fe4a8ULL, "orthography" },
+    { 0xdfa571e5b1bcaa57ULL, "_scrollPoint" },
+    { 0x61d66c3106602bf4ULL, "setFileType:" },
+    { 0x13026d066de98a8bULL, "parser:foundComment:" },
+    { 0, NULL },
+    { 0xf8b0988e8640ebb4ULL, "moveRulerlineFromLocation:toLocation:" },
+    { 0x7ec6c3cf8712d0e0ULL, "setDataCell:" },
+    { 0x772431110491220aULL, "setViewsNeedDisplay:" },
+    { 0xf026daf896f42157ULL, "adjustSubviews" },
+    { 0x1247056329a4c0b3ULL, "complete:" },
+    { 0xb817224a2290a47eULL, "bytes" },
+    { 0x0cc0e39a5692522cULL, "setLevelsOfUndo:" },
+    { 0x9bd527e372e93425ULL, "stopModal" },
+    { 0xa71e93a62333847bULL, "encodeRootObject:" },
+    { 0x7b08c303d7835590ULL, "setAllowsUndo:" },
+    { 0xa9417ce6062e4b62ULL, "drawSelectionAtPoint:" },
+    { 0xc5c6446456fa1614ULL, "printingAdjustmentInLayoutManager:forNominallySpacedGlyphRange:packedGlyphs:count:" },
+    { 0x2d49bc0719dc07ddULL, "selectedFontName" },
+    { 0x24c6af8596f307e0ULL, "cancelOperation:" },
+    { 0x8c3c943859c70a7cULL, "objectsForXQuery:constants:error:" },
+    { 0, NULL },
+    { 0x38663a4e4c181bc2ULL, "platformWindowWillMove:" },
+    { 0x2b416d5f99b3ba8aULL, "setDocumentView:" },
+    { 0xa0c1a344351497dcULL, "updateRuler" },
+    { 0xb3cdfb677658a071ULL, "localObjects" },
+    { 0x8d92353accd4678fULL, "pathComponents" },
+    { 0, NULL },
+    { 0x941320ee826a5fa1ULL, "rectOfRow:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2aff235dc09f2a21ULL, "_addCursorRect:cursor:view:" },
+    { 0xc35f7e907946479fULL, "setCachesBezierPath:" },
+    { 0xb570fde708191b32ULL, "replaceBytesInRange:withBytes:" },
+    { 0xb58ed462a79326eeULL, "_displayWidthOfColumns" },
+    { 0x5cef701045d65efdULL, "resizeUpDownCursor" },
+    { 0x2454cd7da78b9dccULL, "setColor:forKey:" },
+    { 0x22f0d835427843feULL, "takeColorFrom:" },
+    { 0x21984c83ff3fcd49ULL, "setAttributesInTextStorage:" },
+    { 0x91c40ba9c50468ceULL, "deminiaturize" },
+    { 0x2031fb25a8875c3aULL, "underline:" },
+    { 0xf9f5ccc18d36a17bULL, "getBuffer:length:" },
+    { 0x0d117ed6dc2e9d10ULL, "getBytes:length:" },
+    { 0x6fabac8795f44510ULL, "initialize" },
+    { 0xbe19220dda2cc6a4ULL, "setClearsFilterPredicateOnInsertion:" },
+    { 0x5e1199964241a81eULL, "autoresizesOutlineColumn" },
+    { 0, NULL },
+    { 0x43028f23414a2e02ULL, "isNativeType:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x92d2124ba3d9e701ULL, "setHeightTracksTextView:" },
+    { 0, NULL },
+    { 0x0a8e063e5cc79c73ULL, "minDate" },
+    { 0x89d1d0505a0b9469ULL, "_setFilename:" },
+    { 0xe9d38cc9d164f888ULL, "_name" },
+    { 0, NULL },
+    { 0x3c3a3bb0d9021e0fULL, "sendBeforeDate:components:from:reserved:" },
+    { 0, NULL },
+    { 0x9941d59a1f3f13d2ULL, "setItemHeight:" },
+    { 0xdc7c2a8af6bcb542ULL, "isZoomed" },
+    { 0xe8199ebbecb753ffULL, "socketClass" },
+    { 0, NULL },
+    { 0xed32f381c9c34de8ULL, "_attentionTimer:" },
+    { 0x5e335044b1ce0618ULL, "writeDestinationToSource" },
+    { 0x60e590d0298cdf66ULL, "directory" },
+    { 0x3d87a56a5d8fa152ULL, "_resizeWithOldMenuViewSize:" },
+    { 0x5ad37a1c12774fbfULL, "width" },
+    { 0xf7fa5d72e0b71f58ULL, "usesFontLeading" },
+    { 0x8d616377bc8b8ec5ULL, "isSecure" },
+    { 0xd6eb985c39296ecbULL, "underlineThickness" },
+    { 0, NULL },
+    { 0xbf111053f59ce6dcULL, "setMultiplier:" },
+    { 0x60e8ce43613e9212ULL, "frameViewClassForStyleMask:" },
+    { 0x8141a76401bb7a36ULL, "drawerShouldClose:" },
+    { 0x07217497771be3e4ULL, "filterUsingPredicate:" },
+    { 0x1befe86b8fce6dd5ULL, "_attachSheetContextOrderFrontAndAnimate:" },
+    { 0, NULL },
+    { 0x40580e22c32ad0e5ULL, "paperSize" },
+    { 0xfb51f5243bacb4d0ULL, "timeZoneWithName:data:" },
+    { 0x3fac931b70054afeULL, "setEra:" },
+    { 0x13368b6ac963f8e6ULL, "socketPortClass" },
+    { 0xea6681a07d455ae9ULL, "resizeIncrements" },
+    { 0x983ad13f3cd5249bULL, "recognizesInputSource:" },
+    { 0x52dd069091802579ULL, "setFirstWeekday:" },
+    { 0, NULL },
+    { 0xc68c3f39fc4b8613ULL, "removeAllItems" },
+    { 0x4baefd460b20c6d8ULL, "toolbarWillAddItem:" },
+    { 0xcead9f26a490fff6ULL, "setTextAttributesForNil:" },
+    { 0xb2512ba71ca51866ULL, "openFile:withApplication:andDeactivate:" },
+    { 0x4dd2e90e932d6621ULL, "_screenForPoint:" },
+    { 0x32df6fe15b93eeebULL, "setPathComponentCells:" },
+    { 0x839a40aeca29c783ULL, "_fontFamilyName" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5cbca22465104e3aULL, "allSpellEngines" },
+    { 0x5436975d00763533ULL, "defaultLineHeightForFont" },
+    { 0xdf6914790c7923d0ULL, "_addTrackingRect:view:flipped:owner:userData:assumeInside:isToolTip:" },
+    { 0x79f91211c775d8bcULL, "registerFoundationDefaults" },
+    { 0xca6d9de6543dc249ULL, "encodeFloat:forKey:" },
+    { 0x0f3a4a8e7cfccacfULL, "postsFrameChangedNotifications" },
+    { 0x6d0df970b3e99be7ULL, "setPaletteLabel:" },
+    { 0, NULL },
+    { 0x5e374500789b1639ULL, "_horizontalScroll:" },
+    { 0xb45e3e8a82ed99e4ULL, "modifierMask" },
+    { 0x07b332a739d756eeULL, "takeSelectedTabViewItemFromSender:" },
+    { 0x0904468dbb46ace7ULL, "setRestOfPathObserver:" },
+    { 0x980b9f1e5125d8bbULL, "encodeInt32:forKey:" },
+    { 0, NULL },
+    { 0x856a44d154812933ULL, "endEditingFor:" },
+    { 0x9651f9dd81bdcd33ULL, "keyBindingPaths" },
+    { 0xe916d187e7491824ULL, "value" },
+    { 0x958be1765a6d9d08ULL, "colorRenderingIntent" },
+    { 0x748752fb10b85daaULL, "minusSign" },
+    { 0x6b398a1249f9c71bULL, "_setCurrentValueIsPlaceholder:" },
+    { 0x44ebf3c5e40b026dULL, "multipleThreadsEnabled" },
+    { 0x8e025131641da5c2ULL, "canInitBackingWithContext:deviceDictionary:" },
+    { 0x506856ca998e4942ULL, "willSetLineFragmentRect:forGlyphRange:usedRect:baselineOffset:" },
+    { 0xfa36a662ad2e2c07ULL, "_segmentForPoint:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xa99199346932f19bULL, "setURL:" },
+    { 0, NULL },
+    { 0x63e46b4e078da2dfULL, "removeTrackingRect:" },
+    { 0x94a46bfa5da76de1ULL, "conformsToProtocol:" },
+    { 0x2b779e2497cdda98ULL, "WM_MOVE_wParam:lParam:" },
+    { 0xe0e553392d9d883aULL, "usesThreadedAnimation" },
+    { 0xdb70d8822f64790fULL, "lineToPoint:" },
+    { 0, NULL },
+    { 0x84ce1c108d55b12aULL, "abortModal" },
+    { 0xb80c9f376aa9f486ULL, "removeObjectsAtArrangedObjectIndexPaths:" },
+    { 0, NULL },
+    { 0xfb1640df04bee3d9ULL, "path" },
+    { 0x6b9880403187b365ULL, "isSupportingCoalescing" },
+    { 0xe2e9c12fc9cda019ULL, "addKeyViewPositionsWithView:toArray:" },
+    { 0x9957aef48e04186fULL, "platformWindowDidMove:" },
+    { 0x765d18d6d22d2bfeULL, "sortUsingDescriptors:" },
+    { 0x4a1070eafc0b9a0eULL, "endSheet:" },
+    { 0xa1d693e649b2803cULL, "transpose:" },
+    { 0xfd9f55ef37421fb4ULL, "viewDidHide" },
+    { 0xe943872dc6ae3a2cULL, "values" },
+    { 0x1251909c8f08c2b8ULL, "floatValue" },
+    { 0x0b99efc5c715231eULL, "pathControl:acceptDrop:" },
+    { 0x9c19e9bc9747aef4ULL, "drawBackgroundInClipRect:" },
+    { 0, NULL },
+    { 0xc6ebe3475a79588bULL, "sharedToolTipWindow" },
+    { 0x4c92601ed4c39659ULL, "cancelButtonCell" },
+    { 0x66bf81590cf532bdULL, "_removeItemAtIndex:" },
+    { 0xc891300dc38fc452ULL, "setLineJoinStyle:" },
+    { 0xa34329f6369230b5ULL, "waitUntilExit" },
+    { 0x97fcdf0d8482223eULL, "setSizeMode:" },
+    { 0x6c14a475f2f663caULL, "openTempFile:" },
+    { 0x0f18990ef9d3b841ULL, "startRunningCopyPipe" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x664c920795ac9afbULL, "unarchiver:willReplaceObject:withObject:" },
+    { 0xb7374c611b1574a7ULL, "drawsBackground" },
+    { 0x654fd0d44d70e38cULL, "acceptsArrowKeys" },
+    { 0xdfccf214d1ac63ffULL, "pathControl:willPopUpMenu:" },
+    { 0xb740bad9dc360a84ULL, "setAutosavingDelay:" },
+    { 0xf0ce84e0f4395d9fULL, "mainQueue" },
+    { 0xc9dd074cd02624c4ULL, "isDrawingToScreen" },
+    { 0xec467cd7da9e1f1dULL, "keyEquivalentFont" },
+    { 0x74f2b6e18579d5f5ULL, "doubleValue" },
+    { 0xd14e99c5080ca1beULL, "setCurrentProgress:" },
+    { 0x80ba58fd5c29ffeaULL, "valueForKeyPath:" },
+    { 0xc03d895f36d8ceb9ULL, "deleteToMark:" },
+    { 0, NULL },
+    { 0xc469d00737a4070eULL, "setDrawsGrid:" },
+    { 0x5630cd8be8f75c92ULL, "dateCheckingResultWithRange:date:" },
+    { 0x51d764eaab666f81ULL, "requestTimeout" },
+    { 0x8ec89150eeb63d8dULL, "setStandardInput:" },
+    { 0x7f107511629ccf25ULL, "ignoreableWhitespace:" },
+    { 0xc6982310d2a1f648ULL, "setPreservesSelection:" },
+    { 0x2d0ccf078cedaa70ULL, "convertFont:toSize:" },
+    { 0xd43e1f0a23c34ac0ULL, "signal" },
+    { 0, NULL },
+    { 0x3e85a23cc122ee3cULL, "trackMouse:adding:" },
+    { 0xb72fc1427eea0fbdULL, "handle" },
+    { 0x360526b60cddbd5bULL, "colorListPopUpClicked:" },
+    { 0x0893ecd5382b4f38ULL, "setAcceptsArrowKeys:" },
+    { 0xb1d6ec1839fb910cULL, "URLHandleUsingCache:" },
+    { 0xd0756898dc4c04f9ULL, "childAtIndex:" },
+    { 0x9d5d18b2e3b1de4aULL, "fillRect:" },
+    { 0, NULL },
+    { 0x4d016b588d7a47daULL, "_checkForReleasedWindows" },
+    { 0x7bbba44805002463ULL, "widthForLayer:edge:" },
+    { 0xa1b86c015162be12ULL, "setPeriodicDelay:interval:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x8bec9185fd1e9555ULL, "setNotANumberSymbol:" },
+    { 0, NULL },
+    { 0x02b8c5874619a2fbULL, "setLocation:forStartOfGlyphRange:" },
+    { 0x615f65be72845e9eULL, "allowsColumnResizing" },
+    { 0xd1aa31631e081914ULL, "transformFrame:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe7e2dba712c8dfbcULL, "configurationDictionary" },
+    { 0xc222593ed866bb64ULL, "drawBackingContext:size:" },
+    { 0x92079a9eac799fc9ULL, "localizedStringForKey:value:table:" },
+    { 0x44f333e2591f3e5fULL, "_showSplashImage" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1a7465444eb6917cULL, "setMinimumFractionDigits:" },
+    { 0x92071e0f3d6bfc6bULL, "advancementForGlyph:" },
+    { 0, NULL },
+    { 0x889d7f943e947317ULL, "control:isValidObject:" },
+    { 0x09b9a8a9b1e47d36ULL, "noteFileSystemChanged" },
+    { 0x42db245efc46a9c0ULL, "shouldCloseWindowController:delegate:shouldCloseSelector:contextInfo:" },
+    { 0x3c54f0c8661e25f3ULL, "_createFileStreamIfNeeded" },
+    { 0x31c5a7b093eca635ULL, "deviceDescription" },
+    { 0x032c20593bf5aeefULL, "_selectedValue" },
+    { 0xb4165dcc61e490bcULL, "comboBoxWillDismiss:" },
+    { 0xf50c3dead028e0dfULL, "_appendData:" },
+    { 0x4f92b7686db65494ULL, "parser:foundIgnorableWhitespace:" },
+    { 0, NULL },
+    { 0x8c34a1eb889bb317ULL, "setLineFragmentRect:forGlyphRange:usedRect:baselineOffset:" },
+    { 0, NULL },
+    { 0x20c881ff59422920ULL, "_discardTrackingRectsForView:toolTipsOnly:" },
+    { 0x2ac8569ac0021bdaULL, "markerFormat" },
+    { 0x11e17f3cba201088ULL, "newItemForRepresentedObject:" },
+    { 0x5efe3bb579027d3aULL, "setBoundsSize:" },
+    { 0, NULL },
+    { 0xefbe815b8510d456ULL, "setWidth:type:forLayer:" },
+    { 0xdfec8417d2f9cb32ULL, "currentVirtualScreen" },
+    { 0xaf011a8e64650f14ULL, "netServiceBrowser:didFindDomain:moreComing:" },
+    { 0xd8dba6bbc8855486ULL, "_callingInfo" },
+    { 0xc1c9ccf423aedbe5ULL, "cachedValue" },
+    { 0, NULL },
+    { 0x5c0b7ceb64c2c962ULL, "setUsesFontLeading:" },
+    { 0xd70fe06a57428ad3ULL, "setContinuous:" },
+    { 0x72263fb056361591ULL, "location" },
+    { 0x46c99c3d3c079565ULL, "placeholderString" },
+    { 0, NULL },
+    { 0x57267128f7dac000ULL, "dividerThickness" },
+    { 0x97290e76dd7c93fbULL, "selectionIndex" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xbfc02fc1a34d3406ULL, "initDirectoryWithFileWrappers:" },
+    { 0xa32269cea84424a0ULL, "sizeOfAttributedString:inSize:" },
+    { 0, NULL },
+    { 0x1212dd1d52b5f384ULL, "userFixedPitchFontOfSize:" },
+    { 0xff8721e84e3da979ULL, "setTypesetterBehavior:" },
+    { 0x950de8da41a93308ULL, "willChangeAlreadyChanging" },
+    { 0x96c05696df7e74c5ULL, "canDrawConcurrently" },
+    { 0x411bf4b95cad29a2ULL, "runModalOpenPanel:forTypes:" },
+    { 0x52a5d997b3927ab5ULL, "usesEPSOnResolutionMismatch" },
+    { 0x232ec261c19f7d43ULL, "isOneway" },
+    { 0x52b3bc3328daa1c6ULL, "mutableArrayValueForKeyPath:" },
+    { 0xabe72a95582a3afaULL, "openTheme" },
+    { 0xb4753e2415da7ae4ULL, "menuItemTextMargins" },
+    { 0x98b72f37d2a102beULL, "setSelectionIndex:" },
+    { 0x623b9e51404c0e5cULL, "pointValue" },
+    { 0x2abeb789efe535e9ULL, "platformWindowDidInvalidateCGContext:" },
+    { 0xfee7bb10016ebb89ULL, "previousSibling" },
+    { 0xb2af3285c79e63e1ULL, "errorForReturnValue:" },
+    { 0x5e9b6e3db82d128eULL, "_resizeRectBeforeColumn:" },
+    { 0, NULL },
+    { 0xca0986b137382e1eULL, "setColorButtonClicked:" },
+    { 0x3e34c1a90e5ad0b9ULL, "setVerticalLineScroll:" },
+    { 0xd9d81b056a0a0fb4ULL, "nextChangeCount" },
+    { 0x713a42013bd11a98ULL, "insertColor:key:atIndex:" },
+    { 0xdeed029a39d3c8a5ULL, "stringByPaddingToLength:withString:startingAtIndex:" },
+    { 0x7a4d11edaf7ba91dULL, "windowForSheet" },
+    { 0x7affe52a21ffafc8ULL, "predefinedNamespaceForPrefix:" },
+    { 0xbe042474749fceebULL, "stringsByAppendingPaths:" },
+    { 0x9a4decd502e964a5ULL, "strokeRect:" },
+    { 0x7d59b9a0f9b7d1efULL, "printPanel" },
+    { 0, NULL },
+    { 0x7719ec76345a5471ULL, "inputContext" },
+    { 0xbb9fdb6232c38c97ULL, "pointsMeasurementUnit" },
+    { 0xf6fd38a633159e4cULL, "contentRectForFrameRect:" },
+    { 0x921f607c9c62acd5ULL, "menuItemCheckMarkSize" },
+    { 0x720df369dffcb6c2ULL, "setLayer:" },
+    { 0xbf0c4856f73a1209ULL, "windowDidResignKey:" },
+    { 0x801bb2cd43f3851fULL, "pathForSoundResource:" },
+    { 0x0c42fa35ab5112d3ULL, "fire" },
+    { 0xfe89a06a3557746bULL, "inchesMeasurementUnit" },
+    { 0, NULL },
+    { 0xc7ce0a93f0ccb037ULL, "paragraphSpacingBefore" },
+    { 0x2285c342c0b3a7d0ULL, "raise" },
+    { 0xdcb815bb7ab7a5f9ULL, "dismissCorrectionIndicatorForView:" },
+    { 0x95d78eb5fcfe85b6ULL, "printOperationWithView:printInfo:" },
+    { 0x83e56ca277700bbaULL, "contentBorderThicknessForEdge:" },
+    { 0x6c9871ea8db4556aULL, "insertObject:atIndex:" },
+    { 0, NULL },
+    { 0xb5447341c694d700ULL, "colorPickerWheelView:didSelectHue:saturation:andBrightness:" },
+    { 0x6e2cf98539996025ULL, "measurementUnit" },
+    { 0xef5028dd759690acULL, "systemStatusBar" },
+    { 0xe03f5591f0f13409ULL, "_setContentArray:" },
+    { 0x483499d1b486fb9eULL, "drawerWillResizeContents:toSize:" },
+    { 0xd8b4bceb8734514aULL, "XPath" },
+    { 0x0d5f73856142e69dULL, "drawStatusBarBackgroundInRect:withHighlight:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf347df1e576d3884ULL, "unloadLastColumn" },
+    { 0x39f6f045ec3d2c7cULL, "menuBarHeight" },
+    { 0xc94da2d2b9deba19ULL, "drawProgressIndicatorIndeterminate:clipRect:bezeled:animation:" },
+    { 0xee0a40f00268d56aULL, "editedColumn" },
+    { 0xd3e07bc2e52f78ebULL, "unlockWithCondition:" },
+    { 0x85bfee1b7fbd4398ULL, "setTemplate:" },
+    { 0x1eaf07a2028f3481ULL, "setDefaultLineCapStyle:" },
+    { 0xae5cd9643bd094bbULL, "setTitleBaseWritingDirection:" },
+    { 0x0f7c057688d28fa2ULL, "setCopiesOnScroll:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x32c86a352aef5ce0ULL, "glyphInfoWithCharacterIdentifier:collection:baseString:" },
+    { 0xcde981d0a2c7dd61ULL, "layoutParagraphAtPoint:" },
+    { 0x0e7d3b10ba3edd9bULL, "setTextContainerInset:" },
+    { 0, NULL },
+    { 0x8a08750f1698b84bULL, "cacheMode" },
+    { 0xb9d54eacf8d4b453ULL, "getObjectValue:forString:range:error:" },
+    { 0xd344b12188d99bc3ULL, "platformWindow:frameSizeWillChange:" },
+    { 0xac071643fd2bc456ULL, "_upArrowFrameForStepperFrame:" },
+    { 0, NULL },
+    { 0x33783342500ebc22ULL, "readableTypes" },
+    { 0xa8d5a709cdd247e6ULL, "setDictionary:" },
+    { 0x6cc43824c4a8ad81ULL, "_fontTraitsAsDictionary" },
+    { 0, NULL },
+    { 0x4d49cec1dd61013fULL, "filteredArrayUsingPredicate:" },
+    { 0x1a21f51d820002d6ULL, "invalidateRowCache" },
+    { 0, NULL },
+    { 0x0671ab7be5bdc7a3ULL, "currentUnicodeCharacterBytesCount" },
+    { 0x71da0586df2cf1eaULL, "removeInvocationsWithTarget:" },
+    { 0x45d9b6fa71c68e61ULL, "_drawGridForItem:style:level:" },
+    { 0x2cb2d83b30b8081cULL, "truncateFileAtOffset:" },
+    { 0xf7aba7238928d6e3ULL, "addInputSource:forMode:" },
+    { 0x8d57128b891ef43cULL, "_representedObject" },
+    { 0x98fd956c1c12a586ULL, "maxItemSize" },
+    { 0xedfb385dc9611496ULL, "menuItemTextColor" },
+    { 0, NULL },
+    { 0xb5565e3098d1593bULL, "setDatePickerMode:" },
+    { 0xe610c922da6abd75ULL, "layoutManagers" },
+    { 0x2bfd7e65f3043479ULL, "cmykSliderChanged:" },
+    { 0xe542e989bd9337a1ULL, "printDocumentWithSettings:showPrintPanel:delegate:didPrintSelector:contextInfo:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4226a85cbbc58c44ULL, "drawerShouldOpen:" },
+    { 0, NULL },
+    { 0x507123ef31a610a2ULL, "_adjustedFrameOfCellAtColumn:row:objectValue:" },
+    { 0xff9a3a4be99d26f2ULL, "dataWithAttributedString:range:" },
+    { 0xa85f854eea29e95fULL, "insertionPointColor" },
+    { 0, NULL },
+    { 0x7f91c59e712c66abULL, "selectTabViewItemAtIndex:" },
+    { 0x6fe38e876bd3c07aULL, "setObjectValue:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc39d10406e2eb723ULL, "compare:options:range:locale:" },
+    { 0xe8185b5bf5683947ULL, "_didNotResolve:" },
+    { 0x7a36589842f7a85bULL, "addValue:forHTTPHeaderField:" },
+    { 0x8b7015de9df52188ULL, "drawKnob:" },
+    { 0x6c804ecdbeda056fULL, "_animateWithContext:" },
+    { 0x8a3729cd6e923c87ULL, "selectedItem" },
+    { 0x9db425b7d5f65035ULL, "_searchCell" },
+    { 0, NULL },
+    { 0xaaeb9ea574b66213ULL, "loadResourceDataNotifyingClient:usingCache:" },
+    { 0, NULL },
+    { 0xcf39da74a360ef9aULL, "hasAlpha" },
+    { 0, NULL },
+    { 0x48caa7797675785fULL, "insertObjects:atIndexes:" },
+    { 0x4b2d5eb9d504d827ULL, "getWhite:alpha:" },
+    { 0x5f5750e22e13e470ULL, "isRegularFile" },
+    { 0xdaace0e99b229e1bULL, "copyItemAtURL:toURL:error:" },
+    { 0x82b9ec01497a7ecfULL, "setHorizontallyCentered:" },
+    { 0x813e0e1b4aa27740ULL, "trackingArea" },
+    { 0x5cec9de6d4cd305dULL, "paragraphGlyphRange" },
+    { 0x797adea9dbf2657aULL, "scrollColumnsRightBy:" },
+    { 0, NULL },
+    { 0xe1280f6202b750efULL, "addNamespace:" },
+    { 0x2b7f5349a1c20d78ULL, "viewBoundsChanged:" },
+    { 0x46486b005645f56eULL, "setDataRetained:" },
+    { 0x271c3797bf97a018ULL, "preventWindowOrdering" },
+    { 0, NULL },
+    { 0xa18af1ebd8a05430ULL, "writeToURL:atomically:encoding:error:" },
+    { 0x8daba213fb4319a4ULL, "registerEncoding" },
+    { 0, NULL },
+    { 0x3235ba94b5e2a6fbULL, "setSaturation:" },
+    { 0x767b3b785c9c829bULL, "isButtonBordered" },
+    { 0xbafaf1a9f3d88a50ULL, "rectForBorder" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x695cf494b1417d14ULL, "processControlWithArgValue:" },
+    { 0x2a13d309200b16dbULL, "abbreviation" },
+    { 0x6b50aaf32da72463ULL, "drawAtPoint:" },
+    { 0x37848da955ffd667ULL, "_locale" },
+    { 0x1a9e7e2a0ec86066ULL, "usesFontPanel" },
+    { 0x001755bc04dd6cefULL, "libraryDirectory" },
+    { 0xec18a930bffe1ef4ULL, "classForCoder" },
+    { 0, NULL },
+    { 0x264e99640c4f7869ULL, "setIntAttribute:value:forGlyphAtIndex:" },
+    { 0, NULL },
+    { 0xbfa3001df1061693ULL, "_enclosingView" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdd4db49991a2706dULL, "setMonth:" },
+    { 0, NULL },
+    { 0xa8c2998a9d2d22c8ULL, "nibName" },
+    { 0xa65c99abdb62b6d9ULL, "isReady" },
+    { 0x5c3ba5a87df9773eULL, "fontWithName:matrix:" },
+    { 0x4114f05bbcd841aaULL, "setVerticalScroller:" },
+    { 0xc157594fd5e90067ULL, "_mouseInside" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6c8cbcbe8ffedcbaULL, "drawTickMarks" },
+    { 0x236e2cecca657e8fULL, "smallestEncoding" },
+    { 0, NULL },
+    { 0x49ddbe7ad7897f2bULL, "decimalNumberByAdding:" },
+    { 0x893e3cb40ec1fcceULL, "setFloatValue:knobProportion:" },
+    { 0x61254d722d85ccb2ULL, "imageInterpolation" },
+    { 0, NULL },
+    { 0xd6d3dada6ed3b4bbULL, "enableUndoRegistration" },
+    { 0, NULL },
+    { 0x258b0edc9ffa5ec9ULL, "removeObjectAtArrangedObjectIndex:" },
+    { 0x61bcb4c266610218ULL, "decodeValueOfObjCType:at:" },
+    { 0xb500628bbdd403a3ULL, "sharedSupportPath" },
+    { 0x6bff86edbd1aecd5ULL, "drawInRect:fromRect:operation:fraction:" },
+    { 0x4db5f521bd602905ULL, "_extractWordTwo" },
+    { 0x54ea3970d4861b14ULL, "yank:" },
+    { 0x9b9c7144c32f5845ULL, "cut:" },
+    { 0xd8d2b1054e04ea03ULL, "titleOfColumn:" },
+    { 0x6f59bc70486f637eULL, "changeDictionary" },
+    { 0xfbfbc2592b18a72cULL, "windowRef" },
+    { 0xb311a80de0ee8a2dULL, "localizedDescriptionForType:" },
+    { 0x2b5bdd02df1a5752ULL, "moveParagraphBackwardAndModifySelection:" },
+    { 0x22f2fb949563003cULL, "_demangleTypeEncoding:to:" },
+    { 0xe76877d1c847397bULL, "numberOfComponents" },
+    { 0xe736007f6c33a866ULL, "IBeamCursor" },
+    { 0xe918b0ec6cce952cULL, "handleMonitorIndicatesAbandoned:" },
+    { 0x88fe16e0ea932b4bULL, "selectTabViewItemWithIdentifier:" },
+    { 0x3638259d028f7e4fULL, "imageRepClassForPasteboardType:" },
+    { 0xbd359bdc71e5752dULL, "expressionForFunction:arguments:" },
+    { 0x9bb77ba49e3f691bULL, "color" },
+    { 0x4f9a04af9183d1a1ULL, "collectionBehavior" },
+    { 0x06eaa0e1817e8e04ULL, "sizeToCells" },
+    { 0x1daf40b196130844ULL, "_setValue:withSelector:fromKey:" },
+    { 0, NULL },
+    { 0x6175f01719067721ULL, "_delayResizeButExpandItem:expandChildren:" },
+    { 0xb5c037633a91442eULL, "poofImageSize" },
+    { 0x9c7ef3fecd710d88ULL, "stringFromNumberPercentStyle:" },
+    { 0x55f2442b7d49d309ULL, "compositeToPoint:operation:" },
+    { 0, NULL },
+    { 0xd1a366110aad415cULL, "lineHeightMultiple" },
+    { 0xc31f9f472749d4f9ULL, "pathStyle" },
+    { 0x326c0c88edcf386dULL, "markerLocation" },
+    { 0x17e588deb3dc630fULL, "beginEditing" },
+    { 0, NULL },
+    { 0x50a300801f3b8141ULL, "standardWindowButton:" },
+    { 0x01c0c6a0f693ca79ULL, "_cfTypeID" },
+    { 0x7e2adf4736f632b5ULL, "setTimeoutInterval:" },
+    { 0, NULL },
+    { 0xa8a54f6f51b10642ULL, "replacementString" },
+    { 0xa7ea0839ff3f6822ULL, "addCursorRect:cursor:" },
+    { 0, NULL },
+    { 0x5f7f849a14f61b0bULL, "removePersistentDomainForName:" },
+    { 0, NULL },
+    { 0x49f5d630d20bb525ULL, "editColumn:row:withEvent:select:" },
+    { 0x961b7617cbd94a4dULL, "createHorizontalScrollerIfNeeded" },
+    { 0, NULL },
+    { 0x1cf6750eeead00a1ULL, "setOptions:" },
+    { 0, NULL },
+    { 0x47dff10b9a3ac91aULL, "applyToObject:inRow:keyPath:" },
+    { 0x2aa2810a71c14f4eULL, "replyToApplicationShouldTerminate:" },
+    { 0xeada386c548f9befULL, "controlTint" },
+    { 0x9b6643fe1e1c30e6ULL, "deleteBackward:" },
+    { 0, NULL },
+    { 0x7a1e4255e7930413ULL, "proxyWithLocal:connection:" },
+    { 0xec2586e1fa236711ULL, "instanceMethodForSelector:" },
+    { 0x4c665266ee8f7a01ULL, "hash" },
+    { 0xc5b283746f94227dULL, "setSource:" },
+    { 0xc854e035ae5e6f55ULL, "localizedDescription" },
+    { 0x08e8836b0797aa6cULL, "isEqualToHost:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf59a6a38821edb18ULL, "remove:" },
+    { 0xec1369bd63a5fab3ULL, "setOutputFormat:" },
+    { 0, NULL },
+    { 0xe3afce932711faf8ULL, "substitutionsPanel" },
+    { 0, NULL },
+    { 0xc3fb3f19d665459cULL, "firstUnlaidGlyphIndex" },
+    { 0xfae4c352a04a086cULL, "expiresDate" },
+    { 0xcf2ee60ca7d1a8e0ULL, "localizedFailureReason" },
+    { 0xaaf3bd54a97ed3cdULL, "selectText:" },
+    { 0x8a9d062b36ee6ca1ULL, "tableView:validateDrop:proposedRow:proposedDropOperation:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x61bc55d012826ea8ULL, "resolve" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xfa1c5da9daea5115ULL, "writeToFile:options:error:" },
+    { 0x5e07cbe2e3a6db85ULL, "change:" },
+    { 0x61f81067d8aea96dULL, "setVersion:" },
+    { 0x0113b2e0171f1aaaULL, "decodeBytesWithReturnedLength:" },
+    { 0, NULL },
+    { 0xfdb0d591cfb9244fULL, "replaceCharactersInRange:withRTFD:" },
+    { 0x70b5504f53724f0dULL, "transformToLayer" },
+    { 0x25e4fe29e65ed199ULL, "opaqueAncestor" },
+    { 0xcf9466292a0d8c79ULL, "encodeConditionalObject:" },
+    { 0x7bc706384dc8c36cULL, "isUndoing" },
+    { 0xcddea82504fd01feULL, "disableScreenUpdatesUntilFlush" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xbfd326b31fd5ddcfULL, "valueWithNonretainedObject:" },
+    { 0x80ed5d385e8facbbULL, "rulerAttributesInRange:" },
+    { 0, NULL },
+    { 0x5d1891847f187ce6ULL, "paragraphSpacing" },
+    { 0x89ba051ccef16a9fULL, "selectItemWithTag:" },
+    { 0x92c93fa4051f0df5ULL, "attributeName:" },
+    { 0xf57e9cac6efc0e31ULL, "poofAtLocation:size:animationDelegate:didEndSelector:contextInfo:" },
+    { 0xce492baa7f13ea9dULL, "moveItemAtURL:toURL:error:" },
+    { 0x1a2fcbed89ae9eaeULL, "_configureAsStandardItemIfNeeded" },
+    { 0x4ab12bfda3d9a62aULL, "setPixelsWide:" },
+    { 0xba95888f9eb754e3ULL, "wantsMoreIncoming" },
+    { 0x416c9d836d6906f9ULL, "delayedPerformWithObject:selector:argument:" },
+    { 0xe82f6846483ae2d6ULL, "insertGlyphs:length:forStartingGlyphAtIndex:characterIndex:" },
+    { 0x258c19a7db831cb9ULL, "_addAttribute:value:range:" },
+    { 0xc5b2f58b57147ca9ULL, "isSubclassOfClass:" },
+    { 0x1013e79a00234d0eULL, "minimumLineHeight" },
+    { 0xdad735d3e830a56aULL, "finalWritePrintInfo" },
+    { 0x7918bd69d021e9beULL, "isDefaultSetView" },
+    { 0x77c92b972313ff2bULL, "_contentObjects" },
+    { 0, NULL },
+    { 0xb50a8f3e7a3b0cf2ULL, "drawsGrid" },
+    { 0, NULL },
+    { 0xf22db2faabf47458ULL, "setMaximumLineHeight:" },
+    { 0xc015269841c77b6bULL, "selectRow:inColumn:" },
+    { 0, NULL },
+    { 0x36ec4602efa15e3eULL, "greyscaleDidChange:" },
+    { 0, NULL },
+    { 0x8c11ed6deb22ecceULL, "setFontPanelFactory:" },
+    { 0xc9f5aad9fe971afdULL, "setSendsWholeSearchString:" },
+    { 0x4bf6d6c54b4ac761ULL, "splitViewWillResizeSubviews:" },
+    { 0xfb384d2153c76c65ULL, "miterLimit" },
+    { 0x4a97fa7726a03c9bULL, "saveToURL:ofType:forSaveOperation:delegate:didSaveSelector:contextInfo:" },
+    { 0x5592171664086280ULL, "isSelectable" },
+    { 0x9a0886c3ef26e4feULL, "sendAction:to:" },
+    { 0x626bae032e226dc0ULL, "setIndentationLevel:" },
+    { 0x5fd6a12c06b61332ULL, "flushColorInfo" },
+    { 0x01a6a75b2288e507ULL, "setPathStyle:" },
+    { 0x95eec07c76facaf2ULL, "showPanel" },
+    { 0, NULL },
+    { 0x6501c6d6985f0d1fULL, "toolbarCustomizationPalette" },
+    { 0x3f6852a65199fdf1ULL, "contentResizeIncrements" },
+    { 0x6dd4bbb43ba5d898ULL, "borderColor" },
+    { 0xf79555f3882a871bULL, "sortUsingSelector:" },
+    { 0, NULL },
+    { 0x96331a5344a25a07ULL, "setValue:forKey:" },
+    { 0x575143681884adfdULL, "_animate" },
+    { 0xe0ab1b68a047e794ULL, "removeFromSuperviewWithoutNeedingDisplay" },
+    { 0xf3c061dc903619aaULL, "startAnimation:" },
+    { 0x9db3d87d2d487676ULL, "_contentObject" },
+    { 0x281cf1d679476a6bULL, "drawPopUpButtonWindowBackgroundInRect:" },
+    { 0x00e0fed30f924492ULL, "maxPossiblePositionOfDividerAtIndex:" },
+    { 0x7a437f9474d8cc12ULL, "childCount" },
+    { 0, NULL },
+    { 0x32ad73ff8e37ff7cULL, "URLByStandardizingPath" },
+    { 0xc4e1f69b22b0aac4ULL, "typesAndOwnerWithTypes:owner:" },
+    { 0x4d99ab99f51de7baULL, "_registryNameToAbbreviation:" },
+    { 0xc22c8e591feb028dULL, "setUsesWeakReadAndWriteBarriers:" },
+    { 0, NULL },
+    { 0x914d259624f56d1eULL, "setMarker:" },
+    { 0x3f90a2e5c00a51aeULL, "moveToBeginningOfDocumentAndModifySelection:" },
+    { 0xca6b45230c15f1ecULL, "conditionClass" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x99902765b5388b11ULL, "allBundles" },
+    { 0x55b0b4326ca10ccfULL, "_setLinearDoubleValueFromPoint:" },
+    { 0xe95d7606469306caULL, "textAttributes" },
+    { 0x5cad5c61459fa202ULL, "invalidateLayoutForCharacterRange:isSoft:actualCharacterRange:" },
+    { 0x7829e7db2fdb5cc3ULL, "addColumn" },
+    { 0xb7571a1bacb50530ULL, "startAnimation" },
+    { 0x1426b268328b10f0ULL, "popUpOverflowMenu:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd02d04dc202572f8ULL, "highlightsBy" },
+    { 0x63de5cd6d1b3a120ULL, "coalesceNotification:inQueue:coalesceMask:" },
+    { 0, NULL },
+    { 0x51a679de8792a39cULL, "_textDidEndWithMovement:" },
+    { 0xdf28f1b0638f8741ULL, "_displayAllWindowsIfNeeded" },
+    { 0, NULL },
+    { 0x5e703295f9af998eULL, "elementWithName:" },
+    { 0x8bbc8356a531fadaULL, "spellServer:suggestGuessesForWord:inLanguage:" },
+    { 0x6370f4f596f971edULL, "_resetInfoPanel" },
+    { 0x6229373d7b2b0c46ULL, "numberOfTabViewItems" },
+    { 0x484bbbf16d435e77ULL, "_paginateWithPageRange:context:" },
+    { 0, NULL },
+    { 0x05f859e998f08e0dULL, "toolTipForSegment:" },
+    { 0x32321d7ab5a24380ULL, "menuFormRepresentation" },
+    { 0x01cadef5374c676aULL, "_periodicDelay:" },
+    { 0xd78d1be6650580afULL, "setSelector:" },
+    { 0xd833eabc9854fbaaULL, "greenComponent" },
+    { 0x1f54339e0e4a4711ULL, "tableViewColumnDidMove:" },
+    { 0xeba8cf2be8e488caULL, "mouseLocationOutsideOfEventStream" },
+    { 0xd321404fab6c4909ULL, "layerContentsRedrawPolicy" },
+    { 0x52351841273fac81ULL, "handlePortMessage:" },
+    { 0xed43f3ba77ce3bc8ULL, "_configureTextContainerSize" },
+    { 0x541d6b8e8a35514fULL, "coreGraphicsEvent" },
+    { 0, NULL },
+    { 0x8b20654cb6f45de4ULL, "_KVO_className" },
+    { 0x6e784129a14ffc7fULL, "convertFont:toFace:" },
+    { 0x4387b73fdbe2207aULL, "isBycopy" },
+    { 0x8cc1ae692e93b452ULL, "attributeWithName:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x9013c413cbea3e36ULL, "drawInBezierPath:relativeCenterPosition:" },
+    { 0xcc897f7a92c34c98ULL, "setNextState" },
+    { 0, NULL },
+    { 0x82a235606e90343cULL, "writeToURL:ofType:" },
+    { 0x6590aa44b3d64b8dULL, "fontDescriptorWithFamily:" },
+    { 0x5e125896eb28aa90ULL, "theme:" },
+    { 0xeded1c965ed67bbaULL, "setNextParentWindow" },
+    { 0, NULL },
+    { 0x064b8bf10abb9f9aULL, "greenColor" },
+    { 0x52714d974d516db4ULL, "setMaxSize:" },
+    { 0x7feed8af46d8fc2fULL, "allowsMixedState" },
+    { 0x6a6ef02e9fa796d8ULL, "lockFocusIfCanDraw" },
+    { 0x7d2164c745a33f3cULL, "appendBezierPathWithArcWithCenter:radius:startAngle:endAngle:clockwise:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x9bdc243e85f2c9b4ULL, "handleFailureInFunction:file:lineNumber:description:" },
+    { 0x7c2c5407a9ec36a5ULL, "setResourceData:" },
+    { 0x06ee3dd9b5ce724dULL, "paragraphSeparatorGlyphRange" },
+    { 0, NULL },
+    { 0x634434ee8971afd4ULL, "connection:didReceiveResponse:" },
+    { 0xeb692640a429bb15ULL, "setString:forType:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xa4acb5fd236c717dULL, "dictionaryFromElement:" },
+    { 0x267b575a9e20798dULL, "selectedTextAttributes" },
+    { 0x1812577f0600e21fULL, "_alertButton:" },
+    { 0x7112316ad0949d05ULL, "syncUp" },
+    { 0x59a1def6a20e9837ULL, "tableColumns" },
+    { 0xe81dbfc8d5e96bc8ULL, "removeFrameUsingName:" },
+    { 0x2f64e7bee1b16962ULL, "setMaxConcurrentOperationCount:" },
+    { 0x556d29bb1c042965ULL, "externalNameTable" },
+    { 0, NULL },
+    { 0x452ed7c8b3632e1fULL, "sound" },
+    { 0x6fd37e2af7889dd4ULL, "_clipAndDrawInRect:" },
+    { 0x6a58ba75fded2f95ULL, "generateGlyphsForGlyphStorage:desiredNumberOfCharacters:glyphIndex:characterIndex:" },
+    { 0x87839040b6cc07ddULL, "isEmpty" },
+    { 0xc762fab7b97ef635ULL, "setFilename:" },
+    { 0x11c04abffe4ea8d2ULL, "moveToEndOfParagraph:" },
+    { 0x1ad3c5b7f384244dULL, "autosavesConfiguration" },
+    { 0x5aa014d087de0e92ULL, "rectPreservedDuringLiveResize" },
+    { 0x3c7a5efc95cf987aULL, "allConnections" },
+    { 0x433f0fca57f4d11aULL, "runModalForDirectory:file:types:" },
+    { 0, NULL },
+    { 0xaddeb0f4aa98c575ULL, "textUnfilteredTypes" },
+    { 0x8ad89b82426bf8edULL, "removeInputSource:" },
+    { 0x984975e88b727573ULL, "launchApplication:showIcon:autolaunch:" },
+    { 0x8d72a97328eb3cd6ULL, "setShowsFirstResponder:" },
+    { 0x5ff027c5b014c1e0ULL, "unmapAddress:length:" },
+    { 0x8a9888c0ea0b090cULL, "collapseItem:collapseChildren:" },
+    { 0xa9180635edbce3d4ULL, "platformWindow" },
+    { 0, NULL },
+    { 0xa0efe6d654291ce7ULL, "setFrameFromContentFrame:" },
+    { 0x0a15523f2e135c1dULL, "imageScaling" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x7898bfb02ef67f41ULL, "generalPasteboard" },
+    { 0x49bcff2474063a54ULL, "setSelectedRange:" },
+    { 0xb927a0be30598f5bULL, "setCompletes:" },
+    { 0, NULL },
+    { 0xb4ef84713c3ab712ULL, "setDefaultNameServerPortNumber:" },
+    { 0, NULL },
+    { 0x24dee9bd08d4b5fbULL, "grayscaleConstant:" },
+    { 0x2e4abcb8db7c2f38ULL, "isDirectory" },
+    { 0x73da5ba12f4238b4ULL, "symbolicTraits" },
+    { 0, NULL },
+    { 0x959b4c29839753c3ULL, "insertItemWithTitle:atIndex:" },
+    { 0x5d7edadeb8fd4348ULL, "willChangeValueForKey:" },
+    { 0xd2d1edc873a451acULL, "encodeUnsignedInteger:" },
+    { 0xf0af12e3df434c27ULL, "setResizable:" },
+    { 0x8caad41f431da8b8ULL, "indexAtPosition:" },
+    { 0x6babee82437fedbcULL, "didEndShouldCloseSheet:returnCode:contextInfo:" },
+    { 0x91f81d1655b5e57aULL, "getTIFFCompressionTypes:count:" },
+    { 0x990bccd955647c2eULL, "fileWrapperRepresentationOfType:" },
+    { 0x16cc23461f1558e0ULL, "memoryCapacity" },
+    { 0x69b63659c68ab616ULL, "recentsAutosaveName" },
+    { 0x687b3f44bea81355ULL, "initWithTextAlignment:location:options:" },
+    { 0xaec2494206391197ULL, "autosizesCells" },
+    { 0x5ec7e9ea4002e69dULL, "registerPort:name:" },
+    { 0, NULL },
+    { 0x9a61e8ca5a7f065aULL, "flushBuffer:only:" },
+    { 0x4f1df02c42c1bc17ULL, "animationCurve" },
+    { 0xdc809c649eb23025ULL, "_parentWindowDidActivate:" },
+    { 0x431176bcc49bcc18ULL, "retainArguments" },
+    { 0, NULL },
+    { 0x4c247722a8ec6c04ULL, "resetCursorRect:inView:" },
+    { 0x90e96212548a6575ULL, "createTexture:fromView:internalFormat:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xcc810dbe3df89668ULL, "characters" },
+    { 0x4b956e69becb4dd7ULL, "showsApplicationBadge" },
+    { 0, NULL },
+    { 0xc6e8bccdab5e2fdaULL, "makeUntitledDocumentOfType:" },
+    { 0, NULL },
+    { 0x8f67f1571277f1c5ULL, "storeDiskCachedResponse:forRequest:" },
+    { 0x1a8c27264e56145cULL, "_isApplicationWindow" },
+    { 0x25fe26ae8cb7281bULL, "dimpleImage" },
+    { 0, NULL },
+    { 0x4b19fd2db27cafaaULL, "layoutFrameSizeWithWidth:" },
+    { 0x6327de792b8e211dULL, "titleRectForBounds:" },
+    { 0xe149495b85e1c40eULL, "tableView:heightOfRow:" },
+    { 0xa48e4e1632b1a404ULL, "italicAngle" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf9d33ceb298fb757ULL, "miniaturize:" },
+    { 0x37eda35e15c54b58ULL, "defaultBehavior" },
+    { 0, NULL },
+    { 0xca49da7e9f55d548ULL, "cellFrameForTextContainer:proposedLineFragment:glyphPosition:characterIndex:" },
+    { 0, NULL },
+    { 0x2fc122d3ea4b4e85ULL, "_extractClass" },
+    { 0xc17a24bd02e8bf0eULL, "setValue:forHTTPHeaderField:" },
+    { 0x9bee85f73e563475ULL, "filenamesFromDROPFILES:" },
+    { 0x5a4e17dfe8c5a919ULL, "_enclosingClipView" },
+    { 0x69d257737c641a6fULL, "setMaxNumberOfColumns:" },
+    { 0x39901244463b065eULL, "requestCheckingOfString:range:types:options:inSpellDocumentWithTag:completionHandler:" },
+    { 0xdde759ad64b43658ULL, "setFloatingPointFormat:left:right:" },
+    { 0x710e0ade748d141aULL, "removeObjectForRead:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb39f5a1ed4705141ULL, "postNotificationName:object:userInfo:deliverImmediately:" },
+    { 0x6d2a50ba58ed907eULL, "_windowsDataFromRegistry:stdName:daylightName:" },
+    { 0x46ef1432ef781658ULL, "getCharacters:" },
+    { 0x26e3c441a363fb53ULL, "_setUntitledNumber:" },
+    { 0xfb324a9b5e61e071ULL, "idleProcessMode:" },
+    { 0, NULL },
+    { 0x2682ca4101e772edULL, "retain" },
+    { 0x67591dc26cc007e8ULL, "displayRectIgnoringOpacity:inContext:" },
+    { 0x585168b98e3e1cc5ULL, "roundingBehavior" },
+    { 0x4bf84d10e5dd7465ULL, "paragraphCharacterRange" },
+    { 0, NULL },
+    { 0x79b232bc64357e1eULL, "convertBaseToScreen:" },
+    { 0, NULL },
+    { 0xcd3da120cfd0e28dULL, "drawInsertionPointInRect:color:turnedOn:" },
+    { 0xe2f08273a4aeb463ULL, "clearRecentDocuments:" },
+    { 0x812b2c906d92a758ULL, "setPaperSize:" },
+    { 0x04fe2406c76655efULL, "addFontTrait:" },
+    { 0x306233434c925f06ULL, "getCString:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4e3d6a4da5b98854ULL, "connectionWithRequest:delegate:" },
+    { 0xee85999ea124262bULL, "convertPointToBase:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xa7b84ba5e7db8338ULL, "rangeOfTextTable:atIndex:" },
+    { 0x44fb214ed82b198cULL, "endDocument" },
+    { 0x6705b287546b3482ULL, "redColor" },
+    { 0, NULL },
+    { 0x682a148e43778cabULL, "lockClass" },
+    { 0xa5341630e25071cfULL, "fileType" },
+    { 0x316efea4db40cf31ULL, "catalogName" },
+    { 0x7243238c1e41ae65ULL, "_createPlatformWindowOnMainThread" },
+    { 0x6456f9afafea6371ULL, "setVolatileDomain:forName:" },
+    { 0x6e3a523e2befd773ULL, "baseWritingDirection" },
+    { 0x255557c7d2f668aaULL, "allLanguages" },
+    { 0xb152f0afba616bebULL, "postMSG:keyboardState:" },
+    { 0x9e748f3b7e2d1b09ULL, "setShowsBorderOnlyWhileMouseInside:" },
+    { 0xaa37090d591f0d05ULL, "controlSize" },
+    { 0x0fea91af760ea0e7ULL, "setCurrentDirectoryPath:" },
+    { 0xb57edb7c2cbbbc87ULL, "maxConcurrentOperationCount" },
+    { 0x0da31f0b3d1b1db6ULL, "negativeSuffix" },
+    { 0xd5f7c008e7ef3e34ULL, "orderFrontRegardless" },
+    { 0xaef616799319930aULL, "setAutomaticSpellingCorrectionEnabled:" },
+    { 0xa609097b9ebc4b10ULL, "defaultMiterLimit" },
+    { 0, NULL },
+    { 0x74305e36c4699253ULL, "coveredCharacterSet" },
+    { 0x622ae81bebd7ed60ULL, "submenu" },
+    { 0xa056212bd34aa893ULL, "keyCodeForLParam:isKeypad:" },
+    { 0x9469f8b38f36daf7ULL, "dataUsingEncoding:allowLossyConversion:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xed9af3a4a0c70550ULL, "needsToDrawRect:" },
+    { 0x374f5e884b7ef2e3ULL, "getValue:" },
+    { 0, NULL },
+    { 0xe9d834069d9669b1ULL, "setNegativeInfinitySymbol:" },
+    { 0x90c21cdf68263f86ULL, "replacementClassForClass:" },
+    { 0x648d17f8b2069a1dULL, "dataForRootObject:" },
+    { 0x862539a430a8442cULL, "setReleasedWhenClosed:" },
+    { 0x779288af89046eeeULL, "endPrinting" },
+    { 0x305ec8275e4563faULL, "URLProtocol:wasRedirectedToRequest:redirectResponse:" },
+    { 0x95259be379acb9a1ULL, "appendCString:" },
+    { 0xf8d945514af8abf8ULL, "undoManagerForTextView:" },
+    { 0xb5ac13a77b6171dfULL, "viewFrameChanged:" },
+    { 0xd1ec459ce85b4e7fULL, "DNSHostName" },
+    { 0x8b65e8141f50868dULL, "currentParagraphStyle" },
+    { 0x1f220dccebc116b9ULL, "applicationShouldTerminateAfterLastWindowClosed:" },
+    { 0x70a1c560f296eaaaULL, "drawStrikethroughForGlyphRange:strikethroughType:baselineOffset:lineFragmentRect:lineFragmentGlyphRange:containerOrigin:" },
+    { 0x720ce0b39c9fe2c7ULL, "setFrameTopLeftPoint:" },
+    { 0xb800dfc663026d5dULL, "_didStopSearch" },
+    { 0, NULL },
+    { 0x58274ed2990b9bc9ULL, "initialValue" },
+    { 0x1f4dc63162e0333cULL, "setHorizontalLineScroll:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdf14efc3ceb7868aULL, "unregisterDraggedTypes" },
+    { 0xc2914e50ba3348c3ULL, "_realTypes" },
+    { 0xbc30858d70a47158ULL, "initWithStyle:" },
+    { 0x1842d375ea0a5c3bULL, "writePDFInsideRect:toPasteboard:" },
+    { 0xd329ef97c46457cbULL, "_defaultToolbarItems" },
+    { 0xd411b03ab2dd9eb2ULL, "scrollLineUp:" },
+    { 0xfed2612b181cb089ULL, "decodePortObject" },
+    { 0x6db61c829d669aacULL, "hasEditedDocuments" },
+    { 0x18a5210528b3340aULL, "shouldAntialias" },
+    { 0xc2d9a4c01f5adc39ULL, "colorWithCyan:magenta:yellow:black:alpha:spaceName:" },
+    { 0x182c0ce7839bc32cULL, "moveRightAndModifySelection:" },
+    { 0x8d21be2921147c08ULL, "beginAsynchronousNetService" },
+    { 0x1a8a4c42eeab383eULL, "daylightSavingTimeOffsetForDate:" },
+    { 0xa600d794dc6f2be6ULL, "highlightColorWithFrame:inView:" },
+    { 0xacd318b137c8cee4ULL, "_receiverForDragSession:" },
+    { 0xa9415dc19030f203ULL, "_binderForBinding:create:" },
+    { 0x14f1bcdfe55e561aULL, "resultSurface" },
+    { 0, NULL },
+    { 0xb279c2f1c4cde0bdULL, "numberStyle" },
+    { 0xe68ebebe6f15b057ULL, "setHasShadow:" },
+    { 0xa5032e43a1bf24b1ULL, "moveWordForward:" },
+    { 0xcccaa8452049146dULL, "orderedPerformWithSelector:target:argument:order:modes:" },
+    { 0xc2993d640cd80bcdULL, "didEndSelector" },
+    { 0xcb66f1d9b01d3b6dULL, "fileManager:shouldProceedAfterError:linkingItemAtPath:toPath:" },
+    { 0x77a1e2d1c140fa58ULL, "fireInMode:" },
+    { 0xb5f0ccdc4cee3091ULL, "WM_SIZING_wParam:lParam:" },
+    { 0xc5287f424bb61e01ULL, "setPaperName:" },
+    { 0xcbb1f519bfa858e2ULL, "processInfo" },
+    { 0, NULL },
+    { 0x2340993b0d24564bULL, "runMode:beforeDate:" },
+    { 0, NULL },
+    { 0xa3f02b770ea9008eULL, "selectedRanges" },
+    { 0xa10a717736b4609bULL, "splitView:constrainMinCoordinate:maxCoordinate:ofSubviewAt:" },
+    { 0, NULL },
+    { 0xa1a47c30d8da4162ULL, "drawScrollerTrackInRect:vertical:" },
+    { 0xd16eaf094639f339ULL, "deselectSelectedCell" },
+    { 0x08dcc9cb40a5b4d9ULL, "headIndent" },
+    { 0xdde7747c7691a0d8ULL, "clearDrawable" },
+    { 0xc346571eac185f88ULL, "_pickerCell" },
+    { 0x04d427bfb75853ccULL, "removeSelectedObjects:" },
+    { 0xdee9b22a10c99607ULL, "colorFromPasteboard:" },
+    { 0xbf2ef5b2207242c1ULL, "setControlSize:" },
+    { 0xbabd563bbf1867d1ULL, "spellCheckingResultWithRange:" },
+    { 0x394d7f80ebf99b5aULL, "imageFrameStyle" },
+    { 0xfdbf9d4172cac21dULL, "setHasHorizontalRuler:" },
+    { 0x4d9e2711a3e6f4acULL, "EnumDAdvise:" },
+    { 0x31b5a112ae630793ULL, "currentDirectoryPath" },
+    { 0x139346bf9a61b740ULL, "intercellSpacing" },
+    { 0x66e88d5f06d55f4fULL, "deleteToEndOfParagraph:" },
+    { 0, NULL },
+    { 0xb2f22c3e35259a76ULL, "showWindowWithoutActivation" },
+    { 0x73fc889e0d83f168ULL, "frameChanged" },
+    { 0x6a046342b85fd437ULL, "autoenablesItems" },
+    { 0, NULL },
+    { 0xdca6454248a0c6d3ULL, "becomeKeyWindow" },
+    { 0xe76a8ee44536b0e7ULL, "setCurrencySymbol:" },
+    { 0x349fcef9bc1c2546ULL, "_createLayersInTreeIfNeeded" },
+    { 0, NULL },
+    { 0x3520d21a8af85d09ULL, "graphicsStyle" },
+    { 0x982f54a0843a12b3ULL, "setIgnoresMouseEvents:" },
+    { 0x5abd59ce1fc4569cULL, "setAttributes:range:" },
+    { 0x4ddee5de1c021692ULL, "beginParagraph" },
+    { 0x6ee25e09620f9766ULL, "modalSession" },
+    { 0xaeda8690c5d18545ULL, "_appendWordEight:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x09917812bca05332ULL, "substituteGlyphsInRange:withGlyphs:" },
+    { 0xcf633fd42fa9725aULL, "createSurfaceWithWidth:height:" },
+    { 0x114384b70d034cb8ULL, "lastColumn" },
+    { 0x8e723685358e4763ULL, "standardInput" },
+    { 0x84181b01f7ea1f39ULL, "weightOfFont:" },
+    { 0x62eb3d9d84e52903ULL, "imageOrigin" },
+    { 0x79c8042ea8279dd9ULL, "setQueuePriority:" },
+    { 0x2091d0ed5ae5e9dbULL, "descriptionWithCalendarFormat:locale:" },
+    { 0x6b5ac61fcb64ecb7ULL, "isMainThread" },
+    { 0x7243679dd626ca08ULL, "setHighlighted:" },
+    { 0xb28f81e0cb58838fULL, "isColumnSelected:" },
+    { 0x095b6da73ace6545ULL, "selectFile:inFileViewerRootedAtPath:" },
+    { 0x904cbcd12fbdebfaULL, "rectArrayForGlyphRange:withinSelectedGlyphRange:inTextContainer:rectCount:" },
+    { 0x470d51e0c1da7088ULL, "menuView" },
+    { 0x88282fd4e5c2382dULL, "changeFileAttributes:atPath:" },
+    { 0xf0ebf3903ddeb964ULL, "localizesFormat" },
+    { 0x93c112ee085253c5ULL, "setLastComponentOfFileName:" },
+    { 0xc730284dbc07f30bULL, "animation:valueForProgress:" },
+    { 0, NULL },
+    { 0x6af0cf127e49fa47ULL, "tableViewColumnDidResize:" },
+    { 0x620af7ba9486b1beULL, "object:performSelector:withObject:afterDelay:inModes:" },
+    { 0xed6fe32bfe7895e5ULL, "setDependantKeyObservers:" },
+    { 0x53f93d3febdabce4ULL, "drawWithFrame:inView:characterIndex:layoutManager:" },
+    { 0xf53a3e23985a6acfULL, "titleMargins" },
+    { 0x9344cdc72ecef432ULL, "colorWithDeviceWhite:alpha:" },
+    { 0xd5b3c572c18ce0c6ULL, "showsBorderOnlyWhileMouseInside" },
+    { 0x99d1fab4528cecb1ULL, "_appendFloat:" },
+    { 0x130984cc6c576276ULL, "indexOfCellWithTag:" },
+    { 0xae37e6f1e0397d21ULL, "canSelectNext" },
+    { 0x6623fc632fde67deULL, "hideWindowForAppDeactivation:" },
+    { 0x617fae1c6ce35f3cULL, "_animationContext" },
+    { 0x1cbd4c605077344fULL, "variable" },
+    { 0xfc280e6866e6f018ULL, "__appendLocale:key:index:" },
+    { 0x0b8745b06e1783dcULL, "completedString:" },
+    { 0x0434ac5bbcf1566aULL, "bidiProcessingEnabled" },
+    { 0x35506c3fc73b646eULL, "transformToWindow" },
+    { 0x5d403d525f79e441ULL, "removeDocument:" },
+    { 0x39b87d25de397611ULL, "menuForResult:string:options:atLocation:inView:" },
+    { 0x26fd48c3b9c6de49ULL, "numberOfGlyphs" },
+    { 0, NULL },
+    { 0x7a12f56a3f4c9b8aULL, "_closeDocumentsStartingWith:shouldClose:closeAllContext:" },
+    { 0x563037928201bbe0ULL, "dictionary" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x9bf3f1d24bd48d3bULL, "representations" },
+    { 0xb835e8fc862652b6ULL, "dashCheckingResultWithRange:replacementString:" },
+    { 0, NULL },
+    { 0x2bcd20dc4052e5abULL, "establishConnection" },
+    { 0, NULL },
+    { 0x51cb27f2024634b9ULL, "localizedInfoDictionary" },
+    { 0x761a1e3f20c4fd74ULL, "quartzDebuggingIsEnabled" },
+    { 0x1174d8553a870d27ULL, "scheduleInRunLoop:forMode:" },
+    { 0x7c2f9e22c960db3bULL, "didChange:valuesAtIndexes:forKey:" },
+    { 0, NULL },
+    { 0xadca59cf1c7194cfULL, "setClass:forClassName:" },
+    { 0x96c313d5e9752f7aULL, "toggleToolbarShown:" },
+    { 0x8ab6eca4a1fea201ULL, "_buildCachedItemRects" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x996fc6e0f18b01b0ULL, "isExpandable:" },
+    { 0xeda07744fee78408ULL, "setMsgid:" },
+    { 0xefa1eacb093e32f4ULL, "positionOfGlyph:precededByGlyph:isNominal:" },
+    { 0xdbba3d64f510eaadULL, "fileWrapperFromRange:documentAttributes:error:" },
+    { 0x419c273ae90c20e5ULL, "numberWithBool:" },
+    { 0, NULL },
+    { 0x957d8ca7b7996dc2ULL, "bezierPath" },
+    { 0x081bb7d9b1f3db8aULL, "removeInputSource:forMode:" },
+    { 0x1f06d20a3bbbe4e0ULL, "orderedWindows" },
+    { 0x1d0b24938e93f0a2ULL, "editingStringForObjectValue:" },
+    { 0x169fefd60a0cdb3aULL, "viewWillStartLiveResize" },
+    { 0xb0a36ccea95de9ddULL, "invokeInvocations" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x53a1f6e2b9d0973dULL, "setValue:" },
+    { 0, NULL },
+    { 0x7d472a5e7712178aULL, "launch" },
+    { 0x933a639a8b1963f8ULL, "createRulerViewsIfNeeded" },
+    { 0xf1967fe11b199d24ULL, "setMatchesOnMultipleResolution:" },
+    { 0xe9b976733e2e861dULL, "horizontalPageScroll" },
+    { 0x26310da6573539bfULL, "replaceTextStorage:" },
+    { 0x91c296864a64ca3cULL, "drawArrow:highlight:" },
+    { 0, NULL },
+    { 0xf73690ae9c5b8756ULL, "writableTypes" },
+    { 0xe841e1d9572c6fb9ULL, "colorWithCalibratedRed:green:blue:alpha:" },
+    { 0x1642807915b91c52ULL, "stringArrayForKey:" },
+    { 0x4ead6702d3056854ULL, "setVerticalAlignment:" },
+    { 0x038849883c515bf8ULL, "vendor" },
+    { 0, NULL },
+    { 0xb4ec049322dcde06ULL, "titleFont" },
+    { 0x99b710b74ebe33c3ULL, "unhide:" },
+    { 0xb9619bd08d163b54ULL, "drawUnborderedButtonInRect:defaulted:" },
+    { 0x48d9a044c43adc3dULL, "isHiddenOrHasHiddenAncestor" },
+    { 0xdb4e40c091fba9d1ULL, "setRowValues:" },
+    { 0x749832f122c205beULL, "setAttributedTitle:" },
+    { 0xe37f1767530ab588ULL, "lastIndex" },
+    { 0x40dfa606b6fa6a85ULL, "fileExtensionsFromType:" },
+    { 0x63af3d409d88272aULL, "getBytes:range:" },
+    { 0xc203803068988d8eULL, "moveToEndOfDocumentAndModifySelection:" },
+    { 0x20a3e724adc7265bULL, "fastestEncoding" },
+    { 0x7f818d70c701fdaaULL, "lineBreakBeforeIndex:withinRange:" },
+    { 0x7dd7853a16f098f0ULL, "setFloat:forKey:" },
+    { 0xe6cfa2b5c64337a8ULL, "setSelectedItemIdentifier:" },
+    { 0, NULL },
+    { 0xc16aa011d8eddeb6ULL, "keyboardFocusIndicatorColor" },
+    { 0x9b15edcff1edc942ULL, "RTFFromRange:documentAttributes:" },
+    { 0x47179ba50b013031ULL, "setDrawer:" },
+    { 0x739fd0bef750c8f3ULL, "pathsForResourcesOfType:inDirectory:" },
+    { 0, NULL },
+    { 0x96e7cc3050c9b311ULL, "frameOfColumn:" },
+    { 0xd52e8b229855d456ULL, "defaultButtonCell" },
+    { 0x50e8b03208dd6861ULL, "setRowHeight:" },
+    { 0x035efc513a41a8fcULL, "setSelectsInsertedObjects:" },
+    { 0x96000ee8d794b07aULL, "setAttachment:" },
+    { 0xd73494723372362dULL, "fillColor" },
+    { 0, NULL },
+    { 0x509075ba2e62e107ULL, "getLineDash:count:phase:" },
+    { 0x7da1299417bb1f36ULL, "setKeyEquivalentFont:" },
+    { 0x66a299130b82f3d6ULL, "showGlyphs:advances:count:" },
+    { 0xb9ab09d9180e85bfULL, "setFileAttributes:" },
+    { 0, NULL },
+    { 0x1d9d114270f8d53eULL, "drawLabel:inRect:" },
+    { 0x91a94a830e00a104ULL, "_selectionDidChange" },
+    { 0x11e542465774f61dULL, "getRectsExposedDuringLiveResize:count:" },
+    { 0x969013eec546d4adULL, "textureInternalFormat" },
+    { 0xceedafa24a1fa8d5ULL, "operatingSystem" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x14c411930c5b97e7ULL, "Drop::::" },
+    { 0x808c2ce05c9e8c81ULL, "transformUsingAffineTransform:" },
+    { 0x2d7d8cb428abfc56ULL, "lineSpacingAfterGlyphAtIndex:withProposedLineFragmentRect:" },
+    { 0xd06214da74568a3bULL, "poseAsClass:" },
+    { 0, NULL },
+    { 0xe803f305a8fa13e7ULL, "encodeObject:forKey:" },
+    { 0x05e78fb85b79bb67ULL, "drawTitle:withFrame:inView:" },
+    { 0x5d8c2f5d21721c03ULL, "setMessage:" },
+    { 0xc67469ba7f9177d5ULL, "userFontOfSize:" },
+    { 0xa529302755360bc3ULL, "addToolTipRect:owner:userData:" },
+    { 0xcc77a56e714ce135ULL, "persistence" },
+    { 0xfcaef736d7ac74b3ULL, "launchedApplications" },
+    { 0x872f782d403c26fdULL, "minimumSize" },
+    { 0x498c011d1d81d415ULL, "_stopObservingSelectedObjects" },
+    { 0, NULL },
+    { 0xe5f3617a955359b5ULL, "colorUsingColorSpaceName:" },
+    { 0x6dd7264cf92fe99fULL, "editedRow" },
+    { 0xc80c63de3181bd52ULL, "dateWithCalendarFormat:timeZone:" },
+    { 0x65aa29fa6368d7d3ULL, "parser:foundInternalEntityDeclarationWithName:value:" },
+    { 0xde13ec776d6a68d7ULL, "menuItemGutterSize" },
+    { 0x581c9b5a990999a7ULL, "localTimeZone" },
+    { 0xb6bb15715d99bb2fULL, "tabView" },
+    { 0x048ba0a6e79a6a8eULL, "persistentDomainForName:" },
+    { 0x5c90ba9ce79ff10bULL, "_setHeaderTitle:" },
+    { 0, NULL },
+    { 0xa8355f9f7c58a9f9ULL, "textColor" },
+    { 0, NULL },
+    { 0x3e7bc996486fc300ULL, "_setRect:" },
+    { 0x93714d7ff2b6e535ULL, "parser:didEndElement:namespaceURI:qualifiedName:" },
+    { 0x2202c81f354869faULL, "setTextAttributesForNotANumber:" },
+    { 0xa8950ecf51e910acULL, "bitmapFormat" },
+    { 0, NULL },
+    { 0x85583788e6f707b3ULL, "thicknessRequiredInRuler" },
+    { 0x267f72c6446adb7dULL, "insertItemWithObjectValue:atIndex:" },
+    { 0x55b10fc816dfb21eULL, "setTerminationStatus:" },
+    { 0xc8df5d67bcf5a55cULL, "initWithData:" },
+    { 0x4143009cf9c2ce0aULL, "isMovableByWindowBackground" },
+    { 0, NULL },
+    { 0xbefe627e01380c49ULL, "fontDescriptorByAddingAttributes:" },
+    { 0, NULL },
+    { 0x7dbe3d346d95bb19ULL, "years:months:days:hours:minutes:seconds:sinceDate:" },
+    { 0x4e1823c638f5d370ULL, "sharedFrameworksPath" },
+    { 0xb018b28696ef0bafULL, "setLineDash:count:phase:" },
+    { 0xa0736a8023288820ULL, "pageFooter" },
+    { 0x2f86f7b5205d7092ULL, "setCachedValue:" },
+    { 0x892e809f49478ec2ULL, "translateFromNibFontName:" },
+    { 0xc20ce13bb7de2369ULL, "notificationCenter" },
+    { 0xda2e1ed4435c38b5ULL, "setReplyTimeout:" },
+    { 0xf56431a94b526277ULL, "relativeMoveToPoint:" },
+    { 0, NULL },
+    { 0xb3d39b3a1eb91841ULL, "_replacementKeyPathForBinding:" },
+    { 0, NULL },
+    { 0xdfac0d4ae5dd6b79ULL, "parser:parseErrorOccurred:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x94e72284b60d5c53ULL, "updateLayeredWindow" },
+    { 0, NULL },
+    { 0xedc6cb06b23293f8ULL, "setMaxNumberOfRows:" },
+    { 0, NULL },
+    { 0xf8ca20629b756886ULL, "setAlphaValue:" },
+    { 0, NULL },
+    { 0x1b3da247ffe96433ULL, "preventsApplicationTerminationWhenModal" },
+    { 0x62aad9deff2f9a4bULL, "predicateWithFormat:argumentArray:" },
+    { 0, NULL },
+    { 0x1fd309ac16ecea9bULL, "isRotatedOrScaledFromBase" },
+    { 0xe23fe66bbfba16c1ULL, "prefersTrackingUntilMouseUp" },
+    { 0x2be659feee335ed1ULL, "buildSystemColors" },
+    { 0xb0481bac403646e1ULL, "noteFileSystemChanged:" },
+    { 0x34113e9091362294ULL, "_orderedPerforms" },
+    { 0x1680b3f07a86d3b4ULL, "scrollCellToVisibleAtRow:column:" },
+    { 0x521d4062f9ef3703ULL, "_KVC_isSetterForSelectorNameStartingWith:endingWith:" },
+    { 0x70422438ab458276ULL, "fileSystemRepresentationWithPathW:" },
+    { 0x31a1c5ad03ae2935ULL, "currentState" },
+    { 0x0b7f82bc2db9e2afULL, "dataCellForRow:" },
+    { 0x73f6d8199b88461dULL, "retainCount" },
+    { 0x8ed29adf1ac79f8eULL, "addAttribute:" },
+    { 0x724d383b2e7a94a4ULL, "getCyan:magenta:yellow:black:alpha:" },
+    { 0, NULL },
+    { 0xd37af80d01a040baULL, "setStroke" },
+    { 0x1933a517484d9fdbULL, "setRoundingIncrement:" },
+    { 0x0bfb790d8bff187dULL, "replaceChildAtIndex:withNode:" },
+    { 0x3a91b6095de0d6ccULL, "_expandWidth:" },
+    { 0, NULL },
+    { 0xcd9b5c12493906d9ULL, "alwaysShowsDecimalSeparator" },
+    { 0x9cc85337c603a649ULL, "insertChildren:atIndex:" },
+    { 0xce5f1352fd73a9c2ULL, "keyEquivalentMargins" },
+    { 0xa86014d0e6dfb217ULL, "themeChanged" },
+    { 0x5368de545330b137ULL, "_setTrackingArea:" },
+    { 0, NULL },
+    { 0xaa5b9249171128ebULL, "setShouldCascadeWindows:" },
+    { 0x02e3f21760fa2803ULL, "setToolTip:" },
+    { 0x32db79d7823f5e38ULL, "_updateHue:saturation:brightness:" },
+    { 0x9eec4f06ac9ddef7ULL, "setSharedURLCache:" },
+    { 0x6b13b04ee74cce7fULL, "stringByAbbreviatingWithTildeInPath" },
+    { 0, NULL },
+    { 0x0ceb0274a5067637ULL, "reviewUnsavedDocumentsWithAlertTitle:cancellable:" },
+    { 0xc59dbaf6ac80463fULL, "itemWithTag:" },
+    { 0x47b590829660e4c3ULL, "mainMenu" },
+    { 0xe327103931727a01ULL, "setMiniwindowTitle:" },
+    { 0xfe990aeec57d0ef5ULL, "isByref" },
+    { 0x41c3fca44c759306ULL, "provideNewView:" },
+    { 0xc27859086d9e5582ULL, "flagsChanged:" },
+    { 0xf0956c813ebcd29bULL, "sheetOrderFrontFromFrame:aboveWindow:" },
+    { 0x6d82d5a86ad30982ULL, "setOutlineTableColumn:" },
+    { 0x7b6fddd34aa5e5d2ULL, "setTabView:" },
+    { 0, NULL },
+    { 0x264d4934a0bfb54aULL, "matrixClass" },
+    { 0xe3792556f9280ea6ULL, "setCollectionBehavior:" },
+    { 0, NULL },
+    { 0x254018ed41d5cc1aULL, "ignoreSpelling:" },
+    { 0, NULL },
+    { 0x51640a2b6b89d815ULL, "setByAddingObjectsFromSet:" },
+    { 0xe172a2e16156a49bULL, "tableView:objectValueForTableColumn:row:" },
+    { 0x3848e6b04163a809ULL, "fragment" },
+    { 0x8d81dd031664966bULL, "draggingSourceOperationMask" },
+    { 0x0aba8d8b806bcedcULL, "createDirectoryAtPath:attributes:" },
+    { 0x53e021d64c8c91e1ULL, "setSortDescriptorPrototype:" },
+    { 0xc15704d4ddaa0e64ULL, "moveToBeginningOfParagraph:" },
+    { 0x4e13d1c2ae78581aULL, "windowBackgroundColor" },
+    { 0xbcf751c14e6687beULL, "reservedSpaceLength" },
+    { 0x20da851e6a553de6ULL, "hasUnappliedChanges" },
+    { 0, NULL },
+    { 0x9d81808ec02d0cf1ULL, "isEqualToDictionary:" },
+    { 0x3a21ea1c4f1fa577ULL, "ignoreModifierKeysWhileDragging" },
+    { 0, NULL },
+    { 0xac9ecbae1921e22eULL, "boundingRectWithSize:options:" },
+    { 0, NULL },
+    { 0xdf578e220bcffc6fULL, "removeItemWithObjectValue:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x860770701be06a6cULL, "setHorizontalRulerView:" },
+    { 0x484a45a7710728afULL, "availableRectForSubview" },
+    { 0x9c970fdd5940684dULL, "valueForDimension:" },
+    { 0, NULL },
+    { 0x29736c113fba02b9ULL, "setPersistentDomain:forName:" },
+    { 0x402262ae000d94f2ULL, "setAllowedFileTypes:" },
+    { 0x9a0041b5e82db825ULL, "drawComboBoxButtonInRect:enabled:bordered:pressed:" },
+    { 0, NULL },
+    { 0xdbd9fe4dd107e41dULL, "rangeAtIndex:" },
+    { 0xab2501c20a57c203ULL, "descriptionWithCalendarFormat:" },
+    { 0x3b7ad6a6952bda6dULL, "createTransformToWindow" },
+    { 0xa85e43843178368cULL, "performDragOperation:" },
+    { 0xfbad3e741599c50aULL, "nextKeyView" },
+    { 0x63cb1d844451824fULL, "flushGraphics" },
+    { 0x638c31b3f7a002a1ULL, "leafKeyPath" },
+    { 0x973e7e3337a79288ULL, "lockBeforeDate:" },
+    { 0xed7df2388f7b4913ULL, "drawBoxWithBezelInRect:clipRect:" },
+    { 0x86dd3afbd973e58fULL, "argumentsRetained" },
+    { 0, NULL },
+    { 0x86430cb454e863aaULL, "encodeWithCoder:" },
+    { 0x3904840c9fc54085ULL, "setMinItemSize:" },
+    { 0xf82aa6b396ab66b7ULL, "elementsForName:" },
+    { 0x83895cbd417b4fd6ULL, "appendStringFromRange:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5f9cdbc73399f833ULL, "soundNamed:" },
+    { 0xc4f2e6d70c801d28ULL, "indexOfObject:inRange:" },
+    { 0xac51fa744667f7b1ULL, "outlineView:shouldCollapseItem:" },
+    { 0xefe515d11dd9aa3cULL, "allowsBranchSelection" },
+    { 0x0512cd0f80494767ULL, "children" },
+    { 0x4f35d8d11e7e5a34ULL, "firstIndex" },
+    { 0, NULL },
+    { 0x23e1a6d0a00bc2c4ULL, "animationShouldStart:" },
+    { 0x00340833c8e2c404ULL, "evaluateWithObject:" },
+    { 0x6a3ac1654ad2683fULL, "removeCollection:" },
+    { 0xe29b95d85ce0c2a8ULL, "setFileURL:" },
+    { 0xc8023315ca6b7398ULL, "stringByDeletingPathExtension" },
+    { 0x3a2fdef1adbfc52aULL, "attributedSubstringFromRange:" },
+    { 0xf870f5c2d59ccdf3ULL, "setTransparent:" },
+    { 0x0c8fc7fe4de6e2adULL, "originOffset" },
+    { 0x330575ceb1114c49ULL, "sizeModeChanged:" },
+    { 0x85f39358ef789e8aULL, "clearRedoStackIfStateIsNormal" },
+    { 0x17c1cf9e7d7614ddULL, "bitsPerPixel" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x86f77f53fed3702eULL, "cachedFontWithName:size:" },
+    { 0, NULL },
+    { 0x70704c551917243bULL, "mouseEventWithType:location:modifierFlags:window:clickCount:deltaX:deltaY:" },
+    { 0x00e6c1443793058cULL, "indexOfObject:" },
+    { 0xd796f688b152eb08ULL, "defaultFormatterBehavior" },
+    { 0, NULL },
+    { 0x3504492634d9c155ULL, "_dataForDocumentTag:" },
+    { 0xdfd550b098d7de36ULL, "setScrollView:" },
+    { 0x1051d6da018aa853ULL, "_removeAllToolTips" },
+    { 0xca9964a7b1fcda6bULL, "_clipAndDrawInRect:withAttributes:" },
+    { 0x5c1e02c6ec5100e2ULL, "outlineViewItemWillExpand:" },
+    { 0x115a0f07d813135eULL, "whiteColor" },
+    { 0, NULL },
+    { 0x5970551bef1a6488ULL, "setInteger:forKey:" },
+    { 0x0668bd2db4f91fcbULL, "removeWindowsItem:" },
+    { 0xfcb031fc960d1acdULL, "headerRectOfColumn:" },
+    { 0, NULL },
+    { 0x7b8af87737b586d9ULL, "dictionaryRepresentation" },
+    { 0xf61b3810cbdfd3ecULL, "magentaColor" },
+    { 0xf9d9734dea0b82c3ULL, "binding" },
+    { 0x410657ed84549f4bULL, "substituteFontForFont:" },
+    { 0x290fcda8a6e2b680ULL, "enclosingMenuItem" },
+    { 0x38a0f439f5bca9eeULL, "fileSystemRepresentationWithPath:" },
+    { 0, NULL },
+    { 0x8be0606e3202596aULL, "dealloc" },
+    { 0xd23dbfef6df01e24ULL, "rulerView:willMoveMarker:toLocation:" },
+    { 0x55c251a060141cceULL, "arrowsPosition" },
+    { 0x625b1862e3cc6f14ULL, "contentsEqualAtPath:andPath:" },
+    { 0xec765cac70db0533ULL, "unload" },
+    { 0x8bdbcb0ff07bd75dULL, "arrayByAddingObjectsFromArray:" },
+    { 0x28d4631502b1dc64ULL, "calendarIdentifier" },
+    { 0xc654a1c41d454e36ULL, "doesNotRecognizeSelector:" },
+    { 0x0273e7123b7e6846ULL, "addClip" },
+    { 0x672f58144c2fec07ULL, "propertyListFromDocument:" },
+    { 0, NULL },
+    { 0x33c091810df2d970ULL, "setOnStateImage:" },
+    { 0x4593825a5d8eea00ULL, "didChangeText" },
+    { 0xd6071c751948ae9eULL, "minimumDaysInFirstWeek" },
+    { 0, NULL },
+    { 0x2cc94af6c9e37574ULL, "read:maxLength:" },
+    { 0, NULL },
+    { 0x65c72cc5034f57acULL, "writeToFile:" },
+    { 0x4d7f8dc14fb547c3ULL, "sortedArrayUsingFunction:context:" },
+    { 0x1807eda1bd0758a5ULL, "cookiesWithResponseHeaderFields:forURL:" },
+    { 0x1e953c4a0f0a1aaeULL, "setOriginalValue:" },
+    { 0, NULL },
+    { 0x74ef2f8c5aae998cULL, "cacheDepthMatchesImageDepth" },
+    { 0xb704c5ce066a8a30ULL, "removeItemAtPath:error:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdf3a16aa875649bfULL, "setTextColor:" },
+    { 0, NULL },
+    { 0x29168a8f42b03efbULL, "availableStringEncodings" },
+    { 0, NULL },
+    { 0x878718105af6d702ULL, "noteColumnDidResizeWithOldWidth:" },
+    { 0x0596ba8c71e96335ULL, "setSize:" },
+    { 0x195df4d9d367bec4ULL, "updateViewParameters" },
+    { 0xd481365b6548722cULL, "cacheImageInRect:" },
+    { 0xce65be0e2e50a763ULL, "draggingEntered:" },
+    { 0, NULL },
+    { 0xc86eb8d0916ee725ULL, "runUntilDate:" },
+    { 0, NULL },
+    { 0x3c20eb01b6f72ff4ULL, "duration" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xeefafc24a8040261ULL, "isNonBlocking" },
+    { 0, NULL },
+    { 0xe0ed7af9d28fc441ULL, "numberOfColorStops" },
+    { 0xeb96063511fcf1a1ULL, "isPartialStringValidationEnabled" },
+    { 0x3db882aec1734672ULL, "deleteWordForward:" },
+    { 0, NULL },
+    { 0x4f04b0c05e05f87aULL, "allowsTickMarkValuesOnly" },
+    { 0x2acd69f077129574ULL, "_ffiInvokeWithTarget:" },
+    { 0xa61782d74e67c2f5ULL, "isMultiple" },
+    { 0x571c4264bb56af89ULL, "setVerticallyResizable:" },
+    { 0xb7ac1899050a0b9fULL, "checkMarkSize" },
+    { 0x75fe1c72ec4a3bd8ULL, "timeIntervalSince1970" },
+    { 0xf7343ac2d2791c1dULL, "drawMenuGutterInRect:" },
+    { 0x3729d2b46abe95a1ULL, "setIcon:" },
+    { 0xfbd07d15963e92ffULL, "_processWin32Event:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xe7c4928662408702ULL, "colorWithRed:green:blue:alpha:spaceName:" },
+    { 0xe5e2ce7f9636e607ULL, "refusesFirstResponder" },
+    { 0xe9459ebc24586797ULL, "allowsKeyedCoding" },
+    { 0x27e04e7c1c502fddULL, "writeWithBackupToFile:ofType:saveOperation:" },
+    { 0x061d9a96509b4a76ULL, "canChooseDirectories" },
+    { 0x6300f98e44b09f18ULL, "shouldCollapseAutoExpandedItemsForDeposited:" },
+    { 0x97a83c6c3eefc02bULL, "traitName" },
+    { 0xa7494dfe12144568ULL, "performMnemonic:" },
+    { 0xc1d11384cf27a980ULL, "matrixInColumn:" },
+    { 0x06ef406ff4c341d4ULL, "canBecomeKeyView" },
+    { 0xa427be6a5f147d09ULL, "indexPathWithIndexes:length:" },
+    { 0x5994d6bfe03d20d6ULL, "_editTextCell:row:column:event:" },
+    { 0xa36e0a73a4e59206ULL, "writeSelectionToPasteboard:type:" },
+    { 0x9cf6f9fffbc2a09aULL, "setToolbar:" },
+    { 0x93a8b13e49a152bbULL, "_valueRectForBounds:" },
+    { 0, NULL },
+    { 0xae463b93c21910abULL, "textView" },
+    { 0xd38240352e1d30d1ULL, "lowercaseWord:" },
+    { 0, NULL },
+    { 0x5b6e76dab35fd515ULL, "setCornerRadius:" },
+    { 0x915394e0aa82ce05ULL, "previousNode" },
+    { 0xa0fa3929a3677cd7ULL, "environment" },
+    { 0, NULL },
+    { 0xff2a5d7618268ddeULL, "addMetric:" },
+    { 0xe19af9a2c4faacf4ULL, "indentationMarkerFollowsCell" },
+    { 0x75831946e8cfdf59ULL, "setSpellingState:range:" },
+    { 0xb69789543d1e7b31ULL, "writeToURL:ofType:error:" },
+    { 0, NULL },
+    { 0x7a0f86c5caca8cc0ULL, "numberWithLong:" },
+    { 0x10167a6af8302819ULL, "firstIndentMarkerWithRulerView:location:" },
+    { 0xee7af1d0bcd0daf5ULL, "localeIdentifierFromComponents:" },
+    { 0x798c112711bd9ca9ULL, "setGlyphGenerator:" },
+    { 0x40a6ab10d64de08cULL, "updateChangeCount:" },
+    { 0x4cc3b98b5ee83577ULL, "setWeek:" },
+    { 0, NULL },
+    { 0x87088afc2ef7db3bULL, "loadColumnZero" },
+    { 0xf01a5e921ee9b6c1ULL, "_insertRange:position:" },
+    { 0x6f9adbdcf39f72e7ULL, "setTypingAttributes:" },
+    { 0, NULL },
+    { 0x6269266085594fe5ULL, "hashFunction" },
+    { 0xa715f9252fe52e74ULL, "applicationShouldOpenUntitledFile:" },
+    { 0x54837000121044e4ULL, "menuItemGutterMargins" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5012d1e3aaea3e88ULL, "exponentSymbol" },
+    { 0xee1ae482bae6ec81ULL, "types" },
+    { 0x5f856fd061970806ULL, "normalizeAdjacentTextNodesPreservingCDATA:" },
+    { 0xf41ad56858570140ULL, "waitForHandleActivityBeforeDate:mode:" },
+    { 0, NULL },
+    { 0x03696a2b1fa8c132ULL, "setProgressMarks:" },
+    { 0xed81cd6c665ba8c3ULL, "setOpenGLContext:" },
+    { 0x08c72e01ecd7cc53ULL, "setControlTint:" },
+    { 0xb4a0a61b9d766730ULL, "windowWillBeginSheet:" },
+    { 0xe98a0b1e7337ff22ULL, "horizontalScrollerFrame" },
+    { 0x766e2d6714595a36ULL, "createTransformToLayer" },
+    { 0, NULL },
+    { 0x40b30ca35dddc13fULL, "drawCellAtRow:column:" },
+    { 0xdc977cbb79e8e843ULL, "datePickerCell:validateProposedDateValue:timeInterval:" },
+    { 0x8f25bca352a2c9b5ULL, "sizeWithAttributes:" },
+    { 0x8d835dccc41e5dfbULL, "_removeAllRecentDocumentsFromMenu:" },
+    { 0xa78bb85d7e95e6dbULL, "convertPoint:fromView:" },
+    { 0x55c474d8c561be01ULL, "sendsWholeSearchString" },
+    { 0x26ab9adb80768d9dULL, "stepCount" },
+    { 0xd0c45e5876ead87fULL, "push" },
+    { 0xe3d0131d44cdd575ULL, "streamStatus" },
+    { 0x4152dfbcaba5f3f0ULL, "dayOfMonth" },
+    { 0xc788335e5e37822aULL, "topMargin" },
+    { 0x732a4b29c71a3898ULL, "_updateHandleLocation" },
+    { 0x7a676b40e6345578ULL, "restoreGraphicsState" },
+    { 0x02b5f98b1dd1f3e1ULL, "setLocale:" },
+    { 0x45d3513a787a64ecULL, "_didFindDomain:moreComing:" },
+    { 0x6ef133e45f39a18aULL, "contentFilters" },
+    { 0x4bb9df09e3f115d0ULL, "selectedColumnIndexes" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb00213affe19812eULL, "setScrollsDynamically:" },
+    { 0, NULL },
+    { 0xb634cae95b0ffbdcULL, "setWindowBorderType:" },
+    { 0x01d1435821b1c847ULL, "buildTypefaceMatrix" },
+    { 0xfcdef2d4a90f2cf9ULL, "setButtonBordered:" },
+    { 0x73fdccb37778cabfULL, "setIntercellSpacing:" },
+    { 0, NULL },
+    { 0xdd4b3fc281895d60ULL, "colorPanelWillClose:" },
+    { 0x1d30b712dab6bcc8ULL, "predicateOperatorType" },
+    { 0x572a951a1d1a7a14ULL, "convertWeight:ofFont:" },
+    { 0x3a00ca9e1d706f20ULL, "setCookie:" },
+    { 0x1e3a8f407c02f480ULL, "_adjustSubviewWidths" },
+    { 0x9b6c2756725d5268ULL, "sender" },
+    { 0xa64fe9810a4fe7e6ULL, "currentSystemCursor" },
+    { 0, NULL },
+    { 0xa18df3ca9bad49e6ULL, "noteHeightOfRowsWithIndexesChanged:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2063b039dd613514ULL, "readFromFile:ofType:" },
+    { 0xe75fdac52de5bf6bULL, "appendAttributedString:" },
+    { 0xb2f366a72e79dd64ULL, "setPreventsApplicationTerminationWhenModal:" },
+    { 0xb2b5a4223c31775bULL, "countYCrossingFromPoint:toCurveFrom:to:tan1:tan2:" },
+    { 0, NULL },
+    { 0x233eaa4de9fe7382ULL, "readInBackground:data:" },
+    { 0x42471b4d8f111f52ULL, "decodeUnsignedCharForKey:" },
+    { 0x337b1aca5e820065ULL, "glyphInfoWithGlyph:forFont:baseString:" },
+    { 0x419a2666b6999f8dULL, "xid" },
+    { 0x25803eabec28bc0bULL, "invalidateContextsWithNewSize:" },
+    { 0xc23781c6bc3321e8ULL, "comparisonPredicateModifier" },
+    { 0x1396bd9470c2f4fbULL, "parameterString" },
+    { 0, NULL },
+    { 0xef3461c3cea1a048ULL, "_insertObject:inArraySortedByDescriptors:" },
+    { 0x23da7f2213a11954ULL, "dateCheckingResultWithRange:date:timeZone:duration:" },
+    { 0xe774de9ad2ff3a7bULL, "encodeSize:" },
+    { 0x04d3accfbd84a395ULL, "isMultiThreaded" },
+    { 0x7d1afdded7c9e076ULL, "setContextHelpModeActive:" },
+    { 0xa1a025c69a6e4a42ULL, "scrollBarColor" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xc2003cf6061f3acfULL, "imageUnfilteredPasteboardTypes" },
+    { 0, NULL },
+    { 0x2c2be9336216628dULL, "isIndeterminate" },
+    { 0x5bf8c69c97509bfdULL, "isEqualToDate:" },
+    { 0x00c306146dcc0236ULL, "netServiceWillResolve:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x49c51481fb7dcf4cULL, "setAttributedString:" },
+    { 0xd6640f4a218775a6ULL, "_willChangeValueForKey:changeOptions:" },
+    { 0x18b4ce9b9e940974ULL, "mainScreen" },
+    { 0x797e817da06a7571ULL, "canBecomeKeyWindow" },
+    { 0xd4ece47b354f5df3ULL, "objectZone" },
+    { 0x63063a388df4d4c0ULL, "finishLaunching" },
+    { 0x71380108ef87be4aULL, "setResolvesAliases:" },
+    { 0, NULL },
+    { 0x3f71b80368bf3adcULL, "setScreenLocation:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xf9def7ffa17f3d46ULL, "initWithCoder:" },
+    { 0xc01bee902ad2ee12ULL, "rowsInRect:" },
+    { 0x7eabe3caf1107c30ULL, "swapInNewView:" },
+    { 0xc3829e23ed17591dULL, "selectedItemIndex" },
+    { 0, NULL },
+    { 0x37457fe26f0de25eULL, "testPart:" },
+    { 0xda97349ca2220455ULL, "setMemoryCapacity:" },
+    { 0x44b4f7a6de3073bfULL, "drawInRect:angle:" },
+    { 0, NULL },
+    { 0x694dbb991feb3ca5ULL, "scrollPoint:" },
+    { 0x71282ba3b52faa25ULL, "addTrackingArea:" },
+    { 0x9b37f2b92cd22788ULL, "removeObjects:" },
+    { 0x1af92200a5bb59ffULL, "load" },
+    { 0, NULL },
+    { 0x3179e34c4bcaf81eULL, "numberWithDouble:" },
+    { 0x20c10ce64725bc7cULL, "_rectInWindow" },
+    { 0xc4ec26e6b6873746ULL, "suggestedFilename" },
+    { 0x7c7446a499c62956ULL, "dragPromisedFilesOfTypes:fromRect:source:slideBack:event:" },
+    { 0x417cddc1324a7d2bULL, "rangeOfCharacterFromSet:" },
+    { 0x8627cb442dbfc73bULL, "getCFRunLoop" },
+    { 0x8393bcb60077feceULL, "decimalNumberByDividingBy:withBehavior:" },
+    { 0xa60026248cd01a38ULL, "drawMenuBranchArrowInRect:selected:" },
+    { 0xdd10c4d6417b17ceULL, "setAllowsEmptySelection:" },
+    { 0x4109b341cf36fab0ULL, "setFormatter:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xed5467bd1952a01eULL, "setShowsResizeIndicator:" },
+    { 0, NULL },
+    { 0x6fd400d9fb087e71ULL, "_backgroundView" },
+    { 0x090f98619c4e5dcbULL, "loadGlyphRangeTable" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2060fc0464b715e6ULL, "_background_beginSheetForDirectory:file:modalForWindow:modalDelegate:didEndSelector:contextInfo:" },
+    { 0x8d1e9851b2f39188ULL, "selectedRowInColumn:" },
+    { 0x9623e5da26cbcc2dULL, "EnumFormatEtc::" },
+    { 0xac4d58a0eb49b733ULL, "allHeaderFields" },
+    { 0, NULL },
+    { 0x6a8801d8b7cd0accULL, "windowHandle" },
+    { 0, NULL },
+    { 0x09718dcc369748eaULL, "setObjectArray:" },
+    { 0xe8d2865654f4e842ULL, "isSessionOnly" },
+    { 0xcdb8ae6ecc02a974ULL, "drawStepperButtonInRect:clipRect:enabled:highlighted:upNotDown:" },
+    { 0xe235e1665468bf20ULL, "extraLineFragmentUsedRect" },
+    { 0, NULL },
+    { 0xb03632af9cbb7c56ULL, "constrainScrollPoint:" },
+    { 0, NULL },
+    { 0xe8771293f6d60a3eULL, "WM_ENTERSIZEMOVE_wParam:lParam:" },
+    { 0x9750c652818c541dULL, "moveWordBackwardAndModifySelection:" },
+    { 0xa5397a909bbb0779ULL, "receivePort" },
+    { 0x24733ef30d79da40ULL, "URI" },
+    { 0x123ad27f1473df80ULL, "setByAddingObjectsFromArray:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x4262ff4c05b02747ULL, "setPixelBuffer:cubeMapFace:mipMapLeve:currentVirtualScreen:" },
+    { 0xbe68a123d27be69eULL, "trackMouse:inRect:ofView:untilMouseUp:" },
+    { 0x2e9d88f61ab2f773ULL, "setScanLocation:" },
+    { 0x4a74880c6a405c90ULL, "highlightMode" },
+    { 0, NULL },
+    { 0xb2b2ffe2e1b03116ULL, "textAttributesForPositiveValues" },
+    { 0, NULL },
+    { 0xf910d44b2c784334ULL, "attachedSheet" },
+    { 0x84668472e49cf332ULL, "tryToPerform:with:" },
+    { 0x39d2b4b244d74aaaULL, "waitForDataInBackgroundAndNotifyForModes:" },
+    { 0x2df05f9a9d038c5bULL, "stringByDeletingLastPathComponent" },
+    { 0xd09b5f10274cb77cULL, "localizedCompare:" },
+    { 0xf38d5bf0f9d8d194ULL, "setTitleFont:" },
+    { 0, NULL },
+    { 0x2f0321c245a0c92cULL, "host" },
+    { 0, NULL },
+    { 0x827fae0a302aff17ULL, "nextNode" },
+    { 0x997ca827180d13b6ULL, "objectDidEndEditing:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3e3f973803cf4bcbULL, "draggingSource" },
+    { 0x0ee464cd1b6a5798ULL, "clickedRow" },
+    { 0xda379ce2de4834f0ULL, "drawImage:inRect:" },
+    { 0xe8a92a40dfec5c30ULL, "imagePosition" },
+    { 0x8ac22fef2f4dcbe7ULL, "_encodeIndent:" },
+    { 0, NULL },
+    { 0xd240ce260c33dc69ULL, "TIFFRepresentationUsingCompression:factor:" },
+    { 0x60145694f88b62c4ULL, "fill" },
+    { 0xa615a00888898c32ULL, "textView:doCommandBySelector:" },
+    { 0x589deef2e2645a03ULL, "URLForResource:withExtension:subdirectory:localization:" },
+    { 0, NULL },
+    { 0x74f37e5d0b5b369bULL, "invalidateSystemColors" },
+    { 0x470d433bc95c1cd6ULL, "cairo_surface" },
+    { 0x7a95eeb074b7a4c1ULL, "removeMarker:" },
+    { 0, NULL },
+    { 0x8de066e598c1daacULL, "_startObservingKey:" },
+    { 0x243532fb128cb670ULL, "mouse:inRect:" },
+    { 0x1549046996375e97ULL, "endSheet:returnCode:" },
+    { 0xfd68fe492ba6b86fULL, "_clearCurrentContext" },
+    { 0x49a5df7b46b7cef1ULL, "drawString:withAttributes:atPoint:inSize:" },
+    { 0xaa64c2464a0cfef2ULL, "alphaValue" },
+    { 0xa318c8ff9e7422c3ULL, "currentWord" },
+    { 0x6aba2d4771a5a692ULL, "setTimeZone:" },
+    { 0x76cbb810f6b96509ULL, "setModalSession:" },
+    { 0xce8f1f7ce73c62ecULL, "descriptionWithLocale:indent:" },
+    { 0x7559f215869c99f6ULL, "pathForApplication:" },
+    { 0xfe6a066cf7147423ULL, "numberOfSelectedRows" },
+    { 0xc6d7565b8cbf6c0eULL, "setAspectRatio:" },
+    { 0, NULL },
+    { 0xdedc4eb28a44bd76ULL, "boolValue" },
+    { 0, NULL },
+    { 0x02fd164bbf8b3f29ULL, "decimalNumberByMultiplyingByPowerOf10:withBehavior:" },
+    { 0xf01df0ad77ff6ab2ULL, "setPrompt:" },
+    { 0xf53384c850b716a4ULL, "_windowDidBecomeActive:" },
+    { 0, NULL },
+    { 0x66381b63b2fb1b1fULL, "mouseDownCanMoveWindow" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x819c6f4e7db8f622ULL, "setSet:" },
+    { 0, NULL },
+    { 0xce26928937fbc6aeULL, "setStringValue:" },
+    { 0x2347ffb21648b678ULL, "currentDirectory" },
+    { 0x3b1f93d9d4bee0e9ULL, "deselectColumn:" },
+    { 0x4b2610b509d59e6eULL, "setNotationName:" },
+    { 0x958ee25ad687d6d1ULL, "setFireDate:" },
+    { 0x3e344b56d2980717ULL, "strokeLineFromPoint:toPoint:" },
+    { 0x22df8fe339f35404ULL, "sortedArrayUsingDescriptors:" },
+    { 0, NULL },
+    { 0x33e0e655356e6eeaULL, "characterIndexForPoint:" },
+    { 0x55b57c1a2986d8a5ULL, "applicationWillResignActive:" },
+    { 0xb70b7d7dc3b304cbULL, "dragOver:" },
+    { 0xbc921bb8679d4287ULL, "applicationOpenUntitledFile:" },
+    { 0x39e32f2a52df976fULL, "setFrame:" },
+    { 0, NULL },
+    { 0x7bfebf465ea979eeULL, "rangeForUserParagraphAttributeChange" },
+    { 0, NULL },
+    { 0x83c0548128c9bf03ULL, "setOnMouseEntered:" },
+    { 0, NULL },
+    { 0xd50c8972aa642367ULL, "setDropItem:dropChildIndex:" },
+    { 0, NULL },
+    { 0x63f49bccd8ed2256ULL, "attributedString" },
+    { 0xd57e95acba820560ULL, "pageSize" },
+    { 0x7acba329ba7eb392ULL, "timeout:" },
+    { 0xf6ab60054a5da01bULL, "sizeForMenuItemImage:" },
+    { 0x961d7c123642fef7ULL, "setTextFont:" },
+    { 0, NULL },
+    { 0xc786cfc40027f196ULL, "setIsEqualFunction:" },
+    { 0xd81a20ab9d292564ULL, "raise:format:" },
+    { 0xfac59b7010610f8dULL, "decodeIntegerForKey:" },
+    { 0xf006660137169d25ULL, "createPathForGlyph:transform:" },
+    { 0, NULL },
+    { 0xd145e42c6213e832ULL, "applicationWillUpdate:" },
+    { 0x64147aed57dfbf82ULL, "minimumSignificantDigits" },
+    { 0xd67825d870bee60eULL, "insertChild:" },
+    { 0x9fba829dcc680aefULL, "setLastFilePath:" },
+    { 0x092bd7e3ccf9058cULL, "drawCellInside:" },
+    { 0xff2a4ab5cc16f1e9ULL, "setShouldResolveExternalEntities:" },
+    { 0xfdfeb07029c3d8b5ULL, "addAddress:length:type:interfaceIndex:" },
+    { 0xd665f3f82980c887ULL, "areCursorRectsEnabled" },
+    { 0x01033cbf2967f703ULL, "createsSortDescriptor" },
+    { 0, NULL },
+    { 0xe4f1dfc1ed8367b5ULL, "indexGreaterThanIndex:" },
+    { 0x7286562458a4fe70ULL, "drawScrollerKnobInRect:vertical:highlight:" },
+    { 0x21e5a053d24978e0ULL, "setBool:forKey:" },
+    { 0x828a9ec2ef02613cULL, "content:" },
+    { 0xccd1aaa9dd6da47dULL, "URLsFromRunningOpenPanel" },
+    { 0, NULL },
+    { 0x7f40544012f21e86ULL, "decimalNumberByAdding:withBehavior:" },
+    { 0x3476e1b426d83d86ULL, "_spellingViewController" },
+    { 0x3122d619a8f6509eULL, "viewWillDraw" },
+    { 0, NULL },
+    { 0xdf4ef12b84c5dceeULL, "scrollRowToVisible:" },
+    { 0xae731a425b928bc9ULL, "valueForHTTPHeaderField:" },
+    { 0, NULL },
+    { 0xa4a468effc48f3aaULL, "_basePassword" },
+    { 0x36240a109feb2e44ULL, "hasShadow" },
+    { 0, NULL },
+    { 0x6c506645ab8c4af7ULL, "comboBoxSelectionIsChanging:" },
+    { 0x9106d35fbc4ce49cULL, "drawSliderTickInRect:" },
+    { 0xb181236efbcc637cULL, "fontFamilyWithName:" },
+    { 0, NULL },
+    { 0xdb32ae7c95ebd19bULL, "windowDidChangeScreenProfile:" },
+    { 0, NULL },
+    { 0x2eb94414d1aa228dULL, "attributedStringForObjectValue:withDefaultAttributes:" },
+    { 0x32d1fa4f07cf1b83ULL, "removeFileAtPath:handler:" },
+    { 0x28773fe5eadd7635ULL, "drawMenuItemText:inRect:enabled:selected:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x3e26a270b0066aa2ULL, "selectLine:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb1878281765ee5edULL, "ancestorSharedWithView:" },
+    { 0xda2acc79848e20ddULL, "rulerView:didRemoveMarker:" },
+    { 0x8d8347e0a609daacULL, "encodeRect:" },
+    { 0xb4cc5d52696d720bULL, "setEnvironment:" },
+    { 0x943b1d9e617724c5ULL, "title" },
+    { 0xaaa120a2b76db775ULL, "stringFromNumber:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xdb9cfaf7ae04ed40ULL, "updateWithView:" },
+    { 0x08118c413a20444eULL, "isExternal" },
+    { 0x9bfdd7eafc8c704dULL, "setFileModificationDate:" },
+    { 0xc7371c49162a410aULL, "writeToURL:options:error:" },
+    { 0x7fd7da72c07df818ULL, "removeColumn:" },
+    { 0, NULL },
+    { 0x7defddeba5bf16c8ULL, "resetStandardUserDefaults" },
+    { 0, NULL },
+    { 0xb2d72c4f424de8daULL, "removeRangeAtIndex:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb4929e28a9f31cd1ULL, "fireSingleImmediateInputInMode:" },
+    { 0xc7f1d9e9efc84c24ULL, "notANumberSymbol" },
+    { 0x2f3ec7bea856dba9ULL, "selectSegmentWithTag:" },
+    { 0xda5a2f1c02578674ULL, "_delegateChangeTextInRange:replacementString:" },
+    { 0x78cbc53c2fb33d95ULL, "prefix" },
+    { 0xef20f74f8869a210ULL, "allValues" },
+    { 0x9ca93c249658bb8bULL, "cancelIncrementalLoad" },
+    { 0x6782fa2a1e235ddcULL, "setTitled:" },
+    { 0x8c03eca4049db913ULL, "setShowsStateBy:" },
+    { 0x271a38fe2215785aULL, "createDirectoryAtURL:withIntermediateDirectories:attributes:error:" },
+    { 0x6ac083073a20c193ULL, "showInfoPanel:withOptions:" },
+    { 0x2544caf239625f5eULL, "firstLineHeadIndent" },
+    { 0x6e8fa63416560bb1ULL, "loadAndReturnError:" },
+    { 0x134eb87e906443ddULL, "showsPrintPanel" },
+    { 0x96c114239a98d692ULL, "runWithSocket:" },
+    { 0x66d3611547f6b419ULL, "removeRunLoop:" },
+    { 0, NULL },
+    { 0x153a391a7d97ee0eULL, "preferredBackingLocation" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1d40316c35038e3fULL, "parentGroup" },
+    { 0x81d7ff87f8e6a902ULL, "draggedImage:beganAt:" },
+    { 0x77631131a0b78893ULL, "countWordsInString:language:" },
+    { 0x003af9634f011ac7ULL, "reason" },
+    { 0xc3cf07132b5b7829ULL, "_resetMapTables" },
+    { 0xc173e5702ffdc15fULL, "fontDescriptorsInCollection:" },
+    { 0x0c8d13d6d4ca2793ULL, "setSubitems:" },
+    { 0, NULL },
+    { 0x6cf7cc54f775a43fULL, "glyphWithGlyphName:" },
+    { 0x53de611ea32f091dULL, "textAttributesForNegativeValues" },
+    { 0x1bb4fa9cf0330c70ULL, "helpAnchor" },
+    { 0xd0d5484d6d0e218cULL, "items" },
+    { 0x8e227aeded76d761ULL, "_insertSubview:atIndex:" },
+    { 0x0c77d061e44c8463ULL, "boldSystemFontOfSize:" },
+    { 0x7195797fc92522a0ULL, "defaultFlatness" },
+    { 0x86890022f650edc5ULL, "setQuarter:" },
+    { 0x5013bc07909c6e44ULL, "classDescription" },
+    { 0x7bb9ce89d790cca6ULL, "findMisspelledWordInString:language:wordCount:countOnly:" },
+    { 0xd21012468ed1a61bULL, "drawLinearSliderWithFrame:inView:" },
+    { 0, NULL },
+    { 0x6e94ebcb856c0abaULL, "setLanguage:" },
+    { 0x73c106154750200fULL, "bitsPerSample" },
+    { 0, NULL },
+    { 0x5ce68b07ad53abdbULL, "setValueURL:" },
+    { 0x81ad562c29b4529dULL, "setLineHeightMultiple:" },
+    { 0xe476f7957628e027ULL, "methodReturnLength" },
+    { 0, NULL },
+    { 0xda243571a5af35bfULL, "commentURL" },
+    { 0xed82fadf42af63b2ULL, "toolbar:itemForItemIdentifier:willBeInsertedIntoToolbar:" },
+    { 0x2da27d9d745d1f8dULL, "selectItemWithTitle:" },
+    { 0x0f3dd99129ece695ULL, "positionBranchForSelectedItem:screen:" },
+    { 0x50dae182678aaaacULL, "isReleasedWhenClosed" },
+    { 0x6f6f14d682f3cd2bULL, "setAutomaticallyPreparesContent:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x95405b61e66e7e26ULL, "protocolFamily" },
+    { 0x1785b18f9a2cd2a3ULL, "localizedName:locale:" },
+    { 0xaf746efca62101a4ULL, "setHeaderToolTip:" },
+    { 0xb1cc543d97dccd11ULL, "setBackgroundFilters:" },
+    { 0x743e6126eba5676dULL, "mixedStateImage" },
+    { 0, NULL },
+    { 0x7975a41dcc511220ULL, "exceptionWithName:reason:userInfo:" },
+    { 0x5385b9f133f17ffcULL, "language" },
+    { 0xf0d8de5a23e5cf09ULL, "isEqual:" },
+    { 0x5582740742341363ULL, "drawBarInside:flipped:" },
+    { 0xee968a3eaf2e54dbULL, "createBackingCGContextIfNeeded" },
+    { 0, NULL },
+    { 0x16efa8afe44009e8ULL, "orderFrontStylesPanel:" },
+    { 0xfbac06865a48a9eaULL, "rect" },
+    { 0, NULL },
+    { 0x43e85f9087cfccfbULL, "prepareWithInvocationTarget:" },
+    { 0x934d8a2af0869c90ULL, "visibilityPriority" },
+    { 0x8ba14312ff97198dULL, "drawerDidOpen:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x47bf66c6d8c81957ULL, "destinationValue" },
+    { 0x6f0ba971616eb72fULL, "_unbindAllBindings" },
+    { 0xbda570decd0a3fe0ULL, "persistantDomain" },
+    { 0x10070162b7301430ULL, "formatter" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x14cff5a7b976c3a7ULL, "fileExistsAtPath:isDirectory:" },
+    { 0x660ccf0529a14177ULL, "valueTransformerForName:" },
+    { 0xb9f946e2e72e4ef3ULL, "filePosixPermissions" },
+    { 0x6c53b1f936a856eaULL, "currentEvent" },
+    { 0x14ed5337f3e8458bULL, "textViewDidChangeSelection:" },
+    { 0x2d423147af98e4d9ULL, "availableLocaleIdentifiers" },
+    { 0xece6d64cd7ae5b69ULL, "alertStyle" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x5e2155652a467ae2ULL, "taskFinished" },
+    { 0x0f027d2d742a0636ULL, "ignore:" },
+    { 0x156b05aa13c98d03ULL, "encodeBool:forKey:" },
+    { 0x91ad9c0a2f973b0bULL, "noSelectionPlaceholder" },
+    { 0x8c1ad93b2d167184ULL, "modifierForDefault::" },
+    { 0, NULL },
+    { 0x8514537079acaabdULL, "setPerMillSymbol:" },
+    { 0x8c33d04fac5c974eULL, "scanInt:" },
+    { 0x4900f639b4c709c4ULL, "maxSize" },
+    { 0xd347c6c22131a471ULL, "setRootObject:" },
+    { 0, NULL },
+    { 0xfde03df287609469ULL, "layoutViewsWithWidth:setFrame:" },
+    { 0xde0639d83b21eb9cULL, "setBoundsRotation:" },
+    { 0xf4101628a43dc5e8ULL, "pathControl:shouldDragPathComponentCell:withPasteboard:" },
+    { 0x41a81a935bb34e99ULL, "stopLoading" },
+    { 0x7251cfd67c1ac112ULL, "userSpaceScaleFactor" },
+    { 0x445028d596afd3b7ULL, "rowValues" },
+    { 0x78b0e3973a908f61ULL, "iUknown" },
+    { 0xa3995c57dd49da99ULL, "viewWillMoveToWindow:" },
+    { 0x38127c376b61ca54ULL, "standardUserDefaultsAvailable" },
+    { 0x6be606e6055f387cULL, "windowFrameColor" },
+    { 0xd6e1f7f962726916ULL, "redComponent" },
+    { 0x0cb3efa7a4d8d0b7ULL, "conditionallySetsEditable" },
+    { 0xf383bb455f81c904ULL, "shouldDrawColor" },
+    { 0xd474f287d94965daULL, "pathWithComponents:" },
+    { 0xd2e7b15e64b26a54ULL, "_deselectAllCellsInLockFocus" },
+    { 0xd83873336c4a5063ULL, "canDraw" },
+    { 0, NULL },
+    { 0xa4e671ad622e8d89ULL, "weekday" },
+    { 0xcd1bb681452d373cULL, "paragraphSpacingAfterGlyphAtIndex:withProposedLineFragmentRect:" },
+    { 0x8c2a48564ad10dedULL, "stringByResolvingSymlinksInPath" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1605455435d7e93bULL, "isBezeled" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1599b69516cda29bULL, "invalidateDisplayForCharacterRange:" },
+    { 0xe5b516557db0c8d7ULL, "setReceiver:" },
+    { 0, NULL },
+    { 0x00d5fee1dc583658ULL, "_selectionWillChange" },
+    { 0x7e4d63542b1368f9ULL, "_removeLayerFromSuperlayer" },
+    { 0x579753a0319bb210ULL, "isSimpleRectangularTextContainer" },
+    { 0x7ff271fd8dff01a6ULL, "viewDidMoveToWindow" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x391281fdbc85c6c5ULL, "positiveInfinitySymbol" },
+    { 0x2d2795d3d6df464cULL, "setMessageText:" },
+    { 0, NULL },
+    { 0xb4a32d6290fcf2d2ULL, "netServiceDidStop:" },
+    { 0xca6682afe042f14cULL, "sendsSearchStringImmediately" },
+    { 0x3344bf956b921a00ULL, "keyPathObserver" },
+    { 0x1ffc0efff70c847eULL, "deleteForward:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0dc981cd56b3b08cULL, "_markerLocationFromLocation:" },
+    { 0xa542fbef7ef6dbabULL, "tabViewType" },
+    { 0xf06f251b51a85e0fULL, "systemDefaultPortNameServer" },
+    { 0xff73d343df642b18ULL, "namespaceForPrefix:" },
+    { 0xa8980148dacde307ULL, "stringValue" },
+    { 0xcea9713bb706de97ULL, "decodeRect" },
+    { 0, NULL },
+    { 0x1bd0b728c6fe889aULL, "numberOfVisibleItems" },
+    { 0, NULL },
+    { 0xee58c2f13d77a997ULL, "bringToTop" },
+    { 0x82e15d9bf8a7a0ddULL, "currentPage" },
+    { 0x30e3660f56fd3770ULL, "drawerDidClose:" },
+    { 0x66c5141b6f8cb69dULL, "linkPath:toPath:handler:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xb63a31abb64f6a73ULL, "_stopThreadedAnimation" },
+    { 0, NULL },
+    { 0x4ff37eca61c48f45ULL, "font" },
+    { 0xffbf8c079c9c0dbaULL, "statusCode" },
+    { 0x96133a683d7ed562ULL, "fileNameExtensionWasHiddenInLastRunSavePanel" },
+    { 0, NULL },
+    { 0x5ca56ac35c7c8e54ULL, "expressionType" },
+    { 0x1fd608cde58c6a2fULL, "drawSortIndicatorWithFrame:inView:ascending:priority:" },
+    { 0x77e637628f173995ULL, "drawFromPoint:toPoint:options:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd807edc73df3c5eaULL, "closePath" },
+    { 0, NULL },
+    { 0x6237d268c0e18163ULL, "setFilterPredicate:" },
+    { 0xccee33c314d31b0aULL, "_fieldEditCell:row:column:" },
+    { 0x02bb96fb515ae10aULL, "removeRow:" },
+    { 0xcc467bcc84f01e4eULL, "setAttributes:" },
+    { 0x48ecb4add7de679bULL, "initWithContent:" },
+    { 0xa26a155960c90083ULL, "isSupersetOfSet:" },
+    { 0x1ab180ea20cc4893ULL, "charactersToBeSkipped" },
+    { 0x3449c588ff40cb30ULL, "_objectValue:withNumberFormat:" },
+    { 0xe2f7169aac909ac6ULL, "QueryInterface::" },
+    { 0xab5881dd83afcbfdULL, "documentWithData:" },
+    { 0x36f6d924ef51caa2ULL, "setTextBaseWritingDirection:" },
+    { 0, NULL },
+    { 0xc07ceaa8438faa3fULL, "menu:willHighlightItem:" },
+    { 0x389e2e30369fe431ULL, "delegateShouldEditTableColumn:row:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x6eab6d4d130753cfULL, "pathExtension" },
+    { 0, NULL },
+    { 0x08411a86fcbdef4eULL, "_paragraphStyleBeforeGlyphIndex:" },
+    { 0, NULL },
+    { 0x791eecafef028081ULL, "colorWithKey:indexPtr:" },
+    { 0x78b3245e6dbbf19fULL, "_kvo_operator_count" },
+    { 0xe31bccda882ff329ULL, "setContinuousSpellCheckingEnabled:" },
+    { 0xb32f40e4cefac1a8ULL, "pipeClass" },
+    { 0x06d5f9dbcc617dabULL, "baseURL" },
+    { 0x984e54d91e61be66ULL, "taskClass" },
+    { 0xaba1bd9679527a78ULL, "drawIndeterminateCircular" },
+    { 0xb2d0c0188dfba600ULL, "moveColumn:toColumn:" },
+    { 0xc4dbeae8bcfde322ULL, "visibleHeight" },
+    { 0, NULL },
+    { 0x77d9311ff060a552ULL, "unsignedLongValue" },
+    { 0x40107a0e25a4fd03ULL, "noteNumberOfItemsChanged" },
+    { 0x85f8a99c6ef8a185ULL, "characterIndexForGlyphAtIndex:" },
+    { 0x8ebc4f3ae74b697cULL, "outlineView:willDisplayOutlineCell:forTableColumn:item:" },
+    { 0x660b9aedece00737ULL, "saveGraphicsState" },
+    { 0, NULL },
+    { 0x262c442471938db3ULL, "alternateSelectedControlTextColor" },
+    { 0x963aaf94bfa886d0ULL, "setAlwaysUsesMultipleValuesMarker:" },
+    { 0x548185837060d2e0ULL, "reflectScrolledClipView:" },
+    { 0x3c10198149f37975ULL, "setMark:" },
+    { 0x71e44070c853dc60ULL, "credentialsForProtectionSpace:" },
+    { 0x99d228501ecce2a3ULL, "indexLessThanIndex:" },
+    { 0xbd69ddb17bea62dbULL, "fontNamed:hasTraits:" },
+    { 0xd1ba9c9638fe1655ULL, "changeFont:" },
+    { 0x2358cb29f6347eeaULL, "setInsertionPointColor:" },
+    { 0xa1782a289fae444dULL, "valueWithRange:" },
+    { 0xcd00dcc04d2fff26ULL, "deleteToBeginningOfParagraph:" },
+    { 0x1f9084e807e23b2cULL, "resignMainWindow" },
+    { 0x58f0bc53e7a23760ULL, "comparePriority:" },
+    { 0xb30f4449b818cc34ULL, "splitView:shouldAdjustSizeOfSubview:" },
+    { 0xf46ddca889a426ecULL, "themeForClassList:deviceContext:" },
+    { 0x86193143a6e68e2dULL, "indexOfItemWithTarget:andAction:" },
+    { 0x6114d8bba3da8a35ULL, "initWithCondition:" },
+    { 0x452d0761d82f9a45ULL, "acceptsFirstResponder" },
+    { 0x305ba6d32fc49ce1ULL, "startDragImage:at:offset:event:" },
+    { 0x96378d29d9ad8029ULL, "setBoundsOrigin:" },
+    { 0xf100d9aaabc42721ULL, "attributesOfItemAtPath:error:" },
+    { 0x03de1b74f5a12b0eULL, "appendBezierPathWithGlyphs:count:inFont:" },
+    { 0x6e71610a0405b6f9ULL, "_setMouseInside:" },
+    { 0x74fac83c882361b2ULL, "WM_GETMINMAXINFO_wParam:lParam:" },
+    { 0x1c413fcb39ebe638ULL, "regularFileContents" },
+    { 0xb091ef5524317e85ULL, "toOneRelationshipKeys" },
+    { 0x65837875ff04d034ULL, "setNumberOfVisibleItems:" },
+    { 0x7a454dd97dded221ULL, "notificationWithName:object:userInfo:" },
+    { 0x04cd6636fc7c247eULL, "toolTipForCell:" },
+    { 0x786ebcb72f4df582ULL, "recentSearches" },
+    { 0x963be90ea9e659f5ULL, "selection" },
+    { 0x308d5b4bdd43d0dfULL, "enableCursorRects" },
+    { 0x71a4139868cb9d6bULL, "allowsFloats" },
+    { 0x1ed4cb1ea15ec163ULL, "terminate" },
+    { 0x3d427c0a68ec7f06ULL, "_recomputeSegmentWidths" },
+    { 0xcf7bcb2ee675c497ULL, "menuChanged:" },
+    { 0xae855e1096ec6a13ULL, "performZoom:" },
+    { 0, NULL },
+    { 0xcc943bd63553ca5dULL, "setTextAttributesForNegativeInfinity:" },
+    { 0, NULL },
+    { 0x1d049eedd2b755f7ULL, "userReplacementsDictionary" },
+    { 0xdfaab65b47a060eeULL, "addObjectForException:" },
+    { 0x8af4ec2d33d1b90dULL, "importsGraphics" },
+    { 0xe1cd3a84af03877fULL, "completionsForPartialWordRange:inString:language:inSpellDocumentWithTag:" },
+    { 0xa10d187c70afc9d8ULL, "objectIsForcedForKey:" },
+    { 0xa63ccb55868de5acULL, "lineFragmentUsedRectForGlyphAtIndex:effectiveRange:" },
+    { 0x50b1e6529de674f7ULL, "removeCachedResponseForRequest:" },
+    { 0x99a8ff8d23e88851ULL, "allowsColumnReordering" },
+    { 0x0fa1d3dc1e81a237ULL, "offsetInFile" },
+    { 0xb412e1fc3afb40e8ULL, "createGLContext" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x2d9f2950754ff890ULL, "write:maxLength:" },
+    { 0xb8a7181b812d6f18ULL, "setReservedThicknessForAccessoryView:" },
+    { 0x9246ce841fdf28e7ULL, "rightMarginMarkerWithRulerView:location:" },
+    { 0xe6c62c48f56d3f56ULL, "sizeOfString:withAttributes:inSize:" },
+    { 0x35443a090a852662ULL, "usableParts" },
+    { 0xf6f920133d5649dcULL, "statusVersion:" },
+    { 0xc2f8dffde32ec89cULL, "_itemForItemIdentifier:willBeInsertedIntoToolbar:" },
+    { 0, NULL },
+    { 0x51a99c47df99d761ULL, "setNotifyObject:" },
+    { 0x99353a119836ce2eULL, "selectRow:byExtendingSelection:" },
+    { 0xd5df358b9180324bULL, "perMillSymbol" },
+    { 0x540d53aa1b9d6959ULL, "preferredLocalizationsFromArray:forPreferences:" },
+    { 0, NULL },
+    { 0xaa632d93e1485535ULL, "childWindows" },
+    { 0xace7cc52658e97e1ULL, "titleAlignment" },
+    { 0xef308e132ac75d56ULL, "moveToEndOfLine:" },
+    { 0x7d4402855d9e8658ULL, "setPrototype:" },
+    { 0x1b1e2868f4bbf8fcULL, "setCurrentPath:" },
+    { 0xccffb97b3969ea2bULL, "drawInRect:highlighted:" },
+    { 0xcf7d421fa5684856ULL, "DTD" },
+    { 0xdcf5b173015ab412ULL, "addItemsWithObjectValues:" },
+    { 0, NULL },
+    { 0x9ccd87d173576b77ULL, "_appendReference:" },
+    { 0x82a0c04afe738749ULL, "getComponents:" },
+    { 0x1c27d6119f6471dbULL, "windowControllerDidLoadNib:" },
+    { 0xbbd8c82851e7dd61ULL, "fontTypefacesForFamilyName:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x1e1e4b1544f98b26ULL, "_hideForDeactivation" },
+    { 0, NULL },
+    { 0x14594ea9af1013ddULL, "addTableColumn:" },
+    { 0, NULL },
+    { 0xa3494a54972b62a0ULL, "URLByAppendingPathExtension:" },
+    { 0xc7abebfa718a7e6aULL, "_adjustSubviewHeights" },
+    { 0xab3d66a3c34820bbULL, "applyFontTraits:range:" },
+    { 0x52225272de74a18eULL, "unregisterWindow:" },
+    { 0, NULL },
+    { 0x2f8391679c6812caULL, "itemHeight" },
+    { 0, NULL },
+    { 0x0598d1ef8b30df46ULL, "locale" },
+    { 0x38427811c4cdca38ULL, "setInitialKey:" },
+    { 0x0a816bcf345868b2ULL, "selectCellAtRow:column:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0176f3705317b939ULL, "changeSpelling:" },
+    { 0x6e32f86e9006944dULL, "getCString:maxLength:encoding:" },
+    { 0x73526e1c5e3ad6f2ULL, "removeObject:" },
+    { 0xc56592abed1a6cbeULL, "drawBackgroundWithFrame:inView:characterRange:layoutManager:" },
+    { 0, NULL },
+    { 0x861a2d8407c347bbULL, "containsIndexes:" },
+    { 0x777b3d0c1e05d9d2ULL, "hour" },
+    { 0x2c63bfab8c5dae56ULL, "picasMeasurementUnit" },
+    { 0x39d5ad57d18e3664ULL, "browser:selectRow:inColumn:" },
+    { 0xe2fb6aab6a6e2315ULL, "hotSpot" },
+    { 0xf9fdeef4e4ead28eULL, "defaultButton:" },
+    { 0x245f557bc10109c1ULL, "numberOfItemsInMenu:" },
+    { 0, NULL },
+    { 0x812d13789a915bb6ULL, "showWindows" },
+    { 0xdd4c0b4d4e45a1c2ULL, "sortUsingFunction:context:" },
+    { 0x0ec8d1cc5701e9d8ULL, "initWithParentGroup:" },
+    { 0xe57c01f066a48c66ULL, "setWidth:forSegment:" },
+    { 0xc167a9b7853fd90fULL, "parentWindowDidClose:" },
+    { 0xa685ec2e570482f7ULL, "glyphRangeForBoundingRectWithoutAdditionalLayout:inTextContainer:" },
+    { 0xc55cd8ba93cf5946ULL, "hitPart" },
+    { 0x70d12da21ae0aa0eULL, "beginLineWithGlyphAtIndex:" },
+    { 0, NULL },
+    { 0x9119beb6648e44e2ULL, "buildFrame" },
+    { 0x3500dbc5d9187c1fULL, "itemTitles" },
+    { 0xa1887ac280336dd7ULL, "splitView:constrainSplitPosition:ofSubviewAt:" },
+    { 0x7ab0268de0e7c786ULL, "mouseEventWithType:location:modifierFlags:window:deltaY:" },
+    { 0xdf6a759c93fa5f57ULL, "validateGlyphsAndLayoutForGlyphRange:" },
+    { 0, NULL },
+    { 0x813f4212dcff7b28ULL, "alternateSelectedControlColor" },
+    { 0x8590034579248ce2ULL, "incrementBy:" },
+    { 0x2364c4ea52e668eaULL, "KVO_notifying_change_removeKeyAtIndexes:" },
+    { 0, NULL },
+    { 0x582f26c304ce4197ULL, "moveToEndOfLineAndModifySelection:" },
+    { 0, NULL },
+    { 0xa1afcf0d821bc913ULL, "managedObjectContext" },
+    { 0x1a0e0d0f4d8cd4e3ULL, "fileHandle" },
+    { 0xf90005344925110cULL, "stringByReplacingCharactersInRange:withString:" },
+    { 0x44a462f28a877193ULL, "drawBezelWithFrame:inView:" },
+    { 0x487b0d40b8d3f88cULL, "keyBindingWithString:modifierMask:selectorNames:" },
+    { 0x4d88027c01e4b597ULL, "XMLStringWithOptions:" },
+    { 0x154dcc274589ba37ULL, "setDraggingSourceOperationMask:forLocal:" },
+    { 0x6c4a9fa81681f7f7ULL, "mouseEntered:withFrame:inView:" },
+    { 0xac8c17c232b33c64ULL, "sendSynchronousRequest:returningResponse:error:" },
+    { 0xe9415c7fac7f8a8bULL, "contentWidth" },
+    { 0x89679bd226862a3aULL, "setAlternateImage:" },
+    { 0, NULL },
+    { 0x46e4029d79b1c190ULL, "setTickMarkPosition:" },
+    { 0xd1c8b1657f8f0c27ULL, "getRectsBeingDrawn:count:" },
+    { 0x72dc2db90aac13bfULL, "selectEventMask" },
+    { 0xee1ba4560633edf0ULL, "spellEngines" },
+    { 0x3ea17e291f2715bbULL, "deltaX" },
+    { 0x08592d0e057aa9caULL, "isFixedPitch" },
+    { 0xafaf02b41a62cf59ULL, "rangeForUserCompletion" },
+    { 0x64909537d2fb7c5eULL, "hasHorizontalRuler" },
+    { 0xc5da1702a46a7be7ULL, "reverseTransformedObject:" },
+    { 0x2814592c21695501ULL, "coalesceAffectedRange:replacementRange:selectedRange:text:" },
+    { 0, NULL },
+    { 0x2a720e3380f4db69ULL, "draggingPasteboard" },
+    { 0xe22814c20ac7b338ULL, "notANumber" },
+    { 0, NULL },
+    { 0xc562cb71a399b9faULL, "depthLimit" },
+    { 0xb673c7ec7cb7681cULL, "zoom:" },
+    { 0x5e3cc0c1c7e3415cULL, "removeKeyObserver:" },
+    { 0x59073b9145673dbbULL, "indexOfItemWithRepresentedObject:" },
+    { 0, NULL },
+    { 0xe47dbcc6009d70bbULL, "setMaxPages:" },
+    { 0x454d342df6ff2f6dULL, "defaultCStringEncoding" },
+    { 0xd4e0894508ac2ba8ULL, "setLastColumn:" },
+    { 0x8c873a5df2dcc1c7ULL, "tabStopType" },
+    { 0xe7e4d1cbf0523bebULL, "removeItemAtURL:error:" },
+    { 0x6e08b7f3cbb0beb1ULL, "temporaryAttribute:atCharacterIndex:longestEffectiveRange:inRange:" },
+    { 0, NULL },
+    { 0x9675356633aef951ULL, "insertTextContainer:atIndex:" },
+    { 0xcdf283c91f1e9a96ULL, "getCString:maxLength:range:remainingRange:" },
+    { 0x43a64c451f95d630ULL, "dayOfWeek" },
+    { 0, NULL },
+    { 0x89bace63c0a9b138ULL, "statusItemWithLength:" },
+    { 0xf013f7861f49a6fcULL, "savePanel:runModalForDirectory:file:" },
+    { 0, NULL },
+    { 0x54950f7cc8f9e591ULL, "positivePrefix" },
+    { 0x623ec0b5c4f2079bULL, "_setItemValues:forKey:" },
+    { 0xba416a82eae1089bULL, "setHasVerticalScroller:" },
+    { 0, NULL },
+    { 0x9bf9883d908b3b76ULL, "documents" },
+    { 0, NULL },
+    { 0xc2e9a33a92abacc5ULL, "addObserver:forKeyPath:options:context:" },
+    { 0x45848d7b5341f7bcULL, "setSound:" },
+    { 0xebfd905dc2afa0bbULL, "removeRepresentation:" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x0917553bf8278b38ULL, "andPredicateWithSubpredicates:" },
+    { 0x5f372961b10ed8ecULL, "windowWillResize:toSize:" },
+    { 0x2860bd4181ab0f35ULL, "tableView:acceptDrop:row:dropOperation:" },
+    { 0x61645d2d40522575ULL, "isAtEnd" },
+    { 0xb85ae7a19be74ec7ULL, "setWordFieldStringValue:" },
+    { 0, NULL },
+    { 0xbeda06e91665ada3ULL, "transposeWords:" },
+    { 0x0faf5e05b90e9e8fULL, "addEntry:" },
+    { 0xd4c215ba34a78f01ULL, "flushFontName" },
+    { 0x4f99d2a750fbfdd2ULL, "_addWindow:" },
+    { 0, NULL },
+    { 0x7d7c283bf5932a8bULL, "fontDescriptorWithSymbolicTraits:" },
+    { 0x247d5c604c42e67aULL, "openPanel" },
+    { 0x6d0835a1a9d472bdULL, "decimalNumberByDividingBy:" },
+    { 0, NULL },
+    { 0x82817fe268686529ULL, "numberFromString:" },
+    { 0x8ea78c67c38c236cULL, "prepareContent" },
+    { 0xccbed18be921b67bULL, "thousandSeparator" },
+    { 0x9d509603403184d6ULL, "outlineView:numberOfChildrenOfItem:" },
+    { 0x873af66b6b24185dULL, "editedRange" },
+    { 0xa07fb9ef6e1ff722ULL, "setColorRenderingIntent:" },
+    { 0x05daa856511a9f2fULL, "setCaseSensitive:" },
+    { 0x43ccc0fe29d73e75ULL, "takeDoubleValueFrom:" },
+    { 0x3727f03ce426e477ULL, "selectedTextColor" },
+    { 0xa9f06d1aea7ec058ULL, "__appendCharacter:" },
+    { 0x4bb5bb580cd89959ULL, "_didChangeValueForKey:changeOptions:" },
+    { 0xf4a2d245c88e551eULL, "indexOfObjectIdenticalTo:inRange:" },
+    { 0, NULL },
+    { 0xd19a89b11c11837eULL, "_setValue:toBuffer:ofType:shouldRetain:" },
+    { 0x76384020f2c96336ULL, "version" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0xd7700a54258bea9fULL, "timeIntervalSinceReferenceDate" },
+    { 0xd7caded240dfddb4ULL, "downloadDidFinish:" },
+    { 0, NULL },
+    { 0x4af4d49201c76a2bULL, "encodeArrayOfDoubles:count:forKey:" },
+    { 0x27c2e095d3c8ae64ULL, "_setView:" },
+    { 0x88a632ddc96d0c48ULL, "removeObserver:object:" },
+    { 0x13b60ed40bec08e6ULL, "closeAndDealloc" },
+    { 0xafcf1393d9e8584aULL, "suppressionButton" },
+    { 0, NULL },
+    { 0, NULL },
+    { 0x94f1fd6f6a654f39ULL, "typeFromFileExtension:" },
+    { 0xa1f5ef4eefb4726bULL, "addressCheckingResultWithRange:components:" },
+    { 0, NULL },
+    { 0x26345e5a1b7b91a5ULL, "valueWithPoint:" },
+    { 0xc72fc7674cf09182ULL, "hasSuffix:" },
+    { 0, NULL },
+    { 0x2da3d78c861c0b78ULL, "autoresizesAllColumnsToFit" },
+    { 0xc079a7fb0c0094daULL, "setVerticalPageScroll:" },
+    { 0x13df2832f8444e61ULL, "keyUp:" },
+    { 0xad247a2c4dd35e17ULL, "selectCellWithTag:" },
+    { 0x09cfbbf0665c0eccULL, "shadowColor" },
+    { 0x996f5f2182f87800ULL, "isHorizontallyResizable" },
+};
@@ -1,24 +1,115 @@
 #import "objc_tls.h"
+#import "objc_lock.h"
+#import "objc_cache.h"
+#import "objc_profile.h"
+#import "objc_census.h"
 #import <objc/objc_arc.h>
 #import <pthread.h>
 
-static void objc_tls_free(void *tls) {
+static objc_lock objc_tls_lock = 0;
+static objc_tls *objc_tls_threads = NULL;
+
+#ifdef OBJC_TLS_CURRENT
+// skips pthread_once and pthread_getspecific once the thread has state
+__thread objc_tls *objc_tls_current = NULL;
+#endif
+
+void (*objc_tlsSyncCacheExit)(objc_tls *tls) = NULL;
+void (*objc_tlsObjectCacheExit)(objc_tls *tls) = NULL;
+
+static void objc_tls_free(void *tlsX) {
+    objc_tls *tls = tlsX, **check;
+    objc_autoreleasepage *page, *child;
+    id pending;
+
+    // a return value handed off by objc_autoreleaseReturnValue which nobody claimed, released
+    // while this is still the thread's state in case its dealloc hands off another
+    while((pending = tls->returnValue) != nil) {
+        tls->returnValue = nil;
+        objc_release(pending);
+    }
+
+    objc_lock_lock(&objc_tls_lock);
+    for(check = &objc_tls_threads; *check != NULL; check = &(*check)->next)
+        if(*check == tls) {
+            *check = tls->next;
+            break;
+        }
+    objc_lock_unlock(&objc_tls_lock);
+
+#ifdef OBJC_TLS_CURRENT
+    objc_tls_current = NULL;
+#endif
+
+    if(tls->profile != NULL)
+        OBJCProfileThreadExit(tls->profile);
+
+    if(tls->census != NULL)
+        OBJCCensusThreadExit(tls->census);
+
+    if(tls->syncCacheCount != 0 && objc_tlsSyncCacheExit != NULL)
+        objc_tlsSyncCacheExit(tls);
+
+    if(tls->objectCache != NULL && objc_tlsObjectCacheExit != NULL)
+        objc_tlsObjectCacheExit(tls);
+
+    // objects still in unpopped pools are leaked, there is no thread left to release them on
+    for(page = tls->pool; page != NULL && page->parent != NULL; page = page->parent)
+        ;
+    for(; page != NULL; page = child) {
+        child = page->child;
+        free(page);
+    }
+
+    free(tls);
 }
 
 static pthread_key_t objc_tls_key;
 
 static void createKey() {
     pthread_key_create(&objc_tls_key, objc_tls_free);
+}
 
+static objc_tls *createThreadState() {
     objc_tls *tls = calloc(1, sizeof(objc_tls));
 
+    // a new thread can't be holding on to a method cache which was retired before now
+    tls->cacheEpoch = OBJCCacheCurrentEpoch();
     pthread_setspecific(objc_tls_key, tls);
+
+    objc_lock_lock(&objc_tls_lock);
+    tls->next = objc_tls_threads;
+    objc_tls_threads = tls;
+    objc_lock_unlock(&objc_tls_lock);
+
+    return tls;
 }
 
 objc_tls *objc_tlsCurrent() {
     static pthread_once_t createKeyOnce = PTHREAD_ONCE_INIT;
+    objc_tls *result;
+
+#ifdef OBJC_TLS_CURRENT
+    if((result = objc_tls_current) != NULL)
+        return result;
+#endif
 
     pthread_once(&createKeyOnce, createKey);
 
-    return pthread_getspecific(objc_tls_key);
+    if((result = pthread_getspecific(objc_tls_key)) == NULL)
+        result = createThreadState();
+
+#ifdef OBJC_TLS_CURRENT
+    objc_tls_current = result;
+#endif
+    return result;
+}
+
+void objc_tlsEnumerate(void (*function)(objc_tls *tls, void *context), void *context) {
+    objc_tls *check;
+
+    objc_lock_lock(&objc_tls_lock);
+    for(check = objc_tls_threads; check != NULL; check = check->next)
+        function(check, context);
+    objc_lock_unlock(&objc_tls_lock);
 }
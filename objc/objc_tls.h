@@ -1,13 +1,13 @@
 #import <objc/runtime.h>
 #include <setjmp.h>
 
-typedef struct objc_autoreleasepool {
-    struct objc_autoreleasepool *_parent;
-    unsigned long _pageCount;
-    id **_pages;
-    unsigned long _nextSlot;
-    struct objc_autoreleasepool *_childPool;
-} objc_autoreleasepool;
+// One page of a thread's autorelease stack, the slots fill the rest of the page
+typedef struct objc_autoreleasepage {
+    struct objc_autoreleasepage *parent;
+    struct objc_autoreleasepage *child;
+    id *next;
+    id slots[1];
+} objc_autoreleasepage;
 
 typedef struct objc_exception_frame {
     jmp_buf state;
@@ -17,10 +17,54 @@ typedef struct objc_exception_frame {
 
 typedef void NSUncaughtExceptionHandler(id exception);
 
+// @synchronized locks the thread holds, so nested and recursive entries skip the lock table
+#define OBJC_SYNC_CACHE_SIZE 8
+
+typedef struct {
+    id object;
+    void *lock;
+} objc_sync_cache_entry;
+
 typedef struct objc_tls {
-    objc_autoreleasepool *pool;
+    struct objc_tls *next;
+    objc_autoreleasepage *pool;
+    id returnValue;
     objc_exception_frame *exception_frame;
+    struct objc_exception_catch *caught;
     NSUncaughtExceptionHandler *uncaught_exception_handler;
+    volatile uintptr_t cacheEpoch;
+    struct objc_profile_buffer *profile;
+    struct objc_census_buffer *census;
+    unsigned syncCacheCount;
+    objc_sync_cache_entry syncCache[OBJC_SYNC_CACHE_SIZE];
+    struct NSObjectCache *objectCache; // freed instances kept by NSDeallocateObject, see NSZone.m
 } objc_tls;
 
 objc_tls *objc_tlsCurrent();
+
+#ifndef __has_feature
+#define __has_feature(x) 0
+#endif
+
+// Apple's gcc has no __thread, everything else we build with does
+#if !defined(__APPLE__) || __has_feature(tls)
+#define OBJC_TLS_CURRENT 1
+#endif
+
+#ifdef OBJC_TLS_CURRENT
+// the calling thread's state, NULL until objc_tlsCurrent creates it. The Linux objc_msgSend
+// tests it before probing a method cache so it has to stay in the static TLS block there.
+#ifdef LINUX
+extern __thread objc_tls *objc_tls_current __attribute__((tls_model("initial-exec")));
+#else
+extern __thread objc_tls *objc_tls_current;
+#endif
+#endif
+
+// calls function for every thread which has runtime thread state, with the thread list locked
+void objc_tlsEnumerate(void (*function)(objc_tls *tls, void *context), void *context);
+
+// set by Foundation, drops the @synchronized records an exiting thread still caches
+extern void (*objc_tlsSyncCacheExit)(objc_tls *tls);
+// set by Foundation, hands back the freed instances an exiting thread kept
+extern void (*objc_tlsObjectCacheExit)(objc_tls *tls);
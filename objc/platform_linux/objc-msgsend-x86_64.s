@@ -1,129 +1,311 @@
-.globl _objc_msgSend_fpret
-	.type	_objc_msgSend_fpret, @function
-_objc_msgSend_fpret:
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+/*
+   SysV x86_64 message dispatch.
+
+   The arguments arrive in registers: self in %rdi and _cmd in %rsi, or for the _stret
+   variants the structure return address in %rdi, self in %rsi and _cmd in %rdx. A cache
+   hit touches only %r10 and %r11, builds no frame and tail jumps into the method with every
+   argument register, %al (vector register count for varargs) and the stack untouched.
+
+   Only a miss builds a frame, to preserve the argument registers across the call into the
+   C lookup, which initializes the class, fills the cache and returns the IMP (or the
+   forwarding IMP, the _stret one for the _stret variants) to jump to.
+
+   struct objc_class:     isa 0, super_class 8, ..., cache 64
+   OBJCMethodCache:       mask 0, occupied 8, table 16
+   struct objc_method:    method_name 0, method_types 8, method_imp 16
+   struct objc_super:     receiver 0, super_class 8
+*/
+
+	.text
+
+	.equ	CLASS_SUPERCLASS, 8
+	.equ	CLASS_CACHE, 64
+	.equ	CACHE_MASK, 0
+	.equ	CACHE_TABLE, 16
+	.equ	METHOD_NAME, 0
+	.equ	METHOD_IMP, 16
+	.equ	SUPER_RECEIVER, 0
+	.equ	SUPER_CLASS, 8
+
+# slow path frame, %rsp is 8 mod 16 on entry so this keeps calls 16 byte aligned
+	.equ	FRAME_SIZE, 200
+	.equ	FRAME_RDI, 128
+	.equ	FRAME_RSI, 136
+	.equ	FRAME_RDX, 144
+	.equ	FRAME_RCX, 152
+	.equ	FRAME_R8, 160
+	.equ	FRAME_R9, 168
+	.equ	FRAME_RAX, 176
+	.equ	FRAME_SUPER, 184
 
-.globl _objc_msgSend
+.macro ENTRY name
+	.globl	\name
+	.type	\name, @function
+	.p2align 4
+\name:
+	.cfi_startproc
+.endm
+
+.macro END name
+	.cfi_endproc
+	.size	\name, .-\name
+.endm
+
+# %r10 = class of \object, which is not nil. Tagged pointers take their class from
+# objc_taggedPointerClasses, indexed by bits 1-3.
+.macro GetClass object
+	testq	$1, \object
+	jne	8f
+	movq	(\object), %r10
+9:
+.endm
+
+.macro GetTaggedClass object
+8:
+	movq	\object, %r10
+	andq	$14, %r10                       # slot * 2
+	movq	objc_taggedPointerClasses@GOTPCREL(%rip), %r11
+	movq	(%r11,%r10,4), %r10
+	jmp	9b
+.endm
+
+# Probe the cache of the class in %r10 for \sel. On a hit load the IMP into %r11, replace
+# the objc_super pointer in \super with its receiver if given and tail jump. Falls
+# through to \miss on a miss or a negative entry, or when the thread has no objc_tls yet,
+# the slow path registers it with the cache reclaimer before any table is loaded.
+.macro CacheLookup sel, miss, super
+	movq	objc_tls_current@GOTTPOFF(%rip), %r11
+	cmpq	$0, %fs:(%r11)
+	je	\miss
+	movq	CLASS_CACHE(%r10), %r10
+	movq	\sel, %r11
+	shrq	$4, %r11
+	xorq	\sel, %r11
+	andq	CACHE_MASK(%r10), %r11          # index = (_cmd ^ _cmd >> 4) & cache->mask
+	movq	CACHE_TABLE(%r10,%r11,8), %r11
+	cmpq	\sel, METHOD_NAME(%r11)
+	jne	1f
+	movq	METHOD_IMP(%r11), %r11
+	testq	%r11, %r11                      # negative entry, let the slow path forward it
+	je	\miss
+.ifnb \super
+	movq	SUPER_RECEIVER(\super), \super
+.endif
+	jmp	*%r11
+
+	# first slot taken by another selector, continue linear probing with a scratch
+	# register borrowed from the stack, %rax carries the varargs count
+1:
+	cmpq	$0, METHOD_NAME(%r11)            # empty slot ends the probe
+	je	\miss
+	pushq	%rax
+	.cfi_adjust_cfa_offset 8
+	movq	\sel, %rax
+	shrq	$4, %rax
+	xorq	\sel, %rax
+2:
+	incq	%rax
+	andq	CACHE_MASK(%r10), %rax
+	movq	CACHE_TABLE(%r10,%rax,8), %r11
+	cmpq	\sel, METHOD_NAME(%r11)
+	je	3f
+	cmpq	$0, METHOD_NAME(%r11)
+	jne	2b
+	popq	%rax
+	.cfi_adjust_cfa_offset -8
+	jmp	\miss
+3:
+	.cfi_adjust_cfa_offset 8
+	popq	%rax
+	.cfi_adjust_cfa_offset -8
+	movq	METHOD_IMP(%r11), %r11
+	testq	%r11, %r11
+	je	\miss
+.ifnb \super
+	movq	SUPER_RECEIVER(\super), \super
+.endif
+	jmp	*%r11
+.endm
+
+.macro SaveArguments
+	subq	$FRAME_SIZE, %rsp
+	.cfi_adjust_cfa_offset FRAME_SIZE
+	movdqa	%xmm0, 0(%rsp)
+	movdqa	%xmm1, 16(%rsp)
+	movdqa	%xmm2, 32(%rsp)
+	movdqa	%xmm3, 48(%rsp)
+	movdqa	%xmm4, 64(%rsp)
+	movdqa	%xmm5, 80(%rsp)
+	movdqa	%xmm6, 96(%rsp)
+	movdqa	%xmm7, 112(%rsp)
+	movq	%rdi, FRAME_RDI(%rsp)
+	movq	%rsi, FRAME_RSI(%rsp)
+	movq	%rdx, FRAME_RDX(%rsp)
+	movq	%rcx, FRAME_RCX(%rsp)
+	movq	%r8, FRAME_R8(%rsp)
+	movq	%r9, FRAME_R9(%rsp)
+	movq	%rax, FRAME_RAX(%rsp)
+.endm
+
+# IMP returned by the lookup in %rax, moved to %r11 for the tail jump
+.macro RestoreArguments
+	movq	%rax, %r11
+	movdqa	0(%rsp), %xmm0
+	movdqa	16(%rsp), %xmm1
+	movdqa	32(%rsp), %xmm2
+	movdqa	48(%rsp), %xmm3
+	movdqa	64(%rsp), %xmm4
+	movdqa	80(%rsp), %xmm5
+	movdqa	96(%rsp), %xmm6
+	movdqa	112(%rsp), %xmm7
+	movq	FRAME_RDI(%rsp), %rdi
+	movq	FRAME_RSI(%rsp), %rsi
+	movq	FRAME_RDX(%rsp), %rdx
+	movq	FRAME_RCX(%rsp), %rcx
+	movq	FRAME_R8(%rsp), %r8
+	movq	FRAME_R9(%rsp), %r9
+	movq	FRAME_RAX(%rsp), %rax
+	addq	$FRAME_SIZE, %rsp
+	.cfi_adjust_cfa_offset -FRAME_SIZE
+.endm
+
+/*
+   id objc_msgSend(id self, SEL _cmd, ...)
+
+   objc_msgSend_fpret is the same entry point, message.h declares it returning double
+   which comes back in %xmm0 like any other floating point result.
+*/
+ENTRY objc_msgSend
+	.globl	objc_msgSend_fpret
+	.type	objc_msgSend_fpret, @function
+objc_msgSend_fpret:
+	.globl	_objc_msgSend
 	.type	_objc_msgSend, @function
 _objc_msgSend:
+	.globl	_objc_msgSend_fpret
+	.type	_objc_msgSend_fpret, @function
+_objc_msgSend_fpret:
+	testq	%rdi, %rdi
+	je	.LmsgSendNil
+	GetClass %rdi
+	CacheLookup %rsi, .LmsgSendMiss
+
+.LmsgSendMiss:
+	SaveArguments
+	call	OBJCInitializeLookupAndCacheUniqueIdForObject@PLT
+	RestoreArguments
+	jmp	*%r11
+
+	GetTaggedClass %rdi
+
+	# messages to nil return zero in every integer and floating point return register
+.LmsgSendNil:
+	xorl	%eax, %eax
+	xorl	%edx, %edx
+	xorps	%xmm0, %xmm0
+	xorps	%xmm1, %xmm1
+	ret
+END objc_msgSend
 
 /*
-   # this just calls objc_msg_lookup, then jumps to the returned method
-	pushl	%ebp
-	movl	%esp, %ebp
-	subl	$16, %esp
-	pushl	12(%ebp)
-	pushl	8(%ebp)
-	call	objc_msg_lookup
-	mov  %ebp, %esp
-	pop  %ebp
-	jmp		*%eax
+   void objc_msgSend_stret(void *result, id self, SEL _cmd, ...)
 */
-   
-	pushq	%rbp
-	movq	%rsp, %rbp
-	pushq	%rsi
-	pushq	%rbx
-	movq	16(%rbp), %rsi     # self
-	movq	24(%rbp), %rbx    # _cmd
+ENTRY objc_msgSend_stret
+	.globl	_objc_msgSend_stret
+	.type	_objc_msgSend_stret, @function
+_objc_msgSend_stret:
 	testq	%rsi, %rsi
-	jne	L8                
-	xorq	%rax, %rax        # self == nil, bail
-	leaq	-16(%rbp), %rsp
-	popq	%rbx
-	popq	%rsi
-	leave
+	je	.LmsgSendStretNil
+	GetClass %rsi
+	CacheLookup %rdx, .LmsgSendStretMiss
+
+.LmsgSendStretMiss:
+	SaveArguments
+	movq	%rsi, %rdi
+	movq	%rdx, %rsi
+	call	OBJCInitializeLookupAndCacheUniqueIdForObject_stret@PLT
+	RestoreArguments
+	jmp	*%r11
+
+	GetTaggedClass %rsi
+
+	# the structure is left as the caller had it, the ABI returns its address in %rax
+.LmsgSendStretNil:
+	movq	%rdi, %rax
 	ret
-L8:
-	movq	(%rsi), %rax
-	movq	%rbx, %rdx
-	andq	$504, %rdx     # OBJCMethodCacheMask
-	addq	64(%rax), %rdx
-L11:
-	movq	8(%rdx), %rax
-	cmpq	%rbx, (%rax)
-	jne	L9
-	movq	16(%rax), %rax
-	jmp	L10            # found selector in cache
-L9:
-	addq	(%rdx), %rdx
-	jne	L11
-	pushq	%rdx           # not in cache; traditional lookup
-	pushq	%rdx
-	pushq	%rbx
-	pushq	%rsi
-	call	OBJCInitializeLookupAndCacheUniqueIdForObject@PLT
-	addq	$32, %rsp
-L10:
-	movq	%rbx, 24(%rbp)
-	movq	%rsi, 16(%rbp)
-	leaq	-16(%rbp), %rsp
-	popq	%rbx
-	popq	%rsi
-	leave
-	jmp	*%rax
-   
-
-.globl _objc_msgSendSuper
+END objc_msgSend_stret
+
+/*
+   id objc_msgSendSuper(struct objc_super *super, SEL _cmd, ...)
+
+   super->super_class is the class to start the search in.
+*/
+ENTRY objc_msgSendSuper
+	.globl	_objc_msgSendSuper
 	.type	_objc_msgSendSuper, @function
 _objc_msgSendSuper:
-	pushq	%rbp
-	movq	%rsp, %rbp
-   pushq	%rdi
-   pushq %rsi
-	subq	$32, %rsp
-	movq	16(%rbp), %rdi
-	movq	24(%rbp), %rsi
-   movq	%rsi, 8(%rsp)
-	movq	%rdi, (%rsp)
-   
-	call	objc_msg_lookup_super@PLT
-
-   movq  (%rdi), %rsi
-	movq	%rsi, 16(%rbp)
-   
-   addq  $32, %rsp
-   popq %rsi
-   popq %rdi
-   movq  %rbp, %rsp
-	popq  %rbp
-	jmp		*%rax   
-	
-	
-.globl _objc_msgSend_stret
-	.type	_objc_msgSend_stret, @function
-_objc_msgSend_stret:
-	pushq	%rbp
-	movq	%rsp, %rbp
-	subq	$64, %rsp
-	pushq	32(%rbp)
-	pushq	24(%rbp)
-	call	objc_msg_lookup@PLT
-	movq  %rbp, %rsp
-	popq  %rbp
-	jmp		*%rax
-
-.globl _objc_msgSendSuper_stret
+	movq	SUPER_CLASS(%rdi), %r10
+	CacheLookup %rsi, .LmsgSendSuperMiss, %rdi
+
+.LmsgSendSuperMiss:
+	SaveArguments
+	call	OBJCLookupAndCacheUniqueIdForSuper@PLT
+	RestoreArguments
+	movq	SUPER_RECEIVER(%rdi), %rdi
+	jmp	*%r11
+END objc_msgSendSuper
+
+/*
+   id objc_msgSendSuper2(struct objc_super *super, SEL _cmd, ...)
+
+   super->super_class is the class of the sending method, the search starts at its
+   superclass. This spares the compiler a load of the superclass at every call site.
+*/
+ENTRY objc_msgSendSuper2
+	movq	SUPER_CLASS(%rdi), %r10
+	movq	CLASS_SUPERCLASS(%r10), %r10
+	CacheLookup %rsi, .LmsgSendSuper2Miss, %rdi
+
+.LmsgSendSuper2Miss:
+	SaveArguments
+	movq	SUPER_RECEIVER(%rdi), %r10
+	movq	%r10, FRAME_SUPER+SUPER_RECEIVER(%rsp)
+	movq	SUPER_CLASS(%rdi), %r10
+	movq	CLASS_SUPERCLASS(%r10), %r10
+	movq	%r10, FRAME_SUPER+SUPER_CLASS(%rsp)
+	leaq	FRAME_SUPER(%rsp), %rdi
+	call	OBJCLookupAndCacheUniqueIdForSuper@PLT
+	RestoreArguments
+	movq	SUPER_RECEIVER(%rdi), %rdi
+	jmp	*%r11
+END objc_msgSendSuper2
+
+/*
+   void objc_msgSendSuper_stret(void *result, struct objc_super *super, SEL _cmd, ...)
+*/
+ENTRY objc_msgSendSuper_stret
+	.globl	_objc_msgSendSuper_stret
 	.type	_objc_msgSendSuper_stret, @function
 _objc_msgSendSuper_stret:
-	pushq	%rbp
-	movq	%rsp, %rbp
-   pushq	%rdi
-   pushq %rsi
-	subq	$64, %rsp
-	movq	24(%rbp), %rdi
-	movq	32(%rbp), %rsi
-   movq	%rsi, 8(%rsp)
-	movq	%rdi, (%rsp)
-   
-	call	objc_msg_lookup_super@PLT
-
-   movq  (%rdi), %rsi
-	movq	%rsi, 16(%rbp)
-   
-   addq  $64, %rsp
-   popq %rsi
-   popq %rdi
-   movq  %rbp, %rsp
-	popq  %rbp
-	jmp		*%rax
+	movq	SUPER_CLASS(%rsi), %r10
+	CacheLookup %rdx, .LmsgSendSuperStretMiss, %rsi
+
+.LmsgSendSuperStretMiss:
+	SaveArguments
+	movq	%rsi, %rdi
+	movq	%rdx, %rsi
+	call	OBJCLookupAndCacheUniqueIdForSuper_stret@PLT
+	RestoreArguments
+	movq	SUPER_RECEIVER(%rsi), %rsi
+	jmp	*%r11
+END objc_msgSendSuper_stret
 
+	.section .note.GNU-stack,"",@progbits
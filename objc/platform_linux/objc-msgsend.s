@@ -34,19 +34,34 @@ _objc_msgSend:
 	leave
 	ret
 L8:
-	movl	(%esi), %eax
-	movl	%ebx, %edx
-	andl	$504, %edx     # OBJCMethodCacheMask
-	addl	32(%eax), %edx
+	call	L13                # GOT address into %ecx, an absolute TLS offset would be a text relocation
+L13:
+	popl	%ecx
+	addl	$_GLOBAL_OFFSET_TABLE_+[.-L13], %ecx
+	movl	objc_tls_current@gotntpoff(%ecx), %eax
+	cmpl	$0, %gs:(%eax)     # no objc_tls yet, the slow path registers the thread
+	je	L12
+	movl	(%esi), %edx
+	movl	32(%edx), %edx     # isa->cache
+	movl	%ebx, %ecx
+	shrl	$4, %ecx
+	xorl	%ebx, %ecx
+	andl	(%edx), %ecx       # index = (_cmd ^ _cmd >> 4) & cache->mask
 L11:
-	movl	4(%edx), %eax
+	movl	8(%edx,%ecx,4), %eax
 	cmpl	%ebx, (%eax)
 	jne	L9
 	movl	8(%eax), %eax
+	testl	%eax, %eax     # negative entry, let the slow path forward it
+	je	L12
 	jmp	L10            # found selector in cache
 L9:
-	addl	(%edx), %edx
-	jne	L11
+	cmpl	$0, (%eax)     # empty slot ends the probe
+	je	L12
+	incl	%ecx
+	andl	(%edx), %ecx
+	jmp	L11
+L12:
 	pushl	%edx           # not in cache; traditional lookup
 	pushl	%edx
 	pushl	%ebx
@@ -12,51 +12,6 @@ _objc_msgSend:
 	mov  %ebp, %esp
 	pop  %ebp
 	jmp		*%eax
-   
-   
-	pushl	%ebp
-	movl	%esp, %ebp
-	pushl	%esi
-	pushl	%ebx
-	movl	8(%ebp), %esi     # self
-	movl	12(%ebp), %ebx    # _cmd
-	testl	%esi, %esi
-	jne	L8                
-	xorl	%eax, %eax        # self == nil, bail
-	leal	-8(%ebp), %esp
-	popl	%ebx
-	popl	%esi
-	leave
-	ret
-L8:
-	movl	(%esi), %eax
-	movl	%ebx, %edx
-	andl	$504, %edx     # OBJCMethodCacheMask
-	addl	32(%eax), %edx
-L11:
-	movl	4(%edx), %eax
-	cmpl	%ebx, (%eax)
-	jne	L9
-	movl	8(%eax), %eax
-	jmp	L10            # found selector in cache
-L9:
-	addl	(%edx), %edx
-	jne	L11
-	pushl	%edx           # not in cache; traditional lookup
-	pushl	%edx
-	pushl	%ebx
-	pushl	%esi
-	call	_OBJCInitializeLookupAndCacheUniqueIdForObject
-	addl	$16, %esp
-L10:
-	movl	%ebx, 12(%ebp)
-	movl	%esi, 8(%ebp)
-	leal	-8(%ebp), %esp
-	popl	%ebx
-	popl	%esi
-	leave
-	jmp	*%eax
-   
 
 .globl _objc_msgSendSuper
 	.def	_objc_msgSendSuper;	.scl	2;	.type	32;	.endef
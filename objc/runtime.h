@@ -118,6 +118,126 @@ OBJC_EXPORT void OBJCResetModuleQueue(void);
 OBJC_EXPORT void OBJCLinkQueuedModulesToObjectFileWithPath(const char *path);
 
 OBJC_EXPORT void objc_enableMessageLoggingWithCount(int count);
+
+typedef struct {
+    unsigned long caches;           // classes and metaclasses with a populated cache
+    unsigned long capacity;         // cache slots in total
+    unsigned long occupied;         // cache slots in use
+    unsigned long negative;         // slots holding a negative (does not respond) entry
+    unsigned long misses;           // lookups which fell through to the method lists
+    unsigned long negativeHits;     // lookups answered by a negative entry instead of the method lists
+    unsigned long totalProbeLength; // sum over occupied slots of the probes needed to hit them
+    unsigned long maxProbeLength;
+} objc_method_cache_statistics;
+
+OBJC_EXPORT void objc_getMethodCacheStatistics(objc_method_cache_statistics *stats);
+
+// Time the runtime spends setting up images, set OBJC_PRINT_STARTUP in the environment to have
+// it logged when the process exits. Classes are realized (their method selectors uniqued) the
+// first time their methods are looked up, which may be long after startup.
+typedef struct {
+    unsigned long modules;
+    unsigned long classesRegistered;
+    unsigned long classesRealized;
+    unsigned long selectorReferences;     // uniqued at image load, referenced from code
+    unsigned long methodSelectors;        // method names uniqued by realization
+    unsigned long long imageNanoseconds;  // registering modules, +load messages included
+    unsigned long long loadNanoseconds;   // in +load methods
+    unsigned long long realizeNanoseconds;
+} objc_startup_statistics;
+
+OBJC_EXPORT void objc_getStartupStatistics(objc_startup_statistics *stats);
+
+// Tagged pointers, 64 bit only. An object pointer with the low bit set is the object
+// itself: bits 1-3 are a slot in objc_taggedPointerClasses and the upper 60 bits are the
+// payload. Tagged objects have no storage, retain/release are no-ops and they never dealloc.
+#ifdef __LP64__
+#define OBJC_HAVE_TAGGED_POINTERS 1
+#endif
+
+enum {
+    OBJC_TAG_NSNumber = 1,
+    OBJC_TAG_NSString = 2,
+    OBJC_TAG_NSDate = 3,
+};
+
+#define OBJC_TAG_SLOT_COUNT 8
+#define OBJC_TAG_PAYLOAD_BITS 60
+
+OBJC_EXPORT Class objc_taggedPointerClasses[OBJC_TAG_SLOT_COUNT];
+
+OBJC_EXPORT void objc_registerTaggedPointerClass(unsigned slot, Class cls);
+
+static inline BOOL objc_isTaggedPointer(const void *pointer) {
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+    return ((uintptr_t)pointer & 1) ? YES : NO;
+#else
+    return NO;
+#endif
+}
+
+static inline unsigned objc_getTaggedPointerSlot(const void *pointer) {
+    return ((uintptr_t)pointer >> 1) & (OBJC_TAG_SLOT_COUNT - 1);
+}
+
+// payload must fit in OBJC_TAG_PAYLOAD_BITS, the top bits are shifted out
+static inline id objc_makeTaggedPointer(unsigned slot, uintptr_t payload) {
+    return (id)((payload << 4) | ((uintptr_t)slot << 1) | 1);
+}
+
+static inline uintptr_t objc_getTaggedPointerValue(const void *pointer) {
+    return (uintptr_t)pointer >> 4;
+}
+
+static inline intptr_t objc_getTaggedPointerSignedValue(const void *pointer) {
+    return (intptr_t)pointer >> 4;
+}
+
+// Contention on the runtime's internal locks (class table, retain counts, caches, associations)
+typedef struct {
+    unsigned long acquisitions;
+    unsigned long spins; // iterations spent spinning on a held lock
+    unsigned long parks; // times a thread had to sleep in the kernel
+} objc_lock_statistics;
+
+OBJC_EXPORT void objc_setLockStatisticsEnabled(BOOL enabled);
+OBJC_EXPORT void objc_getLockStatistics(objc_lock_statistics *stats);
+OBJC_EXPORT void objc_resetLockStatistics(void);
+// Sampling message profiler. While started every thread samples one in interval of its sends
+// through objc_msg_lookup into a private buffer, the buffers are merged when a profile is
+// copied or written, so it can be switched on and read in a running process.
+typedef struct {
+    Class cls;                 // receiver class, Nil for messages to nil
+    SEL selector;
+    unsigned long sends;       // estimated, samples times the sampling interval
+    unsigned long samples;
+    unsigned long long cycles; // from a sampled send to the thread's next send, summed (TSC ticks on x86, ns elsewhere)
+} objc_message_profile_entry;
+
+typedef enum {
+    OBJC_PROFILE_REPORT,          // table sorted by sends
+    OBJC_PROFILE_COLLAPSED_STACKS // "caller;-[Class selector] sends" lines for flame graph tools
+} objc_message_profile_format;
+
+OBJC_EXPORT void objc_startMessageProfiling(unsigned interval); // 0 for the default interval
+OBJC_EXPORT void objc_stopMessageProfiling(void);
+OBJC_EXPORT void objc_resetMessageProfile(void);
+OBJC_EXPORT objc_message_profile_entry *objc_copyMessageProfile(unsigned *countp); // hottest first, free() the result
+OBJC_EXPORT BOOL objc_writeMessageProfile(const char *path, objc_message_profile_format format); // NULL path for stderr
+
+// Heap census. While enabled class_createInstance, object_dispose and Foundation's
+// NSAllocateObject and NSDeallocateObject count instances per class. Live counts start from
+// when the census is enabled and go negative for older instances as they are deallocated.
+typedef struct {
+    Class cls;
+    long liveInstances;
+    unsigned long allocations;
+    unsigned long allocatedBytes; // including extra bytes
+} objc_census_entry;
+
+OBJC_EXPORT void objc_setCensusEnabled(BOOL enabled);
+OBJC_EXPORT objc_census_entry *objc_copyCensus(unsigned *countp); // unordered, free() the result
+
 OBJC_EXPORT void OBJCEnableMsgTracing();
 OBJC_EXPORT void OBJCDisableMsgTracing();
 
@@ -125,3 +245,8 @@ OBJC_EXPORT void OBJCInitializeProcess();
 
 OBJC_EXPORT BOOL object_cxxConstruct(id self, Class c);
 OBJC_EXPORT BOOL object_cxxDestruct(id self, Class c);
+
+// Instances of a class which was never allocated with extra bytes are all its instance size,
+// NSDeallocateObject only recycles those
+OBJC_EXPORT void OBJCClassNoteExtraBytes(Class cls);
+OBJC_EXPORT BOOL OBJCClassMayHaveExtraBytes(Class cls);
@@ -0,0 +1,87 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import "AssociatedObjects.h"
+#import <objc/runtime.h>
+
+static char firstKey, secondKey;
+
+@implementation AssociatedObjects
+
+-(void)testSetAndReplace
+{
+   id object=[NSObject new];
+   id value=[NSObject new];
+   NSMutableString *string=[NSMutableString stringWithString:@"value"];
+
+   STAssertNil(objc_getAssociatedObject(object, &firstKey), nil);
+
+   objc_setAssociatedObject(object, &firstKey, value, OBJC_ASSOCIATION_RETAIN);
+   STAssertEquals(objc_getAssociatedObject(object, &firstKey), value, nil);
+   STAssertEquals([value retainCount], (NSUInteger)2, nil);
+
+   objc_setAssociatedObject(object, &firstKey, value, OBJC_ASSOCIATION_ASSIGN);
+   STAssertEquals([value retainCount], (NSUInteger)1, nil);
+
+   objc_setAssociatedObject(object, &secondKey, string, OBJC_ASSOCIATION_COPY);
+   STAssertFalse(objc_getAssociatedObject(object, &secondKey)==string, nil);
+   STAssertEqualObjects(objc_getAssociatedObject(object, &secondKey), @"value", nil);
+
+   objc_setAssociatedObject(object, &firstKey, nil, OBJC_ASSOCIATION_ASSIGN);
+   STAssertNil(objc_getAssociatedObject(object, &firstKey), nil);
+   STAssertNotNil(objc_getAssociatedObject(object, &secondKey), nil);
+
+   objc_removeAssociatedObjects(object);
+   STAssertNil(objc_getAssociatedObject(object, &secondKey), nil);
+
+   [object release];
+   [value release];
+}
+
+-(void)testValuesReleasedOnDealloc
+{
+   id object=[NSObject new];
+   id value=[NSObject new];
+   char keys[40];
+
+   // more keys than fit in the initial entry array
+   for(int i=0; i<40; i++)
+      objc_setAssociatedObject(object, keys+i, value, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+   STAssertEquals([value retainCount], (NSUInteger)41, nil);
+   for(int i=0; i<40; i++)
+      STAssertEquals(objc_getAssociatedObject(object, keys+i), value, nil);
+
+   [object release];
+   STAssertEquals([value retainCount], (NSUInteger)1, nil);
+   [value release];
+}
+
+-(void)testManyObjects
+{
+   enum { count=20000 };
+   id *objects=malloc(sizeof(id)*count);
+   id value=[NSObject new];
+
+   for(int i=0; i<count; i++) {
+      objects[i]=[NSObject new];
+      objc_setAssociatedObject(objects[i], &firstKey, value, OBJC_ASSOCIATION_RETAIN);
+   }
+   for(int i=0; i<count; i+=2)
+      [objects[i] release];
+   for(int i=1; i<count; i+=2)
+      STAssertEquals(objc_getAssociatedObject(objects[i], &firstKey), value, nil);
+   STAssertEquals([value retainCount], (NSUInteger)(1+count/2), nil);
+   for(int i=1; i<count; i+=2)
+      [objects[i] release];
+
+   STAssertEquals([value retainCount], (NSUInteger)1, nil);
+   [value release];
+   free(objects);
+}
+
+@end
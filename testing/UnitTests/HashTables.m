@@ -0,0 +1,89 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "HashTables.h"
+
+@implementation HashTables
+
+// Random inserts and removes of a few thousand keys, checked against a plain array
+-(void)testMapTableChurn
+{
+   NSMapTable *table=NSCreateMapTable(NSIntegerMapKeyCallBacks, NSIntegerMapValueCallBacks, 0);
+   NSInteger values[3000]={0};
+
+   srandom(1);
+   for(int i=0; i<200000; i++) {
+      NSInteger key=random()%3000+1;
+
+      if(random()%3==0) {
+         NSMapRemove(table, (void *)key);
+         values[key-1]=0;
+      }
+      else {
+         values[key-1]=random()%1000+1;
+         NSMapInsert(table, (void *)key, (void *)values[key-1]);
+      }
+   }
+
+   NSUInteger count=0;
+   for(NSInteger key=1; key<=3000; key++) {
+      STAssertEquals((NSInteger)NSMapGet(table, (void *)key), values[key-1], nil);
+      count+=(values[key-1]!=0);
+   }
+   STAssertEquals(NSCountMapTable(table), count, nil);
+   NSFreeMapTable(table);
+}
+
+-(void)testHashTableChurn
+{
+   NSHashTable *table=NSCreateHashTable(NSObjectHashCallBacks, 0);
+   NSMutableSet *expected=[NSMutableSet set];
+
+   srandom(2);
+   for(int i=0; i<20000; i++) {
+      NSString *string=[NSString stringWithFormat:@"key %d", (int)(random()%500)];
+
+      if(random()%3==0) {
+         NSHashRemove(table, string);
+         [expected removeObject:string];
+      }
+      else {
+         NSHashInsert(table, string);
+         [expected addObject:string];
+      }
+   }
+
+   STAssertEquals(NSCountHashTable(table), [expected count], nil);
+   for(NSString *string in expected)
+      STAssertEqualObjects((id)NSHashGet(table, string), string, nil);
+   NSFreeHashTable(table);
+}
+
+-(void)testEnumeration
+{
+   NSMapTable *table=NSCreateMapTable(NSObjectMapKeyCallBacks, NSObjectMapValueCallBacks, 0);
+   NSMutableSet *keys=[NSMutableSet set];
+   NSMapEnumerator state;
+   void *key, *value;
+
+   for(int i=0; i<100; i++)
+      NSMapInsert(table, [NSNumber numberWithInt:i], [NSString stringWithFormat:@"%d", i]);
+   for(int i=0; i<100; i+=2)
+      NSMapRemove(table, [NSNumber numberWithInt:i]);
+
+   state=NSEnumerateMapTable(table);
+   while(NSNextMapEnumeratorPair(&state, &key, &value)) {
+      STAssertTrue([(id)key intValue]%2==1, nil);
+      STAssertEquals([(id)value intValue], [(id)key intValue], nil);
+      [keys addObject:(id)key];
+   }
+   STAssertEquals([keys count], (NSUInteger)50, nil);
+   STAssertEquals([NSAllMapTableKeys(table) count], (NSUInteger)50, nil);
+   NSFreeMapTable(table);
+}
+
+@end
@@ -0,0 +1,89 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "HeapCensus.h"
+
+@interface HeapCensusObject : NSObject {
+   char payload[40];
+}
+@end
+
+@implementation HeapCensusObject
+@end
+
+@implementation HeapCensus
+
+-(NSHeapCensusEntry *)entryForClass:(Class)cls in:(NSHeapCensusEntry *)entries count:(NSUInteger)count
+{
+   for(NSUInteger i=0; i<count; i++)
+      if(entries[i].cls==cls)
+         return entries+i;
+
+   return NULL;
+}
+
+-(void)testCountsInstances
+{
+   NSMutableArray *objects=[NSMutableArray array];
+   NSUInteger beforeCount, afterCount;
+
+   NSSetHeapCensusEnabled(YES);
+   NSHeapCensusEntry *before=NSCopyHeapCensus(&beforeCount);
+   for(int i=0; i<100; i++) {
+      id object=[HeapCensusObject new];
+
+      [objects addObject:object];
+      [object release];
+   }
+   [objects removeObjectsInRange:NSMakeRange(0, 40)];
+   NSHeapCensusEntry *after=NSCopyHeapCensus(&afterCount);
+   NSSetHeapCensusEnabled(NO);
+
+   NSHeapCensusEntry *old=[self entryForClass:[HeapCensusObject class] in:before count:beforeCount];
+   NSHeapCensusEntry *entry=[self entryForClass:[HeapCensusObject class] in:after count:afterCount];
+
+   STAssertTrue(entry!=NULL, nil);
+   STAssertEquals(entry->liveInstances-(old ? old->liveInstances : 0), (NSInteger)60, nil);
+   STAssertEquals(entry->allocations-(old ? old->allocations : 0), (NSUInteger)100, nil);
+   STAssertEquals(entry->liveBytes, entry->liveInstances*(NSInteger)class_getInstanceSize([HeapCensusObject class]), nil);
+   for(NSUInteger i=1; i<afterCount; i++)
+      STAssertTrue(after[i-1].liveBytes>=after[i].liveBytes, nil);
+
+   free(before);
+   free(after);
+}
+
+-(void)testDifference
+{
+   NSMutableArray *objects=[NSMutableArray array];
+   NSUInteger beforeCount, afterCount, count;
+
+   NSSetHeapCensusEnabled(YES);
+   NSHeapCensusEntry *before=NSCopyHeapCensus(&beforeCount);
+   for(int i=0; i<25; i++) {
+      id object=[HeapCensusObject new];
+
+      [objects addObject:object];
+      [object release];
+   }
+   NSHeapCensusEntry *after=NSCopyHeapCensus(&afterCount);
+   NSSetHeapCensusEnabled(NO);
+
+   NSHeapCensusEntry *difference=NSCopyHeapCensusDifference(before, beforeCount, after, afterCount, &count);
+   NSHeapCensusEntry *entry=[self entryForClass:[HeapCensusObject class] in:difference count:count];
+
+   STAssertTrue(entry!=NULL, nil);
+   STAssertEquals(entry->liveInstances, (NSInteger)25, nil);
+   STAssertEquals(entry->allocations, (NSUInteger)25, nil);
+   NSPrintHeapCensus(difference, count, 10);
+
+   free(difference);
+   free(before);
+   free(after);
+}
+
+@end
@@ -0,0 +1,133 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "ImmutableCollections.h"
+
+@implementation ImmutableCollections
+
+static NSDictionary *numberDictionary(int count)
+{
+   NSMutableArray *keys=[NSMutableArray array], *objects=[NSMutableArray array];
+
+   for(int i=0; i<count; i++) {
+      [keys addObject:[NSString stringWithFormat:@"key %d", i]];
+      [objects addObject:[NSNumber numberWithInt:i]];
+   }
+
+   return [NSDictionary dictionaryWithObjects:objects forKeys:keys];
+}
+
+// Sizes either side of where the scanned layout gives way to the hashed one
+-(void)testDictionaryLookup
+{
+   int counts[]={ 0, 1, 7, 8, 9, 100, 5000 };
+
+   for(int c=0; c<sizeof(counts)/sizeof(counts[0]); c++) {
+      NSDictionary *dictionary=numberDictionary(counts[c]);
+
+      STAssertEquals([dictionary count], (NSUInteger)counts[c], nil);
+      for(int i=0; i<counts[c]; i++) {
+         NSString *key=[NSString stringWithFormat:@"key %d", i];
+
+         STAssertEquals([[dictionary objectForKey:key] intValue], i, nil);
+      }
+      STAssertNil([dictionary objectForKey:@"missing"], nil);
+      STAssertNil([dictionary objectForKey:nil], nil);
+   }
+}
+
+// The last value for a key wins, as if the pairs were set one by one on a mutable dictionary
+-(void)testDictionaryDuplicateKeys
+{
+   NSDictionary *small=[NSDictionary dictionaryWithObjectsAndKeys:@"1", @"a", @"2", @"b", @"3", @"a", nil];
+   NSMutableArray *keys=[NSMutableArray array], *objects=[NSMutableArray array];
+
+   STAssertEquals([small count], (NSUInteger)2, nil);
+   STAssertEqualObjects([small objectForKey:@"a"], @"3", nil);
+   STAssertEqualObjects([small objectForKey:@"b"], @"2", nil);
+
+   for(int i=0; i<50; i++) {
+      [keys addObject:[NSNumber numberWithInt:i%20]];
+      [objects addObject:[NSNumber numberWithInt:i]];
+   }
+   NSDictionary *large=[NSDictionary dictionaryWithObjects:objects forKeys:keys];
+
+   STAssertEquals([large count], (NSUInteger)20, nil);
+   STAssertEquals([[large allKeys] count], (NSUInteger)20, nil);
+   for(int i=0; i<20; i++)
+      STAssertEquals([[large objectForKey:[NSNumber numberWithInt:i]] intValue], (i<10)?i+40:i+20, nil);
+}
+
+-(void)testDictionaryNilRaises
+{
+   id keys[2]={ @"a", nil }, objects[2]={ @"1", @"2" };
+
+   STAssertThrows([[NSDictionary alloc] initWithObjects:objects forKeys:keys count:2], nil);
+   keys[1]=@"b";
+   objects[1]=nil;
+   STAssertThrows([[NSDictionary alloc] initWithObjects:objects forKeys:keys count:2], nil);
+}
+
+-(void)testCopyReturnsSelf
+{
+   NSDictionary *dictionary=numberDictionary(20);
+   NSSet *set=[NSSet setWithArray:[dictionary allKeys]];
+
+   STAssertTrue([dictionary copy]==dictionary, nil);
+   STAssertTrue([set copy]==set, nil);
+   [dictionary release];
+   [set release];
+
+   NSMutableDictionary *mutable=[[dictionary mutableCopy] autorelease];
+   [mutable setObject:@"x" forKey:@"key 0"];
+   STAssertEqualObjects([dictionary objectForKey:@"key 0"], [NSNumber numberWithInt:0], nil);
+}
+
+// The first of equal objects is the member
+-(void)testSetMembership
+{
+   NSMutableArray *objects=[NSMutableArray array];
+
+   for(int i=0; i<300; i++)
+      [objects addObject:[NSString stringWithFormat:@"%d", i%100]];
+
+   NSSet *set=[NSSet setWithArray:objects];
+
+   STAssertEquals([set count], (NSUInteger)100, nil);
+   for(int i=0; i<100; i++)
+      STAssertTrue([set member:[NSString stringWithFormat:@"%d", i]]==[objects objectAtIndex:i], nil);
+   STAssertFalse([set containsObject:@"100"], nil);
+   STAssertTrue([[NSSet setWithObjects:@"a", @"b", @"a", nil] count]==2, nil);
+}
+
+-(void)testEnumeration
+{
+   NSDictionary *dictionary=numberDictionary(30);
+   NSSet *set=[NSSet setWithArray:[dictionary allValues]];
+   NSUInteger count=0;
+
+   for(NSString *key in dictionary) {
+      STAssertNotNil([dictionary objectForKey:key], nil);
+      count++;
+   }
+   STAssertEquals(count, (NSUInteger)30, nil);
+
+   NSEnumerator *keys=[dictionary keyEnumerator], *values=[dictionary objectEnumerator];
+   NSString *key;
+   while((key=[keys nextObject])!=nil)
+      STAssertEqualObjects([values nextObject], [dictionary objectForKey:key], nil);
+
+   count=0;
+   for(NSNumber *number in set) {
+      STAssertTrue([set containsObject:number], nil);
+      count++;
+   }
+   STAssertEquals(count, (NSUInteger)30, nil);
+   STAssertEquals([[[set objectEnumerator] allObjects] count], (NSUInteger)30, nil);
+}
+
+@end
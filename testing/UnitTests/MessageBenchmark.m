@@ -7,6 +7,7 @@
  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #import "MessageBenchmark.h"
+#import <objc/message.h>
 
 
 @implementation MessageBenchmark
@@ -17,13 +18,201 @@
    count = 50000000;
 }
 
+-(void)logCacheStatisticsSince:(objc_method_cache_statistics *)before sends:(int)sends
+{
+   objc_method_cache_statistics after;
+
+   objc_getMethodCacheStatistics(&after);
+
+   unsigned long misses=after.misses-before->misses;
+
+   NSLog(@"%d sends, %lu misses, hit rate %.4f%%, %lu misses saved by negative entries", sends, misses, 100.0*(sends-(double)misses)/sends, after.negativeHits-before->negativeHits);
+   NSLog(@"%lu caches, %lu/%lu slots used (%lu negative), average probe length %.2f, longest %lu", after.caches, after.occupied, after.capacity, after.negative, (after.occupied==0)?0.0:(double)after.totalProbeLength/after.occupied, after.maxProbeLength);
+}
+
 -(void)testLookup
 {
+   objc_method_cache_statistics before;
    int ret=1;
+
+   objc_getMethodCacheStatistics(&before);
    for(int i=0; i<count; i++) {
       ret|=[self testStuff:object];
    }
    STAssertEquals(ret, 1, nil);
+   [self logCacheStatisticsSince:&before sends:count];
+}
+
+-(void)testNegativeLookup
+{
+   objc_method_cache_statistics before;
+   SEL missing=@selector(messageBenchmarkDoesNotImplementThis);
+   int responds=0, iterations=count/10;
+
+   objc_getMethodCacheStatistics(&before);
+   for(int i=0; i<iterations; i++) {
+      responds+=[self respondsToSelector:missing];
+   }
+   STAssertEquals(responds, 0, nil);
+   [self logCacheStatisticsSince:&before sends:iterations];
+}
+
+-(void)testStartupStatistics
+{
+   objc_startup_statistics stats;
+
+   objc_getStartupStatistics(&stats);
+   NSLog(@"%lu modules, %lu classes registered in %.3f ms (+load %.3f ms), %lu selector references", stats.modules, stats.classesRegistered, stats.imageNanoseconds/1e6, stats.loadNanoseconds/1e6, stats.selectorReferences);
+   NSLog(@"%lu of %lu classes and metaclasses realized in %.3f ms, %lu method selectors", stats.classesRealized, stats.classesRegistered*2, stats.realizeNanoseconds/1e6, stats.methodSelectors);
+   STAssertTrue(stats.classesRegistered>0, nil);
+   STAssertTrue(stats.classesRealized>0, nil);
+}
+
+// Name to selector lookups as done by NSSelectorFromString and the KVC/KVO paths, for a
+// selector the frameworks implement and for one only registered at runtime
+-(void)testSelectorLookup
+{
+   const char *names[2]={"objectForKey:", "messageBenchmarkRegisteredAtRuntime:"};
+   int iterations=count/10;
+
+   for(int i=0; i<2; i++) {
+      SEL expected=sel_registerName(names[i]);
+      int matches=0;
+
+      NSDate *start=[NSDate date];
+      for(int j=0; j<iterations; j++)
+         matches+=sel_isEqual(sel_getUid(names[i]), expected);
+      NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+
+      NSLog(@"%s: %.1f ns/sel_getUid", names[i], elapsed*1e9/iterations);
+      STAssertEquals(matches, iterations, nil);
+      STAssertTrue(strcmp(sel_getName(expected), names[i])==0, nil);
+   }
+}
+
+// Uncached lookups over every class linked into the process (Foundation and AppKit), which is
+// the work a cold application launch does before its caches warm up
+-(void)testColdMethodLookup
+{
+   int classCount=objc_getClassList(NULL, 0);
+   Class *classes=malloc(sizeof(Class)*classCount);
+   SEL missing=@selector(messageBenchmarkDoesNotImplementThis);
+   unsigned long lookups=0, found=0;
+
+   classCount=objc_getClassList(classes, classCount);
+
+   NSDate *start=[NSDate date];
+   for(int i=0; i<classCount; i++) {
+      Class classes2[2]={classes[i], object_getClass(classes[i])};
+
+      for(int j=0; j<2; j++) {
+         unsigned int methodCount;
+         Method *methods=class_copyMethodList(classes2[j], &methodCount);
+
+         for(unsigned int k=0; k<methodCount; k++, lookups++)
+            found+=(class_getInstanceMethod(classes2[j], method_getName(methods[k]))!=NULL);
+
+         // a miss walks every list up to the root
+         class_getInstanceMethod(classes2[j], missing);
+         lookups++;
+         free(methods);
+      }
+   }
+   NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+
+   free(classes);
+   NSLog(@"%d classes, %lu uncached lookups in %.3f ms, %.1f ns/lookup", classCount, lookups, elapsed*1000.0, elapsed*1e9/lookups);
+   STAssertEquals(found, lookups-classCount*2, nil);
+}
+
+// Cost of a single dispatch through objc_msgSend and friends, called directly so the compiler
+// cannot pick another entry point
+-(void)testSendLatency
+{
+   int (*send)(id, SEL, id)=(int (*)(id, SEL, id))objc_msgSend;
+   id (*sendSuper)(struct objc_super *, SEL)=(id (*)(struct objc_super *, SEL))objc_msgSendSuper;
+   SEL selector=@selector(testStuff:);
+   struct objc_super superSelf={self, [NSObject class]};
+   int ret=0, iterations=count/5;
+   id result=nil;
+   NSDate *start;
+   NSTimeInterval hit, nilReceiver, superSend;
+
+   send(self, selector, object);
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++)
+      ret+=send(self, selector, object);
+   hit=-[start timeIntervalSinceNow];
+   STAssertEquals(ret, iterations, nil);
+
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++)
+      ret+=send(nil, selector, object);
+   nilReceiver=-[start timeIntervalSinceNow];
+   STAssertEquals(ret, iterations, nil);
+
+   sendSuper(&superSelf, @selector(self));
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++)
+      result=sendSuper(&superSelf, @selector(self));
+   superSend=-[start timeIntervalSinceNow];
+   STAssertEquals(result, (id)self, nil);
+
+   NSLog(@"objc_msgSend hit %.2f ns/send, nil receiver %.2f ns/send, objc_msgSendSuper %.2f ns/send", hit*1e9/iterations, nilReceiver*1e9/iterations, superSend*1e9/iterations);
+
+#ifdef __x86_64__
+   id (*sendSuper2)(struct objc_super *, SEL)=(id (*)(struct objc_super *, SEL))objc_msgSendSuper2;
+   struct objc_super superClass={self, [MessageBenchmark class]};
+
+   sendSuper2(&superClass, @selector(self));
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++)
+      result=sendSuper2(&superClass, @selector(self));
+   superSend=-[start timeIntervalSinceNow];
+   STAssertEquals(result, (id)self, nil);
+
+   NSLog(@"objc_msgSendSuper2 %.2f ns/send", superSend*1e9/iterations);
+#endif
+}
+
+-(void)testMessageProfile
+{
+   SEL selector=@selector(testStuff:);
+   int (*imp)(id, SEL, id);
+   unsigned long sends=0;
+   unsigned count;
+
+   objc_resetMessageProfile();
+   objc_startMessageProfiling(1);
+   for(int i=0; i<10000; i++) {
+      imp=(int (*)(id, SEL, id))objc_msg_lookup(self, selector);
+      imp(self, selector, object);
+   }
+   objc_stopMessageProfiling();
+
+   objc_message_profile_entry *entries=objc_copyMessageProfile(&count);
+
+   for(unsigned i=0; i<count; i++)
+      if(entries[i].cls==[self class] && entries[i].selector==selector)
+         sends=entries[i].sends;
+   free(entries);
+
+   STAssertEquals(sends, 10000UL, nil);
+
+   NSString *path=[NSTemporaryDirectory() stringByAppendingPathComponent:@"MessageBenchmark.profile"];
+   NSString *message=[NSString stringWithFormat:@"-[%@ testStuff:]", NSStringFromClass([self class])];
+   NSString *contents;
+
+   STAssertTrue(objc_writeMessageProfile([path fileSystemRepresentation], OBJC_PROFILE_REPORT), nil);
+   contents=[NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:NULL];
+   STAssertTrue([contents rangeOfString:message].location!=NSNotFound, nil);
+
+   STAssertTrue(objc_writeMessageProfile([path fileSystemRepresentation], OBJC_PROFILE_COLLAPSED_STACKS), nil);
+   contents=[NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:NULL];
+   STAssertTrue([contents rangeOfString:[message stringByAppendingString:@" "]].location!=NSNotFound, nil);
+
+   [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+   objc_resetMessageProfile();
 }
 
 -(int)testStuff:(id)string
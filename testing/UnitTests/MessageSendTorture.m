@@ -110,6 +110,46 @@ extern id objc_msgSend(id self, SEL op, ...);
    }
 }
 
+// Every first send of a selector to a fresh class misses the cache and takes the slow path
+// through the method lists, the second round over the same selectors hits
+-(void)testMissLatency
+{
+   typedef int	(*TestImp)(id, SEL, ...); 
+   TestImp send=(TestImp)objc_msgSend;
+   Method torture=class_getInstanceMethod([self class], @selector(_torture_));
+   Class missClass=objc_allocateClassPair([MessageSendTorture class], "MessageSendTortureMiss", 0);
+   SEL *selectors=malloc(sizeof(SEL)*NUM_SELECTORS);
+   int failures=0;
+
+   for(int i=0; i<NUM_SELECTORS; i++)
+   {
+      char buf[strlen(SEL_PREFIX)+10];
+
+      sprintf(buf, "%s%i", SEL_PREFIX, i);
+      selectors[i]=sel_getUid(buf);
+      class_addMethod(missClass, selectors[i], method_getImplementation(torture), method_getTypeEncoding(torture));
+   }
+   objc_registerClassPair(missClass);
+
+   id instance=class_createInstance(missClass, 0);
+   send(instance, @selector(_torture_));
+
+   NSDate *start=[NSDate date];
+   for(int i=0; i<NUM_SELECTORS; i++)
+      failures+=(send(instance, selectors[i])!=i);
+   NSTimeInterval miss=-[start timeIntervalSinceNow];
+
+   start=[NSDate date];
+   for(int i=0; i<NUM_SELECTORS; i++)
+      failures+=(send(instance, selectors[i])!=i);
+   NSTimeInterval hit=-[start timeIntervalSinceNow];
+
+   NSLog(@"objc_msgSend miss %.1f ns/send, hit %.1f ns/send over %d selectors", miss*1e9/NUM_SELECTORS, hit*1e9/NUM_SELECTORS, NUM_SELECTORS);
+   STAssertEquals(failures, 0, nil);
+   object_dispose(instance);
+   free(selectors);
+}
+
 -(void)testMessageSendTorture
 {
    for(int i=0; i<12; i++)
@@ -0,0 +1,148 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "MutableStringEditing.h"
+
+@interface NSString (MutableStringLineIndex)
+-(NSUInteger)_numberOfLines;
+-(NSUInteger)_lineOfCharacterIndex:(NSUInteger)location;
+-(NSUInteger)_characterIndexOfLine:(NSUInteger)line;
+@end
+
+@implementation MutableStringEditing
+
+static NSMutableString *largeString(NSUInteger length)
+{
+   unichar *characters=malloc(length*sizeof(unichar));
+
+   for(NSUInteger i=0; i<length; i++)
+      characters[i]=(i%80==79) ? '\n' : 'a'+i%26;
+
+   NSMutableString *result=[NSMutableString stringWithCharacters:characters length:length];
+
+   free(characters);
+   return result;
+}
+
+// Edits of a large string go to its rope, the same edits on a plain buffer give the same characters
+-(void)testEditsMatchFlatCopy
+{
+   NSMutableString *string=largeString(200000);
+   NSUInteger length=[string length];
+   unichar *check=malloc((length+100000)*sizeof(unichar));
+   unichar inserted[64];
+
+   [string getCharacters:check];
+   srandom(23);
+   for(int i=0; i<3000; i++) {
+      NSUInteger location=random()%(length+1);
+      NSUInteger remove=MIN(length-location, (NSUInteger)random()%((i%100==0) ? 20000 : 20));
+      NSUInteger count=random()%64;
+
+      for(NSUInteger j=0; j<count; j++)
+         inserted[j]=(j%9==0) ? '\r' : (j%9==1) ? '\n' : 0x400+j;
+
+      [string replaceCharactersInRange:NSMakeRange(location, remove) withString:[NSString stringWithCharacters:inserted length:count]];
+      memmove(check+location+count, check+location+remove, (length-location-remove)*sizeof(unichar));
+      memcpy(check+location, inserted, count*sizeof(unichar));
+      length=length-remove+count;
+
+      STAssertEquals([string length], length, nil);
+      if(length>0)
+         STAssertEquals([string characterAtIndex:location%length], check[location%length], nil);
+   }
+
+   unichar *characters=malloc(length*sizeof(unichar));
+   [string getCharacters:characters];
+   STAssertTrue(memcmp(characters, check, length*sizeof(unichar))==0, nil);
+   [string getCharacters:characters range:NSMakeRange(length/3, length/3)];
+   STAssertTrue(memcmp(characters, check+length/3, (length/3)*sizeof(unichar))==0, nil);
+
+   NSString *flat=[NSString stringWithCharacters:check length:length];
+   STAssertEqualObjects(string, flat, nil);
+   STAssertEquals([string hash], [flat hash], nil);
+   STAssertEquals([string lengthOfBytesUsingEncoding:NSUTF8StringEncoding], [[flat dataUsingEncoding:NSUTF8StringEncoding] length], nil);
+
+   [string deleteCharactersInRange:NSMakeRange(10, length-20)];
+   STAssertEquals([string length], (NSUInteger)20, nil);
+   STAssertEqualObjects([string substringFromIndex:10], [flat substringFromIndex:length-10], nil);
+
+   free(characters);
+   free(check);
+}
+
+// The line index agrees with -lineRangeForRange:, including a \r\n made by two edits
+-(void)testLineIndex
+{
+   NSMutableString *string=largeString(300000);
+
+   [string insertString:@"\r" atIndex:150000];
+   [string insertString:@"\n" atIndex:150001];
+   [string insertString:@"x\r" atIndex:1000];
+   [string insertString:@"\n" atIndex:1002];
+   [string insertString:[NSString stringWithFormat:@"%C%C", (unichar)0x2028, (unichar)0x2029] atIndex:5];
+
+   NSUInteger line=0, location=0, length=[string length];
+
+   while(location<length) {
+      NSRange range=[string lineRangeForRange:NSMakeRange(location, 0)];
+
+      STAssertEquals([string _characterIndexOfLine:line], range.location, nil);
+      STAssertEquals([string _lineOfCharacterIndex:range.location], line, nil);
+      STAssertEquals([string _lineOfCharacterIndex:NSMaxRange(range)-1], line, nil);
+      location=NSMaxRange(range);
+      line++;
+   }
+   // the string ends with a terminator, the last line is empty
+   STAssertEquals([string _numberOfLines], line+1, nil);
+   STAssertThrows([string _characterIndexOfLine:line+1], nil);
+}
+
+-(void)testSequentialAccess
+{
+   NSMutableString *string=largeString(5*1024*1024);
+
+   [string insertString:@"rope" atIndex:1];
+
+   NSUInteger length=[string length];
+   NSUInteger sum=0, check=0;
+   unichar buffer[1000];
+
+   NSDate *start=[NSDate date];
+   for(NSUInteger i=0; i<length; i++)
+      sum+=[string characterAtIndex:i];
+   NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+
+   for(NSUInteger i=0; i<length; i+=1000) {
+      NSRange range=NSMakeRange(i, MIN(1000, length-i));
+
+      [string getCharacters:buffer range:range];
+      for(NSUInteger j=0; j<range.length; j++)
+         check+=buffer[j];
+   }
+
+   STAssertEquals(sum, check, nil);
+   NSLog(@"sequential characterAtIndex: of a 10MB string: %.1f ns", elapsed*1e9/length);
+}
+
+-(void)testRandomInsertSpeed
+{
+   NSMutableString *string=largeString(5*1024*1024);
+
+   [string insertString:@"rope" atIndex:1];
+   srandom(10);
+
+   NSDate *start=[NSDate date];
+   for(int i=0; i<10000; i++)
+      [string insertString:@"insert" atIndex:random()%([string length]+1)];
+   NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+
+   STAssertEquals([string length], (NSUInteger)(5*1024*1024+4+10000*6), nil);
+   NSLog(@"random insert into a 10MB string: %.1f ns", elapsed*1e9/10000);
+}
+
+@end
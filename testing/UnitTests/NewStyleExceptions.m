@@ -158,6 +158,49 @@
 	}
 }
 
+-(int)returnArgument:(int)i
+{
+   return i;
+}
+
+// What entering a handler costs when nothing is thrown, which is what NSRunLoop, notification
+// posting and KVC pay on every call
+-(void)testTryEntry
+{
+   int iterations=10000000, sum=0;
+   NSTimeInterval plain, tryBlock, during;
+   NSDate *start;
+
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++)
+      sum+=[self returnArgument:i&1];
+   plain=-[start timeIntervalSinceNow];
+
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++) {
+      @try {
+         sum+=[self returnArgument:i&1];
+      }
+      @catch(NSException *a) {
+         sum--;
+      }
+   }
+   tryBlock=-[start timeIntervalSinceNow];
+
+   start=[NSDate date];
+   for(int i=0; i<iterations; i++) {
+      NS_DURING
+         sum+=[self returnArgument:i&1];
+      NS_HANDLER
+         sum--;
+      NS_ENDHANDLER
+   }
+   during=-[start timeIntervalSinceNow];
+
+   NSLog(@"send %.2f ns, @try adds %.2f ns, NS_DURING adds %.2f ns", plain*1e9/iterations, (tryBlock-plain)*1e9/iterations, (during-plain)*1e9/iterations);
+   STAssertEquals(sum, iterations*3/2, nil);
+}
+
 -(void)recurse:(int)i
 {
     @synchronized([NSNumber numberWithInt:i])
@@ -11,6 +11,13 @@
 
 #import "ObjCXXExceptions.h"
 
+struct ObjCXXExceptionsCleanup {
+    bool *ran;
+    ~ObjCXXExceptionsCleanup() {
+        *ran = true;
+    }
+};
+
 @implementation ObjCXXExceptions
 - (void)throwObjCException {
     [NSException raise:NSInvalidArgumentException format:nil];
@@ -54,4 +61,24 @@
     STFail(@"nothing caught");
 }
 
+- (void)throwObjCExceptionThroughDestructor:(bool *)ran {
+    ObjCXXExceptionsCleanup cleanup = { ran };
+
+    [self throwObjCException];
+}
+
+// the destructor runs in a C++ landing pad which resumes unwinding the Objective-C exception
+- (void)testObjCThrowThroughCXXCleanup {
+    bool ran = false;
+
+    @try {
+        [self throwObjCExceptionThroughDestructor:&ran];
+    }
+    @catch(NSException *ex) {
+        STAssertTrue(ran, nil);
+        return;
+    }
+    STFail(@"nothing caught");
+}
+
 @end
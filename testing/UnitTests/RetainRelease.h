@@ -13,5 +13,7 @@
 }
 - (void)testRetainRelease;
 - (void)testAutoreleasePool;
+- (void)testNestedAutoreleasePools;
+- (void)testAutoreleaseReturnValue;
 - (void)didCallDealloc;
 @end
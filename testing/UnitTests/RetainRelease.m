@@ -7,6 +7,7 @@
  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #import "RetainRelease.h"
+#import <objc/objc_arc.h>
 
 @interface RetainReleaseTestHelperObject : NSObject
 {
@@ -25,7 +26,7 @@
 @end
 
 @implementation RetainRelease
--(void)testRetainRelease;
+-(void)testRetainRelease
 {
    deallocCalled=NO;
    RetainReleaseTestHelperObject *helper=[RetainReleaseTestHelperObject new];
@@ -42,7 +43,7 @@
    deallocCalled=YES;
 }
 
--(void)testAutoreleasePool;
+-(void)testAutoreleasePool
 {
    deallocCalled=NO;
    RetainReleaseTestHelperObject *helper=[RetainReleaseTestHelperObject new];
@@ -57,4 +58,43 @@
    STAssertTrue(deallocCalled, nil);
 
 }
+
+-(void)testNestedAutoreleasePools
+{
+   deallocCalled=NO;
+   RetainReleaseTestHelperObject *helper=[RetainReleaseTestHelperObject new];
+   NSUInteger i;
+
+   helper->delegate=self;
+
+   id outer=[NSAutoreleasePool new];
+   [helper autorelease];
+
+   // enough objects to spill over several pages
+   id inner=[NSAutoreleasePool new];
+   for(i=0;i<10000;i++)
+      [[NSObject new] autorelease];
+   [inner drain];
+
+   STAssertFalse(deallocCalled, nil);
+   [outer drain];
+   STAssertTrue(deallocCalled, nil);
+}
+
+-(void)testAutoreleaseReturnValue
+{
+   deallocCalled=NO;
+   RetainReleaseTestHelperObject *helper=[RetainReleaseTestHelperObject new];
+
+   helper->delegate=self;
+
+   id pool=[NSAutoreleasePool new];
+   id result=objc_retainAutoreleasedReturnValue(objc_autoreleaseReturnValue(helper));
+   [pool drain];
+
+   STAssertEquals(result, (id)helper, nil);
+   STAssertFalse(deallocCalled, nil);
+   [result release];
+   STAssertTrue(deallocCalled, nil);
+}
 @end
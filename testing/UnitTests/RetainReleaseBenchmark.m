@@ -0,0 +1,127 @@
+/* Copyright (c) 2026 Cocotron contributors
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import "RetainReleaseBenchmark.h"
+
+#define MAX_THREADS 8
+#define OBJECTS_PER_THREAD 64
+
+@interface RetainReleaseBenchmarkThread : NSThread {
+    RetainReleaseBenchmark *_delegate;
+    BOOL _shared;
+}
+@property (retain) RetainReleaseBenchmark *delegate;
+@property (assign) BOOL shared;
+@end
+
+@implementation RetainReleaseBenchmarkThread
+@synthesize delegate=_delegate;
+@synthesize shared=_shared;
+-(void)main
+{
+   [_delegate retainReleaseLoop:_shared];
+}
+@end
+
+@implementation RetainReleaseBenchmark
+
+-(void)setUp
+{
+   NSMutableArray *array=[NSMutableArray array];
+
+   for(int i=0; i<MAX_THREADS*OBJECTS_PER_THREAD; i++)
+   {
+      id object=[NSObject new];
+      [array addObject:object];
+      [object release];
+   }
+   objects=[array retain];
+   iterations=200000;
+}
+
+-(void)tearDown
+{
+   [objects release];
+}
+
+// shared==YES hammers the same objects from all threads, otherwise each thread has its own slice
+-(void)retainReleaseLoop:(BOOL)shared
+{
+   NSUInteger count=[objects count];
+   NSUInteger offset=shared?0:(NSUInteger)(__sync_fetch_and_add(&nextSlice, 1)%MAX_THREADS)*OBJECTS_PER_THREAD;
+   id local[OBJECTS_PER_THREAD];
+
+   for(int i=0; i<OBJECTS_PER_THREAD; i++)
+      local[i]=[objects objectAtIndex:(offset+i)%count];
+
+   for(int i=0; i<iterations; i++)
+   {
+      id object=local[i%OBJECTS_PER_THREAD];
+
+      [object retain];
+      [object release];
+   }
+   __sync_add_and_fetch(&finishedThreads, 1);
+}
+
+-(NSTimeInterval)runWithThreads:(int)numThreads shared:(BOOL)shared
+{
+   NSDate *start=[NSDate date];
+
+   finishedThreads=0;
+   nextSlice=0;
+   for(int i=0; i<numThreads; i++)
+   {
+      RetainReleaseBenchmarkThread *thread=[RetainReleaseBenchmarkThread new];
+      thread.delegate=self;
+      thread.shared=shared;
+      [thread start];
+      [thread release];
+   }
+   while(finishedThreads<numThreads)
+      [NSThread sleepForTimeInterval:0.001];
+
+   return -[start timeIntervalSinceNow];
+}
+
+-(void)testContentionScaling
+{
+   for(int shared=0; shared<2; shared++)
+   {
+      for(int numThreads=1; numThreads<=MAX_THREADS; numThreads*=2)
+      {
+         NSTimeInterval elapsed=[self runWithThreads:numThreads shared:shared];
+         double pairs=(double)numThreads*iterations;
+
+         NSLog(@"retain/release %@ objects, %d thread(s): %.1f ns/pair, %.2f M pairs/s", shared?@"shared":@"private", numThreads, elapsed*1e9/pairs, pairs/elapsed/1e6);
+      }
+   }
+
+   for(id object in objects)
+      STAssertEquals([object retainCount], (NSUInteger)1, nil);
+}
+
+-(void)testAutoreleasePoolPushPop
+{
+   NSDate *start=[NSDate date];
+   id object=[objects objectAtIndex:0];
+
+   for(int i=0; i<iterations; i++)
+   {
+      NSAutoreleasePool *pool=[NSAutoreleasePool new];
+
+      [[object retain] autorelease];
+      [pool drain];
+   }
+
+   NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+   NSLog(@"autorelease pool push/autorelease/pop: %.1f ns/iteration", elapsed*1e9/iterations);
+   STAssertEquals([object retainCount], (NSUInteger)1, nil);
+}
+
+@end
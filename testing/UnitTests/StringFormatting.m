@@ -0,0 +1,63 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "StringFormatting.h"
+
+@implementation StringFormatting
+
+-(void)testIntegers
+{
+   STAssertEqualObjects(([NSString stringWithFormat:@"%d|%d|%d", 0, -42, 2147483647]), @"0|-42|2147483647", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%5d|%-5d|%+d|% d", 42, 42, 7, 7]), @"   42|42   |+7| 7", nil);
+   // zero fill goes in front of the sign
+   STAssertEqualObjects(([NSString stringWithFormat:@"%05d", -42]), @"00-42", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%ld|%qd|%hd", -9223372036854775807L, 123456789012LL, 70000]), @"-9223372036854775807|123456789012|4464", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%u|%x|%X|%o", 4294967295U, 255, 48879, 8]), @"4294967295|ff|BEEF|10", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%lu|%lx", 18446744073709551615UL, 0xfeedfaceUL]), @"18446744073709551615|feedface", nil);
+}
+
+-(void)testFieldArguments
+{
+   STAssertEqualObjects(([NSString stringWithFormat:@"%*d|%-*d|%*d|", 4, 1, 4, 2, -4, 3]), @"   1|2   |3   |", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%.*f", 2, 3.14159]), @"3.14", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%*%|%d", 3, 5]), @"%|5", nil);
+}
+
+-(void)testFloats
+{
+   STAssertEqualObjects(([NSString stringWithFormat:@"%f|%.2f", 1.5, 0.25]), @"1.500000|0.25", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%8.3f|%-8.1f|%+.0f", 3.14159, 2.5, 9.6]), @"   3.142|2.5     |+10", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%g", 123456.0]), @"123456", nil);
+}
+
+-(void)testStringsAndObjects
+{
+   STAssertEqualObjects(([NSString stringWithFormat:@"%@/%@", @"usr", @"local"]), @"usr/local", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%@|%s", nil, NULL]), @"*nil*|(null pointer)", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"100%%|%5s|%-5@|", "ab", @"cd"]), @"100%|   ab|cd   |", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"%c%c|%5c|%@", 'o', 'k', 'x', [NSNumber numberWithInt:12]]), @"ok|    x|12", nil);
+   STAssertEqualObjects(([NSString stringWithFormat:@"caf%C", (unichar)0xE9]), ([NSString stringWithFormat:@"caf%s", "\xE9"]), nil);
+}
+
+// Constant formats are compiled once and reused, other formats every time
+-(void)testRepeatedFormats
+{
+   NSString *format=[NSString stringWithString:@"%@ = %d;"];
+   NSString *longFormat=[[@"" stringByPaddingToLength:1000 withString:@"-" startingAtIndex:0] stringByAppendingString:@"%d"];
+   int position=0;
+
+   for(int i=0; i<3; i++) {
+      STAssertEqualObjects(([NSString stringWithFormat:@"%@ = %d;", @"key", i]), ([NSString stringWithFormat:format, @"key", i]), nil);
+      STAssertEqualObjects(([NSString stringWithFormat:@"abc%ndef", &position]), @"abcdef", nil);
+      STAssertEquals(position, 3, nil);
+   }
+
+   STAssertEquals([[NSString stringWithFormat:longFormat, 12345] length], (NSUInteger)1005, nil);
+   STAssertEqualObjects(([NSMutableString stringWithFormat:@"%@/%@", @"a", @"b"]), @"a/b", nil);
+}
+
+@end
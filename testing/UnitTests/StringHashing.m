@@ -0,0 +1,140 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "StringHashing.h"
+#import <objc/runtime.h>
+
+@implementation StringHashing
+
+static NSArray *equalStrings(NSString *string)
+{
+   NSMutableArray *result=[NSMutableArray arrayWithObject:string];
+   NSUInteger length=[string length];
+   unichar characters[length];
+   NSStringEncoding encodings[]={ NSISOLatin1StringEncoding, NSWindowsCP1252StringEncoding, NSMacOSRomanStringEncoding, NSNEXTSTEPStringEncoding, NSUTF8StringEncoding };
+
+   [string getCharacters:characters];
+   [result addObject:[NSString stringWithCharacters:characters length:length]];
+   [result addObject:[[[NSString alloc] initWithCharactersNoCopy:characters length:length freeWhenDone:NO] autorelease]];
+   [result addObject:[NSMutableString stringWithString:string]];
+   for(int i=0; i<sizeof(encodings)/sizeof(encodings[0]); i++) {
+      NSData *data=[string dataUsingEncoding:encodings[i]];
+
+      if(data!=nil)
+         [result addObject:[[[NSString alloc] initWithData:data encoding:encodings[i]] autorelease]];
+   }
+
+   return result;
+}
+
+// Equal strings hash the same whatever the class, including tagged and constant strings
+-(void)testSameHashAcrossClasses
+{
+   NSArray *strings=[NSArray arrayWithObjects:@"", @"a", @"key", @"1234567", @"12345678", @"A sixteen chars!", @"/usr/local/share/doc/cocotron/Foundation/NSString.html", [NSString stringWithFormat:@"caf%C na%Cve", (unichar)0xE9, (unichar)0xEF], nil];
+
+   for(NSString *string in strings) {
+      NSUInteger hash=[string hash];
+
+      for(NSString *equal in equalStrings(string)) {
+         STAssertEqualObjects(equal, string, nil);
+         STAssertEquals([equal hash], hash, @"%@ %@", [equal class], string);
+      }
+   }
+}
+
+// The whole string is hashed, not just a prefix
+-(void)testLongCommonPrefixes
+{
+   NSString *prefix=[@"" stringByPaddingToLength:200 withString:@"/Library/Application Support/" startingAtIndex:0];
+   NSMutableSet *hashes=[NSMutableSet set];
+
+   for(int i=0; i<1000; i++)
+      [hashes addObject:[NSNumber numberWithUnsignedInteger:[[prefix stringByAppendingFormat:@"%d", i] hash]]];
+
+   STAssertEquals([hashes count], (NSUInteger)1000, nil);
+}
+
+// An immutable string's cached hash is the one a fresh string computes, a mutable string's
+// follows its contents
+-(void)testHashIsCached
+{
+   NSString *string=[[@"" stringByPaddingToLength:100000 withString:@"abcdefgh" startingAtIndex:0] copy];
+   NSUInteger hash=[string hash];
+   NSMutableString *mutable=[NSMutableString stringWithString:string];
+
+   STAssertEquals([mutable hash], hash, nil);
+   STAssertEquals([[[string mutableCopy] autorelease] hash], hash, nil);
+   for(int i=0; i<1000; i++)
+      STAssertEquals([string hash], hash, nil);
+
+   [mutable appendString:@"i"];
+   STAssertEquals([mutable hash], [[string stringByAppendingString:@"i"] hash], nil);
+   STAssertTrue([mutable hash]!=hash, nil);
+   STAssertEquals([string hash], hash, nil);
+   [string release];
+}
+
+static NSArray *pathCorpus(void)
+{
+   NSMutableArray *result=[NSMutableArray array];
+   NSString *root=[[NSBundle bundleForClass:[StringHashing class]] bundlePath];
+   NSDirectoryEnumerator *files=[[NSFileManager defaultManager] enumeratorAtPath:[root stringByDeletingLastPathComponent]];
+   NSString *path;
+
+   while((path=[files nextObject])!=nil && [result count]<50000)
+      [result addObject:path];
+
+   return result;
+}
+
+static NSArray *keyCorpus(void)
+{
+   NSMutableSet *result=[NSMutableSet set];
+   Class classes[]={ [NSString class], [NSArray class], [NSDictionary class], [NSObject class], [NSFileManager class] };
+
+   for(int i=0; i<sizeof(classes)/sizeof(classes[0]); i++) {
+      unsigned int count;
+      Method *methods=class_copyMethodList(classes[i], &count);
+
+      for(unsigned int j=0; j<count; j++)
+         [result addObject:NSStringFromSelector(method_getName(methods[j]))];
+      free(methods);
+   }
+
+   return [result allObjects];
+}
+
+// Distinct strings which hash the same, and the time for uncached hashes of copies of the strings
+-(void)testCorpusCollisionsAndSpeed
+{
+   NSArray *corpora=[NSArray arrayWithObjects:pathCorpus(), keyCorpus(), nil];
+   NSArray *names=[NSArray arrayWithObjects:@"paths", @"keys", nil];
+
+   for(int c=0; c<2; c++) {
+      NSArray *corpus=[corpora objectAtIndex:c];
+      NSUInteger count=[corpus count], characters=0, sink=0;
+      NSMutableSet *hashes=[NSMutableSet set];
+      NSMutableArray *copies=[NSMutableArray array];
+
+      for(NSString *string in corpus) {
+         [hashes addObject:[NSNumber numberWithUnsignedInteger:[string hash]]];
+         characters+=[string length];
+         [copies addObject:[NSMutableString stringWithString:string]];
+      }
+
+      NSDate *start=[NSDate date];
+      for(int r=0; r<10; r++)
+         for(NSString *string in copies)
+            sink+=[string hash];
+      NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+
+      NSLog(@"%@: %lu strings, %lu colliding, %.1f ns per hash, %.2f ns per character", [names objectAtIndex:c], (unsigned long)count, (unsigned long)(count-[hashes count]), (count==0)?0:elapsed*1e9/(10*count), (characters==0)?0:elapsed*1e9/(10*characters));
+      STAssertTrue(count-[hashes count]<=count/10000+1, nil);
+   }
+}
+
+@end
@@ -0,0 +1,137 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "StringSearching.h"
+
+@implementation StringSearching
+
+-(void)testRangeOfString
+{
+   NSString *string=@"one two three two one";
+   NSRange all=NSMakeRange(0, [string length]);
+
+   STAssertEquals([string rangeOfString:@"two"], NSMakeRange(4, 3), nil);
+   STAssertEquals([string rangeOfString:@"two" options:NSBackwardsSearch], NSMakeRange(14, 3), nil);
+   STAssertEquals([string rangeOfString:@"two" options:0 range:NSMakeRange(5, 16)], NSMakeRange(14, 3), nil);
+   STAssertEquals([string rangeOfString:@"two" options:NSBackwardsSearch range:NSMakeRange(0, 16)], NSMakeRange(4, 3), nil);
+   STAssertEquals([string rangeOfString:@"four"].location, (NSUInteger)NSNotFound, nil);
+   STAssertEquals([string rangeOfString:@""].location, (NSUInteger)NSNotFound, nil);
+
+   // anchored searches match at the start of the range, or its end searching backwards
+   STAssertEquals([string rangeOfString:@"one" options:NSAnchoredSearch range:all], NSMakeRange(0, 3), nil);
+   STAssertEquals([string rangeOfString:@"two" options:NSAnchoredSearch range:NSMakeRange(4, 10)], NSMakeRange(4, 3), nil);
+   STAssertEquals([string rangeOfString:@"one" options:NSAnchoredSearch|NSBackwardsSearch range:all], NSMakeRange(18, 3), nil);
+   STAssertEquals([string rangeOfString:@"two" options:NSAnchoredSearch range:all].location, (NSUInteger)NSNotFound, nil);
+
+   NSArray *parts=[@"a/bb//ccc/" componentsSeparatedByString:@"/"];
+   STAssertEqualObjects(parts, ([NSArray arrayWithObjects:@"a", @"bb", @"", @"ccc", @"", nil]), nil);
+}
+
+-(void)testCaseInsensitive
+{
+   NSString *string=[NSString stringWithFormat:@"Log: CAF%C ouvert, caf%C ferm%C", (unichar)0xC9, (unichar)0xE9, (unichar)0xE9];
+   NSString *pattern=[NSString stringWithFormat:@"caf%C", (unichar)0xE9];
+
+   STAssertEquals([string rangeOfString:pattern options:NSCaseInsensitiveSearch], NSMakeRange(5, 4), nil);
+   STAssertEquals([string rangeOfString:pattern options:NSCaseInsensitiveSearch|NSBackwardsSearch], NSMakeRange(18, 4), nil);
+   STAssertEquals([string rangeOfString:@"OUVERT" options:NSCaseInsensitiveSearch], NSMakeRange(10, 6), nil);
+   STAssertEquals([string rangeOfString:@"OUVERT"].location, (NSUInteger)NSNotFound, nil);
+
+   STAssertEqualObjects([pattern uppercaseString], ([NSString stringWithFormat:@"CAF%C", (unichar)0xC9]), nil);
+   STAssertEqualObjects([[pattern uppercaseString] lowercaseString], pattern, nil);
+}
+
+// Patterns which nearly match everywhere, the match is found after many partial ones
+-(void)testRepetitivePatterns
+{
+   NSMutableString *text=[NSMutableString string];
+   NSMutableString *pattern=[NSMutableString string];
+
+   for(int i=0; i<100000; i++)
+      [text appendString:@"a"];
+   for(int i=0; i<200; i++)
+      [pattern appendString:@"a"];
+   [pattern replaceCharactersInRange:NSMakeRange(198, 1) withString:@"b"];
+
+   STAssertEquals([text rangeOfString:pattern].location, (NSUInteger)NSNotFound, nil);
+   STAssertEquals([text rangeOfString:pattern options:NSBackwardsSearch].location, (NSUInteger)NSNotFound, nil);
+
+   // the pattern's b lines up with the first b in the text, which is preceded by more a's than it needs
+   [text replaceCharactersInRange:NSMakeRange(70000, 1) withString:@"b"];
+   [text replaceCharactersInRange:NSMakeRange(80000, 1) withString:@"b"];
+   STAssertEquals([text rangeOfString:pattern], NSMakeRange(69802, 200), nil);
+   STAssertEquals([text rangeOfString:pattern options:NSBackwardsSearch], NSMakeRange(79802, 200), nil);
+   STAssertEquals([text rangeOfString:pattern options:0 range:NSMakeRange(69803, 30197)], NSMakeRange(79802, 200), nil);
+   STAssertEquals([text rangeOfString:pattern options:NSBackwardsSearch range:NSMakeRange(0, 80001)], NSMakeRange(69802, 200), nil);
+   [text replaceCharactersInRange:NSMakeRange(70000, 1) withString:@"a"];
+   [text replaceCharactersInRange:NSMakeRange(80000, 1) withString:@"a"];
+
+   [text replaceCharactersInRange:NSMakeRange(50000, 200) withString:pattern];
+   STAssertEquals([text rangeOfString:pattern], NSMakeRange(50000, 200), nil);
+   STAssertEquals([text rangeOfString:[pattern uppercaseString] options:NSCaseInsensitiveSearch|NSBackwardsSearch], NSMakeRange(50000, 200), nil);
+}
+
+-(void)testCompare
+{
+   STAssertEquals([@"abc" compare:@"abd"], (NSComparisonResult)NSOrderedAscending, nil);
+   STAssertEquals([@"abc" compare:@"ab"], (NSComparisonResult)NSOrderedDescending, nil);
+   STAssertEquals([@"abc" compare:@"abc"], (NSComparisonResult)NSOrderedSame, nil);
+   STAssertEquals([@"ABC" caseInsensitiveCompare:@"abc"], (NSComparisonResult)NSOrderedSame, nil);
+   STAssertEquals([@"a_c" caseInsensitiveCompare:@"ABC"], (NSComparisonResult)NSOrderedDescending, nil);
+   STAssertEquals([[NSString stringWithFormat:@"%C", (unichar)0xE9] caseInsensitiveCompare:[NSString stringWithFormat:@"%C", (unichar)0xC9]], (NSComparisonResult)NSOrderedSame, nil);
+   STAssertEquals([@"file10" compare:@"file9" options:NSNumericSearch], (NSComparisonResult)NSOrderedDescending, nil);
+   STAssertEquals([@"xxabcxx" compare:@"ABC" options:NSCaseInsensitiveSearch range:NSMakeRange(2, 3)], (NSComparisonResult)NSOrderedSame, nil);
+
+   NSMutableString *left=[NSMutableString string];
+   for(int i=0; i<1000; i++)
+      [left appendString:@"path/component/"];
+   NSString *right=[[left uppercaseString] stringByAppendingString:@"x"];
+
+   STAssertEquals([left caseInsensitiveCompare:[right substringToIndex:[left length]]], (NSComparisonResult)NSOrderedSame, nil);
+   STAssertEquals([left caseInsensitiveCompare:right], (NSComparisonResult)NSOrderedAscending, nil);
+   STAssertEquals([left compare:right], (NSComparisonResult)NSOrderedDescending, nil);
+}
+
+-(void)testSearchSpeed
+{
+   NSUInteger lengths[]={ 64, 4096, 1<<20 };
+   NSUInteger patternLengths[]={ 1, 4, 16, 64, 256 };
+   unichar *characters=malloc((1<<20)*sizeof(unichar));
+   unichar pattern[256];
+
+   srandom(24);
+   for(int i=0; i<(1<<20); i++)
+      characters[i]=(random()%6==0) ? ' ' : 'a'+random()%26;
+
+   for(int caseInsensitive=0; caseInsensitive<2; caseInsensitive++) {
+      for(int l=0; l<3; l++) {
+         NSString *text=[NSString stringWithCharacters:characters length:lengths[l]];
+
+         for(int p=0; p<5 && patternLengths[p]<=lengths[l]; p++) {
+            // never found, so every search reads the whole text
+            for(int i=0; i<patternLengths[p]; i++)
+               pattern[i]='a'+random()%26;
+            pattern[patternLengths[p]/2]='~';
+
+            NSString *search=[NSString stringWithCharacters:pattern length:patternLengths[p]];
+            NSStringCompareOptions options=caseInsensitive ? NSCaseInsensitiveSearch : 0;
+            int count=(int)(20000000/lengths[l])+1;
+
+            NSDate *start=[NSDate date];
+            for(int r=0; r<count; r++)
+               STAssertEquals([text rangeOfString:search options:options].location, (NSUInteger)NSNotFound, nil);
+            NSTimeInterval elapsed=-[start timeIntervalSinceNow];
+
+            NSLog(@"%@ search of %u characters for %u: %.1f ns", caseInsensitive ? @"case insensitive" : @"literal", (unsigned)lengths[l], (unsigned)patternLengths[p], elapsed*1e9/count);
+         }
+      }
+   }
+
+   free(characters);
+}
+
+@end
@@ -0,0 +1,92 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+#import "StringStorage.h"
+
+@implementation StringStorage
+
+// Strings with every character below 0x100 are stored a byte each, primitives see the same characters
+-(void)testCompactStrings
+{
+   unichar characters[300];
+
+   for(int i=0; i<300; i++)
+      characters[i]=(i*7)%256;
+
+   NSString *compact=[NSString stringWithCharacters:characters length:300];
+   NSString *wide=[NSString stringWithFormat:@"%@%C", compact, (unichar)0x20AC];
+   unichar check[300];
+
+   STAssertEquals([compact length], (NSUInteger)300, nil);
+   for(int i=0; i<300; i++)
+      STAssertEquals([compact characterAtIndex:i], characters[i], nil);
+   [compact getCharacters:check range:NSMakeRange(100, 200)];
+   STAssertTrue(memcmp(check, characters+100, 200*sizeof(unichar))==0, nil);
+
+   STAssertEqualObjects([wide substringToIndex:300], compact, nil);
+   STAssertEqualObjects(compact, [wide substringToIndex:300], nil);
+   STAssertFalse([compact isEqual:[wide substringFromIndex:1]], nil);
+   STAssertEquals([compact hash], [[wide substringToIndex:300] hash], nil);
+
+   NSString *latin1=[[[NSString alloc] initWithData:[compact dataUsingEncoding:NSISOLatin1StringEncoding] encoding:NSISOLatin1StringEncoding] autorelease];
+   STAssertEqualObjects(latin1, compact, nil);
+   STAssertEquals([compact lengthOfBytesUsingEncoding:NSUTF8StringEncoding], [[compact dataUsingEncoding:NSUTF8StringEncoding] length], nil);
+}
+
+-(void)testUTF8RoundTrip
+{
+   NSString *string=[NSString stringWithFormat:@"ascii caf%C %C %C%C end", (unichar)0xE9, (unichar)0x20AC, (unichar)0xD83D, (unichar)0xDE00];
+   NSData *utf8=[string dataUsingEncoding:NSUTF8StringEncoding];
+   const char expected[]="ascii caf\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80 end";
+
+   STAssertEquals([utf8 length], (NSUInteger)(sizeof(expected)-1), nil);
+   STAssertTrue(memcmp([utf8 bytes], expected, sizeof(expected)-1)==0, nil);
+   STAssertEqualObjects([NSString stringWithUTF8String:expected], string, nil);
+   STAssertTrue(strcmp([string UTF8String], expected)==0, nil);
+}
+
+// Each maximal invalid subsequence becomes one U+FFFD
+-(void)testMalformedUTF8
+{
+   NSString *decoded=[NSString stringWithUTF8String:"a\xC3(b\xE2\x82z\xED\xA0\x80y\xF4\x90\x80\x80x\xC0\xAF"];
+   NSString *expected=[NSString stringWithFormat:@"a%C(b%Cz%C%C%Cy%C%C%C%Cx%C%C", 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD];
+
+   STAssertEqualObjects(decoded, expected, nil);
+
+   NSString *lone=[NSString stringWithFormat:@"x%Cy", (unichar)0xD800];
+   STAssertTrue(strcmp([lone UTF8String], "x\xEF\xBF\xBDy")==0, nil);
+}
+
+-(void)testZeroCopyUTF8String
+{
+   NSString *string=[NSString stringWithUTF8String:"a string of plain ASCII characters, longer than a tagged string"];
+
+   STAssertTrue([string UTF8String]==[string UTF8String], nil);
+   STAssertTrue([@"constant" UTF8String]==[@"constant" UTF8String], nil);
+   STAssertTrue([string cStringUsingEncoding:NSASCIIStringEncoding]==[string UTF8String], nil);
+}
+
+// Long enough for the bulk ASCII paths, with one multibyte character well past the start
+-(void)testLongUTF8
+{
+   NSMutableData *utf8=[NSMutableData dataWithLength:100000];
+   char *bytes=[utf8 mutableBytes];
+
+   for(int i=0; i<[utf8 length]; i++)
+      bytes[i]='a'+i%26;
+   memcpy(bytes+70001, "\xC3\xA9", 2);
+
+   NSString *string=[[[NSString alloc] initWithData:utf8 encoding:NSUTF8StringEncoding] autorelease];
+
+   STAssertEquals([string length], [utf8 length]-1, nil);
+   STAssertEquals([string characterAtIndex:70000], (unichar)('a'+70000%26), nil);
+   STAssertEquals([string characterAtIndex:70001], (unichar)0xE9, nil);
+   STAssertEquals([[string dataUsingEncoding:NSUTF16LittleEndianStringEncoding] length], ([utf8 length]-1)*2, nil);
+   STAssertEqualObjects([string dataUsingEncoding:NSUTF8StringEncoding], utf8, nil);
+}
+
+@end
@@ -0,0 +1,109 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import "Synchronized.h"
+#import <Foundation/NSDebug.h>
+
+#define THREADS 4
+#define ITERATIONS 100000
+
+@implementation Synchronized
+
+-(void)testRecursive
+{
+   id object=[[NSObject new] autorelease];
+   int depth=0;
+
+   @synchronized(object) {
+      @synchronized(object) {
+         @synchronized(self) {
+            @synchronized(object) {
+               depth=3;
+            }
+         }
+      }
+   }
+   STAssertEquals(depth, 3, nil);
+}
+
+-(void)testExceptionLeavesBlock
+{
+   id object=[[NSObject new] autorelease];
+   BOOL caught=NO;
+
+   @try {
+      @synchronized(object) {
+         [NSException raise:NSGenericException format:@"inside @synchronized"];
+      }
+   }
+   @catch(NSException *exception) {
+      caught=YES;
+   }
+   STAssertTrue(caught, nil);
+
+   // still usable, and not left locked by this thread
+   @synchronized(object) {
+      caught=NO;
+   }
+   STAssertFalse(caught, nil);
+}
+
+-(void)increment:(id)unused
+{
+   NSAutoreleasePool *pool=[NSAutoreleasePool new];
+
+   for(int i=0; i<ITERATIONS; i++) {
+      int which=i%4;
+
+      @synchronized([objects objectAtIndex:which]) {
+         counters[which]++;
+      }
+   }
+
+   [finished lock];
+   [finished unlockWithCondition:[finished condition]+1];
+   [pool release];
+}
+
+-(void)testMutualExclusion
+{
+   NSUInteger count, contentions=0;
+
+   objects=[[NSMutableArray alloc] init];
+   for(int i=0; i<4; i++)
+      [objects addObject:[[NSObject new] autorelease]];
+   finished=[[NSConditionLock alloc] initWithCondition:0];
+
+   NSResetSynchronizationStatistics();
+   NSSetSynchronizationStatisticsEnabled(YES);
+   for(int i=0; i<THREADS; i++)
+      [NSThread detachNewThreadSelector:@selector(increment:) toTarget:self withObject:nil];
+   [finished lockWhenCondition:THREADS];
+   [finished unlock];
+   NSSetSynchronizationStatisticsEnabled(NO);
+
+   for(int i=0; i<4; i++)
+      STAssertEquals(counters[i], (unsigned long)(THREADS*ITERATIONS/4), nil);
+
+   NSSynchronizationStatistics *statistics=NSCopySynchronizationStatistics(&count);
+   NSUInteger acquisitions=0;
+
+   for(NSUInteger i=0; i<count; i++) {
+      acquisitions+=statistics[i].acquisitions;
+      contentions+=statistics[i].contentions;
+   }
+   free(statistics);
+   NSResetSynchronizationStatistics();
+
+   STAssertEquals(acquisitions, (NSUInteger)(THREADS*ITERATIONS), nil);
+   STAssertTrue(contentions<=acquisitions, nil);
+   [finished release];
+   [objects release];
+}
+
+@end
@@ -0,0 +1,121 @@
+/* Copyright (c) 2026 Cocotron contributors
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import "TaggedPointers.h"
+#import <objc/runtime.h>
+#import <objc/objc_arc.h>
+
+@implementation TaggedPointers
+
+-(void)testNumbers
+{
+   NSNumber *small=[NSNumber numberWithInt:7];
+   NSNumber *big=[NSNumber numberWithLongLong:1LL<<60];
+   NSNumber *bigDouble=[NSNumber numberWithDouble:(double)(1LL<<60)];
+
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   STAssertTrue(objc_isTaggedPointer(small), nil);
+   STAssertFalse(objc_isTaggedPointer(big), nil);
+   STAssertTrue(objc_isTaggedPointer(bigDouble), nil);
+#endif
+   STAssertEquals([small intValue], 7, nil);
+   STAssertEquals(strcmp([small objCType],@encode(int)), 0, nil);
+   STAssertEquals([[NSNumber numberWithChar:-3] intValue], -3, nil);
+   STAssertEquals([[NSNumber numberWithUnsignedChar:200] charValue], (char)200, nil);
+   STAssertEquals([[NSNumber numberWithFloat:0.1f] floatValue], 0.1f, nil);
+   STAssertEqualObjects([small description], @"7", nil);
+   STAssertEqualObjects([[NSNumber numberWithFloat:2.5f] description], @"2.5", nil);
+
+   // tagged and heap instances of the same value must be interchangeable as keys
+   STAssertEqualObjects(small, [NSNumber numberWithDouble:7.0], nil);
+   STAssertEquals([small hash], [[NSNumber numberWithDouble:7.0] hash], nil);
+   STAssertEqualObjects(big, bigDouble, nil);
+   STAssertEqualObjects(bigDouble, big, nil);
+   STAssertEquals([big hash], [bigDouble hash], nil);
+}
+
+-(void)testStrings
+{
+   NSString *tagged=[NSString stringWithUTF8String:"key"];
+   NSString *heap=[NSString stringWithUTF8String:"not so short"];
+   unichar   characters[3];
+
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   STAssertTrue(objc_isTaggedPointer(tagged), nil);
+   STAssertFalse(objc_isTaggedPointer(heap), nil);
+   STAssertFalse(objc_isTaggedPointer([NSString stringWithUTF8String:"caf\xC3\xA9"]), nil);
+   STAssertFalse(objc_isTaggedPointer([NSMutableString stringWithString:@"key"]), nil);
+#endif
+   STAssertEquals([tagged length], (NSUInteger)3, nil);
+   [tagged getCharacters:characters];
+   STAssertEquals(characters[2], (unichar)'y', nil);
+   STAssertEqualObjects([heap substringToIndex:3], @"not", nil);
+   STAssertEqualObjects([tagged stringByAppendingString:@"s"], @"keys", nil);
+   STAssertThrows([tagged characterAtIndex:3], nil);
+
+   STAssertEqualObjects(tagged, @"key", nil);
+   STAssertEqualObjects(@"key", tagged, nil);
+   STAssertEquals([tagged hash], [@"key" hash], nil);
+   STAssertEquals([tagged hash], [[NSMutableString stringWithString:@"key"] hash], nil);
+   STAssertFalse([tagged isEqual:[NSString stringWithUTF8String:"kez"]], nil);
+}
+
+-(void)testDates
+{
+   NSDate *date=[NSDate dateWithTimeIntervalSinceReferenceDate:0.1];
+   NSDate *heap=[NSCalendarDate dateWithTimeIntervalSinceReferenceDate:0.1];
+
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   STAssertTrue(objc_isTaggedPointer(date), nil);
+   STAssertFalse(objc_isTaggedPointer([NSDate dateWithTimeIntervalSinceReferenceDate:-0.0]), nil);
+#endif
+   STAssertEquals([date timeIntervalSinceReferenceDate], 0.1, nil);
+   STAssertEquals([[date addTimeInterval:1e9] timeIntervalSinceReferenceDate], 0.1+1e9, nil);
+   STAssertEquals([[NSDate distantPast] timeIntervalSinceReferenceDate], -(2010.0L*365.0*24.0*60.0*60.0), nil);
+
+   STAssertEqualObjects(date, heap, nil);
+   STAssertEqualObjects(heap, date, nil);
+   STAssertEquals([date hash], [heap hash], nil);
+   STAssertEquals([date compare:[NSDate dateWithTimeIntervalSinceReferenceDate:1]], NSOrderedAscending, nil);
+}
+
+-(void)testRetainReleaseAndWeak
+{
+   NSNumber *number=[NSNumber numberWithInt:42];
+   id        weak;
+
+   [[number retain] release];
+#ifdef OBJC_HAVE_TAGGED_POINTERS
+   // retain counts are ignored
+   [number release];
+#endif
+   STAssertEquals([number intValue], 42, nil);
+   STAssertEquals([number copy], number, nil);
+   STAssertEquals([number class], object_getClass(number), nil);
+   STAssertTrue([number isKindOfClass:[NSNumber class]], nil);
+   STAssertTrue([number respondsToSelector:@selector(intValue)], nil);
+
+   objc_initWeak(&weak,number);
+   STAssertEquals(objc_loadWeak(&weak), number, nil);
+   objc_destroyWeak(&weak);
+}
+
+-(void)testObserveNumber
+{
+   NSNumber *number=[NSNumber numberWithInt:42];
+   Class     class=object_getClass(number);
+
+   // KVO must not try to swizzle the class of a tagged pointer
+   [number addObserver:self forKeyPath:@"intValue" options:0 context:NULL];
+   STAssertEquals(object_getClass(number), class, nil);
+   STAssertEquals([number intValue], 42, nil);
+   [number removeObserver:self forKeyPath:@"intValue"];
+   STAssertTrue([number observationInfo]==NULL, nil);
+}
+
+@end
@@ -0,0 +1,85 @@
+/* Copyright (c) 2026 Cocotron contributors
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ 
+ The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ 
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import "WeakReferences.h"
+#import <objc/objc_arc.h>
+
+@implementation WeakReferences
+
+-(void)testWeakIsZeroedOnDealloc
+{
+   id object=[NSObject new];
+   id weak;
+
+   objc_initWeak(&weak,object);
+   STAssertEquals(weak, object, nil);
+
+   id loaded=objc_loadWeakRetained(&weak);
+   STAssertEquals(loaded, object, nil);
+   [loaded release];
+   STAssertEquals([object retainCount], (NSUInteger)1, nil);
+
+   [object release];
+   STAssertNil(weak, nil);
+   STAssertNil(objc_loadWeakRetained(&weak), nil);
+   objc_destroyWeak(&weak);
+}
+
+-(void)testCopyAndMoveWeak
+{
+   id object=[NSObject new];
+   id first,second,third;
+
+   objc_initWeak(&first,object);
+   objc_copyWeak(&second,&first);
+   objc_moveWeak(&third,&first);
+   STAssertNil(first, nil);
+   STAssertEquals(second, object, nil);
+   STAssertEquals(third, object, nil);
+
+   [object release];
+   STAssertNil(second, nil);
+   STAssertNil(third, nil);
+   objc_destroyWeak(&second);
+   objc_destroyWeak(&third);
+}
+
+-(void)testWeakValueMapTable
+{
+   NSMapTable *table=[NSMapTable mapTableWithStrongToWeakObjects];
+   id pool=[NSAutoreleasePool new];
+   id value=[NSObject new];
+
+   [table setObject:value forKey:@"key"];
+   STAssertEquals([table objectForKey:@"key"], value, nil);
+   [pool drain];
+
+   [value release];
+   STAssertNil([table objectForKey:@"key"], nil);
+   STAssertEquals([NSAllMapTableValues(table) count], (NSUInteger)0, nil);
+}
+
+-(void)testWeakKeyMapTable
+{
+   NSMapTable *table=[NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory|NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+   id key=[NSObject new];
+   NSUInteger i;
+
+   [table setObject:@"value" forKey:key];
+   STAssertEqualObjects([table objectForKey:key], @"value", nil);
+
+   [key release];
+   STAssertNil([[table keyEnumerator] nextObject], nil);
+
+   // zeroed entries are purged when the table has to grow
+   for(i=0;i<16;i++)
+    [table setObject:@"value" forKey:[NSString stringWithFormat:@"%d",(int)i]];
+   STAssertEquals(NSCountMapTable(table), (NSUInteger)16, nil);
+}
+
+@end
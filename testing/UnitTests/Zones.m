@@ -0,0 +1,127 @@
+/* Copyright (c) 2026 Cocotron contributors
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#import "Zones.h"
+
+@interface ZonesExtraBytesObject : NSObject
+@end
+
+@implementation ZonesExtraBytesObject
+@end
+
+@implementation Zones
+
+-(void)testDefaultZone
+{
+   id object=[NSObject new];
+   void *memory=NSZoneMalloc(NULL, 64);
+
+   STAssertTrue(NSZoneFromPointer(memory)==NSDefaultMallocZone(), nil);
+   STAssertTrue([object zone]==NSDefaultMallocZone(), nil);
+   NSZoneFree(NULL, memory);
+   [object release];
+}
+
+-(void)testObjectsInZone
+{
+   NSZone *zone=NSCreateZone(0, 0, YES);
+   NSMutableArray *array=[[NSMutableArray allocWithZone:zone] init];
+
+   STAssertTrue([array zone]==zone, nil);
+   for(int i=0; i<1000; i++) {
+      id object=[[NSObject allocWithZone:zone] init];
+
+      STAssertTrue([object zone]==zone, nil);
+      [array addObject:object];
+      [object release];
+   }
+   STAssertEquals([array count], (NSUInteger)1000, nil);
+
+   // freeing into the wrong zone goes by the pointer
+   void *memory=NSZoneCalloc(zone, 10, 10);
+   STAssertTrue(NSZoneFromPointer(memory)==zone, nil);
+   STAssertEquals(((char *)memory)[99], (char)0, nil);
+   NSZoneFree(NULL, memory);
+
+   [array release];
+   NSSetZoneName(zone, @"test");
+   STAssertEqualObjects(NSZoneName(zone), @"test", nil);
+   NSRecycleZone(zone);
+}
+
+-(void)testReallocKeepsContents
+{
+   NSZone *zone=NSCreateZone(0, 0, YES);
+   char *memory=NSZoneMalloc(zone, 16);
+
+   strcpy(memory, "zone");
+   for(NSUInteger size=32; size<=(1<<20); size*=2) {
+      memory=NSZoneRealloc(zone, memory, size);
+      STAssertTrue(NSZoneFromPointer(memory+size-1)==zone, nil);
+   }
+   STAssertTrue(strcmp(memory, "zone")==0, nil);
+   NSRecycleZone(zone);
+}
+
+-(void)testFreedInstancesAreReused
+{
+   NSUInteger count, hits=0;
+   id first, second;
+
+   NSResetObjectCacheStatistics();
+   NSSetObjectCacheStatisticsEnabled(YES);
+   first=[NSObject new];
+   [first release];
+   second=[NSObject new];
+   NSSetObjectCacheStatisticsEnabled(NO);
+
+   STAssertEquals(first, second, nil);
+   STAssertEquals([second retainCount], (NSUInteger)1, nil);
+   [second release];
+
+   NSObjectCacheStatistics *statistics=NSCopyObjectCacheStatistics(&count);
+   for(NSUInteger i=0; i<count; i++)
+      if(statistics[i].cls==[NSObject class])
+         hits=statistics[i].hits;
+   free(statistics);
+   STAssertTrue(hits>=1, nil);
+
+   NSTrimObjectCaches();
+}
+
+-(void)testExtraBytesAreNotReused
+{
+   Class class=[ZonesExtraBytesObject class];
+   NSUInteger count, hits=0, misses=0;
+   id object;
+
+   NSResetObjectCacheStatistics();
+   NSSetObjectCacheStatisticsEnabled(YES);
+   // too big for the cache, and the block must not be filed under the instance size either
+   object=NSAllocateObject(class, 1024, NULL);
+   NSDeallocateObject(object);
+   object=NSAllocateObject(class, 0, NULL);
+   NSDeallocateObject(object);
+   object=NSAllocateObject(class, 0, NULL);
+   NSDeallocateObject(object);
+   NSSetObjectCacheStatisticsEnabled(NO);
+
+   NSObjectCacheStatistics *statistics=NSCopyObjectCacheStatistics(&count);
+   for(NSUInteger i=0; i<count; i++)
+      if(statistics[i].cls==class) {
+         hits=statistics[i].hits;
+         misses=statistics[i].misses;
+      }
+   free(statistics);
+   STAssertEquals(hits, (NSUInteger)0, nil);
+   STAssertEquals(misses, (NSUInteger)2, nil);
+
+   NSTrimObjectCaches();
+}
+
+@end